@@ -82,7 +82,9 @@ typedef enum
 typedef enum
 {
     UHOS_BLE_SUCCESS = 0, //<! 成功
-    UHOS_BLE_ERROR = -1   //<! 错误
+    UHOS_BLE_ERROR = -1,  //<! 错误
+    UHOS_BLE_BUSY = -2,   //<! 发送队列已满，稍后重试
+    UHOS_BLE_TIMEOUT = -3 //<! 等待对端响应超时
 } uhos_ble_status_t;
 
 /**
@@ -98,6 +100,37 @@ typedef struct uhos_ble_uuid
     };
 } uhos_ble_uuid_t;
 
+/**
+ * @enum 用户回调事件的分类
+ * @note 所有用户回调均由ble_daemon任务按优先级投递：连接类 > GATT数据类 > 广播上报
+ */
+typedef enum
+{
+    UHOS_BLE_EVENT_TYPE_CONN = 0,   //<! 连接与断连事件
+    UHOS_BLE_EVENT_TYPE_GATTS,      //<! GATT Server端读写事件
+    UHOS_BLE_EVENT_TYPE_GATTC,      //<! GATT Client端事件
+    UHOS_BLE_EVENT_TYPE_ADV_REPORT, //<! 广播上报事件（批量上报时按批次计）
+    UHOS_BLE_EVENT_TYPE_NUM
+} uhos_ble_event_type_t;
+
+/**
+ * @struct 用户回调事件的投递统计信息
+ * @note   时延为事件产生到开始回调的时间；回调耗时超过预算计入overruns
+ */
+typedef struct uhos_ble_event_stats
+{
+    uhos_u32 posted;         //<! 进入队列的事件数
+    uhos_u32 dispatched;     //<! 由ble_daemon任务投递的事件数
+    uhos_u32 dropped;        //<! 队列已满、内存不足或任务未运行而丢弃的事件数
+    uhos_u32 overruns;       //<! 回调耗时超过预算的次数
+    uhos_u16 depth;          //<! 当前排队的事件数
+    uhos_u16 max_depth;      //<! 最大排队事件数
+    uhos_u32 avg_latency_us; //<! 平均排队时延（微秒）
+    uhos_u32 max_latency_us; //<! 最大排队时延（微秒）
+    uhos_u32 avg_cb_us;      //<! 平均回调耗时（微秒）
+    uhos_u32 max_cb_us;      //<! 最大回调耗时（微秒）
+} uhos_ble_event_stats_t;
+
 /**************************************************************************************************/
 /* BLE GAP层广播相关数据类型定义                                                                  */
 /**************************************************************************************************/
@@ -131,6 +164,42 @@ typedef struct uhos_ble_gap_adv_param
     } ch_mask;
 } uhos_ble_gap_adv_param_t;
 
+/**
+ * @enum 物理层（PHY）类型，数值与Core Spec一致
+ */
+typedef enum
+{
+    UHOS_BLE_PHY_1M    = 1, //<! LE 1M
+    UHOS_BLE_PHY_2M    = 2, //<! LE 2M，仅可用于扩展广播的辅助通道
+    UHOS_BLE_PHY_CODED = 3, //<! LE Coded（远距离）
+} uhos_ble_gap_phy_t;
+
+/**
+ * @struct 扩展广播（BLE 5.0广播集）参数描述结构
+ * @note   connectable与scannable不可同时置位；legacy置位时按传统广播PDU发送，数据不可超过31字节
+ */
+typedef struct uhos_ble_gap_ext_adv_param
+{
+    uhos_u8 instance;                    //<! 广播集编号，0 ~ CONFIG_UHOS_BLE_EXT_ADV_SET_NUM-1
+    uhos_bool connectable;               //<! 可连接
+    uhos_bool scannable;                 //<! 可扫描
+    uhos_bool legacy;                    //<! 使用传统广播PDU
+    uhos_u32 adv_interval_min;           //<! 最小广播间隔，Time=N * 0.625msec
+    uhos_u32 adv_interval_max;           //<! 最大广播间隔，Time=N * 0.625msec
+    uhos_ble_addr_type_t own_addr_type;  //<! 本端地址类型
+    uhos_ble_gap_phy_t primary_phy;      //<! 主通道PHY：UHOS_BLE_PHY_1M/UHOS_BLE_PHY_CODED
+    uhos_ble_gap_phy_t secondary_phy;    //<! 辅助通道PHY
+    uhos_u8 sid;                         //<! 广播集标识（Advertising SID），0~15
+    uhos_s8 tx_power;                    //<! 发射功率（dBm），127表示由控制器决定
+
+    struct
+    {
+        uhos_u8 ch_37_off : 1; //<! 37广播通道关闭标志位，1表示关闭
+        uhos_u8 ch_38_off : 1; //<! 38广播通道关闭标志位，1表示关闭
+        uhos_u8 ch_39_off : 1; //<! 39广播通道关闭标志为，1表示关闭
+    } ch_mask;
+} uhos_ble_gap_ext_adv_param_t;
+
 /**************************************************************************************************/
 /* BLE GAP层扫描相关数据类型定义                                                                  */
 /**************************************************************************************************/
@@ -156,6 +225,22 @@ typedef struct uhos_ble_gap_scan_param
                             //<! 0x0000表示没有超时
 } uhos_ble_gap_scan_param_t;
 
+/**
+ * @struct 扩展扫描参数描述结构
+ * @note   phys为扫描的主通道PHY集合，同时扫描1M与Coded时两者使用相同的间隔与窗口
+ */
+typedef struct uhos_ble_gap_ext_scan_param
+{
+    uhos_ble_gap_scan_type_t scan_type; //<! 扫描类型
+    uhos_u16 scan_interval;             //<! 扫描间隔时间，Time=N * 1msec, 范围: 5msec~10.24sec
+    uhos_u16 scan_window;               //<! 扫描窗口，Time=N * 1msec, 范围: 5msec~10.24sec
+    uhos_u16 timeout;                   //<! 扫描超时时间（秒），0x0000表示没有超时
+    uhos_u8 phys;                       //<! 扫描PHY：bit0-1M，bit1-Coded；0等同于仅1M
+} uhos_ble_gap_ext_scan_param_t;
+
+#define UHOS_BLE_GAP_EXT_SCAN_PHY_1M        0x01 //<! 扩展扫描：1M PHY
+#define UHOS_BLE_GAP_EXT_SCAN_PHY_CODED     0x02 //<! 扩展扫描：Coded PHY
+
 /**************************************************************************************************/
 /* BLE GAP层连接相关数据类型定义                                                                  */
 /**************************************************************************************************/
@@ -184,6 +269,49 @@ typedef struct uhos_ble_gap_connect
     uhos_ble_gap_conn_param_t conn_param; //<! 连接参数
 } uhos_ble_gap_connect_t;
 
+/**
+ * @enum 连接参数策略为连接选择的档位
+ */
+typedef enum
+{
+    UHOS_BLE_CONN_PROFILE_NONE = 0, //<! 未调整，保持建立连接时的参数
+    UHOS_BLE_CONN_PROFILE_BURST,    //<! 突发传输：短连接间隔、无从设备时延，并开启数据长度扩展
+    UHOS_BLE_CONN_PROFILE_IDLE,     //<! 空闲：长连接间隔、较大的从设备时延
+    UHOS_BLE_CONN_PROFILE_MANUAL,   //<! 用户调用uhos_ble_gap_update_conn_params指定了参数，策略不再调整
+} uhos_ble_conn_profile_t;
+
+/**
+ * @struct 连接参数策略
+ * @note   吞吐率为notify/indicate发送与写入接收字节数之和；
+ *         吞吐率高于burst_bps或发送队列积压达到burst_queued时立即切换到突发档位，
+ *         吞吐率连续idle_hold_ms低于idle_bps后才回落到空闲档位
+ */
+typedef struct uhos_ble_conn_policy
+{
+    uhos_bool enable;                     //<! 是否开启策略
+    uhos_u32 burst_bps;                   //<! 进入突发档位的吞吐率门限（字节/秒）
+    uhos_u16 burst_queued;                //<! 进入突发档位的发送队列积压门限（包）
+    uhos_u32 idle_bps;                    //<! 回落到空闲档位的吞吐率门限（字节/秒），应小于burst_bps
+    uhos_u32 idle_hold_ms;                //<! 回落到空闲档位前需持续低于idle_bps的时间（毫秒）
+    uhos_u16 dle_len;                     //<! 突发档位请求的链路层数据长度（27~251），0表示不开启数据长度扩展
+    uhos_ble_gap_conn_param_t burst;      //<! 突发档位的连接参数
+    uhos_ble_gap_conn_param_t idle;       //<! 空闲档位的连接参数
+} uhos_ble_conn_policy_t;
+
+/**
+ * @struct 连接参数策略的一个统计窗口
+ */
+typedef struct uhos_ble_conn_policy_sample
+{
+    uhos_u32 time_ms;                     //<! 窗口结束时刻（uhos_current_time_get）
+    uhos_u32 throughput;                  //<! 窗口内的吞吐率（字节/秒）
+    uhos_u16 tx_latency_ms;               //<! 窗口内notify/indicate在发送队列中的平均等待时间（毫秒）
+    uhos_u16 queued;                      //<! 窗口结束时发送队列积压的包数
+    uhos_u16 interval;                    //<! 窗口结束时的连接间隔（单位1.25ms）
+    uhos_u16 latency;                     //<! 窗口结束时的从设备时延
+    uhos_ble_conn_profile_t profile;      //<! 窗口结束时的档位
+} uhos_ble_conn_policy_sample_t;
+
 /**************************************************************************************************/
 /* BLE GAP层用户回调相关数据类型定义                                                              */
 /**************************************************************************************************/
@@ -237,6 +365,39 @@ typedef struct uhos_ble_gap_adv_report
     uhos_u8 data_len;                      //<! 广播数据长度
 } uhos_ble_gap_adv_report_t;
 
+/**
+ * @struct 上报的扩展广播数据描述结构
+ * @note   分段上报的广播链已在AL层重组为完整载荷；data指向AL内部缓存，仅在回调期间有效
+ */
+typedef struct uhos_ble_gap_ext_adv_report
+{
+    uhos_ble_addr_t peer_addr;             //<! 地址
+    uhos_ble_addr_type_t addr_type;        //<! 地址类型
+    uhos_ble_gap_adv_data_type_t adv_type; //<! 广播数据类型
+    uhos_u16 event_type;                   //<! 协议栈上报的事件类型（可连接/可扫描/扫描响应等位组合）
+    uhos_ble_gap_phy_t primary_phy;        //<! 主通道PHY
+    uhos_ble_gap_phy_t secondary_phy;      //<! 辅助通道PHY
+    uhos_u8 sid;                           //<! 广播集标识
+    uhos_s8 tx_power;                      //<! 对端发射功率，127表示未知
+    uhos_s8 rssi;                          //<! 信号强度rssi数值（最后一段）
+    uhos_bool truncated;                   //<! 载荷不完整（控制器截断或超出AL缓存）
+    uhos_u16 data_len;                     //<! 广播数据长度
+    const uhos_u8 *data;                   //<! 广播数据
+} uhos_ble_gap_ext_adv_report_t;
+
+/**
+ * @struct 扩展扫描分段重组的统计信息
+ */
+typedef struct uhos_ble_gap_ext_scan_stats
+{
+    uhos_u32 fragments; //<! 收到的扩展广播分段数
+    uhos_u32 reports;   //<! 重组完成的扩展广播条数
+    uhos_u32 truncated; //<! 被截断的扩展广播条数
+    uhos_u32 evicted;   //<! 重组槽不足或超时被放弃的广播链数
+    uhos_u32 dropped;   //<! 重组槽全部待投递而丢弃的分段数
+    uhos_u32 legacy;    //<! 以传统PDU上报、转入普通广播上报通道的条数
+} uhos_ble_gap_ext_scan_stats_t;
+
 /**
  * @enum GAP层用户回调事件定义
  */
@@ -246,8 +407,151 @@ typedef enum
     UHOS_BLE_GAP_EVT_DISCONNET,          //<! 断连事件
     UHOS_BLE_GAP_EVT_CONN_PARAM_UPDATED, //<! 连接参数更新事件（未实现）
     UHOS_BLE_GAP_EVT_ADV_REPORT,         //<! 广播数据上报事件（未实现）
+    UHOS_BLE_GAP_EVT_ADV_REPORT_BATCH,   //<! 广播数据批量上报事件，需调用uhos_ble_gap_adv_report_batch_enable开启
+    UHOS_BLE_GAP_EVT_EXT_ADV_REPORT,     //<! 扩展广播数据上报事件（重组后的完整载荷），需调用uhos_ble_gap_ext_scan_start开启
 } uhos_ble_gap_evt_t;
 
+/**
+ * @struct 批量上报的广播数据描述结构
+ * @note   reports指向AL内部缓存，仅在回调期间有效，回调返回后不可再访问
+ */
+typedef struct uhos_ble_gap_adv_report_batch
+{
+    uhos_u16 num;                       //<! 本批次的广播数据条数
+    uhos_ble_gap_adv_report_t *reports; //<! 广播数据数组，共num条
+} uhos_ble_gap_adv_report_batch_t;
+
+/**
+ * @struct 广播上报通道的统计信息
+ */
+typedef struct uhos_ble_gap_adv_report_stats
+{
+    uhos_u32 received;  //<! 协议栈上报的广播数据条数
+    uhos_u32 delivered; //<! 已投递给用户回调的广播数据条数
+    uhos_u32 dropped;   //<! 缓存已满被丢弃的广播数据条数
+    uhos_u32 batches;   //<! 投递的批次数
+    uhos_u32 wakeups;   //<! 处理任务被唤醒的次数
+    uhos_u16 max_batch; //<! 单批次最大条数
+    uhos_u16 capacity;  //<! 缓存容量
+} uhos_ble_gap_adv_report_stats_t;
+
+/**
+ * @struct 广播上报去重配置
+ * @note   以(地址, 地址类型)区分设备；窗口期内载荷未变化且RSSI变化未超过阈值的广播不再上报
+ */
+typedef struct uhos_ble_gap_adv_dedup_cfg
+{
+    uhos_bool enable;    //<! 去重开关
+    uhos_u8 rssi_delta;  //<! 平滑RSSI变化阈值（dBm），超过即上报；0-不按RSSI上报
+    uhos_u32 window_ms;  //<! 去重窗口（毫秒），同一载荷至少间隔该时间才再次上报
+} uhos_ble_gap_adv_dedup_cfg_t;
+
+/**
+ * @struct 广播上报去重的统计信息
+ */
+typedef struct uhos_ble_gap_adv_dedup_stats
+{
+    uhos_u32 checked;    //<! 经过去重检查的广播条数
+    uhos_u32 forwarded;  //<! 上报的广播条数
+    uhos_u32 suppressed; //<! 作为重复数据丢弃的广播条数
+    uhos_u32 evicted;    //<! 缓存已满被替换的设备数
+    uhos_u16 entries;    //<! 当前缓存的设备数
+    uhos_u16 capacity;   //<! 缓存容量
+} uhos_ble_gap_adv_dedup_stats_t;
+
+/**
+ * @struct 广播透传过滤规则
+ * @note   内存布局与uhsd_ble_adv_scan_passthrough_rules_t/uhepp_ble_adv_scan_passthrough_rules_t一致；
+ *         UUID按空口字节序（小端）填写
+ */
+typedef struct uhos_ble_gap_adv_filter_rules
+{
+    uhos_u8 rule_relation; //<! 0-各类条件为“或”关系；1-各类条件为“与”关系
+
+    uhos_u32 cid_num;      //<! 厂商CID数量
+    uhos_u16 *cids;        //<! 厂商CID数组
+
+    uhos_u32 mac_num;      //<! MAC数量
+    struct
+    {
+        uhos_u8 mac_type;  //<! MAC类型，目前为0
+        uhos_u8 mac[6];    //<! MAC地址
+    } * macs;
+
+    uhos_u32 uuid_num;     //<! 服务UUID数量
+    struct
+    {
+        uhos_u8 uuid_type; //<! 0x00-16位UUID；0x01-32位UUID；0x02-128位UUID
+        uhos_u8 uuid[16];  //<! UUID
+    } * uuids;
+} uhos_ble_gap_adv_filter_rules_t;
+
+/**
+ * @struct 广播透传过滤的统计信息
+ */
+typedef struct uhos_ble_gap_adv_filter_stats
+{
+    uhos_u32 checked;  //<! 经过规则匹配的广播条数
+    uhos_u32 matched;  //<! 匹配规则的广播条数
+    uhos_u32 rejected; //<! 不匹配被丢弃的广播条数
+} uhos_ble_gap_adv_filter_stats_t;
+
+/**
+ * @brief  广播透传帧的发送函数，与uhepp_ble_adv_scan_passthrough_data一致
+ * @return 0-已交给发送队列；其他-发送队列已满，帧保留到下次重试
+ */
+typedef uhos_s32 (*uhos_ble_gap_adv_pack_sink_t)(uhos_u8 *data, uhos_u16 data_len);
+
+/**
+ * @struct 广播透传打包配置
+ * @note   帧格式：版本(1) 条数(1)，之后每条上报为 标志(1) [MAC(6) | MAC序号(1)] RSSI(1) [长度(1) 数据]；
+ *         标志bit0~1为广播数据类型，bit2为地址类型，bit6表示MAC与本帧中第(MAC序号)个不同MAC相同，
+ *         bit7表示数据与该MAC在本帧中上一条数据相同（不再携带长度与数据）
+ */
+typedef struct uhos_ble_gap_adv_pack_cfg
+{
+    uhos_ble_gap_adv_pack_sink_t sink; //<! 发送函数，UHOS_NULL表示关闭打包
+    uhos_u16 max_frame;                //<! 单帧长度上限（字节），不超过CONFIG_UHOS_BLE_ADV_PACK_FRAME_MAX
+    uhos_u16 max_delay_ms;             //<! 帧中第一条上报的最长等待时间（毫秒），0表示每条上报单独成帧
+} uhos_ble_gap_adv_pack_cfg_t;
+
+/**
+ * @struct 广播透传打包的统计信息
+ */
+typedef struct uhos_ble_gap_adv_pack_stats
+{
+    uhos_u32 reports;     //<! 打包发送的上报条数
+    uhos_u32 frames;      //<! 发送的帧数
+    uhos_u32 bytes;       //<! 发送的帧字节数
+    uhos_u32 mac_refs;    //<! MAC以序号编码的上报条数
+    uhos_u32 data_refs;   //<! 数据省略的上报条数
+    uhos_u32 busy;        //<! 发送队列已满的次数
+    uhos_u32 dropped;     //<! 帧已满无法发送或单条超过帧长而丢弃的上报条数
+    uhos_u32 max_wait_ms; //<! 上报从入帧到发送的最长等待时间（毫秒）
+    uhos_bool stopped;    //<! 当前处于流控暂停状态
+} uhos_ble_gap_adv_pack_stats_t;
+
+/**
+ * @struct 白名单的统计信息
+ * @note   扫描中断时长自暂停扫描起，到协议栈上报扫描重新启动为止
+ */
+typedef struct uhos_ble_gap_white_list_stats
+{
+    uhos_u32 syncs;             //<! 下发到控制器的同步次数（无差异的不计）
+    uhos_u32 windows;           //<! 为修改白名单暂停扫描的次数
+    uhos_u32 adds;              //<! 下发的添加操作数
+    uhos_u32 removes;           //<! 下发的删除操作数
+    uhos_u32 clears;            //<! 下发的清空操作数
+    uhos_u32 failures;          //<! 控制器拒绝的操作数
+    uhos_u32 host_filtered;     //<! 主机侧过滤丢弃的广播条数
+    uhos_u32 last_downtime_ms;  //<! 最近一次扫描中断时长（毫秒）
+    uhos_u32 max_downtime_ms;   //<! 最长扫描中断时长（毫秒）
+    uhos_u32 total_downtime_ms; //<! 累计扫描中断时长（毫秒）
+    uhos_u16 num;               //<! 白名单地址个数
+    uhos_u16 capacity;          //<! 控制器白名单容量
+    uhos_bool host_filter;      //<! 地址数超过控制器容量，当前由主机侧过滤
+} uhos_ble_gap_white_list_stats_t;
+
 /**
  * @struct GAP层回调事件的参数结构定义
  */
@@ -259,6 +563,8 @@ typedef struct uhos_ble_gap_evt_param
         uhos_ble_gap_connect_t connect;            //<! 连接数据
         uhos_ble_gap_disconnect_t disconnect;      //<! 断连数据
         uhos_ble_gap_adv_report_t report;          //<! 上报的广播数据
+        uhos_ble_gap_adv_report_batch_t batch;     //<! 批量上报的广播数据
+        uhos_ble_gap_ext_adv_report_t ext_report;  //<! 上报的扩展广播数据
         uhos_ble_gap_connect_update_t update_conn; //<! 连接更新数据
     };
 } uhos_ble_gap_evt_param_t;
@@ -334,6 +640,25 @@ typedef struct uhos_ble_gatts_evt_param
  */
 typedef uhos_ble_status_t (*uhos_ble_gatts_cb_t)(uhos_ble_gatts_evt_t evt, uhos_ble_gatts_evt_param_t *param);
 
+/**
+ * @struct 单个连接的收发统计信息
+ */
+typedef struct uhos_ble_conn_stats
+{
+    uhos_u32 tx_bytes;     //<! 已发送的notify/indicate字节数
+    uhos_u32 tx_packets;   //<! 已发送的notify/indicate包数
+    uhos_u32 tx_busy;      //<! 发送队列已满被拒绝的次数
+    uhos_u32 rx_bytes;     //<! 收到的写入字节数
+    uhos_u32 rx_packets;   //<! 收到的写入包数
+    uhos_u32 congested;    //<! 协议栈报告拥塞的次数
+    uhos_u32 duration_ms;  //<! 连接持续时间（毫秒），用于计算吞吐率
+    uhos_u16 queued;       //<! 当前排队待发送的包数
+    uhos_u16 mtu;          //<! 当前MTU
+    uhos_u16 interval;     //<! 当前连接间隔（单位1.25ms），未知时为0
+    uhos_u16 latency;      //<! 当前从设备时延
+    uhos_u32 tx_wait_ms;   //<! 已发送的notify/indicate在发送队列中的累计等待时间（毫秒）
+} uhos_ble_conn_stats_t;
+
 /**
  * @enum 服务类型
  */
@@ -630,6 +955,68 @@ typedef struct uhos_ble_gattc_evt_param
  */
 typedef void (*uhos_ble_gattc_callback_t)(uhos_ble_gattc_evt_t evt, uhos_ble_gattc_evt_param_t *param);
 
+/**
+ * @enum GATT层Client端排队执行的操作类型
+ */
+typedef enum
+{
+    UHOS_BLE_GATTC_OP_PRIMARY_SERVICE_DISCOVER_ALL = 0, //<! 发现所有首要服务
+    UHOS_BLE_GATTC_OP_PRIMARY_SERVICE_DISCOVER_BY_UUID, //<! 按UUID发现首要服务
+    UHOS_BLE_GATTC_OP_CHAR_DISCOVER,                    //<! 发现句柄范围内的特征
+    UHOS_BLE_GATTC_OP_CHAR_DISCOVER_BY_UUID,            //<! 按UUID发现特征
+    UHOS_BLE_GATTC_OP_CHAR_DESC_DISCOVER,               //<! 发现句柄范围内的特征描述符
+    UHOS_BLE_GATTC_OP_READ,                             //<! 按句柄读特征值
+    UHOS_BLE_GATTC_OP_READ_BY_UUID,                     //<! 按UUID读特征值
+    UHOS_BLE_GATTC_OP_WRITE,                            //<! 写特征值（需要响应）
+    UHOS_BLE_GATTC_OP_EXCHANGE_MTU,                     //<! MTU交换
+} uhos_ble_gattc_op_type_t;
+
+/**
+ * @struct GATT层Client端操作请求
+ * @note   按类型填写所需字段；写入数据在入队时拷贝，调用返回后即可释放
+ */
+typedef struct uhos_ble_gattc_op
+{
+    uhos_ble_gattc_op_type_t type;  //<! 操作类型
+    uhos_ble_handle_range_t range;  //<! 发现、按UUID读操作的句柄范围
+    uhos_ble_uuid_t uuid;           //<! 按UUID操作的UUID
+    uhos_u16 handle;                //<! 读、写操作的特征值句柄
+    uhos_u16 len;                   //<! 写入数据长度；MTU交换时为本端MTU，0表示使用默认值
+    const uhos_u8 *data;            //<! 写入数据
+    void *user_data;                //<! 用户数据，在完成回调中原样返回
+} uhos_ble_gattc_op_t;
+
+/**
+ * @struct GATT层Client端操作完成结果
+ */
+typedef struct uhos_ble_gattc_op_result
+{
+    uhos_u16 conn_handle;           //<! 连接句柄
+    uhos_ble_gattc_op_type_t type;  //<! 操作类型
+    uhos_u32 op_id;                 //<! 入队时分配的操作ID
+    uhos_ble_status_t status;       //<! UHOS_BLE_SUCCESS-成功，UHOS_BLE_TIMEOUT-等待响应超时，UHOS_BLE_ERROR-对端返回错误或连接断开
+    uhos_u32 queue_ms;              //<! 从入队到下发给协议栈的等待时间（毫秒）
+    uhos_u32 latency_ms;            //<! 从下发到收到响应的时间（毫秒）
+    void *user_data;                //<! 请求中的用户数据
+} uhos_ble_gattc_op_result_t;
+
+/**
+ * @brief  GATT client操作完成的回调函数
+ */
+typedef void (*uhos_ble_gattc_op_cb_t)(const uhos_ble_gattc_op_result_t *result);
+
+/**
+ * @struct GATT层Client端属性缓存的统计信息
+ */
+typedef struct uhos_ble_gattc_cache_stats
+{
+    uhos_u32 hits;          //<! 服务发现由缓存完成的次数
+    uhos_u32 misses;        //<! 服务发现需要与对端交互的次数（无缓存或缓存已失效）
+    uhos_u32 invalidations; //<! 因Service Changed或Database Hash变化而失效的次数
+    uhos_u32 ttfw_hit_ms;   //<! 最近一次命中缓存的连接，从连接建立到首次写入完成的时间（毫秒）
+    uhos_u32 ttfw_miss_ms;  //<! 最近一次未命中缓存的连接，从连接建立到首次写入完成的时间（毫秒）
+} uhos_ble_gattc_cache_stats_t;
+
 /**************************************************************************************************/
 /*                                          全局变量声明                                          */
 /**************************************************************************************************/
@@ -712,6 +1099,23 @@ extern uhos_ble_status_t uhos_ble_rssi_stop(uhos_u16 conn_handle);
  */
 extern uhos_ble_status_t uhos_ble_tx_power_set(uhos_u16 conn_handle, uhos_s8 tx_power);
 
+/**
+ * @brief       获取用户回调事件的投递统计信息
+ * @param[in]   type    事件分类
+ * @param[out]  stats   统计信息
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ * @retval      UHOS_BLE_ERROR    错误
+ */
+extern uhos_ble_status_t uhos_ble_event_stats_get(uhos_ble_event_type_t type, uhos_ble_event_stats_t *stats);
+
+/**
+ * @brief       清零用户回调事件的投递统计信息（不影响当前排队数）
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ */
+extern uhos_ble_status_t uhos_ble_event_stats_reset(void);
+
 /**************************************************************************************************/
 /* BLE GAP层广播相关功能接口原型                                                                  */
 /**************************************************************************************************/
@@ -753,6 +1157,77 @@ extern uhos_ble_status_t uhos_ble_gap_adv_stop(void);
  */
 extern uhos_ble_status_t uhos_ble_gap_non_connectable_stop(void);
 
+/**************************************************************************************************/
+/* BLE GAP层扩展广播（BLE 5.0）相关功能接口原型                                                   */
+/**************************************************************************************************/
+/**
+ * @brief       设置扩展广播集参数
+ * @note        广播集正在广播时需先调用uhos_ble_gap_ext_adv_stop；协议栈未开启BLE 5.0特性时返回UHOS_BLE_ERROR
+ * @param[in]   param 广播集参数
+ * @return      uhos_ble_status_t 执行结果
+ */
+extern uhos_ble_status_t uhos_ble_gap_ext_adv_param_set(const uhos_ble_gap_ext_adv_param_t *param);
+
+/**
+ * @brief       设置扩展广播集的广播数据与扫描响应数据
+ * @note        数据最长CONFIG_UHOS_BLE_EXT_ADV_DATA_MAX字节，由协议栈按分段发送
+ * @param[in]   instance   广播集编号
+ * @param[in]   p_data     广播数据，可为UHOS_NULL（不更新）
+ * @param[in]   dlen       广播数据长度
+ * @param[in]   p_sr_data  扫描响应数据，可为UHOS_NULL（不更新）
+ * @param[in]   srdlen     扫描响应数据长度
+ * @return      uhos_ble_status_t 执行结果
+ */
+extern uhos_ble_status_t uhos_ble_gap_ext_adv_data_set(uhos_u8 instance, uhos_u8 const *p_data, uhos_u16 dlen,
+                                                       uhos_u8 const *p_sr_data, uhos_u16 srdlen);
+
+/**
+ * @brief       开启扩展广播集，各广播集可同时广播
+ * @param[in]   instance    广播集编号
+ * @param[in]   duration    广播持续时间，Time=N * 10msec，0表示一直广播
+ * @param[in]   max_events  最多广播事件数，0表示不限制
+ * @return      uhos_ble_status_t 执行结果
+ */
+extern uhos_ble_status_t uhos_ble_gap_ext_adv_start(uhos_u8 instance, uhos_u16 duration, uhos_u8 max_events);
+
+/**
+ * @brief       关闭扩展广播集
+ * @param[in]   instance    广播集编号
+ * @return      uhos_ble_status_t 执行结果
+ */
+extern uhos_ble_status_t uhos_ble_gap_ext_adv_stop(uhos_u8 instance);
+
+/**
+ * @brief       删除扩展广播集，释放协议栈资源
+ * @param[in]   instance    广播集编号
+ * @return      uhos_ble_status_t 执行结果
+ */
+extern uhos_ble_status_t uhos_ble_gap_ext_adv_remove(uhos_u8 instance);
+
+/**
+ * @brief       开启扩展扫描
+ * @note        扩展广播通过UHOS_BLE_GAP_EVT_EXT_ADV_REPORT事件上报重组后的完整载荷；
+ *              以传统PDU发送的广播仍走UHOS_BLE_GAP_EVT_ADV_REPORT(_BATCH)事件，并经过去重与透传过滤
+ * @param[in]   scan_param 扫描参数
+ * @return      uhos_ble_status_t 执行结果
+ */
+extern uhos_ble_status_t uhos_ble_gap_ext_scan_start(const uhos_ble_gap_ext_scan_param_t *scan_param);
+
+/**
+ * @brief       关闭扩展扫描
+ * @return      uhos_ble_status_t 执行结果
+ */
+extern uhos_ble_status_t uhos_ble_gap_ext_scan_stop(void);
+
+/**
+ * @brief       获取扩展扫描分段重组的统计信息
+ * @param[out]  stats 统计信息
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ * @retval      UHOS_BLE_ERROR    参数错误
+ */
+extern uhos_ble_status_t uhos_ble_gap_ext_scan_stats_get(uhos_ble_gap_ext_scan_stats_t *stats);
+
 /**************************************************************************************************/
 /* BLE GAP层扫描相关功能接口原型                                                                  */
 /**************************************************************************************************/
@@ -783,6 +1258,41 @@ extern uhos_ble_status_t uhos_ble_gap_scan_stop(void);
  */
 extern uhos_ble_status_t uhos_ble_gap_update_conn_params(uhos_u16 conn_handle, uhos_ble_gap_conn_param_t conn_params);
 
+/**
+ * @brief       设置连接参数策略
+ * @note        对已建立的连接立即生效；通过uhos_ble_gap_update_conn_params指定过参数的连接不受策略调整
+ * @param[in]   policy 策略
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ * @retval      UHOS_BLE_ERROR    参数错误
+ */
+extern uhos_ble_status_t uhos_ble_gap_conn_policy_set(const uhos_ble_conn_policy_t *policy);
+
+/**
+ * @brief       获取当前的连接参数策略
+ * @param[out]  policy 策略
+ * @return      uhos_ble_status_t 执行结果
+ */
+extern uhos_ble_status_t uhos_ble_gap_conn_policy_get(uhos_ble_conn_policy_t *policy);
+
+/**
+ * @brief       提示连接即将开始突发传输（如OTA、场景数据同步），在duration_ms内保持突发档位
+ * @param[in]   conn_handle 连接句柄
+ * @param[in]   duration_ms 保持时间（毫秒），0表示取消提示
+ * @return      uhos_ble_status_t 执行结果
+ */
+extern uhos_ble_status_t uhos_ble_gap_conn_policy_boost(uhos_u16 conn_handle, uhos_u32 duration_ms);
+
+/**
+ * @brief       获取连接最近若干个统计窗口的吞吐率与时延
+ * @param[in]   conn_handle 连接句柄
+ * @param[out]  samples     统计窗口，按时间由旧到新排列
+ * @param[in,out] num       输入samples的容量，输出实际写入的个数
+ * @return      uhos_ble_status_t 执行结果
+ */
+extern uhos_ble_status_t uhos_ble_gap_conn_policy_history_get(uhos_u16 conn_handle, uhos_ble_conn_policy_sample_t *samples,
+                                                              uhos_u8 *num);
+
 /**
  * @brief       断开连接
  *
@@ -812,6 +1322,104 @@ extern uhos_ble_status_t uhos_ble_gap_connect(uhos_ble_gap_scan_param_t scan_par
  */
 extern uhos_ble_status_t uhos_ble_gap_callback_register(uhos_ble_gap_cb_t cb);
 
+/**************************************************************************************************/
+/* BLE GAP层广播批量上报相关功能接口原型                                                          */
+/**************************************************************************************************/
+/**
+ * @brief       开启/关闭广播数据批量上报
+ * @note        开启后，广播数据通过UHOS_BLE_GAP_EVT_ADV_REPORT_BATCH事件一次上报多条；
+ *              关闭（默认）时，仍通过UHOS_BLE_GAP_EVT_ADV_REPORT事件逐条上报
+ * @param[in]   enable UHOS_TRUE-开启，UHOS_FALSE-关闭
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ */
+extern uhos_ble_status_t uhos_ble_gap_adv_report_batch_enable(uhos_bool enable);
+
+/**
+ * @brief       获取广播上报通道的统计信息（含丢弃计数）
+ * @param[out]  stats 统计信息
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ * @retval      UHOS_BLE_ERROR    参数错误
+ */
+extern uhos_ble_status_t uhos_ble_gap_adv_report_stats_get(uhos_ble_gap_adv_report_stats_t *stats);
+
+/**
+ * @brief       清零广播上报通道的统计信息
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ */
+extern uhos_ble_status_t uhos_ble_gap_adv_report_stats_reset(void);
+
+/**
+ * @brief       配置广播上报去重（默认开启）
+ * @note        配置后去重缓存会被清空
+ * @param[in]   cfg 去重配置
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ * @retval      UHOS_BLE_ERROR    参数错误
+ */
+extern uhos_ble_status_t uhos_ble_gap_adv_dedup_config(const uhos_ble_gap_adv_dedup_cfg_t *cfg);
+
+/**
+ * @brief       获取广播上报去重的统计信息
+ * @param[out]  stats 统计信息
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ * @retval      UHOS_BLE_ERROR    参数错误
+ */
+extern uhos_ble_status_t uhos_ble_gap_adv_dedup_stats_get(uhos_ble_gap_adv_dedup_stats_t *stats);
+
+/**
+ * @brief       设置广播透传过滤规则
+ * @note        规则被编译为有序CID数组、MAC哈希集合及按位宽划分的UUID集合，
+ *              在协议栈扫描回调中直接匹配原始AD数据，不匹配的广播不做拷贝和缓存
+ * @param[in]   rules 过滤规则，UHOS_NULL表示清除规则（上报全部广播）
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ * @retval      UHOS_BLE_ERROR    规则非法或内存不足
+ */
+extern uhos_ble_status_t uhos_ble_gap_adv_filter_set(const uhos_ble_gap_adv_filter_rules_t *rules);
+
+/**
+ * @brief       获取广播透传过滤的统计信息
+ * @param[out]  stats 统计信息
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ * @retval      UHOS_BLE_ERROR    参数错误
+ */
+extern uhos_ble_status_t uhos_ble_gap_adv_filter_stats_get(uhos_ble_gap_adv_filter_stats_t *stats);
+
+/**
+ * @brief       配置广播透传打包
+ * @note        经过透传过滤与去重的广播上报按帧长上限与最长等待时间打包，在ble_daemon任务中交给sink发送；
+ *              与GAP层用户回调的广播上报互不影响。重新配置时未发送的帧被丢弃，统计信息清零。
+ *              帧格式为AL层自定义格式，须与接收方约定；编译时定义CONFIG_UHOS_BLE_ADV_PACK_ENABLE才可开启
+ * @param[in]   cfg 打包配置，UHOS_NULL或sink为UHOS_NULL表示关闭
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ * @retval      UHOS_BLE_ERROR    参数错误、内存不足或未启用CONFIG_UHOS_BLE_ADV_PACK_ENABLE
+ */
+extern uhos_ble_status_t uhos_ble_gap_adv_pack_config(const uhos_ble_gap_adv_pack_cfg_t *cfg);
+
+/**
+ * @brief       广播透传打包的流控
+ * @note        供E++发送队列达到高/低水位时调用；暂停期间上报继续打包，帧满后新上报丢弃
+ * @param[in]   stop UHOS_TRUE-暂停发送，UHOS_FALSE-恢复发送
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ */
+extern uhos_ble_status_t uhos_ble_gap_adv_pack_flow_ctrl(uhos_bool stop);
+
+/**
+ * @brief       获取广播透传打包的统计信息
+ * @param[out]  stats 统计信息
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ * @retval      UHOS_BLE_ERROR    参数错误
+ */
+extern uhos_ble_status_t uhos_ble_gap_adv_pack_stats_get(uhos_ble_gap_adv_pack_stats_t *stats);
+
 /**************************************************************************************************/
 /* BLE GAP层添加白名单设备的接口原型                                                              */
 /**************************************************************************************************/
@@ -847,6 +1455,46 @@ extern uhos_ble_status_t uhos_ble_gap_white_list_remove(uhos_u8 *mac);
  */
 extern uhos_ble_status_t uhos_ble_gap_white_list_clear(void);
 
+/**************************************************************************************************/
+/* BLE GAP层批量设置白名单设备的接口原型                                                          */
+/**************************************************************************************************/
+/**
+ * @brief       以地址列表整体替换gap的白名单设备
+ * @note        AL层维护白名单影子，只把与控制器白名单的差异下发，整批修改最多暂停一次扫描；
+ *              num为0等同于uhos_ble_gap_white_list_clear
+ * @param[in]   mac_list 白名单设备的mac地址列表
+ * @param[in]   num      地址个数，不超过CONFIG_UHOS_BLE_WL_SHADOW_NUM
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ * @retval      UHOS_BLE_ERROR    错误
+ */
+extern uhos_ble_status_t uhos_ble_gap_white_list_set(const uhos_ble_addr_t *mac_list, uhos_u16 num);
+
+/**************************************************************************************************/
+/* BLE GAP层白名单扫描过滤开关的接口原型                                                          */
+/**************************************************************************************************/
+/**
+ * @brief       设置扫描是否只上报白名单设备的广播，默认关闭
+ * @note        白名单地址数不超过控制器容量时由控制器过滤，超过时扫描不过滤、由AL层丢弃白名单以外的广播
+ * @param[in]   enable UHOS_TRUE-开启，UHOS_FALSE-关闭
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ * @retval      UHOS_BLE_ERROR    错误
+ */
+extern uhos_ble_status_t uhos_ble_gap_white_list_filter_enable(uhos_bool enable);
+
+/**************************************************************************************************/
+/* BLE GAP层获取白名单统计信息的接口原型                                                          */
+/**************************************************************************************************/
+/**
+ * @brief       获取白名单的统计信息
+ * @param[out]  stats 统计信息
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ * @retval      UHOS_BLE_ERROR    错误
+ */
+extern uhos_ble_status_t uhos_ble_gap_white_list_stats_get(uhos_ble_gap_white_list_stats_t *stats);
+
 /**************************************************************************************************/
 /* BLE GATT层server相关功能接口原型                                                               */
 /**************************************************************************************************/
@@ -871,22 +1519,42 @@ extern uhos_ble_status_t uhos_ble_gatts_register_destroy(destroy_func_t destroy)
 
 /**
  * @brief       设置GATT层Server端的服务框架
+ * @note        数据库中的所有服务、特征及描述符以属性表一次注册；服务创建完成后srv_handle与
+ *              char_value_handle回填到数据库中，因此数据库须在协议栈使用期间保持有效。
+ *              读写事件上报给uhos_ble_gatts_callback_register注册的回调
  *
  * @param[in]   service_database 服务数据集合
  * @return      uplus_ble_status_t 执行结果
  */
 extern uhos_ble_status_t uhos_ble_gatts_service_set(uhos_ble_gatts_db_t *uhos_ble_service_database);
 
+/**
+ * @brief       追加一组服务，并指定这组服务的读写事件回调
+ * @note        可多次调用，使多个服务集（profile）并存；其余约定同uhos_ble_gatts_service_set
+ *
+ * @param[in]   service_database 服务数据集合
+ * @param[in]   cb               这组服务的回调函数，UHOS_NULL表示使用全局回调
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ * @retval      UHOS_BLE_ERROR    参数错误或服务个数超过上限
+ */
+extern uhos_ble_status_t uhos_ble_gatts_service_add(uhos_ble_gatts_db_t *service_database, uhos_ble_gatts_cb_t cb);
+
 /**
  * @brief       向指定的特性发送notify和indicate数据
+ * @note        数据拷贝到该连接的发送队列后即返回，协议栈缓存可用时再下发；
+ *              各连接的队列相互独立，单个慢速连接不会阻塞其他连接
  *
  * @param[in]   conn_handle         连接句柄
  * @param[in]   srv_handle          服务句柄
  * @param[in]   char_value_handle   特性值句柄
- * @param[in]   offset              偏移量
+ * @param[in]   offset              0-notify，非0-indicate
  * @param[in]   p_value             发送数据
  * @param[in]   len                 发送数据的字节数
  * @return      uhos_ble_status_t   执行结果
+ * @retval      UHOS_BLE_SUCCESS    已进入发送队列
+ * @retval      UHOS_BLE_BUSY       该连接的发送队列已满，需等待后重试
+ * @retval      UHOS_BLE_ERROR      连接不存在或参数错误
  */
 extern uhos_ble_status_t uhos_ble_gatts_notify_or_indicate(uhos_u16 conn_handle,
                                                            uhos_u16 srv_handle,
@@ -910,6 +1578,16 @@ extern uhos_ble_status_t uhos_ble_gatts_mtu_default_set(uhos_u16 mtu);
  */
 extern uhos_ble_status_t uhos_ble_gatts_mtu_get(uhos_u16 conn_handle, uhos_u16 *mtu_size);
 
+/**
+ * @brief       获取指定连接的收发统计信息
+ * @param[in]   conn_handle 连接句柄
+ * @param[out]  stats       统计信息
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  成功
+ * @retval      UHOS_BLE_ERROR    连接不存在或参数错误
+ */
+extern uhos_ble_status_t uhos_ble_gatts_conn_stats_get(uhos_u16 conn_handle, uhos_ble_conn_stats_t *stats);
+
 /**************************************************************************************************/
 /* BLE GATT层client相关功能接口原型                                                               */
 /**************************************************************************************************/
@@ -920,6 +1598,47 @@ extern uhos_ble_status_t uhos_ble_gatts_mtu_get(uhos_u16 conn_handle, uhos_u16 *
  * @return      uplus_ble_status_t 执行结果
  */
 extern uhos_ble_status_t uhos_ble_gattc_callback_register(uhos_ble_gattc_callback_t cb);
+
+/**
+ * @brief       注册GATT层client端操作完成回调函数
+ * @note        所有经操作队列执行的请求（含下列发现、读、写请求接口）完成时均通过该回调通知，
+ *              过程中的数据（服务、特征、读取的值等）仍通过uhos_ble_gattc_callback_register注册的回调上报
+ * @param[in]   cb 操作完成回调函数
+ * @return      uhos_ble_status_t 执行结果
+ */
+extern uhos_ble_status_t uhos_ble_gattc_op_callback_register(uhos_ble_gattc_op_cb_t cb);
+
+/**
+ * @brief       提交一个GATT client操作
+ * @note        每个连接的操作按提交顺序逐个执行，前一个操作收到响应后再下发下一个；
+ *              不同连接的操作互不等待；写命令（write without response）不经过队列，可穿插发送。
+ *              特征、描述符发现的结果来自协议栈的本地缓存，可能在本接口返回前即回调完成
+ * @param[in]   conn_handle 连接句柄
+ * @param[in]   op          操作请求
+ * @param[out]  op_id       分配的操作ID，可为UHOS_NULL
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  已入队
+ * @retval      UHOS_BLE_BUSY     该连接的操作队列已满
+ * @retval      UHOS_BLE_ERROR    参数错误或连接不存在
+ */
+extern uhos_ble_status_t uhos_ble_gattc_op_submit(uhos_u16 conn_handle, const uhos_ble_gattc_op_t *op, uhos_u32 *op_id);
+
+/**
+ * @brief       获取GATT client属性缓存的统计信息
+ * @note        发现所有首要服务时，若对端的属性数据库已缓存则直接由缓存上报服务，
+ *              之后的特征、描述符发现同样由缓存完成；对端支持Database Hash时先读取哈希值校验缓存
+ * @param[out]  stats 统计信息
+ * @return      uhos_ble_status_t 执行结果
+ */
+extern uhos_ble_status_t uhos_ble_gattc_cache_stats_get(uhos_ble_gattc_cache_stats_t *stats);
+
+/**
+ * @brief       清除GATT client属性缓存
+ * @param[in]   addr 对端地址（与uhos_ble_gap_find_connect获取的地址字节序一致），UHOS_NULL表示清除所有对端的缓存
+ * @return      uhos_ble_status_t 执行结果
+ */
+extern uhos_ble_status_t uhos_ble_gattc_cache_clear(const uhos_u8 *addr);
+
 /**
  * @brief       启动所有首要服务发现
  *
@@ -0,0 +1,430 @@
+/**
+ * @addtogroup grp_uhosble
+ * @{
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_ad.h
+ * @author agent (agent@local)
+ * @brief 不需要适配。广播数据（AD结构）的零拷贝迭代与解析工具，仅头文件实现
+ * @details 迭代器只引用原始数据，不做任何拷贝；单段数据最多31个AD结构，解析时间有上界。
+ *          支持将同一设备的广播数据与扫描响应数据串联迭代，无需重新分配内存。
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：广播数据（AD结构）的零拷贝迭代与解析工具，仅头文件实现
+ * </table>
+ */
+
+#ifndef __UH_BLE_AD_H__
+#define __UH_BLE_AD_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**************************************************************************************************/
+/*                                           常量定义                                             */
+/**************************************************************************************************/
+#define UHOS_BLE_AD_TYPE_FLAGS              0x01                //<! Flags
+#define UHOS_BLE_AD_TYPE_UUID16_MORE        0x02                //<! 16位服务UUID（不完整）
+#define UHOS_BLE_AD_TYPE_UUID16_ALL         0x03                //<! 16位服务UUID（完整）
+#define UHOS_BLE_AD_TYPE_UUID32_MORE        0x04                //<! 32位服务UUID（不完整）
+#define UHOS_BLE_AD_TYPE_UUID32_ALL         0x05                //<! 32位服务UUID（完整）
+#define UHOS_BLE_AD_TYPE_UUID128_MORE       0x06                //<! 128位服务UUID（不完整）
+#define UHOS_BLE_AD_TYPE_UUID128_ALL        0x07                //<! 128位服务UUID（完整）
+#define UHOS_BLE_AD_TYPE_NAME_SHORT         0x08                //<! 设备名称（缩写）
+#define UHOS_BLE_AD_TYPE_NAME_COMPLETE      0x09                //<! 设备名称（完整）
+#define UHOS_BLE_AD_TYPE_TX_POWER           0x0A                //<! 发射功率
+#define UHOS_BLE_AD_TYPE_SVC_DATA16         0x16                //<! 16位UUID服务数据
+#define UHOS_BLE_AD_TYPE_SVC_DATA32         0x20                //<! 32位UUID服务数据
+#define UHOS_BLE_AD_TYPE_SVC_DATA128        0x21                //<! 128位UUID服务数据
+#define UHOS_BLE_AD_TYPE_MANUFACTURER       0xFF                //<! 厂商自定义数据
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+/**
+ * @struct AD结构描述，data指向原始数据，不拷贝
+ */
+typedef struct uhos_ble_ad_field
+{
+    uhos_u8 type;        //<! AD类型
+    uhos_u8 len;         //<! 数据长度（不含长度和类型字节）
+    const uhos_u8 *data; //<! 数据
+} uhos_ble_ad_field_t;
+
+/**
+ * @struct AD结构迭代器，最多串联两段数据（广播数据+扫描响应数据）
+ */
+typedef struct uhos_ble_ad_iter
+{
+    const uhos_u8 *seg[2]; //<! 数据段
+    uhos_u16 seg_len[2];   //<! 数据段长度（扩展广播可超过255字节）
+    uhos_u8 seg_idx;       //<! 当前数据段
+    uhos_u16 pos;          //<! 当前数据段内的偏移
+} uhos_ble_ad_iter_t;
+
+/**
+ * @struct 服务数据描述
+ */
+typedef struct uhos_ble_ad_service_data
+{
+    uhos_u8 uuid_len;    //<! UUID长度：2/4/16
+    const uhos_u8 *uuid; //<! UUID（小端）
+    uhos_u8 len;         //<! 服务数据长度
+    const uhos_u8 *data; //<! 服务数据
+} uhos_ble_ad_service_data_t;
+
+/**************************************************************************************************/
+/*                                         全局函数实现                                           */
+/**************************************************************************************************/
+/**
+ * @brief       读取小端16位整数
+ */
+static inline uhos_u16 uhos_ble_ad_le16(const uhos_u8 *p)
+{
+    return (uhos_u16)(p[0] | (p[1] << 8));
+}
+
+/**
+ * @brief       读取小端32位整数
+ */
+static inline uhos_u32 uhos_ble_ad_le32(const uhos_u8 *p)
+{
+    return (uhos_u32)p[0] | ((uhos_u32)p[1] << 8) | ((uhos_u32)p[2] << 16) | ((uhos_u32)p[3] << 24);
+}
+
+/**
+ * @brief       初始化迭代器（单段数据）
+ * @param[out]  it      迭代器
+ * @param[in]   data    AD数据
+ * @param[in]   len     数据长度
+ */
+static inline void uhos_ble_ad_iter_init(uhos_ble_ad_iter_t *it, const uhos_u8 *data, uhos_u16 len)
+{
+    it->seg[0]     = data;
+    it->seg_len[0] = data ? len : 0;
+    it->seg[1]     = UHOS_NULL;
+    it->seg_len[1] = 0;
+    it->seg_idx    = 0;
+    it->pos        = 0;
+}
+
+/**
+ * @brief       初始化迭代器，串联广播数据与扫描响应数据
+ * @param[out]  it      迭代器
+ * @param[in]   adv     广播数据，可为UHOS_NULL
+ * @param[in]   adv_len 广播数据长度
+ * @param[in]   rsp     扫描响应数据，可为UHOS_NULL
+ * @param[in]   rsp_len 扫描响应数据长度
+ */
+static inline void uhos_ble_ad_iter_init_merged(uhos_ble_ad_iter_t *it,
+                                                const uhos_u8 *adv, uhos_u16 adv_len,
+                                                const uhos_u8 *rsp, uhos_u16 rsp_len)
+{
+    uhos_ble_ad_iter_init(it, adv, adv_len);
+    it->seg[1]     = rsp;
+    it->seg_len[1] = rsp ? rsp_len : 0;
+}
+
+/**
+ * @brief       获取下一个AD结构
+ * @note        遇到长度为0或越界的AD结构时结束当前数据段
+ * @param[in]   it      迭代器
+ * @param[out]  field   AD结构
+ * @return      UHOS_TRUE-获取成功，UHOS_FALSE-已无数据
+ */
+static inline uhos_bool uhos_ble_ad_iter_next(uhos_ble_ad_iter_t *it, uhos_ble_ad_field_t *field)
+{
+    const uhos_u8 *seg = UHOS_NULL;
+    uhos_u8 ad_len = 0;
+
+    while (it->seg_idx < 2)
+    {
+        seg = it->seg[it->seg_idx];
+
+        if ((uhos_u32)it->pos + 1 < it->seg_len[it->seg_idx])
+        {
+            ad_len = seg[it->pos];
+            if ((0 != ad_len) && ((uhos_u32)it->pos + 1 + ad_len <= it->seg_len[it->seg_idx]))
+            {
+                field->type = seg[it->pos + 1];
+                field->len = ad_len - 1;
+                field->data = &seg[it->pos + 2];
+                it->pos = (uhos_u16)(it->pos + 1 + ad_len);
+                return UHOS_TRUE;
+            }
+        }
+
+        it->seg_idx++;
+        it->pos = 0;
+    }
+
+    return UHOS_FALSE;
+}
+
+/**
+ * @brief       从头查找指定类型的第一个AD结构
+ * @param[in]   src     迭代器（不会被修改）
+ * @param[in]   type    AD类型
+ * @param[out]  field   AD结构
+ * @return      UHOS_TRUE-找到，UHOS_FALSE-未找到
+ */
+static inline uhos_bool uhos_ble_ad_find(const uhos_ble_ad_iter_t *src, uhos_u8 type, uhos_ble_ad_field_t *field)
+{
+    uhos_ble_ad_iter_t it = *src;
+
+    it.seg_idx = 0;
+    it.pos = 0;
+
+    while (uhos_ble_ad_iter_next(&it, field))
+    {
+        if (field->type == type)
+        {
+            return UHOS_TRUE;
+        }
+    }
+
+    return UHOS_FALSE;
+}
+
+/**
+ * @brief       获取Flags
+ * @param[in]   src     迭代器
+ * @param[out]  flags   Flags
+ * @return      UHOS_TRUE-存在，UHOS_FALSE-不存在
+ */
+static inline uhos_bool uhos_ble_ad_get_flags(const uhos_ble_ad_iter_t *src, uhos_u8 *flags)
+{
+    uhos_ble_ad_field_t field;
+
+    if (!uhos_ble_ad_find(src, UHOS_BLE_AD_TYPE_FLAGS, &field) || (field.len < 1))
+    {
+        return UHOS_FALSE;
+    }
+
+    *flags = field.data[0];
+    return UHOS_TRUE;
+}
+
+/**
+ * @brief       获取设备名称（优先完整名称）
+ * @param[in]   src         迭代器
+ * @param[out]  name        名称（不以'\0'结尾）
+ * @param[out]  len         名称长度
+ * @param[out]  complete    是否为完整名称，可为UHOS_NULL
+ * @return      UHOS_TRUE-存在，UHOS_FALSE-不存在
+ */
+static inline uhos_bool uhos_ble_ad_get_local_name(const uhos_ble_ad_iter_t *src, const uhos_char **name, uhos_u8 *len, uhos_bool *complete)
+{
+    uhos_ble_ad_field_t field;
+    uhos_bool is_complete = UHOS_TRUE;
+
+    if (!uhos_ble_ad_find(src, UHOS_BLE_AD_TYPE_NAME_COMPLETE, &field))
+    {
+        is_complete = UHOS_FALSE;
+        if (!uhos_ble_ad_find(src, UHOS_BLE_AD_TYPE_NAME_SHORT, &field))
+        {
+            return UHOS_FALSE;
+        }
+    }
+
+    *name = (const uhos_char *)field.data;
+    *len = field.len;
+    if (complete)
+    {
+        *complete = is_complete;
+    }
+
+    return UHOS_TRUE;
+}
+
+/**
+ * @brief       获取厂商自定义数据
+ * @param[in]   src     迭代器
+ * @param[out]  cid     厂商ID
+ * @param[out]  data    厂商数据（不含厂商ID）
+ * @param[out]  len     厂商数据长度
+ * @return      UHOS_TRUE-存在，UHOS_FALSE-不存在
+ */
+static inline uhos_bool uhos_ble_ad_get_manufacturer(const uhos_ble_ad_iter_t *src, uhos_u16 *cid, const uhos_u8 **data, uhos_u8 *len)
+{
+    uhos_ble_ad_field_t field;
+
+    if (!uhos_ble_ad_find(src, UHOS_BLE_AD_TYPE_MANUFACTURER, &field) || (field.len < 2))
+    {
+        return UHOS_FALSE;
+    }
+
+    *cid = uhos_ble_ad_le16(field.data);
+    *data = field.data + 2;
+    *len = field.len - 2;
+    return UHOS_TRUE;
+}
+
+/**
+ * @brief       获取AD结构中UUID的宽度
+ * @param[in]   field   AD结构
+ * @return      2/4/16；非UUID列表或服务数据类型返回0
+ */
+static inline uhos_u8 uhos_ble_ad_field_uuid_width(const uhos_ble_ad_field_t *field)
+{
+    switch (field->type)
+    {
+        case UHOS_BLE_AD_TYPE_UUID16_MORE:
+        case UHOS_BLE_AD_TYPE_UUID16_ALL:
+        case UHOS_BLE_AD_TYPE_SVC_DATA16:
+            return 2;
+        case UHOS_BLE_AD_TYPE_UUID32_MORE:
+        case UHOS_BLE_AD_TYPE_UUID32_ALL:
+        case UHOS_BLE_AD_TYPE_SVC_DATA32:
+            return 4;
+        case UHOS_BLE_AD_TYPE_UUID128_MORE:
+        case UHOS_BLE_AD_TYPE_UUID128_ALL:
+        case UHOS_BLE_AD_TYPE_SVC_DATA128:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief       获取AD结构中包含的UUID个数
+ * @note        UUID列表返回列表长度；服务数据返回1（仅开头的UUID）
+ * @param[in]   field   AD结构
+ * @return      UUID个数
+ */
+static inline uhos_u8 uhos_ble_ad_field_uuid_count(const uhos_ble_ad_field_t *field)
+{
+    uhos_u8 width = uhos_ble_ad_field_uuid_width(field);
+
+    if ((0 == width) || (field->len < width))
+    {
+        return 0;
+    }
+
+    if ((UHOS_BLE_AD_TYPE_SVC_DATA16 == field->type) || (UHOS_BLE_AD_TYPE_SVC_DATA32 == field->type) ||
+        (UHOS_BLE_AD_TYPE_SVC_DATA128 == field->type))
+    {
+        return 1;
+    }
+
+    return field->len / width;
+}
+
+/**
+ * @brief       获取AD结构中第idx个UUID的起始地址（小端）
+ * @param[in]   field   AD结构
+ * @param[in]   idx     UUID序号，需小于uhos_ble_ad_field_uuid_count
+ * @return      UUID地址
+ */
+static inline const uhos_u8 *uhos_ble_ad_field_uuid_at(const uhos_ble_ad_field_t *field, uhos_u8 idx)
+{
+    return field->data + idx * uhos_ble_ad_field_uuid_width(field);
+}
+
+/**
+ * @brief       查找包含16位UUID的服务UUID列表或服务数据
+ * @param[in]   src     迭代器
+ * @param[in]   uuid    16位UUID
+ * @return      UHOS_TRUE-包含，UHOS_FALSE-不包含
+ */
+static inline uhos_bool uhos_ble_ad_has_uuid16(const uhos_ble_ad_iter_t *src, uhos_u16 uuid)
+{
+    uhos_ble_ad_iter_t it = *src;
+    uhos_ble_ad_field_t field;
+    uhos_u8 i = 0;
+    uhos_u8 n = 0;
+
+    it.seg_idx = 0;
+    it.pos = 0;
+
+    while (uhos_ble_ad_iter_next(&it, &field))
+    {
+        if (2 != uhos_ble_ad_field_uuid_width(&field))
+        {
+            continue;
+        }
+
+        n = uhos_ble_ad_field_uuid_count(&field);
+        for (i = 0; i < n; i++)
+        {
+            if (uhos_ble_ad_le16(uhos_ble_ad_field_uuid_at(&field, i)) == uuid)
+            {
+                return UHOS_TRUE;
+            }
+        }
+    }
+
+    return UHOS_FALSE;
+}
+
+/**
+ * @brief       将服务数据类AD结构解析为UUID与数据
+ * @param[in]   field   AD结构（类型为0x16/0x20/0x21）
+ * @param[out]  svc     服务数据
+ * @return      UHOS_TRUE-解析成功，UHOS_FALSE-不是服务数据或长度非法
+ */
+static inline uhos_bool uhos_ble_ad_field_service_data(const uhos_ble_ad_field_t *field, uhos_ble_ad_service_data_t *svc)
+{
+    uhos_u8 width = 0;
+
+    if ((UHOS_BLE_AD_TYPE_SVC_DATA16 != field->type) && (UHOS_BLE_AD_TYPE_SVC_DATA32 != field->type) &&
+        (UHOS_BLE_AD_TYPE_SVC_DATA128 != field->type))
+    {
+        return UHOS_FALSE;
+    }
+
+    width = uhos_ble_ad_field_uuid_width(field);
+    if (field->len < width)
+    {
+        return UHOS_FALSE;
+    }
+
+    svc->uuid_len = width;
+    svc->uuid = field->data;
+    svc->len = field->len - width;
+    svc->data = field->data + width;
+    return UHOS_TRUE;
+}
+
+/**
+ * @brief       获取第一个服务数据
+ * @param[in]   src     迭代器
+ * @param[out]  svc     服务数据
+ * @return      UHOS_TRUE-存在，UHOS_FALSE-不存在
+ */
+static inline uhos_bool uhos_ble_ad_get_service_data(const uhos_ble_ad_iter_t *src, uhos_ble_ad_service_data_t *svc)
+{
+    uhos_ble_ad_iter_t it = *src;
+    uhos_ble_ad_field_t field;
+
+    it.seg_idx = 0;
+    it.pos = 0;
+
+    while (uhos_ble_ad_iter_next(&it, &field))
+    {
+        if (uhos_ble_ad_field_service_data(&field, svc))
+        {
+            return UHOS_TRUE;
+        }
+    }
+
+    return UHOS_FALSE;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_BLE_AD_H__
+       /**@}*/
@@ -0,0 +1,167 @@
+/**
+ * @addtogroup grp_uhosble
+ * @{
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_frag.h
+ * @author agent (agent@local)
+ * @brief 不需要适配。基于MTU的大数据分片发送与重组接口
+ * @details 发送端按(MTU-3)切分数据并加分片头，通过notify或write without response流水线发送；
+ *          接收端按分片头重组。分片头格式：
+ *          - 字节0：bit7-首片标志，bit6-末片标志，bit0~5-分片序号（模64递增）
+ *          - 首片额外携带2字节小端总长度
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：基于MTU的大数据分片发送与重组接口
+ * </table>
+ */
+
+#ifndef __UH_BLE_FRAG_H__
+#define __UH_BLE_FRAG_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_ble.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**************************************************************************************************/
+/*                                           常量定义                                             */
+/**************************************************************************************************/
+#define UHOS_BLE_FRAG_FLAG_FIRST 0x80 //<! 首片
+#define UHOS_BLE_FRAG_FLAG_LAST  0x40 //<! 末片
+#define UHOS_BLE_FRAG_SEQ_MASK   0x3F //<! 分片序号
+#define UHOS_BLE_FRAG_HDR_LEN    1    //<! 分片头长度
+#define UHOS_BLE_FRAG_FIRST_HDR_LEN 3 //<! 首片分片头长度（含总长度）
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+/**
+ * @enum 分片发送使用的链路类型
+ */
+typedef enum
+{
+    UHOS_BLE_FRAG_LINK_NOTIFY = 0, //<! GATT server端notify
+    UHOS_BLE_FRAG_LINK_WRITE_CMD,  //<! GATT client端write without response
+} uhos_ble_frag_link_t;
+
+/**
+ * @struct 分片通道的统计信息
+ */
+typedef struct uhos_ble_frag_stats
+{
+    uhos_u32 tx_msgs;      //<! 发送完成的消息数
+    uhos_u32 tx_bytes;     //<! 发送的有效载荷字节数
+    uhos_u32 tx_chunks;    //<! 发送的分片数
+    uhos_u32 tx_retries;   //<! 链路忙导致的重试次数
+    uhos_u32 tx_confirmed; //<! 协议栈上报发送完成的分片数
+    uhos_u32 rx_msgs;      //<! 重组完成的消息数
+    uhos_u32 rx_bytes;     //<! 重组完成的有效载荷字节数
+    uhos_u32 rx_errors;    //<! 分片序号错误、长度错误等导致丢弃的消息数
+    uhos_u32 goodput_bps;  //<! 最近一段连续发送的有效载荷吞吐率（字节/秒），以最后一个分片发送完成的时间计算
+} uhos_ble_frag_stats_t;
+
+/**
+ * @struct 分片通道
+ * @note   由调用者分配，使用uhos_ble_frag_init初始化、uhos_ble_frag_deinit释放；同一通道的发送与接收
+ *         可在不同任务中进行，但同一方向不可并发调用。
+ *         协议栈上报的发送完成事件按连接与链路类型计入已初始化的通道，同一连接上不宜另外发送同类型数据
+ */
+typedef struct uhos_ble_frag
+{
+    uhos_u16 conn_handle;      //<! 连接句柄
+    uhos_u16 srv_handle;       //<! 服务句柄（notify时使用）
+    uhos_u16 char_handle;      //<! 特性值句柄
+    uhos_ble_frag_link_t link; //<! 链路类型
+    uhos_u8 window;            //<! 流水线窗口：连接发送队列中最多排队的分片数
+    uhos_u8 tx_seq;            //<! 发送序号
+    uhos_u8 rx_seq;            //<! 期望的接收序号
+    uhos_u8 rx_active;         //<! 是否正在重组
+    uhos_u8 *rx_buf;           //<! 重组缓存
+    uhos_u16 rx_total;         //<! 消息总长度
+    uhos_u16 rx_len;           //<! 已重组长度
+    uhos_u32 tx_unacked;       //<! 已提交、协议栈尚未上报发送完成的分片数
+    uhos_u32 tx_busy_start;    //<! 本段连续发送的开始时间（毫秒）
+    uhos_u32 tx_busy_bytes;    //<! 本段连续发送已提交的有效载荷字节数
+    uhos_ble_frag_stats_t stats; //<! 统计信息
+} uhos_ble_frag_t;
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       初始化分片通道
+ * @note        须在BLE协议栈启用后调用，最多同时存在CONFIG_UHOS_BLE_FRAG_CHANNEL_NUM个通道
+ * @param[out]  ch          分片通道
+ * @param[in]   link        链路类型
+ * @param[in]   conn_handle 连接句柄
+ * @param[in]   srv_handle  服务句柄
+ * @param[in]   char_handle 特性值句柄
+ * @param[in]   window      流水线窗口，0表示使用默认值
+ * @return      uhos_ble_status_t 执行结果，通道数已达上限返回UHOS_BLE_ERROR
+ */
+extern uhos_ble_status_t uhos_ble_frag_init(uhos_ble_frag_t *ch,
+                                            uhos_ble_frag_link_t link,
+                                            uhos_u16 conn_handle,
+                                            uhos_u16 srv_handle,
+                                            uhos_u16 char_handle,
+                                            uhos_u8 window);
+
+/**
+ * @brief       释放分片通道的重组缓存，不再统计该通道的发送完成事件
+ * @param[in]   ch 分片通道
+ */
+extern void uhos_ble_frag_deinit(uhos_ble_frag_t *ch);
+
+/**
+ * @brief       分片发送一条消息
+ * @note        按连接当前的MTU切分；链路忙时等待后重试，直至全部分片交给协议栈或超时
+ * @param[in]   ch          分片通道
+ * @param[in]   data        消息数据
+ * @param[in]   len         消息长度，最大65535
+ * @param[in]   timeout_ms  超时时间（毫秒）
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  全部分片已提交
+ * @retval      UHOS_BLE_BUSY     超时，部分分片未发送
+ * @retval      UHOS_BLE_ERROR    参数错误或连接不存在
+ */
+extern uhos_ble_status_t uhos_ble_frag_send(uhos_ble_frag_t *ch, const uhos_u8 *data, uhos_u32 len, uhos_u32 timeout_ms);
+
+/**
+ * @brief       输入一个收到的分片
+ * @param[in]   ch      分片通道
+ * @param[in]   data    分片数据（含分片头）
+ * @param[in]   len     分片长度
+ * @param[out]  msg     重组完成时指向完整消息，在下一次调用本接口前有效
+ * @param[out]  msg_len 重组完成时的消息长度
+ * @return      uhos_ble_status_t 执行结果
+ * @retval      UHOS_BLE_SUCCESS  重组完成，msg/msg_len有效
+ * @retval      UHOS_BLE_BUSY     分片已接收，消息尚未完整
+ * @retval      UHOS_BLE_ERROR    分片非法，当前消息被丢弃
+ */
+extern uhos_ble_status_t uhos_ble_frag_input(uhos_ble_frag_t *ch, const uhos_u8 *data, uhos_u16 len, const uhos_u8 **msg, uhos_u16 *msg_len);
+
+/**
+ * @brief       获取分片通道的统计信息
+ * @param[in]   ch      分片通道
+ * @param[out]  stats   统计信息
+ * @return      uhos_ble_status_t 执行结果
+ */
+extern uhos_ble_status_t uhos_ble_frag_stats_get(const uhos_ble_frag_t *ch, uhos_ble_frag_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_BLE_FRAG_H__
+       /**@}*/
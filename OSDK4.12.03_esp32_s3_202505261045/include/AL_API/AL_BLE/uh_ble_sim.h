@@ -0,0 +1,365 @@
+/**
+ * @addtogroup grp_uhosble
+ * @{
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_sim.h
+ * @author agent (agent@local)
+ * @brief 主机BLE模拟器的脚本接口
+ * @details 在Linux主机上以虚拟控制器替代Bluedroid协议栈运行AL_BLE，uhos_ble_*接口保持不变，
+ *          用于在CI中测试与评估广播上报、过滤、GATT吞吐等功能。
+ *          编译方法：以src/AL_API/AL_BLE/sim/include作为ESP-IDF头文件路径，
+ *          以src/AL_API/AL_BLE/include与src/AL_API/AL_BENCH/include作为内部头文件路径，
+ *          编译src/AL_API/AL_BLE/src、src/AL_API/AL_BLE/sim/src下的全部源文件与AL_BENCH，
+ *          OS适配层使用src/AL_API/AL_OS/linux_posix（参见test/host/run.sh）。
+ *          模拟器提供：
+ *          - 虚拟广播者：按设定间隔（外加0~10ms随机advDelay）广播，仅在扫描窗口内上报，
+ *            主动扫描时另行上报扫描响应；
+ *          - 虚拟对端：提供GATT属性表，可连接、读写、通知，并模拟MTU与连接间隔对吞吐的影响，
+ *            每个连接事件收发的LL数据包数由pkts_per_event限定。
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：主机BLE模拟器的脚本接口
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>基准测试类型改由uh_ble_bench.h提供，输出函数改用uhos_bench_print_t
+ * </table>
+ */
+
+#ifndef __UH_BLE_SIM_H__
+#define __UH_BLE_SIM_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_ble.h"
+#include "uh_bench.h"
+#include "uh_ble_bench.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**************************************************************************************************/
+/*                                           常量定义                                             */
+/**************************************************************************************************/
+#define UHOS_BLE_SIM_ADV_DATA_LEN           31          //<! 广播数据与扫描响应数据的最大长度
+#define UHOS_BLE_SIM_EXT_ADV_DATA_LEN       1650        //<! 扩展广播数据的最大长度
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+/**
+ * @struct      模拟器配置
+ */
+typedef struct uhos_ble_sim_cfg
+{
+    uhos_ble_addr_t local_addr;                                 //<! 本端地址
+    uhos_u16        conn_interval;                              //<! 新建连接的连接间隔，单位1.25ms
+    uhos_u8         pkts_per_event;                             //<! 每个连接事件每个方向可传输的LL数据包数
+    uhos_u8         queue_size;                                 //<! 每条链路每个方向的发送队列深度
+    uhos_u32        seed;                                       //<! advDelay随机数种子
+} uhos_ble_sim_cfg_t;
+
+/**
+ * @struct      虚拟广播者
+ */
+typedef struct uhos_ble_sim_adv
+{
+    uhos_ble_addr_t      addr;                                  //<! 广播者地址
+    uhos_ble_addr_type_t addr_type;                             //<! 地址类型
+    uhos_bool            connectable;                           //<! 是否为可连接广播
+    uhos_s8              rssi;                                  //<! 上报的信号强度
+    uhos_u16             interval_ms;                           //<! 广播间隔，单位ms，实际间隔另加0~10ms随机延时
+    uhos_u8              data_len;                              //<! 广播数据长度
+    uhos_u8              data[UHOS_BLE_SIM_ADV_DATA_LEN];       //<! 广播数据
+    uhos_u8              rsp_len;                               //<! 扫描响应数据长度，0表示不响应扫描请求
+    uhos_u8              rsp[UHOS_BLE_SIM_ADV_DATA_LEN];        //<! 扫描响应数据
+    uhos_bool            extended;                              //<! 扩展广播：仅扩展扫描可见，载荷为ext_data，不使用data/rsp
+    uhos_u8              sid;                                   //<! 扩展广播的广播集标识
+    uhos_ble_gap_phy_t   primary_phy;                           //<! 扩展广播的主通道PHY，0等同于1M
+    uhos_ble_gap_phy_t   secondary_phy;                         //<! 扩展广播的辅助通道PHY，0等同于1M
+    uhos_u16             ext_len;                               //<! 扩展广播数据长度
+    uhos_u8              ext_data[UHOS_BLE_SIM_EXT_ADV_DATA_LEN];   //<! 扩展广播数据，超过一个上报的部分分段上报
+} uhos_ble_sim_adv_t;
+
+/**
+ * @enum        虚拟对端的属性类型
+ */
+typedef enum
+{
+    UHOS_BLE_SIM_ATTR_SERVICE,                                  //<! 首要服务，handle为服务起始句柄
+    UHOS_BLE_SIM_ATTR_CHAR,                                     //<! 特征，handle为特征值句柄
+    UHOS_BLE_SIM_ATTR_DESC                                      //<! 描述符，handle为描述符句柄
+} uhos_ble_sim_attr_type_t;
+
+/**
+ * @struct      虚拟对端的属性
+ * @note        属性表须按句柄升序排列，服务的结束句柄取下一个服务起始句柄减一
+ */
+typedef struct uhos_ble_sim_attr
+{
+    uhos_ble_sim_attr_type_t type;                              //<! 属性类型
+    uhos_u16                 handle;                            //<! 句柄
+    uhos_ble_uuid_t          uuid;                              //<! UUID
+    uhos_u8                  props;                             //<! 特征属性，按BLE规范的位定义
+    uhos_u16                 len;                               //<! 初始值长度
+    const uhos_u8           *value;                             //<! 初始值
+} uhos_ble_sim_attr_t;
+
+/**
+ * @struct      虚拟对端
+ */
+typedef struct uhos_ble_sim_peer
+{
+    uhos_ble_addr_t            addr;                            //<! 对端地址
+    uhos_ble_addr_type_t       addr_type;                       //<! 地址类型
+    uhos_u16                   mtu;                             //<! 对端支持的MTU
+    const uhos_ble_sim_attr_t *attrs;                           //<! 属性表
+    uhos_u16                   attr_num;                        //<! 属性个数
+    uhos_bool                  bonded;                          //<! 已与本端绑定，出现在协议栈的绑定设备列表中
+} uhos_ble_sim_peer_t;
+
+/**
+ * @enum        虚拟对端收到的数据类型
+ */
+typedef enum
+{
+    UHOS_BLE_SIM_PEER_RX_NOTIFY,                                //<! 本端server发送的通知
+    UHOS_BLE_SIM_PEER_RX_INDICATE,                              //<! 本端server发送的指示
+    UHOS_BLE_SIM_PEER_RX_WRITE_REQ,                             //<! 本端client的写请求
+    UHOS_BLE_SIM_PEER_RX_WRITE_CMD,                             //<! 本端client的写命令
+    UHOS_BLE_SIM_PEER_RX_READ_RSP                               //<! 本端server的读响应
+} uhos_ble_sim_peer_rx_t;
+
+/**
+ * @brief       虚拟对端收到数据的回调，在模拟器线程中调用，不可阻塞
+ */
+typedef void (*uhos_ble_sim_peer_rx_cb_t)(const uhos_u8 *addr, uhos_ble_sim_peer_rx_t type, uhos_u16 handle,
+                                          const uhos_u8 *data, uhos_u16 len);
+
+/**
+ * @struct      链路信息
+ */
+typedef struct uhos_ble_sim_link_info
+{
+    uhos_u16            conn_id;                                //<! 连接ID
+    uhos_ble_gap_role_t role;                                   //<! 本端角色
+    uhos_u16            conn_interval;                          //<! 连接间隔，单位1.25ms
+    uhos_u16            latency;                                //<! 从设备时延
+    uhos_u16            timeout;                                //<! 监控超时，单位10ms
+    uhos_u16            mtu;                                    //<! ATT MTU
+    uhos_u16            ll_payload;                             //<! LL数据包最大载荷
+    uhos_u32            conn_events;                            //<! 已发生的连接事件数
+    uhos_u32            tx_pdus;                                //<! 本端发出的ATT PDU数
+    uhos_u32            tx_bytes;                               //<! 本端发出的属性值字节数
+    uhos_u32            rx_pdus;                                //<! 本端收到的ATT PDU数
+    uhos_u32            rx_bytes;                               //<! 本端收到的属性值字节数
+    uhos_u32            tx_full;                                //<! 发送队列满被拒绝的次数
+} uhos_ble_sim_link_info_t;
+
+/**
+ * @struct      模拟器统计信息
+ */
+typedef struct uhos_ble_sim_stats
+{
+    uhos_u32 adv_sent;                                          //<! 虚拟广播者发出的广播数
+    uhos_u32 adv_reports;                                       //<! 上报的广播数
+    uhos_u32 rsp_reports;                                       //<! 上报的扫描响应数
+    uhos_u32 adv_missed;                                        //<! 落在扫描窗口之外的广播数
+    uhos_u32 adv_wl_filtered;                                   //<! 被白名单过滤的广播数
+    uhos_u32 evt_delivered;                                     //<! 已投递的协议栈回调事件数
+    uhos_u32 evt_dropped;                                       //<! 事件队列满丢弃的事件数
+    uhos_u32 evt_max_depth;                                     //<! 事件队列的最大深度
+    uhos_u32 wl_rejected;                                       //<! 被拒绝的白名单更新次数
+    uhos_u32 ext_reports;                                       //<! 上报的扩展广播分段数
+} uhos_ble_sim_stats_t;
+
+/**************************************************************************************************/
+/*                                         全局变量声明                                           */
+/**************************************************************************************************/
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       设置模拟器配置，须在uhos_ble_enable之前调用；新配置对之后建立的连接生效
+ * @param[in]   cfg     配置，字段为0时使用默认值
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_sim_config_set(const uhos_ble_sim_cfg_t *cfg);
+
+/**
+ * @brief       添加虚拟广播者，地址已存在时更新其参数与数据
+ * @param[in]   adv     广播者描述
+ * @return      uhos_ble_status_t 执行结果，数量超过上限返回UHOS_BLE_ERROR
+ */
+uhos_ble_status_t uhos_ble_sim_adv_add(const uhos_ble_sim_adv_t *adv);
+
+/**
+ * @brief       删除虚拟广播者
+ * @param[in]   addr    广播者地址
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_sim_adv_remove(const uhos_ble_addr_t addr);
+
+/**
+ * @brief       删除所有虚拟广播者
+ */
+void uhos_ble_sim_adv_clear(void);
+
+/**
+ * @brief       添加虚拟对端，地址已存在时替换其属性表
+ * @param[in]   peer    对端描述
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_sim_peer_add(const uhos_ble_sim_peer_t *peer);
+
+/**
+ * @brief       删除虚拟对端，已建立的连接被断开
+ * @param[in]   addr    对端地址
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_sim_peer_remove(const uhos_ble_addr_t addr);
+
+/**
+ * @brief       设置虚拟对端收到数据的回调
+ * @param[in]   cb      回调函数，UHOS_NULL表示取消
+ */
+void uhos_ble_sim_peer_rx_cb_set(uhos_ble_sim_peer_rx_cb_t cb);
+
+/**
+ * @brief       虚拟对端向本端发起连接，要求本端正在进行可连接广播
+ * @param[in]   addr    对端地址
+ * @param[out]  conn_id 连接ID，可为UHOS_NULL
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_sim_peer_connect(const uhos_ble_addr_t addr, uhos_u16 *conn_id);
+
+/**
+ * @brief       虚拟对端断开连接
+ * @param[in]   addr    对端地址
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_sim_peer_disconnect(const uhos_ble_addr_t addr);
+
+/**
+ * @brief       虚拟对端写本端server的属性
+ * @param[in]   addr        对端地址
+ * @param[in]   handle      属性句柄
+ * @param[in]   data        数据
+ * @param[in]   len         数据长度，不超过MTU-3
+ * @param[in]   need_rsp    UHOS_TRUE-写请求，UHOS_FALSE-写命令
+ * @return      uhos_ble_status_t 执行结果，队列满返回UHOS_BLE_BUSY
+ */
+uhos_ble_status_t uhos_ble_sim_peer_write(const uhos_ble_addr_t addr, uhos_u16 handle, const uhos_u8 *data,
+                                          uhos_u16 len, uhos_bool need_rsp);
+
+/**
+ * @brief       虚拟对端读本端server的属性，读响应通过uhos_ble_sim_peer_rx_cb_set设置的回调返回
+ * @note        由协议栈自动响应的属性直接返回属性值；由应用响应的属性上报READ_EVT，应用回复后返回
+ * @param[in]   addr        对端地址
+ * @param[in]   handle      属性句柄
+ * @return      uhos_ble_status_t 执行结果，队列满返回UHOS_BLE_BUSY
+ */
+uhos_ble_status_t uhos_ble_sim_peer_read(const uhos_ble_addr_t addr, uhos_u16 handle);
+
+/**
+ * @brief       虚拟对端向本端发送通知或指示
+ * @param[in]   addr        对端地址
+ * @param[in]   handle      特征值句柄
+ * @param[in]   data        数据
+ * @param[in]   len         数据长度，不超过MTU-3
+ * @param[in]   is_notify   UHOS_TRUE-通知，UHOS_FALSE-指示
+ * @return      uhos_ble_status_t 执行结果，队列满返回UHOS_BLE_BUSY
+ */
+uhos_ble_status_t uhos_ble_sim_peer_notify(const uhos_ble_addr_t addr, uhos_u16 handle, const uhos_u8 *data,
+                                           uhos_u16 len, uhos_bool is_notify);
+
+/**
+ * @brief       虚拟对端发起MTU交换
+ * @param[in]   addr    对端地址
+ * @param[in]   mtu     对端MTU
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_sim_peer_mtu_exchange(const uhos_ble_addr_t addr, uhos_u16 mtu);
+
+/**
+ * @brief       修改虚拟对端属性的值，不产生通知
+ * @param[in]   addr    对端地址
+ * @param[in]   handle  属性句柄
+ * @param[in]   data    数据
+ * @param[in]   len     数据长度
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_sim_peer_attr_set(const uhos_ble_addr_t addr, uhos_u16 handle, const uhos_u8 *data,
+                                             uhos_u16 len);
+
+/**
+ * @brief       虚拟对端的属性表发生变化，已连接时向本端client上报Service Changed
+ * @param[in]   addr    对端地址
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_sim_peer_service_changed(const uhos_ble_addr_t addr);
+
+/**
+ * @brief       获取与虚拟对端之间的链路信息
+ * @param[in]   addr    对端地址
+ * @param[out]  info    链路信息
+ * @return      uhos_ble_status_t 执行结果，未连接返回UHOS_BLE_ERROR
+ */
+uhos_ble_status_t uhos_ble_sim_link_get(const uhos_ble_addr_t addr, uhos_ble_sim_link_info_t *info);
+
+/**
+ * @brief       获取模拟器统计信息
+ * @param[out]  stats   统计信息
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_sim_stats_get(uhos_ble_sim_stats_t *stats);
+
+/**
+ * @brief       清零模拟器统计信息（含链路统计）
+ */
+void uhos_ble_sim_stats_reset(void);
+
+/**
+ * @brief       获取模拟器的基准测试环境，用于uhos_ble_bench_env_set
+ * @note        每个用例新建虚拟对端并连接：notify用例由对端连接本端广播，写用例由本端发起连接；
+ *              对端在用例句柄上提供可写特征；CPU时间为进程CPU时间（含模拟器线程），不统计系统内存分配
+ * @return      基准测试环境
+ */
+const uhos_ble_bench_env_t *uhos_ble_sim_bench_env_get(void);
+
+/**
+ * @brief       分片通道测试：本端notify分片发送多条消息，用虚拟对端收到的分片检查按序重组、乱序与丢片的处理
+ * @note        须在uhos_ble_enable之后、没有其他连接与广播时调用；执行期间占用虚拟对端收到数据的回调，
+ *              每个用例输出一行JSON
+ * @param[in]   print   输出函数
+ * @return      uhos_ble_status_t 执行结果，有用例失败时返回UHOS_BLE_ERROR
+ */
+uhos_ble_status_t uhos_ble_sim_frag_test_run(uhos_bench_print_t print);
+
+/**
+ * @brief       GATT client属性缓存测试：同一虚拟对端首次连接、已绑定重连、未绑定重连，
+ *              检查服务发现是否由缓存完成，并记录从连接建立到首次写入完成的时间
+ * @note        须在uhos_ble_enable之后、没有其他连接与广播时调用；执行期间占用GATT client操作完成回调，
+ *              开始与结束时清除所有对端的属性缓存；缓存经AL_FS持久化，每个用例输出一行JSON
+ * @param[in]   print   输出函数
+ * @return      uhos_ble_status_t 执行结果，有用例失败时返回UHOS_BLE_ERROR
+ */
+uhos_ble_status_t uhos_ble_sim_cache_test_run(uhos_bench_print_t print);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_BLE_SIM_H__
+/**@} grp_uhosble end */
@@ -33,6 +33,15 @@ UHSD_API uhos_s32 uhos_libc_atoi(const uhos_char *nptr);
  */
 UHSD_API uhos_s64 uhos_libc_atoll(const uhos_char *nptr);
 
+/**
+ * @brief 将字符串转为unsigned long
+ * @param nptr 字符串指针
+ * @param endptr 输出第一个未转换字符的位置，可为空
+ * @param base 进制，0表示按前缀自动识别
+ * @return unsigned long 转换结果，溢出时为ULONG_MAX
+ */
+UHSD_API unsigned long uhos_libc_strtoul(const uhos_char *nptr, uhos_char **endptr, int base);
+
 /**
  * @brief 计算字符串长度
  *
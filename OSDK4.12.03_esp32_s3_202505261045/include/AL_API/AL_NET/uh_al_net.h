@@ -930,6 +930,86 @@ extern uhos_void uhos_net_fd_rcv_plus(uhos_s32 fd);
  */
 extern uhos_void uhos_net_fd_rcv_minus(uhos_s32 fd);
 
+/** @def UHOS_NET_POLL_XXX
+ *
+ * @brief poller关注/返回的事件，可按位组合。
+ * IN  可读（含对端关闭、监听socket有新连接）。
+ * OUT 可写（含非阻塞connect完成）。
+ * ERR 异常，总是返回，无需关注。
+ * HUP 对端挂断，总是返回，无需关注。
+ *
+ */
+#define UHOS_NET_POLL_IN  0x01
+#define UHOS_NET_POLL_OUT 0x02
+#define UHOS_NET_POLL_ERR 0x04
+#define UHOS_NET_POLL_HUP 0x08
+
+/** @def UHOS_NET_POLL_CTL_XXX
+ *
+ * @brief uhos_net_poller_ctl操作方式。
+ * ADD 注册fd。
+ * DEL 注销fd。
+ * MOD 修改已注册fd关注的事件与用户数据。
+ *
+ */
+#define UHOS_NET_POLL_CTL_ADD OP_ADD
+#define UHOS_NET_POLL_CTL_DEL OP_DELETE
+#define UHOS_NET_POLL_CTL_MOD 3
+
+/**
+ * @brief poller句柄，由uhos_net_poller_create创建。
+ */
+typedef struct uhos_net_poller_s *uhos_net_poller_t;
+
+/**
+ * @brief poller返回的就绪事件。
+ */
+typedef struct
+{
+    uhos_s32 fd;      /* 就绪的文件描述符。 */
+    uhos_u32 events;  /* 就绪事件，UHOS_NET_POLL_XXX组合。 */
+    uhos_void *data;  /* 注册时传入的用户数据。 */
+} uhos_net_poll_event_t;
+
+/**
+ * @brief 创建poller。fd注册一次后持续有效，每次等待只返回就绪的fd，调用者无需每次重建fd set。
+ * @note 等待的代价取决于平台：Linux基于epoll，与就绪fd数相关；
+ *       ESP32(lwIP)未向应用开放socket事件回调，基于lwIP select实现，每次等待仍与注册fd数相关，
+ *       注册fd受FD_SETSIZE（CONFIG_LWIP_MAX_SOCKETS）限制，仅省去调用者重建与扫描整个fd set的开销。
+ * @param max_fds 预计注册的fd数量，仅作为容量提示，0表示使用默认值。
+ * @return 成功返回poller句柄，失败返回UHOS_NULL。
+ */
+extern uhos_net_poller_t uhos_net_poller_create(uhos_u32 max_fds);
+
+/**
+ * @brief 注册、注销或修改poller中的fd，可在其他线程等待期间调用。
+ * @param poller poller句柄。
+ * @param op 操作方式，UHOS_NET_POLL_CTL_ADD/DEL/MOD。
+ * @param fd 文件描述符。
+ * @param events 关注的事件，UHOS_NET_POLL_IN/OUT组合；DEL时忽略。
+ * @param data 用户数据，就绪时原样返回；DEL时忽略。
+ * @return 0表示成功，-1表示失败（fd重复注册、未注册或超出容量）。
+ * @note fd关闭前应先注销。事件为水平触发，与uhos_net_select语义一致。
+ */
+extern uhos_s32 uhos_net_poller_ctl(uhos_net_poller_t poller, uhos_u8 op, uhos_s32 fd, uhos_u32 events, uhos_void *data);
+
+/**
+ * @brief 等待注册的fd就绪。
+ * @param poller poller句柄。
+ * @param events 输出就绪事件的数组。
+ * @param max_events 数组长度。
+ * @param timeout_ms 超时时间（毫秒），-1表示一直等待，0表示立即返回。
+ * @return >0，就绪fd的个数。=0，超时。<0，错误。
+ */
+extern uhos_s32 uhos_net_poller_wait(uhos_net_poller_t poller, uhos_net_poll_event_t *events, uhos_s32 max_events, uhos_s32 timeout_ms);
+
+/**
+ * @brief 销毁poller，不关闭已注册的fd。
+ * @param poller poller句柄。
+ * @return N/A。
+ */
+extern uhos_void uhos_net_poller_destroy(uhos_net_poller_t poller);
+
 /** @def NETIF_TYPE_STA/NETIF_TYPE_AP
  *
  * @brief 网络接口类型，在不同的系统上，WIFI STA和WIFI
@@ -949,6 +1029,120 @@ extern uhos_void uhos_net_fd_rcv_minus(uhos_s32 fd);
  */
 extern uhos_s32 uhos_net_dns_config(uhos_u8 op, uhos_char *dns_server);
 
+/* 单个域名缓存的最大IPv4地址数。 */
+#ifndef CONFIG_UHOS_NET_DNS_ADDR_MAX
+#define CONFIG_UHOS_NET_DNS_ADDR_MAX 4
+#endif
+
+/** @def UHOS_NET_DNS_XXX
+ *
+ * @brief 域名解析结果状态。
+ * OK       解析成功。
+ * NOTFOUND 域名不存在或没有IPv4地址。
+ * TIMEOUT  所有DNS服务器均未应答。
+ * ERROR    其他错误（参数错误、资源不足、服务器拒绝等）。
+ *
+ */
+#define UHOS_NET_DNS_OK       0
+#define UHOS_NET_DNS_NOTFOUND (-1)
+#define UHOS_NET_DNS_TIMEOUT  (-2)
+#define UHOS_NET_DNS_ERROR    (-3)
+
+/**
+ * @brief 域名解析结果。
+ */
+typedef struct
+{
+    uhos_s32 status;                                        /* 结果状态，UHOS_NET_DNS_XXX。 */
+    uhos_u8 num;                                            /* 地址个数。 */
+    uhos_u8 stale;                                          /* 1表示地址已超过TTL，正在后台刷新。 */
+    struct uhos_in_addr addr[CONFIG_UHOS_NET_DNS_ADDR_MAX]; /* IPv4地址，网络字节序。 */
+} uhos_net_dns_result_t;
+
+/**
+ * @brief 异步域名解析回调。
+ * @param host 域名。
+ * @param result 解析结果，仅在回调期间有效。
+ * @param arg 发起解析时传入的用户参数。
+ */
+typedef uhos_void (*uhos_net_dns_cb_t)(const uhos_char *host, const uhos_net_dns_result_t *result, uhos_void *arg);
+
+/**
+ * @brief 域名解析统计。
+ */
+typedef struct
+{
+    uhos_u32 hits;       /* 命中未过期缓存。 */
+    uhos_u32 stale_hits; /* 命中已过期缓存，同时后台刷新。 */
+    uhos_u32 neg_hits;   /* 命中域名不存在的缓存。 */
+    uhos_u32 misses;     /* 未命中，发起查询。 */
+    uhos_u32 merged;     /* 与进行中的相同查询合并。 */
+    uhos_u32 queries;    /* 发出的查询报文数（含重传）。 */
+    uhos_u32 timeouts;   /* 查询超时。 */
+    uhos_u32 rejected;   /* 来源不是所查询的服务器而丢弃的应答。 */
+} uhos_net_resolver_stats_t;
+
+/**
+ * @brief 初始化异步域名解析器，创建解析线程。
+ * @param servers DNS服务器列表，格式"ip[:port],ip[:port]"；UHOS_NULL表示每次查询时使用uhos_net_dns_config查询到的系统DNS。
+ * @return 成功返回0，失败返回-1。
+ */
+extern uhos_s32 uhos_net_resolver_init(const uhos_char *servers);
+
+/**
+ * @brief 反初始化域名解析器，进行中的查询以UHOS_NET_DNS_ERROR回调，清空缓存。
+ * @return N/A。
+ */
+extern uhos_void uhos_net_resolver_deinit(uhos_void);
+
+/**
+ * @brief 异步解析域名的IPv4地址，不阻塞调用者。
+ * @details 先查缓存：未过期的地址与域名不存在的结果直接返回；已过期但在宽限期内的地址也直接返回(stale为1)，
+ * 同时在后台刷新。未命中时发起查询，与进行中的相同域名查询合并。
+ * DNS与uhos_net_resolver_httpdns_update提供的地址合并返回。
+ * @param host 域名或点分十进制IP地址。
+ * @param cb 结果回调。
+ * @param arg 用户参数。
+ * @return 0表示命中缓存，cb已在当前上下文调用；1表示已发起查询，cb稍后在解析线程中调用；-1表示失败，cb不会被调用。
+ */
+extern uhos_s32 uhos_net_resolve_async(const uhos_char *host, uhos_net_dns_cb_t cb, uhos_void *arg);
+
+/**
+ * @brief 同步解析域名，基于uhos_net_resolve_async，命中缓存时不等待。
+ * @param host 域名或点分十进制IP地址。
+ * @param result 解析结果。
+ * @param timeout_ms 最长等待时间（毫秒）。
+ * @return 结果状态，UHOS_NET_DNS_XXX。
+ */
+extern uhos_s32 uhos_net_resolve(const uhos_char *host, uhos_net_dns_result_t *result, uhos_u32 timeout_ms);
+
+/**
+ * @brief 合并HTTP-DNS的解析结果，替换该域名之前由HTTP-DNS提供的地址。
+ * @note 目前没有调用者：SDK的HTTP-DNS（uhsd_dev_httpDNS_enable_set开启）在SDK库内部完成解析并直接使用结果，
+ * 不经过本接口，也不提供获取结果的回调，因此开启HTTP-DNS不会向本解析器的缓存写入地址。
+ * 在SDK库提供结果回调之前，只有应用自行获取HTTP-DNS结果并调用本接口时才会合并。
+ * @param host 域名。
+ * @param addr IPv4地址数组，网络字节序；num为0时清除HTTP-DNS地址。
+ * @param num 地址个数。
+ * @param ttl_sec 地址有效期（秒）。
+ * @return 成功返回0，失败返回-1。
+ */
+extern uhos_s32 uhos_net_resolver_httpdns_update(const uhos_char *host, const struct uhos_in_addr *addr, uhos_u8 num, uhos_u32 ttl_sec);
+
+/**
+ * @brief 清除域名缓存，例如连接该域名的地址失败时。
+ * @param host 域名；UHOS_NULL表示清除全部。
+ * @return N/A。
+ */
+extern uhos_void uhos_net_resolver_flush(const uhos_char *host);
+
+/**
+ * @brief 获取域名解析统计。
+ * @param stats 统计信息。
+ * @return 成功返回0，失败返回-1。
+ */
+extern uhos_s32 uhos_net_resolver_stats_get(uhos_net_resolver_stats_t *stats);
+
 #define UHOS_DHCPC_EVENT_RENEW_OK   0
 #define UHOS_DHCPC_EVENT_RENEW_FAIL 1
 
@@ -1077,6 +1271,30 @@ extern struct uhos_cmsghdr *uhos_net_cmsg_nxthdr(struct uhos_msghdr *mhdr, struc
 */
 extern uhos_ssize_t uhos_net_recvmsg(uhos_s32 fd, struct uhos_msghdr *message, uhos_s32 flags);
 
+/* 单次uhos_net_sendmsg/uhos_net_writev允许的最大iovec个数。 */
+#ifndef CONFIG_UHOS_NET_IOV_MAX
+#define CONFIG_UHOS_NET_IOV_MAX 16
+#endif
+
+/**
+ * @brief 聚合发送，按顺序发送message->msg_iov中的各段数据，协议头与负载无需先拷贝到连续的buffer。
+ * @param fd 套接字。
+ * @param message 待发送的消息；msg_name为UHOS_NULL时用于已连接的套接字，msg_control忽略。
+ * @param flags 与uhos_net_send一致。
+ * @return 成功返回实际发送的字节数（流式套接字可能小于总长度），失败返回-1，
+ *         msg_iovlen超过CONFIG_UHOS_NET_IOV_MAX时返回-1。
+ */
+extern uhos_ssize_t uhos_net_sendmsg(uhos_s32 fd, const struct uhos_msghdr *message, uhos_s32 flags);
+
+/**
+ * @brief 聚合写，等价于msg_name为UHOS_NULL、flags为0的uhos_net_sendmsg。
+ * @param fd 已连接的套接字。
+ * @param iov 数据段数组。
+ * @param iovcnt 数据段个数，不超过CONFIG_UHOS_NET_IOV_MAX。
+ * @return 成功返回实际发送的字节数，失败返回-1。
+ */
+extern uhos_ssize_t uhos_net_writev(uhos_s32 fd, const struct uhos_iovec *iov, uhos_s32 iovcnt);
+
 #define UHOS_IN6_IS_ADDR_LINKLOCAL(a)                                                             \
     ({                                                                                            \
         const struct uhos_in6_addr *__a = (const struct uhos_in6_addr *)(a);                      \
@@ -0,0 +1,175 @@
+/**
+ * @addtogroup grp_uhosnet
+ * @{
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_http.h
+ * @author agent (agent@local)
+ * @brief HTTP/HTTPS客户端接口，按服务器维护连接池，连接保持复用
+ * @details 基于uhos_net_*与uhos_tls_*实现。请求完成后连接放回连接池，同一服务器的后续请求直接复用，
+ *          省去TCP建连与TLS握手。空闲超时的连接在取用与归还时清理，也可由uhos_http_pool_evict周期清理。
+ *          已调用uhos_tls_session_cache_init时，新建的HTTPS连接恢复该服务器缓存的tls会话，只进行简化握手。
+ * @note 连接复用只对经本接口发出的请求生效。SDK闭源库中的REST调用仍各自建连与握手，不经过连接池，包括：
+ *       大数据上报（uhsd_dev_bigdata_report）、扫地机历史数据上报（uhsd_sweeper_history_data_report）、
+ *       文件推送到OSS（uhsd_push_file_to_oss）、用户token获取（uhsd_dev_get_user_token）与版本查询。
+ *       这些调用改用连接池需要在SDK库中修改，开源部分无法替换。
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：HTTP/HTTPS客户端接口，按服务器维护连接池，连接保持复用
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>说明SDK闭源库中的REST调用不经过连接池
+ * </table>
+ */
+
+#ifndef __UH_HTTP_H__
+#define __UH_HTTP_H__
+
+#include "uh_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @def CONFIG_UHOS_HTTP_POOL_MAX
+ * 连接池缓存的空闲连接总数。
+ */
+#ifndef CONFIG_UHOS_HTTP_POOL_MAX
+#define CONFIG_UHOS_HTTP_POOL_MAX 4
+#endif
+
+/**
+ * @def CONFIG_UHOS_HTTP_POOL_PER_HOST
+ * 每个服务器缓存的空闲连接数。
+ */
+#ifndef CONFIG_UHOS_HTTP_POOL_PER_HOST
+#define CONFIG_UHOS_HTTP_POOL_PER_HOST 2
+#endif
+
+/**
+ * @def CONFIG_UHOS_HTTP_IDLE_MS
+ * 空闲连接的最长保留时间（毫秒），服务器通过Keep-Alive头声明更短的超时时以服务器为准。
+ */
+#ifndef CONFIG_UHOS_HTTP_IDLE_MS
+#define CONFIG_UHOS_HTTP_IDLE_MS 30000
+#endif
+
+/**
+ * @def CONFIG_UHOS_HTTP_PIPELINE_DEPTH
+ * uhos_http_request_batch在一个连接上连续发出、未收到响应的最多请求数。
+ */
+#ifndef CONFIG_UHOS_HTTP_PIPELINE_DEPTH
+#define CONFIG_UHOS_HTTP_PIPELINE_DEPTH 4
+#endif
+
+/**
+ * @brief HTTP请求。
+ */
+typedef struct uhos_http_req
+{
+    const uhos_char *method;   /* 请求方法，如"GET"、"POST"。 */
+    const uhos_char *host;     /* 服务器域名或点分十进制IP地址。 */
+    uhos_u16 port;             /* 服务器端口，0表示使用默认端口。 */
+    uhos_u8 https;             /* 1-HTTPS，0-HTTP。 */
+    const uhos_char *path;     /* 请求路径，含查询参数。 */
+    const uhos_char *headers;  /* 附加请求头，每行以"\r\n"结尾，可为NULL。 */
+    const uhos_u8 *body;       /* 请求体，可为NULL。 */
+    uhos_size_t body_len;      /* 请求体长度。 */
+    uhos_u32 timeout_ms;       /* 请求超时（毫秒），含建连、握手与接收响应。 */
+} uhos_http_req_t;
+
+/**
+ * @brief HTTP响应。
+ */
+typedef struct uhos_http_rsp
+{
+    uhos_s32 status;           /* HTTP状态码。 */
+    uhos_u8 *buf;              /* 调用者提供的响应体buffer，可为NULL表示丢弃响应体。 */
+    uhos_size_t buf_size;      /* buffer大小。 */
+    uhos_size_t body_len;      /* 写入buffer的响应体长度。 */
+    uhos_size_t total_len;     /* 响应体总长度，大于body_len表示buffer不足，超出部分已丢弃。 */
+} uhos_http_rsp_t;
+
+/**
+ * @brief 连接池配置。
+ */
+typedef struct uhos_http_pool_cfg
+{
+    const uhos_u8 *ca_cert;    /* HTTPS使用的CA证书，可为NULL，初始化时解析一次，各连接共用。 */
+    uhos_size_t ca_cert_len;   /* CA证书长度。 */
+    uhos_u8 max_conns;         /* 空闲连接总数上限，0表示不缓存连接，每个请求后关闭。 */
+    uhos_u8 max_per_host;      /* 每个服务器的空闲连接数上限。 */
+    uhos_u32 idle_ms;          /* 空闲连接最长保留时间（毫秒）。 */
+} uhos_http_pool_cfg_t;
+
+/**
+ * @brief 连接池统计。
+ */
+typedef struct uhos_http_pool_stats
+{
+    uhos_u32 requests;         /* 完成的请求数。 */
+    uhos_u32 reused;           /* 复用空闲连接的请求数。 */
+    uhos_u32 connects;         /* 新建的TCP连接数。 */
+    uhos_u32 handshakes;       /* 完成的TLS握手数。 */
+    uhos_u32 resumed;          /* 其中恢复会话的握手数。 */
+    uhos_u32 pipelined;        /* 未等待前一响应即发出的请求数。 */
+    uhos_u32 evicted;          /* 因空闲超时、服务器关闭或池满而关闭的空闲连接数。 */
+    uhos_u32 retries;          /* 复用连接已被服务器关闭，换新连接重试的次数。 */
+} uhos_http_pool_stats_t;
+
+/**
+ * @brief 初始化连接池。
+ * @param cfg 配置，NULL表示使用CONFIG_UHOS_HTTP_XXX默认值。
+ * @return 成功返回0，失败返回-1。
+ */
+extern uhos_s32 uhos_http_pool_init(const uhos_http_pool_cfg_t *cfg);
+
+/**
+ * @brief 反初始化连接池，关闭所有空闲连接。
+ * @details 调用前须确保没有进行中的请求。
+ * @return N/A。
+ */
+extern uhos_void uhos_http_pool_deinit(uhos_void);
+
+/**
+ * @brief 发送HTTP请求并接收响应，优先复用连接池中同一服务器的空闲连接。
+ * @details 复用的连接在收到任何响应数据前断开时（服务器已关闭空闲连接），
+ * 幂等方法的请求换新连接重试一次。
+ * @param req 请求。
+ * @param rsp 响应，调用前设置buf与buf_size。
+ * @return 成功返回0（rsp->status为HTTP状态码），失败返回-1。
+ */
+extern uhos_s32 uhos_http_request(const uhos_http_req_t *req, uhos_http_rsp_t *rsp);
+
+/**
+ * @brief 批量发送HTTP请求，按顺序返回响应。
+ * @details 服务器已在该连接上以HTTP/1.1保持连接响应过时，连续的同一服务器幂等请求
+ * 不等待前一响应即发出（最多CONFIG_UHOS_HTTP_PIPELINE_DEPTH个）；其他情况逐个发送。
+ * 连接中途关闭时，未收到响应的请求换新连接重发。
+ * @param reqs 请求数组。
+ * @param rsps 响应数组，与reqs一一对应。
+ * @param num 请求个数。
+ * @return 成功完成的请求数，小于num时第一个未完成的请求之后的请求均未完成。
+ */
+extern uhos_u32 uhos_http_request_batch(const uhos_http_req_t *reqs, uhos_http_rsp_t *rsps, uhos_u32 num);
+
+/**
+ * @brief 关闭空闲超时的连接，可由周期定时器调用。
+ * @return N/A。
+ */
+extern uhos_void uhos_http_pool_evict(uhos_void);
+
+/**
+ * @brief 获取连接池统计。
+ * @param stats 统计值。
+ * @return N/A。
+ */
+extern uhos_void uhos_http_pool_stats_get(uhos_http_pool_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __UH_HTTP_H__ */
+/**@}*/
@@ -78,6 +78,87 @@ uhos_s32 uhos_aes_setkey_enc(uhos_void *ctx, const uhos_u8 *key, uhos_u32 keybit
  */
 uhos_s32 uhos_aes_crypt_cbc(uhos_void *ctx, UHOS_AES_CRYPT_E crypt_mode, uhos_size_t length, uhos_u8 iv[16], const uhos_u8 *input, uhos_u8 *output);
 
+/**
+ * @brief aes-ctr加解密数据。
+ * @details 加密与解密相同，均使用uhos_aes_setkey_enc设置的秘钥。
+ * 数据可分段处理，每段长度任意，无需16字节对齐：nc_off、nonce_counter与stream_block保存上一段结束时的状态，
+ * 分段结果与一次处理全部数据相同。input与output可以为同一buffer（原地加解密）。
+ * 同一秘钥下nonce_counter不得重复使用。
+ * @param ctx aes句柄。
+ * @param length 数据长度。
+ * @param nc_off 当前stream_block中已使用的字节数，首段设为0(使用后更新)。
+ * @param nonce_counter 128位计数器，大端序，首段设为nonce与初始计数值(使用后更新)。
+ * @param stream_block 保存的密钥流块(使用后更新)。
+ * @param input 加解密之前的数据。
+ * @param output 加解密之后的数据。
+ * @return 成功返回0，失败返回-1。
+ */
+uhos_s32 uhos_aes_crypt_ctr(uhos_void *ctx, uhos_size_t length, uhos_size_t *nc_off, uhos_u8 nonce_counter[16], uhos_u8 stream_block[16],
+                            const uhos_u8 *input, uhos_u8 *output);
+
+/**
+ * @brief aes-gcm初始化。
+ * @details 一个句柄设置一次秘钥后可依次处理多条消息，每条消息依次调用starts、update(可多次)、finish。
+ * @return 成功返回gcm句柄，失败返回NULL。
+ */
+uhos_void *uhos_aes_gcm_init(uhos_void);
+
+/**
+ * @brief aes-gcm反初始化。
+ * @details
+ * @param ctx gcm句柄。
+ * @return 无。
+ */
+uhos_void uhos_aes_gcm_free(uhos_void *ctx);
+
+/**
+ * @brief 设置aes-gcm秘钥，加密与解密使用同一秘钥。
+ * @details
+ * @param ctx gcm句柄。
+ * @param key 秘钥buffer。
+ * @param keybits 秘钥bit位数，128、192或256。
+ * @return 成功返回0，失败返回-1。
+ */
+uhos_s32 uhos_aes_gcm_setkey(uhos_void *ctx, const uhos_u8 *key, uhos_u32 keybits);
+
+/**
+ * @brief 开始一条aes-gcm消息。
+ * @details 同一秘钥下iv不得重复使用，推荐使用12字节iv。
+ * @param ctx gcm句柄。
+ * @param crypt_mode 加解密模式。
+ *             UHOS_AES_DECRYPT：解密模式。
+ *             UHOS_AES_ENCRYPT：加密模式。
+ * @param iv 初始化向量。
+ * @param iv_len 初始化向量长度。
+ * @param add 只认证不加密的附加数据，可为NULL。
+ * @param add_len 附加数据长度。
+ * @return 成功返回0，失败返回-1。
+ */
+uhos_s32 uhos_aes_gcm_starts(uhos_void *ctx, UHOS_AES_CRYPT_E crypt_mode, const uhos_u8 *iv, uhos_size_t iv_len, const uhos_u8 *add,
+                             uhos_size_t add_len);
+
+/**
+ * @brief 加解密aes-gcm消息的一段数据。
+ * @details 每段长度任意，无需16字节对齐，output与输入等长。input与output可以为同一buffer（原地加解密）。
+ * 解密时在finish校验通过之前，输出的明文不可信。
+ * @param ctx gcm句柄。
+ * @param length 数据长度。
+ * @param input 加解密之前的数据。
+ * @param output 加解密之后的数据。
+ * @return 成功返回0，失败返回-1。
+ */
+uhos_s32 uhos_aes_gcm_update(uhos_void *ctx, uhos_size_t length, const uhos_u8 *input, uhos_u8 *output);
+
+/**
+ * @brief 结束aes-gcm消息。
+ * @details 加密模式输出认证标签；解密模式校验传入的认证标签。
+ * @param ctx gcm句柄。
+ * @param tag 认证标签，加密时输出，解密时输入。
+ * @param tag_len 认证标签长度，4~16字节，推荐16字节。
+ * @return 成功返回0，失败或解密时认证标签不匹配返回-1。
+ */
+uhos_s32 uhos_aes_gcm_finish(uhos_void *ctx, uhos_u8 *tag, uhos_size_t tag_len);
+
 #ifdef __cplusplus
 }
 #endif
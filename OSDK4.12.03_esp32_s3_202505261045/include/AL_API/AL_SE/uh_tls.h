@@ -28,6 +28,7 @@ typedef enum
     UHOS_TLS_RET_ERROR = -1,
     UHOS_TLS_RET_WANT_READ = -2,
     UHOS_TLS_RET_WANT_WRITE = -3,
+    UHOS_TLS_RET_TIMEOUT = -4,
 } UHOS_TLS_RET_E;
 
 typedef enum
@@ -89,6 +90,21 @@ uhos_s32 uhos_tls_handshake(uhos_void *handle);
  */
 uhos_s32 uhos_tls_send(uhos_void *handle, const uhos_u8 *data, uhos_size_t data_len);
 
+struct uhos_iovec;
+
+/**
+ * @brief 聚合发送tls数据。
+ * @details 按顺序发送iov中的各段数据，协议头与负载无需先拷贝到连续的buffer。
+ * 较小的相邻数据段合并为一个tls记录发送，避免每段单独成为一个记录。
+ * 返回UHOS_TLS_RET_WANT_READ或UHOS_TLS_RET_WANT_WRITE时，需以相同的剩余数据再次发送；
+ * 返回值小于总长度时，从返回值对应的位置继续发送剩余数据。
+ * @param handle tls句柄。
+ * @param iov 数据段数组。
+ * @param iovcnt 数据段个数。
+ * @return 成功返回已发送的字节数(>0)，失败返回-1，继续发送返回UHOS_TLS_RET_WANT_READ或UHOS_TLS_RET_WANT_WRITE。
+ */
+uhos_s32 uhos_tls_sendv(uhos_void *handle, const struct uhos_iovec *iov, uhos_s32 iovcnt);
+
 /**
  * @brief 接收tls数据。
  * @details 期间返回UHOS_TLS_RET_WANT_READ或UHOS_TLS_RET_WANT_WRITE，只是网络io没有数据可读或可写，需要再次接收。
@@ -158,6 +174,241 @@ uhos_s32 uhos_tls_set_own_cert(uhos_void *handle, const uhos_u8 *own_cert, uhos_
  * @return 成功返回0，失败返回-1。
  */
 uhos_s32 uhos_tls_get_cert_cn(uhos_u8 *cert_buf, uhos_size_t cert_buf_len, uhos_u8 *cert_cn_buf, uhos_size_t cert_cn_buf_len);
+
+/**
+ * @brief 创建证书库，预先解析ca证书、设备证书和私钥。
+ * @details 证书库创建后只读，可在多个tls句柄、多个线程间共享，句柄使用证书库时不再逐个连接解析证书。
+ * 证书库带引用计数，创建时为1，每个设置了该证书库的tls句柄持有一个引用，句柄释放时归还。
+ * @param ca_cert ca证书buffer，多个证书放到一个buffer里面，为NULL表示不校验服务器。
+ * @param ca_cert_len ca证书buffer长度。
+ * @param own_cert 设备证书buffer，为NULL表示不进行双向认证。
+ * @param own_cert_len 设备证书长度。
+ * @param priv_key 设备私钥buffer，own_cert不为NULL时必须设置。
+ * @param priv_key_len 设备私钥长度。
+ * @return 成功返回证书库，失败返回NULL。
+ */
+uhos_void *uhos_tls_store_create(const uhos_u8 *ca_cert, uhos_size_t ca_cert_len, const uhos_u8 *own_cert, uhos_size_t own_cert_len,
+                                 const uhos_u8 *priv_key, uhos_size_t priv_key_len);
+
+/**
+ * @brief 释放调用者持有的证书库引用。
+ * @details 最后一个引用释放时销毁证书库，仍在使用该证书库的tls句柄不受影响。
+ * @param store 证书库。
+ * @return N/A。
+ */
+uhos_void uhos_tls_store_release(uhos_void *store);
+
+/**
+ * @brief 获取证书库中设备证书的cn。
+ * @details 与uhos_tls_get_cert_cn相同，但不再重新解析证书。
+ * @param store 证书库。
+ * @param cert_cn_buf 证书cn buffer。
+ * @param cert_cn_buf_len 证书cn buffer长度。
+ * @return 成功返回0，没有设备证书或buffer不足返回-1。
+ */
+uhos_s32 uhos_tls_store_get_cert_cn(uhos_void *store, uhos_u8 *cert_cn_buf, uhos_size_t cert_cn_buf_len);
+
+/**
+ * @brief 为tls句柄设置证书库。
+ * @details 在uhos_tls_start之前调用，句柄持有证书库的一个引用。设置证书库后，
+ * uhos_tls_set_ca_cert与uhos_tls_set_own_cert设置的值不再生效。
+ * @param handle tls句柄。
+ * @param store uhos_tls_store_create创建的证书库，为NULL表示取消设置。
+ * @return 成功返回0，失败返回-1。
+ */
+uhos_s32 uhos_tls_set_ca_store(uhos_void *handle, uhos_void *store);
+
+/**
+ * @brief 握手上下文统计，用于确认证书库的共用与释放。
+ * @details 握手上下文在linux上为SSL_CTX，在esp32上为解析后的证书，证书库持有一份，
+ * 未设置证书库的tls句柄在uhos_tls_start时各自持有一份。ctx_free在上下文真正销毁时计数，
+ * 共用同一上下文的句柄与证书库全部释放后才加1。
+ */
+typedef struct
+{
+    uhos_u32 stores;        // 当前未销毁的证书库数。
+    uhos_u32 ctx_new;       // 累计创建的握手上下文数。
+    uhos_u32 ctx_free;      // 累计销毁的握手上下文数。
+    uhos_u32 ctx_shared;    // 累计共用证书库上下文启动的tls句柄数。
+} uhos_tls_store_stat_t;
+
+/**
+ * @brief 获取证书库当前的引用数。
+ * @details 调用者持有的引用加上设置了该证书库、尚未释放的tls句柄数，仅用于测试。
+ * @param store 证书库。
+ * @return 成功返回引用数，store为NULL返回-1。
+ */
+uhos_s32 uhos_tls_store_get_refs(uhos_void *store);
+
+/**
+ * @brief 获取握手上下文统计。
+ * @param stat 统计值。
+ * @return 成功返回0，失败返回-1。
+ */
+uhos_s32 uhos_tls_store_get_stat(uhos_tls_store_stat_t *stat);
+
+/**
+ * @brief 导出当前连接的tls会话。
+ * @details 会话包含服务器分配的会话ID或会话票据(RFC 5077)及主密钥，在新的tls句柄上恢复后可省去完整握手。
+ * TLS1.3的会话票据在握手完成后由服务器单独发送，需在收到第一批应用数据后再导出。
+ * 会话含密钥材料，持久化时须存放在受保护的区域。
+ * @param handle tls句柄，握手已成功。
+ * @param buf 会话buffer，为NULL时只返回所需长度。
+ * @param buf_len buffer长度。
+ * @return 成功返回会话长度，会话不可恢复或buffer不足返回-1。
+ */
+uhos_s32 uhos_tls_session_save(uhos_void *handle, uhos_u8 *buf, uhos_size_t buf_len);
+
+/**
+ * @brief 设置握手时尝试恢复的tls会话。
+ * @details 在uhos_tls_start之后、uhos_tls_handshake之前调用。服务器拒绝恢复时自动进行完整握手。
+ * @param handle tls句柄。
+ * @param buf uhos_tls_session_save导出的会话。
+ * @param buf_len 会话长度。
+ * @return 成功返回0，失败返回-1。
+ */
+uhos_s32 uhos_tls_session_restore(uhos_void *handle, const uhos_u8 *buf, uhos_size_t buf_len);
+
+/**
+ * @brief 查询握手是否恢复了会话。
+ * @details TLS1.2与TLS1.3均适用。
+ * @param handle tls句柄，握手已成功。
+ * @return 恢复了会话返回1，完整握手返回0。
+ */
+uhos_s32 uhos_tls_session_reused(uhos_void *handle);
+
+/**
+ * @brief 读取会话缓存的持久化数据。
+ * @details 由各平台实现会话缓存配置区的存储，不经uhos_sys_config_read/write：
+ * ESP32存放在加密的NVS分区CONFIG_UHOS_TLS_NVS_PARTITION（数据含会话密钥），未配置NVS加密时返回-1，会话只缓存在内存中；
+ * Linux存放在CONFIG_UHOS_TLS_SESSION_DIR目录下仅属主可读写的文件。
+ * @param zone 配置区域，见uhos_tls_session_cache_init。
+ * @param buf 数据buffer，数据短于len时其余部分不修改。
+ * @param len buffer长度。
+ * @return 成功返回0，没有数据或失败返回-1。
+ */
+uhos_s32 uhos_tls_session_zone_read(uhos_u8 zone, uhos_u8 *buf, uhos_size_t len);
+
+/**
+ * @brief 写入会话缓存的持久化数据，覆盖之前的数据。
+ * @details
+ * @param zone 配置区域，见uhos_tls_session_cache_init。
+ * @param buf 数据。
+ * @param len 数据长度。
+ * @return 成功返回0，失败返回-1。
+ */
+uhos_s32 uhos_tls_session_zone_write(uhos_u8 zone, const uhos_u8 *buf, uhos_size_t len);
+
+/**
+ * @brief 初始化按服务器缓存tls会话的会话缓存。
+ * @details zone不为0时经uhos_tls_session_zone_read加载上次保存的会话，新增服务器或完整握手得到的新会话
+ * 经uhos_tls_session_zone_write写回，重启后仍可恢复；写回有最小间隔，见CONFIG_UHOS_TLS_SESSION_PERSIST_MIN_MS。
+ * @param zone 配置区域，通常为uh_sys.h的ZONE_TLS_SESSION，0表示只缓存在内存中。
+ * @return 成功返回0，失败返回-1。
+ */
+uhos_s32 uhos_tls_session_cache_init(uhos_u8 zone);
+
+/**
+ * @brief 在握手前为tls句柄设置该服务器缓存的会话。
+ * @details
+ * @param handle tls句柄，已调用uhos_tls_start。
+ * @param host 服务器域名。
+ * @param port 服务器端口。
+ * @return 设置了缓存的会话返回0，没有缓存返回-1。
+ */
+uhos_s32 uhos_tls_session_cache_resume(uhos_void *handle, const uhos_char *host, uhos_u16 port);
+
+/**
+ * @brief 在握手成功并收到应用数据后更新该服务器的缓存会话。
+ * @details 恢复会话的握手只更新内存；新增服务器或完整握手得到的会话同时写入配置区，距上次写入过近时推迟到之后的更新。
+ * @param handle tls句柄。
+ * @param host 服务器域名。
+ * @param port 服务器端口。
+ * @return 成功返回0，会话尚不可导出返回-1。
+ */
+uhos_s32 uhos_tls_session_cache_update(uhos_void *handle, const uhos_char *host, uhos_u16 port);
+
+/**
+ * @brief 删除该服务器缓存的会话，恢复会话后握手失败时调用。
+ * @details
+ * @param host 服务器域名，为NULL时删除所有会话。
+ * @param port 服务器端口。
+ * @return N/A。
+ */
+uhos_void uhos_tls_session_cache_remove(const uhos_char *host, uhos_u16 port);
+
+struct uhos_net_poller_s;
+
+/**
+ * @brief 初始化异步握手模块，创建保护进行中握手链表的锁。
+ * @details 须在其他uhos_tls_handshake_*接口之前调用一次，重复调用直接返回0。
+ * 各接口可在多个事件循环线程中调用（每个线程一个poller），同一握手的step、cancel与超时检查须在同一线程中调用。
+ * @return 成功返回0，失败返回-1。
+ */
+uhos_s32 uhos_tls_handshake_init(uhos_void);
+
+/**
+ * @brief 异步握手完成回调。
+ * @details 回调时套接字已从poller注销，可在回调中收发数据、重新注册或释放tls句柄。
+ * @param handle tls句柄。
+ * @param result 握手成功返回0，失败返回-1，超时返回UHOS_TLS_RET_TIMEOUT。
+ * @param arg 发起握手时传入的用户参数。
+ */
+typedef uhos_void (*uhos_tls_handshake_cb_t)(uhos_void *handle, uhos_s32 result, uhos_void *arg);
+
+/**
+ * @brief 发起异步握手，不阻塞调用者。
+ * @details 立即尝试一次握手；未完成时将套接字按需要的方向(可读/可写)注册到poller，
+ * poller上该套接字的用户数据为内部握手对象，事件循环取得就绪事件后调用uhos_tls_handshake_step推进。
+ * 多个tls连接可在同一线程中并发握手，无需每个连接一个阻塞线程。
+ * @param handle tls句柄，已调用uhos_tls_start，且可选地已设置恢复的会话。
+ * @param poller 事件循环的poller。
+ * @param socket_fd 已设置给tls句柄的套接字，须为非阻塞模式，且未注册到poller。
+ * @param timeout_ms 握手超时（毫秒），0表示不超时。
+ * @param cb 完成回调。
+ * @param arg 用户参数。
+ * @return 0表示握手已完成（成功或失败），cb已在当前上下文调用；1表示握手进行中，cb稍后在事件循环中调用；-1表示失败，cb不会被调用。
+ */
+uhos_s32 uhos_tls_handshake_start(uhos_void *handle, struct uhos_net_poller_s *poller, uhos_s32 socket_fd, uhos_u32 timeout_ms,
+                                  uhos_tls_handshake_cb_t cb, uhos_void *arg);
+
+/**
+ * @brief 套接字就绪时推进异步握手，完成时注销套接字并调用回调。
+ * @details 与其他连接共用poller时，将每个就绪事件的data与events传入，返回-1表示该事件不属于异步握手，由调用者自行处理。
+ * data只与进行中的握手对象比较地址，前面事件的回调已结束该握手时返回-1，不会访问已释放的内存；
+回调中新发起的握手可能复用已释放握手对象的地址，共用poller时应在一批事件分发完成后再发起新握手。
+ * 同一握手的step、cancel与超时检查须在同一线程（事件循环）中调用。
+ * @param data 就绪事件的用户数据(uhos_net_poll_event_t.data)。
+ * @param events 就绪事件(uhos_net_poll_event_t.events)。
+ * @return 事件属于异步握手返回0，否则返回-1。
+ */
+uhos_s32 uhos_tls_handshake_step(uhos_void *data, uhos_u32 events);
+
+/**
+ * @brief 结束该poller上超时的异步握手，以UHOS_TLS_RET_TIMEOUT调用回调。
+ * @details 事件循环每次等待返回后调用，返回值可作为下次uhos_net_poller_wait的超时时间。
+ * 只处理注册在该poller上的握手，其他线程的握手及其回调不受影响。
+ * @param poller 事件循环的poller。
+ * @return 距该poller上最近一个握手超时的毫秒数，没有设置超时的进行中握手或出错时返回-1。
+ */
+uhos_s32 uhos_tls_handshake_check_timeout(struct uhos_net_poller_s *poller);
+
+/**
+ * @brief 取消进行中的异步握手，注销套接字，不调用回调。
+ * @details
+ * @param handle tls句柄。
+ * @return 取消了握手返回0，该句柄没有进行中的握手返回-1。
+ */
+uhos_s32 uhos_tls_handshake_cancel(uhos_void *handle);
+
+/**
+ * @brief 只用于异步握手的poller的简易事件循环：等待一次并处理就绪事件与超时。
+ * @details 一次取回的事件逐个分发前都重新校验其握手仍在进行，前面事件的回调结束或新建的握手不会被误推进。
+ * @param poller poller句柄。
+ * @param timeout_ms 最长等待时间（毫秒），-1表示等到最近的握手超时或有事件就绪。
+ * @return 该poller上进行中的握手数，出错返回-1。
+ */
+uhos_s32 uhos_tls_handshake_poll(struct uhos_net_poller_s *poller, uhos_s32 timeout_ms);
 #ifdef __cplusplus
 }
 #endif
@@ -103,6 +103,96 @@ UHSD_API uhos_void uhos_md_finish(uhos_void *md_ctx, uhos_u8 *output);
  */
 UHSD_API uhos_s32 uhos_md_hmac(UHOS_MD_TYPE_E md_type, const uhos_u8 *key, uhos_size_t keylen, const uhos_u8 *input, uhos_size_t ilen, uhos_u8 *output);
 
+/**
+ * @brief 流式摘要中需单独计算摘要的数据区间，如整机升级包中的子固件。
+ */
+typedef struct
+{
+    uhos_u32 offset;        /**< 区间在整个数据中的偏移。 */
+    uhos_u32 len;           /**< 区间长度。 */
+    UHOS_MD_TYPE_E md_type; /**< 区间的摘要算法。 */
+} uhos_md_range_t;
+
+/**
+ * @brief 流式摘要统计。
+ */
+typedef struct
+{
+    uhos_u32 streamed;  /**< 写入时即计算了摘要的字节数。 */
+    uhos_u32 read_back; /**< 结束时经read_cb读回计算摘要的字节数。 */
+} uhos_md_stream_stats_t;
+
+/**
+ * @brief 读回数据的回调，用于补算写入时未能按顺序计算摘要的部分。
+ * @param offset 数据偏移。
+ * @param buf 数据buffer。
+ * @param len 读取长度。
+ * @param arg 用户参数。
+ * @return 成功返回0，失败返回-1。
+ */
+typedef uhos_s32 (*uhos_md_read_cb_t)(uhos_u32 offset, uhos_u8 *buf, uhos_u32 len, uhos_void *arg);
+
+/**
+ * @brief 流式摘要初始化，在写入数据(如OTA镜像)的同时计算整体摘要及各区间的摘要。
+ * @details 写入路径每写入一段数据即调用uhos_md_stream_update，数据全部写入后调用uhos_md_stream_finish，
+ * 摘要即已算完，无需再把整个镜像读回计算。
+ * @param md_type 整体数据的摘要算法，UHOS_MD_NONE表示只计算区间摘要。
+ * @param total_len 数据总长度，可为0，此时整体摘要为空数据的摘要。
+ * @param ranges 区间数组，可为NULL。长度为0的区间得到空数据的摘要。
+ * @param range_num 区间个数，0~255。
+ * @return 成功返回流式摘要句柄，失败返回NULL。
+ */
+UHSD_API uhos_void *uhos_md_stream_init(UHOS_MD_TYPE_E md_type, uhos_u32 total_len, const uhos_md_range_t *ranges, uhos_u8 range_num);
+
+/**
+ * @brief 对写入的一段数据计算摘要。
+ * @details 数据按偏移顺序写入时直接计算。出现跳跃(先写入后面的数据)时，从跳跃处起的数据留到结束时读回计算；
+ * 重写已计算过的数据时，结束时全部读回重新计算，保证摘要与最终写入的内容一致。
+ * @param stream 流式摘要句柄。
+ * @param offset 数据偏移。
+ * @param buf 数据buffer。
+ * @param len 数据长度。
+ * @return 成功返回0，失败返回-1。
+ */
+UHSD_API uhos_s32 uhos_md_stream_update(uhos_void *stream, uhos_u32 offset, const uhos_u8 *buf, uhos_size_t len);
+
+/**
+ * @brief 完成流式摘要。
+ * @details 数据全部按顺序写入时不读回任何数据；否则经read_cb读回未计算的部分。
+ * @param stream 流式摘要句柄。
+ * @param read_cb 读回数据的回调，数据全部按顺序写入时可为NULL。
+ * @param arg 用户参数。
+ * @return 成功返回0，失败返回-1。
+ */
+UHSD_API uhos_s32 uhos_md_stream_finish(uhos_void *stream, uhos_md_read_cb_t read_cb, uhos_void *arg);
+
+/**
+ * @brief 获取流式摘要结果，在uhos_md_stream_finish成功后调用。
+ * @details
+ * @param stream 流式摘要句柄。
+ * @param index 区间序号，-1表示整体数据。
+ * @param output 摘要buffer，长度不小于uhos_md_get_size。
+ * @return 成功返回摘要长度，失败返回-1。
+ */
+UHSD_API uhos_s32 uhos_md_stream_digest(uhos_void *stream, uhos_s32 index, uhos_u8 *output);
+
+/**
+ * @brief 获取流式摘要统计。
+ * @details
+ * @param stream 流式摘要句柄。
+ * @param stats 统计值。
+ * @return 无。
+ */
+UHSD_API uhos_void uhos_md_stream_stats_get(uhos_void *stream, uhos_md_stream_stats_t *stats);
+
+/**
+ * @brief 释放流式摘要句柄。
+ * @details
+ * @param stream 流式摘要句柄。
+ * @return 无。
+ */
+UHSD_API uhos_void uhos_md_stream_free(uhos_void *stream);
+
 #ifdef __cplusplus
 }
 #endif
@@ -168,6 +168,12 @@ uhos_s32 uhos_sys_config_write(uhos_u8 config_zone, uhos_u8 *conf, uhos_size_t l
  * @brief 多子机绑定状态  大小 6k
  *
  */
+/** @def ZONE_TLS_SESSION
+ *
+ * @brief tls会话缓存  大小 4096  可选，内容含会话密钥，须使用受保护（加密）的存储区
+ *        由uh_tls的平台实现uhos_tls_session_zone_read/write存储（ESP32为NVS，Linux为文件），不经uhos_sys_config_read/write
+ *
+ */
 #define ZONE_1       1
 #define ZONE_2       2
 #define ZONE_BOARD   3
@@ -179,6 +185,7 @@ uhos_s32 uhos_sys_config_write(uhos_u8 config_zone, uhos_u8 *conf, uhos_size_t l
 #define ZONE_LICENSE 9
 #define ZONE_8       10
 #define ZONE_9       11
+#define ZONE_TLS_SESSION 12
 
 #define ZONE_OTHER 0
 
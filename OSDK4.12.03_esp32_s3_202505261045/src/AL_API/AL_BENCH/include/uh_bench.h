@@ -0,0 +1,106 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_bench.h
+ * @author agent (agent@local)
+ * @brief 各模块基准测试共用的输出回调、计时与JSON行拼接接口
+ * @details 基准测试每个用例输出一行JSON，由调用者提供的回调打印到shell、串口或文件；
+ *          各模块的用例与结果结构不同，字段通过uhos_bench_json_*逐个追加
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：各模块基准测试共用的输出回调、计时与JSON行拼接接口
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>新增uhos_bench_json_raw
+ * </table>
+ */
+
+#ifndef __UH_BENCH_H__
+#define __UH_BENCH_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+/**
+ * @brief       JSON行输出回调，line不含换行符
+ */
+typedef void (*uhos_bench_print_t)(const uhos_char *line);
+
+/**
+ * @struct      正在拼接的JSON行
+ * @note        超出缓冲区的字段被截断，之后的字段不再追加，结果仍以'\0'结尾
+ */
+typedef struct uhos_bench_json
+{
+    uhos_char *buf;                                             //<! 输出缓冲区
+    uhos_u32   size;                                            //<! 缓冲区大小
+    uhos_u32   len;                                             //<! 已写入的字符数，不含'\0'
+} uhos_bench_json_t;
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       微秒时间戳，32位回绕，仅用于计算不超过约71分钟的时间差
+ */
+uhos_u32 uhos_bench_now_us(uhos_void);
+
+/**
+ * @brief       开始一行JSON，写入'{'
+ * @param[out]  json    拼接状态
+ * @param[in]   buf     输出缓冲区
+ * @param[in]   size    缓冲区大小，至少为2
+ */
+uhos_void uhos_bench_json_begin(uhos_bench_json_t *json, uhos_char *buf, uhos_u32 size);
+
+/**
+ * @brief       追加字符串字段，value不做转义，只用于固定的用例名、模式名等
+ */
+uhos_void uhos_bench_json_str(uhos_bench_json_t *json, const uhos_char *key, const uhos_char *value);
+
+/**
+ * @brief       追加无符号整数字段
+ */
+uhos_void uhos_bench_json_u32(uhos_bench_json_t *json, const uhos_char *key, uhos_u32 value);
+
+/**
+ * @brief       追加有符号整数字段
+ */
+uhos_void uhos_bench_json_s32(uhos_bench_json_t *json, const uhos_char *key, uhos_s32 value);
+
+/**
+ * @brief       追加不加引号的字段值，用于已格式化的小数；value为UHOS_NULL时输出null
+ */
+uhos_void uhos_bench_json_raw(uhos_bench_json_t *json, const uhos_char *key, const uhos_char *value);
+
+/**
+ * @brief       追加"status"字段：0为"ok"，其他为"failed"
+ */
+uhos_void uhos_bench_json_status(uhos_bench_json_t *json, uhos_s32 status);
+
+/**
+ * @brief       结束一行JSON，写入'}'
+ * @return      写入的字符数
+ */
+uhos_s32 uhos_bench_json_end(uhos_bench_json_t *json);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_BENCH_H__
@@ -0,0 +1,130 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_bench.c
+ * @author agent (agent@local)
+ * @brief 各模块基准测试共用的计时与JSON行拼接的功能实现
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：各模块基准测试共用的计时与JSON行拼接的功能实现
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>新增uhos_bench_json_raw
+ * </table>
+ */
+
+#define LOG_TAG "bench"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_time.h"
+
+#include "uh_bench.h"
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       按格式追加内容，空间不足时截断并停止之后的追加
+ */
+static uhos_void uhos_bench_json_append(uhos_bench_json_t *json, const uhos_char *key, const uhos_char *fmt,
+                                        const uhos_char *str, uhos_s32 num)
+{
+    uhos_s32 n = 0;
+
+    if ((UHOS_NULL == json) || (UHOS_NULL == json->buf) || (json->len + 1 >= json->size))
+    {
+        return;
+    }
+
+    // 第一个字段紧跟'{'，之后的字段以','分隔
+    n = uhos_libc_snprintf(json->buf + json->len, json->size - json->len, "%s\"%s\":",
+                           (1 == json->len) ? "" : ",", key);
+    if ((n < 0) || ((uhos_u32)n >= json->size - json->len))
+    {
+        json->len = json->size - 1;
+        return;
+    }
+    json->len += n;
+
+    n = str ? uhos_libc_snprintf(json->buf + json->len, json->size - json->len, fmt, str)
+            : uhos_libc_snprintf(json->buf + json->len, json->size - json->len, fmt, num);
+    if ((n < 0) || ((uhos_u32)n >= json->size - json->len))
+    {
+        json->len = json->size - 1;
+        return;
+    }
+    json->len += n;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_u32 uhos_bench_now_us(uhos_void)
+{
+    struct uhos_timeval tv = {0};
+
+    uhos_gettimeofday(&tv, UHOS_NULL);
+
+    return (uhos_u32)tv.tv_sec * 1000000 + (uhos_u32)tv.tv_usec;
+}
+
+uhos_void uhos_bench_json_begin(uhos_bench_json_t *json, uhos_char *buf, uhos_u32 size)
+{
+    if ((UHOS_NULL == json) || (UHOS_NULL == buf) || (size < 2))
+    {
+        return;
+    }
+
+    json->buf  = buf;
+    json->size = size;
+    json->len  = 1;
+    buf[0]     = '{';
+    buf[1]     = '\0';
+}
+
+uhos_void uhos_bench_json_str(uhos_bench_json_t *json, const uhos_char *key, const uhos_char *value)
+{
+    uhos_bench_json_append(json, key, "\"%s\"", value ? value : "", 0);
+}
+
+uhos_void uhos_bench_json_u32(uhos_bench_json_t *json, const uhos_char *key, uhos_u32 value)
+{
+    uhos_bench_json_append(json, key, "%u", UHOS_NULL, (uhos_s32)value);
+}
+
+uhos_void uhos_bench_json_s32(uhos_bench_json_t *json, const uhos_char *key, uhos_s32 value)
+{
+    uhos_bench_json_append(json, key, "%d", UHOS_NULL, value);
+}
+
+uhos_void uhos_bench_json_raw(uhos_bench_json_t *json, const uhos_char *key, const uhos_char *value)
+{
+    uhos_bench_json_append(json, key, "%s", value ? value : "null", 0);
+}
+
+uhos_void uhos_bench_json_status(uhos_bench_json_t *json, uhos_s32 status)
+{
+    uhos_bench_json_str(json, "status", (0 == status) ? "ok" : "failed");
+}
+
+uhos_s32 uhos_bench_json_end(uhos_bench_json_t *json)
+{
+    if ((UHOS_NULL == json) || (UHOS_NULL == json->buf))
+    {
+        return 0;
+    }
+
+    // 截断时用最后一个字符收尾，保证输出仍以'}'结束
+    if (json->len + 1 >= json->size)
+    {
+        json->len = json->size - 2;
+    }
+    json->buf[json->len++] = '}';
+    json->buf[json->len]   = '\0';
+
+    return (uhos_s32)json->len;
+}
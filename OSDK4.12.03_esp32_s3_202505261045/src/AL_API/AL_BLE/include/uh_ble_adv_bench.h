@@ -0,0 +1,125 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_adv_bench.h
+ * @author agent (agent@local)
+ * @brief 广播透传过滤回放基准测试的接口，供shell命令与主机测试使用，不属于uh_ble.h的对外接口
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：广播透传过滤回放基准测试的接口，由uh_ble.h移出
+ * </table>
+ */
+
+#ifndef __UH_BLE_ADV_BENCH_H__
+#define __UH_BLE_ADV_BENCH_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_ble.h"
+#include "uh_bench.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                           常量定义                                             */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+/**
+ * @struct 广播回放基准测试使用的一条广播
+ */
+typedef struct uhos_ble_adv_bench_report
+{
+    uhos_u8 mac[6];      //<! 对端地址（与上报给用户的字节序一致）
+    uhos_u8 len;         //<! 原始AD数据长度（广播数据与扫描响应数据）
+    const uhos_u8 *data; //<! 原始AD数据
+} uhos_ble_adv_bench_report_t;
+
+/**
+ * @struct 广播回放基准测试用例
+ * @note   规则中每类条件各有一个值取自回放数据，其余为随机值
+ */
+typedef struct uhos_ble_adv_bench_case
+{
+    uhos_u8 relation;  //<! 0-各类条件为“或”关系；1-各类条件为“与”关系
+    uhos_u32 cid_num;  //<! 厂商CID规则数
+    uhos_u32 mac_num;  //<! MAC规则数
+    uhos_u32 uuid_num; //<! 服务UUID规则数（16/32/128位各占约三分之一）
+    uhos_u32 rounds;   //<! 回放轮数
+} uhos_ble_adv_bench_case_t;
+
+/**
+ * @struct 广播回放基准测试结果
+ * @note   逐条线性比较规则为规则编译前的匹配方式，与编译后的匹配器结果须一致
+ */
+typedef struct uhos_ble_adv_bench_result
+{
+    uhos_ble_status_t status;   //<! UHOS_BLE_SUCCESS-完成，UHOS_BLE_ERROR-参数错误、内存不足或两种匹配结果不一致
+    uhos_u32 reports;           //<! 匹配的广播条数（回放数据条数×轮数）
+    uhos_u32 matched;           //<! 匹配规则的条数
+    uhos_u32 mismatches;        //<! 编译后的匹配器与线性比较结果不一致的条数
+    uhos_u32 compile_us;        //<! 规则编译耗时（微秒）
+    uhos_u32 compiled_ns;       //<! 编译后的匹配器每条广播的耗时（纳秒）
+    uhos_u32 linear_ns;         //<! 线性比较每条广播的耗时（纳秒）
+    uhos_u32 reports_per_sec;   //<! 编译后的匹配器每秒可匹配的广播条数
+} uhos_ble_adv_bench_result_t;
+
+
+/**************************************************************************************************/
+/*                                         全局变量声明                                           */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       回放广播数据，对比编译后的透传规则匹配器与线性比较规则的匹配耗时
+ * @note        执行期间替换当前的透传过滤规则，结束后清除规则；不应在业务扫描期间执行
+ * @param[in]   bcase   测试用例
+ * @param[in]   reports 回放的广播，UHOS_NULL表示使用内置的抓包数据
+ * @param[in]   num     广播条数
+ * @param[out]  result  测试结果
+ * @return      uhos_ble_status_t 执行结果，同result->status
+ */
+uhos_ble_status_t uhos_ble_adv_bench_run(const uhos_ble_adv_bench_case_t *bcase, const uhos_ble_adv_bench_report_t *reports,
+                                         uhos_u32 num, uhos_ble_adv_bench_result_t *result);
+
+/**
+ * @brief       将广播回放用例与结果格式化为一行JSON
+ * @return      写入的字符数（不含结束符）
+ */
+uhos_s32 uhos_ble_adv_bench_result_json(const uhos_ble_adv_bench_case_t *bcase, const uhos_ble_adv_bench_result_t *result,
+                                        uhos_char *buf, uhos_u32 size);
+
+/**
+ * @brief       使用内置抓包数据，按规则数与条件关系依次执行广播回放用例，每个用例输出一行JSON
+ * @param[in]   rounds  每个用例的回放轮数，0表示使用默认值
+ * @param[in]   print   输出函数
+ * @return      uhos_ble_status_t 执行结果，有用例失败时返回UHOS_BLE_ERROR
+ */
+uhos_ble_status_t uhos_ble_adv_bench_matrix_run(uhos_u32 rounds, uhos_bench_print_t print);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_BLE_ADV_BENCH_H__
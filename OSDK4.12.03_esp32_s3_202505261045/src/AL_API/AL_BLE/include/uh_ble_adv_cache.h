@@ -0,0 +1,72 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_adv_cache.h
+ * @author agent (agent@local)
+ * @brief 广播上报去重缓存提供的内部接口头文件，供组件内部使用
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：广播上报去重缓存提供的内部接口头文件，供组件内部使用
+ * </table>
+ */
+
+#ifndef __UH_BLE_ADV_CACHE_H__
+#define __UH_BLE_ADV_CACHE_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_ble.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                           常量定义                                             */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                         全局变量声明                                           */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       去重缓存初始化
+ */
+void uhos_ble_pal_adv_cache_init(void);
+
+/**
+ * @brief       判断广播上报是否需要继续上送（仅在协议栈扫描回调上下文中调用）
+ * @note        同时更新该设备的缓存表项（载荷哈希、RSSI、平滑RSSI、最后出现时间）
+ * @param[in]   report  广播上报数据
+ * @return      UHOS_TRUE-需要上送，UHOS_FALSE-重复数据，丢弃
+ */
+uhos_bool uhos_ble_pal_adv_cache_check(const uhos_ble_gap_adv_report_t *report);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_BLE_ADV_CACHE_H__
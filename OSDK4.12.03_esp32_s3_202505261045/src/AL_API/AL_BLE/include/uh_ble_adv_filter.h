@@ -0,0 +1,73 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_adv_filter.h
+ * @author agent (agent@local)
+ * @brief 广播透传过滤提供的内部接口头文件，供组件内部使用
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：广播透传过滤提供的内部接口头文件，供组件内部使用
+ * </table>
+ */
+
+#ifndef __UH_BLE_ADV_FILTER_H__
+#define __UH_BLE_ADV_FILTER_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_ble.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                           常量定义                                             */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                         全局变量声明                                           */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       广播透传过滤初始化
+ */
+void uhos_ble_pal_adv_filter_init(void);
+
+/**
+ * @brief       使用已编译的透传规则匹配一条广播（在协议栈扫描回调上下文中调用）
+ * @param[in]   mac     对端地址（与上报给用户的字节序一致）
+ * @param[in]   data    原始AD数据（广播数据与扫描响应数据）
+ * @param[in]   len     原始AD数据长度
+ * @return      UHOS_TRUE-匹配或未设置规则，UHOS_FALSE-不匹配，丢弃
+ */
+uhos_bool uhos_ble_pal_adv_filter_match(const uhos_u8 *mac, const uhos_u8 *data, uhos_u16 len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_BLE_ADV_FILTER_H__
@@ -0,0 +1,95 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_adv_pack.h
+ * @author agent (agent@local)
+ * @brief 广播透传打包提供的内部接口头文件，供GAP层与ble_daemon任务使用
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：广播透传打包提供的内部接口头文件，供GAP层与ble_daemon任务使用
+ * </table>
+ */
+
+#ifndef __UH_BLE_ADV_PACK_H__
+#define __UH_BLE_ADV_PACK_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_ble.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                           常量定义                                             */
+/**************************************************************************************************/
+#define UHOS_BLE_ADV_PACK_IDLE              0xFFFFFFFF          //<! 没有等待发送的帧
+
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+// 广播透传打包默认关闭：帧格式须与接收方约定，定义CONFIG_UHOS_BLE_ADV_PACK_ENABLE后启用
+// #define CONFIG_UHOS_BLE_ADV_PACK_ENABLE
+
+// 单帧长度上限（字节）
+#ifndef CONFIG_UHOS_BLE_ADV_PACK_FRAME_MAX
+#define CONFIG_UHOS_BLE_ADV_PACK_FRAME_MAX  512
+#endif
+
+// 每帧记录的不同MAC个数上限，超过后的MAC不再以序号编码
+#ifndef CONFIG_UHOS_BLE_ADV_PACK_MAC_NUM
+#define CONFIG_UHOS_BLE_ADV_PACK_MAC_NUM    16
+#endif
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                         全局变量声明                                           */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       广播透传打包初始化
+ */
+void uhos_ble_pal_adv_pack_init(void);
+
+/**
+ * @brief       将一条广播上报加入当前帧（仅ble_daemon任务调用）
+ * @param[in]   report  广播上报
+ */
+void uhos_ble_pal_adv_pack_add(const uhos_ble_gap_adv_report_t *report);
+
+/**
+ * @brief       将一条扩展广播上报加入当前帧（仅ble_daemon任务调用），数据超过255字节的丢弃
+ * @param[in]   report  扩展广播上报
+ */
+void uhos_ble_pal_adv_pack_ext_add(const uhos_ble_gap_ext_adv_report_t *report);
+
+/**
+ * @brief       发送到期的帧（仅ble_daemon任务调用）
+ * @return      距下一次需要发送的毫秒数，没有等待发送的帧时返回UHOS_BLE_ADV_PACK_IDLE
+ */
+uhos_u32 uhos_ble_pal_adv_pack_tick(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_BLE_ADV_PACK_H__
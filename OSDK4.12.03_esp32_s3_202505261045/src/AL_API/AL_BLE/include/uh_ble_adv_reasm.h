@@ -0,0 +1,116 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_adv_reasm.h
+ * @author agent (agent@local)
+ * @brief 扩展广播分段重组提供的内部接口头文件，供GAP层使用
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：扩展广播分段重组提供的内部接口头文件，供GAP层使用
+ * </table>
+ */
+
+#ifndef __UH_BLE_ADV_REASM_H__
+#define __UH_BLE_ADV_REASM_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_ble.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                           常量定义                                             */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+// 单条扩展广播（广播数据或扫描响应数据）的最大载荷，超出部分丢弃并标记为截断；Core Spec上限1650
+#ifndef CONFIG_UHOS_BLE_EXT_ADV_DATA_MAX
+#define CONFIG_UHOS_BLE_EXT_ADV_DATA_MAX    512
+#endif
+
+// 重组槽个数，即可同时重组及等待投递的扩展广播条数
+#ifndef CONFIG_UHOS_BLE_EXT_ADV_REASM_NUM
+#define CONFIG_UHOS_BLE_EXT_ADV_REASM_NUM   4
+#endif
+
+// 广播链相邻分段的最大间隔（毫秒），超时未收到后续分段的广播链被放弃
+#ifndef CONFIG_UHOS_BLE_EXT_ADV_REASM_TIMEOUT_MS
+#define CONFIG_UHOS_BLE_EXT_ADV_REASM_TIMEOUT_MS    500
+#endif
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+/**
+ * @enum        分段状态，与协议栈上报的数据状态对应
+ */
+typedef enum uhos_ble_pal_adv_reasm_status
+{
+    UHOS_BLE_PAL_ADV_REASM_COMPLETE = 0,                        //<! 最后一段，载荷完整
+    UHOS_BLE_PAL_ADV_REASM_MORE,                                //<! 后续还有分段
+    UHOS_BLE_PAL_ADV_REASM_TRUNCATED,                           //<! 最后一段，控制器已截断
+} uhos_ble_pal_adv_reasm_status_t;
+
+
+/**************************************************************************************************/
+/*                                         全局变量声明                                           */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       分段重组初始化
+ */
+void uhos_ble_pal_adv_reasm_init(void);
+
+/**
+ * @brief       加入一个扩展广播分段（仅在协议栈扫描回调上下文中调用）
+ * @note        以(地址, 地址类型, SID, 广播/扫描响应)区分广播链；frag->data指向本段数据
+ * @param[in]   frag    分段，地址已转换为上报给用户的字节序
+ * @param[in]   status  分段状态
+ * @return      UHOS_TRUE-有一条广播重组完成，等待投递；UHOS_FALSE-其他
+ */
+uhos_bool uhos_ble_pal_adv_reasm_add(const uhos_ble_gap_ext_adv_report_t *frag, uhos_ble_pal_adv_reasm_status_t status);
+
+/**
+ * @brief       按完成顺序取出最早一条重组完成的广播（仅ble_daemon任务调用）
+ * @note        report->data指向重组槽，使用完毕后必须调用uhos_ble_pal_adv_reasm_put归还
+ * @param[out]  report  重组后的广播
+ * @return      UHOS_TRUE-取出成功，UHOS_FALSE-没有待投递的广播
+ */
+uhos_bool uhos_ble_pal_adv_reasm_get(uhos_ble_gap_ext_adv_report_t *report);
+
+/**
+ * @brief       归还uhos_ble_pal_adv_reasm_get取出的重组槽
+ * @param[in]   report  uhos_ble_pal_adv_reasm_get取出的广播
+ */
+void uhos_ble_pal_adv_reasm_put(const uhos_ble_gap_ext_adv_report_t *report);
+
+/**
+ * @brief       获取分段重组的统计信息
+ * @param[out]  stats   统计信息（不含legacy字段）
+ */
+void uhos_ble_pal_adv_reasm_stats_get(uhos_ble_gap_ext_scan_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_BLE_ADV_REASM_H__
@@ -0,0 +1,214 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_bench.h
+ * @author agent (agent@local)
+ * @brief BLE性能基准测试的接口：测试用例与结果类型、执行接口，以及供连接管理、GATT server/client
+ *        上报操作完成与内存分配的内部接口；基准测试不属于uh_ble.h的对外接口
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：BLE性能基准测试的内部接口，供连接管理、GATT server/client上报操作完成与内存分配
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>基准测试的类型与执行接口由uh_ble.h移入，输出函数改用uhos_bench_print_t
+ * </table>
+ */
+
+#ifndef __UH_BLE_BENCH_H__
+#define __UH_BLE_BENCH_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_ble.h"
+#include "uh_bench.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                           常量定义                                             */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+// 每个连接已提交、尚未完成的最大操作数
+#ifndef CONFIG_UHOS_BLE_BENCH_WINDOW
+#define CONFIG_UHOS_BLE_BENCH_WINDOW        32
+#endif
+
+// 单个用例记录的延迟样本数，超出部分不参与分位数计算
+#ifndef CONFIG_UHOS_BLE_BENCH_SAMPLE_NUM
+#define CONFIG_UHOS_BLE_BENCH_SAMPLE_NUM    2048
+#endif
+
+// 单个用例的默认超时时间（毫秒）
+#ifndef CONFIG_UHOS_BLE_BENCH_TIMEOUT_MS
+#define CONFIG_UHOS_BLE_BENCH_TIMEOUT_MS    30000
+#endif
+
+// 等待MTU交换与连接参数更新生效的最长时间（毫秒）
+#ifndef CONFIG_UHOS_BLE_BENCH_SETTLE_MS
+#define CONFIG_UHOS_BLE_BENCH_SETTLE_MS     3000
+#endif
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+/**
+ * @enum 基准测试的操作类型
+ */
+typedef enum
+{
+    UHOS_BLE_BENCH_NOTIFY = 0, //<! uhos_ble_gatts_notify_or_indicate发送notify，以CONF事件为完成
+    UHOS_BLE_BENCH_WRITE_CMD,  //<! uhos_ble_gattc_write_without_rsp，以协议栈的写完成事件为完成
+    UHOS_BLE_BENCH_WRITE_REQ,  //<! uhos_ble_gattc_write_with_rsp，以收到对端写响应为完成
+    UHOS_BLE_BENCH_OP_MAX
+} uhos_ble_bench_op_t;
+
+/**
+ * @struct 基准测试用例
+ */
+typedef struct uhos_ble_bench_case
+{
+    uhos_ble_bench_op_t op; //<! 操作类型
+    uhos_u16 mtu;           //<! 期望MTU，0表示不调整
+    uhos_u16 interval;      //<! 期望连接间隔（单位1.25ms），0表示不调整
+    uhos_u16 payload_len;   //<! 每次操作的数据长度，需不大于MTU-3
+    uhos_u8 conn_num;       //<! 并发连接数
+    uhos_u16 handle;        //<! notify为本端特征值句柄，写操作为对端特征值句柄
+    uhos_u32 ops_per_conn;  //<! 每个连接的操作次数
+    uhos_u32 timeout_ms;    //<! 用例超时时间（毫秒），0表示使用默认值
+} uhos_ble_bench_case_t;
+
+/**
+ * @struct 基准测试结果
+ * @note   延迟为从调用接口到完成事件的时间；无法获取的指标为-1
+ */
+typedef struct uhos_ble_bench_result
+{
+    uhos_ble_status_t status;   //<! UHOS_BLE_SUCCESS-完成，UHOS_BLE_ERROR-连接不足、参数不满足、超时或全部操作失败
+    uhos_bool timed_out;        //<! 是否在全部操作完成前超时
+    uhos_u16 mtu;               //<! 实际MTU（各连接中的最小值）
+    uhos_u16 interval;          //<! 实际连接间隔（各连接中的最大值，单位1.25ms），未知时为0
+    uhos_u8 conn_num;           //<! 实际参与的连接数
+    uhos_u32 ops;               //<! 完成的操作数
+    uhos_u32 errors;            //<! 失败的操作数
+    uhos_u32 busy;              //<! 接口返回UHOS_BLE_BUSY的次数
+    uhos_u32 bytes;             //<! 成功发送的数据字节数
+    uhos_u32 elapsed_us;        //<! 从第一次调用到最后一次完成的时间（微秒）
+    uhos_u32 goodput_bps;       //<! 有效吞吐（字节/秒）
+    uhos_u32 lat_p50_us;        //<! 延迟中位数（微秒）
+    uhos_u32 lat_p99_us;        //<! 延迟99分位（微秒）
+    uhos_u32 lat_max_us;        //<! 最大延迟（微秒）
+    uhos_s32 cpu_us_per_kb;     //<! 每KB数据消耗的CPU时间（微秒）
+    uhos_s32 al_allocs_x100;    //<! AL层数据路径每次操作的内存分配次数×100
+    uhos_s32 heap_allocs_x100;  //<! 整个系统每次操作的内存分配次数×100
+} uhos_ble_bench_result_t;
+
+/**
+ * @struct 基准测试的平台环境
+ * @note   各回调均可为空：setup为空时使用当前已建立的连接；
+ *         cpu_us_get/alloc_count_get为空时对应指标输出-1
+ */
+typedef struct uhos_ble_bench_env
+{
+    uhos_u8 (*setup)(const uhos_ble_bench_case_t *bcase, uhos_u16 *conn_handles, uhos_u8 max); //<! 为用例建立连接，返回连接数
+    void (*teardown)(const uhos_u16 *conn_handles, uhos_u8 num); //<! 用例结束后释放连接
+    uhos_u64 (*cpu_us_get)(void);                                //<! 累计CPU时间（微秒）
+    uhos_u32 (*alloc_count_get)(void);                           //<! 累计内存分配次数
+} uhos_ble_bench_env_t;
+
+/**
+ * @struct 基准测试矩阵，按操作类型、MTU、连接间隔、数据长度、连接数的顺序展开
+ */
+typedef struct uhos_ble_bench_matrix
+{
+    uhos_u8 op_mask;            //<! 操作类型掩码，bit n对应uhos_ble_bench_op_t中的n
+    const uhos_u16 *mtus;       //<! MTU列表
+    uhos_u8 mtu_num;
+    const uhos_u16 *intervals;  //<! 连接间隔列表
+    uhos_u8 interval_num;
+    const uhos_u16 *payloads;   //<! 数据长度列表
+    uhos_u8 payload_num;
+    const uhos_u8 *conns;       //<! 连接数列表
+    uhos_u8 conn_num;
+    uhos_u16 notify_handle;     //<! notify用例的本端特征值句柄
+    uhos_u16 write_handle;      //<! 写用例的对端特征值句柄
+    uhos_u32 ops_per_conn;      //<! 每个连接的操作次数
+    uhos_u32 timeout_ms;        //<! 单个用例超时时间（毫秒），0表示使用默认值
+} uhos_ble_bench_matrix_t;
+
+
+/**************************************************************************************************/
+/*                                         全局变量声明                                           */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       设置基准测试的平台环境
+ * @note        主机模拟器使用uhos_ble_sim_bench_env_get()获取的环境
+ * @param[in]   env 平台环境，UHOS_NULL表示使用已建立的连接且不统计CPU与系统内存分配
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_bench_env_set(const uhos_ble_bench_env_t *env);
+
+/**
+ * @brief       执行单个基准测试用例
+ * @note        阻塞执行；执行期间不应有其他业务使用参与测试的连接收发数据
+ * @param[in]   bcase   测试用例
+ * @param[out]  result  测试结果
+ * @return      uhos_ble_status_t 执行结果，同result->status
+ */
+uhos_ble_status_t uhos_ble_bench_run(const uhos_ble_bench_case_t *bcase, uhos_ble_bench_result_t *result);
+
+/**
+ * @brief       将用例与结果格式化为一行JSON
+ * @param[in]   bcase   测试用例
+ * @param[in]   result  测试结果
+ * @param[out]  buf     输出缓冲区
+ * @param[in]   size    输出缓冲区大小
+ * @return      写入的字符数（不含结束符）
+ */
+uhos_s32 uhos_ble_bench_result_json(const uhos_ble_bench_case_t *bcase, const uhos_ble_bench_result_t *result,
+                                    uhos_char *buf, uhos_u32 size);
+
+/**
+ * @brief       按矩阵依次执行基准测试用例，每个用例输出一行JSON
+ * @param[in]   matrix  测试矩阵
+ * @param[in]   print   输出函数
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_bench_matrix_run(const uhos_ble_bench_matrix_t *matrix, uhos_bench_print_t print);
+
+/**
+ * @brief       一次操作已完成（notify的CONF事件、写命令/写请求的写完成事件）
+ * @note        未在执行基准测试或操作类型与当前用例不一致时直接返回
+ * @param[in]   conn_id 连接ID
+ * @param[in]   op      操作类型 @ref uhos_ble_bench_op_t
+ * @param[in]   ok      是否成功
+ */
+void uhos_ble_pal_bench_op_done(uhos_u16 conn_id, uhos_u8 op, uhos_bool ok);
+
+/**
+ * @brief       AL层数据路径上发生了一次内存分配
+ */
+void uhos_ble_pal_bench_alloc(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_BLE_BENCH_H__
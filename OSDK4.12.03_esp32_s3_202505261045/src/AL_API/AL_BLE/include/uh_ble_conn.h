@@ -0,0 +1,143 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_conn.h
+ * @author agent (agent@local)
+ * @brief 连接管理提供的内部接口头文件，供组件内部使用
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：连接管理提供的内部接口头文件，供组件内部使用
+ * </table>
+ */
+
+#ifndef __UH_BLE_CONN_H__
+#define __UH_BLE_CONN_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_ble.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                           常量定义                                             */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+// 最大连接数，与协议栈的CONFIG_BT_ACL_CONNECTIONS保持一致
+#ifndef CONFIG_UHOS_BLE_MAX_CONN
+#define CONFIG_UHOS_BLE_MAX_CONN            4
+#endif
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                         全局变量声明                                           */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       连接管理初始化
+ */
+void uhos_ble_pal_conn_init(void);
+
+/**
+ * @brief       记录新建立的连接
+ * @param[in]   conn_id     连接ID
+ * @param[in]   gatt_if     所属的GATT接口
+ * @param[in]   bda         对端地址（协议栈字节序）
+ * @param[in]   role        本端角色
+ * @return      uhos_ble_status_t 执行结果；连接表已满返回UHOS_BLE_ERROR
+ */
+uhos_ble_status_t uhos_ble_pal_conn_add(uhos_u16 conn_id, uhos_u16 gatt_if, const uhos_u8 *bda, uhos_ble_gap_role_t role);
+
+/**
+ * @brief       删除连接，并丢弃其发送队列中的数据
+ * @param[in]   conn_id     连接ID
+ */
+void uhos_ble_pal_conn_remove(uhos_u16 conn_id);
+
+/**
+ * @brief       获取连接的对端地址
+ * @param[in]   conn_id     连接ID
+ * @param[out]  bda         对端地址（协议栈字节序）
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_pal_conn_addr_get(uhos_u16 conn_id, uhos_ble_addr_t bda);
+
+/**
+ * @brief       更新连接的MTU
+ */
+void uhos_ble_pal_conn_mtu_set(uhos_u16 conn_id, uhos_u16 mtu);
+
+/**
+ * @brief       获取连接的MTU
+ * @return      MTU；连接不存在返回0
+ */
+uhos_u16 uhos_ble_pal_conn_mtu_get(uhos_u16 conn_id);
+
+/**
+ * @brief       连接建立或连接参数更新（ESP_GATTS_CONNECT_EVT/ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT）
+ * @param[in]   bda      对端地址（协议栈字节序）
+ * @param[in]   interval 连接间隔（单位1.25ms）
+ * @param[in]   latency  从设备时延
+ */
+void uhos_ble_pal_conn_params_update(const uhos_u8 *bda, uhos_u16 interval, uhos_u16 latency);
+
+/**
+ * @brief       获取当前所有连接的conn_id
+ * @return      写入conn_ids的连接数
+ */
+uhos_u8 uhos_ble_pal_conn_list(uhos_u16 *conn_ids, uhos_u8 max);
+
+/**
+ * @brief       协议栈拥塞状态变化（ESP_GATTS_CONGEST_EVT）
+ */
+void uhos_ble_pal_conn_congest(uhos_u16 conn_id, uhos_bool congested);
+
+/**
+ * @brief       一包notify/indicate已由协议栈处理完成（ESP_GATTS_CONF_EVT），继续发送队列中的数据
+ */
+void uhos_ble_pal_conn_tx_done(uhos_u16 conn_id);
+
+/**
+ * @brief       统计收到的写入数据
+ */
+void uhos_ble_pal_conn_rx(uhos_u16 conn_id, uhos_u16 len);
+
+/**
+ * @brief       将notify/indicate数据放入连接的发送队列
+ * @param[in]   conn_id         连接ID
+ * @param[in]   handle          特性值句柄
+ * @param[in]   need_confirm    UHOS_TRUE-indicate，UHOS_FALSE-notify
+ * @param[in]   data            数据
+ * @param[in]   len             数据长度
+ * @return      UHOS_BLE_SUCCESS-已入队，UHOS_BLE_BUSY-队列已满，UHOS_BLE_ERROR-连接不存在
+ */
+uhos_ble_status_t uhos_ble_pal_conn_tx(uhos_u16 conn_id, uhos_u16 handle, uhos_bool need_confirm, const uhos_u8 *data, uhos_u16 len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_BLE_CONN_H__
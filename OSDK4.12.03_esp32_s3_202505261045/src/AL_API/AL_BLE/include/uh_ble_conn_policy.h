@@ -0,0 +1,102 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_conn_policy.h
+ * @author agent (agent@local)
+ * @brief 连接参数策略提供的内部接口头文件，供组件内部使用
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：连接参数策略提供的内部接口头文件，供组件内部使用
+ * </table>
+ */
+
+#ifndef __UH_BLE_CONN_POLICY_H__
+#define __UH_BLE_CONN_POLICY_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_ble.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                           常量定义                                             */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+// 统计窗口长度（毫秒），每个窗口结束时评估一次各连接的档位
+#ifndef CONFIG_UHOS_BLE_CONN_POLICY_PERIOD_MS
+#define CONFIG_UHOS_BLE_CONN_POLICY_PERIOD_MS   500
+#endif
+
+// 每个连接保留的统计窗口个数
+#ifndef CONFIG_UHOS_BLE_CONN_POLICY_HISTORY_NUM
+#define CONFIG_UHOS_BLE_CONN_POLICY_HISTORY_NUM 16
+#endif
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                         全局变量声明                                           */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       连接参数策略初始化
+ */
+void uhos_ble_pal_conn_policy_init(void);
+
+/**
+ * @brief       新建立的连接纳入策略管理
+ * @param[in]   conn_id     连接ID
+ * @param[in]   bda         对端地址（协议栈字节序）
+ */
+void uhos_ble_pal_conn_policy_add(uhos_u16 conn_id, const uhos_u8 *bda);
+
+/**
+ * @brief       连接断开，丢弃其策略状态与统计历史
+ */
+void uhos_ble_pal_conn_policy_remove(uhos_u16 conn_id);
+
+/**
+ * @brief       用户指定了连接参数，策略不再调整该连接
+ */
+void uhos_ble_pal_conn_policy_pin(uhos_u16 conn_id);
+
+/**
+ * @brief       连接参数更新完成（ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT）
+ * @param[in]   bda         对端地址（协议栈字节序）
+ * @param[in]   success     UHOS_TRUE-更新成功，UHOS_FALSE-对端拒绝或更新失败
+ */
+void uhos_ble_pal_conn_policy_updated(const uhos_u8 *bda, uhos_bool success);
+
+/**
+ * @brief       周期处理（仅ble_daemon任务调用），每个统计窗口结束时采样并按需调整连接参数
+ */
+void uhos_ble_pal_conn_policy_tick(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_BLE_CONN_POLICY_H__
@@ -0,0 +1,200 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_evt.h
+ * @author agent (agent@local)
+ * @brief BLE用户回调事件队列提供的内部接口头文件，供各层与ble_daemon任务使用
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：BLE用户回调事件队列提供的内部接口头文件，供各层与ble_daemon任务使用
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>新增预分配的连接/断连事件
+ * </table>
+ */
+
+#ifndef __UH_BLE_EVT_H__
+#define __UH_BLE_EVT_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "esp_gatts_api.h"
+
+#include "uh_types.h"
+#include "uh_ble.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                           常量定义                                             */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+// GATT数据类事件的排队上限，超过后丢弃并计入dropped；对端读请求、需要响应的写请求回复ESP_GATT_BUSY
+#ifndef CONFIG_UHOS_BLE_EVT_DATA_NUM
+#define CONFIG_UHOS_BLE_EVT_DATA_NUM        32
+#endif
+
+// 每轮最多投递的GATT数据类事件数，之后让出给广播上报
+#ifndef CONFIG_UHOS_BLE_EVT_DATA_BUDGET
+#define CONFIG_UHOS_BLE_EVT_DATA_BUDGET     8
+#endif
+
+// 单次用户回调的耗时预算（微秒），超过计入overruns
+#ifndef CONFIG_UHOS_BLE_EVT_CB_BUDGET_US
+#define CONFIG_UHOS_BLE_EVT_CB_BUDGET_US    20000
+#endif
+
+
+// 事件不属于任何连接
+#define UHOS_BLE_PAL_EVT_CONN_NONE          0xFFFF
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+struct uhos_ble_pal_evt;
+
+/**
+ * @brief       事件处理函数，在ble_daemon任务中调用
+ */
+typedef void (*uhos_ble_pal_evt_handler_t)(struct uhos_ble_pal_evt *evt);
+
+/**
+ * @struct      排队的用户回调事件
+ * @note        事件参数中的指针在入队时改为指向data中的拷贝
+ */
+typedef struct uhos_ble_pal_evt
+{
+    struct uhos_ble_pal_evt    *next;                           //<! 队列中的下一个事件
+    uhos_ble_pal_evt_handler_t  handler;                        //<! 处理函数
+    uhos_u8                     type;                           //<! 事件分类，见uhos_ble_event_type_t
+    uhos_u8                     flush;                          //<! 投递前先投递同一连接排队中的数据类事件（断连事件）
+    uhos_u8                     pooled;                         //<! 预分配的连接/断连事件，投递后归还而不释放
+    uhos_u16                    conn_id;                        //<! 所属连接，UHOS_BLE_PAL_EVT_CONN_NONE表示不属于任何连接
+    uhos_u32                    time_us;                        //<! 入队时刻
+    union
+    {
+        struct
+        {
+            uhos_ble_gap_evt_t       evt;
+            uhos_ble_gap_evt_param_t param;
+        } gap;                                                  //<! GAP层事件
+        struct
+        {
+            uhos_ble_gattc_evt_t       evt;
+            uhos_ble_gattc_evt_param_t param;
+        } gattc;                                                //<! GATT Client端事件
+        struct
+        {
+            esp_gatt_if_t gatts_if;
+            union
+            {
+                struct gatts_write_evt_param write;
+                struct gatts_read_evt_param  read;
+            };
+        } gatts;                                                //<! GATT Server端读写请求
+    };
+    uhos_u16                    len;                            //<! data长度
+    uhos_u8                     data[];                         //<! 事件携带数据的拷贝
+} uhos_ble_pal_evt_t;
+
+
+/**************************************************************************************************/
+/*                                         全局变量声明                                           */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       事件队列初始化，此后产生的事件交给ble_daemon任务投递
+ */
+void uhos_ble_pal_evt_init(void);
+
+/**
+ * @brief       事件队列反初始化，丢弃未投递的事件
+ */
+void uhos_ble_pal_evt_deinit(void);
+
+/**
+ * @brief       申请一个事件
+ * @param[in]   type        事件分类
+ * @param[in]   conn_id     所属连接，UHOS_BLE_PAL_EVT_CONN_NONE表示不属于任何连接
+ * @param[in]   len         携带数据长度
+ * @param[in]   reliable    UHOS_TRUE-不受数据类排队上限约束，用于数量本身有界且不可丢失的事件（如操作结果）
+ * @return      事件；队列已满、内存不足或未初始化时返回UHOS_NULL，调用者应丢弃事件并调用uhos_ble_pal_evt_drop计数
+ */
+uhos_ble_pal_evt_t *uhos_ble_pal_evt_alloc(uhos_ble_event_type_t type, uhos_u16 conn_id, uhos_u16 len,
+                                           uhos_bool reliable);
+
+/**
+ * @brief       申请一个预分配的连接/断连事件
+ * @note        连接事件与断连事件各预分配CONFIG_UHOS_BLE_MAX_CONN个，在uhos_ble_pal_evt_init中分配，
+ *              投递后归还；不受内存不足影响，只有队列未运行或同类事件全部在排队时才失败
+ * @param[in]   conn_id     所属连接
+ * @param[in]   disconnect  UHOS_TRUE-断连事件，UHOS_FALSE-连接事件
+ * @return      事件，分类为UHOS_BLE_EVENT_TYPE_CONN，不携带数据；失败时返回UHOS_NULL
+ */
+uhos_ble_pal_evt_t *uhos_ble_pal_evt_conn_alloc(uhos_u16 conn_id, uhos_bool disconnect);
+
+/**
+ * @brief       事件入队并唤醒ble_daemon任务
+ * @param[in]   evt     uhos_ble_pal_evt_alloc申请的事件
+ * @param[in]   handler 处理函数
+ */
+void uhos_ble_pal_evt_post(uhos_ble_pal_evt_t *evt, uhos_ble_pal_evt_handler_t handler);
+
+/**
+ * @brief       记录一次无法入队而丢弃的事件
+ * @param[in]   type    事件分类
+ */
+void uhos_ble_pal_evt_drop(uhos_ble_event_type_t type);
+
+/**
+ * @brief       唤醒ble_daemon任务（广播上报缓存使用）
+ */
+void uhos_ble_pal_evt_wake(void);
+
+/**
+ * @brief       等待事件或超时（仅ble_daemon任务调用）
+ * @param[in]   timeout 超时时间（毫秒）
+ */
+void uhos_ble_pal_evt_wait(uhos_u32 timeout);
+
+/**
+ * @brief       按优先级投递事件（仅ble_daemon任务调用）
+ * @return      UHOS_TRUE-仍有事件待投递
+ */
+uhos_bool uhos_ble_pal_evt_dispatch(void);
+
+/**
+ * @brief       记录一次由调用者自行投递的回调（广播上报）
+ * @param[in]   type        事件分类
+ * @param[in]   num         本次投递的事件数
+ * @param[in]   latency_us  最早一个事件的排队时延
+ * @param[in]   cb_us       回调耗时
+ */
+void uhos_ble_pal_evt_record(uhos_ble_event_type_t type, uhos_u16 num, uhos_u32 latency_us, uhos_u32 cb_us);
+
+/**
+ * @brief       微秒时间戳，仅用于计算时间差
+ */
+uhos_u32 uhos_ble_pal_evt_now_us(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_BLE_EVT_H__
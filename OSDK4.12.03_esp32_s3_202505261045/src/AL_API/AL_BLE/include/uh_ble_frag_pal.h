@@ -0,0 +1,72 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_frag_pal.h
+ * @author agent (agent@local)
+ * @brief 分片通道提供的内部接口头文件，供组件内部使用
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：分片通道提供的内部接口头文件，供组件内部使用
+ * </table>
+ */
+
+#ifndef __UH_BLE_FRAG_PAL_H__
+#define __UH_BLE_FRAG_PAL_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_ble.h"
+#include "uh_ble_frag.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                           常量定义                                             */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                         全局变量声明                                           */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       分片通道初始化
+ */
+void uhos_ble_pal_frag_init(void);
+
+/**
+ * @brief       协议栈上报一包notify或写命令发送完成（在协议栈回调上下文中调用）
+ * @param[in]   conn_id 连接ID
+ * @param[in]   link    链路类型
+ */
+void uhos_ble_pal_frag_tx_done(uhos_u16 conn_id, uhos_ble_frag_link_t link);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_BLE_FRAG_PAL_H__
@@ -18,6 +18,8 @@
 /**************************************************************************************************/
 /*                         #include (依次为标准库头文件、非标准库头文件)                          */
 /**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_ble.h"
 
 
 /**************************************************************************************************/
@@ -53,7 +55,48 @@ extern "C" {
 /**************************************************************************************************/
 void uhos_ble_pal_gap_init(void);
 void uhos_ble_pal_gap_deinit(void);
-void uhos_ble_pal_gap_adv_rpt_handle(uhos_u32 timeout);
+
+/**
+ * @brief       投递一个批次的广播上报（仅ble_daemon任务调用，不阻塞）
+ * @return      UHOS_TRUE-缓存中仍有广播待投递
+ */
+uhos_bool uhos_ble_pal_gap_adv_rpt_handle(void);
+
+/**
+ * @brief       上报连接事件（在协议栈回调上下文中调用，事件交给ble_daemon任务投递）
+ * @param[in]   conn_id     连接ID
+ * @param[in]   bda         对端地址（协议栈字节序）
+ * @param[in]   role        本端角色
+ * @param[in]   interval    连接间隔（单位1.25ms）
+ * @param[in]   latency     从设备时延
+ * @param[in]   timeout     监控超时（单位10ms）
+ */
+void uhos_ble_pal_gap_conn_report(uhos_u16 conn_id, const uhos_u8 *bda, uhos_ble_gap_role_t role,
+                                  uhos_u16 interval, uhos_u16 latency, uhos_u16 timeout);
+
+/**
+ * @brief       上报断连事件（在协议栈回调上下文中调用，事件交给ble_daemon任务投递）
+ * @param[in]   conn_id     连接ID
+ * @param[in]   reason      协议栈上报的HCI断连原因
+ */
+void uhos_ble_pal_gap_disconn_report(uhos_u16 conn_id, uhos_u16 reason);
+
+/**
+ * @brief       是否有进行中的扫描（含暂停中的扫描）
+ * @param[out]  wl_policy 扫描是否使用控制器白名单过滤策略，可为UHOS_NULL
+ */
+uhos_bool uhos_ble_pal_gap_scan_active(uhos_bool *wl_policy);
+
+/**
+ * @brief       暂停进行中的扫描，保留扫描参数
+ */
+void uhos_ble_pal_gap_scan_pause(void);
+
+/**
+ * @brief       以指定过滤策略恢复暂停的扫描，扫描时长按剩余时间计算
+ * @param[in]   wl_policy 是否使用控制器白名单过滤策略
+ */
+void uhos_ble_pal_gap_scan_resume(uhos_bool wl_policy);
 
 
 #ifdef __cplusplus
@@ -18,6 +18,7 @@
 /**************************************************************************************************/
 /*                         #include (依次为标准库头文件、非标准库头文件)                          */
 /**************************************************************************************************/
+#include "uh_types.h"
 
 /**************************************************************************************************/
 /*                                        其他条件编译选项                                        */
@@ -45,6 +46,16 @@ extern "C" {
 /**************************************************************************************************/
 /*                                         全局函数原型                                           */
 /**************************************************************************************************/
+/**
+ * @brief       GATT层Client端初始化，注册协议栈回调
+ */
+void uhos_ble_pal_gattc_init(void);
+
+/**
+ * @brief       检查各连接已下发操作是否超时，超时的操作以UHOS_BLE_TIMEOUT结束
+ * @note        由BLE守候线程周期调用
+ */
+void uhos_ble_pal_gattc_op_tick(void);
 
 
 #ifdef __cplusplus
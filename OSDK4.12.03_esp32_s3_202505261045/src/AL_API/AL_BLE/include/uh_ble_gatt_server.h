@@ -36,6 +36,15 @@ extern "C" {
 /**************************************************************************************************/
 /*                                          全局宏定义                                            */
 /**************************************************************************************************/
+// 本端GATT数据库可容纳的服务个数（所有通过uhos_ble_gatts_service_set/add注册的服务之和）
+#ifndef CONFIG_UHOS_BLE_GATTS_SRV_NUM
+#define CONFIG_UHOS_BLE_GATTS_SRV_NUM       10
+#endif
+
+// 句柄查找表的容量，即本端所有服务的属性句柄跨度上限
+#ifndef CONFIG_UHOS_BLE_GATTS_ATTR_NUM
+#define CONFIG_UHOS_BLE_GATTS_ATTR_NUM      128
+#endif
 
 
 /**************************************************************************************************/
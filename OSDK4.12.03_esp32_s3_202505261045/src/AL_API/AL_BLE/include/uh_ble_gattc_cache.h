@@ -0,0 +1,140 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_gattc_cache.h
+ * @author agent (agent@local)
+ * @brief GATT client端对端属性数据库缓存的持久化接口
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：GATT client端对端属性数据库缓存的持久化接口
+ * </table>
+ */
+
+#ifndef __UH_BLE_GATTC_CACHE_H__
+#define __UH_BLE_GATTC_CACHE_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_ble.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                           常量定义                                             */
+/**************************************************************************************************/
+#define UHOS_BLE_GATTC_DB_HASH_LEN              16
+
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+// 每个对端缓存的首要服务数
+#ifndef CONFIG_UHOS_BLE_GATTC_CACHE_SVC_NUM
+#define CONFIG_UHOS_BLE_GATTC_CACHE_SVC_NUM     16
+#endif
+
+// 每个对端缓存的特征数
+#ifndef CONFIG_UHOS_BLE_GATTC_CACHE_CHAR_NUM
+#define CONFIG_UHOS_BLE_GATTC_CACHE_CHAR_NUM    48
+#endif
+
+// 每个对端缓存的描述符数
+#ifndef CONFIG_UHOS_BLE_GATTC_CACHE_DESC_NUM
+#define CONFIG_UHOS_BLE_GATTC_CACHE_DESC_NUM    32
+#endif
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+/**
+ * @struct      缓存的首要服务
+ */
+typedef struct uhos_ble_pal_gattc_db_svc
+{
+    uhos_u16        begin_handle;                               //<! 起始句柄
+    uhos_u16        end_handle;                                 //<! 结束句柄
+    uhos_ble_uuid_t uuid;                                       //<! 服务UUID
+} uhos_ble_pal_gattc_db_svc_t;
+
+/**
+ * @struct      缓存的特征
+ */
+typedef struct uhos_ble_pal_gattc_db_char
+{
+    uhos_u16        value_handle;                               //<! 特征值句柄
+    uhos_u8         properties;                                 //<! 特征属性
+    uhos_ble_uuid_t uuid;                                       //<! 特征UUID
+} uhos_ble_pal_gattc_db_char_t;
+
+/**
+ * @struct      缓存的描述符
+ */
+typedef struct uhos_ble_pal_gattc_db_desc
+{
+    uhos_u16        handle;                                     //<! 描述符句柄
+    uhos_ble_uuid_t uuid;                                       //<! 描述符UUID
+} uhos_ble_pal_gattc_db_desc_t;
+
+/**
+ * @struct      对端的属性数据库
+ */
+typedef struct uhos_ble_pal_gattc_db
+{
+    uhos_ble_addr_t bda;                                        //<! 对端地址（协议栈字节序）
+    uhos_u16        sc_handle;                                  //<! Service Changed特征值句柄，0表示不存在
+    uhos_u16        hash_handle;                                //<! Database Hash特征值句柄，0表示不存在
+    uhos_u8         hash_valid;                                 //<! hash是否有效
+    uhos_u8         hash[UHOS_BLE_GATTC_DB_HASH_LEN];           //<! Database Hash
+    uhos_u8         svc_num;                                    //<! 服务数
+    uhos_u8         char_num;                                   //<! 特征数
+    uhos_u8         desc_num;                                   //<! 描述符数
+    uhos_ble_pal_gattc_db_svc_t  svcs[CONFIG_UHOS_BLE_GATTC_CACHE_SVC_NUM];    //<! 首要服务
+    uhos_ble_pal_gattc_db_char_t chars[CONFIG_UHOS_BLE_GATTC_CACHE_CHAR_NUM];  //<! 特征，按句柄升序
+    uhos_ble_pal_gattc_db_desc_t descs[CONFIG_UHOS_BLE_GATTC_CACHE_DESC_NUM];  //<! 描述符，按句柄升序
+} uhos_ble_pal_gattc_db_t;
+
+
+/**************************************************************************************************/
+/*                                         全局变量声明                                           */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       读取对端的属性数据库缓存
+ * @param[in]   bda     对端地址（协议栈字节序）
+ * @return      属性数据库，由调用者使用uhos_libc_free释放；无缓存或缓存损坏返回UHOS_NULL
+ */
+uhos_ble_pal_gattc_db_t *uhos_ble_pal_gattc_cache_load(const uhos_u8 *bda);
+
+/**
+ * @brief       保存对端的属性数据库缓存
+ * @param[in]   db      属性数据库
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_pal_gattc_cache_save(const uhos_ble_pal_gattc_db_t *db);
+
+/**
+ * @brief       删除对端的属性数据库缓存
+ * @param[in]   bda     对端地址（协议栈字节序），UHOS_NULL表示删除所有对端的缓存
+ */
+void uhos_ble_pal_gattc_cache_remove(const uhos_u8 *bda);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_BLE_GATTC_CACHE_H__
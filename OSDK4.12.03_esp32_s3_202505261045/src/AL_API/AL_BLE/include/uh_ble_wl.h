@@ -0,0 +1,124 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_wl.h
+ * @author agent (agent@local)
+ * @brief 白名单影子提供的内部接口头文件，供GAP层使用
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：白名单影子提供的内部接口头文件，供GAP层使用
+ * </table>
+ */
+
+#ifndef __UH_BLE_WL_H__
+#define __UH_BLE_WL_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_ble.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                           常量定义                                             */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+// 影子白名单的地址个数上限；超过控制器容量的部分由主机侧过滤
+#ifndef CONFIG_UHOS_BLE_WL_SHADOW_NUM
+#define CONFIG_UHOS_BLE_WL_SHADOW_NUM   64
+#endif
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+/**
+ * @enum        GAP层白名单操作类型枚举定义
+ */
+typedef enum uhos_ble_pal_gap_white_list_op
+{
+    UHOS_BLE_GAP_WHITE_LIST_ADD = 1,                            //<! 添加白名单
+    UHOS_BLE_GAP_WHITE_LIST_DEL,                                //<! 删除白名单
+    UHOS_BLE_GAP_WHITE_LIST_CLEAR                               //<! 清楚白名单
+} uhos_ble_pal_gap_white_list_op_t;
+
+
+/**************************************************************************************************/
+/*                                         全局变量声明                                           */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       白名单影子初始化，控制器白名单视为空
+ */
+void uhos_ble_pal_wl_init(void);
+
+/**
+ * @brief       修改影子白名单，不下发控制器，需调用uhos_ble_pal_wl_sync生效
+ * @param[in]   op      操作类型
+ * @param[in]   addr    地址（协议栈字节序），清空时可为UHOS_NULL
+ * @return      uhos_ble_status_t 执行结果，影子已满返回UHOS_BLE_ERROR
+ */
+uhos_ble_status_t uhos_ble_pal_wl_edit(uhos_ble_pal_gap_white_list_op_t op, const uhos_u8 *addr);
+
+/**
+ * @brief       以地址列表整体替换影子白名单，重复地址只保留一个；需调用uhos_ble_pal_wl_sync生效
+ * @param[in]   list    地址列表（协议栈字节序）
+ * @param[in]   num     地址个数
+ * @return      uhos_ble_status_t 执行结果，去重后超过影子容量返回UHOS_BLE_ERROR
+ */
+uhos_ble_status_t uhos_ble_pal_wl_replace(const uhos_ble_addr_t *list, uhos_u16 num);
+
+/**
+ * @brief       将影子白名单与控制器白名单的差异在一个扫描暂停窗口内下发
+ * @note        只有正在进行的扫描使用白名单（或扫描过滤策略需要切换）时才暂停扫描；
+ *              地址数超过控制器容量时不修改控制器，改由主机侧过滤
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_pal_wl_sync(void);
+
+/**
+ * @brief       扫描是否应使用控制器白名单过滤策略（扫描开始时调用）
+ */
+uhos_bool uhos_ble_pal_wl_scan_policy(void);
+
+/**
+ * @brief       主机侧过滤：判断广播是否应丢弃（在协议栈扫描回调上下文中调用）
+ * @param[in]   bda     广播者地址（协议栈字节序）
+ * @return      UHOS_TRUE-丢弃，UHOS_FALSE-保留
+ */
+uhos_bool uhos_ble_pal_wl_host_drop(const uhos_u8 *bda);
+
+/**
+ * @brief       控制器白名单更新完成
+ * @param[in]   success 是否成功，失败时下次同步重写整个控制器白名单
+ */
+void uhos_ble_pal_wl_update_done(uhos_bool success);
+
+/**
+ * @brief       扫描已启动，用于统计白名单更新造成的扫描中断时长
+ */
+void uhos_ble_pal_wl_scan_started(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_BLE_WL_H__
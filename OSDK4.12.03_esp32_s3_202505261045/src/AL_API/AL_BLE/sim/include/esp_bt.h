@@ -0,0 +1,64 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file esp_bt.h
+ * @author agent (agent@local)
+ * @brief 蓝牙控制器接口（主机模拟）
+ * @details 与ESP-IDF同名头文件的子集，类型、枚举值与结构成员保持一致，
+ *          仅用于在主机上以BLE模拟器替代Bluedroid协议栈编译AL_BLE
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：蓝牙控制器接口（主机模拟）
+ * </table>
+ */
+
+#ifndef __ESP_BT_H__
+#define __ESP_BT_H__
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Bluetooth mode for controller enable/disable
+typedef enum {
+    ESP_BT_MODE_IDLE       = 0x00,
+    ESP_BT_MODE_BLE        = 0x01,
+    ESP_BT_MODE_CLASSIC_BT = 0x02,
+    ESP_BT_MODE_BTDM       = 0x03,
+} esp_bt_mode_t;
+
+/// Bluetooth controller enable/disable/initialised/de-initialised status
+typedef enum {
+    ESP_BT_CONTROLLER_STATUS_IDLE = 0,
+    ESP_BT_CONTROLLER_STATUS_INITED,
+    ESP_BT_CONTROLLER_STATUS_ENABLED,
+    ESP_BT_CONTROLLER_STATUS_NUM,
+} esp_bt_controller_status_t;
+
+/// Controller config options, 模拟器仅保留与连接数相关的字段
+typedef struct {
+    uint8_t ble_max_act;
+    uint8_t controller_task_prio;
+} esp_bt_controller_config_t;
+
+#define BT_CONTROLLER_INIT_CONFIG_DEFAULT() {   \
+    .ble_max_act          = 6,                  \
+    .controller_task_prio = 23,                 \
+}
+
+esp_err_t esp_bt_controller_init(esp_bt_controller_config_t *cfg);
+esp_err_t esp_bt_controller_deinit(void);
+esp_err_t esp_bt_controller_enable(esp_bt_mode_t mode);
+esp_err_t esp_bt_controller_disable(void);
+esp_bt_controller_status_t esp_bt_controller_get_status(void);
+esp_err_t esp_bt_controller_mem_release(esp_bt_mode_t mode);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __ESP_BT_H__
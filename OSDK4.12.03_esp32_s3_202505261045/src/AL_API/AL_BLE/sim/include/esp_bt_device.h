@@ -0,0 +1,38 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file esp_bt_device.h
+ * @author agent (agent@local)
+ * @brief 蓝牙本端设备接口（主机模拟）
+ * @details 与ESP-IDF同名头文件的子集，类型、枚举值与结构成员保持一致，
+ *          仅用于在主机上以BLE模拟器替代Bluedroid协议栈编译AL_BLE
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：蓝牙本端设备接口（主机模拟）
+ * </table>
+ */
+
+#ifndef __ESP_BT_DEVICE_H__
+#define __ESP_BT_DEVICE_H__
+
+#include "esp_err.h"
+#include "esp_bt_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief       获取本端蓝牙地址（协议栈字节序）
+ */
+const uint8_t *esp_bt_dev_get_address(void);
+
+esp_err_t esp_bt_dev_set_device_name(const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __ESP_BT_DEVICE_H__
@@ -0,0 +1,54 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file esp_bt_main.h
+ * @author agent (agent@local)
+ * @brief Bluedroid主机协议栈接口（主机模拟）
+ * @details 与ESP-IDF同名头文件的子集，类型、枚举值与结构成员保持一致，
+ *          仅用于在主机上以BLE模拟器替代Bluedroid协议栈编译AL_BLE
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：Bluedroid主机协议栈接口（主机模拟）
+ * </table>
+ */
+
+#ifndef __ESP_BT_MAIN_H__
+#define __ESP_BT_MAIN_H__
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Bluetooth stack status type, to indicate whether the bluetooth stack is ready.
+typedef enum {
+    ESP_BLUEDROID_STATUS_UNINITIALIZED   = 0,
+    ESP_BLUEDROID_STATUS_INITIALIZED,
+    ESP_BLUEDROID_STATUS_ENABLED
+} esp_bluedroid_status_t;
+
+/// Bluetooth stack configuration
+typedef struct {
+    bool ssp_en;
+} esp_bluedroid_config_t;
+
+#define BT_BLUEDROID_INIT_CONFIG_DEFAULT()  \
+    {                                       \
+        .ssp_en = true,                     \
+    }
+
+esp_bluedroid_status_t esp_bluedroid_get_status(void);
+esp_err_t esp_bluedroid_enable(void);
+esp_err_t esp_bluedroid_disable(void);
+esp_err_t esp_bluedroid_init(void);
+esp_err_t esp_bluedroid_init_with_cfg(esp_bluedroid_config_t *cfg);
+esp_err_t esp_bluedroid_deinit(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __ESP_BT_MAIN_H__
@@ -0,0 +1,49 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file esp_err.h
+ * @author agent (agent@local)
+ * @brief ESP错误码定义（主机模拟）
+ * @details 与ESP-IDF同名头文件的子集，类型、枚举值与结构成员保持一致，
+ *          仅用于在主机上以BLE模拟器替代Bluedroid协议栈编译AL_BLE
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：ESP错误码定义（主机模拟）
+ * </table>
+ */
+
+#ifndef __ESP_ERR_H__
+#define __ESP_ERR_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int esp_err_t;
+
+#define ESP_OK                      0
+#define ESP_FAIL                    -1
+
+#define ESP_ERR_NO_MEM              0x101
+#define ESP_ERR_INVALID_ARG         0x102
+#define ESP_ERR_INVALID_STATE       0x103
+#define ESP_ERR_INVALID_SIZE        0x104
+#define ESP_ERR_NOT_FOUND           0x105
+#define ESP_ERR_NOT_SUPPORTED       0x106
+#define ESP_ERR_TIMEOUT             0x107
+
+/**
+ * @brief       错误码转换为字符串
+ */
+const char *esp_err_to_name(esp_err_t code);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __ESP_ERR_H__
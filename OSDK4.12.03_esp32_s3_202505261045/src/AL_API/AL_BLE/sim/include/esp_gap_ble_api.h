@@ -0,0 +1,506 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file esp_gap_ble_api.h
+ * @author agent (agent@local)
+ * @brief BLE GAP接口（主机模拟）
+ * @details 与ESP-IDF同名头文件的子集，类型、枚举值与结构成员保持一致，
+ *          仅用于在主机上以BLE模拟器替代Bluedroid协议栈编译AL_BLE
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：BLE GAP接口（主机模拟）
+ * </table>
+ */
+
+#ifndef __ESP_GAP_BLE_API_H__
+#define __ESP_GAP_BLE_API_H__
+
+#include "esp_err.h"
+#include "esp_bt_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// GAP BLE callback event type
+typedef enum {
+    ESP_GAP_BLE_ADV_DATA_SET_COMPLETE_EVT        = 0,
+    ESP_GAP_BLE_SCAN_RSP_DATA_SET_COMPLETE_EVT,
+    ESP_GAP_BLE_SCAN_PARAM_SET_COMPLETE_EVT,
+    ESP_GAP_BLE_SCAN_RESULT_EVT,
+    ESP_GAP_BLE_ADV_DATA_RAW_SET_COMPLETE_EVT,
+    ESP_GAP_BLE_SCAN_RSP_DATA_RAW_SET_COMPLETE_EVT,
+    ESP_GAP_BLE_ADV_START_COMPLETE_EVT,
+    ESP_GAP_BLE_SCAN_START_COMPLETE_EVT,
+    ESP_GAP_BLE_AUTH_CMPL_EVT                    = 8,
+    ESP_GAP_BLE_KEY_EVT,
+    ESP_GAP_BLE_SEC_REQ_EVT,
+    ESP_GAP_BLE_PASSKEY_NOTIF_EVT,
+    ESP_GAP_BLE_PASSKEY_REQ_EVT,
+    ESP_GAP_BLE_OOB_REQ_EVT,
+    ESP_GAP_BLE_LOCAL_IR_EVT,
+    ESP_GAP_BLE_LOCAL_ER_EVT,
+    ESP_GAP_BLE_NC_REQ_EVT,
+    ESP_GAP_BLE_ADV_STOP_COMPLETE_EVT,
+    ESP_GAP_BLE_SCAN_STOP_COMPLETE_EVT,
+    ESP_GAP_BLE_SET_STATIC_RAND_ADDR_EVT,
+    ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT,
+    ESP_GAP_BLE_SET_PKT_LENGTH_COMPLETE_EVT,
+    ESP_GAP_BLE_SET_LOCAL_PRIVACY_COMPLETE_EVT,
+    ESP_GAP_BLE_REMOVE_BOND_DEV_COMPLETE_EVT,
+    ESP_GAP_BLE_CLEAR_BOND_DEV_COMPLETE_EVT,
+    ESP_GAP_BLE_GET_BOND_DEV_COMPLETE_EVT,
+    ESP_GAP_BLE_READ_RSSI_COMPLETE_EVT,
+    ESP_GAP_BLE_UPDATE_WHITELIST_COMPLETE_EVT,
+    ESP_GAP_BLE_UPDATE_DUPLICATE_EXCEPTIONAL_LIST_COMPLETE_EVT,
+    ESP_GAP_BLE_SET_CHANNELS_EVT,
+    ESP_GAP_BLE_READ_PHY_COMPLETE_EVT,
+    ESP_GAP_BLE_SET_PREFERRED_DEFAULT_PHY_COMPLETE_EVT,
+    ESP_GAP_BLE_SET_PREFERRED_PHY_COMPLETE_EVT,
+    ESP_GAP_BLE_EXT_ADV_SET_RAND_ADDR_COMPLETE_EVT,
+    ESP_GAP_BLE_EXT_ADV_SET_PARAMS_COMPLETE_EVT,
+    ESP_GAP_BLE_EXT_ADV_DATA_SET_COMPLETE_EVT,
+    ESP_GAP_BLE_EXT_SCAN_RSP_DATA_SET_COMPLETE_EVT,
+    ESP_GAP_BLE_EXT_ADV_START_COMPLETE_EVT,
+    ESP_GAP_BLE_EXT_ADV_STOP_COMPLETE_EVT,
+    ESP_GAP_BLE_EXT_ADV_SET_REMOVE_COMPLETE_EVT,
+    ESP_GAP_BLE_EXT_ADV_SET_CLEAR_COMPLETE_EVT,
+    ESP_GAP_BLE_PERIODIC_ADV_SET_PARAMS_COMPLETE_EVT,
+    ESP_GAP_BLE_PERIODIC_ADV_DATA_SET_COMPLETE_EVT,
+    ESP_GAP_BLE_PERIODIC_ADV_START_COMPLETE_EVT,
+    ESP_GAP_BLE_PERIODIC_ADV_STOP_COMPLETE_EVT,
+    ESP_GAP_BLE_PERIODIC_ADV_CREATE_SYNC_COMPLETE_EVT,
+    ESP_GAP_BLE_PERIODIC_ADV_SYNC_CANCEL_COMPLETE_EVT,
+    ESP_GAP_BLE_PERIODIC_ADV_SYNC_TERMINATE_COMPLETE_EVT,
+    ESP_GAP_BLE_PERIODIC_ADV_ADD_DEV_COMPLETE_EVT,
+    ESP_GAP_BLE_PERIODIC_ADV_REMOVE_DEV_COMPLETE_EVT,
+    ESP_GAP_BLE_PERIODIC_ADV_CLEAR_DEV_COMPLETE_EVT,
+    ESP_GAP_BLE_SET_EXT_SCAN_PARAMS_COMPLETE_EVT,
+    ESP_GAP_BLE_EXT_SCAN_START_COMPLETE_EVT,
+    ESP_GAP_BLE_EXT_SCAN_STOP_COMPLETE_EVT,
+    ESP_GAP_BLE_PREFER_EXT_CONN_PARAMS_SET_COMPLETE_EVT,
+    ESP_GAP_BLE_PHY_UPDATE_COMPLETE_EVT,
+    ESP_GAP_BLE_EXT_ADV_REPORT_EVT,
+    ESP_GAP_BLE_SCAN_TIMEOUT_EVT,
+    ESP_GAP_BLE_ADV_TERMINATED_EVT,
+    ESP_GAP_BLE_SCAN_REQ_RECEIVED_EVT,
+    ESP_GAP_BLE_CHANNEL_SELECT_ALGORITHM_EVT,
+    ESP_GAP_BLE_PERIODIC_ADV_REPORT_EVT,
+    ESP_GAP_BLE_PERIODIC_ADV_SYNC_LOST_EVT,
+    ESP_GAP_BLE_PERIODIC_ADV_SYNC_ESTAB_EVT,
+    ESP_GAP_BLE_EVT_MAX,
+} esp_gap_ble_cb_event_t;
+
+/// Advertising data maximum length
+#define ESP_BLE_ADV_DATA_LEN_MAX               31
+/// Scan response data maximum length
+#define ESP_BLE_SCAN_RSP_DATA_LEN_MAX          31
+
+/// Advertising mode
+typedef enum {
+    ADV_TYPE_IND                = 0x00,
+    ADV_TYPE_DIRECT_IND_HIGH    = 0x01,
+    ADV_TYPE_SCAN_IND           = 0x02,
+    ADV_TYPE_NONCONN_IND        = 0x03,
+    ADV_TYPE_DIRECT_IND_LOW     = 0x04,
+} esp_ble_adv_type_t;
+
+/// Advertising channel mask
+typedef enum {
+    ADV_CHNL_37     = 0x01,
+    ADV_CHNL_38     = 0x02,
+    ADV_CHNL_39     = 0x04,
+    ADV_CHNL_ALL    = 0x07,
+} esp_ble_adv_channel_t;
+
+typedef enum {
+    ///Allow both scan and connection requests from anyone
+    ADV_FILTER_ALLOW_SCAN_ANY_CON_ANY  = 0x00,
+    ///Allow both scan req from White List devices only and connection req from anyone
+    ADV_FILTER_ALLOW_SCAN_WLST_CON_ANY,
+    ///Allow both scan req from anyone and connection req from White List devices only
+    ADV_FILTER_ALLOW_SCAN_ANY_CON_WLST,
+    ///Allow scan and connection requests from White List devices only
+    ADV_FILTER_ALLOW_SCAN_WLST_CON_WLST,
+} esp_ble_adv_filter_t;
+
+/// Advertising parameters
+typedef struct {
+    uint16_t                adv_int_min;
+    uint16_t                adv_int_max;
+    esp_ble_adv_type_t      adv_type;
+    esp_ble_addr_type_t     own_addr_type;
+    esp_bd_addr_t           peer_addr;
+    esp_ble_addr_type_t     peer_addr_type;
+    esp_ble_adv_channel_t   channel_map;
+    esp_ble_adv_filter_t    adv_filter_policy;
+} esp_ble_adv_params_t;
+
+/// Advertising data content, according to "Supplement to the Bluetooth Core Specification"
+typedef struct {
+    bool                    set_scan_rsp;
+    bool                    include_name;
+    bool                    include_txpower;
+    int                     min_interval;
+    int                     max_interval;
+    int                     appearance;
+    uint16_t                manufacturer_len;
+    uint8_t                 *p_manufacturer_data;
+    uint16_t                service_data_len;
+    uint8_t                 *p_service_data;
+    uint16_t                service_uuid_len;
+    uint8_t                 *p_service_uuid;
+    uint8_t                 flag;
+} esp_ble_adv_data_t;
+
+/// Ble scan type
+typedef enum {
+    BLE_SCAN_TYPE_PASSIVE   =   0x0,
+    BLE_SCAN_TYPE_ACTIVE    =   0x1,
+} esp_ble_scan_type_t;
+
+/// Ble scan filter type
+typedef enum {
+    BLE_SCAN_FILTER_ALLOW_ALL           = 0x0,
+    BLE_SCAN_FILTER_ALLOW_ONLY_WLST     = 0x1,
+    BLE_SCAN_FILTER_ALLOW_UND_RPA_DIR   = 0x2,
+    BLE_SCAN_FILTER_ALLOW_WLIST_RPA_DIR = 0x3,
+} esp_ble_scan_filter_t;
+
+/// Ble scan duplicate type
+typedef enum {
+    BLE_SCAN_DUPLICATE_DISABLE           = 0x0,
+    BLE_SCAN_DUPLICATE_ENABLE            = 0x1,
+    BLE_SCAN_DUPLICATE_MAX               = 0x2,
+} esp_ble_scan_duplicate_t;
+
+/// Ble scan parameters
+typedef struct {
+    esp_ble_scan_type_t     scan_type;
+    esp_ble_addr_type_t     own_addr_type;
+    esp_ble_scan_filter_t   scan_filter_policy;
+    uint16_t                scan_interval;
+    uint16_t                scan_window;
+    esp_ble_scan_duplicate_t  scan_duplicate;
+} esp_ble_scan_params_t;
+
+/// connection parameters information
+typedef struct {
+    uint16_t             interval;
+    uint16_t             latency;
+    uint16_t             timeout;
+} esp_gap_conn_params_t;
+
+/// Connection update parameters
+typedef struct {
+    esp_bd_addr_t bda;
+    uint16_t min_int;
+    uint16_t max_int;
+    uint16_t latency;
+    uint16_t timeout;
+} esp_ble_conn_update_params_t;
+
+/// BLE pkt date length keys
+typedef struct
+{
+    uint16_t rx_len;
+    uint16_t tx_len;
+} esp_ble_pkt_data_length_params_t;
+
+/// Sub Event of ESP_GAP_BLE_SCAN_RESULT_EVT
+typedef enum {
+    ESP_GAP_SEARCH_INQ_RES_EVT             = 0,
+    ESP_GAP_SEARCH_INQ_CMPL_EVT            = 1,
+    ESP_GAP_SEARCH_DISC_RES_EVT            = 2,
+    ESP_GAP_SEARCH_DISC_BLE_RES_EVT        = 3,
+    ESP_GAP_SEARCH_DISC_CMPL_EVT           = 4,
+    ESP_GAP_SEARCH_DI_DISC_CMPL_EVT        = 5,
+    ESP_GAP_SEARCH_SEARCH_CANCEL_CMPL_EVT  = 6,
+    ESP_GAP_SEARCH_INQ_DISCARD_NUM_EVT     = 7,
+} esp_gap_search_evt_t;
+
+/// Ble scan result event type
+typedef enum {
+    ESP_BLE_EVT_CONN_ADV         = 0x00,
+    ESP_BLE_EVT_CONN_DIR_ADV     = 0x01,
+    ESP_BLE_EVT_DISC_ADV         = 0x02,
+    ESP_BLE_EVT_NON_CONN_ADV     = 0x03,
+    ESP_BLE_EVT_SCAN_RSP         = 0x04,
+} esp_ble_evt_type_t;
+
+typedef enum{
+    ESP_BLE_WHITELIST_REMOVE     = 0X00,
+    ESP_BLE_WHITELIST_ADD        = 0X01,
+    ESP_BLE_WHITELIST_CLEAR      = 0x02,
+} esp_ble_wl_operation_t;
+
+/// 模拟器支持BLE 5.0扩展广播与扩展扫描
+#define CONFIG_BT_BLE_50_FEATURES_SUPPORTED    1
+
+/// Extended advertising data maximum length (controller limit)
+#define ESP_BLE_EXT_ADV_DATA_LEN_MAX           1650
+/// Maximum advertising data carried by one extended advertising report
+#define ESP_BLE_EXT_ADV_REPORT_DATA_LEN_MAX    229
+/// Maximum number of advertising sets started or stopped in one call
+#define EXT_ADV_NUM_SETS_MAX                   10
+
+/// PHY
+typedef uint8_t esp_ble_gap_phy_t;
+#define ESP_BLE_GAP_PHY_1M                     1
+#define ESP_BLE_GAP_PHY_2M                     2
+#define ESP_BLE_GAP_PHY_CODED                  3
+
+/// Primary advertising PHY
+typedef uint8_t esp_ble_gap_pri_phy_t;
+#define ESP_BLE_GAP_PRI_PHY_1M                 ESP_BLE_GAP_PHY_1M
+#define ESP_BLE_GAP_PRI_PHY_CODED              ESP_BLE_GAP_PHY_CODED
+
+/// Extended advertising properties
+typedef uint16_t esp_ble_ext_adv_type_mask_t;
+#define ESP_BLE_GAP_SET_EXT_ADV_PROP_NONCONN_NONSCANNABLE_UNDIRECTED   (0 << 0)
+#define ESP_BLE_GAP_SET_EXT_ADV_PROP_CONNECTABLE                       (1 << 0)
+#define ESP_BLE_GAP_SET_EXT_ADV_PROP_SCANNABLE                         (1 << 1)
+#define ESP_BLE_GAP_SET_EXT_ADV_PROP_DIRECTED                          (1 << 2)
+#define ESP_BLE_GAP_SET_EXT_ADV_PROP_HD_DIRECTED                       (1 << 3)
+#define ESP_BLE_GAP_SET_EXT_ADV_PROP_LEGACY                            (1 << 4)
+#define ESP_BLE_GAP_SET_EXT_ADV_PROP_ANON_ADV                          (1 << 5)
+#define ESP_BLE_GAP_SET_EXT_ADV_PROP_INCLUDE_TX_PWR                    (1 << 6)
+#define ESP_BLE_GAP_SET_EXT_ADV_PROP_MASK                              (0x7F)
+
+/// Extended advertising report event type
+typedef uint16_t esp_ble_gap_adv_type_t;
+#define ESP_BLE_GAP_ADV_REPORT_EXT_ADV_IND     (1 << 0)
+#define ESP_BLE_GAP_ADV_REPORT_EXT_SCAN_IND    (1 << 1)
+#define ESP_BLE_GAP_ADV_REPORT_EXT_DIRECT_ADV  (1 << 2)
+#define ESP_BLE_GAP_ADV_REPORT_EXT_SCAN_RSP    (1 << 3)
+#define ESP_BLE_GAP_ADV_REPORT_LEGACY_ADV      (1 << 4)
+
+/// Extended advertising report data status
+typedef uint8_t esp_ble_gap_ext_adv_data_status_t;
+#define ESP_BLE_GAP_EXT_ADV_DATA_COMPLETE      (0x00)
+#define ESP_BLE_GAP_EXT_ADV_DATA_INCOMPLETE    (0x01)
+#define ESP_BLE_GAP_EXT_ADV_DATA_TRUNCATED     (0x02)
+
+/// Extended scan configuration mask
+typedef uint8_t esp_ble_ext_scan_cfg_mask_t;
+#define ESP_BLE_GAP_EXT_SCAN_CFG_UNCODE_MASK   0x01
+#define ESP_BLE_GAP_EXT_SCAN_CFG_CODE_MASK     0x02
+
+/// Extended advertising parameters
+typedef struct {
+    esp_ble_ext_adv_type_mask_t type;
+    uint32_t interval_min;
+    uint32_t interval_max;
+    esp_ble_adv_channel_t channel_map;
+    esp_ble_addr_type_t own_addr_type;
+    esp_ble_addr_type_t peer_addr_type;
+    esp_bd_addr_t peer_addr;
+    esp_ble_adv_filter_t filter_policy;
+    int8_t tx_power;
+    esp_ble_gap_pri_phy_t primary_phy;
+    uint8_t max_skip;
+    esp_ble_gap_phy_t secondary_phy;
+    uint8_t sid;
+    bool scan_req_notif;
+} esp_ble_gap_ext_adv_params_t;
+
+/// Extended advertising instance to start
+typedef struct {
+    uint8_t instance;
+    int duration;
+    int max_events;
+} esp_ble_gap_ext_adv_t;
+
+/// Extended scan configuration per PHY
+typedef struct {
+    esp_ble_scan_type_t scan_type;
+    uint16_t scan_interval;
+    uint16_t scan_window;
+} esp_ble_ext_scan_cfg_t;
+
+/// Extended scan parameters
+typedef struct {
+    esp_ble_addr_type_t own_addr_type;
+    esp_ble_scan_filter_t filter_policy;
+    esp_ble_scan_duplicate_t  scan_duplicate;
+    esp_ble_ext_scan_cfg_mask_t cfg_mask;
+    esp_ble_ext_scan_cfg_t uncoded_cfg;
+    esp_ble_ext_scan_cfg_t coded_cfg;
+} esp_ble_ext_scan_params_t;
+
+/// Extended advertising report
+typedef struct {
+    esp_ble_gap_adv_type_t event_type;
+    uint8_t addr_type;
+    esp_bd_addr_t addr;
+    esp_ble_gap_pri_phy_t primary_phy;
+    esp_ble_gap_phy_t secondly_phy;
+    uint8_t sid;
+    uint8_t tx_power;
+    int8_t rssi;
+    uint16_t per_adv_interval;
+    uint8_t dir_addr_type;
+    esp_bd_addr_t dir_addr;
+    esp_ble_gap_ext_adv_data_status_t data_status;
+    uint8_t adv_data_len;
+    uint8_t *adv_data;
+} esp_ble_gap_ext_adv_reprot_t;
+
+/// Gap callback parameters union
+typedef union {
+    struct ble_adv_data_cmpl_evt_param {
+        esp_bt_status_t status;
+    } adv_data_cmpl;
+    struct ble_scan_rsp_data_cmpl_evt_param {
+        esp_bt_status_t status;
+    } scan_rsp_data_cmpl;
+    struct ble_scan_param_cmpl_evt_param {
+        esp_bt_status_t status;
+    } scan_param_cmpl;
+    struct ble_scan_result_evt_param {
+        esp_gap_search_evt_t search_evt;
+        esp_bd_addr_t bda;
+        esp_bt_dev_type_t dev_type;
+        esp_ble_addr_type_t ble_addr_type;
+        esp_ble_evt_type_t ble_evt_type;
+        int rssi;
+        uint8_t  ble_adv[ESP_BLE_ADV_DATA_LEN_MAX + ESP_BLE_SCAN_RSP_DATA_LEN_MAX];
+        int flag;
+        int num_resps;
+        uint8_t adv_data_len;
+        uint8_t scan_rsp_len;
+        uint32_t num_dis;
+    } scan_rst;
+    struct ble_adv_data_raw_cmpl_evt_param {
+        esp_bt_status_t status;
+    } adv_data_raw_cmpl;
+    struct ble_scan_rsp_data_raw_cmpl_evt_param {
+        esp_bt_status_t status;
+    } scan_rsp_data_raw_cmpl;
+    struct ble_adv_start_cmpl_evt_param {
+        esp_bt_status_t status;
+    } adv_start_cmpl;
+    struct ble_scan_start_cmpl_evt_param {
+        esp_bt_status_t status;
+    } scan_start_cmpl;
+    struct ble_scan_stop_cmpl_evt_param {
+        esp_bt_status_t status;
+    } scan_stop_cmpl;
+    struct ble_adv_stop_cmpl_evt_param {
+        esp_bt_status_t status;
+    } adv_stop_cmpl;
+    struct ble_update_conn_params_evt_param {
+        esp_bt_status_t status;
+        esp_bd_addr_t bda;
+        uint16_t min_int;
+        uint16_t max_int;
+        uint16_t latency;
+        uint16_t conn_int;
+        uint16_t timeout;
+    } update_conn_params;
+    struct ble_pkt_data_length_cmpl_evt_param {
+        esp_bt_status_t status;
+        esp_ble_pkt_data_length_params_t params;
+    } pkt_data_length_cmpl;
+    struct ble_read_rssi_cmpl_evt_param {
+        esp_bt_status_t status;
+        int8_t rssi;
+        esp_bd_addr_t remote_addr;
+    } read_rssi_cmpl;
+    struct ble_update_whitelist_cmpl_evt_param {
+        esp_bt_status_t status;
+        esp_ble_wl_operation_t wl_operation;
+    } update_whitelist_cmpl;
+    struct ble_ext_adv_set_params_cmpl_evt_param {
+        esp_bt_status_t status;
+        uint8_t instance;
+    } ext_adv_set_params;
+    struct ble_ext_adv_data_set_cmpl_evt_param {
+        esp_bt_status_t status;
+        uint8_t instance;
+    } ext_adv_data_set;
+    struct ble_ext_adv_scan_rsp_set_cmpl_evt_param {
+        esp_bt_status_t status;
+        uint8_t instance;
+    } scan_rsp_set;
+    struct ble_ext_adv_start_cmpl_evt_param {
+        esp_bt_status_t status;
+        uint8_t instance_num;
+        uint8_t instance[EXT_ADV_NUM_SETS_MAX];
+    } ext_adv_start;
+    struct ble_ext_adv_stop_cmpl_evt_param {
+        esp_bt_status_t status;
+        uint8_t instance_num;
+        uint8_t instance[EXT_ADV_NUM_SETS_MAX];
+    } ext_adv_stop;
+    struct ble_ext_adv_set_remove_cmpl_evt_param {
+        esp_bt_status_t status;
+        uint8_t instance;
+    } ext_adv_remove;
+    struct ble_ext_adv_set_clear_cmpl_evt_param {
+        esp_bt_status_t status;
+    } ext_adv_clear;
+    struct ble_set_ext_scan_params_cmpl_param {
+        esp_bt_status_t status;
+    } set_ext_scan_params;
+    struct ble_ext_scan_start_cmpl_evt_param {
+        esp_bt_status_t status;
+    } ext_scan_start;
+    struct ble_ext_scan_stop_cmpl_evt_param {
+        esp_bt_status_t status;
+    } ext_scan_stop;
+    struct ble_ext_adv_report_param {
+        esp_ble_gap_ext_adv_reprot_t params;
+    } ext_adv_report;
+    struct ble_adv_terminate_param {
+        uint8_t status;
+        uint8_t adv_instance;
+        uint16_t conn_idx;
+        uint8_t completed_event;
+    } adv_terminate;
+} esp_ble_gap_cb_param_t;
+
+/// GAP callback function type
+typedef void (* esp_gap_ble_cb_t)(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param);
+
+/// bonded device, bond keys are not simulated
+typedef struct {
+    esp_bd_addr_t bd_addr;
+} esp_ble_bond_dev_t;
+
+esp_err_t esp_ble_gap_register_callback(esp_gap_ble_cb_t callback);
+esp_err_t esp_ble_gap_config_adv_data(esp_ble_adv_data_t *adv_data);
+esp_err_t esp_ble_gap_config_adv_data_raw(uint8_t *raw_data, uint32_t raw_data_len);
+esp_err_t esp_ble_gap_config_scan_rsp_data_raw(uint8_t *raw_data, uint32_t raw_data_len);
+esp_err_t esp_ble_gap_set_scan_params(esp_ble_scan_params_t *scan_params);
+esp_err_t esp_ble_gap_start_scanning(uint32_t duration);
+esp_err_t esp_ble_gap_stop_scanning(void);
+esp_err_t esp_ble_gap_start_advertising(esp_ble_adv_params_t *adv_params);
+esp_err_t esp_ble_gap_stop_advertising(void);
+esp_err_t esp_ble_gap_update_conn_params(esp_ble_conn_update_params_t *params);
+esp_err_t esp_ble_gap_set_pkt_data_len(esp_bd_addr_t remote_device, uint16_t tx_data_length);
+esp_err_t esp_ble_gap_update_whitelist(bool add_remove, esp_bd_addr_t remote_bda, esp_ble_wl_addr_type_t wl_addr_type);
+esp_err_t esp_ble_gap_clear_whitelist(void);
+esp_err_t esp_ble_gap_get_whitelist_size(uint16_t *length);
+esp_err_t esp_ble_gap_read_rssi(esp_bd_addr_t remote_addr);
+esp_err_t esp_ble_gap_disconnect(esp_bd_addr_t remote_device);
+esp_err_t esp_ble_gap_ext_adv_set_params(uint8_t instance, const esp_ble_gap_ext_adv_params_t *params);
+esp_err_t esp_ble_gap_config_ext_adv_data_raw(uint8_t instance, uint16_t length, const uint8_t *data);
+esp_err_t esp_ble_gap_config_ext_scan_rsp_data_raw(uint8_t instance, uint16_t length, const uint8_t *scan_rsp_data);
+esp_err_t esp_ble_gap_ext_adv_start(uint8_t num_adv, const esp_ble_gap_ext_adv_t *ext_adv);
+esp_err_t esp_ble_gap_ext_adv_stop(uint8_t num_adv, const uint8_t *ext_adv_inst);
+esp_err_t esp_ble_gap_ext_adv_set_remove(uint8_t instance);
+esp_err_t esp_ble_gap_ext_adv_set_clear(void);
+esp_err_t esp_ble_gap_set_ext_scan_params(const esp_ble_ext_scan_params_t *params);
+esp_err_t esp_ble_gap_start_ext_scan(uint32_t duration, uint16_t period);
+esp_err_t esp_ble_gap_stop_ext_scan(void);
+int esp_ble_get_bond_device_num(void);
+esp_err_t esp_ble_get_bond_device_list(int *dev_num, esp_ble_bond_dev_t *dev_list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __ESP_GAP_BLE_API_H__
@@ -0,0 +1,37 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file esp_gatt_common_api.h
+ * @author agent (agent@local)
+ * @brief GATT公共接口（主机模拟）
+ * @details 与ESP-IDF同名头文件的子集，类型、枚举值与结构成员保持一致，
+ *          仅用于在主机上以BLE模拟器替代Bluedroid协议栈编译AL_BLE
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：GATT公共接口（主机模拟）
+ * </table>
+ */
+
+#ifndef __ESP_GATT_COMMON_API_H__
+#define __ESP_GATT_COMMON_API_H__
+
+#include "esp_err.h"
+#include "esp_bt_defs.h"
+#include "esp_gatt_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief       设置本端MTU，取值范围[23, 517]
+ */
+esp_err_t esp_ble_gatt_set_local_mtu(uint16_t mtu);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __ESP_GATT_COMMON_API_H__
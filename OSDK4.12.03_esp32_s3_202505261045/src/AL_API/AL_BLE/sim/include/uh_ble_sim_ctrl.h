@@ -0,0 +1,321 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_sim_ctrl.h
+ * @author agent (agent@local)
+ * @brief BLE模拟器内部接口
+ * @details 虚拟控制器由一个模拟器线程驱动：处理虚拟广播者与扫描窗口、按连接间隔推进各条链路的
+ *          连接事件，并将产生的协议栈事件依次回调给AL_BLE。所有状态由一把互斥体保护，
+ *          事件回调在互斥体之外执行，回调中可以再次调用esp_*接口。
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：BLE模拟器内部接口
+ * </table>
+ */
+
+#ifndef __UH_BLE_SIM_CTRL_H__
+#define __UH_BLE_SIM_CTRL_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_osal.h"
+#include "uh_ble.h"
+#include "uh_ble_sim.h"
+#include "esp_err.h"
+#include "esp_gap_ble_api.h"
+#include "esp_gatts_api.h"
+#include "esp_gattc_api.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**************************************************************************************************/
+/*                                           常量定义                                             */
+/**************************************************************************************************/
+#ifndef CONFIG_UHOS_BLE_SIM_EVT_NUM
+#define CONFIG_UHOS_BLE_SIM_EVT_NUM         256         //<! 待投递事件队列深度
+#endif
+
+#ifndef CONFIG_UHOS_BLE_SIM_ADV_NUM
+#define CONFIG_UHOS_BLE_SIM_ADV_NUM         64          //<! 虚拟广播者个数上限
+#endif
+
+#ifndef CONFIG_UHOS_BLE_SIM_PEER_NUM
+#define CONFIG_UHOS_BLE_SIM_PEER_NUM        8           //<! 虚拟对端个数上限
+#endif
+
+#ifndef CONFIG_UHOS_BLE_SIM_PEER_ATTR_NUM
+#define CONFIG_UHOS_BLE_SIM_PEER_ATTR_NUM   32          //<! 每个虚拟对端的属性个数上限
+#endif
+
+#ifndef CONFIG_UHOS_BLE_SIM_ATTR_LEN
+#define CONFIG_UHOS_BLE_SIM_ATTR_LEN        64          //<! 属性值的最大长度
+#endif
+
+#ifndef CONFIG_UHOS_BLE_SIM_LOCAL_ATTR_NUM
+#define CONFIG_UHOS_BLE_SIM_LOCAL_ATTR_NUM  64          //<! 本端GATT数据库的属性个数上限
+#endif
+
+#ifndef CONFIG_UHOS_BLE_SIM_WL_NUM
+#define CONFIG_UHOS_BLE_SIM_WL_NUM          12          //<! 控制器白名单容量
+#endif
+
+#ifndef CONFIG_UHOS_BLE_SIM_EXT_ADV_SET_NUM
+#define CONFIG_UHOS_BLE_SIM_EXT_ADV_SET_NUM 4           //<! 本端扩展广播集个数上限
+#endif
+
+#ifndef CONFIG_UHOS_BLE_SIM_LINK_NUM
+#define CONFIG_UHOS_BLE_SIM_LINK_NUM        4           //<! 同时存在的链路个数上限
+#endif
+
+#ifndef CONFIG_UHOS_BLE_SIM_TXQ_NUM
+#define CONFIG_UHOS_BLE_SIM_TXQ_NUM         16          //<! 每条链路每个方向的队列深度上限
+#endif
+
+#define UHOS_BLE_SIM_APP_NUM                4           //<! 每种角色可注册的应用个数
+#define UHOS_BLE_SIM_GATT_IF_BASE           3           //<! 分配的第一个gatt_if
+#define UHOS_BLE_SIM_PDU_LEN                ESP_GATT_MAX_MTU_SIZE
+#define UHOS_BLE_SIM_LL_HDR_LEN             7           //<! L2CAP头4字节 + ATT头3字节
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+#define UHOS_BLE_SIM_LOCK()                 uhos_mutex_wait(g_uhos_ble_sim.mutex, UHOS_MUTEX_WAIT_FOREVER)
+#define UHOS_BLE_SIM_UNLOCK()               uhos_mutex_release(g_uhos_ble_sim.mutex)
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+/**
+ * @enum        事件所属的回调
+ */
+typedef enum
+{
+    UHOS_BLE_SIM_EVT_GAP,
+    UHOS_BLE_SIM_EVT_GATTS,
+    UHOS_BLE_SIM_EVT_GATTC
+} uhos_ble_sim_evt_kind_t;
+
+/**
+ * @struct      待投递的协议栈事件
+ * @note        携带数据的事件（写、通知、读响应等）将数据存放在data中，投递时再设置value指针
+ */
+typedef struct uhos_ble_sim_evt
+{
+    uhos_u8       kind;                                         //<! uhos_ble_sim_evt_kind_t
+    esp_gatt_if_t gatt_if;                                      //<! ESP_GATT_IF_NONE表示投递给该角色的所有应用
+    uhos_u16      event;                                        //<! 事件ID
+    union
+    {
+        esp_ble_gap_cb_param_t   gap;
+        esp_ble_gatts_cb_param_t gatts;
+        esp_ble_gattc_cb_param_t gattc;
+    } param;
+    uhos_u8 data[UHOS_BLE_SIM_PDU_LEN];                         //<! 事件携带的数据
+} uhos_ble_sim_evt_t;
+
+/**
+ * @enum        链路上传输的ATT PDU类型
+ */
+typedef enum
+{
+    UHOS_BLE_SIM_PDU_NOTIFY,                                    //<! 本端server -> 对端
+    UHOS_BLE_SIM_PDU_INDICATE,
+    UHOS_BLE_SIM_PDU_WRITE_CMD,                                 //<! 本端client -> 对端
+    UHOS_BLE_SIM_PDU_WRITE_REQ,
+    UHOS_BLE_SIM_PDU_READ,
+    UHOS_BLE_SIM_PDU_READ_BY_TYPE,
+    UHOS_BLE_SIM_PDU_MTU_REQ,
+    UHOS_BLE_SIM_PDU_SEARCH,
+    UHOS_BLE_SIM_PDU_PEER_WRITE_CMD,                            //<! 对端 -> 本端server
+    UHOS_BLE_SIM_PDU_PEER_WRITE_REQ,
+    UHOS_BLE_SIM_PDU_PEER_MTU_REQ,
+    UHOS_BLE_SIM_PDU_PEER_READ,
+    UHOS_BLE_SIM_PDU_PEER_NOTIFY,                               //<! 对端 -> 本端client
+    UHOS_BLE_SIM_PDU_PEER_INDICATE
+} uhos_ble_sim_pdu_op_t;
+
+/**
+ * @struct      链路队列中的ATT PDU
+ */
+typedef struct uhos_ble_sim_pdu
+{
+    uhos_u8       op;                                           //<! uhos_ble_sim_pdu_op_t
+    esp_gatt_if_t gatt_if;                                      //<! 发起请求的应用
+    uhos_u16      handle;                                       //<! 属性句柄或起始句柄
+    uhos_u16      end_handle;                                   //<! 结束句柄（按类型读）
+    uhos_u16      len;                                          //<! 数据长度
+    esp_bt_uuid_t uuid;                                         //<! 按类型读或搜索服务的UUID过滤
+    uhos_bool     has_uuid;                                     //<! uuid是否有效
+    uhos_u8       data[UHOS_BLE_SIM_PDU_LEN];
+} uhos_ble_sim_pdu_t;
+
+/**
+ * @struct      单方向的PDU队列
+ */
+typedef struct uhos_ble_sim_pduq
+{
+    uhos_ble_sim_pdu_t pdu[CONFIG_UHOS_BLE_SIM_TXQ_NUM];
+    uhos_u8            head;
+    uhos_u8            count;
+} uhos_ble_sim_pduq_t;
+
+/**
+ * @struct      虚拟对端的属性
+ */
+typedef struct uhos_ble_sim_peer_attr
+{
+    uhos_u8       type;                                         //<! uhos_ble_sim_attr_type_t
+    uhos_u8       props;
+    uhos_u16      handle;
+    esp_bt_uuid_t uuid;
+    uhos_u16      len;
+    uhos_u8       value[CONFIG_UHOS_BLE_SIM_ATTR_LEN];
+} uhos_ble_sim_peer_attr_t;
+
+/**
+ * @struct      虚拟对端
+ */
+typedef struct uhos_ble_sim_peer_ctx
+{
+    uhos_bool                used;
+    esp_bd_addr_t            bda;                               //<! 协议栈字节序的地址
+    uhos_u8                  addr_type;
+    uhos_bool                bonded;
+    uhos_u16                 mtu;
+    uhos_u16                 attr_num;
+    uhos_ble_sim_peer_attr_t attrs[CONFIG_UHOS_BLE_SIM_PEER_ATTR_NUM];
+} uhos_ble_sim_peer_ctx_t;
+
+/**
+ * @enum        链路状态
+ */
+typedef enum
+{
+    UHOS_BLE_SIM_LINK_IDLE,
+    UHOS_BLE_SIM_LINK_CONNECTING,                               //<! 等待第一个连接事件
+    UHOS_BLE_SIM_LINK_CONNECTED
+} uhos_ble_sim_link_state_t;
+
+/**
+ * @struct      链路
+ */
+typedef struct uhos_ble_sim_link
+{
+    uhos_u8             state;                                  //<! uhos_ble_sim_link_state_t
+    uhos_u8             peer;                                   //<! 虚拟对端索引
+    uhos_u8             role;                                   //<! uhos_ble_gap_role_t，本端角色
+    esp_gatt_if_t       open_if;                                //<! 由esp_ble_gattc_open发起时的gatt_if
+    uhos_u16            interval;                               //<! 单位1.25ms
+    uhos_u16            latency;
+    uhos_u16            timeout;
+    uhos_u16            mtu;
+    uhos_u16            ll_payload;
+    uhos_u64            next_evt_us;                            //<! 下一个连接事件的时刻
+    uhos_u8             upd_countdown;                          //<! 连接参数更新生效前剩余的连接事件数
+    esp_ble_conn_update_params_t upd;                           //<! 待生效的连接参数
+    uhos_s32            tx_budget;                              //<! 本端发送方向剩余的LL数据包数
+    uhos_s32            rx_budget;                              //<! 对端发送方向剩余的LL数据包数
+    uhos_bool           congested;
+    uhos_bool           searched;                               //<! 已完成服务发现
+    uhos_bool           ind_pending;                            //<! 等待对端确认的指示
+    uhos_u16            req_rounds;                             //<! 未完成的client请求剩余的往返次数
+    uhos_ble_sim_pdu_t  req;                                    //<! 未完成的client请求
+    uhos_ble_sim_pdu_t  ind;                                    //<! 等待确认的指示
+    uhos_ble_sim_pduq_t txq;                                    //<! 本端 -> 对端
+    uhos_ble_sim_pduq_t rxq;                                    //<! 对端 -> 本端
+    uhos_ble_sim_link_info_t info;                              //<! 统计信息
+} uhos_ble_sim_link_t;
+
+/**
+ * @struct      模拟器控制块
+ */
+typedef struct uhos_ble_sim_ctl
+{
+    uhos_mutex_t        mutex;
+    uhos_sem_t          wake;                                   //<! 唤醒模拟器线程
+    uhos_sem_t          exit;                                   //<! 模拟器线程已退出
+    uhos_thread_t       thread;
+    uhos_bool           running;
+    uhos_u8             ctrl_status;                            //<! esp_bt_controller_status_t
+    uhos_u8             bluedroid_status;                       //<! esp_bluedroid_status_t
+    uhos_ble_sim_cfg_t  cfg;
+    esp_bd_addr_t       local_bda;                              //<! 本端地址，协议栈字节序
+    uhos_u16            local_mtu;
+
+    esp_gap_ble_cb_t    gap_cb;
+    esp_gatts_cb_t      gatts_cb;
+    esp_gattc_cb_t      gattc_cb;
+    uhos_u16            gatts_app[UHOS_BLE_SIM_APP_NUM];        //<! 0xFFFF表示空闲，否则为app_id
+    uhos_u16            gattc_app[UHOS_BLE_SIM_APP_NUM];
+
+    uhos_ble_sim_evt_t  evt[CONFIG_UHOS_BLE_SIM_EVT_NUM];
+    uhos_u16            evt_head;
+    uhos_u16            evt_count;
+
+    uhos_ble_sim_peer_ctx_t   peer[CONFIG_UHOS_BLE_SIM_PEER_NUM];
+    uhos_ble_sim_link_t       link[CONFIG_UHOS_BLE_SIM_LINK_NUM];
+    uhos_ble_sim_peer_rx_cb_t peer_rx_cb;
+
+    uhos_ble_sim_stats_t stats;
+    uhos_u32             rand;                                  //<! advDelay随机数状态
+} uhos_ble_sim_ctl_t;
+
+/**************************************************************************************************/
+/*                                         全局变量声明                                           */
+/**************************************************************************************************/
+extern uhos_ble_sim_ctl_t g_uhos_ble_sim;
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/* uh_ble_sim_ctrl.c */
+void uhos_ble_sim_ctl_init(void);
+uhos_u64 uhos_ble_sim_now_us(void);
+uhos_u32 uhos_ble_sim_rand(void);
+void uhos_ble_sim_wakeup(void);
+uhos_ble_sim_evt_t *uhos_ble_sim_evt_alloc(uhos_u8 kind, esp_gatt_if_t gatt_if, uhos_u16 event);
+void uhos_ble_sim_addr_to_bda(const uhos_ble_addr_t addr, esp_bd_addr_t bda);
+uhos_s32 uhos_ble_sim_peer_find(const esp_bd_addr_t bda);
+uhos_ble_sim_peer_attr_t *uhos_ble_sim_peer_attr_find(uhos_ble_sim_peer_ctx_t *peer, uhos_u16 handle);
+uhos_ble_sim_link_t *uhos_ble_sim_link_get_by_id(uhos_u16 conn_id);
+uhos_ble_sim_link_t *uhos_ble_sim_link_get_by_bda(const esp_bd_addr_t bda);
+uhos_ble_sim_link_t *uhos_ble_sim_link_open(uhos_u8 peer, uhos_u8 role, esp_gatt_if_t open_if);
+void uhos_ble_sim_link_close(uhos_ble_sim_link_t *link, esp_gatt_conn_reason_t reason);
+uhos_u16 uhos_ble_sim_link_id(const uhos_ble_sim_link_t *link);
+uhos_ble_sim_pdu_t *uhos_ble_sim_link_tx_alloc(uhos_ble_sim_link_t *link, uhos_u8 op);
+esp_err_t uhos_ble_sim_app_register(uhos_u8 kind, uhos_u16 app_id);
+esp_err_t uhos_ble_sim_app_unregister(uhos_u8 kind, esp_gatt_if_t gatt_if);
+
+/* uh_ble_sim_gap.c */
+void uhos_ble_sim_gap_reset(void);
+uhos_u64 uhos_ble_sim_gap_process(uhos_u64 now);
+uhos_bool uhos_ble_sim_gap_adv_connectable(void);
+void uhos_ble_sim_gap_adv_stop(void);
+void uhos_ble_sim_gap_link_process(uhos_ble_sim_link_t *link);
+
+/* uh_ble_sim_gatts.c */
+void uhos_ble_sim_gatts_reset(void);
+void uhos_ble_sim_gatts_tx(uhos_ble_sim_link_t *link, const uhos_ble_sim_pdu_t *pdu);
+void uhos_ble_sim_gatts_rx(uhos_ble_sim_link_t *link, const uhos_ble_sim_pdu_t *pdu);
+void uhos_ble_sim_gatts_ind_confirm(uhos_ble_sim_link_t *link);
+
+/* uh_ble_sim_gattc.c */
+void uhos_ble_sim_gattc_reset(void);
+uhos_u16 uhos_ble_sim_gattc_tx(uhos_ble_sim_link_t *link, const uhos_ble_sim_pdu_t *pdu);
+void uhos_ble_sim_gattc_req_done(uhos_ble_sim_link_t *link);
+void uhos_ble_sim_gattc_rx(uhos_ble_sim_link_t *link, const uhos_ble_sim_pdu_t *pdu);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_BLE_SIM_CTRL_H__
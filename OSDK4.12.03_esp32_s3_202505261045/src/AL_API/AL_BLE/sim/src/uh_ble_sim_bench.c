@@ -0,0 +1,257 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_sim_bench.c
+ * @author agent (agent@local)
+ * @brief BLE模拟器：性能基准测试环境
+ * @details 每个用例按连接数新建虚拟对端，对端在用例句柄上提供可写、可通知的特征：
+ *          notify用例由对端连接本端的可连接广播（本端为从设备），写用例由本端发起连接（本端为主设备）。
+ *          用例结束后删除虚拟对端，链路随之断开。
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：BLE模拟器：性能基准测试环境
+ * </table>
+ */
+
+#define LOG_TAG "ble_sim_bench"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include <time.h>
+
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_osal.h"
+#include "uh_ble.h"
+#include "uh_ble_bench.h"
+#include "uh_ble_sim.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define UHOS_BLE_SIM_BENCH_PEER_NUM         4           //<! 虚拟对端个数上限
+#define UHOS_BLE_SIM_BENCH_PEER_MTU         517         //<! 虚拟对端支持的MTU
+#define UHOS_BLE_SIM_BENCH_WAIT_MS          1000        //<! 等待连接建立/断开的最长时间
+#define UHOS_BLE_SIM_BENCH_CHAR_PROPS       0x1C        //<! 写命令|写请求|通知
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      基准测试环境状态
+ */
+typedef struct uhos_ble_sim_bench
+{
+    uhos_u8         peer_num;                                   //<! 当前用例的虚拟对端个数
+    uhos_ble_addr_t peers[UHOS_BLE_SIM_BENCH_PEER_NUM];         //<! 虚拟对端地址
+} uhos_ble_sim_bench_t;
+
+/**************************************************************************************************/
+/*                                          内部函数原型                                          */
+/**************************************************************************************************/
+static uhos_u8 uhos_ble_sim_bench_setup(const uhos_ble_bench_case_t *bcase, uhos_u16 *conn_handles, uhos_u8 max);
+static void uhos_ble_sim_bench_teardown(const uhos_u16 *conn_handles, uhos_u8 num);
+static uhos_u64 uhos_ble_sim_bench_cpu_us_get(void);
+
+/**************************************************************************************************/
+/*                                          内部全局变量                                          */
+/**************************************************************************************************/
+static uhos_ble_sim_bench_t g_uhos_ble_sim_bench;
+
+static const uhos_ble_bench_env_t g_uhos_ble_sim_bench_env = {
+    .setup           = uhos_ble_sim_bench_setup,
+    .teardown        = uhos_ble_sim_bench_teardown,
+    .cpu_us_get      = uhos_ble_sim_bench_cpu_us_get,
+    .alloc_count_get = UHOS_NULL,
+};
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       等待本端与虚拟对端之间的链路在AL层可见
+ * @param[in]   addr        对端地址
+ * @param[out]  conn_id     连接ID
+ * @return      uhos_ble_status_t 执行结果
+ */
+static uhos_ble_status_t uhos_ble_sim_bench_link_wait(const uhos_ble_addr_t addr, uhos_u16 *conn_id)
+{
+    uhos_ble_sim_link_info_t info;
+    uhos_ble_conn_stats_t stats;
+    uhos_u32 waited = 0;
+
+    for (waited = 0; waited < UHOS_BLE_SIM_BENCH_WAIT_MS; waited += 10)
+    {
+        if ((UHOS_BLE_SUCCESS == uhos_ble_sim_link_get(addr, &info)) &&
+            (UHOS_BLE_SUCCESS == uhos_ble_gatts_conn_stats_get(info.conn_id, &stats)))
+        {
+            *conn_id = info.conn_id;
+            return UHOS_BLE_SUCCESS;
+        }
+        uhos_thread_sleep(10);
+    }
+
+    return UHOS_BLE_ERROR;
+}
+
+/**
+ * @brief       新建虚拟对端并与本端建立连接
+ * @param[in]   bcase       用例
+ * @param[in]   addr        对端地址
+ * @param[out]  conn_id     连接ID
+ * @return      uhos_ble_status_t 执行结果
+ */
+static uhos_ble_status_t uhos_ble_sim_bench_peer_open(const uhos_ble_bench_case_t *bcase, const uhos_ble_addr_t addr,
+                                                      uhos_u16 *conn_id)
+{
+    static const uhos_u8 adv_data[] = {0x02, 0x01, 0x06};
+    uhos_ble_sim_attr_t attrs[2];
+    uhos_ble_sim_peer_t peer;
+    uhos_ble_gap_adv_param_t adv_param;
+    uhos_ble_gap_scan_param_t scan_param;
+    uhos_ble_gap_connect_t conn_param;
+
+    if (bcase->handle < 3)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_libc_memset(attrs, 0, sizeof(attrs));
+    attrs[0].type        = UHOS_BLE_SIM_ATTR_SERVICE;
+    attrs[0].handle      = bcase->handle - 2;
+    attrs[0].uuid.type   = UHOS_BLE_UUID_TYPE_16;
+    attrs[0].uuid.uuid16 = 0xFFF0;
+    attrs[1].type        = UHOS_BLE_SIM_ATTR_CHAR;
+    attrs[1].handle      = bcase->handle;
+    attrs[1].uuid.type   = UHOS_BLE_UUID_TYPE_16;
+    attrs[1].uuid.uuid16 = 0xFFF1;
+    attrs[1].props       = UHOS_BLE_SIM_BENCH_CHAR_PROPS;
+
+    uhos_libc_memset(&peer, 0, sizeof(peer));
+    uhos_libc_memcpy(peer.addr, addr, sizeof(uhos_ble_addr_t));
+    peer.mtu      = UHOS_BLE_SIM_BENCH_PEER_MTU;
+    peer.attrs    = attrs;
+    peer.attr_num = 2;
+
+    uhos_ble_sim_peer_remove(addr);
+    if (UHOS_BLE_SUCCESS != uhos_ble_sim_peer_add(&peer))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    if (UHOS_BLE_BENCH_NOTIFY == bcase->op)
+    {
+        // 本端作为server发送通知：本端广播，由对端发起连接
+        uhos_libc_memset(&adv_param, 0, sizeof(adv_param));
+        adv_param.adv_interval_min = 0x20;
+        adv_param.adv_interval_max = 0x20;
+        adv_param.adv_type         = UHOS_BLE_ADV_TYPE_CONNECTABLE_UNDIRECTED;
+        uhos_ble_gap_adv_data_set(adv_data, sizeof(adv_data), UHOS_NULL, 0);
+        if ((UHOS_BLE_SUCCESS != uhos_ble_gap_adv_start(&adv_param)) ||
+            (UHOS_BLE_SUCCESS != uhos_ble_sim_peer_connect(addr, UHOS_NULL)))
+        {
+            uhos_ble_sim_peer_remove(addr);
+            return UHOS_BLE_ERROR;
+        }
+    }
+    else
+    {
+        // 本端作为client写入：本端发起连接
+        uhos_libc_memset(&scan_param, 0, sizeof(scan_param));
+        uhos_libc_memset(&conn_param, 0, sizeof(conn_param));
+        scan_param.scan_interval = 100;
+        scan_param.scan_window   = 50;
+        scan_param.timeout       = 1;
+        uhos_libc_memcpy(conn_param.peer_addr, addr, sizeof(uhos_ble_addr_t));
+        conn_param.role = UHOS_BLE_GAP_CENTRAL;
+        if (UHOS_BLE_SUCCESS != uhos_ble_gap_connect(scan_param, conn_param))
+        {
+            uhos_ble_sim_peer_remove(addr);
+            return UHOS_BLE_ERROR;
+        }
+    }
+
+    if (UHOS_BLE_SUCCESS != uhos_ble_sim_bench_link_wait(addr, conn_id))
+    {
+        UHOS_LOGW("peer %02x link not ready", addr[0]);
+        uhos_ble_sim_peer_remove(addr);
+        return UHOS_BLE_ERROR;
+    }
+
+    return UHOS_BLE_SUCCESS;
+}
+
+static uhos_u8 uhos_ble_sim_bench_setup(const uhos_ble_bench_case_t *bcase, uhos_u16 *conn_handles, uhos_u8 max)
+{
+    uhos_ble_sim_bench_t *ctx = &g_uhos_ble_sim_bench;
+    uhos_u8 num = 0;
+    uhos_u8 i = 0;
+
+    if (max > UHOS_BLE_SIM_BENCH_PEER_NUM)
+    {
+        max = UHOS_BLE_SIM_BENCH_PEER_NUM;
+    }
+
+    ctx->peer_num = 0;
+    for (i = 0; i < max; i++)
+    {
+        uhos_libc_memset(ctx->peers[num], 0, sizeof(uhos_ble_addr_t));
+        ctx->peers[num][0] = 0xB0 + i;
+        ctx->peers[num][5] = 0xC0;
+        if (UHOS_BLE_SUCCESS == uhos_ble_sim_bench_peer_open(bcase, ctx->peers[num], &conn_handles[num]))
+        {
+            num++;
+        }
+    }
+    ctx->peer_num = num;
+
+    return num;
+}
+
+static void uhos_ble_sim_bench_teardown(const uhos_u16 *conn_handles, uhos_u8 num)
+{
+    uhos_ble_sim_bench_t *ctx = &g_uhos_ble_sim_bench;
+    uhos_ble_conn_stats_t stats;
+    uhos_u32 waited = 0;
+    uhos_u8 i = 0;
+
+    for (i = 0; i < ctx->peer_num; i++)
+    {
+        uhos_ble_sim_peer_remove(ctx->peers[i]);
+    }
+    ctx->peer_num = 0;
+
+    // 等待断开事件送达AL层，避免下一个用例把旧连接计入
+    for (i = 0; i < num; i++)
+    {
+        while ((waited < UHOS_BLE_SIM_BENCH_WAIT_MS) &&
+               (UHOS_BLE_SUCCESS == uhos_ble_gatts_conn_stats_get(conn_handles[i], &stats)))
+        {
+            uhos_thread_sleep(10);
+            waited += 10;
+        }
+    }
+}
+
+static uhos_u64 uhos_ble_sim_bench_cpu_us_get(void)
+{
+    struct timespec ts;
+
+    if (0 != clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts))
+    {
+        return 0;
+    }
+
+    return (uhos_u64)ts.tv_sec * 1000000 + (uhos_u64)ts.tv_nsec / 1000;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+const uhos_ble_bench_env_t *uhos_ble_sim_bench_env_get(void)
+{
+    return &g_uhos_ble_sim_bench_env;
+}
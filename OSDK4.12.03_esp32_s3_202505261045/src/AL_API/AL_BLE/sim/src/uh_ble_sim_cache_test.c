@@ -0,0 +1,308 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_sim_cache_test.c
+ * @author agent (agent@local)
+ * @brief BLE模拟器：GATT client属性缓存的命中条件与重连首次写入时间测试
+ * @details 同一虚拟对端依次连接三次，每次先发现所有首要服务再写一次特征值，记录从连接建立到写入完成的时间：
+ *          首次连接没有缓存，须与对端交互发现；已绑定的对端重连由缓存完成发现；
+ *          未绑定的对端重连不信任缓存，重新发现。属性缓存经AL_FS持久化，主机上须链接文件系统适配层。
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：BLE模拟器：GATT client属性缓存的命中条件与重连首次写入时间测试
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>输出改用uh_bench.h
+ * </table>
+ */
+
+#define LOG_TAG "ble_sim_cache"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_osal.h"
+#include "uh_bench.h"
+#include "uh_ble.h"
+#include "uh_ble_sim.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define UHOS_BLE_SIM_CACHE_TEST_HANDLE      0x0012      //<! 写入的特征值句柄
+#define UHOS_BLE_SIM_CACHE_TEST_WAIT_MS     3000        //<! 等待连接、操作完成与断开的最长时间
+#define UHOS_BLE_SIM_CACHE_TEST_JSON_LEN    256         //<! JSON行的最大长度
+#define UHOS_BLE_SIM_CACHE_TEST_ATTR_NUM    (sizeof(g_uhos_ble_sim_cache_attrs) / sizeof(g_uhos_ble_sim_cache_attrs[0]))
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      一个用例
+ */
+typedef struct uhos_ble_sim_cache_case
+{
+    const uhos_char *name;                                      //<! 用例名称
+    uhos_bool        bonded;                                    //<! 虚拟对端是否已绑定
+    uhos_bool        expect_hit;                                //<! 服务发现是否应由缓存完成
+    uhos_bool        ok;                                        //<! 是否通过
+    uhos_bool        hit;                                       //<! 服务发现是否由缓存完成
+    uhos_u32         ttfw_ms;                                   //<! 从连接建立到首次写入完成的时间
+    uhos_u32         conn_events;                               //<! 首次写入完成时已发生的连接事件数
+    const uhos_char *reason;                                    //<! 失败原因
+} uhos_ble_sim_cache_case_t;
+
+/**************************************************************************************************/
+/*                                          内部全局变量                                          */
+/**************************************************************************************************/
+static const uhos_ble_addr_t g_uhos_ble_sim_cache_peer = {0xF1, 0x11, 0x22, 0x33, 0x44, 0xC0};
+
+// 对端属性表：GAP、GATT（含Service Changed）与一个厂商服务，不带Database Hash
+static const uhos_ble_sim_attr_t g_uhos_ble_sim_cache_attrs[] = {
+    {UHOS_BLE_SIM_ATTR_SERVICE, 0x0001, {.type = UHOS_BLE_UUID_TYPE_16, .uuid16 = 0x1800}, 0x00, 0, UHOS_NULL},
+    {UHOS_BLE_SIM_ATTR_CHAR,    0x0003, {.type = UHOS_BLE_UUID_TYPE_16, .uuid16 = 0x2A00}, 0x02, 0, UHOS_NULL},
+    {UHOS_BLE_SIM_ATTR_CHAR,    0x0005, {.type = UHOS_BLE_UUID_TYPE_16, .uuid16 = 0x2A01}, 0x02, 0, UHOS_NULL},
+    {UHOS_BLE_SIM_ATTR_SERVICE, 0x0006, {.type = UHOS_BLE_UUID_TYPE_16, .uuid16 = 0x1801}, 0x00, 0, UHOS_NULL},
+    {UHOS_BLE_SIM_ATTR_CHAR,    0x0008, {.type = UHOS_BLE_UUID_TYPE_16, .uuid16 = 0x2A05}, 0x20, 0, UHOS_NULL},
+    {UHOS_BLE_SIM_ATTR_DESC,    0x0009, {.type = UHOS_BLE_UUID_TYPE_16, .uuid16 = 0x2902}, 0x00, 0, UHOS_NULL},
+    {UHOS_BLE_SIM_ATTR_SERVICE, 0x0010, {.type = UHOS_BLE_UUID_TYPE_16, .uuid16 = 0xFFF0}, 0x00, 0, UHOS_NULL},
+    {UHOS_BLE_SIM_ATTR_CHAR,    0x0012, {.type = UHOS_BLE_UUID_TYPE_16, .uuid16 = 0xFFF1}, 0x0C, 0, UHOS_NULL},
+    {UHOS_BLE_SIM_ATTR_CHAR,    0x0014, {.type = UHOS_BLE_UUID_TYPE_16, .uuid16 = 0xFFF2}, 0x10, 0, UHOS_NULL},
+    {UHOS_BLE_SIM_ATTR_DESC,    0x0015, {.type = UHOS_BLE_UUID_TYPE_16, .uuid16 = 0x2902}, 0x00, 0, UHOS_NULL},
+};
+
+static volatile uhos_u8           g_uhos_ble_sim_cache_done;    //<! 已完成的操作数
+static volatile uhos_ble_status_t g_uhos_ble_sim_cache_status;  //<! 最近一个操作的结果
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static void uhos_ble_sim_cache_test_op_cb(const uhos_ble_gattc_op_result_t *result)
+{
+    if (UHOS_BLE_SUCCESS != result->status)
+    {
+        g_uhos_ble_sim_cache_status = result->status;
+    }
+    __atomic_add_fetch(&g_uhos_ble_sim_cache_done, 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief       新建虚拟对端，由对端连接本端广播
+ * @param[out]  conn_id 连接ID
+ * @return      uhos_ble_status_t 执行结果
+ */
+static uhos_ble_status_t uhos_ble_sim_cache_test_connect(uhos_bool bonded, uhos_u16 *conn_id)
+{
+    static const uhos_u8 adv_data[] = {0x02, 0x01, 0x06};
+    uhos_ble_sim_peer_t      peer;
+    uhos_ble_gap_adv_param_t adv_param;
+    uhos_ble_sim_link_info_t info;
+    uhos_u32                 waited = 0;
+
+    uhos_libc_memset(&peer, 0, sizeof(peer));
+    uhos_libc_memcpy(peer.addr, g_uhos_ble_sim_cache_peer, sizeof(uhos_ble_addr_t));
+    peer.attrs    = g_uhos_ble_sim_cache_attrs;
+    peer.attr_num = UHOS_BLE_SIM_CACHE_TEST_ATTR_NUM;
+    peer.bonded   = bonded;
+
+    uhos_ble_sim_peer_remove(g_uhos_ble_sim_cache_peer);
+    if (UHOS_BLE_SUCCESS != uhos_ble_sim_peer_add(&peer))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_libc_memset(&adv_param, 0, sizeof(adv_param));
+    adv_param.adv_interval_min = 0x20;
+    adv_param.adv_interval_max = 0x20;
+    adv_param.adv_type         = UHOS_BLE_ADV_TYPE_CONNECTABLE_UNDIRECTED;
+    uhos_ble_gap_adv_data_set(adv_data, sizeof(adv_data), UHOS_NULL, 0);
+    if ((UHOS_BLE_SUCCESS != uhos_ble_gap_adv_start(&adv_param)) ||
+        (UHOS_BLE_SUCCESS != uhos_ble_sim_peer_connect(g_uhos_ble_sim_cache_peer, UHOS_NULL)))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    for (waited = 0; waited < UHOS_BLE_SIM_CACHE_TEST_WAIT_MS; waited += 1)
+    {
+        if (UHOS_BLE_SUCCESS == uhos_ble_sim_link_get(g_uhos_ble_sim_cache_peer, &info))
+        {
+            *conn_id = info.conn_id;
+            return UHOS_BLE_SUCCESS;
+        }
+        uhos_thread_sleep(1);
+    }
+
+    return UHOS_BLE_ERROR;
+}
+
+/**
+ * @brief       断开虚拟对端并等待AL层删除连接
+ */
+static void uhos_ble_sim_cache_test_disconnect(uhos_u16 conn_id)
+{
+    uhos_ble_conn_stats_t stats;
+    uhos_u32              waited = 0;
+
+    uhos_ble_sim_peer_remove(g_uhos_ble_sim_cache_peer);
+    uhos_ble_gap_adv_stop();
+
+    while ((waited < UHOS_BLE_SIM_CACHE_TEST_WAIT_MS) &&
+           (UHOS_BLE_SUCCESS == uhos_ble_gatts_conn_stats_get(conn_id, &stats)))
+    {
+        uhos_thread_sleep(10);
+        waited += 10;
+    }
+}
+
+/**
+ * @brief       执行一个用例：连接，发现所有首要服务，写一次特征值
+ */
+static void uhos_ble_sim_cache_test_case(uhos_ble_sim_cache_case_t *tc)
+{
+    static const uhos_u8 value[] = {0x01, 0x02, 0x03, 0x04};
+    uhos_ble_gattc_cache_stats_t before = {0};
+    uhos_ble_gattc_cache_stats_t after  = {0};
+    uhos_ble_sim_link_info_t     info;
+    uhos_ble_gattc_op_t          op;
+    uhos_u16                     conn_id = 0;
+    uhos_u32                     waited  = 0;
+
+    uhos_ble_gattc_cache_stats_get(&before);
+
+    g_uhos_ble_sim_cache_done   = 0;
+    g_uhos_ble_sim_cache_status = UHOS_BLE_SUCCESS;
+
+    if (UHOS_BLE_SUCCESS != uhos_ble_sim_cache_test_connect(tc->bonded, &conn_id))
+    {
+        tc->reason = "connect";
+        uhos_ble_sim_cache_test_disconnect(conn_id);
+        return;
+    }
+
+    // 虚拟链路建立后，GATT client还要等协议栈的连接事件才创建连接，之前提交返回UHOS_BLE_ERROR
+    uhos_libc_memset(&op, 0, sizeof(op));
+    op.type = UHOS_BLE_GATTC_OP_PRIMARY_SERVICE_DISCOVER_ALL;
+    for (waited = 0; waited < UHOS_BLE_SIM_CACHE_TEST_WAIT_MS; waited += 1)
+    {
+        if (UHOS_BLE_SUCCESS == uhos_ble_gattc_op_submit(conn_id, &op, UHOS_NULL))
+        {
+            break;
+        }
+        uhos_thread_sleep(1);
+    }
+    if (waited >= UHOS_BLE_SIM_CACHE_TEST_WAIT_MS)
+    {
+        tc->reason = "submit";
+        uhos_ble_sim_cache_test_disconnect(conn_id);
+        return;
+    }
+
+    op.type   = UHOS_BLE_GATTC_OP_WRITE;
+    op.handle = UHOS_BLE_SIM_CACHE_TEST_HANDLE;
+    op.data   = value;
+    op.len    = sizeof(value);
+    if (UHOS_BLE_SUCCESS != uhos_ble_gattc_op_submit(conn_id, &op, UHOS_NULL))
+    {
+        tc->reason = "submit";
+        uhos_ble_sim_cache_test_disconnect(conn_id);
+        return;
+    }
+
+    for (waited = 0; waited < UHOS_BLE_SIM_CACHE_TEST_WAIT_MS; waited += 1)
+    {
+        if (2 == __atomic_load_n(&g_uhos_ble_sim_cache_done, __ATOMIC_ACQUIRE))
+        {
+            break;
+        }
+        uhos_thread_sleep(1);
+    }
+
+    if (UHOS_BLE_SUCCESS == uhos_ble_sim_link_get(g_uhos_ble_sim_cache_peer, &info))
+    {
+        tc->conn_events = info.conn_events;
+    }
+
+    uhos_ble_sim_cache_test_disconnect(conn_id);
+    uhos_ble_gattc_cache_stats_get(&after);
+
+    if (waited >= UHOS_BLE_SIM_CACHE_TEST_WAIT_MS)
+    {
+        tc->reason = "timeout";
+        return;
+    }
+    if (UHOS_BLE_SUCCESS != g_uhos_ble_sim_cache_status)
+    {
+        tc->reason = "op";
+        return;
+    }
+
+    tc->hit     = (after.hits != before.hits) ? UHOS_TRUE : UHOS_FALSE;
+    tc->ttfw_ms = tc->hit ? after.ttfw_hit_ms : after.ttfw_miss_ms;
+    tc->ok      = (tc->hit == tc->expect_hit) ? UHOS_TRUE : UHOS_FALSE;
+    if (!tc->ok)
+    {
+        tc->reason = tc->hit ? "unexpected_hit" : "unexpected_miss";
+    }
+}
+
+static void uhos_ble_sim_cache_test_print(uhos_bench_print_t print, const uhos_ble_sim_cache_case_t *tc)
+{
+    uhos_char         line[UHOS_BLE_SIM_CACHE_TEST_JSON_LEN];
+    uhos_bench_json_t json = {0};
+
+    uhos_bench_json_begin(&json, line, sizeof(line));
+    uhos_bench_json_str(&json, "case", tc->name);
+    uhos_bench_json_status(&json, tc->ok ? 0 : -1);
+    uhos_bench_json_str(&json, "reason", tc->reason);
+    uhos_bench_json_str(&json, "cache", tc->hit ? "hit" : "miss");
+    uhos_bench_json_u32(&json, "ttfw_ms", tc->ttfw_ms);
+    uhos_bench_json_u32(&json, "conn_events", tc->conn_events);
+    uhos_bench_json_end(&json);
+    print(line);
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_ble_status_t uhos_ble_sim_cache_test_run(uhos_bench_print_t print)
+{
+    uhos_ble_sim_cache_case_t cases[3];
+    uhos_ble_status_t         ret = UHOS_BLE_SUCCESS;
+    uhos_u8                   i   = 0;
+
+    if (UHOS_NULL == print)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_libc_memset(cases, 0, sizeof(cases));
+    cases[0].name       = "first_connect";
+    cases[0].bonded     = UHOS_TRUE;
+    cases[0].expect_hit = UHOS_FALSE;
+    cases[1].name       = "bonded_reconnect";
+    cases[1].bonded     = UHOS_TRUE;
+    cases[1].expect_hit = UHOS_TRUE;
+    cases[2].name       = "unbonded_reconnect";
+    cases[2].bonded     = UHOS_FALSE;
+    cases[2].expect_hit = UHOS_FALSE;
+
+    uhos_ble_gattc_cache_clear(UHOS_NULL);
+    uhos_ble_gattc_op_callback_register(uhos_ble_sim_cache_test_op_cb);
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        uhos_ble_sim_cache_test_case(&cases[i]);
+        uhos_ble_sim_cache_test_print(print, &cases[i]);
+        if (!cases[i].ok)
+        {
+            ret = UHOS_BLE_ERROR;
+        }
+    }
+
+    uhos_ble_gattc_op_callback_register(UHOS_NULL);
+    uhos_ble_gattc_cache_clear(UHOS_NULL);
+
+    return ret;
+}
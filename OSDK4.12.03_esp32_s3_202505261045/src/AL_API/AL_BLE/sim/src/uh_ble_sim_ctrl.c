@@ -0,0 +1,1376 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_sim_ctrl.c
+ * @author agent (agent@local)
+ * @brief BLE模拟器：虚拟控制器、事件投递与链路调度
+ * @details 实现esp_bt_controller_*、esp_bluedroid_*等协议栈生命周期接口与模拟器线程；
+ *          链路按连接间隔推进，每个连接事件每个方向最多传输pkts_per_event个LL数据包，
+ *          一个ATT PDU占用ceil((len + 7) / ll_payload)个数据包，超出部分计入后续连接事件。
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：BLE模拟器：虚拟控制器、事件投递与链路调度
+ * </table>
+ */
+
+#define LOG_TAG "ble_sim"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include <time.h>
+
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_ble_sim_ctrl.h"
+#include "esp_bt.h"
+#include "esp_bt_main.h"
+#include "esp_bt_device.h"
+#include "esp_mac.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define UHOS_BLE_SIM_IDLE_WAIT_MS           10          //<! 模拟器线程的最长休眠时间
+#define UHOS_BLE_SIM_CATCH_UP_MAX           16          //<! 线程滞后时一次补齐的连接事件数上限
+#define UHOS_BLE_SIM_APP_FREE               0xFFFF
+
+#define UHOS_BLE_SIM_DEF_CONN_INTERVAL      24          //<! 30ms
+#define UHOS_BLE_SIM_DEF_PKTS_PER_EVENT     4
+#define UHOS_BLE_SIM_DEF_LL_PAYLOAD         27
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+uhos_ble_sim_ctl_t g_uhos_ble_sim;
+
+static const uhos_ble_addr_t g_uhos_ble_sim_def_addr = {0x66, 0x55, 0x44, 0x33, 0x22, 0xC0};
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static uhos_ble_sim_pdu_t *uhos_ble_sim_pduq_push(uhos_ble_sim_pduq_t *q)
+{
+    uhos_ble_sim_pdu_t *pdu = UHOS_NULL;
+
+    if (q->count >= g_uhos_ble_sim.cfg.queue_size)
+    {
+        return UHOS_NULL;
+    }
+
+    pdu = &q->pdu[(q->head + q->count) % CONFIG_UHOS_BLE_SIM_TXQ_NUM];
+    q->count++;
+    uhos_libc_memset(pdu, 0, sizeof(uhos_ble_sim_pdu_t));
+
+    return pdu;
+}
+
+static void uhos_ble_sim_pduq_pop(uhos_ble_sim_pduq_t *q)
+{
+    q->head = (q->head + 1) % CONFIG_UHOS_BLE_SIM_TXQ_NUM;
+    q->count--;
+}
+
+/**
+ * @brief       ATT PDU占用的LL数据包个数
+ */
+static uhos_s32 uhos_ble_sim_pdu_cost(const uhos_ble_sim_link_t *link, const uhos_ble_sim_pdu_t *pdu)
+{
+    return (pdu->len + UHOS_BLE_SIM_LL_HDR_LEN + link->ll_payload - 1) / link->ll_payload;
+}
+
+static void uhos_ble_sim_link_congest_evt(uhos_ble_sim_link_t *link, uhos_bool congested)
+{
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+
+    link->congested = congested;
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTS, ESP_GATT_IF_NONE, ESP_GATTS_CONGEST_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gatts.congest.conn_id   = uhos_ble_sim_link_id(link);
+        evt->param.gatts.congest.congested = congested;
+    }
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTC, ESP_GATT_IF_NONE, ESP_GATTC_CONGEST_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gattc.congest.conn_id   = uhos_ble_sim_link_id(link);
+        evt->param.gattc.congest.congested = congested;
+    }
+}
+
+static uhos_bool uhos_ble_sim_pdu_is_req(uhos_u8 op)
+{
+    return ((UHOS_BLE_SIM_PDU_WRITE_REQ == op) || (UHOS_BLE_SIM_PDU_READ == op) ||
+            (UHOS_BLE_SIM_PDU_READ_BY_TYPE == op) || (UHOS_BLE_SIM_PDU_MTU_REQ == op) ||
+            (UHOS_BLE_SIM_PDU_SEARCH == op));
+}
+
+static void uhos_ble_sim_link_established(uhos_ble_sim_link_t *link)
+{
+    uhos_ble_sim_evt_t *evt   = UHOS_NULL;
+    uhos_u16 conn_id          = uhos_ble_sim_link_id(link);
+    const uhos_u8 *bda        = g_uhos_ble_sim.peer[link->peer].bda;
+    uhos_u8 link_role         = (UHOS_BLE_GAP_CENTRAL == link->role) ? 0 : 1;
+
+    link->state = UHOS_BLE_SIM_LINK_CONNECTED;
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTS, ESP_GATT_IF_NONE, ESP_GATTS_CONNECT_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gatts.connect.conn_id              = conn_id;
+        evt->param.gatts.connect.link_role            = link_role;
+        evt->param.gatts.connect.conn_params.interval = link->interval;
+        evt->param.gatts.connect.conn_params.latency  = link->latency;
+        evt->param.gatts.connect.conn_params.timeout  = link->timeout;
+        uhos_libc_memcpy(evt->param.gatts.connect.remote_bda, bda, ESP_BD_ADDR_LEN);
+    }
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTC, ESP_GATT_IF_NONE, ESP_GATTC_CONNECT_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gattc.connect.conn_id              = conn_id;
+        evt->param.gattc.connect.link_role            = link_role;
+        evt->param.gattc.connect.conn_params.interval = link->interval;
+        evt->param.gattc.connect.conn_params.latency  = link->latency;
+        evt->param.gattc.connect.conn_params.timeout  = link->timeout;
+        uhos_libc_memcpy(evt->param.gattc.connect.remote_bda, bda, ESP_BD_ADDR_LEN);
+    }
+
+    if (ESP_GATT_IF_NONE != link->open_if)
+    {
+        evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTC, link->open_if, ESP_GATTC_OPEN_EVT);
+        if (UHOS_NULL != evt)
+        {
+            evt->param.gattc.open.status  = ESP_GATT_OK;
+            evt->param.gattc.open.conn_id = conn_id;
+            evt->param.gattc.open.mtu     = link->mtu;
+            uhos_libc_memcpy(evt->param.gattc.open.remote_bda, bda, ESP_BD_ADDR_LEN);
+        }
+    }
+}
+
+/**
+ * @brief       推进一个连接事件：完成上一事件发出的请求，再在包数预算内收发队列中的PDU
+ */
+static void uhos_ble_sim_link_event(uhos_ble_sim_link_t *link)
+{
+    uhos_s32 pkts            = g_uhos_ble_sim.cfg.pkts_per_event;
+    uhos_ble_sim_pdu_t *pdu  = UHOS_NULL;
+    uhos_u16 rounds          = 0;
+
+    link->next_evt_us += (uhos_u64)link->interval * 1250;
+
+    if (UHOS_BLE_SIM_LINK_CONNECTING == link->state)
+    {
+        uhos_ble_sim_link_established(link);
+        return;
+    }
+
+    link->info.conn_events++;
+    uhos_ble_sim_gap_link_process(link);
+
+    if (link->ind_pending)
+    {
+        link->ind_pending = UHOS_FALSE;
+        uhos_ble_sim_gatts_ind_confirm(link);
+    }
+
+    if ((0 != link->req_rounds) && (0 == --link->req_rounds))
+    {
+        uhos_ble_sim_gattc_req_done(link);
+    }
+
+    // 预算不足时的欠账计入本事件
+    link->tx_budget = (link->tx_budget + pkts > pkts) ? pkts : (link->tx_budget + pkts);
+    while ((0 != link->txq.count) && (link->tx_budget > 0))
+    {
+        pdu = &link->txq.pdu[link->txq.head];
+        if (uhos_ble_sim_pdu_is_req(pdu->op) && (0 != link->req_rounds))
+        {
+            break;
+        }
+        if ((UHOS_BLE_SIM_PDU_INDICATE == pdu->op) && link->ind_pending)
+        {
+            break;
+        }
+
+        link->tx_budget -= uhos_ble_sim_pdu_cost(link, pdu);
+        link->info.tx_pdus++;
+        link->info.tx_bytes += pdu->len;
+
+        if ((UHOS_BLE_SIM_PDU_NOTIFY == pdu->op) || (UHOS_BLE_SIM_PDU_INDICATE == pdu->op))
+        {
+            uhos_ble_sim_gatts_tx(link, pdu);
+        }
+        else
+        {
+            rounds = uhos_ble_sim_gattc_tx(link, pdu);
+            if (0 != rounds)
+            {
+                uhos_libc_memcpy(&link->req, pdu, sizeof(uhos_ble_sim_pdu_t));
+                link->req_rounds = rounds;
+            }
+        }
+        uhos_ble_sim_pduq_pop(&link->txq);
+
+        if (link->congested && (link->txq.count <= g_uhos_ble_sim.cfg.queue_size / 4))
+        {
+            uhos_ble_sim_link_congest_evt(link, UHOS_FALSE);
+        }
+    }
+
+    link->rx_budget = (link->rx_budget + pkts > pkts) ? pkts : (link->rx_budget + pkts);
+    while ((0 != link->rxq.count) && (link->rx_budget > 0))
+    {
+        pdu = &link->rxq.pdu[link->rxq.head];
+
+        link->rx_budget -= uhos_ble_sim_pdu_cost(link, pdu);
+        link->info.rx_pdus++;
+        link->info.rx_bytes += pdu->len;
+
+        if ((UHOS_BLE_SIM_PDU_PEER_NOTIFY == pdu->op) || (UHOS_BLE_SIM_PDU_PEER_INDICATE == pdu->op))
+        {
+            uhos_ble_sim_gattc_rx(link, pdu);
+        }
+        else
+        {
+            uhos_ble_sim_gatts_rx(link, pdu);
+        }
+        uhos_ble_sim_pduq_pop(&link->rxq);
+    }
+}
+
+/**
+ * @brief       推进所有到期的连接事件
+ * @return      最近一个连接事件的时刻，无链路时返回0
+ */
+static uhos_u64 uhos_ble_sim_link_process(uhos_u64 now)
+{
+    uhos_ble_sim_link_t *link = UHOS_NULL;
+    uhos_u64 next             = 0;
+    uhos_u8 i = 0, n = 0;
+
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_LINK_NUM; i++)
+    {
+        link = &g_uhos_ble_sim.link[i];
+
+        for (n = 0; (UHOS_BLE_SIM_LINK_IDLE != link->state) && (now >= link->next_evt_us) &&
+                    (n < UHOS_BLE_SIM_CATCH_UP_MAX); n++)
+        {
+            uhos_ble_sim_link_event(link);
+        }
+        if (UHOS_BLE_SIM_LINK_IDLE == link->state)
+        {
+            continue;
+        }
+        if (now >= link->next_evt_us)
+        {
+            // 线程被回调阻塞过久，丢弃积压的连接事件
+            link->next_evt_us = now + (uhos_u64)link->interval * 1250;
+        }
+        if ((0 == next) || (link->next_evt_us < next))
+        {
+            next = link->next_evt_us;
+        }
+    }
+
+    return next;
+}
+
+/**
+ * @brief       投递一个事件
+ * @return      UHOS_FALSE表示队列已空
+ */
+static uhos_bool uhos_ble_sim_evt_deliver(void)
+{
+    static uhos_ble_sim_evt_t evt;                              // 仅模拟器线程使用
+    uhos_u16 app[UHOS_BLE_SIM_APP_NUM];
+    esp_gap_ble_cb_t gap_cb;
+    esp_gatts_cb_t gatts_cb;
+    esp_gattc_cb_t gattc_cb;
+    uhos_u8 i = 0;
+
+    UHOS_BLE_SIM_LOCK();
+    if (0 == g_uhos_ble_sim.evt_count)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return UHOS_FALSE;
+    }
+    uhos_libc_memcpy(&evt, &g_uhos_ble_sim.evt[g_uhos_ble_sim.evt_head], sizeof(evt));
+    g_uhos_ble_sim.evt_head = (g_uhos_ble_sim.evt_head + 1) % CONFIG_UHOS_BLE_SIM_EVT_NUM;
+    g_uhos_ble_sim.evt_count--;
+    g_uhos_ble_sim.stats.evt_delivered++;
+
+    gap_cb   = g_uhos_ble_sim.gap_cb;
+    gatts_cb = g_uhos_ble_sim.gatts_cb;
+    gattc_cb = g_uhos_ble_sim.gattc_cb;
+    uhos_libc_memcpy(app, (UHOS_BLE_SIM_EVT_GATTS == evt.kind) ? g_uhos_ble_sim.gatts_app : g_uhos_ble_sim.gattc_app,
+                     sizeof(app));
+    UHOS_BLE_SIM_UNLOCK();
+
+    switch (evt.kind)
+    {
+    case UHOS_BLE_SIM_EVT_GAP:
+        if (ESP_GAP_BLE_EXT_ADV_REPORT_EVT == evt.event)
+        {
+            evt.param.gap.ext_adv_report.params.adv_data = evt.data;
+        }
+        if (UHOS_NULL != gap_cb)
+        {
+            gap_cb((esp_gap_ble_cb_event_t)evt.event, &evt.param.gap);
+        }
+        return UHOS_TRUE;
+
+    case UHOS_BLE_SIM_EVT_GATTS:
+        if (ESP_GATTS_WRITE_EVT == evt.event)
+        {
+            evt.param.gatts.write.value = evt.data;
+        }
+        else if (ESP_GATTS_CONF_EVT == evt.event)
+        {
+            evt.param.gatts.conf.value = evt.data;
+        }
+        else if (ESP_GATTS_CREAT_ATTR_TAB_EVT == evt.event)
+        {
+            evt.param.gatts.add_attr_tab.handles = (uint16_t *)evt.data;
+        }
+        if (UHOS_NULL == gatts_cb)
+        {
+            return UHOS_TRUE;
+        }
+        if (ESP_GATT_IF_NONE != evt.gatt_if)
+        {
+            gatts_cb((esp_gatts_cb_event_t)evt.event, evt.gatt_if, &evt.param.gatts);
+            return UHOS_TRUE;
+        }
+        for (i = 0; i < UHOS_BLE_SIM_APP_NUM; i++)
+        {
+            if (UHOS_BLE_SIM_APP_FREE != app[i])
+            {
+                gatts_cb((esp_gatts_cb_event_t)evt.event, UHOS_BLE_SIM_GATT_IF_BASE + i, &evt.param.gatts);
+            }
+        }
+        return UHOS_TRUE;
+
+    case UHOS_BLE_SIM_EVT_GATTC:
+        if (ESP_GATTC_READ_CHAR_EVT == evt.event)
+        {
+            evt.param.gattc.read.value = evt.data;
+        }
+        else if (ESP_GATTC_NOTIFY_EVT == evt.event)
+        {
+            evt.param.gattc.notify.value = evt.data;
+        }
+        if (UHOS_NULL == gattc_cb)
+        {
+            return UHOS_TRUE;
+        }
+        if (ESP_GATT_IF_NONE != evt.gatt_if)
+        {
+            gattc_cb((esp_gattc_cb_event_t)evt.event, evt.gatt_if, &evt.param.gattc);
+            return UHOS_TRUE;
+        }
+        for (i = 0; i < UHOS_BLE_SIM_APP_NUM; i++)
+        {
+            if (UHOS_BLE_SIM_APP_FREE != app[i])
+            {
+                gattc_cb((esp_gattc_cb_event_t)evt.event, UHOS_BLE_SIM_GATT_IF_BASE + i, &evt.param.gattc);
+            }
+        }
+        return UHOS_TRUE;
+
+    default:
+        return UHOS_TRUE;
+    }
+}
+
+static void *uhos_ble_sim_thread(void *arg)
+{
+    uhos_u64 now = 0, next = 0, link_next = 0;
+    uhos_u32 wait_ms = 0;
+
+    (void)arg;
+
+    while (g_uhos_ble_sim.running)
+    {
+        UHOS_BLE_SIM_LOCK();
+        now       = uhos_ble_sim_now_us();
+        next      = uhos_ble_sim_gap_process(now);
+        link_next = uhos_ble_sim_link_process(now);
+        if ((0 != link_next) && ((0 == next) || (link_next < next)))
+        {
+            next = link_next;
+        }
+        UHOS_BLE_SIM_UNLOCK();
+
+        while (uhos_ble_sim_evt_deliver())
+        {
+        }
+
+        now     = uhos_ble_sim_now_us();
+        wait_ms = UHOS_BLE_SIM_IDLE_WAIT_MS;
+        if ((0 != next) && (next < now + (uhos_u64)UHOS_BLE_SIM_IDLE_WAIT_MS * 1000))
+        {
+            wait_ms = (next > now) ? (uhos_u32)((next - now + 999) / 1000) : 0;
+        }
+        if (0 != wait_ms)
+        {
+            uhos_sem_wait(g_uhos_ble_sim.wake, wait_ms);
+        }
+    }
+
+    uhos_sem_release(g_uhos_ble_sim.exit);
+
+    return UHOS_NULL;
+}
+
+static uhos_ble_sim_link_t *uhos_ble_sim_link_of_addr(const uhos_ble_addr_t addr, uhos_ble_sim_peer_ctx_t **peer)
+{
+    esp_bd_addr_t bda;
+    uhos_s32 idx = 0;
+
+    uhos_ble_sim_addr_to_bda(addr, bda);
+    idx = uhos_ble_sim_peer_find(bda);
+    if (idx < 0)
+    {
+        return UHOS_NULL;
+    }
+    if (UHOS_NULL != peer)
+    {
+        *peer = &g_uhos_ble_sim.peer[idx];
+    }
+
+    return uhos_ble_sim_link_get_by_bda(bda);
+}
+
+static void uhos_ble_sim_uuid_conv(const uhos_ble_uuid_t *src, esp_bt_uuid_t *dst)
+{
+    uhos_libc_memset(dst, 0, sizeof(esp_bt_uuid_t));
+    if (UHOS_BLE_UUID_TYPE_16 == src->type)
+    {
+        dst->len          = ESP_UUID_LEN_16;
+        dst->uuid.uuid16  = src->uuid16;
+    }
+    else
+    {
+        dst->len = ESP_UUID_LEN_128;
+        uhos_libc_memcpy(dst->uuid.uuid128, src->uuid128, ESP_UUID_LEN_128);
+    }
+}
+
+/**
+ * @brief       对端向本端发送PDU（写、读、通知、MTU请求）
+ */
+static uhos_ble_status_t uhos_ble_sim_peer_send(const uhos_ble_addr_t addr, uhos_u8 op, uhos_u16 handle,
+                                                const uhos_u8 *data, uhos_u16 len)
+{
+    uhos_ble_sim_link_t *link = UHOS_NULL;
+    uhos_ble_sim_pdu_t *pdu   = UHOS_NULL;
+
+    uhos_ble_sim_ctl_init();
+
+    UHOS_BLE_SIM_LOCK();
+    link = uhos_ble_sim_link_of_addr(addr, UHOS_NULL);
+    if ((UHOS_NULL == link) || (UHOS_BLE_SIM_LINK_CONNECTED != link->state) ||
+        (len > link->mtu - 3) || (len > UHOS_BLE_SIM_PDU_LEN))
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return UHOS_BLE_ERROR;
+    }
+
+    pdu = uhos_ble_sim_pduq_push(&link->rxq);
+    if (UHOS_NULL == pdu)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return UHOS_BLE_BUSY;
+    }
+    pdu->op     = op;
+    pdu->handle = handle;
+    pdu->len    = len;
+    if (UHOS_NULL != data)
+    {
+        uhos_libc_memcpy(pdu->data, data, len);
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       首次使用时初始化控制块，模拟器接口可能早于协议栈初始化被调用
+ */
+void uhos_ble_sim_ctl_init(void)
+{
+    uhos_u8 i = 0;
+
+    if (UHOS_NULL != g_uhos_ble_sim.mutex)
+    {
+        return;
+    }
+
+    uhos_mutex_create(&g_uhos_ble_sim.mutex);
+    uhos_sem_create(&g_uhos_ble_sim.wake, 0);
+    uhos_sem_create(&g_uhos_ble_sim.exit, 0);
+
+    uhos_libc_memcpy(g_uhos_ble_sim.cfg.local_addr, g_uhos_ble_sim_def_addr, sizeof(uhos_ble_addr_t));
+    g_uhos_ble_sim.cfg.conn_interval  = UHOS_BLE_SIM_DEF_CONN_INTERVAL;
+    g_uhos_ble_sim.cfg.pkts_per_event = UHOS_BLE_SIM_DEF_PKTS_PER_EVENT;
+    g_uhos_ble_sim.cfg.queue_size     = CONFIG_UHOS_BLE_SIM_TXQ_NUM;
+    g_uhos_ble_sim.cfg.seed           = 1;
+    g_uhos_ble_sim.rand               = 1;
+    uhos_ble_sim_addr_to_bda(g_uhos_ble_sim.cfg.local_addr, g_uhos_ble_sim.local_bda);
+    g_uhos_ble_sim.local_mtu = ESP_GATT_DEF_BLE_MTU_SIZE;
+
+    for (i = 0; i < UHOS_BLE_SIM_APP_NUM; i++)
+    {
+        g_uhos_ble_sim.gatts_app[i] = UHOS_BLE_SIM_APP_FREE;
+        g_uhos_ble_sim.gattc_app[i] = UHOS_BLE_SIM_APP_FREE;
+    }
+}
+
+uhos_u64 uhos_ble_sim_now_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uhos_u64)ts.tv_sec * 1000000 + (uhos_u64)(ts.tv_nsec / 1000);
+}
+
+uhos_u32 uhos_ble_sim_rand(void)
+{
+    // xorshift32，结果只与种子有关，便于复现
+    uhos_u32 x = g_uhos_ble_sim.rand;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    g_uhos_ble_sim.rand = x;
+
+    return x;
+}
+
+void uhos_ble_sim_wakeup(void)
+{
+    if (UHOS_NULL != g_uhos_ble_sim.wake)
+    {
+        uhos_sem_release(g_uhos_ble_sim.wake);
+    }
+}
+
+/**
+ * @brief       申请一个待投递事件，调用者须持有模拟器锁
+ * @return      事件，队列满时返回UHOS_NULL并计入丢弃统计
+ */
+uhos_ble_sim_evt_t *uhos_ble_sim_evt_alloc(uhos_u8 kind, esp_gatt_if_t gatt_if, uhos_u16 event)
+{
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+
+    if (CONFIG_UHOS_BLE_SIM_EVT_NUM == g_uhos_ble_sim.evt_count)
+    {
+        g_uhos_ble_sim.stats.evt_dropped++;
+        UHOS_LOGW("event queue full, drop kind %d event %d", kind, event);
+        return UHOS_NULL;
+    }
+
+    evt = &g_uhos_ble_sim.evt[(g_uhos_ble_sim.evt_head + g_uhos_ble_sim.evt_count) % CONFIG_UHOS_BLE_SIM_EVT_NUM];
+    g_uhos_ble_sim.evt_count++;
+    if (g_uhos_ble_sim.evt_count > g_uhos_ble_sim.stats.evt_max_depth)
+    {
+        g_uhos_ble_sim.stats.evt_max_depth = g_uhos_ble_sim.evt_count;
+    }
+
+    uhos_libc_memset(&evt->param, 0, sizeof(evt->param));
+    evt->kind    = kind;
+    evt->gatt_if = gatt_if;
+    evt->event   = event;
+
+    uhos_ble_sim_wakeup();
+
+    return evt;
+}
+
+/**
+ * @brief       应用字节序地址转换为协议栈字节序
+ */
+void uhos_ble_sim_addr_to_bda(const uhos_ble_addr_t addr, esp_bd_addr_t bda)
+{
+    uhos_u8 i = 0;
+
+    for (i = 0; i < ESP_BD_ADDR_LEN; i++)
+    {
+        bda[i] = addr[ESP_BD_ADDR_LEN - 1 - i];
+    }
+}
+
+uhos_s32 uhos_ble_sim_peer_find(const esp_bd_addr_t bda)
+{
+    uhos_s32 i = 0;
+
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_PEER_NUM; i++)
+    {
+        if (g_uhos_ble_sim.peer[i].used &&
+            (0 == uhos_libc_memcmp(g_uhos_ble_sim.peer[i].bda, bda, ESP_BD_ADDR_LEN)))
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+uhos_ble_sim_peer_attr_t *uhos_ble_sim_peer_attr_find(uhos_ble_sim_peer_ctx_t *peer, uhos_u16 handle)
+{
+    uhos_u16 i = 0;
+
+    for (i = 0; i < peer->attr_num; i++)
+    {
+        if (peer->attrs[i].handle == handle)
+        {
+            return &peer->attrs[i];
+        }
+    }
+
+    return UHOS_NULL;
+}
+
+uhos_ble_sim_link_t *uhos_ble_sim_link_get_by_id(uhos_u16 conn_id)
+{
+    if ((conn_id >= CONFIG_UHOS_BLE_SIM_LINK_NUM) || (UHOS_BLE_SIM_LINK_IDLE == g_uhos_ble_sim.link[conn_id].state))
+    {
+        return UHOS_NULL;
+    }
+
+    return &g_uhos_ble_sim.link[conn_id];
+}
+
+uhos_ble_sim_link_t *uhos_ble_sim_link_get_by_bda(const esp_bd_addr_t bda)
+{
+    uhos_ble_sim_link_t *link = UHOS_NULL;
+    uhos_u8 i = 0;
+
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_LINK_NUM; i++)
+    {
+        link = &g_uhos_ble_sim.link[i];
+        if ((UHOS_BLE_SIM_LINK_IDLE != link->state) &&
+            (0 == uhos_libc_memcmp(g_uhos_ble_sim.peer[link->peer].bda, bda, ESP_BD_ADDR_LEN)))
+        {
+            return link;
+        }
+    }
+
+    return UHOS_NULL;
+}
+
+uhos_u16 uhos_ble_sim_link_id(const uhos_ble_sim_link_t *link)
+{
+    return (uhos_u16)(link - g_uhos_ble_sim.link);
+}
+
+/**
+ * @brief       建立链路，连接事件在第一个连接间隔后上报
+ * @return      链路，链路已满或对端已连接时返回UHOS_NULL
+ */
+uhos_ble_sim_link_t *uhos_ble_sim_link_open(uhos_u8 peer, uhos_u8 role, esp_gatt_if_t open_if)
+{
+    uhos_ble_sim_link_t *link = UHOS_NULL;
+    uhos_u8 i = 0;
+
+    if (UHOS_NULL != uhos_ble_sim_link_get_by_bda(g_uhos_ble_sim.peer[peer].bda))
+    {
+        return UHOS_NULL;
+    }
+
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_LINK_NUM; i++)
+    {
+        if (UHOS_BLE_SIM_LINK_IDLE == g_uhos_ble_sim.link[i].state)
+        {
+            link = &g_uhos_ble_sim.link[i];
+            break;
+        }
+    }
+    if (UHOS_NULL == link)
+    {
+        return UHOS_NULL;
+    }
+
+    uhos_libc_memset(link, 0, sizeof(uhos_ble_sim_link_t));
+    link->state       = UHOS_BLE_SIM_LINK_CONNECTING;
+    link->peer        = peer;
+    link->role        = role;
+    link->open_if     = open_if;
+    link->interval    = g_uhos_ble_sim.cfg.conn_interval;
+    link->latency     = 0;
+    link->timeout     = 400;
+    link->mtu         = ESP_GATT_DEF_BLE_MTU_SIZE;
+    link->ll_payload  = UHOS_BLE_SIM_DEF_LL_PAYLOAD;
+    link->next_evt_us = uhos_ble_sim_now_us() + (uhos_u64)link->interval * 1250;
+    link->info.conn_id = i;
+    link->info.role    = role;
+
+    uhos_ble_sim_wakeup();
+
+    return link;
+}
+
+/**
+ * @brief       断开链路并上报断开事件，队列中未发出的PDU被丢弃
+ */
+void uhos_ble_sim_link_close(uhos_ble_sim_link_t *link, esp_gatt_conn_reason_t reason)
+{
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+    uhos_u16 conn_id        = uhos_ble_sim_link_id(link);
+    const uhos_u8 *bda      = g_uhos_ble_sim.peer[link->peer].bda;
+
+    if (UHOS_BLE_SIM_LINK_CONNECTED == link->state)
+    {
+        evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTS, ESP_GATT_IF_NONE, ESP_GATTS_DISCONNECT_EVT);
+        if (UHOS_NULL != evt)
+        {
+            evt->param.gatts.disconnect.conn_id = conn_id;
+            evt->param.gatts.disconnect.reason  = reason;
+            uhos_libc_memcpy(evt->param.gatts.disconnect.remote_bda, bda, ESP_BD_ADDR_LEN);
+        }
+
+        evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTC, ESP_GATT_IF_NONE, ESP_GATTC_DISCONNECT_EVT);
+        if (UHOS_NULL != evt)
+        {
+            evt->param.gattc.disconnect.conn_id = conn_id;
+            evt->param.gattc.disconnect.reason  = reason;
+            uhos_libc_memcpy(evt->param.gattc.disconnect.remote_bda, bda, ESP_BD_ADDR_LEN);
+        }
+    }
+
+    if (ESP_GATT_IF_NONE != link->open_if)
+    {
+        evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTC, link->open_if, ESP_GATTC_CLOSE_EVT);
+        if (UHOS_NULL != evt)
+        {
+            evt->param.gattc.close.status  = ESP_GATT_OK;
+            evt->param.gattc.close.conn_id = conn_id;
+            evt->param.gattc.close.reason  = reason;
+            uhos_libc_memcpy(evt->param.gattc.close.remote_bda, bda, ESP_BD_ADDR_LEN);
+        }
+    }
+
+    link->state = UHOS_BLE_SIM_LINK_IDLE;
+}
+
+/**
+ * @brief       申请本端发送方向的PDU，队列达到3/4时上报拥塞
+ * @return      PDU，队列满时返回UHOS_NULL
+ */
+uhos_ble_sim_pdu_t *uhos_ble_sim_link_tx_alloc(uhos_ble_sim_link_t *link, uhos_u8 op)
+{
+    uhos_ble_sim_pdu_t *pdu = UHOS_NULL;
+
+    if (UHOS_BLE_SIM_LINK_CONNECTED != link->state)
+    {
+        return UHOS_NULL;
+    }
+
+    pdu = uhos_ble_sim_pduq_push(&link->txq);
+    if (UHOS_NULL == pdu)
+    {
+        link->info.tx_full++;
+        return UHOS_NULL;
+    }
+    pdu->op = op;
+
+    if (!link->congested && (link->txq.count >= g_uhos_ble_sim.cfg.queue_size * 3 / 4))
+    {
+        uhos_ble_sim_link_congest_evt(link, UHOS_TRUE);
+    }
+
+    return pdu;
+}
+
+/****************ESP-IDF*********************/
+const char *esp_err_to_name(esp_err_t code)
+{
+    switch (code)
+    {
+    case ESP_OK:                return "ESP_OK";
+    case ESP_FAIL:              return "ESP_FAIL";
+    case ESP_ERR_NO_MEM:        return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG:   return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE:  return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND:     return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_NOT_SUPPORTED: return "ESP_ERR_NOT_SUPPORTED";
+    case ESP_ERR_TIMEOUT:       return "ESP_ERR_TIMEOUT";
+    default:                    return "UNKNOWN ERROR";
+    }
+}
+
+esp_err_t esp_read_mac(uint8_t *mac, esp_mac_type_t type)
+{
+    (void)type;
+
+    if (UHOS_NULL == mac)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uhos_ble_sim_ctl_init();
+    uhos_libc_memcpy(mac, g_uhos_ble_sim.local_bda, ESP_BD_ADDR_LEN);
+
+    return ESP_OK;
+}
+
+const uint8_t *esp_bt_dev_get_address(void)
+{
+    uhos_ble_sim_ctl_init();
+
+    return g_uhos_ble_sim.local_bda;
+}
+
+esp_err_t esp_bt_dev_set_device_name(const char *name)
+{
+    return (UHOS_NULL == name) ? ESP_ERR_INVALID_ARG : ESP_OK;
+}
+
+esp_err_t esp_bt_controller_mem_release(esp_bt_mode_t mode)
+{
+    (void)mode;
+
+    return ESP_OK;
+}
+
+esp_err_t esp_bt_controller_init(esp_bt_controller_config_t *cfg)
+{
+    if (UHOS_NULL == cfg)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uhos_ble_sim_ctl_init();
+    if (ESP_BT_CONTROLLER_STATUS_IDLE != g_uhos_ble_sim.ctrl_status)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    g_uhos_ble_sim.ctrl_status = ESP_BT_CONTROLLER_STATUS_INITED;
+
+    return ESP_OK;
+}
+
+esp_err_t esp_bt_controller_deinit(void)
+{
+    if (ESP_BT_CONTROLLER_STATUS_INITED != g_uhos_ble_sim.ctrl_status)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    g_uhos_ble_sim.ctrl_status = ESP_BT_CONTROLLER_STATUS_IDLE;
+
+    return ESP_OK;
+}
+
+esp_err_t esp_bt_controller_enable(esp_bt_mode_t mode)
+{
+    if ((ESP_BT_CONTROLLER_STATUS_INITED != g_uhos_ble_sim.ctrl_status) || (ESP_BT_MODE_BLE != mode))
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    g_uhos_ble_sim.ctrl_status = ESP_BT_CONTROLLER_STATUS_ENABLED;
+
+    return ESP_OK;
+}
+
+esp_err_t esp_bt_controller_disable(void)
+{
+    if (ESP_BT_CONTROLLER_STATUS_ENABLED != g_uhos_ble_sim.ctrl_status)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    g_uhos_ble_sim.ctrl_status = ESP_BT_CONTROLLER_STATUS_INITED;
+
+    return ESP_OK;
+}
+
+esp_bt_controller_status_t esp_bt_controller_get_status(void)
+{
+    return (esp_bt_controller_status_t)g_uhos_ble_sim.ctrl_status;
+}
+
+esp_bluedroid_status_t esp_bluedroid_get_status(void)
+{
+    return (esp_bluedroid_status_t)g_uhos_ble_sim.bluedroid_status;
+}
+
+esp_err_t esp_bluedroid_init(void)
+{
+    esp_bluedroid_config_t cfg = BT_BLUEDROID_INIT_CONFIG_DEFAULT();
+
+    return esp_bluedroid_init_with_cfg(&cfg);
+}
+
+esp_err_t esp_bluedroid_init_with_cfg(esp_bluedroid_config_t *cfg)
+{
+    (void)cfg;
+
+    if ((ESP_BT_CONTROLLER_STATUS_ENABLED != g_uhos_ble_sim.ctrl_status) ||
+        (ESP_BLUEDROID_STATUS_UNINITIALIZED != g_uhos_ble_sim.bluedroid_status))
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    g_uhos_ble_sim.bluedroid_status = ESP_BLUEDROID_STATUS_INITIALIZED;
+
+    return ESP_OK;
+}
+
+esp_err_t esp_bluedroid_deinit(void)
+{
+    if (ESP_BLUEDROID_STATUS_INITIALIZED != g_uhos_ble_sim.bluedroid_status)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    g_uhos_ble_sim.bluedroid_status = ESP_BLUEDROID_STATUS_UNINITIALIZED;
+
+    return ESP_OK;
+}
+
+esp_err_t esp_bluedroid_enable(void)
+{
+    uhos_thread_attr_t attr = {0};
+
+    if (ESP_BLUEDROID_STATUS_INITIALIZED != g_uhos_ble_sim.bluedroid_status)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    g_uhos_ble_sim.running = UHOS_TRUE;
+    attr.name              = "ble_sim";
+    if (0 != uhos_thread_create(&g_uhos_ble_sim.thread, uhos_ble_sim_thread, UHOS_NULL, &attr))
+    {
+        g_uhos_ble_sim.running = UHOS_FALSE;
+        return ESP_FAIL;
+    }
+    g_uhos_ble_sim.bluedroid_status = ESP_BLUEDROID_STATUS_ENABLED;
+
+    return ESP_OK;
+}
+
+esp_err_t esp_bluedroid_disable(void)
+{
+    uhos_u8 i = 0;
+
+    if (ESP_BLUEDROID_STATUS_ENABLED != g_uhos_ble_sim.bluedroid_status)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    g_uhos_ble_sim.running = UHOS_FALSE;
+    uhos_ble_sim_wakeup();
+    if (uhos_thread_getid() != g_uhos_ble_sim.thread)
+    {
+        uhos_sem_wait(g_uhos_ble_sim.exit, UHOS_SEM_WAIT_FOREVER);
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_LINK_NUM; i++)
+    {
+        g_uhos_ble_sim.link[i].state = UHOS_BLE_SIM_LINK_IDLE;
+    }
+    for (i = 0; i < UHOS_BLE_SIM_APP_NUM; i++)
+    {
+        g_uhos_ble_sim.gatts_app[i] = UHOS_BLE_SIM_APP_FREE;
+        g_uhos_ble_sim.gattc_app[i] = UHOS_BLE_SIM_APP_FREE;
+    }
+    g_uhos_ble_sim.evt_head  = 0;
+    g_uhos_ble_sim.evt_count = 0;
+    uhos_ble_sim_gap_reset();
+    uhos_ble_sim_gatts_reset();
+    uhos_ble_sim_gattc_reset();
+    UHOS_BLE_SIM_UNLOCK();
+
+    g_uhos_ble_sim.bluedroid_status = ESP_BLUEDROID_STATUS_INITIALIZED;
+
+    return ESP_OK;
+}
+
+/**
+ * @brief       为一种角色注册应用并上报REG_EVT
+ * @param[in]   kind    UHOS_BLE_SIM_EVT_GATTS或UHOS_BLE_SIM_EVT_GATTC
+ */
+esp_err_t uhos_ble_sim_app_register(uhos_u8 kind, uhos_u16 app_id)
+{
+    uhos_u16 *app           = (UHOS_BLE_SIM_EVT_GATTS == kind) ? g_uhos_ble_sim.gatts_app : g_uhos_ble_sim.gattc_app;
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+    uhos_u8 i = 0;
+
+    if ((ESP_BLUEDROID_STATUS_ENABLED != g_uhos_ble_sim.bluedroid_status) || (app_id > ESP_APP_ID_MAX))
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    for (i = 0; i < UHOS_BLE_SIM_APP_NUM; i++)
+    {
+        if (UHOS_BLE_SIM_APP_FREE == app[i])
+        {
+            break;
+        }
+    }
+    if (UHOS_BLE_SIM_APP_NUM == i)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_NO_MEM;
+    }
+    app[i] = app_id;
+
+    evt = uhos_ble_sim_evt_alloc(kind, UHOS_BLE_SIM_GATT_IF_BASE + i,
+                                 (UHOS_BLE_SIM_EVT_GATTS == kind) ? ESP_GATTS_REG_EVT : ESP_GATTC_REG_EVT);
+    if (UHOS_NULL != evt)
+    {
+        // gatts与gattc的reg参数布局相同
+        evt->param.gatts.reg.status = ESP_GATT_OK;
+        evt->param.gatts.reg.app_id = app_id;
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t uhos_ble_sim_app_unregister(uhos_u8 kind, esp_gatt_if_t gatt_if)
+{
+    uhos_u16 *app = (UHOS_BLE_SIM_EVT_GATTS == kind) ? g_uhos_ble_sim.gatts_app : g_uhos_ble_sim.gattc_app;
+
+    if ((gatt_if < UHOS_BLE_SIM_GATT_IF_BASE) || (gatt_if >= UHOS_BLE_SIM_GATT_IF_BASE + UHOS_BLE_SIM_APP_NUM))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    app[gatt_if - UHOS_BLE_SIM_GATT_IF_BASE] = UHOS_BLE_SIM_APP_FREE;
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+/****************SIM-API*********************/
+uhos_ble_status_t uhos_ble_sim_config_set(const uhos_ble_sim_cfg_t *cfg)
+{
+    if (UHOS_NULL == cfg)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_sim_ctl_init();
+
+    UHOS_BLE_SIM_LOCK();
+    uhos_libc_memcpy(g_uhos_ble_sim.cfg.local_addr, cfg->local_addr, sizeof(uhos_ble_addr_t));
+    uhos_ble_sim_addr_to_bda(cfg->local_addr, g_uhos_ble_sim.local_bda);
+    g_uhos_ble_sim.cfg.conn_interval  = (0 != cfg->conn_interval) ? cfg->conn_interval : UHOS_BLE_SIM_DEF_CONN_INTERVAL;
+    g_uhos_ble_sim.cfg.pkts_per_event = (0 != cfg->pkts_per_event) ? cfg->pkts_per_event : UHOS_BLE_SIM_DEF_PKTS_PER_EVENT;
+    g_uhos_ble_sim.cfg.queue_size     = ((0 != cfg->queue_size) && (cfg->queue_size <= CONFIG_UHOS_BLE_SIM_TXQ_NUM)) ?
+                                        cfg->queue_size : CONFIG_UHOS_BLE_SIM_TXQ_NUM;
+    g_uhos_ble_sim.cfg.seed           = (0 != cfg->seed) ? cfg->seed : 1;
+    g_uhos_ble_sim.rand               = g_uhos_ble_sim.cfg.seed;
+    UHOS_BLE_SIM_UNLOCK();
+
+    return UHOS_BLE_SUCCESS;
+}
+
+uhos_ble_status_t uhos_ble_sim_peer_add(const uhos_ble_sim_peer_t *peer)
+{
+    uhos_ble_sim_peer_ctx_t *ctx = UHOS_NULL;
+    esp_bd_addr_t bda;
+    uhos_s32 idx = 0;
+    uhos_u16 i = 0;
+
+    if ((UHOS_NULL == peer) || (peer->attr_num > CONFIG_UHOS_BLE_SIM_PEER_ATTR_NUM) ||
+        ((0 != peer->attr_num) && (UHOS_NULL == peer->attrs)))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_sim_ctl_init();
+    uhos_ble_sim_addr_to_bda(peer->addr, bda);
+
+    UHOS_BLE_SIM_LOCK();
+    idx = uhos_ble_sim_peer_find(bda);
+    for (i = 0; (idx < 0) && (i < CONFIG_UHOS_BLE_SIM_PEER_NUM); i++)
+    {
+        if (!g_uhos_ble_sim.peer[i].used)
+        {
+            idx = i;
+        }
+    }
+    if (idx < 0)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return UHOS_BLE_ERROR;
+    }
+
+    ctx = &g_uhos_ble_sim.peer[idx];
+    ctx->used      = UHOS_TRUE;
+    ctx->addr_type = peer->addr_type;
+    ctx->bonded    = peer->bonded;
+    ctx->mtu       = (peer->mtu >= ESP_GATT_DEF_BLE_MTU_SIZE) ? peer->mtu : ESP_GATT_DEF_BLE_MTU_SIZE;
+    ctx->attr_num  = peer->attr_num;
+    uhos_libc_memcpy(ctx->bda, bda, ESP_BD_ADDR_LEN);
+    for (i = 0; i < peer->attr_num; i++)
+    {
+        ctx->attrs[i].type   = peer->attrs[i].type;
+        ctx->attrs[i].props  = peer->attrs[i].props;
+        ctx->attrs[i].handle = peer->attrs[i].handle;
+        ctx->attrs[i].len    = (peer->attrs[i].len > CONFIG_UHOS_BLE_SIM_ATTR_LEN) ?
+                               CONFIG_UHOS_BLE_SIM_ATTR_LEN : peer->attrs[i].len;
+        uhos_ble_sim_uuid_conv(&peer->attrs[i].uuid, &ctx->attrs[i].uuid);
+        if ((0 != ctx->attrs[i].len) && (UHOS_NULL != peer->attrs[i].value))
+        {
+            uhos_libc_memcpy(ctx->attrs[i].value, peer->attrs[i].value, ctx->attrs[i].len);
+        }
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return UHOS_BLE_SUCCESS;
+}
+
+uhos_ble_status_t uhos_ble_sim_peer_remove(const uhos_ble_addr_t addr)
+{
+    uhos_ble_sim_peer_ctx_t *peer = UHOS_NULL;
+    uhos_ble_sim_link_t *link     = UHOS_NULL;
+
+    uhos_ble_sim_ctl_init();
+
+    UHOS_BLE_SIM_LOCK();
+    link = uhos_ble_sim_link_of_addr(addr, &peer);
+    if (UHOS_NULL == peer)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return UHOS_BLE_ERROR;
+    }
+    if (UHOS_NULL != link)
+    {
+        uhos_ble_sim_link_close(link, ESP_GATT_CONN_TIMEOUT);
+    }
+    peer->used = UHOS_FALSE;
+    UHOS_BLE_SIM_UNLOCK();
+
+    return UHOS_BLE_SUCCESS;
+}
+
+void uhos_ble_sim_peer_rx_cb_set(uhos_ble_sim_peer_rx_cb_t cb)
+{
+    uhos_ble_sim_ctl_init();
+
+    UHOS_BLE_SIM_LOCK();
+    g_uhos_ble_sim.peer_rx_cb = cb;
+    UHOS_BLE_SIM_UNLOCK();
+}
+
+uhos_ble_status_t uhos_ble_sim_peer_connect(const uhos_ble_addr_t addr, uhos_u16 *conn_id)
+{
+    uhos_ble_sim_link_t *link = UHOS_NULL;
+    esp_bd_addr_t bda;
+    uhos_s32 idx = 0;
+
+    uhos_ble_sim_ctl_init();
+    uhos_ble_sim_addr_to_bda(addr, bda);
+
+    UHOS_BLE_SIM_LOCK();
+    idx = uhos_ble_sim_peer_find(bda);
+    if ((idx < 0) || !uhos_ble_sim_gap_adv_connectable())
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return UHOS_BLE_ERROR;
+    }
+
+    link = uhos_ble_sim_link_open((uhos_u8)idx, UHOS_BLE_GAP_PERIPHERAL, ESP_GATT_IF_NONE);
+    if (UHOS_NULL == link)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return UHOS_BLE_ERROR;
+    }
+    // 进入连接后控制器停止可连接广播
+    uhos_ble_sim_gap_adv_stop();
+    if (UHOS_NULL != conn_id)
+    {
+        *conn_id = uhos_ble_sim_link_id(link);
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return UHOS_BLE_SUCCESS;
+}
+
+uhos_ble_status_t uhos_ble_sim_peer_disconnect(const uhos_ble_addr_t addr)
+{
+    uhos_ble_sim_link_t *link = UHOS_NULL;
+
+    uhos_ble_sim_ctl_init();
+
+    UHOS_BLE_SIM_LOCK();
+    link = uhos_ble_sim_link_of_addr(addr, UHOS_NULL);
+    if (UHOS_NULL == link)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return UHOS_BLE_ERROR;
+    }
+    uhos_ble_sim_link_close(link, ESP_GATT_CONN_TERMINATE_PEER_USER);
+    UHOS_BLE_SIM_UNLOCK();
+
+    return UHOS_BLE_SUCCESS;
+}
+
+uhos_ble_status_t uhos_ble_sim_peer_write(const uhos_ble_addr_t addr, uhos_u16 handle, const uhos_u8 *data,
+                                          uhos_u16 len, uhos_bool need_rsp)
+{
+    return uhos_ble_sim_peer_send(addr, need_rsp ? UHOS_BLE_SIM_PDU_PEER_WRITE_REQ : UHOS_BLE_SIM_PDU_PEER_WRITE_CMD,
+                                  handle, data, len);
+}
+
+uhos_ble_status_t uhos_ble_sim_peer_read(const uhos_ble_addr_t addr, uhos_u16 handle)
+{
+    return uhos_ble_sim_peer_send(addr, UHOS_BLE_SIM_PDU_PEER_READ, handle, UHOS_NULL, 0);
+}
+
+uhos_ble_status_t uhos_ble_sim_peer_notify(const uhos_ble_addr_t addr, uhos_u16 handle, const uhos_u8 *data,
+                                           uhos_u16 len, uhos_bool is_notify)
+{
+    return uhos_ble_sim_peer_send(addr, is_notify ? UHOS_BLE_SIM_PDU_PEER_NOTIFY : UHOS_BLE_SIM_PDU_PEER_INDICATE,
+                                  handle, data, len);
+}
+
+uhos_ble_status_t uhos_ble_sim_peer_mtu_exchange(const uhos_ble_addr_t addr, uhos_u16 mtu)
+{
+    uhos_u8 data[2] = {(uhos_u8)mtu, (uhos_u8)(mtu >> 8)};
+
+    if (mtu < ESP_GATT_DEF_BLE_MTU_SIZE)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    return uhos_ble_sim_peer_send(addr, UHOS_BLE_SIM_PDU_PEER_MTU_REQ, 0, data, sizeof(data));
+}
+
+uhos_ble_status_t uhos_ble_sim_peer_attr_set(const uhos_ble_addr_t addr, uhos_u16 handle, const uhos_u8 *data,
+                                             uhos_u16 len)
+{
+    uhos_ble_sim_peer_ctx_t *peer  = UHOS_NULL;
+    uhos_ble_sim_peer_attr_t *attr = UHOS_NULL;
+
+    if ((len > CONFIG_UHOS_BLE_SIM_ATTR_LEN) || ((0 != len) && (UHOS_NULL == data)))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_sim_ctl_init();
+
+    UHOS_BLE_SIM_LOCK();
+    uhos_ble_sim_link_of_addr(addr, &peer);
+    attr = (UHOS_NULL != peer) ? uhos_ble_sim_peer_attr_find(peer, handle) : UHOS_NULL;
+    if (UHOS_NULL == attr)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return UHOS_BLE_ERROR;
+    }
+    uhos_libc_memcpy(attr->value, data, len);
+    attr->len = len;
+    UHOS_BLE_SIM_UNLOCK();
+
+    return UHOS_BLE_SUCCESS;
+}
+
+uhos_ble_status_t uhos_ble_sim_peer_service_changed(const uhos_ble_addr_t addr)
+{
+    uhos_ble_sim_peer_ctx_t *peer = UHOS_NULL;
+    uhos_ble_sim_link_t *link     = UHOS_NULL;
+    uhos_ble_sim_evt_t *evt       = UHOS_NULL;
+
+    uhos_ble_sim_ctl_init();
+
+    UHOS_BLE_SIM_LOCK();
+    link = uhos_ble_sim_link_of_addr(addr, &peer);
+    if (UHOS_NULL == peer)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return UHOS_BLE_ERROR;
+    }
+    if ((UHOS_NULL != link) && (UHOS_BLE_SIM_LINK_CONNECTED == link->state))
+    {
+        link->searched = UHOS_FALSE;
+        evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTC, ESP_GATT_IF_NONE, ESP_GATTC_SRVC_CHG_EVT);
+        if (UHOS_NULL != evt)
+        {
+            uhos_libc_memcpy(evt->param.gattc.srvc_chg.remote_bda, peer->bda, ESP_BD_ADDR_LEN);
+        }
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return UHOS_BLE_SUCCESS;
+}
+
+uhos_ble_status_t uhos_ble_sim_link_get(const uhos_ble_addr_t addr, uhos_ble_sim_link_info_t *info)
+{
+    uhos_ble_sim_link_t *link = UHOS_NULL;
+
+    if (UHOS_NULL == info)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_sim_ctl_init();
+
+    UHOS_BLE_SIM_LOCK();
+    link = uhos_ble_sim_link_of_addr(addr, UHOS_NULL);
+    if ((UHOS_NULL == link) || (UHOS_BLE_SIM_LINK_CONNECTED != link->state))
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return UHOS_BLE_ERROR;
+    }
+    link->info.conn_interval = link->interval;
+    link->info.latency       = link->latency;
+    link->info.timeout       = link->timeout;
+    link->info.mtu           = link->mtu;
+    link->info.ll_payload    = link->ll_payload;
+    uhos_libc_memcpy(info, &link->info, sizeof(uhos_ble_sim_link_info_t));
+    UHOS_BLE_SIM_UNLOCK();
+
+    return UHOS_BLE_SUCCESS;
+}
+
+uhos_ble_status_t uhos_ble_sim_stats_get(uhos_ble_sim_stats_t *stats)
+{
+    if (UHOS_NULL == stats)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_sim_ctl_init();
+
+    UHOS_BLE_SIM_LOCK();
+    uhos_libc_memcpy(stats, &g_uhos_ble_sim.stats, sizeof(uhos_ble_sim_stats_t));
+    UHOS_BLE_SIM_UNLOCK();
+
+    return UHOS_BLE_SUCCESS;
+}
+
+void uhos_ble_sim_stats_reset(void)
+{
+    uhos_ble_sim_link_t *link = UHOS_NULL;
+    uhos_u8 i = 0;
+
+    uhos_ble_sim_ctl_init();
+
+    UHOS_BLE_SIM_LOCK();
+    uhos_libc_memset(&g_uhos_ble_sim.stats, 0, sizeof(uhos_ble_sim_stats_t));
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_LINK_NUM; i++)
+    {
+        link = &g_uhos_ble_sim.link[i];
+        link->info.conn_events = 0;
+        link->info.tx_pdus     = 0;
+        link->info.tx_bytes    = 0;
+        link->info.rx_pdus     = 0;
+        link->info.rx_bytes    = 0;
+        link->info.tx_full     = 0;
+    }
+    UHOS_BLE_SIM_UNLOCK();
+}
@@ -0,0 +1,537 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_sim_frag_test.c
+ * @author agent (agent@local)
+ * @brief BLE模拟器：分片通道的重组、乱序与丢片测试
+ * @details 虚拟对端连接本端的可连接广播，本端通过notify分片发送多条消息，对端收到的分片原样保存；
+ *          再把保存的分片按原顺序、交换顺序、缺片等方式送入接收通道，检查重组结果与错误统计。
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：BLE模拟器：分片通道的重组、乱序与丢片测试
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>输出改用uh_bench.h
+ * </table>
+ */
+
+#define LOG_TAG "ble_sim_frag"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_osal.h"
+#include "uh_bench.h"
+#include "uh_ble.h"
+#include "uh_ble_frag.h"
+#include "uh_ble_sim.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define UHOS_BLE_SIM_FRAG_TEST_HANDLE       0x0012      //<! 对端特征值句柄
+#define UHOS_BLE_SIM_FRAG_TEST_MTU          247         //<! 交换的MTU
+#define UHOS_BLE_SIM_FRAG_TEST_CHUNK_NUM    128         //<! 最多保存的分片数
+#define UHOS_BLE_SIM_FRAG_TEST_CHUNK_LEN    244         //<! 单个分片的最大长度
+#define UHOS_BLE_SIM_FRAG_TEST_WAIT_MS      2000        //<! 等待连接、分片送达与发送完成的最长时间
+#define UHOS_BLE_SIM_FRAG_TEST_CHAR_PROPS   0x1C        //<! 写命令|写请求|通知
+#define UHOS_BLE_SIM_FRAG_TEST_JSON_LEN     256         //<! JSON行的最大长度
+#define UHOS_BLE_SIM_FRAG_TEST_LONG_MSG     3           //<! 用于乱序与丢片用例的消息序号
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      对端收到的一个分片
+ */
+typedef struct uhos_ble_sim_frag_chunk
+{
+    uhos_u16 len;                                               //<! 分片长度
+    uhos_u8  data[UHOS_BLE_SIM_FRAG_TEST_CHUNK_LEN];            //<! 分片数据（含分片头）
+} uhos_ble_sim_frag_chunk_t;
+
+/**
+ * @struct      测试状态
+ */
+typedef struct uhos_ble_sim_frag_test
+{
+    volatile uhos_u16         chunk_num;                        //<! 已保存的分片数
+    uhos_ble_sim_frag_chunk_t chunks[UHOS_BLE_SIM_FRAG_TEST_CHUNK_NUM];   //<! 对端收到的分片
+} uhos_ble_sim_frag_test_t;
+
+/**
+ * @struct      一个用例的结果
+ */
+typedef struct uhos_ble_sim_frag_case
+{
+    const uhos_char *name;                                      //<! 用例名称
+    uhos_bool        ok;                                        //<! 是否通过
+    uhos_u32         msgs;                                      //<! 重组完成的消息数
+    uhos_u32         rx_errors;                                 //<! 接收通道统计的错误数
+    const uhos_char *reason;                                    //<! 失败原因
+} uhos_ble_sim_frag_case_t;
+
+/**************************************************************************************************/
+/*                                          内部全局变量                                          */
+/**************************************************************************************************/
+static uhos_ble_sim_frag_test_t g_uhos_ble_sim_frag_test;
+
+static const uhos_ble_addr_t g_uhos_ble_sim_frag_peer = {0xF0, 0x11, 0x22, 0x33, 0x44, 0xC0};
+
+// 消息长度：单片、恰好占满首片、跨两片、多片、重组上限；总分片数超过序号模64
+static const uhos_u16 g_uhos_ble_sim_frag_msg_lens[] = {1, 241, 242, 3000, 5000, 8192};
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       对端收到数据：保存本端发送的分片
+ */
+static void uhos_ble_sim_frag_test_peer_rx(const uhos_u8 *addr, uhos_ble_sim_peer_rx_t type, uhos_u16 handle,
+                                           const uhos_u8 *data, uhos_u16 len)
+{
+    uhos_ble_sim_frag_test_t *ctx = &g_uhos_ble_sim_frag_test;
+    uhos_u16 idx = ctx->chunk_num;
+
+    if ((UHOS_BLE_SIM_PEER_RX_NOTIFY != type) || (UHOS_BLE_SIM_FRAG_TEST_HANDLE != handle) ||
+        (0 != uhos_libc_memcmp(addr, g_uhos_ble_sim_frag_peer, sizeof(uhos_ble_addr_t))) ||
+        (idx >= UHOS_BLE_SIM_FRAG_TEST_CHUNK_NUM) || (len > UHOS_BLE_SIM_FRAG_TEST_CHUNK_LEN))
+    {
+        return;
+    }
+
+    ctx->chunks[idx].len = len;
+    uhos_libc_memcpy(ctx->chunks[idx].data, data, len);
+    __atomic_store_n(&ctx->chunk_num, idx + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief       生成第n条消息的内容
+ */
+static void uhos_ble_sim_frag_test_fill(uhos_u8 *buf, uhos_u16 len, uhos_u8 n)
+{
+    uhos_u16 i = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        buf[i] = (uhos_u8)(i * 7 + n * 31 + (i >> 8));
+    }
+}
+
+/**
+ * @brief       新建虚拟对端，由对端连接本端广播，本端发起MTU交换
+ * @param[out]  conn_id 连接ID
+ * @return      uhos_ble_status_t 执行结果
+ */
+static uhos_ble_status_t uhos_ble_sim_frag_test_connect(uhos_u16 *conn_id)
+{
+    static const uhos_u8 adv_data[] = {0x02, 0x01, 0x06};
+    uhos_ble_sim_attr_t      attrs[2];
+    uhos_ble_sim_peer_t      peer;
+    uhos_ble_gap_adv_param_t adv_param;
+    uhos_ble_sim_link_info_t info;
+    uhos_u16                 mtu    = 0;
+    uhos_u32                 waited = 0;
+
+    uhos_libc_memset(attrs, 0, sizeof(attrs));
+    attrs[0].type        = UHOS_BLE_SIM_ATTR_SERVICE;
+    attrs[0].handle      = UHOS_BLE_SIM_FRAG_TEST_HANDLE - 2;
+    attrs[0].uuid.type   = UHOS_BLE_UUID_TYPE_16;
+    attrs[0].uuid.uuid16 = 0xFFF0;
+    attrs[1].type        = UHOS_BLE_SIM_ATTR_CHAR;
+    attrs[1].handle      = UHOS_BLE_SIM_FRAG_TEST_HANDLE;
+    attrs[1].uuid.type   = UHOS_BLE_UUID_TYPE_16;
+    attrs[1].uuid.uuid16 = 0xFFF1;
+    attrs[1].props       = UHOS_BLE_SIM_FRAG_TEST_CHAR_PROPS;
+
+    uhos_libc_memset(&peer, 0, sizeof(peer));
+    uhos_libc_memcpy(peer.addr, g_uhos_ble_sim_frag_peer, sizeof(uhos_ble_addr_t));
+    peer.mtu      = UHOS_BLE_SIM_FRAG_TEST_MTU;
+    peer.attrs    = attrs;
+    peer.attr_num = 2;
+
+    uhos_ble_sim_peer_remove(g_uhos_ble_sim_frag_peer);
+    if (UHOS_BLE_SUCCESS != uhos_ble_sim_peer_add(&peer))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_libc_memset(&adv_param, 0, sizeof(adv_param));
+    adv_param.adv_interval_min = 0x20;
+    adv_param.adv_interval_max = 0x20;
+    adv_param.adv_type         = UHOS_BLE_ADV_TYPE_CONNECTABLE_UNDIRECTED;
+    uhos_ble_gap_adv_data_set(adv_data, sizeof(adv_data), UHOS_NULL, 0);
+    if ((UHOS_BLE_SUCCESS != uhos_ble_gap_adv_start(&adv_param)) ||
+        (UHOS_BLE_SUCCESS != uhos_ble_sim_peer_connect(g_uhos_ble_sim_frag_peer, UHOS_NULL)))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    for (waited = 0; waited < UHOS_BLE_SIM_FRAG_TEST_WAIT_MS; waited += 10)
+    {
+        if ((UHOS_BLE_SUCCESS == uhos_ble_sim_link_get(g_uhos_ble_sim_frag_peer, &info)) &&
+            (UHOS_BLE_SUCCESS == uhos_ble_gatts_mtu_get(info.conn_id, &mtu)))
+        {
+            break;
+        }
+        uhos_thread_sleep(10);
+    }
+    if (waited >= UHOS_BLE_SIM_FRAG_TEST_WAIT_MS)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    *conn_id = info.conn_id;
+
+    uhos_ble_gattc_exchange_mtu(*conn_id, UHOS_BLE_SIM_FRAG_TEST_MTU);
+    for (; waited < UHOS_BLE_SIM_FRAG_TEST_WAIT_MS; waited += 10)
+    {
+        if ((UHOS_BLE_SUCCESS == uhos_ble_gatts_mtu_get(*conn_id, &mtu)) && (UHOS_BLE_SIM_FRAG_TEST_MTU == mtu))
+        {
+            return UHOS_BLE_SUCCESS;
+        }
+        uhos_thread_sleep(10);
+    }
+
+    return UHOS_BLE_ERROR;
+}
+
+/**
+ * @brief       断开虚拟对端并等待AL层删除连接
+ */
+static void uhos_ble_sim_frag_test_disconnect(uhos_u16 conn_id)
+{
+    uhos_ble_conn_stats_t stats;
+    uhos_u32              waited = 0;
+
+    uhos_ble_sim_peer_remove(g_uhos_ble_sim_frag_peer);
+    uhos_ble_gap_adv_stop();
+
+    while ((waited < UHOS_BLE_SIM_FRAG_TEST_WAIT_MS) &&
+           (UHOS_BLE_SUCCESS == uhos_ble_gatts_conn_stats_get(conn_id, &stats)))
+    {
+        uhos_thread_sleep(10);
+        waited += 10;
+    }
+}
+
+/**
+ * @brief       分片发送各条消息，等待对端收齐且协议栈上报全部发送完成
+ * @param[out]  first   每条消息的首个分片在保存数组中的序号，最后一项为分片总数
+ * @return      UHOS_TRUE-成功
+ */
+static uhos_bool uhos_ble_sim_frag_test_send(uhos_ble_frag_t *tx, uhos_u8 *buf, uhos_u16 *first,
+                                             uhos_ble_sim_frag_case_t *tc)
+{
+    uhos_ble_sim_frag_test_t *ctx   = &g_uhos_ble_sim_frag_test;
+    uhos_ble_frag_stats_t     stats = {0};
+    uhos_u32                  waited = 0;
+    uhos_u8                   n     = 0;
+
+    for (n = 0; n < sizeof(g_uhos_ble_sim_frag_msg_lens) / sizeof(g_uhos_ble_sim_frag_msg_lens[0]); n++)
+    {
+        first[n] = __atomic_load_n(&ctx->chunk_num, __ATOMIC_ACQUIRE);
+
+        uhos_ble_sim_frag_test_fill(buf, g_uhos_ble_sim_frag_msg_lens[n], n);
+        if (UHOS_BLE_SUCCESS != uhos_ble_frag_send(tx, buf, g_uhos_ble_sim_frag_msg_lens[n], UHOS_BLE_SIM_FRAG_TEST_WAIT_MS))
+        {
+            tc->reason = "send";
+            return UHOS_FALSE;
+        }
+
+        // 等待本条消息的分片全部送达对端，再发送下一条，保证按消息划分保存的分片
+        for (waited = 0; waited < UHOS_BLE_SIM_FRAG_TEST_WAIT_MS; waited += 5)
+        {
+            uhos_ble_frag_stats_get(tx, &stats);
+            if ((__atomic_load_n(&ctx->chunk_num, __ATOMIC_ACQUIRE) >= stats.tx_chunks) &&
+                (stats.tx_confirmed == stats.tx_chunks))
+            {
+                break;
+            }
+            uhos_thread_sleep(5);
+        }
+        if (waited >= UHOS_BLE_SIM_FRAG_TEST_WAIT_MS)
+        {
+            tc->reason = "tx_done";
+            return UHOS_FALSE;
+        }
+    }
+
+    first[n] = ctx->chunk_num;
+
+    return UHOS_TRUE;
+}
+
+/**
+ * @brief       把保存的分片[from, to)依次送入接收通道，跳过序号为skip的分片
+ * @return      最后一个分片的输入结果
+ */
+static uhos_ble_status_t uhos_ble_sim_frag_test_feed(uhos_ble_frag_t *rx, uhos_u16 from, uhos_u16 to, uhos_u16 skip,
+                                                     const uhos_u8 **msg, uhos_u16 *msg_len)
+{
+    uhos_ble_sim_frag_test_t *ctx    = &g_uhos_ble_sim_frag_test;
+    uhos_ble_status_t         status = UHOS_BLE_ERROR;
+    uhos_u16                  i      = 0;
+
+    for (i = from; i < to; i++)
+    {
+        if (i != skip)
+        {
+            status = uhos_ble_frag_input(rx, ctx->chunks[i].data, ctx->chunks[i].len, msg, msg_len);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief       检查重组出的消息是否为第n条消息
+ */
+static uhos_bool uhos_ble_sim_frag_test_check(const uhos_u8 *msg, uhos_u16 msg_len, uhos_u8 n, uhos_u8 *buf)
+{
+    if (msg_len != g_uhos_ble_sim_frag_msg_lens[n])
+    {
+        return UHOS_FALSE;
+    }
+
+    uhos_ble_sim_frag_test_fill(buf, msg_len, n);
+
+    return (0 == uhos_libc_memcmp(msg, buf, msg_len)) ? UHOS_TRUE : UHOS_FALSE;
+}
+
+/**
+ * @brief       用例：按原顺序重组全部消息
+ */
+static void uhos_ble_sim_frag_test_reassembly(const uhos_u16 *first, uhos_u8 *buf, uhos_ble_sim_frag_case_t *tc)
+{
+    uhos_ble_frag_t       rx;
+    uhos_ble_frag_stats_t stats   = {0};
+    const uhos_u8        *msg     = UHOS_NULL;
+    uhos_u16              msg_len = 0;
+    uhos_u8               n       = 0;
+
+    uhos_ble_frag_init(&rx, UHOS_BLE_FRAG_LINK_NOTIFY, 0xFFFF, 0, UHOS_BLE_SIM_FRAG_TEST_HANDLE, 0);
+
+    tc->ok = UHOS_TRUE;
+    for (n = 0; n < sizeof(g_uhos_ble_sim_frag_msg_lens) / sizeof(g_uhos_ble_sim_frag_msg_lens[0]); n++)
+    {
+        if ((UHOS_BLE_SUCCESS != uhos_ble_sim_frag_test_feed(&rx, first[n], first[n + 1], 0xFFFF, &msg, &msg_len)) ||
+            !uhos_ble_sim_frag_test_check(msg, msg_len, n, buf))
+        {
+            tc->ok     = UHOS_FALSE;
+            tc->reason = "content";
+            break;
+        }
+    }
+
+    uhos_ble_frag_stats_get(&rx, &stats);
+    tc->msgs      = stats.rx_msgs;
+    tc->rx_errors = stats.rx_errors;
+    if (tc->ok && stats.rx_errors)
+    {
+        tc->ok     = UHOS_FALSE;
+        tc->reason = "rx_errors";
+    }
+
+    uhos_ble_frag_deinit(&rx);
+}
+
+/**
+ * @brief       用例：交换相邻两个分片，当前消息被丢弃，之后的完整消息正常重组
+ */
+static void uhos_ble_sim_frag_test_out_of_order(const uhos_u16 *first, uhos_u8 *buf, uhos_ble_sim_frag_case_t *tc)
+{
+    uhos_ble_sim_frag_test_t *ctx     = &g_uhos_ble_sim_frag_test;
+    uhos_ble_frag_t           rx;
+    uhos_ble_frag_stats_t     stats   = {0};
+    const uhos_u8            *msg     = UHOS_NULL;
+    uhos_u16                  msg_len = 0;
+    uhos_u16                  from    = first[UHOS_BLE_SIM_FRAG_TEST_LONG_MSG];
+    uhos_u16                  to      = first[UHOS_BLE_SIM_FRAG_TEST_LONG_MSG + 1];
+    uhos_ble_status_t         swapped = UHOS_BLE_SUCCESS;
+
+    uhos_ble_frag_init(&rx, UHOS_BLE_FRAG_LINK_NOTIFY, 0xFFFF, 0, UHOS_BLE_SIM_FRAG_TEST_HANDLE, 0);
+
+    // 首片、第2片、第1片、其余分片
+    uhos_ble_frag_input(&rx, ctx->chunks[from].data, ctx->chunks[from].len, &msg, &msg_len);
+    swapped = uhos_ble_frag_input(&rx, ctx->chunks[from + 2].data, ctx->chunks[from + 2].len, &msg, &msg_len);
+    uhos_ble_frag_input(&rx, ctx->chunks[from + 1].data, ctx->chunks[from + 1].len, &msg, &msg_len);
+    uhos_ble_sim_frag_test_feed(&rx, from + 3, to, 0xFFFF, &msg, &msg_len);
+
+    uhos_ble_frag_stats_get(&rx, &stats);
+    if ((UHOS_BLE_ERROR != swapped) || stats.rx_msgs || (0 == stats.rx_errors))
+    {
+        tc->reason = "accepted";
+    }
+    else if ((UHOS_BLE_SUCCESS != uhos_ble_sim_frag_test_feed(&rx, from, to, 0xFFFF, &msg, &msg_len)) ||
+             !uhos_ble_sim_frag_test_check(msg, msg_len, UHOS_BLE_SIM_FRAG_TEST_LONG_MSG, buf))
+    {
+        tc->reason = "recover";
+    }
+    else
+    {
+        tc->ok = UHOS_TRUE;
+    }
+
+    uhos_ble_frag_stats_get(&rx, &stats);
+    tc->msgs      = stats.rx_msgs;
+    tc->rx_errors = stats.rx_errors;
+
+    uhos_ble_frag_deinit(&rx);
+}
+
+/**
+ * @brief       用例：丢失中间分片、末片、首片，当前消息均被丢弃，之后的完整消息正常重组
+ */
+static void uhos_ble_sim_frag_test_loss(const uhos_u16 *first, uhos_u8 *buf, uhos_ble_sim_frag_case_t *tc)
+{
+    uhos_ble_frag_t       rx;
+    uhos_ble_frag_stats_t stats   = {0};
+    const uhos_u8        *msg     = UHOS_NULL;
+    uhos_u16              msg_len = 0;
+    uhos_u16              from    = first[UHOS_BLE_SIM_FRAG_TEST_LONG_MSG];
+    uhos_u16              to      = first[UHOS_BLE_SIM_FRAG_TEST_LONG_MSG + 1];
+    uhos_u16              skips[3];
+    uhos_u8               i       = 0;
+
+    skips[0] = from + (to - from) / 2;
+    skips[1] = to - 1;
+    skips[2] = from;
+
+    uhos_ble_frag_init(&rx, UHOS_BLE_FRAG_LINK_NOTIFY, 0xFFFF, 0, UHOS_BLE_SIM_FRAG_TEST_HANDLE, 0);
+
+    tc->ok = UHOS_TRUE;
+    for (i = 0; i < 3; i++)
+    {
+        if ((UHOS_BLE_SUCCESS == uhos_ble_sim_frag_test_feed(&rx, from, to, skips[i], &msg, &msg_len)) ||
+            (UHOS_BLE_SUCCESS != uhos_ble_sim_frag_test_feed(&rx, from, to, 0xFFFF, &msg, &msg_len)) ||
+            !uhos_ble_sim_frag_test_check(msg, msg_len, UHOS_BLE_SIM_FRAG_TEST_LONG_MSG, buf))
+        {
+            tc->ok     = UHOS_FALSE;
+            tc->reason = (0 == i) ? "middle" : ((1 == i) ? "last" : "first");
+            break;
+        }
+    }
+
+    uhos_ble_frag_stats_get(&rx, &stats);
+    tc->msgs      = stats.rx_msgs;
+    tc->rx_errors = stats.rx_errors;
+
+    // 每次丢片都应计入错误：丢末片时由下一个首片计入
+    if (tc->ok && ((3 != stats.rx_msgs) || (stats.rx_errors < 3)))
+    {
+        tc->ok     = UHOS_FALSE;
+        tc->reason = "stats";
+    }
+
+    uhos_ble_frag_deinit(&rx);
+}
+
+static void uhos_ble_sim_frag_test_print(uhos_bench_print_t print, const uhos_ble_sim_frag_case_t *tc,
+                                         uhos_u32 chunks, uhos_u32 goodput)
+{
+    uhos_char         line[UHOS_BLE_SIM_FRAG_TEST_JSON_LEN];
+    uhos_bench_json_t json = {0};
+
+    uhos_bench_json_begin(&json, line, sizeof(line));
+    uhos_bench_json_str(&json, "case", tc->name);
+    uhos_bench_json_status(&json, tc->ok ? 0 : -1);
+    uhos_bench_json_str(&json, "reason", tc->reason);
+    uhos_bench_json_u32(&json, "msgs", tc->msgs);
+    uhos_bench_json_u32(&json, "rx_errors", tc->rx_errors);
+    uhos_bench_json_u32(&json, "chunks", chunks);
+    uhos_bench_json_u32(&json, "goodput_bps", goodput);
+    uhos_bench_json_end(&json);
+    print(line);
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_ble_status_t uhos_ble_sim_frag_test_run(uhos_bench_print_t print)
+{
+    uhos_ble_sim_frag_test_t *ctx     = &g_uhos_ble_sim_frag_test;
+    uhos_ble_sim_frag_case_t  cases[3];
+    uhos_u16                  first[sizeof(g_uhos_ble_sim_frag_msg_lens) / sizeof(g_uhos_ble_sim_frag_msg_lens[0]) + 1];
+    uhos_ble_frag_t           tx;
+    uhos_ble_frag_stats_t     stats   = {0};
+    uhos_ble_status_t         ret     = UHOS_BLE_SUCCESS;
+    uhos_u8                  *buf     = UHOS_NULL;
+    uhos_u16                  conn_id = 0;
+    uhos_u8                   i       = 0;
+
+    if (UHOS_NULL == print)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    buf = uhos_libc_malloc(8192);
+    if (UHOS_NULL == buf)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_libc_memset(cases, 0, sizeof(cases));
+    cases[0].name = "reassembly";
+    cases[1].name = "out_of_order";
+    cases[2].name = "loss";
+
+    ctx->chunk_num = 0;
+    uhos_ble_sim_peer_rx_cb_set(uhos_ble_sim_frag_test_peer_rx);
+
+    if (UHOS_BLE_SUCCESS != uhos_ble_sim_frag_test_connect(&conn_id))
+    {
+        cases[0].reason = "connect";
+        uhos_ble_sim_frag_test_print(print, &cases[0], 0, 0);
+        uhos_ble_sim_frag_test_disconnect(conn_id);
+        uhos_ble_sim_peer_rx_cb_set(UHOS_NULL);
+        uhos_libc_free(buf);
+        return UHOS_BLE_ERROR;
+    }
+
+    if (UHOS_BLE_SUCCESS != uhos_ble_frag_init(&tx, UHOS_BLE_FRAG_LINK_NOTIFY, conn_id, 0, UHOS_BLE_SIM_FRAG_TEST_HANDLE, 0))
+    {
+        cases[0].reason = "init";
+    }
+    else
+    {
+        if (uhos_ble_sim_frag_test_send(&tx, buf, first, &cases[0]))
+        {
+            uhos_ble_sim_frag_test_reassembly(first, buf, &cases[0]);
+            uhos_ble_sim_frag_test_out_of_order(first, buf, &cases[1]);
+            uhos_ble_sim_frag_test_loss(first, buf, &cases[2]);
+        }
+
+        uhos_ble_frag_stats_get(&tx, &stats);
+        uhos_ble_frag_deinit(&tx);
+    }
+
+    uhos_ble_sim_frag_test_disconnect(conn_id);
+    uhos_ble_sim_peer_rx_cb_set(UHOS_NULL);
+
+    // 发送完成事件已全部到达时，吞吐率按最后一个分片完成的时间计算，不应为0
+    if (cases[0].ok && (0 == stats.goodput_bps))
+    {
+        cases[0].ok     = UHOS_FALSE;
+        cases[0].reason = "goodput";
+    }
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        if (!cases[i].ok && (UHOS_NULL == cases[i].reason))
+        {
+            cases[i].reason = "skipped";
+        }
+        uhos_ble_sim_frag_test_print(print, &cases[i], stats.tx_chunks, (0 == i) ? stats.goodput_bps : 0);
+        if (!cases[i].ok)
+        {
+            ret = UHOS_BLE_ERROR;
+        }
+    }
+
+    uhos_libc_free(buf);
+
+    return ret;
+}
@@ -0,0 +1,1348 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_sim_gap.c
+ * @author agent (agent@local)
+ * @brief BLE模拟器：GAP（广播、扫描、白名单、连接参数）
+ * @details 虚拟广播者按interval_ms + advDelay(0~10ms)周期广播；扫描时仅当广播时刻落在
+ *          扫描窗口内(now - scan_start) % scan_interval < scan_window才上报，否则计为错过。
+ *          主动扫描且广播者设置了扫描响应时，紧随广播上报一个ESP_BLE_EVT_SCAN_RSP类型的结果。
+ *          扩展扫描时，传统广播者以LEGACY事件类型上报；扩展广播者的载荷按每段不超过229字节
+ *          拆成广播链，相邻分段间隔UHOS_BLE_SIM_AUX_OFFSET_US，不同广播者的分段可能交错。
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：BLE模拟器：GAP（广播、扫描、白名单、连接参数）
+ * </table>
+ */
+
+#define LOG_TAG "ble_sim_gap"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_ble_sim_ctrl.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define UHOS_BLE_SIM_ADV_DELAY_MAX_MS       10          //<! advDelay的上限
+#define UHOS_BLE_SIM_CONN_UPD_EVENTS        6           //<! 连接参数更新在第几个连接事件后生效（instant）
+#define UHOS_BLE_SIM_RSSI                   (-50)       //<! 已连接链路读取到的信号强度
+#define UHOS_BLE_SIM_AUX_OFFSET_US          1000        //<! 广播链相邻分段（AUX_CHAIN_IND）的间隔
+#define UHOS_BLE_SIM_HCI_ADV_TIMEOUT        0x3C        //<! HCI错误码：Advertising Timeout
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      虚拟广播者
+ */
+typedef struct uhos_ble_sim_adv_ctx
+{
+    uhos_bool          used;
+    uhos_bool          reported;                                //<! 本次扫描中已上报（过滤重复时使用）
+    esp_bd_addr_t      bda;                                     //<! 协议栈字节序的地址
+    uhos_u64           next_us;                                 //<! 下一次广播的时刻
+    uhos_bool          chain;                                   //<! 扩展广播的广播链正在上报
+    uhos_u16           chain_off;                               //<! 广播链下一段的偏移
+    uhos_u64           chain_us;                                //<! 广播链下一段的时刻
+    uhos_ble_sim_adv_t adv;
+} uhos_ble_sim_adv_ctx_t;
+
+/**
+ * @struct      本端扩展广播集
+ */
+typedef struct uhos_ble_sim_ext_adv_set
+{
+    uhos_bool                    params_set;                    //<! 已设置参数
+    uhos_bool                    enabled;                       //<! 正在广播
+    esp_ble_gap_ext_adv_params_t params;
+    uhos_u16                     data_len;
+    uhos_u16                     rsp_len;
+    uhos_u64                     end_us;                        //<! 广播结束时刻，0表示一直广播
+} uhos_ble_sim_ext_adv_set_t;
+
+/**
+ * @struct      白名单项
+ */
+typedef struct uhos_ble_sim_wl_item
+{
+    esp_bd_addr_t bda;
+    uhos_u8       type;
+} uhos_ble_sim_wl_item_t;
+
+/**
+ * @struct      GAP状态
+ */
+typedef struct uhos_ble_sim_gap_ctl
+{
+    uhos_ble_sim_adv_ctx_t adv[CONFIG_UHOS_BLE_SIM_ADV_NUM];
+
+    esp_ble_scan_params_t  scan_params;
+    uhos_bool              scan_params_set;
+    uhos_bool              scanning;
+    uhos_u64               scan_start_us;
+    uhos_u64               scan_end_us;                         //<! 0表示持续扫描
+    uhos_bool              ext_scan;                            //<! 当前为扩展扫描
+    esp_ble_ext_scan_params_t ext_scan_params;
+    uhos_bool              ext_scan_params_set;
+
+    uhos_bool              advertising;
+    esp_ble_adv_params_t   adv_params;
+    uhos_u8                adv_data[ESP_BLE_ADV_DATA_LEN_MAX];
+    uhos_u8                adv_data_len;
+    uhos_u8                rsp_data[ESP_BLE_SCAN_RSP_DATA_LEN_MAX];
+    uhos_u8                rsp_data_len;
+
+    uhos_ble_sim_ext_adv_set_t ext_adv[CONFIG_UHOS_BLE_SIM_EXT_ADV_SET_NUM];
+
+    uhos_ble_sim_wl_item_t wl[CONFIG_UHOS_BLE_SIM_WL_NUM];
+    uhos_u8                wl_num;
+} uhos_ble_sim_gap_ctl_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_ble_sim_gap_ctl_t g_uhos_ble_sim_gap;
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       上报一个只带状态的GAP完成事件，所有*_cmpl参数的第一个成员均为status
+ */
+static void uhos_ble_sim_gap_status_evt(esp_gap_ble_cb_event_t event, esp_bt_status_t status)
+{
+    uhos_ble_sim_evt_t *evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GAP, ESP_GATT_IF_NONE, event);
+
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gap.adv_data_cmpl.status = status;
+    }
+}
+
+static uhos_bool uhos_ble_sim_gap_wl_contains(const esp_bd_addr_t bda)
+{
+    uhos_u8 i = 0;
+
+    for (i = 0; i < g_uhos_ble_sim_gap.wl_num; i++)
+    {
+        if (0 == uhos_libc_memcmp(g_uhos_ble_sim_gap.wl[i].bda, bda, ESP_BD_ADDR_LEN))
+        {
+            return UHOS_TRUE;
+        }
+    }
+
+    return UHOS_FALSE;
+}
+
+/**
+ * @brief       白名单正在被扫描使用时控制器拒绝修改
+ */
+static uhos_bool uhos_ble_sim_gap_wl_in_use(void)
+{
+    esp_ble_scan_filter_t policy = g_uhos_ble_sim_gap.ext_scan ? g_uhos_ble_sim_gap.ext_scan_params.filter_policy :
+                                                                 g_uhos_ble_sim_gap.scan_params.scan_filter_policy;
+
+    return (g_uhos_ble_sim_gap.scanning && (BLE_SCAN_FILTER_ALLOW_ONLY_WLST == policy));
+}
+
+static void uhos_ble_sim_gap_report(const uhos_ble_sim_adv_ctx_t *ctx, uhos_bool is_rsp)
+{
+    uhos_ble_sim_evt_t *evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GAP, ESP_GATT_IF_NONE, ESP_GAP_BLE_SCAN_RESULT_EVT);
+
+    if (UHOS_NULL == evt)
+    {
+        return;
+    }
+
+    evt->param.gap.scan_rst.search_evt    = ESP_GAP_SEARCH_INQ_RES_EVT;
+    evt->param.gap.scan_rst.dev_type      = ESP_BT_DEVICE_TYPE_BLE;
+    evt->param.gap.scan_rst.ble_addr_type = (esp_ble_addr_type_t)ctx->adv.addr_type;
+    evt->param.gap.scan_rst.rssi          = ctx->adv.rssi;
+    evt->param.gap.scan_rst.num_resps     = 1;
+    uhos_libc_memcpy(evt->param.gap.scan_rst.bda, ctx->bda, ESP_BD_ADDR_LEN);
+
+    if (is_rsp)
+    {
+        evt->param.gap.scan_rst.ble_evt_type = ESP_BLE_EVT_SCAN_RSP;
+        evt->param.gap.scan_rst.scan_rsp_len = ctx->adv.rsp_len;
+        uhos_libc_memcpy(evt->param.gap.scan_rst.ble_adv, ctx->adv.rsp, ctx->adv.rsp_len);
+        g_uhos_ble_sim.stats.rsp_reports++;
+    }
+    else
+    {
+        evt->param.gap.scan_rst.ble_evt_type = ctx->adv.connectable ? ESP_BLE_EVT_CONN_ADV : ESP_BLE_EVT_NON_CONN_ADV;
+        evt->param.gap.scan_rst.adv_data_len = ctx->adv.data_len;
+        uhos_libc_memcpy(evt->param.gap.scan_rst.ble_adv, ctx->adv.data, ctx->adv.data_len);
+        g_uhos_ble_sim.stats.adv_reports++;
+    }
+}
+
+/**
+ * @brief       上报一个扩展广播事件（传统广播或广播链中的一段）
+ * @param[in]   ctx     广播者
+ * @param[in]   is_rsp  传统广播的扫描响应
+ */
+static void uhos_ble_sim_gap_ext_report(uhos_ble_sim_adv_ctx_t *ctx, uhos_bool is_rsp)
+{
+    esp_ble_gap_ext_adv_reprot_t *rpt = UHOS_NULL;
+    uhos_ble_sim_evt_t *evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GAP, ESP_GATT_IF_NONE, ESP_GAP_BLE_EXT_ADV_REPORT_EVT);
+    uhos_u16 len = 0;
+
+    if (UHOS_NULL == evt)
+    {
+        return;
+    }
+
+    rpt = &evt->param.gap.ext_adv_report.params;
+    rpt->addr_type     = (uint8_t)ctx->adv.addr_type;
+    rpt->rssi          = ctx->adv.rssi;
+    rpt->tx_power      = 0x7F;
+    rpt->primary_phy   = ESP_BLE_GAP_PRI_PHY_1M;
+    rpt->secondly_phy  = 0;
+    rpt->sid           = 0xFF;
+    rpt->data_status   = ESP_BLE_GAP_EXT_ADV_DATA_COMPLETE;
+    uhos_libc_memcpy(rpt->addr, ctx->bda, ESP_BD_ADDR_LEN);
+
+    if (!ctx->adv.extended)
+    {
+        rpt->event_type = ESP_BLE_GAP_ADV_REPORT_LEGACY_ADV;
+        if (ctx->adv.connectable)
+        {
+            rpt->event_type |= ESP_BLE_GAP_ADV_REPORT_EXT_ADV_IND | ESP_BLE_GAP_ADV_REPORT_EXT_SCAN_IND;
+        }
+        else if (0 != ctx->adv.rsp_len)
+        {
+            rpt->event_type |= ESP_BLE_GAP_ADV_REPORT_EXT_SCAN_IND;
+        }
+
+        if (is_rsp)
+        {
+            rpt->event_type  |= ESP_BLE_GAP_ADV_REPORT_EXT_SCAN_RSP;
+            rpt->adv_data_len = ctx->adv.rsp_len;
+            uhos_libc_memcpy(evt->data, ctx->adv.rsp, ctx->adv.rsp_len);
+            g_uhos_ble_sim.stats.rsp_reports++;
+        }
+        else
+        {
+            rpt->adv_data_len = ctx->adv.data_len;
+            uhos_libc_memcpy(evt->data, ctx->adv.data, ctx->adv.data_len);
+            g_uhos_ble_sim.stats.adv_reports++;
+        }
+        return;
+    }
+
+    // 扩展广播：本段数据
+    len = ctx->adv.ext_len - ctx->chain_off;
+    if (len > ESP_BLE_EXT_ADV_REPORT_DATA_LEN_MAX)
+    {
+        len = ESP_BLE_EXT_ADV_REPORT_DATA_LEN_MAX;
+        rpt->data_status = ESP_BLE_GAP_EXT_ADV_DATA_INCOMPLETE;
+    }
+
+    rpt->event_type   = ctx->adv.connectable ? ESP_BLE_GAP_ADV_REPORT_EXT_ADV_IND : 0;
+    rpt->primary_phy  = (ESP_BLE_GAP_PHY_CODED == ctx->adv.primary_phy) ? ESP_BLE_GAP_PRI_PHY_CODED : ESP_BLE_GAP_PRI_PHY_1M;
+    rpt->secondly_phy = ctx->adv.secondary_phy ? (esp_ble_gap_phy_t)ctx->adv.secondary_phy : ESP_BLE_GAP_PHY_1M;
+    rpt->sid          = ctx->adv.sid;
+    rpt->adv_data_len = (uint8_t)len;
+    uhos_libc_memcpy(evt->data, &ctx->adv.ext_data[ctx->chain_off], len);
+
+    ctx->chain_off = (uhos_u16)(ctx->chain_off + len);
+    ctx->chain     = (ctx->chain_off < ctx->adv.ext_len);
+    ctx->chain_us += UHOS_BLE_SIM_AUX_OFFSET_US;
+
+    g_uhos_ble_sim.stats.ext_reports++;
+    if (!ctx->chain)
+    {
+        g_uhos_ble_sim.stats.adv_reports++;
+    }
+}
+
+/**
+ * @brief       获取扫描者在广播者主通道PHY上的扫描配置
+ * @return      扫描配置；扫描者不在该PHY上扫描时返回UHOS_NULL
+ */
+static const esp_ble_ext_scan_cfg_t *uhos_ble_sim_gap_ext_scan_cfg(const uhos_ble_sim_adv_ctx_t *ctx)
+{
+    const esp_ble_ext_scan_params_t *params = &g_uhos_ble_sim_gap.ext_scan_params;
+
+    if (ctx->adv.extended && (ESP_BLE_GAP_PHY_CODED == ctx->adv.primary_phy))
+    {
+        return (params->cfg_mask & ESP_BLE_GAP_EXT_SCAN_CFG_CODE_MASK) ? &params->coded_cfg : UHOS_NULL;
+    }
+
+    return (params->cfg_mask & ESP_BLE_GAP_EXT_SCAN_CFG_UNCODE_MASK) ? &params->uncoded_cfg : UHOS_NULL;
+}
+
+/**
+ * @brief       一次广播到达扫描者
+ */
+static void uhos_ble_sim_gap_adv_rx(uhos_ble_sim_adv_ctx_t *ctx, uhos_u64 now)
+{
+    const esp_ble_ext_scan_cfg_t *cfg = UHOS_NULL;
+    uhos_u64 interval_us = (uhos_u64)g_uhos_ble_sim_gap.scan_params.scan_interval * 625;
+    uhos_u64 window_us   = (uhos_u64)g_uhos_ble_sim_gap.scan_params.scan_window * 625;
+    esp_ble_scan_filter_t policy      = g_uhos_ble_sim_gap.scan_params.scan_filter_policy;
+    esp_ble_scan_duplicate_t dup      = g_uhos_ble_sim_gap.scan_params.scan_duplicate;
+    esp_ble_scan_type_t scan_type     = g_uhos_ble_sim_gap.scan_params.scan_type;
+
+    g_uhos_ble_sim.stats.adv_sent++;
+
+    if (!g_uhos_ble_sim_gap.scanning)
+    {
+        return;
+    }
+
+    // 传统扫描收不到扩展广播；扩展扫描只在配置的PHY上接收
+    if (g_uhos_ble_sim_gap.ext_scan)
+    {
+        cfg = uhos_ble_sim_gap_ext_scan_cfg(ctx);
+        if (UHOS_NULL == cfg)
+        {
+            return;
+        }
+        interval_us = (uhos_u64)cfg->scan_interval * 625;
+        window_us   = (uhos_u64)cfg->scan_window * 625;
+        policy      = g_uhos_ble_sim_gap.ext_scan_params.filter_policy;
+        dup         = g_uhos_ble_sim_gap.ext_scan_params.scan_duplicate;
+        scan_type   = cfg->scan_type;
+    }
+    else if (ctx->adv.extended)
+    {
+        return;
+    }
+
+    if ((now - g_uhos_ble_sim_gap.scan_start_us) % interval_us >= window_us)
+    {
+        g_uhos_ble_sim.stats.adv_missed++;
+        return;
+    }
+
+    if ((BLE_SCAN_FILTER_ALLOW_ONLY_WLST == policy) && !uhos_ble_sim_gap_wl_contains(ctx->bda))
+    {
+        g_uhos_ble_sim.stats.adv_wl_filtered++;
+        return;
+    }
+
+    if ((BLE_SCAN_DUPLICATE_ENABLE == dup) && ctx->reported)
+    {
+        return;
+    }
+    ctx->reported = UHOS_TRUE;
+
+    if (ctx->adv.extended)
+    {
+        // 扫描者跟随辅助指针接收整条广播链，第一段随主通道广播上报
+        ctx->chain_off = 0;
+        ctx->chain_us  = now;
+        uhos_ble_sim_gap_ext_report(ctx, UHOS_FALSE);
+        return;
+    }
+
+    if (g_uhos_ble_sim_gap.ext_scan)
+    {
+        uhos_ble_sim_gap_ext_report(ctx, UHOS_FALSE);
+        if ((BLE_SCAN_TYPE_ACTIVE == scan_type) && (0 != ctx->adv.rsp_len))
+        {
+            uhos_ble_sim_gap_ext_report(ctx, UHOS_TRUE);
+        }
+        return;
+    }
+
+    uhos_ble_sim_gap_report(ctx, UHOS_FALSE);
+    if ((BLE_SCAN_TYPE_ACTIVE == scan_type) && (0 != ctx->adv.rsp_len))
+    {
+        uhos_ble_sim_gap_report(ctx, UHOS_TRUE);
+    }
+}
+
+static void uhos_ble_sim_gap_scan_end(void)
+{
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+
+    g_uhos_ble_sim_gap.scanning = UHOS_FALSE;
+
+    if (g_uhos_ble_sim_gap.ext_scan)
+    {
+        uhos_ble_sim_gap_status_evt(ESP_GAP_BLE_SCAN_TIMEOUT_EVT, ESP_BT_STATUS_SUCCESS);
+        return;
+    }
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GAP, ESP_GATT_IF_NONE, ESP_GAP_BLE_SCAN_RESULT_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gap.scan_rst.search_evt = ESP_GAP_SEARCH_INQ_CMPL_EVT;
+    }
+}
+
+/**
+ * @brief       扩展广播集停止广播，上报ESP_GAP_BLE_ADV_TERMINATED_EVT
+ * @param[in]   instance    广播集编号
+ * @param[in]   status      HCI状态：0-因连接建立而停止，0x3C-广播时长到期
+ */
+static void uhos_ble_sim_gap_ext_adv_terminate(uhos_u8 instance, uhos_u8 status)
+{
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+
+    g_uhos_ble_sim_gap.ext_adv[instance].enabled = UHOS_FALSE;
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GAP, ESP_GATT_IF_NONE, ESP_GAP_BLE_ADV_TERMINATED_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gap.adv_terminate.status       = status;
+        evt->param.gap.adv_terminate.adv_instance = instance;
+    }
+}
+
+/**
+ * @brief       查找正在广播的可连接扩展广播集
+ * @return      广播集编号；没有时返回-1
+ */
+static uhos_s32 uhos_ble_sim_gap_ext_adv_connectable(void)
+{
+    uhos_u8 i = 0;
+
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_EXT_ADV_SET_NUM; i++)
+    {
+        if (g_uhos_ble_sim_gap.ext_adv[i].enabled &&
+            (g_uhos_ble_sim_gap.ext_adv[i].params.type & ESP_BLE_GAP_SET_EXT_ADV_PROP_CONNECTABLE))
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static uhos_bool uhos_ble_sim_gap_conn_params_valid(const esp_ble_conn_update_params_t *params)
+{
+    // 间隔7.5ms~4s，从设备时延不超过499，监控超时100ms~32s且大于(1 + latency) * max_int * 2
+    if ((params->min_int < 0x0006) || (params->max_int > 0x0C80) || (params->min_int > params->max_int) ||
+        (params->latency > 0x01F3) || (params->timeout < 0x000A) || (params->timeout > 0x0C80))
+    {
+        return UHOS_FALSE;
+    }
+
+    return ((uhos_u32)params->timeout * 4 > (uhos_u32)(1 + params->latency) * params->max_int);
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+void uhos_ble_sim_gap_reset(void)
+{
+    uhos_u8 i = 0;
+
+    g_uhos_ble_sim_gap.scanning        = UHOS_FALSE;
+    g_uhos_ble_sim_gap.scan_params_set = UHOS_FALSE;
+    g_uhos_ble_sim_gap.advertising     = UHOS_FALSE;
+    g_uhos_ble_sim_gap.adv_data_len    = 0;
+    g_uhos_ble_sim_gap.rsp_data_len    = 0;
+    g_uhos_ble_sim_gap.wl_num          = 0;
+    g_uhos_ble_sim_gap.ext_scan        = UHOS_FALSE;
+    g_uhos_ble_sim_gap.ext_scan_params_set = UHOS_FALSE;
+    uhos_libc_memset(g_uhos_ble_sim_gap.ext_adv, 0, sizeof(g_uhos_ble_sim_gap.ext_adv));
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_ADV_NUM; i++)
+    {
+        g_uhos_ble_sim_gap.adv[i].reported = UHOS_FALSE;
+        g_uhos_ble_sim_gap.adv[i].chain    = UHOS_FALSE;
+    }
+}
+
+/**
+ * @brief       处理到期的广播与扫描超时
+ * @return      下一个到期时刻，无待处理项时返回0
+ */
+uhos_u64 uhos_ble_sim_gap_process(uhos_u64 now)
+{
+    uhos_ble_sim_adv_ctx_t *ctx = UHOS_NULL;
+    uhos_u64 next = 0, period = 0;
+    uhos_u8 i = 0;
+
+    if (g_uhos_ble_sim_gap.scanning && (0 != g_uhos_ble_sim_gap.scan_end_us) && (now >= g_uhos_ble_sim_gap.scan_end_us))
+    {
+        uhos_ble_sim_gap_scan_end();
+    }
+
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_EXT_ADV_SET_NUM; i++)
+    {
+        if (!g_uhos_ble_sim_gap.ext_adv[i].enabled || (0 == g_uhos_ble_sim_gap.ext_adv[i].end_us))
+        {
+            continue;
+        }
+        if (now >= g_uhos_ble_sim_gap.ext_adv[i].end_us)
+        {
+            uhos_ble_sim_gap_ext_adv_terminate(i, UHOS_BLE_SIM_HCI_ADV_TIMEOUT);
+        }
+        else if ((0 == next) || (g_uhos_ble_sim_gap.ext_adv[i].end_us < next))
+        {
+            next = g_uhos_ble_sim_gap.ext_adv[i].end_us;
+        }
+    }
+
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_ADV_NUM; i++)
+    {
+        ctx = &g_uhos_ble_sim_gap.adv[i];
+        if (!ctx->used)
+        {
+            continue;
+        }
+
+        // 广播链的后续分段，扫描停止后不再接收
+        if (ctx->chain)
+        {
+            if (!g_uhos_ble_sim_gap.scanning)
+            {
+                ctx->chain = UHOS_FALSE;
+            }
+            else if (now >= ctx->chain_us)
+            {
+                uhos_ble_sim_gap_ext_report(ctx, UHOS_FALSE);
+            }
+        }
+        if (ctx->chain && ((0 == next) || (ctx->chain_us < next)))
+        {
+            next = ctx->chain_us;
+        }
+
+        period = (uhos_u64)ctx->adv.interval_ms * 1000;
+        if (now >= ctx->next_us + period)
+        {
+            // 线程滞后超过一个广播间隔，只补发一次
+            ctx->next_us = now;
+        }
+        if (now >= ctx->next_us)
+        {
+            uhos_ble_sim_gap_adv_rx(ctx, ctx->next_us);
+            ctx->next_us += period + (uhos_u64)(uhos_ble_sim_rand() % (UHOS_BLE_SIM_ADV_DELAY_MAX_MS + 1)) * 1000;
+        }
+        if ((0 == next) || (ctx->next_us < next))
+        {
+            next = ctx->next_us;
+        }
+    }
+
+    if (g_uhos_ble_sim_gap.scanning && (0 != g_uhos_ble_sim_gap.scan_end_us) &&
+        ((0 == next) || (g_uhos_ble_sim_gap.scan_end_us < next)))
+    {
+        next = g_uhos_ble_sim_gap.scan_end_us;
+    }
+
+    return next;
+}
+
+static uhos_bool uhos_ble_sim_gap_legacy_adv_connectable(void)
+{
+    return (g_uhos_ble_sim_gap.advertising &&
+            ((ADV_TYPE_IND == g_uhos_ble_sim_gap.adv_params.adv_type) ||
+             (ADV_TYPE_DIRECT_IND_HIGH == g_uhos_ble_sim_gap.adv_params.adv_type) ||
+             (ADV_TYPE_DIRECT_IND_LOW == g_uhos_ble_sim_gap.adv_params.adv_type)));
+}
+
+uhos_bool uhos_ble_sim_gap_adv_connectable(void)
+{
+    return uhos_ble_sim_gap_legacy_adv_connectable() || (uhos_ble_sim_gap_ext_adv_connectable() >= 0);
+}
+
+/**
+ * @brief       连接建立，停止被连接的可连接广播（传统广播优先）
+ */
+void uhos_ble_sim_gap_adv_stop(void)
+{
+    uhos_s32 instance = -1;
+
+    if (uhos_ble_sim_gap_legacy_adv_connectable())
+    {
+        g_uhos_ble_sim_gap.advertising = UHOS_FALSE;
+        return;
+    }
+
+    instance = uhos_ble_sim_gap_ext_adv_connectable();
+    if (instance >= 0)
+    {
+        uhos_ble_sim_gap_ext_adv_terminate((uhos_u8)instance, 0);
+    }
+}
+
+/**
+ * @brief       在连接事件中处理到达instant的连接参数更新
+ */
+void uhos_ble_sim_gap_link_process(uhos_ble_sim_link_t *link)
+{
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+
+    if ((0 == link->upd_countdown) || (0 != --link->upd_countdown))
+    {
+        return;
+    }
+
+    link->interval = link->upd.max_int;
+    link->latency  = link->upd.latency;
+    link->timeout  = link->upd.timeout;
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GAP, ESP_GATT_IF_NONE, ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gap.update_conn_params.status   = ESP_BT_STATUS_SUCCESS;
+        evt->param.gap.update_conn_params.min_int  = link->upd.min_int;
+        evt->param.gap.update_conn_params.max_int  = link->upd.max_int;
+        evt->param.gap.update_conn_params.latency  = link->latency;
+        evt->param.gap.update_conn_params.conn_int = link->interval;
+        evt->param.gap.update_conn_params.timeout  = link->timeout;
+        uhos_libc_memcpy(evt->param.gap.update_conn_params.bda, link->upd.bda, ESP_BD_ADDR_LEN);
+    }
+}
+
+/****************ESP-GAP*********************/
+esp_err_t esp_ble_gap_register_callback(esp_gap_ble_cb_t callback)
+{
+    uhos_ble_sim_ctl_init();
+
+    UHOS_BLE_SIM_LOCK();
+    g_uhos_ble_sim.gap_cb = callback;
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gap_config_adv_data(esp_ble_adv_data_t *adv_data)
+{
+    (void)adv_data;
+
+    // AL_BLE只使用原始广播数据
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t esp_ble_gap_config_adv_data_raw(uint8_t *raw_data, uint32_t raw_data_len)
+{
+    if ((raw_data_len > ESP_BLE_ADV_DATA_LEN_MAX) || ((0 != raw_data_len) && (UHOS_NULL == raw_data)))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    uhos_libc_memcpy(g_uhos_ble_sim_gap.adv_data, raw_data, raw_data_len);
+    g_uhos_ble_sim_gap.adv_data_len = (uhos_u8)raw_data_len;
+    uhos_ble_sim_gap_status_evt(ESP_GAP_BLE_ADV_DATA_RAW_SET_COMPLETE_EVT, ESP_BT_STATUS_SUCCESS);
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gap_config_scan_rsp_data_raw(uint8_t *raw_data, uint32_t raw_data_len)
+{
+    if ((raw_data_len > ESP_BLE_SCAN_RSP_DATA_LEN_MAX) || ((0 != raw_data_len) && (UHOS_NULL == raw_data)))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    uhos_libc_memcpy(g_uhos_ble_sim_gap.rsp_data, raw_data, raw_data_len);
+    g_uhos_ble_sim_gap.rsp_data_len = (uhos_u8)raw_data_len;
+    uhos_ble_sim_gap_status_evt(ESP_GAP_BLE_SCAN_RSP_DATA_RAW_SET_COMPLETE_EVT, ESP_BT_STATUS_SUCCESS);
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gap_set_scan_params(esp_ble_scan_params_t *scan_params)
+{
+    if ((UHOS_NULL == scan_params) || (scan_params->scan_interval < 0x0004) || (scan_params->scan_interval > 0x4000) ||
+        (scan_params->scan_window < 0x0004) || (scan_params->scan_window > scan_params->scan_interval))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    uhos_libc_memcpy(&g_uhos_ble_sim_gap.scan_params, scan_params, sizeof(esp_ble_scan_params_t));
+    g_uhos_ble_sim_gap.scan_params_set = UHOS_TRUE;
+    uhos_ble_sim_gap_status_evt(ESP_GAP_BLE_SCAN_PARAM_SET_COMPLETE_EVT, ESP_BT_STATUS_SUCCESS);
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+/**
+ * @param[in]   duration    扫描时长，单位秒，0表示持续扫描
+ */
+esp_err_t esp_ble_gap_start_scanning(uint32_t duration)
+{
+    uhos_u8 i = 0;
+
+    UHOS_BLE_SIM_LOCK();
+    if (!g_uhos_ble_sim_gap.scan_params_set)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    g_uhos_ble_sim_gap.scanning      = UHOS_TRUE;
+    g_uhos_ble_sim_gap.ext_scan      = UHOS_FALSE;
+    g_uhos_ble_sim_gap.scan_start_us = uhos_ble_sim_now_us();
+    g_uhos_ble_sim_gap.scan_end_us   = (0 != duration) ?
+                                       (g_uhos_ble_sim_gap.scan_start_us + (uhos_u64)duration * 1000000) : 0;
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_ADV_NUM; i++)
+    {
+        g_uhos_ble_sim_gap.adv[i].reported = UHOS_FALSE;
+    }
+    uhos_ble_sim_gap_status_evt(ESP_GAP_BLE_SCAN_START_COMPLETE_EVT, ESP_BT_STATUS_SUCCESS);
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gap_stop_scanning(void)
+{
+    UHOS_BLE_SIM_LOCK();
+    g_uhos_ble_sim_gap.scanning = UHOS_FALSE;
+    uhos_ble_sim_gap_status_evt(ESP_GAP_BLE_SCAN_STOP_COMPLETE_EVT, ESP_BT_STATUS_SUCCESS);
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gap_start_advertising(esp_ble_adv_params_t *adv_params)
+{
+    if ((UHOS_NULL == adv_params) || (adv_params->adv_int_min < 0x0020) || (adv_params->adv_int_max > 0x4000) ||
+        (adv_params->adv_int_min > adv_params->adv_int_max) || (0 == (adv_params->channel_map & ADV_CHNL_ALL)))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    uhos_libc_memcpy(&g_uhos_ble_sim_gap.adv_params, adv_params, sizeof(esp_ble_adv_params_t));
+    g_uhos_ble_sim_gap.advertising = UHOS_TRUE;
+    uhos_ble_sim_gap_status_evt(ESP_GAP_BLE_ADV_START_COMPLETE_EVT, ESP_BT_STATUS_SUCCESS);
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gap_stop_advertising(void)
+{
+    UHOS_BLE_SIM_LOCK();
+    g_uhos_ble_sim_gap.advertising = UHOS_FALSE;
+    uhos_ble_sim_gap_status_evt(ESP_GAP_BLE_ADV_STOP_COMPLETE_EVT, ESP_BT_STATUS_SUCCESS);
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gap_update_conn_params(esp_ble_conn_update_params_t *params)
+{
+    uhos_ble_sim_link_t *link = UHOS_NULL;
+
+    if ((UHOS_NULL == params) || !uhos_ble_sim_gap_conn_params_valid(params))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    link = uhos_ble_sim_link_get_by_bda(params->bda);
+    if ((UHOS_NULL == link) || (UHOS_BLE_SIM_LINK_CONNECTED != link->state))
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+    uhos_libc_memcpy(&link->upd, params, sizeof(esp_ble_conn_update_params_t));
+    link->upd_countdown = UHOS_BLE_SIM_CONN_UPD_EVENTS;
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gap_set_pkt_data_len(esp_bd_addr_t remote_device, uint16_t tx_data_length)
+{
+    uhos_ble_sim_link_t *link = UHOS_NULL;
+    uhos_ble_sim_evt_t *evt   = UHOS_NULL;
+
+    if ((tx_data_length < 27) || (tx_data_length > 251))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    link = uhos_ble_sim_link_get_by_bda(remote_device);
+    if ((UHOS_NULL == link) || (UHOS_BLE_SIM_LINK_CONNECTED != link->state))
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+    link->ll_payload = tx_data_length;
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GAP, ESP_GATT_IF_NONE, ESP_GAP_BLE_SET_PKT_LENGTH_COMPLETE_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gap.pkt_data_length_cmpl.status        = ESP_BT_STATUS_SUCCESS;
+        evt->param.gap.pkt_data_length_cmpl.params.tx_len = tx_data_length;
+        evt->param.gap.pkt_data_length_cmpl.params.rx_len = tx_data_length;
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gap_update_whitelist(bool add_remove, esp_bd_addr_t remote_bda, esp_ble_wl_addr_type_t wl_addr_type)
+{
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+    esp_bt_status_t status  = ESP_BT_STATUS_SUCCESS;
+    uhos_u8 i = 0;
+
+    if (UHOS_NULL == remote_bda)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    for (i = 0; i < g_uhos_ble_sim_gap.wl_num; i++)
+    {
+        if (0 == uhos_libc_memcmp(g_uhos_ble_sim_gap.wl[i].bda, remote_bda, ESP_BD_ADDR_LEN))
+        {
+            break;
+        }
+    }
+
+    // 与控制器一致：接口调用成功，结果在完成事件中给出
+    if (uhos_ble_sim_gap_wl_in_use())
+    {
+        status = ESP_BT_STATUS_FAIL;
+    }
+    else if (add_remove)
+    {
+        if ((i == g_uhos_ble_sim_gap.wl_num) && (CONFIG_UHOS_BLE_SIM_WL_NUM == g_uhos_ble_sim_gap.wl_num))
+        {
+            status = ESP_BT_STATUS_FAIL;
+        }
+        else if (i == g_uhos_ble_sim_gap.wl_num)
+        {
+            uhos_libc_memcpy(g_uhos_ble_sim_gap.wl[i].bda, remote_bda, ESP_BD_ADDR_LEN);
+            g_uhos_ble_sim_gap.wl[i].type = wl_addr_type;
+            g_uhos_ble_sim_gap.wl_num++;
+        }
+    }
+    else if (i < g_uhos_ble_sim_gap.wl_num)
+    {
+        g_uhos_ble_sim_gap.wl_num--;
+        uhos_libc_memcpy(&g_uhos_ble_sim_gap.wl[i], &g_uhos_ble_sim_gap.wl[g_uhos_ble_sim_gap.wl_num],
+                         sizeof(uhos_ble_sim_wl_item_t));
+    }
+
+    if (ESP_BT_STATUS_SUCCESS != status)
+    {
+        g_uhos_ble_sim.stats.wl_rejected++;
+    }
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GAP, ESP_GATT_IF_NONE, ESP_GAP_BLE_UPDATE_WHITELIST_COMPLETE_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gap.update_whitelist_cmpl.status       = status;
+        evt->param.gap.update_whitelist_cmpl.wl_operation = add_remove ? ESP_BLE_WHITELIST_ADD : ESP_BLE_WHITELIST_REMOVE;
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gap_clear_whitelist(void)
+{
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+    esp_bt_status_t status  = ESP_BT_STATUS_SUCCESS;
+
+    UHOS_BLE_SIM_LOCK();
+    if (uhos_ble_sim_gap_wl_in_use())
+    {
+        status = ESP_BT_STATUS_FAIL;
+        g_uhos_ble_sim.stats.wl_rejected++;
+    }
+    else
+    {
+        g_uhos_ble_sim_gap.wl_num = 0;
+    }
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GAP, ESP_GATT_IF_NONE, ESP_GAP_BLE_UPDATE_WHITELIST_COMPLETE_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gap.update_whitelist_cmpl.status       = status;
+        evt->param.gap.update_whitelist_cmpl.wl_operation = ESP_BLE_WHITELIST_CLEAR;
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gap_get_whitelist_size(uint16_t *length)
+{
+    if (UHOS_NULL == length)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    *length = CONFIG_UHOS_BLE_SIM_WL_NUM - g_uhos_ble_sim_gap.wl_num;
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gap_read_rssi(esp_bd_addr_t remote_addr)
+{
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+
+    UHOS_BLE_SIM_LOCK();
+    if (UHOS_NULL == uhos_ble_sim_link_get_by_bda(remote_addr))
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GAP, ESP_GATT_IF_NONE, ESP_GAP_BLE_READ_RSSI_COMPLETE_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gap.read_rssi_cmpl.status = ESP_BT_STATUS_SUCCESS;
+        evt->param.gap.read_rssi_cmpl.rssi   = UHOS_BLE_SIM_RSSI;
+        uhos_libc_memcpy(evt->param.gap.read_rssi_cmpl.remote_addr, remote_addr, ESP_BD_ADDR_LEN);
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gap_disconnect(esp_bd_addr_t remote_device)
+{
+    uhos_ble_sim_link_t *link = UHOS_NULL;
+
+    UHOS_BLE_SIM_LOCK();
+    link = uhos_ble_sim_link_get_by_bda(remote_device);
+    if (UHOS_NULL == link)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+    uhos_ble_sim_link_close(link, ESP_GATT_CONN_TERMINATE_LOCAL_HOST);
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+/****************ESP-GAP BLE 5.0*************/
+esp_err_t esp_ble_gap_ext_adv_set_params(uint8_t instance, const esp_ble_gap_ext_adv_params_t *params)
+{
+    uhos_ble_sim_ext_adv_set_t *set = UHOS_NULL;
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+
+    // 扩展PDU不能同时可连接与可扫描；传统PDU只能使用1M PHY
+    if ((instance >= CONFIG_UHOS_BLE_SIM_EXT_ADV_SET_NUM) || (UHOS_NULL == params) ||
+        (params->interval_min < 0x0020) || (params->interval_min > params->interval_max) ||
+        (0 == (params->channel_map & ADV_CHNL_ALL)) ||
+        (!(params->type & ESP_BLE_GAP_SET_EXT_ADV_PROP_LEGACY) &&
+         (params->type & ESP_BLE_GAP_SET_EXT_ADV_PROP_CONNECTABLE) && (params->type & ESP_BLE_GAP_SET_EXT_ADV_PROP_SCANNABLE)) ||
+        ((params->type & ESP_BLE_GAP_SET_EXT_ADV_PROP_LEGACY) && (ESP_BLE_GAP_PRI_PHY_1M != params->primary_phy)))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    set = &g_uhos_ble_sim_gap.ext_adv[instance];
+    if (set->enabled)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+    uhos_libc_memcpy(&set->params, params, sizeof(esp_ble_gap_ext_adv_params_t));
+    set->params_set = UHOS_TRUE;
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GAP, ESP_GATT_IF_NONE, ESP_GAP_BLE_EXT_ADV_SET_PARAMS_COMPLETE_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gap.ext_adv_set_params.status   = ESP_BT_STATUS_SUCCESS;
+        evt->param.gap.ext_adv_set_params.instance = instance;
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+/**
+ * @brief       设置广播集的广播数据或扫描响应数据
+ */
+static esp_err_t uhos_ble_sim_gap_ext_adv_data(uint8_t instance, uint16_t length, const uint8_t *data, uhos_bool is_rsp)
+{
+    uhos_ble_sim_ext_adv_set_t *set = UHOS_NULL;
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+    esp_bt_status_t status  = ESP_BT_STATUS_SUCCESS;
+
+    if ((instance >= CONFIG_UHOS_BLE_SIM_EXT_ADV_SET_NUM) || (length > ESP_BLE_EXT_ADV_DATA_LEN_MAX) ||
+        ((0 != length) && (UHOS_NULL == data)))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    set = &g_uhos_ble_sim_gap.ext_adv[instance];
+
+    // 与控制器一致：未设置参数或传统PDU超过31字节时在完成事件中返回错误
+    if (!set->params_set)
+    {
+        status = ESP_BT_STATUS_FAIL;
+    }
+    else if ((set->params.type & ESP_BLE_GAP_SET_EXT_ADV_PROP_LEGACY) && (length > ESP_BLE_ADV_DATA_LEN_MAX))
+    {
+        status = ESP_BT_STATUS_PARM_INVALID;
+    }
+    else if (is_rsp)
+    {
+        set->rsp_len = length;
+    }
+    else
+    {
+        set->data_len = length;
+    }
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GAP, ESP_GATT_IF_NONE,
+                                 is_rsp ? ESP_GAP_BLE_EXT_SCAN_RSP_DATA_SET_COMPLETE_EVT : ESP_GAP_BLE_EXT_ADV_DATA_SET_COMPLETE_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gap.ext_adv_data_set.status   = status;
+        evt->param.gap.ext_adv_data_set.instance = instance;
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gap_config_ext_adv_data_raw(uint8_t instance, uint16_t length, const uint8_t *data)
+{
+    return uhos_ble_sim_gap_ext_adv_data(instance, length, data, UHOS_FALSE);
+}
+
+esp_err_t esp_ble_gap_config_ext_scan_rsp_data_raw(uint8_t instance, uint16_t length, const uint8_t *scan_rsp_data)
+{
+    return uhos_ble_sim_gap_ext_adv_data(instance, length, scan_rsp_data, UHOS_TRUE);
+}
+
+/**
+ * @note        max_events不做模拟，只按duration结束广播
+ */
+esp_err_t esp_ble_gap_ext_adv_start(uint8_t num_adv, const esp_ble_gap_ext_adv_t *ext_adv)
+{
+    uhos_ble_sim_ext_adv_set_t *set = UHOS_NULL;
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+    uhos_u64 now = 0;
+    uhos_u8 i = 0;
+
+    if ((0 == num_adv) || (num_adv > EXT_ADV_NUM_SETS_MAX) || (UHOS_NULL == ext_adv))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    for (i = 0; i < num_adv; i++)
+    {
+        if ((ext_adv[i].instance >= CONFIG_UHOS_BLE_SIM_EXT_ADV_SET_NUM) ||
+            !g_uhos_ble_sim_gap.ext_adv[ext_adv[i].instance].params_set)
+        {
+            UHOS_BLE_SIM_UNLOCK();
+            return ESP_ERR_INVALID_STATE;
+        }
+    }
+
+    now = uhos_ble_sim_now_us();
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GAP, ESP_GATT_IF_NONE, ESP_GAP_BLE_EXT_ADV_START_COMPLETE_EVT);
+    for (i = 0; i < num_adv; i++)
+    {
+        set = &g_uhos_ble_sim_gap.ext_adv[ext_adv[i].instance];
+        set->enabled = UHOS_TRUE;
+        set->end_us  = (ext_adv[i].duration > 0) ? (now + (uhos_u64)ext_adv[i].duration * 10000) : 0;
+        if (UHOS_NULL != evt)
+        {
+            evt->param.gap.ext_adv_start.instance[i] = ext_adv[i].instance;
+        }
+    }
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gap.ext_adv_start.status       = ESP_BT_STATUS_SUCCESS;
+        evt->param.gap.ext_adv_start.instance_num = num_adv;
+    }
+    uhos_ble_sim_wakeup();
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gap_ext_adv_stop(uint8_t num_adv, const uint8_t *ext_adv_inst)
+{
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+    uhos_u8 i = 0;
+
+    if ((0 == num_adv) || (num_adv > EXT_ADV_NUM_SETS_MAX) || (UHOS_NULL == ext_adv_inst))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GAP, ESP_GATT_IF_NONE, ESP_GAP_BLE_EXT_ADV_STOP_COMPLETE_EVT);
+    for (i = 0; i < num_adv; i++)
+    {
+        if (ext_adv_inst[i] < CONFIG_UHOS_BLE_SIM_EXT_ADV_SET_NUM)
+        {
+            g_uhos_ble_sim_gap.ext_adv[ext_adv_inst[i]].enabled = UHOS_FALSE;
+        }
+        if (UHOS_NULL != evt)
+        {
+            evt->param.gap.ext_adv_stop.instance[i] = ext_adv_inst[i];
+        }
+    }
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gap.ext_adv_stop.status       = ESP_BT_STATUS_SUCCESS;
+        evt->param.gap.ext_adv_stop.instance_num = num_adv;
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gap_ext_adv_set_remove(uint8_t instance)
+{
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+
+    if (instance >= CONFIG_UHOS_BLE_SIM_EXT_ADV_SET_NUM)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    uhos_libc_memset(&g_uhos_ble_sim_gap.ext_adv[instance], 0, sizeof(uhos_ble_sim_ext_adv_set_t));
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GAP, ESP_GATT_IF_NONE, ESP_GAP_BLE_EXT_ADV_SET_REMOVE_COMPLETE_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gap.ext_adv_remove.status   = ESP_BT_STATUS_SUCCESS;
+        evt->param.gap.ext_adv_remove.instance = instance;
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gap_ext_adv_set_clear(void)
+{
+    UHOS_BLE_SIM_LOCK();
+    uhos_libc_memset(g_uhos_ble_sim_gap.ext_adv, 0, sizeof(g_uhos_ble_sim_gap.ext_adv));
+    uhos_ble_sim_gap_status_evt(ESP_GAP_BLE_EXT_ADV_SET_CLEAR_COMPLETE_EVT, ESP_BT_STATUS_SUCCESS);
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+/**
+ * @brief       校验单个PHY的扩展扫描配置
+ */
+static uhos_bool uhos_ble_sim_gap_ext_scan_cfg_valid(const esp_ble_ext_scan_cfg_t *cfg)
+{
+    return (cfg->scan_interval >= 0x0004) && (cfg->scan_window >= 0x0004) && (cfg->scan_window <= cfg->scan_interval);
+}
+
+esp_err_t esp_ble_gap_set_ext_scan_params(const esp_ble_ext_scan_params_t *params)
+{
+    if ((UHOS_NULL == params) ||
+        (0 == (params->cfg_mask & (ESP_BLE_GAP_EXT_SCAN_CFG_UNCODE_MASK | ESP_BLE_GAP_EXT_SCAN_CFG_CODE_MASK))) ||
+        ((params->cfg_mask & ESP_BLE_GAP_EXT_SCAN_CFG_UNCODE_MASK) && !uhos_ble_sim_gap_ext_scan_cfg_valid(&params->uncoded_cfg)) ||
+        ((params->cfg_mask & ESP_BLE_GAP_EXT_SCAN_CFG_CODE_MASK) && !uhos_ble_sim_gap_ext_scan_cfg_valid(&params->coded_cfg)))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    uhos_libc_memcpy(&g_uhos_ble_sim_gap.ext_scan_params, params, sizeof(esp_ble_ext_scan_params_t));
+    g_uhos_ble_sim_gap.ext_scan_params_set = UHOS_TRUE;
+    uhos_ble_sim_gap_status_evt(ESP_GAP_BLE_SET_EXT_SCAN_PARAMS_COMPLETE_EVT, ESP_BT_STATUS_SUCCESS);
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+/**
+ * @param[in]   duration    扫描时长，单位10ms，0表示持续扫描
+ * @param[in]   period      周期扫描，不做模拟
+ */
+esp_err_t esp_ble_gap_start_ext_scan(uint32_t duration, uint16_t period)
+{
+    uhos_u8 i = 0;
+
+    (void)period;
+
+    UHOS_BLE_SIM_LOCK();
+    if (!g_uhos_ble_sim_gap.ext_scan_params_set)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    g_uhos_ble_sim_gap.scanning      = UHOS_TRUE;
+    g_uhos_ble_sim_gap.ext_scan      = UHOS_TRUE;
+    g_uhos_ble_sim_gap.scan_start_us = uhos_ble_sim_now_us();
+    g_uhos_ble_sim_gap.scan_end_us   = (0 != duration) ?
+                                       (g_uhos_ble_sim_gap.scan_start_us + (uhos_u64)duration * 10000) : 0;
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_ADV_NUM; i++)
+    {
+        g_uhos_ble_sim_gap.adv[i].reported = UHOS_FALSE;
+        g_uhos_ble_sim_gap.adv[i].chain    = UHOS_FALSE;
+    }
+    uhos_ble_sim_gap_status_evt(ESP_GAP_BLE_EXT_SCAN_START_COMPLETE_EVT, ESP_BT_STATUS_SUCCESS);
+    uhos_ble_sim_wakeup();
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gap_stop_ext_scan(void)
+{
+    UHOS_BLE_SIM_LOCK();
+    g_uhos_ble_sim_gap.scanning = UHOS_FALSE;
+    uhos_ble_sim_gap_status_evt(ESP_GAP_BLE_EXT_SCAN_STOP_COMPLETE_EVT, ESP_BT_STATUS_SUCCESS);
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+/****************ESP-GAP BLE SECURITY********/
+int esp_ble_get_bond_device_num(void)
+{
+    int num = 0;
+    int i   = 0;
+
+    uhos_ble_sim_ctl_init();
+
+    UHOS_BLE_SIM_LOCK();
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_PEER_NUM; i++)
+    {
+        if (g_uhos_ble_sim.peer[i].used && g_uhos_ble_sim.peer[i].bonded)
+        {
+            num++;
+        }
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return num;
+}
+
+esp_err_t esp_ble_get_bond_device_list(int *dev_num, esp_ble_bond_dev_t *dev_list)
+{
+    int num = 0;
+    int i   = 0;
+
+    if ((UHOS_NULL == dev_num) || (UHOS_NULL == dev_list) || (*dev_num <= 0))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uhos_ble_sim_ctl_init();
+
+    UHOS_BLE_SIM_LOCK();
+    for (i = 0; (i < CONFIG_UHOS_BLE_SIM_PEER_NUM) && (num < *dev_num); i++)
+    {
+        if (g_uhos_ble_sim.peer[i].used && g_uhos_ble_sim.peer[i].bonded)
+        {
+            uhos_libc_memcpy(dev_list[num].bd_addr, g_uhos_ble_sim.peer[i].bda, ESP_BD_ADDR_LEN);
+            num++;
+        }
+    }
+    UHOS_BLE_SIM_UNLOCK();
+    *dev_num = num;
+
+    return ESP_OK;
+}
+
+/****************SIM-API*********************/
+uhos_ble_status_t uhos_ble_sim_adv_add(const uhos_ble_sim_adv_t *adv)
+{
+    uhos_ble_sim_adv_ctx_t *ctx = UHOS_NULL;
+    esp_bd_addr_t bda;
+    uhos_u8 i = 0;
+
+    if ((UHOS_NULL == adv) || (0 == adv->interval_ms) || (adv->data_len > UHOS_BLE_SIM_ADV_DATA_LEN) ||
+        (adv->rsp_len > UHOS_BLE_SIM_ADV_DATA_LEN) || (adv->ext_len > UHOS_BLE_SIM_EXT_ADV_DATA_LEN))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_sim_ctl_init();
+    uhos_ble_sim_addr_to_bda(adv->addr, bda);
+
+    UHOS_BLE_SIM_LOCK();
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_ADV_NUM; i++)
+    {
+        if (g_uhos_ble_sim_gap.adv[i].used && (0 == uhos_libc_memcmp(g_uhos_ble_sim_gap.adv[i].bda, bda, ESP_BD_ADDR_LEN)))
+        {
+            ctx = &g_uhos_ble_sim_gap.adv[i];
+            break;
+        }
+        if ((UHOS_NULL == ctx) && !g_uhos_ble_sim_gap.adv[i].used)
+        {
+            ctx = &g_uhos_ble_sim_gap.adv[i];
+        }
+    }
+    if (UHOS_NULL == ctx)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return UHOS_BLE_ERROR;
+    }
+
+    if (!ctx->used)
+    {
+        // 随机相位，避免所有广播者同时广播
+        ctx->next_us  = uhos_ble_sim_now_us() + (uhos_u64)(uhos_ble_sim_rand() % adv->interval_ms) * 1000;
+        ctx->reported = UHOS_FALSE;
+    }
+    ctx->chain = UHOS_FALSE;
+    ctx->used = UHOS_TRUE;
+    uhos_libc_memcpy(ctx->bda, bda, ESP_BD_ADDR_LEN);
+    uhos_libc_memcpy(&ctx->adv, adv, sizeof(uhos_ble_sim_adv_t));
+    uhos_ble_sim_wakeup();
+    UHOS_BLE_SIM_UNLOCK();
+
+    return UHOS_BLE_SUCCESS;
+}
+
+uhos_ble_status_t uhos_ble_sim_adv_remove(const uhos_ble_addr_t addr)
+{
+    esp_bd_addr_t bda;
+    uhos_u8 i = 0;
+
+    uhos_ble_sim_ctl_init();
+    uhos_ble_sim_addr_to_bda(addr, bda);
+
+    UHOS_BLE_SIM_LOCK();
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_ADV_NUM; i++)
+    {
+        if (g_uhos_ble_sim_gap.adv[i].used && (0 == uhos_libc_memcmp(g_uhos_ble_sim_gap.adv[i].bda, bda, ESP_BD_ADDR_LEN)))
+        {
+            g_uhos_ble_sim_gap.adv[i].used = UHOS_FALSE;
+            UHOS_BLE_SIM_UNLOCK();
+            return UHOS_BLE_SUCCESS;
+        }
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return UHOS_BLE_ERROR;
+}
+
+void uhos_ble_sim_adv_clear(void)
+{
+    uhos_u8 i = 0;
+
+    uhos_ble_sim_ctl_init();
+
+    UHOS_BLE_SIM_LOCK();
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_ADV_NUM; i++)
+    {
+        g_uhos_ble_sim_gap.adv[i].used = UHOS_FALSE;
+    }
+    UHOS_BLE_SIM_UNLOCK();
+}
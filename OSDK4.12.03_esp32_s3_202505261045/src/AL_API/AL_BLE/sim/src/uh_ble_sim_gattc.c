@@ -0,0 +1,705 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_sim_gattc.c
+ * @author agent (agent@local)
+ * @brief BLE模拟器：GATT Client（连接、服务发现、读写与通知）
+ * @details 同一链路同时只有一个未完成的ATT请求，请求在发出后的下一个连接事件完成；
+ *          服务发现按往返次数计时：服务数 + 1，每个服务的特征数 + 1，每个带描述符的特征的描述符数 + 1。
+ *          发现完成后esp_ble_gattc_get_*从虚拟对端的属性表返回结果。
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：BLE模拟器：GATT Client（连接、服务发现、读写与通知）
+ * </table>
+ */
+
+#define LOG_TAG "ble_sim_gattc"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_ble_sim_ctrl.h"
+#include "esp_gatt_common_api.h"
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static uhos_bool uhos_ble_sim_uuid_equal(const esp_bt_uuid_t *a, const esp_bt_uuid_t *b)
+{
+    if (a->len != b->len)
+    {
+        return UHOS_FALSE;
+    }
+
+    switch (a->len)
+    {
+    case ESP_UUID_LEN_16:
+        return (a->uuid.uuid16 == b->uuid.uuid16);
+    case ESP_UUID_LEN_32:
+        return (a->uuid.uuid32 == b->uuid.uuid32);
+    default:
+        return (0 == uhos_libc_memcmp(a->uuid.uuid128, b->uuid.uuid128, ESP_UUID_LEN_128));
+    }
+}
+
+static uhos_ble_sim_peer_ctx_t *uhos_ble_sim_gattc_peer(const uhos_ble_sim_link_t *link)
+{
+    return &g_uhos_ble_sim.peer[link->peer];
+}
+
+/**
+ * @brief       服务的结束句柄为下一个服务起始句柄减一，最后一个服务为0xFFFF
+ */
+static uhos_u16 uhos_ble_sim_gattc_svc_end(const uhos_ble_sim_peer_ctx_t *peer, uhos_u16 idx)
+{
+    uhos_u16 i = 0;
+
+    for (i = idx + 1; i < peer->attr_num; i++)
+    {
+        if (UHOS_BLE_SIM_ATTR_SERVICE == peer->attrs[i].type)
+        {
+            return peer->attrs[i].handle - 1;
+        }
+    }
+
+    return ESP_GATT_ATTR_HANDLE_MAX;
+}
+
+/**
+ * @brief       服务发现所需的往返次数
+ */
+static uhos_u16 uhos_ble_sim_gattc_search_rounds(const uhos_ble_sim_peer_ctx_t *peer)
+{
+    uhos_u16 rounds = 1;
+    uhos_u16 i = 0;
+    uhos_u8 prev = UHOS_BLE_SIM_ATTR_SERVICE;
+
+    for (i = 0; i < peer->attr_num; i++)
+    {
+        if (UHOS_BLE_SIM_ATTR_SERVICE == peer->attrs[i].type)
+        {
+            // 服务本身 + 该服务特征发现的结束
+            rounds += 2;
+        }
+        else if (UHOS_BLE_SIM_ATTR_CHAR == peer->attrs[i].type)
+        {
+            rounds += 1;
+        }
+        else
+        {
+            // 特征的第一个描述符另需一次描述符发现的结束
+            rounds += (UHOS_BLE_SIM_ATTR_CHAR == prev) ? 2 : 1;
+        }
+        prev = peer->attrs[i].type;
+    }
+
+    return rounds;
+}
+
+static void uhos_ble_sim_gattc_write_evt(uhos_ble_sim_link_t *link, const uhos_ble_sim_pdu_t *pdu,
+                                         esp_gatt_status_t status)
+{
+    uhos_ble_sim_evt_t *evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTC, pdu->gatt_if, ESP_GATTC_WRITE_CHAR_EVT);
+
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gattc.write.status  = status;
+        evt->param.gattc.write.conn_id = uhos_ble_sim_link_id(link);
+        evt->param.gattc.write.handle  = pdu->handle;
+    }
+}
+
+static void uhos_ble_sim_gattc_read_evt(uhos_ble_sim_link_t *link, const uhos_ble_sim_pdu_t *pdu,
+                                        const uhos_ble_sim_peer_attr_t *attr, esp_gatt_status_t status)
+{
+    uhos_ble_sim_evt_t *evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTC, pdu->gatt_if, ESP_GATTC_READ_CHAR_EVT);
+
+    if (UHOS_NULL == evt)
+    {
+        return;
+    }
+
+    evt->param.gattc.read.status  = status;
+    evt->param.gattc.read.conn_id = uhos_ble_sim_link_id(link);
+    evt->param.gattc.read.handle  = (UHOS_NULL != attr) ? attr->handle : pdu->handle;
+    if ((ESP_GATT_OK == status) && (UHOS_NULL != attr))
+    {
+        // 单个Read Response最多携带MTU-1字节
+        evt->param.gattc.read.value_len = (attr->len > link->mtu - 1) ? (link->mtu - 1) : attr->len;
+        uhos_libc_memcpy(evt->data, attr->value, evt->param.gattc.read.value_len);
+    }
+}
+
+static void uhos_ble_sim_gattc_search_done(uhos_ble_sim_link_t *link, const uhos_ble_sim_pdu_t *pdu)
+{
+    uhos_ble_sim_peer_ctx_t *peer = uhos_ble_sim_gattc_peer(link);
+    uhos_ble_sim_evt_t *evt       = UHOS_NULL;
+    uhos_u16 i = 0;
+
+    for (i = 0; i < peer->attr_num; i++)
+    {
+        if ((UHOS_BLE_SIM_ATTR_SERVICE != peer->attrs[i].type) ||
+            (pdu->has_uuid && !uhos_ble_sim_uuid_equal(&pdu->uuid, &peer->attrs[i].uuid)))
+        {
+            continue;
+        }
+
+        evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTC, pdu->gatt_if, ESP_GATTC_SEARCH_RES_EVT);
+        if (UHOS_NULL != evt)
+        {
+            evt->param.gattc.search_res.conn_id      = uhos_ble_sim_link_id(link);
+            evt->param.gattc.search_res.start_handle = peer->attrs[i].handle;
+            evt->param.gattc.search_res.end_handle   = uhos_ble_sim_gattc_svc_end(peer, i);
+            evt->param.gattc.search_res.is_primary   = UHOS_TRUE;
+            uhos_libc_memcpy(&evt->param.gattc.search_res.srvc_id.uuid, &peer->attrs[i].uuid, sizeof(esp_bt_uuid_t));
+        }
+    }
+
+    link->searched = UHOS_TRUE;
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTC, pdu->gatt_if, ESP_GATTC_SEARCH_CMPL_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gattc.search_cmpl.status                  = ESP_GATT_OK;
+        evt->param.gattc.search_cmpl.conn_id                 = uhos_ble_sim_link_id(link);
+        evt->param.gattc.search_cmpl.searched_service_source = ESP_GATT_SERVICE_FROM_REMOTE_DEVICE;
+    }
+}
+
+/**
+ * @brief       按连接ID取已完成服务发现的对端
+ */
+static uhos_ble_sim_peer_ctx_t *uhos_ble_sim_gattc_db(uhos_u16 conn_id)
+{
+    uhos_ble_sim_link_t *link = uhos_ble_sim_link_get_by_id(conn_id);
+
+    if ((UHOS_NULL == link) || !link->searched)
+    {
+        return UHOS_NULL;
+    }
+
+    return uhos_ble_sim_gattc_peer(link);
+}
+
+/**
+ * @brief       提交一个client请求
+ */
+static esp_err_t uhos_ble_sim_gattc_submit(esp_gatt_if_t gattc_if, uhos_u16 conn_id, uhos_u8 op, uhos_u16 handle,
+                                           uhos_u16 end_handle, const esp_bt_uuid_t *uuid, const uhos_u8 *value,
+                                           uhos_u16 len)
+{
+    uhos_ble_sim_link_t *link = UHOS_NULL;
+    uhos_ble_sim_pdu_t *pdu   = UHOS_NULL;
+
+    UHOS_BLE_SIM_LOCK();
+    link = uhos_ble_sim_link_get_by_id(conn_id);
+    if (UHOS_NULL == link)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (len > link->mtu - 3)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    pdu = uhos_ble_sim_link_tx_alloc(link, op);
+    if (UHOS_NULL == pdu)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_FAIL;
+    }
+    pdu->gatt_if    = gattc_if;
+    pdu->handle     = handle;
+    pdu->end_handle = end_handle;
+    pdu->len        = len;
+    if (UHOS_NULL != uuid)
+    {
+        pdu->has_uuid = UHOS_TRUE;
+        uhos_libc_memcpy(&pdu->uuid, uuid, sizeof(esp_bt_uuid_t));
+    }
+    if (0 != len)
+    {
+        uhos_libc_memcpy(pdu->data, value, len);
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+void uhos_ble_sim_gattc_reset(void)
+{
+    g_uhos_ble_sim.local_mtu = ESP_GATT_DEF_BLE_MTU_SIZE;
+}
+
+/**
+ * @brief       本端client的PDU发出
+ * @return      请求完成所需的连接事件数，写命令返回0
+ */
+uhos_u16 uhos_ble_sim_gattc_tx(uhos_ble_sim_link_t *link, const uhos_ble_sim_pdu_t *pdu)
+{
+    uhos_ble_sim_peer_ctx_t *peer  = uhos_ble_sim_gattc_peer(link);
+    uhos_ble_sim_peer_attr_t *attr = UHOS_NULL;
+    uhos_ble_addr_t addr;
+
+    switch (pdu->op)
+    {
+    case UHOS_BLE_SIM_PDU_WRITE_CMD:
+    case UHOS_BLE_SIM_PDU_WRITE_REQ:
+        attr = uhos_ble_sim_peer_attr_find(peer, pdu->handle);
+        if ((UHOS_NULL != attr) && (pdu->len <= CONFIG_UHOS_BLE_SIM_ATTR_LEN))
+        {
+            uhos_libc_memcpy(attr->value, pdu->data, pdu->len);
+            attr->len = pdu->len;
+        }
+        if (UHOS_NULL != g_uhos_ble_sim.peer_rx_cb)
+        {
+            uhos_ble_sim_addr_to_bda(peer->bda, addr);
+            g_uhos_ble_sim.peer_rx_cb(addr, (UHOS_BLE_SIM_PDU_WRITE_CMD == pdu->op) ? UHOS_BLE_SIM_PEER_RX_WRITE_CMD :
+                                      UHOS_BLE_SIM_PEER_RX_WRITE_REQ, pdu->handle, pdu->data, pdu->len);
+        }
+        if (UHOS_BLE_SIM_PDU_WRITE_CMD == pdu->op)
+        {
+            // 写命令无响应，发出即完成
+            uhos_ble_sim_gattc_write_evt(link, pdu, ESP_GATT_OK);
+            return 0;
+        }
+        return 1;
+
+    case UHOS_BLE_SIM_PDU_SEARCH:
+        return uhos_ble_sim_gattc_search_rounds(peer);
+
+    default:
+        return 1;
+    }
+}
+
+/**
+ * @brief       未完成的client请求收到响应
+ */
+void uhos_ble_sim_gattc_req_done(uhos_ble_sim_link_t *link)
+{
+    uhos_ble_sim_peer_ctx_t *peer  = uhos_ble_sim_gattc_peer(link);
+    uhos_ble_sim_pdu_t *req        = &link->req;
+    uhos_ble_sim_peer_attr_t *attr = UHOS_NULL;
+    uhos_ble_sim_evt_t *evt        = UHOS_NULL;
+    uhos_u16 i = 0;
+
+    switch (req->op)
+    {
+    case UHOS_BLE_SIM_PDU_WRITE_REQ:
+        attr = uhos_ble_sim_peer_attr_find(peer, req->handle);
+        uhos_ble_sim_gattc_write_evt(link, req, (UHOS_NULL != attr) ? ESP_GATT_OK : ESP_GATT_INVALID_HANDLE);
+        break;
+
+    case UHOS_BLE_SIM_PDU_READ:
+        attr = uhos_ble_sim_peer_attr_find(peer, req->handle);
+        uhos_ble_sim_gattc_read_evt(link, req, attr, (UHOS_NULL != attr) ? ESP_GATT_OK : ESP_GATT_INVALID_HANDLE);
+        break;
+
+    case UHOS_BLE_SIM_PDU_READ_BY_TYPE:
+        for (i = 0; i < peer->attr_num; i++)
+        {
+            if ((UHOS_BLE_SIM_ATTR_SERVICE != peer->attrs[i].type) &&
+                (peer->attrs[i].handle >= req->handle) && (peer->attrs[i].handle <= req->end_handle) &&
+                uhos_ble_sim_uuid_equal(&peer->attrs[i].uuid, &req->uuid))
+            {
+                attr = &peer->attrs[i];
+                break;
+            }
+        }
+        uhos_ble_sim_gattc_read_evt(link, req, attr, (UHOS_NULL != attr) ? ESP_GATT_OK : ESP_GATT_NOT_FOUND);
+        break;
+
+    case UHOS_BLE_SIM_PDU_MTU_REQ:
+        link->mtu = (peer->mtu < g_uhos_ble_sim.local_mtu) ? peer->mtu : g_uhos_ble_sim.local_mtu;
+
+        evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTC, req->gatt_if, ESP_GATTC_CFG_MTU_EVT);
+        if (UHOS_NULL != evt)
+        {
+            evt->param.gattc.cfg_mtu.status  = ESP_GATT_OK;
+            evt->param.gattc.cfg_mtu.conn_id = uhos_ble_sim_link_id(link);
+            evt->param.gattc.cfg_mtu.mtu     = link->mtu;
+        }
+
+        // MTU对链路上的server同样生效
+        evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTS, ESP_GATT_IF_NONE, ESP_GATTS_MTU_EVT);
+        if (UHOS_NULL != evt)
+        {
+            evt->param.gatts.mtu.conn_id = uhos_ble_sim_link_id(link);
+            evt->param.gatts.mtu.mtu     = link->mtu;
+        }
+        break;
+
+    case UHOS_BLE_SIM_PDU_SEARCH:
+        uhos_ble_sim_gattc_search_done(link, req);
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief       对端的通知或指示到达本端client
+ */
+void uhos_ble_sim_gattc_rx(uhos_ble_sim_link_t *link, const uhos_ble_sim_pdu_t *pdu)
+{
+    uhos_ble_sim_evt_t *evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTC, ESP_GATT_IF_NONE, ESP_GATTC_NOTIFY_EVT);
+
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gattc.notify.conn_id   = uhos_ble_sim_link_id(link);
+        evt->param.gattc.notify.handle    = pdu->handle;
+        evt->param.gattc.notify.value_len = pdu->len;
+        evt->param.gattc.notify.is_notify = (UHOS_BLE_SIM_PDU_PEER_NOTIFY == pdu->op);
+        uhos_libc_memcpy(evt->param.gattc.notify.remote_bda, uhos_ble_sim_gattc_peer(link)->bda, ESP_BD_ADDR_LEN);
+        uhos_libc_memcpy(evt->data, pdu->data, pdu->len);
+    }
+}
+
+/****************ESP-GATTC*******************/
+esp_err_t esp_ble_gatt_set_local_mtu(uint16_t mtu)
+{
+    if ((mtu < ESP_GATT_DEF_BLE_MTU_SIZE) || (mtu > ESP_GATT_MAX_MTU_SIZE))
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    uhos_ble_sim_ctl_init();
+
+    UHOS_BLE_SIM_LOCK();
+    g_uhos_ble_sim.local_mtu = mtu;
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gattc_register_callback(esp_gattc_cb_t callback)
+{
+    uhos_ble_sim_ctl_init();
+
+    UHOS_BLE_SIM_LOCK();
+    g_uhos_ble_sim.gattc_cb = callback;
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gattc_app_register(uint16_t app_id)
+{
+    return uhos_ble_sim_app_register(UHOS_BLE_SIM_EVT_GATTC, app_id);
+}
+
+esp_err_t esp_ble_gattc_app_unregister(esp_gatt_if_t gattc_if)
+{
+    return uhos_ble_sim_app_unregister(UHOS_BLE_SIM_EVT_GATTC, gattc_if);
+}
+
+esp_err_t esp_ble_gattc_open(esp_gatt_if_t gattc_if, esp_bd_addr_t remote_bda, esp_ble_addr_type_t remote_addr_type,
+                             bool is_direct)
+{
+    uhos_ble_sim_link_t *link = UHOS_NULL;
+    uhos_ble_sim_evt_t *evt   = UHOS_NULL;
+    uhos_s32 peer = 0;
+
+    (void)remote_addr_type;
+    (void)is_direct;
+
+    if (UHOS_NULL == remote_bda)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    peer = uhos_ble_sim_peer_find(remote_bda);
+    link = (peer >= 0) ? uhos_ble_sim_link_get_by_bda(remote_bda) : UHOS_NULL;
+    if ((peer >= 0) && (UHOS_NULL == link))
+    {
+        if (UHOS_NULL != uhos_ble_sim_link_open((uhos_u8)peer, UHOS_BLE_GAP_CENTRAL, gattc_if))
+        {
+            UHOS_BLE_SIM_UNLOCK();
+            return ESP_OK;
+        }
+    }
+
+    // 对端不存在、链路已满，或链路已由对端建立
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTC, gattc_if, ESP_GATTC_OPEN_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gattc.open.status = ESP_GATT_ERROR;
+        evt->param.gattc.open.mtu    = ESP_GATT_DEF_BLE_MTU_SIZE;
+        uhos_libc_memcpy(evt->param.gattc.open.remote_bda, remote_bda, ESP_BD_ADDR_LEN);
+        if ((UHOS_NULL != link) && (UHOS_BLE_SIM_LINK_CONNECTED == link->state))
+        {
+            evt->param.gattc.open.status  = ESP_GATT_OK;
+            evt->param.gattc.open.conn_id = uhos_ble_sim_link_id(link);
+            evt->param.gattc.open.mtu     = link->mtu;
+        }
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gattc_close(esp_gatt_if_t gattc_if, uint16_t conn_id)
+{
+    uhos_ble_sim_link_t *link = UHOS_NULL;
+
+    UHOS_BLE_SIM_LOCK();
+    link = uhos_ble_sim_link_get_by_id(conn_id);
+    if (UHOS_NULL == link)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+    link->open_if = gattc_if;
+    uhos_ble_sim_link_close(link, ESP_GATT_CONN_TERMINATE_LOCAL_HOST);
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gattc_send_mtu_req(esp_gatt_if_t gattc_if, uint16_t conn_id)
+{
+    return uhos_ble_sim_gattc_submit(gattc_if, conn_id, UHOS_BLE_SIM_PDU_MTU_REQ, 0, 0, UHOS_NULL, UHOS_NULL, 0);
+}
+
+esp_err_t esp_ble_gattc_search_service(esp_gatt_if_t gattc_if, uint16_t conn_id, esp_bt_uuid_t *filter_uuid)
+{
+    return uhos_ble_sim_gattc_submit(gattc_if, conn_id, UHOS_BLE_SIM_PDU_SEARCH, 0, 0, filter_uuid, UHOS_NULL, 0);
+}
+
+esp_gatt_status_t esp_ble_gattc_get_service(esp_gatt_if_t gattc_if, uint16_t conn_id, esp_bt_uuid_t *svc_uuid,
+                                            esp_gattc_service_elem_t *result, uint16_t *count, uint16_t offset)
+{
+    uhos_ble_sim_peer_ctx_t *peer = UHOS_NULL;
+    uhos_u16 i = 0, n = 0, found = 0;
+
+    (void)gattc_if;
+
+    if ((UHOS_NULL == result) || (UHOS_NULL == count) || (0 == *count))
+    {
+        return ESP_GATT_ILLEGAL_PARAMETER;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    peer = uhos_ble_sim_gattc_db(conn_id);
+    for (i = 0; (UHOS_NULL != peer) && (i < peer->attr_num); i++)
+    {
+        if ((UHOS_BLE_SIM_ATTR_SERVICE != peer->attrs[i].type) ||
+            ((UHOS_NULL != svc_uuid) && !uhos_ble_sim_uuid_equal(svc_uuid, &peer->attrs[i].uuid)))
+        {
+            continue;
+        }
+
+        if ((found++ >= offset) && (n < *count))
+        {
+            result[n].is_primary   = UHOS_TRUE;
+            result[n].start_handle = peer->attrs[i].handle;
+            result[n].end_handle   = uhos_ble_sim_gattc_svc_end(peer, i);
+            uhos_libc_memcpy(&result[n].uuid, &peer->attrs[i].uuid, sizeof(esp_bt_uuid_t));
+            n++;
+        }
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    *count = n;
+    if (0 == found)
+    {
+        return ESP_GATT_NOT_FOUND;
+    }
+
+    return (offset >= found) ? ESP_GATT_INVALID_OFFSET : ESP_GATT_OK;
+}
+
+esp_gatt_status_t esp_ble_gattc_get_all_char(esp_gatt_if_t gattc_if, uint16_t conn_id, uint16_t start_handle,
+                                             uint16_t end_handle, esp_gattc_char_elem_t *result,
+                                             uint16_t *count, uint16_t offset)
+{
+    uhos_ble_sim_peer_ctx_t *peer = UHOS_NULL;
+    uhos_u16 i = 0, n = 0, found = 0;
+
+    (void)gattc_if;
+
+    if ((UHOS_NULL == result) || (UHOS_NULL == count) || (0 == *count) || (start_handle > end_handle))
+    {
+        return ESP_GATT_ILLEGAL_PARAMETER;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    peer = uhos_ble_sim_gattc_db(conn_id);
+    for (i = 0; (UHOS_NULL != peer) && (i < peer->attr_num); i++)
+    {
+        if ((UHOS_BLE_SIM_ATTR_CHAR != peer->attrs[i].type) ||
+            (peer->attrs[i].handle < start_handle) || (peer->attrs[i].handle > end_handle))
+        {
+            continue;
+        }
+
+        if ((found++ >= offset) && (n < *count))
+        {
+            result[n].char_handle = peer->attrs[i].handle;
+            result[n].properties  = peer->attrs[i].props;
+            uhos_libc_memcpy(&result[n].uuid, &peer->attrs[i].uuid, sizeof(esp_bt_uuid_t));
+            n++;
+        }
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    *count = n;
+    if (0 == found)
+    {
+        return ESP_GATT_NOT_FOUND;
+    }
+
+    return (offset >= found) ? ESP_GATT_INVALID_OFFSET : ESP_GATT_OK;
+}
+
+esp_gatt_status_t esp_ble_gattc_get_all_descr(esp_gatt_if_t gattc_if, uint16_t conn_id, uint16_t char_handle,
+                                              esp_gattc_descr_elem_t *result, uint16_t *count, uint16_t offset)
+{
+    uhos_ble_sim_peer_ctx_t *peer = UHOS_NULL;
+    uhos_bool in_char             = UHOS_FALSE;
+    uhos_u16 i = 0, n = 0, found = 0;
+
+    (void)gattc_if;
+
+    if ((UHOS_NULL == result) || (UHOS_NULL == count) || (0 == *count))
+    {
+        return ESP_GATT_ILLEGAL_PARAMETER;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    peer = uhos_ble_sim_gattc_db(conn_id);
+    for (i = 0; (UHOS_NULL != peer) && (i < peer->attr_num); i++)
+    {
+        if (UHOS_BLE_SIM_ATTR_DESC != peer->attrs[i].type)
+        {
+            // 描述符属于其前面最近的特征
+            in_char = (UHOS_BLE_SIM_ATTR_CHAR == peer->attrs[i].type) && (peer->attrs[i].handle == char_handle);
+            continue;
+        }
+        if (!in_char)
+        {
+            continue;
+        }
+
+        if ((found++ >= offset) && (n < *count))
+        {
+            result[n].handle = peer->attrs[i].handle;
+            uhos_libc_memcpy(&result[n].uuid, &peer->attrs[i].uuid, sizeof(esp_bt_uuid_t));
+            n++;
+        }
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    *count = n;
+    if (0 == found)
+    {
+        return ESP_GATT_NOT_FOUND;
+    }
+
+    return (offset >= found) ? ESP_GATT_INVALID_OFFSET : ESP_GATT_OK;
+}
+
+esp_gatt_status_t esp_ble_gattc_get_char_by_uuid(esp_gatt_if_t gattc_if, uint16_t conn_id, uint16_t start_handle,
+                                                 uint16_t end_handle, esp_bt_uuid_t char_uuid,
+                                                 esp_gattc_char_elem_t *result, uint16_t *count)
+{
+    uhos_ble_sim_peer_ctx_t *peer = UHOS_NULL;
+    uhos_u16 i = 0, n = 0;
+
+    (void)gattc_if;
+
+    if ((UHOS_NULL == result) || (UHOS_NULL == count) || (0 == *count) || (start_handle > end_handle))
+    {
+        return ESP_GATT_ILLEGAL_PARAMETER;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    peer = uhos_ble_sim_gattc_db(conn_id);
+    for (i = 0; (UHOS_NULL != peer) && (i < peer->attr_num) && (n < *count); i++)
+    {
+        if ((UHOS_BLE_SIM_ATTR_CHAR == peer->attrs[i].type) &&
+            (peer->attrs[i].handle >= start_handle) && (peer->attrs[i].handle <= end_handle) &&
+            uhos_ble_sim_uuid_equal(&char_uuid, &peer->attrs[i].uuid))
+        {
+            result[n].char_handle = peer->attrs[i].handle;
+            result[n].properties  = peer->attrs[i].props;
+            uhos_libc_memcpy(&result[n].uuid, &peer->attrs[i].uuid, sizeof(esp_bt_uuid_t));
+            n++;
+        }
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    *count = n;
+
+    return (0 != n) ? ESP_GATT_OK : ESP_GATT_NOT_FOUND;
+}
+
+esp_err_t esp_ble_gattc_read_char(esp_gatt_if_t gattc_if, uint16_t conn_id, uint16_t handle,
+                                  esp_gatt_auth_req_t auth_req)
+{
+    (void)auth_req;
+
+    return uhos_ble_sim_gattc_submit(gattc_if, conn_id, UHOS_BLE_SIM_PDU_READ, handle, 0, UHOS_NULL, UHOS_NULL, 0);
+}
+
+esp_err_t esp_ble_gattc_read_by_type(esp_gatt_if_t gattc_if, uint16_t conn_id, uint16_t start_handle,
+                                     uint16_t end_handle, esp_bt_uuid_t *uuid, esp_gatt_auth_req_t auth_req)
+{
+    (void)auth_req;
+
+    if ((UHOS_NULL == uuid) || (start_handle > end_handle))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    return uhos_ble_sim_gattc_submit(gattc_if, conn_id, UHOS_BLE_SIM_PDU_READ_BY_TYPE, start_handle, end_handle, uuid,
+                                     UHOS_NULL, 0);
+}
+
+esp_err_t esp_ble_gattc_write_char(esp_gatt_if_t gattc_if, uint16_t conn_id, uint16_t handle, uint16_t value_len,
+                                   uint8_t *value, esp_gatt_write_type_t write_type, esp_gatt_auth_req_t auth_req)
+{
+    (void)auth_req;
+
+    if ((0 != value_len) && (UHOS_NULL == value))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    return uhos_ble_sim_gattc_submit(gattc_if, conn_id,
+                                     (ESP_GATT_WRITE_TYPE_NO_RSP == write_type) ? UHOS_BLE_SIM_PDU_WRITE_CMD :
+                                     UHOS_BLE_SIM_PDU_WRITE_REQ, handle, 0, UHOS_NULL, value, value_len);
+}
+
+esp_err_t esp_ble_gattc_register_for_notify(esp_gatt_if_t gattc_if, esp_bd_addr_t server_bda, uint16_t handle)
+{
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+
+    if (UHOS_NULL == server_bda)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTC, gattc_if, ESP_GATTC_REG_FOR_NOTIFY_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gattc.reg_for_notify.status = ESP_GATT_OK;
+        evt->param.gattc.reg_for_notify.handle = handle;
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
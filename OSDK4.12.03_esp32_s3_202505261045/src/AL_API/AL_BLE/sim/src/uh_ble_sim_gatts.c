@@ -0,0 +1,780 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_sim_gatts.c
+ * @author agent (agent@local)
+ * @brief BLE模拟器：GATT Server（本端属性数据库、通知与指示）
+ * @details create_service按num_handle预留句柄区间，特征声明与特征值各占一个句柄；
+ *          create_attr_tab按属性表顺序连续分配句柄，每个属性占一个句柄；
+ *          通知在发出的连接事件内上报CONF_EVT，指示在下一个连接事件收到确认后上报CONF_EVT，
+ *          同一链路同时只有一个未确认的指示。
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：BLE模拟器：GATT Server（本端属性数据库、通知与指示）
+ * </table>
+ */
+
+#define LOG_TAG "ble_sim_gatts"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_ble_sim_ctrl.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define UHOS_BLE_SIM_SVC_NUM                8           //<! 本端服务个数上限
+#define UHOS_BLE_SIM_FIRST_HANDLE           0x0028      //<! 应用服务的起始句柄，之前的句柄保留给GAP/GATT服务
+#define UHOS_BLE_SIM_READ_TRANS_FLAG        0x80000000  //<! 读请求的事务ID标记，应用回复时据此将数据返回对端
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      本端服务
+ */
+typedef struct uhos_ble_sim_svc
+{
+    uhos_bool     used;
+    esp_gatt_if_t gatt_if;                                      //<! 创建服务的应用
+    uhos_u16      handle;                                       //<! 服务起始句柄
+    uhos_u16      end_handle;                                   //<! 预留区间的结束句柄
+    uhos_u16      cursor;                                       //<! 下一个可分配的句柄
+} uhos_ble_sim_svc_t;
+
+/**
+ * @struct      本端属性（特征值或描述符）
+ */
+typedef struct uhos_ble_sim_local_attr
+{
+    uhos_bool     used;
+    uhos_bool     auto_rsp;                                     //<! 由协议栈保存写入值
+    uhos_u16      handle;
+    uhos_u16      svc_handle;
+    uhos_u16      len;
+    uhos_u8       value[CONFIG_UHOS_BLE_SIM_ATTR_LEN];
+} uhos_ble_sim_local_attr_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_ble_sim_svc_t        g_uhos_ble_sim_svc[UHOS_BLE_SIM_SVC_NUM];
+static uhos_ble_sim_local_attr_t g_uhos_ble_sim_attr[CONFIG_UHOS_BLE_SIM_LOCAL_ATTR_NUM];
+static uhos_u16                  g_uhos_ble_sim_next_handle = UHOS_BLE_SIM_FIRST_HANDLE;
+static uhos_u32                  g_uhos_ble_sim_trans_id;
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static uhos_ble_sim_svc_t *uhos_ble_sim_svc_find(uhos_u16 handle)
+{
+    uhos_u8 i = 0;
+
+    for (i = 0; i < UHOS_BLE_SIM_SVC_NUM; i++)
+    {
+        if (g_uhos_ble_sim_svc[i].used && (g_uhos_ble_sim_svc[i].handle == handle))
+        {
+            return &g_uhos_ble_sim_svc[i];
+        }
+    }
+
+    return UHOS_NULL;
+}
+
+static uhos_ble_sim_local_attr_t *uhos_ble_sim_local_attr_find(uhos_u16 handle)
+{
+    uhos_u16 i = 0;
+
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_LOCAL_ATTR_NUM; i++)
+    {
+        if (g_uhos_ble_sim_attr[i].used && (g_uhos_ble_sim_attr[i].handle == handle))
+        {
+            return &g_uhos_ble_sim_attr[i];
+        }
+    }
+
+    return UHOS_NULL;
+}
+
+/**
+ * @brief       在服务的句柄区间内分配属性
+ * @param[in]   num     占用的句柄数，特征为2（声明 + 值），描述符为1
+ */
+static uhos_ble_sim_local_attr_t *uhos_ble_sim_local_attr_alloc(uhos_ble_sim_svc_t *svc, uhos_u16 num,
+                                                                esp_attr_value_t *val, esp_attr_control_t *control)
+{
+    uhos_ble_sim_local_attr_t *attr = UHOS_NULL;
+    uhos_u16 i = 0;
+
+    if (svc->cursor + num - 1 > svc->end_handle)
+    {
+        return UHOS_NULL;
+    }
+
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_LOCAL_ATTR_NUM; i++)
+    {
+        if (!g_uhos_ble_sim_attr[i].used)
+        {
+            attr = &g_uhos_ble_sim_attr[i];
+            break;
+        }
+    }
+    if (UHOS_NULL == attr)
+    {
+        return UHOS_NULL;
+    }
+
+    uhos_libc_memset(attr, 0, sizeof(uhos_ble_sim_local_attr_t));
+    attr->used       = UHOS_TRUE;
+    attr->handle     = svc->cursor + num - 1;
+    attr->svc_handle = svc->handle;
+    attr->auto_rsp   = (UHOS_NULL == control) || (ESP_GATT_AUTO_RSP == control->auto_rsp);
+    if ((UHOS_NULL != val) && (UHOS_NULL != val->attr_value))
+    {
+        attr->len = (val->attr_len > CONFIG_UHOS_BLE_SIM_ATTR_LEN) ? CONFIG_UHOS_BLE_SIM_ATTR_LEN : val->attr_len;
+        uhos_libc_memcpy(attr->value, val->attr_value, attr->len);
+    }
+    svc->cursor += num;
+
+    return attr;
+}
+
+static void uhos_ble_sim_gatts_conf_evt(uhos_ble_sim_link_t *link, const uhos_ble_sim_pdu_t *pdu)
+{
+    uhos_ble_sim_evt_t *evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTS, pdu->gatt_if, ESP_GATTS_CONF_EVT);
+
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gatts.conf.status  = ESP_GATT_OK;
+        evt->param.gatts.conf.conn_id = uhos_ble_sim_link_id(link);
+        evt->param.gatts.conf.handle  = pdu->handle;
+        evt->param.gatts.conf.len     = pdu->len;
+        uhos_libc_memcpy(evt->data, pdu->data, pdu->len);
+    }
+}
+
+static void uhos_ble_sim_gatts_peer_rx(uhos_ble_sim_link_t *link, uhos_ble_sim_peer_rx_t type,
+                                       const uhos_ble_sim_pdu_t *pdu)
+{
+    uhos_ble_addr_t addr;
+
+    if (UHOS_NULL != g_uhos_ble_sim.peer_rx_cb)
+    {
+        uhos_ble_sim_addr_to_bda(g_uhos_ble_sim.peer[link->peer].bda, addr);
+        g_uhos_ble_sim.peer_rx_cb(addr, type, pdu->handle, pdu->data, pdu->len);
+    }
+}
+
+/**
+ * @brief       对端读本端属性：协议栈自动响应的属性直接回复，否则上报READ_EVT等待应用回复
+ */
+static void uhos_ble_sim_gatts_peer_read(uhos_ble_sim_link_t *link, const uhos_ble_sim_svc_t *svc,
+                                         const uhos_ble_sim_local_attr_t *attr)
+{
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+    uhos_ble_sim_pdu_t rsp;
+    uhos_u16 len            = 0;
+
+    if (attr->auto_rsp)
+    {
+        len        = (attr->len > link->mtu - 1) ? (link->mtu - 1) : attr->len;
+        rsp.handle = attr->handle;
+        rsp.len    = len;
+        uhos_libc_memcpy(rsp.data, attr->value, len);
+        uhos_ble_sim_gatts_peer_rx(link, UHOS_BLE_SIM_PEER_RX_READ_RSP, &rsp);
+        return;
+    }
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTS, svc->gatt_if, ESP_GATTS_READ_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gatts.read.conn_id  = uhos_ble_sim_link_id(link);
+        evt->param.gatts.read.trans_id = (++g_uhos_ble_sim_trans_id) | UHOS_BLE_SIM_READ_TRANS_FLAG;
+        evt->param.gatts.read.handle   = attr->handle;
+        evt->param.gatts.read.need_rsp = true;
+        uhos_libc_memcpy(evt->param.gatts.read.bda, g_uhos_ble_sim.peer[link->peer].bda, ESP_BD_ADDR_LEN);
+    }
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+void uhos_ble_sim_gatts_reset(void)
+{
+    uhos_libc_memset(g_uhos_ble_sim_svc, 0, sizeof(g_uhos_ble_sim_svc));
+    uhos_libc_memset(g_uhos_ble_sim_attr, 0, sizeof(g_uhos_ble_sim_attr));
+    g_uhos_ble_sim_next_handle = UHOS_BLE_SIM_FIRST_HANDLE;
+}
+
+/**
+ * @brief       本端server的通知或指示到达对端
+ */
+void uhos_ble_sim_gatts_tx(uhos_ble_sim_link_t *link, const uhos_ble_sim_pdu_t *pdu)
+{
+    if (UHOS_BLE_SIM_PDU_NOTIFY == pdu->op)
+    {
+        uhos_ble_sim_gatts_peer_rx(link, UHOS_BLE_SIM_PEER_RX_NOTIFY, pdu);
+        uhos_ble_sim_gatts_conf_evt(link, pdu);
+        return;
+    }
+
+    uhos_ble_sim_gatts_peer_rx(link, UHOS_BLE_SIM_PEER_RX_INDICATE, pdu);
+    uhos_libc_memcpy(&link->ind, pdu, sizeof(uhos_ble_sim_pdu_t));
+    link->ind_pending = UHOS_TRUE;
+}
+
+void uhos_ble_sim_gatts_ind_confirm(uhos_ble_sim_link_t *link)
+{
+    uhos_ble_sim_gatts_conf_evt(link, &link->ind);
+}
+
+/**
+ * @brief       对端的写、读或MTU请求到达本端server
+ */
+void uhos_ble_sim_gatts_rx(uhos_ble_sim_link_t *link, const uhos_ble_sim_pdu_t *pdu)
+{
+    uhos_ble_sim_local_attr_t *attr = UHOS_NULL;
+    uhos_ble_sim_svc_t *svc         = UHOS_NULL;
+    uhos_ble_sim_evt_t *evt         = UHOS_NULL;
+    uhos_u16 mtu                    = 0;
+
+    if (UHOS_BLE_SIM_PDU_PEER_MTU_REQ == pdu->op)
+    {
+        mtu       = (uhos_u16)(pdu->data[0] | (pdu->data[1] << 8));
+        link->mtu = (mtu < g_uhos_ble_sim.local_mtu) ? mtu : g_uhos_ble_sim.local_mtu;
+
+        evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTS, ESP_GATT_IF_NONE, ESP_GATTS_MTU_EVT);
+        if (UHOS_NULL != evt)
+        {
+            evt->param.gatts.mtu.conn_id = uhos_ble_sim_link_id(link);
+            evt->param.gatts.mtu.mtu     = link->mtu;
+        }
+        return;
+    }
+
+    // 句柄无效时协议栈直接回复错误，不上报应用
+    attr = uhos_ble_sim_local_attr_find(pdu->handle);
+    svc  = (UHOS_NULL != attr) ? uhos_ble_sim_svc_find(attr->svc_handle) : UHOS_NULL;
+    if (UHOS_NULL == svc)
+    {
+        UHOS_LOGW("peer access invalid handle %d", pdu->handle);
+        return;
+    }
+
+    if (UHOS_BLE_SIM_PDU_PEER_READ == pdu->op)
+    {
+        uhos_ble_sim_gatts_peer_read(link, svc, attr);
+        return;
+    }
+
+    if (attr->auto_rsp && (pdu->len <= CONFIG_UHOS_BLE_SIM_ATTR_LEN))
+    {
+        uhos_libc_memcpy(attr->value, pdu->data, pdu->len);
+        attr->len = pdu->len;
+    }
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTS, svc->gatt_if, ESP_GATTS_WRITE_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gatts.write.conn_id  = uhos_ble_sim_link_id(link);
+        evt->param.gatts.write.trans_id = (++g_uhos_ble_sim_trans_id) & ~UHOS_BLE_SIM_READ_TRANS_FLAG;
+        evt->param.gatts.write.handle   = pdu->handle;
+        evt->param.gatts.write.need_rsp = (UHOS_BLE_SIM_PDU_PEER_WRITE_REQ == pdu->op);
+        evt->param.gatts.write.len      = pdu->len;
+        uhos_libc_memcpy(evt->param.gatts.write.bda, g_uhos_ble_sim.peer[link->peer].bda, ESP_BD_ADDR_LEN);
+        uhos_libc_memcpy(evt->data, pdu->data, pdu->len);
+    }
+}
+
+/****************ESP-GATTS*******************/
+esp_err_t esp_ble_gatts_register_callback(esp_gatts_cb_t callback)
+{
+    uhos_ble_sim_ctl_init();
+
+    UHOS_BLE_SIM_LOCK();
+    g_uhos_ble_sim.gatts_cb = callback;
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gatts_app_register(uint16_t app_id)
+{
+    return uhos_ble_sim_app_register(UHOS_BLE_SIM_EVT_GATTS, app_id);
+}
+
+esp_err_t esp_ble_gatts_app_unregister(esp_gatt_if_t gatts_if)
+{
+    return uhos_ble_sim_app_unregister(UHOS_BLE_SIM_EVT_GATTS, gatts_if);
+}
+
+esp_err_t esp_ble_gatts_create_service(esp_gatt_if_t gatts_if, esp_gatt_srvc_id_t *service_id, uint16_t num_handle)
+{
+    uhos_ble_sim_svc_t *svc = UHOS_NULL;
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+    uhos_u8 i = 0;
+
+    if ((UHOS_NULL == service_id) || (0 == num_handle))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    for (i = 0; i < UHOS_BLE_SIM_SVC_NUM; i++)
+    {
+        if (!g_uhos_ble_sim_svc[i].used)
+        {
+            svc = &g_uhos_ble_sim_svc[i];
+            break;
+        }
+    }
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTS, gatts_if, ESP_GATTS_CREATE_EVT);
+    if ((UHOS_NULL == svc) || ((uhos_u32)g_uhos_ble_sim_next_handle + num_handle - 1 > ESP_GATT_ATTR_HANDLE_MAX))
+    {
+        if (UHOS_NULL != evt)
+        {
+            evt->param.gatts.create.status = ESP_GATT_NO_RESOURCES;
+            uhos_libc_memcpy(&evt->param.gatts.create.service_id, service_id, sizeof(esp_gatt_srvc_id_t));
+        }
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_OK;
+    }
+
+    svc->used                   = UHOS_TRUE;
+    svc->gatt_if                = gatts_if;
+    svc->handle                 = g_uhos_ble_sim_next_handle;
+    svc->end_handle             = g_uhos_ble_sim_next_handle + num_handle - 1;
+    svc->cursor                 = svc->handle + 1;
+    g_uhos_ble_sim_next_handle += num_handle;
+
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gatts.create.status         = ESP_GATT_OK;
+        evt->param.gatts.create.service_handle = svc->handle;
+        uhos_libc_memcpy(&evt->param.gatts.create.service_id, service_id, sizeof(esp_gatt_srvc_id_t));
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+/**
+ * @note        第一个属性须为服务声明；每个属性占一个句柄，句柄表随CREAT_ATTR_TAB_EVT上报
+ */
+esp_err_t esp_ble_gatts_create_attr_tab(const esp_gatts_attr_db_t *gatts_attr_db, esp_gatt_if_t gatts_if,
+                                        uint16_t max_nb_attr, uint8_t srvc_inst_id)
+{
+    const esp_attr_desc_t *desc     = UHOS_NULL;
+    uhos_ble_sim_local_attr_t *attr = UHOS_NULL;
+    uhos_ble_sim_svc_t *svc         = UHOS_NULL;
+    uhos_ble_sim_evt_t *evt         = UHOS_NULL;
+    uhos_u16 *handles               = UHOS_NULL;
+    esp_attr_value_t val;
+    uhos_u16 uuid16 = 0;
+    uhos_u16 i      = 0;
+
+    if ((UHOS_NULL == gatts_attr_db) || (0 == max_nb_attr) || (max_nb_attr > UHOS_BLE_SIM_PDU_LEN / 2))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    desc   = &gatts_attr_db[0].att_desc;
+    uuid16 = (ESP_UUID_LEN_16 == desc->uuid_length) ? (uhos_u16)(desc->uuid_p[0] | (desc->uuid_p[1] << 8)) : 0;
+    if ((ESP_GATT_UUID_PRI_SERVICE != uuid16) && (ESP_GATT_UUID_SEC_SERVICE != uuid16))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if ((ESP_UUID_LEN_16 != desc->length) && (ESP_UUID_LEN_128 != desc->length))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTS, gatts_if, ESP_GATTS_CREAT_ATTR_TAB_EVT);
+    if (UHOS_NULL == evt)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_FAIL;
+    }
+    evt->param.gatts.add_attr_tab.status       = ESP_GATT_NO_RESOURCES;
+    evt->param.gatts.add_attr_tab.svc_inst_id  = srvc_inst_id;
+    evt->param.gatts.add_attr_tab.svc_uuid.len = desc->length;
+    uhos_libc_memcpy(&evt->param.gatts.add_attr_tab.svc_uuid.uuid, desc->value, desc->length);
+
+    for (i = 0; i < UHOS_BLE_SIM_SVC_NUM; i++)
+    {
+        if (!g_uhos_ble_sim_svc[i].used)
+        {
+            svc = &g_uhos_ble_sim_svc[i];
+            break;
+        }
+    }
+    if ((UHOS_NULL == svc) || ((uhos_u32)g_uhos_ble_sim_next_handle + max_nb_attr - 1 > ESP_GATT_ATTR_HANDLE_MAX))
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_OK;
+    }
+
+    svc->used       = UHOS_TRUE;
+    svc->gatt_if    = gatts_if;
+    svc->handle     = g_uhos_ble_sim_next_handle;
+    svc->end_handle = g_uhos_ble_sim_next_handle + max_nb_attr - 1;
+    svc->cursor     = svc->handle + 1;
+
+    // 服务声明之外的属性（含特征声明）都保存属性值，可被对端读取
+    handles    = (uhos_u16 *)evt->data;
+    handles[0] = svc->handle;
+    for (i = 1; i < max_nb_attr; i++)
+    {
+        desc             = &gatts_attr_db[i].att_desc;
+        val.attr_max_len = desc->max_length;
+        val.attr_len     = desc->length;
+        val.attr_value   = desc->value;
+        attr = uhos_ble_sim_local_attr_alloc(svc, 1, &val, (esp_attr_control_t *)&gatts_attr_db[i].attr_control);
+        if (UHOS_NULL == attr)
+        {
+            break;
+        }
+        handles[i] = attr->handle;
+    }
+
+    if (i < max_nb_attr)
+    {
+        // 属性资源不足，回收已分配的属性
+        for (i = 0; i < CONFIG_UHOS_BLE_SIM_LOCAL_ATTR_NUM; i++)
+        {
+            if (g_uhos_ble_sim_attr[i].used && (g_uhos_ble_sim_attr[i].svc_handle == svc->handle))
+            {
+                g_uhos_ble_sim_attr[i].used = UHOS_FALSE;
+            }
+        }
+        svc->used = UHOS_FALSE;
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_OK;
+    }
+
+    g_uhos_ble_sim_next_handle              += max_nb_attr;
+    evt->param.gatts.add_attr_tab.status     = ESP_GATT_OK;
+    evt->param.gatts.add_attr_tab.num_handle = max_nb_attr;
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gatts_add_char(uint16_t service_handle, esp_bt_uuid_t *char_uuid, esp_gatt_perm_t perm,
+                                 esp_gatt_char_prop_t property, esp_attr_value_t *char_val,
+                                 esp_attr_control_t *control)
+{
+    uhos_ble_sim_local_attr_t *attr = UHOS_NULL;
+    uhos_ble_sim_svc_t *svc         = UHOS_NULL;
+    uhos_ble_sim_evt_t *evt         = UHOS_NULL;
+
+    (void)perm;
+    (void)property;
+
+    if (UHOS_NULL == char_uuid)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    svc = uhos_ble_sim_svc_find(service_handle);
+    if (UHOS_NULL == svc)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    attr = uhos_ble_sim_local_attr_alloc(svc, 2, char_val, control);
+    evt  = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTS, svc->gatt_if, ESP_GATTS_ADD_CHAR_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gatts.add_char.status         = (UHOS_NULL != attr) ? ESP_GATT_OK : ESP_GATT_NO_RESOURCES;
+        evt->param.gatts.add_char.attr_handle    = (UHOS_NULL != attr) ? attr->handle : 0;
+        evt->param.gatts.add_char.service_handle = service_handle;
+        uhos_libc_memcpy(&evt->param.gatts.add_char.char_uuid, char_uuid, sizeof(esp_bt_uuid_t));
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gatts_add_char_descr(uint16_t service_handle, esp_bt_uuid_t *descr_uuid, esp_gatt_perm_t perm,
+                                       esp_attr_value_t *char_descr_val, esp_attr_control_t *control)
+{
+    uhos_ble_sim_local_attr_t *attr = UHOS_NULL;
+    uhos_ble_sim_svc_t *svc         = UHOS_NULL;
+    uhos_ble_sim_evt_t *evt         = UHOS_NULL;
+
+    (void)perm;
+
+    if (UHOS_NULL == descr_uuid)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    svc = uhos_ble_sim_svc_find(service_handle);
+    if (UHOS_NULL == svc)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    attr = uhos_ble_sim_local_attr_alloc(svc, 1, char_descr_val, control);
+    evt  = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTS, svc->gatt_if, ESP_GATTS_ADD_CHAR_DESCR_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gatts.add_char_descr.status         = (UHOS_NULL != attr) ? ESP_GATT_OK : ESP_GATT_NO_RESOURCES;
+        evt->param.gatts.add_char_descr.attr_handle    = (UHOS_NULL != attr) ? attr->handle : 0;
+        evt->param.gatts.add_char_descr.service_handle = service_handle;
+        uhos_libc_memcpy(&evt->param.gatts.add_char_descr.descr_uuid, descr_uuid, sizeof(esp_bt_uuid_t));
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gatts_delete_service(uint16_t service_handle)
+{
+    uhos_ble_sim_svc_t *svc = UHOS_NULL;
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+    uhos_u16 i = 0;
+
+    UHOS_BLE_SIM_LOCK();
+    svc = uhos_ble_sim_svc_find(service_handle);
+    if (UHOS_NULL == svc)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    for (i = 0; i < CONFIG_UHOS_BLE_SIM_LOCAL_ATTR_NUM; i++)
+    {
+        if (g_uhos_ble_sim_attr[i].svc_handle == service_handle)
+        {
+            g_uhos_ble_sim_attr[i].used = UHOS_FALSE;
+        }
+    }
+    svc->used = UHOS_FALSE;
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTS, svc->gatt_if, ESP_GATTS_DELETE_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gatts.del.status         = ESP_GATT_OK;
+        evt->param.gatts.del.service_handle = service_handle;
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gatts_start_service(uint16_t service_handle)
+{
+    uhos_ble_sim_svc_t *svc = UHOS_NULL;
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+
+    UHOS_BLE_SIM_LOCK();
+    svc = uhos_ble_sim_svc_find(service_handle);
+    if (UHOS_NULL == svc)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTS, svc->gatt_if, ESP_GATTS_START_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gatts.start.status         = ESP_GATT_OK;
+        evt->param.gatts.start.service_handle = service_handle;
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gatts_stop_service(uint16_t service_handle)
+{
+    uhos_ble_sim_svc_t *svc = UHOS_NULL;
+    uhos_ble_sim_evt_t *evt = UHOS_NULL;
+
+    UHOS_BLE_SIM_LOCK();
+    svc = uhos_ble_sim_svc_find(service_handle);
+    if (UHOS_NULL == svc)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTS, svc->gatt_if, ESP_GATTS_STOP_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gatts.stop.status         = ESP_GATT_OK;
+        evt->param.gatts.stop.service_handle = service_handle;
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+/**
+ * @note        超过MTU-3的数据被截断；发送队列满返回ESP_FAIL，由调用者稍后重试
+ */
+esp_err_t esp_ble_gatts_send_indicate(esp_gatt_if_t gatts_if, uint16_t conn_id, uint16_t attr_handle,
+                                      uint16_t value_len, uint8_t *value, bool need_confirm)
+{
+    uhos_ble_sim_link_t *link = UHOS_NULL;
+    uhos_ble_sim_pdu_t *pdu   = UHOS_NULL;
+
+    if ((0 != value_len) && (UHOS_NULL == value))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    link = uhos_ble_sim_link_get_by_id(conn_id);
+    if (UHOS_NULL == link)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    pdu = uhos_ble_sim_link_tx_alloc(link, need_confirm ? UHOS_BLE_SIM_PDU_INDICATE : UHOS_BLE_SIM_PDU_NOTIFY);
+    if (UHOS_NULL == pdu)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_FAIL;
+    }
+    pdu->gatt_if = gatts_if;
+    pdu->handle  = attr_handle;
+    pdu->len     = (value_len > link->mtu - 3) ? (link->mtu - 3) : value_len;
+    uhos_libc_memcpy(pdu->data, value, pdu->len);
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gatts_send_response(esp_gatt_if_t gatts_if, uint16_t conn_id, uint32_t trans_id,
+                                      esp_gatt_status_t status, esp_gatt_rsp_t *rsp)
+{
+    uhos_ble_sim_link_t *link = UHOS_NULL;
+    uhos_ble_sim_evt_t *evt   = UHOS_NULL;
+    uhos_ble_sim_pdu_t pdu;
+
+    UHOS_BLE_SIM_LOCK();
+    link = uhos_ble_sim_link_get_by_id(conn_id);
+    if (UHOS_NULL == link)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // 读请求的回复发往对端，写请求的回复只影响对端的流控，不单独建模
+    if ((trans_id & UHOS_BLE_SIM_READ_TRANS_FLAG) && (ESP_GATT_OK == status) && (UHOS_NULL != rsp))
+    {
+        pdu.handle = rsp->attr_value.handle;
+        pdu.len    = (rsp->attr_value.len > link->mtu - 1) ? (link->mtu - 1) : rsp->attr_value.len;
+        uhos_libc_memcpy(pdu.data, rsp->attr_value.value, pdu.len);
+        uhos_ble_sim_gatts_peer_rx(link, UHOS_BLE_SIM_PEER_RX_READ_RSP, &pdu);
+    }
+
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTS, gatts_if, ESP_GATTS_RESPONSE_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gatts.rsp.status = status;
+        evt->param.gatts.rsp.handle = (UHOS_NULL != rsp) ? rsp->attr_value.handle : 0;
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_gatts_set_attr_value(uint16_t attr_handle, uint16_t length, const uint8_t *value)
+{
+    uhos_ble_sim_local_attr_t *attr = UHOS_NULL;
+    uhos_ble_sim_svc_t *svc         = UHOS_NULL;
+    uhos_ble_sim_evt_t *evt         = UHOS_NULL;
+    esp_gatt_status_t status        = ESP_GATT_OK;
+
+    if ((0 != length) && (UHOS_NULL == value))
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    attr = uhos_ble_sim_local_attr_find(attr_handle);
+    if (UHOS_NULL == attr)
+    {
+        status = ESP_GATT_INVALID_HANDLE;
+    }
+    else if (length > CONFIG_UHOS_BLE_SIM_ATTR_LEN)
+    {
+        status = ESP_GATT_INVALID_ATTR_LEN;
+    }
+    else
+    {
+        uhos_libc_memcpy(attr->value, value, length);
+        attr->len = length;
+    }
+
+    svc = (UHOS_NULL != attr) ? uhos_ble_sim_svc_find(attr->svc_handle) : UHOS_NULL;
+    evt = uhos_ble_sim_evt_alloc(UHOS_BLE_SIM_EVT_GATTS, (UHOS_NULL != svc) ? svc->gatt_if : ESP_GATT_IF_NONE,
+                                 ESP_GATTS_SET_ATTR_VAL_EVT);
+    if (UHOS_NULL != evt)
+    {
+        evt->param.gatts.set_attr_val.srvc_handle = (UHOS_NULL != attr) ? attr->svc_handle : 0;
+        evt->param.gatts.set_attr_val.attr_handle = attr_handle;
+        evt->param.gatts.set_attr_val.status      = status;
+    }
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
+
+esp_gatt_status_t esp_ble_gatts_get_attr_value(uint16_t attr_handle, uint16_t *length, const uint8_t **value)
+{
+    uhos_ble_sim_local_attr_t *attr = UHOS_NULL;
+
+    if ((UHOS_NULL == length) || (UHOS_NULL == value))
+    {
+        return ESP_GATT_ILLEGAL_PARAMETER;
+    }
+
+    UHOS_BLE_SIM_LOCK();
+    attr = uhos_ble_sim_local_attr_find(attr_handle);
+    if (UHOS_NULL == attr)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_GATT_INVALID_HANDLE;
+    }
+    *length = attr->len;
+    *value  = attr->value;
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_GATT_OK;
+}
+
+esp_err_t esp_ble_gatts_close(esp_gatt_if_t gatts_if, uint16_t conn_id)
+{
+    uhos_ble_sim_link_t *link = UHOS_NULL;
+
+    (void)gatts_if;
+
+    UHOS_BLE_SIM_LOCK();
+    link = uhos_ble_sim_link_get_by_id(conn_id);
+    if (UHOS_NULL == link)
+    {
+        UHOS_BLE_SIM_UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+    uhos_ble_sim_link_close(link, ESP_GATT_CONN_TERMINATE_LOCAL_HOST);
+    UHOS_BLE_SIM_UNLOCK();
+
+    return ESP_OK;
+}
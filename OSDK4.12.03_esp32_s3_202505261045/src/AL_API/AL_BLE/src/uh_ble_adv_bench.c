@@ -0,0 +1,538 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_adv_bench.c
+ * @author agent (agent@local)
+ * @brief 广播透传过滤的回放基准测试
+ * @details 按用例生成CID/MAC/UUID规则并通过uhos_ble_gap_adv_filter_set编译，在扫描回调使用的
+ *          uhos_ble_pal_adv_filter_match上回放广播数据；同一份规则再以逐条线性比较的方式匹配一遍，
+ *          两者的耗时对比即为规则编译的收益，结果不一致的条数同时作为正确性检查。
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：广播透传过滤的回放基准测试
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>接口移至uh_ble_adv_bench.h，输出与计时改用uh_bench.h
+ * </table>
+ */
+
+#define LOG_TAG "ble-fb"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_osal.h"
+#include "uh_log.h"
+#include "uh_shell.h"
+#include "uh_bench.h"
+
+#include "uh_ble.h"
+#include "uh_ble_ad.h"
+#include "uh_ble_adv_filter.h"
+#include "uh_ble_adv_bench.h"
+
+/**************************************************************************************************/
+/*                                          外部引用声明                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+// 默认回放轮数
+#ifndef CONFIG_UHOS_BLE_ADV_BENCH_ROUNDS
+#define CONFIG_UHOS_BLE_ADV_BENCH_ROUNDS    100
+#endif
+
+// JSON行的最大长度
+#define UHOS_BLE_ADV_BENCH_JSON_LEN         256
+
+#define UHOS_BLE_ADV_BENCH_CID              0x01                //<! 命中CID条件
+#define UHOS_BLE_ADV_BENCH_MAC              0x02                //<! 命中MAC条件
+#define UHOS_BLE_ADV_BENCH_UUID             0x04                //<! 命中UUID条件
+
+#define UHOS_BLE_ADV_BENCH_ARRAY_NUM(a)     (sizeof(a) / sizeof((a)[0]))
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+// 内置抓包数据：家电广播、iBeacon、穿戴设备、带服务数据与名称的传感器等常见广播
+static const uhos_u8 g_uhos_ble_adv_bench_ad0[] = {
+    0x02, 0x01, 0x06, 0x03, 0x03, 0xB0, 0xFD, 0x0B, 0xFF, 0x4D, 0x05, 0x01, 0x02, 0x11, 0x22, 0x33,
+    0x44, 0x55, 0x66, 0x07, 0x09, 0x48, 0x61, 0x69, 0x65, 0x72, 0x31};
+static const uhos_u8 g_uhos_ble_adv_bench_ad1[] = {
+    0x02, 0x01, 0x06, 0x1A, 0xFF, 0x4C, 0x00, 0x02, 0x15, 0xE2, 0xC5, 0x6D, 0xB5, 0xDF, 0xFB, 0x48,
+    0xD2, 0xB0, 0x60, 0xD0, 0xF5, 0xA7, 0x10, 0x96, 0xE0, 0x00, 0x01, 0x00, 0x02, 0xC5};
+static const uhos_u8 g_uhos_ble_adv_bench_ad2[] = {
+    0x02, 0x01, 0x1A, 0x05, 0x03, 0x0D, 0x18, 0x0F, 0x18, 0x0A, 0xFF, 0x57, 0x01, 0x00, 0x31, 0x9A,
+    0x8B, 0x7C, 0x6D, 0x5E, 0x05, 0x09, 0x42, 0x61, 0x6E, 0x64};
+static const uhos_u8 g_uhos_ble_adv_bench_ad3[] = {
+    0x02, 0x01, 0x06, 0x11, 0x07, 0x9E, 0xCA, 0xDC, 0x24, 0x0E, 0xE5, 0xA9, 0xE0, 0x93, 0xF3, 0xA3,
+    0xB5, 0x01, 0x00, 0x40, 0x6E};
+static const uhos_u8 g_uhos_ble_adv_bench_ad4[] = {
+    0x02, 0x01, 0x06, 0x0C, 0x16, 0x1A, 0x18, 0xA4, 0xC1, 0x38, 0x12, 0x34, 0x56, 0xE7, 0x00, 0x2A,
+    0x09, 0x09, 0x41, 0x54, 0x43, 0x5F, 0x33, 0x34, 0x35, 0x36};
+static const uhos_u8 g_uhos_ble_adv_bench_ad5[] = {
+    0x02, 0x01, 0x06, 0x05, 0x05, 0x78, 0x56, 0x34, 0x12, 0x08, 0xFF, 0x06, 0x00, 0x01, 0x09, 0x20,
+    0x02, 0x7B};
+static const uhos_u8 g_uhos_ble_adv_bench_ad6[] = {
+    0x1E, 0xFF, 0x06, 0x00, 0x01, 0x09, 0x20, 0x22, 0x1B, 0xC4, 0x5E, 0x8C, 0x3D, 0x70, 0x11, 0x02,
+    0xA0, 0x4F, 0x33, 0x19, 0x86, 0x2C, 0x55, 0xE1, 0x0A, 0x77, 0x13, 0x60, 0x08, 0x9F, 0x40};
+static const uhos_u8 g_uhos_ble_adv_bench_ad7[] = {
+    0x02, 0x0A, 0x08, 0x03, 0x19, 0x80, 0x01, 0x02, 0x01, 0x06};
+
+static const uhos_ble_adv_bench_report_t g_uhos_ble_adv_bench_reports[] = {
+    {{0x01, 0x5A, 0x3C, 0x82, 0x41, 0xC8}, sizeof(g_uhos_ble_adv_bench_ad0), g_uhos_ble_adv_bench_ad0},
+    {{0x6F, 0x20, 0x11, 0x9C, 0xE4, 0xF0}, sizeof(g_uhos_ble_adv_bench_ad1), g_uhos_ble_adv_bench_ad1},
+    {{0x33, 0x97, 0x04, 0xD1, 0x7B, 0xE2}, sizeof(g_uhos_ble_adv_bench_ad2), g_uhos_ble_adv_bench_ad2},
+    {{0xA8, 0x10, 0x56, 0x2F, 0x0C, 0xD9}, sizeof(g_uhos_ble_adv_bench_ad3), g_uhos_ble_adv_bench_ad3},
+    {{0x12, 0x34, 0x56, 0x38, 0xC1, 0xA4}, sizeof(g_uhos_ble_adv_bench_ad4), g_uhos_ble_adv_bench_ad4},
+    {{0x5D, 0x02, 0xE8, 0x73, 0x1A, 0x7C}, sizeof(g_uhos_ble_adv_bench_ad5), g_uhos_ble_adv_bench_ad5},
+    {{0x90, 0xC4, 0x28, 0x6B, 0x3F, 0x4E}, sizeof(g_uhos_ble_adv_bench_ad6), g_uhos_ble_adv_bench_ad6},
+    {{0x07, 0x66, 0xB1, 0x45, 0x2D, 0xF3}, sizeof(g_uhos_ble_adv_bench_ad7), g_uhos_ble_adv_bench_ad7},
+    {{0xC2, 0x8E, 0x19, 0x04, 0x50, 0xEB}, 0, UHOS_NULL},
+};
+
+// 矩阵中各类条件的规则数
+static const uhos_u32 g_uhos_ble_adv_bench_rule_nums[] = {16, 256, 4096};
+
+/**************************************************************************************************/
+/*                                          内部函数原型                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       生成伪随机数，保证每次执行的规则一致
+ */
+static uhos_u32 uhos_ble_pal_adv_bench_rand(uhos_u32 *seed)
+{
+    *seed = *seed * 1103515245u + 12345u;
+
+    return *seed >> 8;
+}
+
+/**
+ * @brief       UUID规则类型对应的宽度
+ */
+static uhos_u8 uhos_ble_pal_adv_bench_uuid_width(uhos_u8 uuid_type)
+{
+    return (0 == uuid_type) ? 2 : ((1 == uuid_type) ? 4 : 16);
+}
+
+/**
+ * @brief       从回放数据中取第一个厂商CID和第一个服务UUID，使规则至少有一个值能够命中
+ * @param[out]  cid         厂商CID
+ * @param[out]  uuid_type   UUID规则类型
+ * @param[out]  uuid        UUID（小端）
+ * @return      取到的条件类别
+ */
+static uhos_u8 uhos_ble_pal_adv_bench_pick(const uhos_ble_adv_bench_report_t *reports, uhos_u32 num,
+                                           uhos_u16 *cid, uhos_u8 *uuid_type, uhos_u8 *uuid)
+{
+    uhos_ble_ad_iter_t  it;
+    uhos_ble_ad_field_t field;
+    uhos_u8             found = 0;
+    uhos_u8             width = 0;
+    uhos_u32            i     = 0;
+
+    for (i = 0; (i < num) && (found != (UHOS_BLE_ADV_BENCH_CID | UHOS_BLE_ADV_BENCH_UUID)); i++)
+    {
+        uhos_ble_ad_iter_init(&it, reports[i].data, reports[i].len);
+
+        while (uhos_ble_ad_iter_next(&it, &field))
+        {
+            if ((UHOS_BLE_AD_TYPE_MANUFACTURER == field.type) && (field.len >= 2) &&
+                !(found & UHOS_BLE_ADV_BENCH_CID))
+            {
+                *cid = uhos_ble_ad_le16(field.data);
+                found |= UHOS_BLE_ADV_BENCH_CID;
+            }
+            else if (uhos_ble_ad_field_uuid_count(&field) && !(found & UHOS_BLE_ADV_BENCH_UUID))
+            {
+                width      = uhos_ble_ad_field_uuid_width(&field);
+                *uuid_type = (2 == width) ? 0 : ((4 == width) ? 1 : 2);
+                uhos_libc_memcpy(uuid, uhos_ble_ad_field_uuid_at(&field, 0), width);
+                found |= UHOS_BLE_ADV_BENCH_UUID;
+            }
+        }
+    }
+
+    return found;
+}
+
+/**
+ * @brief       按用例生成透传规则：每类条件的第0项取自回放数据，其余为随机值
+ * @return      UHOS_BLE_SUCCESS-成功，UHOS_BLE_ERROR-内存不足
+ */
+static uhos_ble_status_t uhos_ble_pal_adv_bench_rules_build(const uhos_ble_adv_bench_case_t *bcase,
+                                                            const uhos_ble_adv_bench_report_t *reports, uhos_u32 num,
+                                                            uhos_ble_gap_adv_filter_rules_t *rules)
+{
+    uhos_u32 seed      = 0x48414952;
+    uhos_u16 cid       = 0;
+    uhos_u8  uuid_type = 0;
+    uhos_u8  uuid[16]  = {0};
+    uhos_u8  found     = 0;
+    uhos_u32 i         = 0;
+    uhos_u8  j         = 0;
+
+    found = uhos_ble_pal_adv_bench_pick(reports, num, &cid, &uuid_type, uuid);
+
+    uhos_libc_memset(rules, 0, sizeof(uhos_ble_gap_adv_filter_rules_t));
+    rules->rule_relation = bcase->relation;
+
+    if (bcase->cid_num)
+    {
+        rules->cids = uhos_libc_malloc(bcase->cid_num * sizeof(uhos_u16));
+        if (UHOS_NULL == rules->cids)
+        {
+            return UHOS_BLE_ERROR;
+        }
+
+        rules->cid_num = bcase->cid_num;
+        for (i = 0; i < bcase->cid_num; i++)
+        {
+            rules->cids[i] = (uhos_u16)uhos_ble_pal_adv_bench_rand(&seed);
+        }
+        if (found & UHOS_BLE_ADV_BENCH_CID)
+        {
+            rules->cids[0] = cid;
+        }
+    }
+
+    if (bcase->mac_num)
+    {
+        rules->macs = uhos_libc_zalloc(bcase->mac_num * sizeof(*rules->macs));
+        if (UHOS_NULL == rules->macs)
+        {
+            return UHOS_BLE_ERROR;
+        }
+
+        rules->mac_num = bcase->mac_num;
+        for (i = 0; i < bcase->mac_num; i++)
+        {
+            for (j = 0; j < 6; j++)
+            {
+                rules->macs[i].mac[j] = (uhos_u8)uhos_ble_pal_adv_bench_rand(&seed);
+            }
+        }
+        if (num)
+        {
+            uhos_libc_memcpy(rules->macs[0].mac, reports[0].mac, 6);
+        }
+    }
+
+    if (bcase->uuid_num)
+    {
+        rules->uuids = uhos_libc_zalloc(bcase->uuid_num * sizeof(*rules->uuids));
+        if (UHOS_NULL == rules->uuids)
+        {
+            return UHOS_BLE_ERROR;
+        }
+
+        rules->uuid_num = bcase->uuid_num;
+        for (i = 0; i < bcase->uuid_num; i++)
+        {
+            rules->uuids[i].uuid_type = (uhos_u8)(i % 3);
+            for (j = 0; j < 16; j++)
+            {
+                rules->uuids[i].uuid[j] = (uhos_u8)uhos_ble_pal_adv_bench_rand(&seed);
+            }
+        }
+        if (found & UHOS_BLE_ADV_BENCH_UUID)
+        {
+            rules->uuids[0].uuid_type = uuid_type;
+            uhos_libc_memcpy(rules->uuids[0].uuid, uuid, 16);
+        }
+    }
+
+    return UHOS_BLE_SUCCESS;
+}
+
+static void uhos_ble_pal_adv_bench_rules_free(uhos_ble_gap_adv_filter_rules_t *rules)
+{
+    uhos_libc_free(rules->cids);
+    uhos_libc_free(rules->macs);
+    uhos_libc_free(rules->uuids);
+    uhos_libc_memset(rules, 0, sizeof(uhos_ble_gap_adv_filter_rules_t));
+}
+
+/**
+ * @brief       逐条线性比较规则，即规则编译前的匹配方式，作为对照与正确性参考
+ */
+static uhos_bool uhos_ble_pal_adv_bench_linear(const uhos_ble_gap_adv_filter_rules_t *rules,
+                                               const uhos_u8 *mac, const uhos_u8 *data, uhos_u16 len)
+{
+    uhos_ble_ad_iter_t  it;
+    uhos_ble_ad_field_t field;
+    uhos_u8             required = 0;
+    uhos_u8             hit      = 0;
+    uhos_u8             width    = 0;
+    uhos_u8             num      = 0;
+    uhos_u8             k        = 0;
+    uhos_u32            i        = 0;
+    uhos_u16            cid      = 0;
+
+    required |= rules->cid_num ? UHOS_BLE_ADV_BENCH_CID : 0;
+    required |= rules->mac_num ? UHOS_BLE_ADV_BENCH_MAC : 0;
+    required |= rules->uuid_num ? UHOS_BLE_ADV_BENCH_UUID : 0;
+
+    if (0 == required)
+    {
+        return UHOS_TRUE;
+    }
+
+    for (i = 0; i < rules->mac_num; i++)
+    {
+        if (0 == uhos_libc_memcmp(rules->macs[i].mac, mac, 6))
+        {
+            hit |= UHOS_BLE_ADV_BENCH_MAC;
+            break;
+        }
+    }
+
+    uhos_ble_ad_iter_init(&it, data, len);
+
+    while (uhos_ble_ad_iter_next(&it, &field))
+    {
+        if (UHOS_BLE_AD_TYPE_MANUFACTURER == field.type)
+        {
+            if (field.len < 2)
+            {
+                continue;
+            }
+
+            cid = uhos_ble_ad_le16(field.data);
+            for (i = 0; i < rules->cid_num; i++)
+            {
+                if (rules->cids[i] == cid)
+                {
+                    hit |= UHOS_BLE_ADV_BENCH_CID;
+                    break;
+                }
+            }
+            continue;
+        }
+
+        width = uhos_ble_ad_field_uuid_width(&field);
+        num   = uhos_ble_ad_field_uuid_count(&field);
+
+        for (k = 0; k < num; k++)
+        {
+            for (i = 0; i < rules->uuid_num; i++)
+            {
+                if ((uhos_ble_pal_adv_bench_uuid_width(rules->uuids[i].uuid_type) == width) &&
+                    (0 == uhos_libc_memcmp(rules->uuids[i].uuid, uhos_ble_ad_field_uuid_at(&field, k), width)))
+                {
+                    hit |= UHOS_BLE_ADV_BENCH_UUID;
+                    break;
+                }
+            }
+        }
+    }
+
+    return rules->rule_relation ? (hit == required) : (0 != hit);
+}
+
+/**
+ * @brief       shell命令：ble_adv_bench [rounds]
+ */
+static void uhos_ble_pal_adv_bench_shell_print(const uhos_char *line)
+{
+    uhos_shell_printf("%s\r\n", line);
+}
+
+static uhos_s32 uhos_ble_pal_adv_bench_shell(int argc, char *argv[])
+{
+    uhos_u32 rounds = (argc > 1) ? (uhos_u32)uhos_libc_atoi(argv[1]) : 0;
+
+    return (UHOS_BLE_SUCCESS == uhos_ble_adv_bench_matrix_run(rounds, uhos_ble_pal_adv_bench_shell_print)) ? 0 : -1;
+}
+UHOS_SHELL_EXPORT_CMD(ble_adv_bench, uhos_ble_pal_adv_bench_shell, BLE adv filter replay benchmark);
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       回放广播数据，对比编译后的透传规则匹配器与线性比较规则的匹配耗时
+ */
+uhos_ble_status_t uhos_ble_adv_bench_run(const uhos_ble_adv_bench_case_t *bcase, const uhos_ble_adv_bench_report_t *reports,
+                                         uhos_u32 num, uhos_ble_adv_bench_result_t *result)
+{
+    uhos_ble_gap_adv_filter_rules_t rules   = {0};
+    uhos_u32                        start   = 0;
+    uhos_u32                        elapsed = 0;
+    uhos_u32                        r       = 0;
+    uhos_u32                        i       = 0;
+    uhos_bool                       a       = UHOS_FALSE;
+    uhos_bool                       b       = UHOS_FALSE;
+
+    if ((UHOS_NULL == bcase) || (UHOS_NULL == result) || ((UHOS_NULL == reports) && num))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_libc_memset(result, 0, sizeof(uhos_ble_adv_bench_result_t));
+    result->status = UHOS_BLE_ERROR;
+
+    if (UHOS_NULL == reports)
+    {
+        reports = g_uhos_ble_adv_bench_reports;
+        num     = UHOS_BLE_ADV_BENCH_ARRAY_NUM(g_uhos_ble_adv_bench_reports);
+    }
+
+    if ((0 == num) || (0 == bcase->rounds) || (num > 0xFFFFFFFFu / bcase->rounds))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    if (UHOS_BLE_SUCCESS != uhos_ble_pal_adv_bench_rules_build(bcase, reports, num, &rules))
+    {
+        UHOS_LOG_MEM_ALLOC_FAIL();
+        uhos_ble_pal_adv_bench_rules_free(&rules);
+        return UHOS_BLE_ERROR;
+    }
+
+    start = uhos_bench_now_us();
+    if (UHOS_BLE_SUCCESS != uhos_ble_gap_adv_filter_set(&rules))
+    {
+        uhos_ble_pal_adv_bench_rules_free(&rules);
+        return UHOS_BLE_ERROR;
+    }
+    result->compile_us = uhos_bench_now_us() - start;
+    result->reports    = num * bcase->rounds;
+
+    // 正确性：逐条对比两种匹配方式
+    for (i = 0; i < num; i++)
+    {
+        a = uhos_ble_pal_adv_filter_match(reports[i].mac, reports[i].data, reports[i].len);
+        b = uhos_ble_pal_adv_bench_linear(&rules, reports[i].mac, reports[i].data, reports[i].len);
+        if (a != b)
+        {
+            UHOS_LOGE("report %u mismatch, compiled %d linear %d", (unsigned)i, a, b);
+            result->mismatches++;
+        }
+    }
+
+    start = uhos_bench_now_us();
+    for (r = 0; r < bcase->rounds; r++)
+    {
+        for (i = 0; i < num; i++)
+        {
+            result->matched += uhos_ble_pal_adv_filter_match(reports[i].mac, reports[i].data, reports[i].len) ? 1 : 0;
+        }
+    }
+    elapsed = uhos_bench_now_us() - start;
+
+    result->compiled_ns     = (uhos_u32)((uhos_u64)elapsed * 1000 / result->reports);
+    result->reports_per_sec = elapsed ? (uhos_u32)((uhos_u64)result->reports * 1000000 / elapsed) : 0;
+
+    start = uhos_bench_now_us();
+    for (r = 0; r < bcase->rounds; r++)
+    {
+        for (i = 0; i < num; i++)
+        {
+            uhos_ble_pal_adv_bench_linear(&rules, reports[i].mac, reports[i].data, reports[i].len);
+        }
+    }
+    elapsed = uhos_bench_now_us() - start;
+
+    result->linear_ns = (uhos_u32)((uhos_u64)elapsed * 1000 / result->reports);
+
+    uhos_ble_gap_adv_filter_set(UHOS_NULL);
+    uhos_ble_pal_adv_bench_rules_free(&rules);
+
+    result->status = result->mismatches ? UHOS_BLE_ERROR : UHOS_BLE_SUCCESS;
+
+    return result->status;
+}
+
+/**
+ * @brief       将广播回放用例与结果格式化为一行JSON
+ */
+uhos_s32 uhos_ble_adv_bench_result_json(const uhos_ble_adv_bench_case_t *bcase, const uhos_ble_adv_bench_result_t *result,
+                                        uhos_char *buf, uhos_u32 size)
+{
+    uhos_bench_json_t json = {0};
+
+    if ((UHOS_NULL == bcase) || (UHOS_NULL == result) || (UHOS_NULL == buf))
+    {
+        return 0;
+    }
+
+    uhos_bench_json_begin(&json, buf, size);
+    uhos_bench_json_str(&json, "relation", bcase->relation ? "and" : "or");
+    uhos_bench_json_u32(&json, "cids", bcase->cid_num);
+    uhos_bench_json_u32(&json, "macs", bcase->mac_num);
+    uhos_bench_json_u32(&json, "uuids", bcase->uuid_num);
+    uhos_bench_json_status(&json, result->status);
+    uhos_bench_json_u32(&json, "reports", result->reports);
+    uhos_bench_json_u32(&json, "matched", result->matched);
+    uhos_bench_json_u32(&json, "mismatches", result->mismatches);
+    uhos_bench_json_u32(&json, "compile_us", result->compile_us);
+    uhos_bench_json_u32(&json, "compiled_ns", result->compiled_ns);
+    uhos_bench_json_u32(&json, "linear_ns", result->linear_ns);
+    uhos_bench_json_u32(&json, "reports_per_sec", result->reports_per_sec);
+
+    return uhos_bench_json_end(&json);
+}
+
+/**
+ * @brief       使用内置抓包数据依次执行广播回放用例
+ */
+uhos_ble_status_t uhos_ble_adv_bench_matrix_run(uhos_u32 rounds, uhos_bench_print_t print)
+{
+    uhos_ble_adv_bench_case_t   bcase  = {0};
+    uhos_ble_adv_bench_result_t result = {0};
+    uhos_ble_status_t           ret    = UHOS_BLE_SUCCESS;
+    uhos_char                  *line   = UHOS_NULL;
+    uhos_u8                     n      = 0;
+    uhos_u8                     rel    = 0;
+
+    if (UHOS_NULL == print)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    line = uhos_libc_malloc(UHOS_BLE_ADV_BENCH_JSON_LEN);
+    if (UHOS_NULL == line)
+    {
+        UHOS_LOG_MEM_ALLOC_FAIL();
+        return UHOS_BLE_ERROR;
+    }
+
+    bcase.rounds = rounds ? rounds : CONFIG_UHOS_BLE_ADV_BENCH_ROUNDS;
+
+    for (rel = 0; rel < 2; rel++)
+    {
+        for (n = 0; n < UHOS_BLE_ADV_BENCH_ARRAY_NUM(g_uhos_ble_adv_bench_rule_nums); n++)
+        {
+            bcase.relation = rel;
+            bcase.cid_num  = g_uhos_ble_adv_bench_rule_nums[n];
+            bcase.mac_num  = g_uhos_ble_adv_bench_rule_nums[n];
+            bcase.uuid_num = g_uhos_ble_adv_bench_rule_nums[n];
+
+            if (UHOS_BLE_SUCCESS != uhos_ble_adv_bench_run(&bcase, UHOS_NULL, 0, &result))
+            {
+                ret = UHOS_BLE_ERROR;
+            }
+
+            uhos_ble_adv_bench_result_json(&bcase, &result, line, UHOS_BLE_ADV_BENCH_JSON_LEN);
+            print(line);
+        }
+    }
+
+    uhos_libc_free(line);
+
+    return ret;
+}
@@ -0,0 +1,348 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_adv_cache.c
+ * @author agent (agent@local)
+ * @brief 广播上报去重缓存的功能实现
+ * @details 以(地址, 地址类型)为键的开放寻址哈希表，记录载荷哈希、RSSI及最后出现时间；
+ *          窗口期内载荷未变化的重复广播直接丢弃，只上送变化或周期刷新的数据
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：广播上报去重缓存的功能实现
+ * </table>
+ */
+
+#define LOG_TAG "ble-a"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_osal.h"
+#include "uh_log.h"
+#include "uh_libc.h"
+
+#include "uh_ble.h"
+#include "uh_ble_adv_cache.h"
+
+/**************************************************************************************************/
+/*                                          外部引用声明                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+// 缓存表项数，必须为2的幂
+#ifndef CONFIG_UHOS_BLE_ADV_CACHE_SIZE
+#define CONFIG_UHOS_BLE_ADV_CACHE_SIZE      128
+#endif
+
+// 默认去重窗口（毫秒），窗口内载荷未变化的广播不重复上送
+#ifndef CONFIG_UHOS_BLE_ADV_DEDUP_WINDOW_MS
+#define CONFIG_UHOS_BLE_ADV_DEDUP_WINDOW_MS 1000
+#endif
+
+// 默认RSSI变化阈值（dBm），平滑RSSI变化超过该值时即使载荷未变也上送；0表示不按RSSI上送
+#ifndef CONFIG_UHOS_BLE_ADV_DEDUP_RSSI_DELTA
+#define CONFIG_UHOS_BLE_ADV_DEDUP_RSSI_DELTA 10
+#endif
+
+#define UHOS_BLE_ADV_CACHE_SIZE             CONFIG_UHOS_BLE_ADV_CACHE_SIZE
+#define UHOS_BLE_ADV_CACHE_MASK             (UHOS_BLE_ADV_CACHE_SIZE - 1)
+#define UHOS_BLE_ADV_CACHE_PROBE_MAX        8                   //<! 线性探测的最大长度
+
+#define UHOS_BLE_ADV_RSSI_SHIFT             4                   //<! 平滑RSSI的定点小数位数
+#define UHOS_BLE_ADV_RSSI_ALPHA_SHIFT       2                   //<! 平滑系数 1/4
+
+#define UHOS_BLE_ADV_FNV_OFFSET             2166136261u
+#define UHOS_BLE_ADV_FNV_PRIME              16777619u
+
+#if (UHOS_BLE_ADV_CACHE_SIZE < UHOS_BLE_ADV_CACHE_PROBE_MAX) || (UHOS_BLE_ADV_CACHE_SIZE & UHOS_BLE_ADV_CACHE_MASK)
+#error "CONFIG_UHOS_BLE_ADV_CACHE_SIZE must be a power of 2 and not less than 8"
+#endif
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      去重缓存表项
+ * @note        表项只会被原位替换，不会删除，因此探测时遇到空项即可结束查找
+ */
+typedef struct uhos_ble_pal_adv_cache_entry
+{
+    uhos_ble_addr_t addr;                                       //<! 对端地址
+    uhos_u8         addr_type;                                  //<! 地址类型
+    uhos_u8         used;                                       //<! 表项是否有效
+    uhos_u32        payload_hash[2];                            //<! 广播/扫描响应载荷哈希，0表示未收到
+    uhos_s8         last_rssi;                                  //<! 最近一次的RSSI
+    uhos_s8         fwd_rssi;                                   //<! 最近一次上送时的平滑RSSI
+    uhos_s16        smooth_rssi;                                //<! 平滑RSSI（Q4定点）
+    uhos_u32        last_seen;                                  //<! 最近一次收到的时间（毫秒）
+    uhos_u32        last_fwd[2];                                //<! 广播/扫描响应最近一次上送的时间（毫秒）
+} uhos_ble_pal_adv_cache_entry_t;
+
+/**
+ * @struct      去重缓存控制块
+ */
+typedef struct uhos_ble_pal_adv_cache_ctl
+{
+    uhos_u8                         enable;                     //<! 去重开关
+    uhos_u8                         flush;                      //<! 清空请求，由扫描回调上下文执行
+    uhos_u8                         rssi_delta;                 //<! RSSI变化阈值
+    uhos_u32                        window_ms;                  //<! 去重窗口
+    uhos_u32                        checked;                    //<! 检查的广播条数
+    uhos_u32                        forwarded;                  //<! 上送的广播条数
+    uhos_u32                        suppressed;                 //<! 丢弃的重复广播条数
+    uhos_u32                        evicted;                    //<! 被替换的表项数
+    uhos_u16                        entries;                    //<! 有效表项数
+    uhos_ble_pal_adv_cache_entry_t  entry[UHOS_BLE_ADV_CACHE_SIZE];
+} uhos_ble_pal_adv_cache_ctl_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_ble_pal_adv_cache_ctl_t g_uhos_ble_pal_adv_cache = {0};   //<! 去重缓存控制块
+
+/**************************************************************************************************/
+/*                                          内部函数原型                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       FNV-1a哈希
+ * @param[in]   hash    初始值
+ * @param[in]   data    数据
+ * @param[in]   len     数据长度
+ * @return      哈希值
+ */
+static uhos_u32 uhos_ble_pal_adv_cache_fnv(uhos_u32 hash, const uhos_u8 *data, uhos_u32 len)
+{
+    uhos_u32 i = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        hash ^= data[i];
+        hash *= UHOS_BLE_ADV_FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief       查找设备对应的表项，未找到时分配空项或替换最久未出现的表项
+ * @param[in]   report  广播上报数据
+ * @param[in]   now     当前时间
+ * @param[out]  is_new  是否为新分配的表项
+ * @return      表项指针
+ */
+static uhos_ble_pal_adv_cache_entry_t *uhos_ble_pal_adv_cache_lookup(const uhos_ble_gap_adv_report_t *report,
+                                                                      uhos_u32                         now,
+                                                                      uhos_bool                       *is_new)
+{
+    uhos_ble_pal_adv_cache_ctl_t   *ctl    = &g_uhos_ble_pal_adv_cache;
+    uhos_ble_pal_adv_cache_entry_t *entry  = UHOS_NULL;
+    uhos_ble_pal_adv_cache_entry_t *victim = UHOS_NULL;
+    uhos_u8                         type   = (uhos_u8)report->addr_type;
+    uhos_u32                        idx    = 0;
+    uhos_u32                        i      = 0;
+
+    idx = uhos_ble_pal_adv_cache_fnv(UHOS_BLE_ADV_FNV_OFFSET, report->peer_addr, sizeof(uhos_ble_addr_t));
+    idx = uhos_ble_pal_adv_cache_fnv(idx, &type, 1);
+
+    for (i = 0; i < UHOS_BLE_ADV_CACHE_PROBE_MAX; i++)
+    {
+        entry = &ctl->entry[(idx + i) & UHOS_BLE_ADV_CACHE_MASK];
+
+        if (!entry->used)
+        {
+            victim = entry;
+            break;
+        }
+
+        if ((entry->addr_type == type) &&
+            (0 == uhos_libc_memcmp(entry->addr, report->peer_addr, sizeof(uhos_ble_addr_t))))
+        {
+            *is_new = UHOS_FALSE;
+            return entry;
+        }
+
+        // 记录探测序列中最久未出现的表项，作为替换对象
+        if ((UHOS_NULL == victim) || ((uhos_s32)(entry->last_seen - victim->last_seen) < 0))
+        {
+            victim = entry;
+        }
+    }
+
+    if (victim->used)
+    {
+        ctl->evicted++;
+    }
+    else
+    {
+        ctl->entries++;
+    }
+
+    uhos_libc_memset(victim, 0, sizeof(uhos_ble_pal_adv_cache_entry_t));
+    uhos_libc_memcpy(victim->addr, report->peer_addr, sizeof(uhos_ble_addr_t));
+    victim->addr_type   = type;
+    victim->used        = 1;
+    victim->smooth_rssi = (uhos_s16)(report->rssi * (1 << UHOS_BLE_ADV_RSSI_SHIFT));
+    victim->fwd_rssi    = report->rssi;
+    victim->last_seen   = now;
+
+    *is_new = UHOS_TRUE;
+    return victim;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       去重缓存初始化
+ */
+void uhos_ble_pal_adv_cache_init(void)
+{
+    uhos_libc_memset(&g_uhos_ble_pal_adv_cache, 0, sizeof(uhos_ble_pal_adv_cache_ctl_t));
+
+    g_uhos_ble_pal_adv_cache.enable     = 1;
+    g_uhos_ble_pal_adv_cache.window_ms  = CONFIG_UHOS_BLE_ADV_DEDUP_WINDOW_MS;
+    g_uhos_ble_pal_adv_cache.rssi_delta = CONFIG_UHOS_BLE_ADV_DEDUP_RSSI_DELTA;
+}
+
+/**
+ * @brief       判断广播上报是否需要继续上送
+ * @param[in]   report  广播上报数据
+ * @return      UHOS_TRUE-需要上送，UHOS_FALSE-重复数据，丢弃
+ */
+uhos_bool uhos_ble_pal_adv_cache_check(const uhos_ble_gap_adv_report_t *report)
+{
+    uhos_ble_pal_adv_cache_ctl_t   *ctl     = &g_uhos_ble_pal_adv_cache;
+    uhos_ble_pal_adv_cache_entry_t *entry   = UHOS_NULL;
+    uhos_bool                       is_new  = UHOS_FALSE;
+    uhos_bool                       forward = UHOS_FALSE;
+    uhos_u32                        now     = 0;
+    uhos_u32                        hash    = 0;
+    uhos_u8                         slot    = 0;
+    uhos_s32                        diff    = 0;
+
+    if (UHOS_NULL == report)
+    {
+        return UHOS_FALSE;
+    }
+
+    if (__atomic_exchange_n(&ctl->flush, 0, __ATOMIC_ACQUIRE))
+    {
+        uhos_libc_memset(ctl->entry, 0, sizeof(ctl->entry));
+        ctl->entries = 0;
+    }
+
+    if (!__atomic_load_n(&ctl->enable, __ATOMIC_RELAXED))
+    {
+        return UHOS_TRUE;
+    }
+
+    now = uhos_current_time_get();
+    ctl->checked++;
+
+    entry = uhos_ble_pal_adv_cache_lookup(report, now, &is_new);
+
+    // 广播与扫描响应分别记录，避免二者交替到达时被误判为载荷变化
+    slot = (SCAN_RSP_DATA == report->adv_type) ? 1 : 0;
+    hash = uhos_ble_pal_adv_cache_fnv(UHOS_BLE_ADV_FNV_OFFSET, report->data, report->data_len);
+    hash = hash ? hash : 1;
+
+    // 更新RSSI：平滑值 += (新值 - 平滑值) / 4
+    entry->last_rssi    = report->rssi;
+    entry->smooth_rssi += (((uhos_s16)(report->rssi * (1 << UHOS_BLE_ADV_RSSI_SHIFT)) - entry->smooth_rssi)
+                           >> UHOS_BLE_ADV_RSSI_ALPHA_SHIFT);
+    entry->last_seen    = now;
+
+    if (is_new || (entry->payload_hash[slot] != hash))
+    {
+        // 新设备或载荷变化
+        forward = UHOS_TRUE;
+    }
+    else if ((now - entry->last_fwd[slot]) >= ctl->window_ms)
+    {
+        // 周期刷新
+        forward = UHOS_TRUE;
+    }
+    else if (ctl->rssi_delta)
+    {
+        diff = (entry->smooth_rssi >> UHOS_BLE_ADV_RSSI_SHIFT) - entry->fwd_rssi;
+        if ((diff >= ctl->rssi_delta) || (-diff >= ctl->rssi_delta))
+        {
+            forward = UHOS_TRUE;
+        }
+    }
+
+    if (!forward)
+    {
+        ctl->suppressed++;
+        return UHOS_FALSE;
+    }
+
+    entry->payload_hash[slot] = hash;
+    entry->last_fwd[slot]     = now;
+    entry->fwd_rssi           = (uhos_s8)(entry->smooth_rssi >> UHOS_BLE_ADV_RSSI_SHIFT);
+    ctl->forwarded++;
+
+    return UHOS_TRUE;
+}
+
+/**
+ * @brief       配置广播上报去重
+ * @param[in]   cfg     去重配置
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_gap_adv_dedup_config(const uhos_ble_gap_adv_dedup_cfg_t *cfg)
+{
+    uhos_ble_pal_adv_cache_ctl_t *ctl = &g_uhos_ble_pal_adv_cache;
+
+    if (UHOS_NULL == cfg)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    __atomic_store_n(&ctl->window_ms, cfg->window_ms, __ATOMIC_RELAXED);
+    __atomic_store_n(&ctl->rssi_delta, cfg->rssi_delta, __ATOMIC_RELAXED);
+    __atomic_store_n(&ctl->enable, cfg->enable ? 1 : 0, __ATOMIC_RELAXED);
+
+    // 配置变化后重新建立缓存
+    __atomic_store_n(&ctl->flush, 1, __ATOMIC_RELEASE);
+
+    UHOS_LOGI("adv dedup %s, window %u ms, rssi delta %u",
+              cfg->enable ? "on" : "off", cfg->window_ms, cfg->rssi_delta);
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       获取广播上报去重的统计信息
+ * @param[out]  stats   统计信息
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_gap_adv_dedup_stats_get(uhos_ble_gap_adv_dedup_stats_t *stats)
+{
+    uhos_ble_pal_adv_cache_ctl_t *ctl = &g_uhos_ble_pal_adv_cache;
+
+    if (UHOS_NULL == stats)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    stats->checked    = __atomic_load_n(&ctl->checked, __ATOMIC_RELAXED);
+    stats->forwarded  = __atomic_load_n(&ctl->forwarded, __ATOMIC_RELAXED);
+    stats->suppressed = __atomic_load_n(&ctl->suppressed, __ATOMIC_RELAXED);
+    stats->evicted    = __atomic_load_n(&ctl->evicted, __ATOMIC_RELAXED);
+    stats->entries    = __atomic_load_n(&ctl->entries, __ATOMIC_RELAXED);
+    stats->capacity   = UHOS_BLE_ADV_CACHE_SIZE;
+
+    return UHOS_BLE_SUCCESS;
+}
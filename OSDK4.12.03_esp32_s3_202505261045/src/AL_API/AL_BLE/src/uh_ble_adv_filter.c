@@ -0,0 +1,561 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_adv_filter.c
+ * @author agent (agent@local)
+ * @brief 广播透传过滤规则的编译与匹配实现
+ * @details 规则设置时编译为：有序CID数组（二分查找）、MAC开放寻址哈希集合、
+ *          16/32/128位有序UUID数组；扫描回调中直接在原始AD数据上匹配
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：广播透传过滤规则的编译与匹配实现
+ * </table>
+ */
+
+#define LOG_TAG "ble-f"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include <stdlib.h>
+
+#include "uh_types.h"
+#include "uh_osal.h"
+#include "uh_log.h"
+#include "uh_libc.h"
+
+#include "uh_ble.h"
+#include "uh_ble_ad.h"
+#include "uh_ble_adv_filter.h"
+
+/**************************************************************************************************/
+/*                                          外部引用声明                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define UHOS_BLE_ADV_FILTER_CID             0x01                //<! 规则包含CID条件
+#define UHOS_BLE_ADV_FILTER_MAC             0x02                //<! 规则包含MAC条件
+#define UHOS_BLE_ADV_FILTER_UUID            0x04                //<! 规则包含UUID条件
+
+#define UHOS_BLE_ADV_FILTER_UUID_TYPE_16    0x00
+#define UHOS_BLE_ADV_FILTER_UUID_TYPE_32    0x01
+#define UHOS_BLE_ADV_FILTER_UUID_TYPE_128   0x02
+
+#define UHOS_BLE_ADV_FILTER_RULE_MAX        0xFFFF              //<! 每类规则的最大数量
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      MAC哈希集合的槽位
+ */
+typedef struct uhos_ble_pal_adv_filter_mac_slot
+{
+    uhos_u8 used;                                               //<! 槽位是否有效
+    uhos_u8 mac[6];                                             //<! MAC地址
+} uhos_ble_pal_adv_filter_mac_slot_t;
+
+/**
+ * @struct      编译后的透传规则
+ */
+typedef struct uhos_ble_pal_adv_matcher
+{
+    uhos_u8                             relation;               //<! 0-或，1-与
+    uhos_u8                             required;               //<! 规则包含的条件类别
+    uhos_u16                            cid_num;                //<! CID数量
+    uhos_u16                           *cids;                   //<! 有序CID数组
+    uhos_u32                            mac_mask;               //<! MAC哈希集合掩码（槽位数-1）
+    uhos_ble_pal_adv_filter_mac_slot_t *mac_set;                //<! MAC哈希集合
+    uhos_u16                            uuid16_num;             //<! 16位UUID数量
+    uhos_u16                            uuid32_num;             //<! 32位UUID数量
+    uhos_u16                            uuid128_num;            //<! 128位UUID数量
+    uhos_u16                           *uuid16;                 //<! 有序16位UUID数组
+    uhos_u32                           *uuid32;                 //<! 有序32位UUID数组
+    uhos_u8                           (*uuid128)[16];           //<! 有序128位UUID数组
+} uhos_ble_pal_adv_matcher_t;
+
+/**
+ * @struct      透传过滤控制块
+ * @note        扫描回调通过readers计数引用matcher，规则替换时等待计数归零后再释放旧规则。
+ *              读端“先增计数再读matcher”与写端“先换matcher再读计数”是先写后读的交叉访问，
+ *              acquire/release不能保证两端至少一方看到对方的写入，四处访问都须为SEQ_CST
+ */
+typedef struct uhos_ble_pal_adv_filter_ctl
+{
+    uhos_ble_pal_adv_matcher_t *matcher;                        //<! 当前生效的规则
+    uhos_u32                    readers;                        //<! 正在使用规则的扫描回调数
+    uhos_u32                    checked;                        //<! 匹配的广播条数
+    uhos_u32                    matched;                        //<! 匹配成功的条数
+    uhos_u32                    rejected;                       //<! 匹配失败的条数
+} uhos_ble_pal_adv_filter_ctl_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_ble_pal_adv_filter_ctl_t g_uhos_ble_pal_adv_filter = {0};  //<! 透传过滤控制块
+
+/**************************************************************************************************/
+/*                                          内部函数原型                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static int uhos_ble_pal_adv_filter_cmp16(const void *a, const void *b)
+{
+    return (int)*(const uhos_u16 *)a - (int)*(const uhos_u16 *)b;
+}
+
+static int uhos_ble_pal_adv_filter_cmp32(const void *a, const void *b)
+{
+    uhos_u32 x = *(const uhos_u32 *)a;
+    uhos_u32 y = *(const uhos_u32 *)b;
+
+    return (x > y) - (x < y);
+}
+
+static int uhos_ble_pal_adv_filter_cmp128(const void *a, const void *b)
+{
+    return uhos_libc_memcmp(a, b, 16);
+}
+
+/**
+ * @brief       计算MAC地址的哈希值
+ */
+static uhos_u32 uhos_ble_pal_adv_filter_mac_hash(const uhos_u8 *mac)
+{
+    uhos_u32 hash = 2166136261u;
+    uhos_u8  i    = 0;
+
+    for (i = 0; i < 6; i++)
+    {
+        hash ^= mac[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief       查找MAC是否在集合中
+ */
+static uhos_bool uhos_ble_pal_adv_filter_mac_find(const uhos_ble_pal_adv_matcher_t *m, const uhos_u8 *mac)
+{
+    uhos_u32 idx = uhos_ble_pal_adv_filter_mac_hash(mac) & m->mac_mask;
+
+    while (m->mac_set[idx].used)
+    {
+        if (0 == uhos_libc_memcmp(m->mac_set[idx].mac, mac, 6))
+        {
+            return UHOS_TRUE;
+        }
+
+        idx = (idx + 1) & m->mac_mask;
+    }
+
+    return UHOS_FALSE;
+}
+
+/**
+ * @brief       向MAC集合中插入地址（重复地址忽略）
+ */
+static void uhos_ble_pal_adv_filter_mac_insert(uhos_ble_pal_adv_matcher_t *m, const uhos_u8 *mac)
+{
+    uhos_u32 idx = uhos_ble_pal_adv_filter_mac_hash(mac) & m->mac_mask;
+
+    while (m->mac_set[idx].used)
+    {
+        if (0 == uhos_libc_memcmp(m->mac_set[idx].mac, mac, 6))
+        {
+            return;
+        }
+
+        idx = (idx + 1) & m->mac_mask;
+    }
+
+    m->mac_set[idx].used = 1;
+    uhos_libc_memcpy(m->mac_set[idx].mac, mac, 6);
+}
+
+/**
+ * @brief       释放编译后的规则
+ */
+static void uhos_ble_pal_adv_filter_free(uhos_ble_pal_adv_matcher_t *m)
+{
+    if (UHOS_NULL == m)
+    {
+        return;
+    }
+
+    uhos_libc_free(m->cids);
+    uhos_libc_free(m->mac_set);
+    uhos_libc_free(m->uuid16);
+    uhos_libc_free(m->uuid32);
+    uhos_libc_free(m->uuid128);
+    uhos_libc_free(m);
+}
+
+/**
+ * @brief       将透传规则编译为匹配器
+ * @param[in]   rules   透传规则
+ * @return      匹配器，失败返回UHOS_NULL
+ */
+static uhos_ble_pal_adv_matcher_t *uhos_ble_pal_adv_filter_compile(const uhos_ble_gap_adv_filter_rules_t *rules)
+{
+    uhos_ble_pal_adv_matcher_t *m     = UHOS_NULL;
+    uhos_u32                    slots = 1;
+    uhos_u32                    i     = 0;
+
+    if ((rules->cid_num > UHOS_BLE_ADV_FILTER_RULE_MAX) || (rules->mac_num > UHOS_BLE_ADV_FILTER_RULE_MAX) ||
+        (rules->uuid_num > UHOS_BLE_ADV_FILTER_RULE_MAX))
+    {
+        UHOS_LOGE("too many rules");
+        return UHOS_NULL;
+    }
+
+    m = uhos_libc_zalloc(sizeof(uhos_ble_pal_adv_matcher_t));
+    if (UHOS_NULL == m)
+    {
+        return UHOS_NULL;
+    }
+
+    m->relation = rules->rule_relation ? 1 : 0;
+
+    // CID：有序数组
+    if (rules->cid_num && rules->cids)
+    {
+        m->cids = uhos_libc_malloc(rules->cid_num * sizeof(uhos_u16));
+        if (UHOS_NULL == m->cids)
+        {
+            goto fail;
+        }
+
+        uhos_libc_memcpy(m->cids, rules->cids, rules->cid_num * sizeof(uhos_u16));
+        qsort(m->cids, rules->cid_num, sizeof(uhos_u16), uhos_ble_pal_adv_filter_cmp16);
+        m->cid_num = (uhos_u16)rules->cid_num;
+        m->required |= UHOS_BLE_ADV_FILTER_CID;
+    }
+
+    // MAC：开放寻址哈希集合，负载因子不超过1/2
+    if (rules->mac_num && rules->macs)
+    {
+        while (slots < rules->mac_num * 2)
+        {
+            slots <<= 1;
+        }
+
+        m->mac_set = uhos_libc_zalloc(slots * sizeof(uhos_ble_pal_adv_filter_mac_slot_t));
+        if (UHOS_NULL == m->mac_set)
+        {
+            goto fail;
+        }
+
+        m->mac_mask = slots - 1;
+        for (i = 0; i < rules->mac_num; i++)
+        {
+            uhos_ble_pal_adv_filter_mac_insert(m, rules->macs[i].mac);
+        }
+
+        m->required |= UHOS_BLE_ADV_FILTER_MAC;
+    }
+
+    // UUID：按位宽拆分为三个有序数组
+    if (rules->uuid_num && rules->uuids)
+    {
+        for (i = 0; i < rules->uuid_num; i++)
+        {
+            switch (rules->uuids[i].uuid_type)
+            {
+                case UHOS_BLE_ADV_FILTER_UUID_TYPE_16:  m->uuid16_num++;  break;
+                case UHOS_BLE_ADV_FILTER_UUID_TYPE_32:  m->uuid32_num++;  break;
+                case UHOS_BLE_ADV_FILTER_UUID_TYPE_128: m->uuid128_num++; break;
+                default:
+                    UHOS_LOGE("uuid type %d invalid", rules->uuids[i].uuid_type);
+                    goto fail;
+            }
+        }
+
+        m->uuid16  = m->uuid16_num ? uhos_libc_malloc(m->uuid16_num * sizeof(uhos_u16)) : UHOS_NULL;
+        m->uuid32  = m->uuid32_num ? uhos_libc_malloc(m->uuid32_num * sizeof(uhos_u32)) : UHOS_NULL;
+        m->uuid128 = m->uuid128_num ? uhos_libc_malloc(m->uuid128_num * 16) : UHOS_NULL;
+
+        if ((m->uuid16_num && !m->uuid16) || (m->uuid32_num && !m->uuid32) || (m->uuid128_num && !m->uuid128))
+        {
+            goto fail;
+        }
+
+        m->uuid16_num = m->uuid32_num = m->uuid128_num = 0;
+        for (i = 0; i < rules->uuid_num; i++)
+        {
+            const uhos_u8 *uuid = rules->uuids[i].uuid;
+
+            if (UHOS_BLE_ADV_FILTER_UUID_TYPE_16 == rules->uuids[i].uuid_type)
+            {
+                m->uuid16[m->uuid16_num++] = uhos_ble_ad_le16(uuid);
+            }
+            else if (UHOS_BLE_ADV_FILTER_UUID_TYPE_32 == rules->uuids[i].uuid_type)
+            {
+                m->uuid32[m->uuid32_num++] = uhos_ble_ad_le32(uuid);
+            }
+            else
+            {
+                uhos_libc_memcpy(m->uuid128[m->uuid128_num++], uuid, 16);
+            }
+        }
+
+        qsort(m->uuid16, m->uuid16_num, sizeof(uhos_u16), uhos_ble_pal_adv_filter_cmp16);
+        qsort(m->uuid32, m->uuid32_num, sizeof(uhos_u32), uhos_ble_pal_adv_filter_cmp32);
+        qsort(m->uuid128, m->uuid128_num, 16, uhos_ble_pal_adv_filter_cmp128);
+
+        m->required |= UHOS_BLE_ADV_FILTER_UUID;
+    }
+
+    return m;
+
+fail:
+    uhos_ble_pal_adv_filter_free(m);
+    return UHOS_NULL;
+}
+
+/**
+ * @brief       在原始AD数据中查找命中的CID/UUID条件
+ * @param[in]   m       匹配器
+ * @param[in]   data    原始AD数据
+ * @param[in]   len     数据长度
+ * @param[in]   want    需要查找的条件类别
+ * @return      命中的条件类别
+ */
+static uhos_u8 uhos_ble_pal_adv_filter_scan_ad(const uhos_ble_pal_adv_matcher_t *m,
+                                                const uhos_u8                    *data,
+                                                uhos_u16                          len,
+                                                uhos_u8                           want)
+{
+    uhos_ble_ad_iter_t  it;
+    uhos_ble_ad_field_t field;
+    uhos_u8             hit   = 0;
+    uhos_u8             width = 0;
+    uhos_u8             num   = 0;
+    uhos_u8             i     = 0;
+    const uhos_u8      *uuid  = UHOS_NULL;
+    uhos_u16            v16   = 0;
+    uhos_u32            v32   = 0;
+
+    uhos_ble_ad_iter_init(&it, data, len);
+
+    while ((hit != want) && uhos_ble_ad_iter_next(&it, &field))
+    {
+        if (UHOS_BLE_AD_TYPE_MANUFACTURER == field.type)
+        {
+            if ((want & UHOS_BLE_ADV_FILTER_CID) && (field.len >= 2))
+            {
+                v16 = uhos_ble_ad_le16(field.data);
+                if (bsearch(&v16, m->cids, m->cid_num, sizeof(uhos_u16), uhos_ble_pal_adv_filter_cmp16))
+                {
+                    hit |= UHOS_BLE_ADV_FILTER_CID;
+                }
+            }
+            continue;
+        }
+
+        if (!(want & UHOS_BLE_ADV_FILTER_UUID))
+        {
+            continue;
+        }
+
+        // 服务UUID列表及服务数据中的UUID
+        width = uhos_ble_ad_field_uuid_width(&field);
+        num   = uhos_ble_ad_field_uuid_count(&field);
+
+        for (i = 0; i < num; i++)
+        {
+            uuid = uhos_ble_ad_field_uuid_at(&field, i);
+
+            if (2 == width)
+            {
+                v16 = uhos_ble_ad_le16(uuid);
+                uuid = bsearch(&v16, m->uuid16, m->uuid16_num, sizeof(uhos_u16), uhos_ble_pal_adv_filter_cmp16);
+            }
+            else if (4 == width)
+            {
+                v32 = uhos_ble_ad_le32(uuid);
+                uuid = bsearch(&v32, m->uuid32, m->uuid32_num, sizeof(uhos_u32), uhos_ble_pal_adv_filter_cmp32);
+            }
+            else
+            {
+                uuid = bsearch(uuid, m->uuid128, m->uuid128_num, 16, uhos_ble_pal_adv_filter_cmp128);
+            }
+
+            if (UHOS_NULL != uuid)
+            {
+                hit |= UHOS_BLE_ADV_FILTER_UUID;
+                break;
+            }
+        }
+    }
+
+    return hit;
+}
+
+/**
+ * @brief       执行匹配
+ * @param[in]   m       匹配器
+ * @param[in]   mac     对端地址
+ * @param[in]   data    原始AD数据
+ * @param[in]   len     数据长度
+ * @return      UHOS_TRUE-匹配，UHOS_FALSE-不匹配
+ */
+static uhos_bool uhos_ble_pal_adv_filter_run(const uhos_ble_pal_adv_matcher_t *m,
+                                              const uhos_u8                    *mac,
+                                              const uhos_u8                    *data,
+                                              uhos_u16                          len)
+{
+    uhos_u8 want = m->required & (UHOS_BLE_ADV_FILTER_CID | UHOS_BLE_ADV_FILTER_UUID);
+    uhos_u8 hit  = 0;
+
+    // MAC条件最廉价，优先判断
+    if (m->required & UHOS_BLE_ADV_FILTER_MAC)
+    {
+        if (uhos_ble_pal_adv_filter_mac_find(m, mac))
+        {
+            if (0 == m->relation)
+            {
+                return UHOS_TRUE;
+            }
+        }
+        else if (1 == m->relation)
+        {
+            return UHOS_FALSE;
+        }
+    }
+
+    if (0 == want)
+    {
+        // 只有MAC条件：走到这里说明“与”关系下已命中，或“或”关系下未命中
+        return (1 == m->relation) ? UHOS_TRUE : UHOS_FALSE;
+    }
+
+    if ((UHOS_NULL == data) || (0 == len))
+    {
+        return UHOS_FALSE;
+    }
+
+    hit = uhos_ble_pal_adv_filter_scan_ad(m, data, len, want);
+
+    return (1 == m->relation) ? (hit == want) : (0 != hit);
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       广播透传过滤初始化
+ */
+void uhos_ble_pal_adv_filter_init(void)
+{
+    __atomic_store_n(&g_uhos_ble_pal_adv_filter.checked, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&g_uhos_ble_pal_adv_filter.matched, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&g_uhos_ble_pal_adv_filter.rejected, 0, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief       使用已编译的透传规则匹配一条广播
+ * @param[in]   mac     对端地址
+ * @param[in]   data    原始AD数据
+ * @param[in]   len     原始AD数据长度
+ * @return      UHOS_TRUE-匹配或未设置规则，UHOS_FALSE-不匹配
+ */
+uhos_bool uhos_ble_pal_adv_filter_match(const uhos_u8 *mac, const uhos_u8 *data, uhos_u16 len)
+{
+    uhos_ble_pal_adv_filter_ctl_t *ctl    = &g_uhos_ble_pal_adv_filter;
+    uhos_ble_pal_adv_matcher_t    *m      = UHOS_NULL;
+    uhos_bool                      result = UHOS_TRUE;
+
+    __atomic_fetch_add(&ctl->readers, 1, __ATOMIC_SEQ_CST);
+
+    m = __atomic_load_n(&ctl->matcher, __ATOMIC_SEQ_CST);
+    if (UHOS_NULL != m)
+    {
+        result = uhos_ble_pal_adv_filter_run(m, mac, data, len);
+
+        __atomic_fetch_add(&ctl->checked, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(result ? &ctl->matched : &ctl->rejected, 1, __ATOMIC_RELAXED);
+    }
+
+    __atomic_fetch_sub(&ctl->readers, 1, __ATOMIC_RELEASE);
+
+    return result;
+}
+
+/**
+ * @brief       设置广播透传过滤规则
+ * @param[in]   rules 过滤规则，UHOS_NULL表示清除规则
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_gap_adv_filter_set(const uhos_ble_gap_adv_filter_rules_t *rules)
+{
+    uhos_ble_pal_adv_filter_ctl_t *ctl = &g_uhos_ble_pal_adv_filter;
+    uhos_ble_pal_adv_matcher_t    *m   = UHOS_NULL;
+    uhos_ble_pal_adv_matcher_t    *old = UHOS_NULL;
+
+    if (UHOS_NULL != rules)
+    {
+        m = uhos_ble_pal_adv_filter_compile(rules);
+        if (UHOS_NULL == m)
+        {
+            UHOS_LOGE("adv filter compile fail");
+            return UHOS_BLE_ERROR;
+        }
+
+        // 没有任何条件时等同于清除规则
+        if (0 == m->required)
+        {
+            uhos_ble_pal_adv_filter_free(m);
+            m = UHOS_NULL;
+        }
+    }
+
+    old = __atomic_exchange_n(&ctl->matcher, m, __ATOMIC_SEQ_CST);
+
+    // 等待正在使用旧规则的扫描回调退出后再释放：读到0时，之后进入的扫描回调必然读到新规则
+    while (0 != __atomic_load_n(&ctl->readers, __ATOMIC_SEQ_CST))
+    {
+        uhos_thread_sleep(1);
+    }
+
+    uhos_ble_pal_adv_filter_free(old);
+
+    UHOS_LOGI("adv filter %s, cid %u, mac %u, uuid %u",
+              m ? "set" : "clear",
+              rules ? rules->cid_num : 0,
+              rules ? rules->mac_num : 0,
+              rules ? rules->uuid_num : 0);
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       获取广播透传过滤的统计信息
+ * @param[out]  stats 统计信息
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_gap_adv_filter_stats_get(uhos_ble_gap_adv_filter_stats_t *stats)
+{
+    uhos_ble_pal_adv_filter_ctl_t *ctl = &g_uhos_ble_pal_adv_filter;
+
+    if (UHOS_NULL == stats)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    stats->checked  = __atomic_load_n(&ctl->checked, __ATOMIC_RELAXED);
+    stats->matched  = __atomic_load_n(&ctl->matched, __ATOMIC_RELAXED);
+    stats->rejected = __atomic_load_n(&ctl->rejected, __ATOMIC_RELAXED);
+
+    return UHOS_BLE_SUCCESS;
+}
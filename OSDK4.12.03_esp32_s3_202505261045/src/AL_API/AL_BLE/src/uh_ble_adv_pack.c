@@ -0,0 +1,559 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_adv_pack.c
+ * @author agent (agent@local)
+ * @brief 广播透传打包的功能实现
+ * @details 串口波特率较低时，每条广播上报单独成帧会被E++帧头占去大部分带宽。本模块将多条上报
+ *          打包为一帧，帧长达到上限或第一条上报等待超时后发送；同一帧中重复出现的MAC以序号编码，
+ *          数据与该MAC上一条相同的省略数据。发送函数返回队列已满或应用调用流控接口后暂停发送，
+ *          期间继续打包，帧满后丢弃新上报。帧缓存仅由ble_daemon任务访问，配置变更在互斥锁保护下进行。
+ *          帧格式为AL层自定义格式，须与接收方约定，因此默认不编译，定义CONFIG_UHOS_BLE_ADV_PACK_ENABLE后启用。
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：广播透传打包的功能实现
+ * </table>
+ */
+
+#define LOG_TAG "ble-p"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_osal.h"
+#include "uh_time.h"
+#include "uh_log.h"
+
+#include "uh_ble.h"
+#include "uh_ble_evt.h"
+#include "uh_ble_adv_pack.h"
+
+/**************************************************************************************************/
+/*                                          外部引用声明                                          */
+/**************************************************************************************************/
+
+
+#ifdef CONFIG_UHOS_BLE_ADV_PACK_ENABLE
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define UHOS_BLE_ADV_PACK_VERSION       0x01                    //<! 帧格式版本
+#define UHOS_BLE_ADV_PACK_HDR_LEN       2                       //<! 帧头：版本、条数
+#define UHOS_BLE_ADV_PACK_COUNT_MAX     255                     //<! 每帧上报条数上限
+
+#define UHOS_BLE_ADV_PACK_FLAG_TYPE     0x03                    //<! 广播数据类型
+#define UHOS_BLE_ADV_PACK_FLAG_RANDOM   0x04                    //<! 随机地址
+#define UHOS_BLE_ADV_PACK_FLAG_MAC_REF  0x40                    //<! MAC以序号编码
+#define UHOS_BLE_ADV_PACK_FLAG_DATA_REF 0x80                    //<! 数据与该MAC上一条相同
+
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      本帧中出现过的MAC
+ */
+typedef struct uhos_ble_pal_adv_pack_mac
+{
+    uhos_ble_addr_t addr;                                       //<! MAC
+    uhos_u16        data_off;                                   //<! 该MAC上一条数据在帧中的偏移
+    uhos_u8         data_len;                                   //<! 该MAC上一条数据的长度
+} uhos_ble_pal_adv_pack_mac_t;
+
+/**
+ * @struct      广播透传打包控制块
+ */
+typedef struct uhos_ble_pal_adv_pack_ctl
+{
+    uhos_mutex_t                  mutex;                        //<! 互斥锁，保护配置与帧缓存
+    uhos_ble_gap_adv_pack_cfg_t   cfg;                          //<! 打包配置
+    uhos_u32                      stopped;                      //<! 应用流控暂停标志
+    uhos_bool                     busy;                         //<! 发送队列已满，等待重试
+    uhos_u8                      *frame;                        //<! 帧缓存
+    uhos_u16                      len;                          //<! 帧长度
+    uhos_u8                       count;                        //<! 帧中上报条数
+    uhos_u32                      first_time;                   //<! 帧中第一条上报的时刻
+    uhos_u8                       mac_num;                      //<! 帧中记录的MAC个数
+    uhos_ble_pal_adv_pack_mac_t   macs[CONFIG_UHOS_BLE_ADV_PACK_MAC_NUM];
+    uhos_ble_gap_adv_pack_stats_t stats;                        //<! 统计信息
+} uhos_ble_pal_adv_pack_ctl_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_ble_pal_adv_pack_ctl_t g_uhos_ble_pal_adv_pack_ctl = {0};
+
+/**************************************************************************************************/
+/*                                          内部函数原型                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static void uhos_ble_pal_adv_pack_lock(void)
+{
+    uhos_mutex_wait(g_uhos_ble_pal_adv_pack_ctl.mutex, UHOS_MUTEX_WAIT_FOREVER);
+}
+
+static void uhos_ble_pal_adv_pack_unlock(void)
+{
+    uhos_mutex_release(g_uhos_ble_pal_adv_pack_ctl.mutex);
+}
+
+/**
+ * @brief       清空帧缓存（调用者持有锁）
+ */
+static void uhos_ble_pal_adv_pack_clear(void)
+{
+    uhos_ble_pal_adv_pack_ctl_t *ctl = &g_uhos_ble_pal_adv_pack_ctl;
+
+    ctl->len     = 0;
+    ctl->count   = 0;
+    ctl->mac_num = 0;
+    ctl->busy    = UHOS_FALSE;
+}
+
+/**
+ * @brief       发送当前帧（调用者持有锁）
+ * @return      UHOS_TRUE-帧已发送或为空，UHOS_FALSE-流控暂停或发送队列已满
+ */
+static uhos_bool uhos_ble_pal_adv_pack_flush(uhos_u32 now)
+{
+    uhos_ble_pal_adv_pack_ctl_t *ctl  = &g_uhos_ble_pal_adv_pack_ctl;
+    uhos_u32                     wait = 0;
+
+    if (0 == ctl->count)
+    {
+        return UHOS_TRUE;
+    }
+
+    if (__atomic_load_n(&ctl->stopped, __ATOMIC_ACQUIRE))
+    {
+        return UHOS_FALSE;
+    }
+
+    ctl->frame[1] = ctl->count;
+    if (0 != ctl->cfg.sink(ctl->frame, ctl->len))
+    {
+        // 发送队列已满，保留本帧，下次唤醒时重试
+        if (!ctl->busy)
+        {
+            ctl->busy = UHOS_TRUE;
+            ctl->stats.busy++;
+        }
+        return UHOS_FALSE;
+    }
+
+    wait = now - ctl->first_time;
+    ctl->stats.frames++;
+    ctl->stats.reports += ctl->count;
+    ctl->stats.bytes   += ctl->len;
+    if (wait > ctl->stats.max_wait_ms)
+    {
+        ctl->stats.max_wait_ms = wait;
+    }
+
+    uhos_ble_pal_adv_pack_clear();
+
+    return UHOS_TRUE;
+}
+
+/**
+ * @brief       查找帧中记录的MAC
+ */
+static uhos_ble_pal_adv_pack_mac_t *uhos_ble_pal_adv_pack_mac_find(const uhos_ble_addr_t addr, uhos_u8 *idx)
+{
+    uhos_ble_pal_adv_pack_ctl_t *ctl = &g_uhos_ble_pal_adv_pack_ctl;
+    uhos_u8                      i   = 0;
+
+    for (i = 0; i < ctl->mac_num; i++)
+    {
+        if (0 == uhos_libc_memcmp(ctl->macs[i].addr, addr, sizeof(uhos_ble_addr_t)))
+        {
+            *idx = i;
+            return &ctl->macs[i];
+        }
+    }
+
+    return UHOS_NULL;
+}
+
+/**
+ * @brief       编码一条上报的长度
+ */
+static uhos_u16 uhos_ble_pal_adv_pack_rec_len(const uhos_ble_addr_t addr, const uhos_u8 *data, uhos_u8 len)
+{
+    uhos_ble_pal_adv_pack_ctl_t *ctl = &g_uhos_ble_pal_adv_pack_ctl;
+    uhos_ble_pal_adv_pack_mac_t *mac = UHOS_NULL;
+    uhos_u8                      idx = 0;
+
+    mac = uhos_ble_pal_adv_pack_mac_find(addr, &idx);
+    if (UHOS_NULL == mac)
+    {
+        return 1 + sizeof(uhos_ble_addr_t) + 1 + 1 + len;
+    }
+
+    if ((mac->data_len == len) && (0 == uhos_libc_memcmp(ctl->frame + mac->data_off, data, len)))
+    {
+        return 1 + 1 + 1;
+    }
+
+    return 1 + 1 + 1 + 1 + len;
+}
+
+/**
+ * @brief       将一条上报编码到帧尾（调用者持有锁，且已确认空间足够）
+ */
+static void uhos_ble_pal_adv_pack_put(const uhos_ble_addr_t addr, uhos_ble_addr_type_t addr_type,
+                                      uhos_ble_gap_adv_data_type_t adv_type, uhos_s8 rssi,
+                                      const uhos_u8 *data, uhos_u8 len, uhos_u32 now)
+{
+    uhos_ble_pal_adv_pack_ctl_t *ctl   = &g_uhos_ble_pal_adv_pack_ctl;
+    uhos_ble_pal_adv_pack_mac_t *mac   = UHOS_NULL;
+    uhos_u8                     *p     = UHOS_NULL;
+    uhos_u8                      flags = 0;
+    uhos_u8                      idx   = 0;
+
+    if (0 == ctl->count)
+    {
+        ctl->frame[0]   = UHOS_BLE_ADV_PACK_VERSION;
+        ctl->len        = UHOS_BLE_ADV_PACK_HDR_LEN;
+        ctl->first_time = now;
+    }
+
+    p     = ctl->frame + ctl->len;
+    flags = ((uhos_u8)adv_type & UHOS_BLE_ADV_PACK_FLAG_TYPE) |
+            ((UHOS_BLE_ADDRESS_TYPE_RANDOM == addr_type) ? UHOS_BLE_ADV_PACK_FLAG_RANDOM : 0);
+
+    mac = uhos_ble_pal_adv_pack_mac_find(addr, &idx);
+    if (UHOS_NULL != mac)
+    {
+        flags |= UHOS_BLE_ADV_PACK_FLAG_MAC_REF;
+        if ((mac->data_len == len) && (0 == uhos_libc_memcmp(ctl->frame + mac->data_off, data, len)))
+        {
+            flags |= UHOS_BLE_ADV_PACK_FLAG_DATA_REF;
+        }
+    }
+
+    *p++ = flags;
+    if (UHOS_NULL != mac)
+    {
+        *p++ = idx;
+        ctl->stats.mac_refs++;
+    }
+    else
+    {
+        uhos_libc_memcpy(p, addr, sizeof(uhos_ble_addr_t));
+        p += sizeof(uhos_ble_addr_t);
+
+        // 记录本帧中新出现的MAC，记满后不再以序号编码
+        if (ctl->mac_num < CONFIG_UHOS_BLE_ADV_PACK_MAC_NUM)
+        {
+            mac = &ctl->macs[ctl->mac_num++];
+            uhos_libc_memcpy(mac->addr, addr, sizeof(uhos_ble_addr_t));
+        }
+    }
+    *p++ = (uhos_u8)rssi;
+
+    if (flags & UHOS_BLE_ADV_PACK_FLAG_DATA_REF)
+    {
+        ctl->stats.data_refs++;
+    }
+    else
+    {
+        *p++ = len;
+        if (UHOS_NULL != mac)
+        {
+            mac->data_off = (uhos_u16)(p - ctl->frame);
+            mac->data_len = len;
+        }
+        uhos_libc_memcpy(p, data, len);
+        p += len;
+    }
+
+    ctl->len = (uhos_u16)(p - ctl->frame);
+    ctl->count++;
+}
+
+/**
+ * @brief       加入一条上报，帧已满时先发送当前帧
+ */
+static void uhos_ble_pal_adv_pack_append(const uhos_ble_addr_t addr, uhos_ble_addr_type_t addr_type,
+                                         uhos_ble_gap_adv_data_type_t adv_type, uhos_s8 rssi,
+                                         const uhos_u8 *data, uhos_u16 len)
+{
+    uhos_ble_pal_adv_pack_ctl_t *ctl     = &g_uhos_ble_pal_adv_pack_ctl;
+    uhos_u16                     rec_len = 0;
+    uhos_u32                     now     = 0;
+
+    if ((UHOS_NULL == ctl->mutex) || (UHOS_NULL == ctl->cfg.sink))
+    {
+        return;
+    }
+
+    uhos_ble_pal_adv_pack_lock();
+
+    if (UHOS_NULL == ctl->cfg.sink)
+    {
+        uhos_ble_pal_adv_pack_unlock();
+        return;
+    }
+
+    // 单条超过帧长上限的无法发送
+    if ((len > 0xFF) || ((UHOS_BLE_ADV_PACK_HDR_LEN + 1 + sizeof(uhos_ble_addr_t) + 1 + 1 + len) > ctl->cfg.max_frame))
+    {
+        ctl->stats.dropped++;
+        uhos_ble_pal_adv_pack_unlock();
+        return;
+    }
+
+    now     = uhos_current_time_get();
+    rec_len = (0 == ctl->count) ? 0 : uhos_ble_pal_adv_pack_rec_len(addr, data, (uhos_u8)len);
+    if ((0 != ctl->count) &&
+        (((ctl->len + rec_len) > ctl->cfg.max_frame) || (UHOS_BLE_ADV_PACK_COUNT_MAX == ctl->count)))
+    {
+        if (!uhos_ble_pal_adv_pack_flush(now))
+        {
+            ctl->stats.dropped++;
+            uhos_ble_pal_adv_pack_unlock();
+            return;
+        }
+    }
+
+    uhos_ble_pal_adv_pack_put(addr, addr_type, adv_type, rssi, data, (uhos_u8)len, now);
+
+    if (0 == ctl->cfg.max_delay_ms)
+    {
+        uhos_ble_pal_adv_pack_flush(now);
+    }
+
+    uhos_ble_pal_adv_pack_unlock();
+}
+#endif // CONFIG_UHOS_BLE_ADV_PACK_ENABLE
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+#ifdef CONFIG_UHOS_BLE_ADV_PACK_ENABLE
+/**
+ * @brief       广播透传打包初始化
+ */
+void uhos_ble_pal_adv_pack_init(void)
+{
+    if (UHOS_NULL == g_uhos_ble_pal_adv_pack_ctl.mutex)
+    {
+        if (UHOS_SUCCESS != uhos_mutex_create(&g_uhos_ble_pal_adv_pack_ctl.mutex))
+        {
+            UHOS_LOGE("create mutex err");
+        }
+    }
+}
+
+/**
+ * @brief       将一条广播上报加入当前帧
+ */
+void uhos_ble_pal_adv_pack_add(const uhos_ble_gap_adv_report_t *report)
+{
+    uhos_ble_pal_adv_pack_append(report->peer_addr, report->addr_type, report->adv_type, report->rssi,
+                                 report->data, report->data_len);
+}
+
+/**
+ * @brief       将一条扩展广播上报加入当前帧
+ */
+void uhos_ble_pal_adv_pack_ext_add(const uhos_ble_gap_ext_adv_report_t *report)
+{
+    uhos_ble_pal_adv_pack_append(report->peer_addr, report->addr_type, report->adv_type, report->rssi,
+                                 report->data, report->data_len);
+}
+
+/**
+ * @brief       发送到期的帧
+ */
+uhos_u32 uhos_ble_pal_adv_pack_tick(void)
+{
+    uhos_ble_pal_adv_pack_ctl_t *ctl     = &g_uhos_ble_pal_adv_pack_ctl;
+    uhos_u32                     now     = 0;
+    uhos_u32                     elapsed = 0;
+    uhos_u32                     next    = UHOS_BLE_ADV_PACK_IDLE;
+
+    if ((UHOS_NULL == ctl->mutex) || (UHOS_NULL == ctl->cfg.sink))
+    {
+        return UHOS_BLE_ADV_PACK_IDLE;
+    }
+
+    uhos_ble_pal_adv_pack_lock();
+
+    if ((UHOS_NULL != ctl->cfg.sink) && (0 != ctl->count))
+    {
+        now     = uhos_current_time_get();
+        elapsed = now - ctl->first_time;
+        if (elapsed < ctl->cfg.max_delay_ms)
+        {
+            next = ctl->cfg.max_delay_ms - elapsed;
+        }
+        else if (!uhos_ble_pal_adv_pack_flush(now))
+        {
+            // 流控暂停时由恢复接口唤醒；发送队列已满时按守护任务的等待周期重试
+            next = UHOS_BLE_ADV_PACK_IDLE;
+        }
+    }
+
+    uhos_ble_pal_adv_pack_unlock();
+
+    return next;
+}
+
+/**
+ * @brief       配置广播透传打包
+ */
+uhos_ble_status_t uhos_ble_gap_adv_pack_config(const uhos_ble_gap_adv_pack_cfg_t *cfg)
+{
+    uhos_ble_pal_adv_pack_ctl_t *ctl   = &g_uhos_ble_pal_adv_pack_ctl;
+    uhos_u8                     *frame = UHOS_NULL;
+
+    if ((UHOS_NULL != cfg) && (UHOS_NULL != cfg->sink) &&
+        ((cfg->max_frame > CONFIG_UHOS_BLE_ADV_PACK_FRAME_MAX) ||
+         (cfg->max_frame < (UHOS_BLE_ADV_PACK_HDR_LEN + 1 + sizeof(uhos_ble_addr_t) + 1 + 1))))
+    {
+        UHOS_LOGE("max_frame %d invalid", cfg->max_frame);
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_pal_adv_pack_init();
+    if (UHOS_NULL == ctl->mutex)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    if ((UHOS_NULL != cfg) && (UHOS_NULL != cfg->sink))
+    {
+        frame = (uhos_u8 *)uhos_libc_malloc(cfg->max_frame);
+        if (UHOS_NULL == frame)
+        {
+            return UHOS_BLE_ERROR;
+        }
+    }
+
+    uhos_ble_pal_adv_pack_lock();
+
+    // 重新配置时丢弃未发送的帧，统计清零
+    uhos_libc_free(ctl->frame);
+    ctl->frame = frame;
+    uhos_ble_pal_adv_pack_clear();
+    uhos_libc_memset(&ctl->stats, 0, sizeof(uhos_ble_gap_adv_pack_stats_t));
+    if (UHOS_NULL != frame)
+    {
+        uhos_libc_memcpy(&ctl->cfg, cfg, sizeof(uhos_ble_gap_adv_pack_cfg_t));
+    }
+    else
+    {
+        uhos_libc_memset(&ctl->cfg, 0, sizeof(uhos_ble_gap_adv_pack_cfg_t));
+    }
+
+    uhos_ble_pal_adv_pack_unlock();
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       广播透传打包的流控
+ */
+uhos_ble_status_t uhos_ble_gap_adv_pack_flow_ctrl(uhos_bool stop)
+{
+    // 仅修改标志，可在发送函数内调用
+    __atomic_store_n(&g_uhos_ble_pal_adv_pack_ctl.stopped, stop ? 1 : 0, __ATOMIC_RELEASE);
+
+    // 恢复后尽快发送积压的帧
+    if (!stop)
+    {
+        uhos_ble_pal_evt_wake();
+    }
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       获取广播透传打包的统计信息
+ */
+uhos_ble_status_t uhos_ble_gap_adv_pack_stats_get(uhos_ble_gap_adv_pack_stats_t *stats)
+{
+    uhos_ble_pal_adv_pack_ctl_t *ctl = &g_uhos_ble_pal_adv_pack_ctl;
+
+    if (UHOS_NULL == stats)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    if (UHOS_NULL == ctl->mutex)
+    {
+        uhos_libc_memset(stats, 0, sizeof(uhos_ble_gap_adv_pack_stats_t));
+        return UHOS_BLE_SUCCESS;
+    }
+
+    uhos_ble_pal_adv_pack_lock();
+    uhos_libc_memcpy(stats, &ctl->stats, sizeof(uhos_ble_gap_adv_pack_stats_t));
+    stats->stopped = __atomic_load_n(&ctl->stopped, __ATOMIC_ACQUIRE) || ctl->busy;
+    uhos_ble_pal_adv_pack_unlock();
+
+    return UHOS_BLE_SUCCESS;
+}
+
+#else // CONFIG_UHOS_BLE_ADV_PACK_ENABLE
+
+void uhos_ble_pal_adv_pack_init(void)
+{
+}
+
+void uhos_ble_pal_adv_pack_add(const uhos_ble_gap_adv_report_t *report)
+{
+    (void)report;
+}
+
+void uhos_ble_pal_adv_pack_ext_add(const uhos_ble_gap_ext_adv_report_t *report)
+{
+    (void)report;
+}
+
+uhos_u32 uhos_ble_pal_adv_pack_tick(void)
+{
+    return UHOS_BLE_ADV_PACK_IDLE;
+}
+
+uhos_ble_status_t uhos_ble_gap_adv_pack_config(const uhos_ble_gap_adv_pack_cfg_t *cfg)
+{
+    // 关闭打包总是成功
+    if ((UHOS_NULL == cfg) || (UHOS_NULL == cfg->sink))
+    {
+        return UHOS_BLE_SUCCESS;
+    }
+
+    UHOS_LOGE("adv pack disabled, define CONFIG_UHOS_BLE_ADV_PACK_ENABLE");
+    return UHOS_BLE_ERROR;
+}
+
+uhos_ble_status_t uhos_ble_gap_adv_pack_flow_ctrl(uhos_bool stop)
+{
+    (void)stop;
+
+    return UHOS_BLE_SUCCESS;
+}
+
+uhos_ble_status_t uhos_ble_gap_adv_pack_stats_get(uhos_ble_gap_adv_pack_stats_t *stats)
+{
+    if (UHOS_NULL == stats)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_libc_memset(stats, 0, sizeof(uhos_ble_gap_adv_pack_stats_t));
+
+    return UHOS_BLE_SUCCESS;
+}
+
+#endif // CONFIG_UHOS_BLE_ADV_PACK_ENABLE
@@ -0,0 +1,464 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_adv_reasm.c
+ * @author agent (agent@local)
+ * @brief 扩展广播分段重组的功能实现
+ * @details 控制器将超过一个HCI事件的扩展广播拆成多段上报（INCOMPLETE...COMPLETE/TRUNCATED），
+ *          不同广播集的分段可能交错到达。以(地址, 地址类型, SID, 广播/扫描响应)为键，在固定个数的
+ *          重组槽中拼接，整条完成后交给ble_daemon任务投递。
+ *          重组槽状态：FREE -> BUILDING（仅扫描回调访问）-> READY（仅ble_daemon访问）-> FREE；
+ *          状态切换使用原子操作，双方无需加锁。
+ *          无空闲槽时放弃最久未更新的BUILDING槽；全部为READY时丢弃分段，并记录该广播链，
+ *          直至其最后一段到达，避免把链尾误当作新广播。
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：扩展广播分段重组的功能实现
+ * </table>
+ */
+
+#define LOG_TAG "ble-r"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_osal.h"
+#include "uh_log.h"
+#include "uh_libc.h"
+
+#include "uh_ble.h"
+#include "uh_ble_adv_reasm.h"
+
+/**************************************************************************************************/
+/*                                          外部引用声明                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define UHOS_BLE_ADV_REASM_NUM              CONFIG_UHOS_BLE_EXT_ADV_REASM_NUM
+#define UHOS_BLE_ADV_REASM_DATA_MAX         CONFIG_UHOS_BLE_EXT_ADV_DATA_MAX
+#define UHOS_BLE_ADV_REASM_TIMEOUT_MS       CONFIG_UHOS_BLE_EXT_ADV_REASM_TIMEOUT_MS
+
+#if (UHOS_BLE_ADV_REASM_NUM < 1) || (UHOS_BLE_ADV_REASM_NUM > 32)
+#error "CONFIG_UHOS_BLE_EXT_ADV_REASM_NUM out of range"
+#endif
+
+#if (UHOS_BLE_ADV_REASM_DATA_MAX < 31) || (UHOS_BLE_ADV_REASM_DATA_MAX > 0xFFFF)
+#error "CONFIG_UHOS_BLE_EXT_ADV_DATA_MAX out of range"
+#endif
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @enum        重组槽状态
+ */
+typedef enum uhos_ble_pal_adv_reasm_state
+{
+    UHOS_BLE_ADV_REASM_FREE = 0,                                //<! 空闲
+    UHOS_BLE_ADV_REASM_BUILDING,                                //<! 重组中
+    UHOS_BLE_ADV_REASM_READY,                                   //<! 重组完成，等待投递
+} uhos_ble_pal_adv_reasm_state_t;
+
+/**
+ * @struct      广播链的键
+ */
+typedef struct uhos_ble_pal_adv_reasm_key
+{
+    uhos_ble_addr_t addr;                                       //<! 对端地址
+    uhos_u8         addr_type;                                  //<! 地址类型
+    uhos_u8         sid;                                        //<! 广播集标识
+    uhos_u8         rsp;                                        //<! 1-扫描响应，0-广播数据
+} uhos_ble_pal_adv_reasm_key_t;
+
+/**
+ * @struct      重组槽
+ */
+typedef struct uhos_ble_pal_adv_reasm_slot
+{
+    uhos_u32                      state;                        //<! 槽状态 @ref uhos_ble_pal_adv_reasm_state_t
+    uhos_u32                      seq;                          //<! 完成序号，按序投递
+    uhos_u32                      last_ms;                      //<! 最近一次收到分段的时间
+    uhos_ble_pal_adv_reasm_key_t  key;                          //<! 广播链的键
+    uhos_ble_gap_ext_adv_report_t report;                       //<! 广播信息，data指向buf
+    uhos_u8                       buf[UHOS_BLE_ADV_REASM_DATA_MAX];   //<! 载荷
+} uhos_ble_pal_adv_reasm_slot_t;
+
+/**
+ * @struct      被丢弃的广播链
+ */
+typedef struct uhos_ble_pal_adv_reasm_skip
+{
+    uhos_u8                       used;                         //<! 是否有效
+    uhos_u32                      since_ms;                     //<! 最近一次丢弃分段的时间
+    uhos_ble_pal_adv_reasm_key_t  key;                          //<! 广播链的键
+} uhos_ble_pal_adv_reasm_skip_t;
+
+/**
+ * @struct      分段重组控制块
+ */
+typedef struct uhos_ble_pal_adv_reasm_ctl
+{
+    uhos_u32                      seq;                          //<! 下一个完成序号，仅扫描回调访问
+    uhos_u32                      fragments;                    //<! 收到的分段数
+    uhos_u32                      reports;                      //<! 重组完成的条数
+    uhos_u32                      truncated;                    //<! 被截断的条数
+    uhos_u32                      evicted;                      //<! 被放弃的广播链数
+    uhos_u32                      dropped;                      //<! 丢弃的分段数
+    uhos_ble_pal_adv_reasm_skip_t skip[UHOS_BLE_ADV_REASM_NUM]; //<! 被丢弃的广播链，仅扫描回调访问
+    uhos_ble_pal_adv_reasm_slot_t slot[UHOS_BLE_ADV_REASM_NUM]; //<! 重组槽
+} uhos_ble_pal_adv_reasm_ctl_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_ble_pal_adv_reasm_ctl_t g_uhos_ble_pal_adv_reasm = {0};   //<! 分段重组控制块
+
+/**************************************************************************************************/
+/*                                          内部函数原型                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       由分段生成广播链的键
+ */
+static void uhos_ble_pal_adv_reasm_key_make(const uhos_ble_gap_ext_adv_report_t *frag, uhos_ble_pal_adv_reasm_key_t *key)
+{
+    uhos_libc_memset(key, 0, sizeof(uhos_ble_pal_adv_reasm_key_t));
+    uhos_libc_memcpy(key->addr, frag->peer_addr, sizeof(uhos_ble_addr_t));
+    key->addr_type = (uhos_u8)frag->addr_type;
+    key->sid       = frag->sid;
+    key->rsp       = (SCAN_RSP_DATA == frag->adv_type) ? 1 : 0;
+}
+
+/**
+ * @brief       比较两个广播链的键
+ * @return      UHOS_TRUE-相同
+ */
+static uhos_bool uhos_ble_pal_adv_reasm_key_equal(const uhos_ble_pal_adv_reasm_key_t *a,
+                                                  const uhos_ble_pal_adv_reasm_key_t *b)
+{
+    return (a->addr_type == b->addr_type) && (a->sid == b->sid) && (a->rsp == b->rsp) &&
+           (0 == uhos_libc_memcmp(a->addr, b->addr, sizeof(uhos_ble_addr_t)));
+}
+
+/**
+ * @brief       查找被丢弃的广播链，超时的记录顺带清除
+ * @return      记录指针；未找到返回UHOS_NULL
+ */
+static uhos_ble_pal_adv_reasm_skip_t *uhos_ble_pal_adv_reasm_skip_find(const uhos_ble_pal_adv_reasm_key_t *key, uhos_u32 now)
+{
+    uhos_ble_pal_adv_reasm_ctl_t  *ctl  = &g_uhos_ble_pal_adv_reasm;
+    uhos_ble_pal_adv_reasm_skip_t *skip = UHOS_NULL;
+    uhos_u32                       i    = 0;
+
+    for (i = 0; i < UHOS_BLE_ADV_REASM_NUM; i++)
+    {
+        skip = &ctl->skip[i];
+
+        if (!skip->used)
+        {
+            continue;
+        }
+
+        if ((now - skip->since_ms) >= UHOS_BLE_ADV_REASM_TIMEOUT_MS)
+        {
+            skip->used = 0;
+            continue;
+        }
+
+        if (uhos_ble_pal_adv_reasm_key_equal(&skip->key, key))
+        {
+            return skip;
+        }
+    }
+
+    return UHOS_NULL;
+}
+
+/**
+ * @brief       记录被丢弃的广播链，记录已满时替换最早的一条
+ */
+static void uhos_ble_pal_adv_reasm_skip_add(const uhos_ble_pal_adv_reasm_key_t *key, uhos_u32 now)
+{
+    uhos_ble_pal_adv_reasm_ctl_t  *ctl    = &g_uhos_ble_pal_adv_reasm;
+    uhos_ble_pal_adv_reasm_skip_t *victim = &ctl->skip[0];
+    uhos_u32                       i      = 0;
+
+    for (i = 0; i < UHOS_BLE_ADV_REASM_NUM; i++)
+    {
+        if (!ctl->skip[i].used)
+        {
+            victim = &ctl->skip[i];
+            break;
+        }
+
+        if ((uhos_s32)(ctl->skip[i].since_ms - victim->since_ms) < 0)
+        {
+            victim = &ctl->skip[i];
+        }
+    }
+
+    victim->used     = 1;
+    victim->since_ms = now;
+    uhos_libc_memcpy(&victim->key, key, sizeof(uhos_ble_pal_adv_reasm_key_t));
+}
+
+/**
+ * @brief       为新的广播链分配重组槽
+ * @note        优先使用空闲槽，其次放弃最久未更新的BUILDING槽；全部为READY时分配失败
+ * @return      重组槽；分配失败返回UHOS_NULL
+ */
+static uhos_ble_pal_adv_reasm_slot_t *uhos_ble_pal_adv_reasm_alloc(uhos_u32 now)
+{
+    uhos_ble_pal_adv_reasm_ctl_t  *ctl    = &g_uhos_ble_pal_adv_reasm;
+    uhos_ble_pal_adv_reasm_slot_t *slot   = UHOS_NULL;
+    uhos_ble_pal_adv_reasm_slot_t *victim = UHOS_NULL;
+    uhos_u32                       state  = 0;
+    uhos_u32                       i      = 0;
+
+    for (i = 0; i < UHOS_BLE_ADV_REASM_NUM; i++)
+    {
+        slot  = &ctl->slot[i];
+        state = __atomic_load_n(&slot->state, __ATOMIC_ACQUIRE);
+
+        if (UHOS_BLE_ADV_REASM_FREE == state)
+        {
+            return slot;
+        }
+
+        if ((UHOS_BLE_ADV_REASM_BUILDING == state) &&
+            ((UHOS_NULL == victim) || ((uhos_s32)(slot->last_ms - victim->last_ms) < 0)))
+        {
+            victim = slot;
+        }
+    }
+
+    if (UHOS_NULL != victim)
+    {
+        // 被放弃的广播链若还有后续分段，需要跳过
+        __atomic_fetch_add(&ctl->evicted, 1, __ATOMIC_RELAXED);
+        if ((now - victim->last_ms) < UHOS_BLE_ADV_REASM_TIMEOUT_MS)
+        {
+            uhos_ble_pal_adv_reasm_skip_add(&victim->key, now);
+        }
+    }
+
+    return victim;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       分段重组初始化
+ */
+void uhos_ble_pal_adv_reasm_init(void)
+{
+    uhos_libc_memset(&g_uhos_ble_pal_adv_reasm, 0, sizeof(uhos_ble_pal_adv_reasm_ctl_t));
+}
+
+/**
+ * @brief       加入一个扩展广播分段
+ * @param[in]   frag    分段
+ * @param[in]   status  分段状态
+ * @return      UHOS_TRUE-有一条广播重组完成
+ */
+uhos_bool uhos_ble_pal_adv_reasm_add(const uhos_ble_gap_ext_adv_report_t *frag, uhos_ble_pal_adv_reasm_status_t status)
+{
+    uhos_ble_pal_adv_reasm_ctl_t  *ctl   = &g_uhos_ble_pal_adv_reasm;
+    uhos_ble_pal_adv_reasm_slot_t *slot  = UHOS_NULL;
+    uhos_ble_pal_adv_reasm_skip_t *skip  = UHOS_NULL;
+    uhos_ble_pal_adv_reasm_key_t   key;
+    uhos_u32                       now   = 0;
+    uhos_u32                       room  = 0;
+    uhos_u32                       copy  = 0;
+    uhos_u32                       i     = 0;
+
+    if ((UHOS_NULL == frag) || ((UHOS_NULL == frag->data) && (0 != frag->data_len)))
+    {
+        return UHOS_FALSE;
+    }
+
+    __atomic_fetch_add(&ctl->fragments, 1, __ATOMIC_RELAXED);
+
+    now = uhos_current_time_get();
+    uhos_ble_pal_adv_reasm_key_make(frag, &key);
+
+    // 已被丢弃的广播链：最后一段到达后清除记录
+    skip = uhos_ble_pal_adv_reasm_skip_find(&key, now);
+    if (UHOS_NULL != skip)
+    {
+        __atomic_fetch_add(&ctl->dropped, 1, __ATOMIC_RELAXED);
+        skip->since_ms = now;
+        if (UHOS_BLE_PAL_ADV_REASM_MORE != status)
+        {
+            skip->used = 0;
+        }
+        return UHOS_FALSE;
+    }
+
+    // 查找正在重组的广播链，超时的视为已中断
+    for (i = 0; i < UHOS_BLE_ADV_REASM_NUM; i++)
+    {
+        if ((UHOS_BLE_ADV_REASM_BUILDING == __atomic_load_n(&ctl->slot[i].state, __ATOMIC_RELAXED)) &&
+            uhos_ble_pal_adv_reasm_key_equal(&ctl->slot[i].key, &key))
+        {
+            slot = &ctl->slot[i];
+            if ((now - slot->last_ms) >= UHOS_BLE_ADV_REASM_TIMEOUT_MS)
+            {
+                __atomic_fetch_add(&ctl->evicted, 1, __ATOMIC_RELAXED);
+                slot->report.data_len = 0;
+                slot->report.truncated = UHOS_FALSE;
+            }
+            break;
+        }
+    }
+
+    if (UHOS_NULL == slot)
+    {
+        slot = uhos_ble_pal_adv_reasm_alloc(now);
+        if (UHOS_NULL == slot)
+        {
+            __atomic_fetch_add(&ctl->dropped, 1, __ATOMIC_RELAXED);
+            if (UHOS_BLE_PAL_ADV_REASM_MORE == status)
+            {
+                uhos_ble_pal_adv_reasm_skip_add(&key, now);
+            }
+            return UHOS_FALSE;
+        }
+
+        uhos_libc_memcpy(&slot->key, &key, sizeof(uhos_ble_pal_adv_reasm_key_t));
+        uhos_libc_memcpy(&slot->report, frag, sizeof(uhos_ble_gap_ext_adv_report_t));
+        slot->report.data      = slot->buf;
+        slot->report.data_len  = 0;
+        slot->report.truncated = UHOS_FALSE;
+        __atomic_store_n(&slot->state, UHOS_BLE_ADV_REASM_BUILDING, __ATOMIC_RELAXED);
+    }
+
+    // 追加载荷，超出缓存的部分丢弃
+    room = UHOS_BLE_ADV_REASM_DATA_MAX - slot->report.data_len;
+    copy = (frag->data_len > room) ? room : frag->data_len;
+    if (copy < frag->data_len)
+    {
+        slot->report.truncated = UHOS_TRUE;
+    }
+
+    if (copy)
+    {
+        uhos_libc_memcpy(&slot->buf[slot->report.data_len], frag->data, copy);
+        slot->report.data_len = (uhos_u16)(slot->report.data_len + copy);
+    }
+
+    slot->report.rssi = frag->rssi;
+    slot->last_ms     = now;
+
+    if (UHOS_BLE_PAL_ADV_REASM_MORE == status)
+    {
+        return UHOS_FALSE;
+    }
+
+    if (UHOS_BLE_PAL_ADV_REASM_TRUNCATED == status)
+    {
+        slot->report.truncated = UHOS_TRUE;
+    }
+
+    __atomic_fetch_add(&ctl->reports, 1, __ATOMIC_RELAXED);
+    if (slot->report.truncated)
+    {
+        __atomic_fetch_add(&ctl->truncated, 1, __ATOMIC_RELAXED);
+    }
+
+    // 发布给ble_daemon任务
+    slot->seq = ctl->seq++;
+    __atomic_store_n(&slot->state, UHOS_BLE_ADV_REASM_READY, __ATOMIC_RELEASE);
+
+    return UHOS_TRUE;
+}
+
+/**
+ * @brief       按完成顺序取出最早一条重组完成的广播
+ * @param[out]  report  重组后的广播
+ * @return      UHOS_TRUE-取出成功
+ */
+uhos_bool uhos_ble_pal_adv_reasm_get(uhos_ble_gap_ext_adv_report_t *report)
+{
+    uhos_ble_pal_adv_reasm_ctl_t  *ctl    = &g_uhos_ble_pal_adv_reasm;
+    uhos_ble_pal_adv_reasm_slot_t *oldest = UHOS_NULL;
+    uhos_u32                       i      = 0;
+
+    if (UHOS_NULL == report)
+    {
+        return UHOS_FALSE;
+    }
+
+    for (i = 0; i < UHOS_BLE_ADV_REASM_NUM; i++)
+    {
+        if ((UHOS_BLE_ADV_REASM_READY == __atomic_load_n(&ctl->slot[i].state, __ATOMIC_ACQUIRE)) &&
+            ((UHOS_NULL == oldest) || ((uhos_s32)(ctl->slot[i].seq - oldest->seq) < 0)))
+        {
+            oldest = &ctl->slot[i];
+        }
+    }
+
+    if (UHOS_NULL == oldest)
+    {
+        return UHOS_FALSE;
+    }
+
+    uhos_libc_memcpy(report, &oldest->report, sizeof(uhos_ble_gap_ext_adv_report_t));
+
+    return UHOS_TRUE;
+}
+
+/**
+ * @brief       归还重组槽
+ * @param[in]   report  uhos_ble_pal_adv_reasm_get取出的广播
+ */
+void uhos_ble_pal_adv_reasm_put(const uhos_ble_gap_ext_adv_report_t *report)
+{
+    uhos_ble_pal_adv_reasm_ctl_t *ctl = &g_uhos_ble_pal_adv_reasm;
+    uhos_u32                      i   = 0;
+
+    if (UHOS_NULL == report)
+    {
+        return;
+    }
+
+    for (i = 0; i < UHOS_BLE_ADV_REASM_NUM; i++)
+    {
+        if (report->data == ctl->slot[i].buf)
+        {
+            __atomic_store_n(&ctl->slot[i].state, UHOS_BLE_ADV_REASM_FREE, __ATOMIC_RELEASE);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief       获取分段重组的统计信息
+ * @param[out]  stats   统计信息
+ */
+void uhos_ble_pal_adv_reasm_stats_get(uhos_ble_gap_ext_scan_stats_t *stats)
+{
+    uhos_ble_pal_adv_reasm_ctl_t *ctl = &g_uhos_ble_pal_adv_reasm;
+
+    if (UHOS_NULL == stats)
+    {
+        return;
+    }
+
+    stats->fragments = __atomic_load_n(&ctl->fragments, __ATOMIC_RELAXED);
+    stats->reports   = __atomic_load_n(&ctl->reports, __ATOMIC_RELAXED);
+    stats->truncated = __atomic_load_n(&ctl->truncated, __ATOMIC_RELAXED);
+    stats->evicted   = __atomic_load_n(&ctl->evicted, __ATOMIC_RELAXED);
+    stats->dropped   = __atomic_load_n(&ctl->dropped, __ATOMIC_RELAXED);
+}
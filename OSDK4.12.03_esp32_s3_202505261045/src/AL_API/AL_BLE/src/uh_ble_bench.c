@@ -0,0 +1,753 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_bench.c
+ * @author agent (agent@local)
+ * @brief BLE吞吐与延迟基准测试的功能实现
+ * @details 通过对外接口uhos_ble_gatts_notify_or_indicate、uhos_ble_gattc_write_without_rsp、
+ *          uhos_ble_gattc_write_with_rsp驱动数据，每个连接保持不超过CONFIG_UHOS_BLE_BENCH_WINDOW个未完成操作；
+ *          协议栈按提交顺序上报完成事件，按连接先进先出匹配提交时间得到单次操作延迟。
+ *          连接由平台环境提供：主机模拟器为每个用例建立虚拟连接，硬件上使用当前已建立的连接。
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：BLE吞吐与延迟基准测试的功能实现
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>输出与计时改用uh_bench.h
+ * </table>
+ */
+
+#define LOG_TAG "ble-bench"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_osal.h"
+#include "uh_log.h"
+#include "uh_shell.h"
+#include "uh_bench.h"
+
+#include "uh_ble.h"
+#include "uh_ble_conn.h"
+#include "uh_ble_bench.h"
+
+/**************************************************************************************************/
+/*                                          外部引用声明                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+// 连接参数更新使用的监控超时（单位10ms）
+#define UHOS_BLE_BENCH_SUP_TIMEOUT          400
+
+// JSON行的最大长度
+#define UHOS_BLE_BENCH_JSON_LEN             512
+
+// shell命令默认的每连接操作次数
+#define UHOS_BLE_BENCH_SHELL_OPS            200
+
+#define UHOS_BLE_BENCH_ARRAY_NUM(a)         (sizeof(a) / sizeof((a)[0]))
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      参与测试的连接
+ */
+typedef struct uhos_ble_pal_bench_conn
+{
+    uhos_u16  conn_id;                                          //<! 连接ID
+    uhos_u8   dead;                                             //<! 接口返回错误，不再提交
+    uhos_u16  head;                                             //<! 提交时间环的头
+    uhos_u16  count;                                            //<! 未完成的操作数
+    uhos_u16  busy_at;                                          //<! 返回BUSY时的未完成操作数，有操作完成前不再提交
+    uhos_u32  submitted;                                        //<! 已提交的操作数
+    uhos_u32  ts[CONFIG_UHOS_BLE_BENCH_WINDOW];                 //<! 未完成操作的提交时间（微秒）
+} uhos_ble_pal_bench_conn_t;
+
+/**
+ * @struct      基准测试控制块
+ */
+typedef struct uhos_ble_pal_bench_ctl
+{
+    uhos_mutex_t              mutex;                            //<! 互斥锁
+    volatile uhos_u8          running;                          //<! 是否正在执行用例
+    uhos_u8                   op;                               //<! 当前用例的操作类型
+    uhos_u8                   conn_num;                         //<! 参与测试的连接数
+    uhos_ble_bench_env_t      env;                              //<! 平台环境
+    volatile uhos_u32         allocs;                           //<! AL层数据路径的内存分配次数
+    uhos_u32                  done;                             //<! 成功完成的操作数
+    uhos_u32                  failed;                           //<! 完成事件为失败的操作数
+    uhos_u32                  last_done;                        //<! 最后一次完成的时间（微秒）
+    uhos_u32                 *samples;                          //<! 延迟样本（微秒）
+    uhos_u32                  sample_num;                       //<! 样本数
+    uhos_ble_pal_bench_conn_t conn[CONFIG_UHOS_BLE_MAX_CONN];   //<! 参与测试的连接
+} uhos_ble_pal_bench_ctl_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_ble_pal_bench_ctl_t g_uhos_ble_pal_bench_ctl = {0};     //<! 基准测试控制块
+
+static const uhos_char *g_uhos_ble_bench_op_name[UHOS_BLE_BENCH_OP_MAX] = {"notify", "write_cmd", "write_req"};
+
+// shell命令使用的默认矩阵
+static const uhos_u16 g_uhos_ble_bench_mtus[]      = {23, 185, 247};
+static const uhos_u16 g_uhos_ble_bench_intervals[] = {12, 24, 48};
+static const uhos_u16 g_uhos_ble_bench_payloads[]  = {20, 64, 180, 244};
+static const uhos_u8  g_uhos_ble_bench_conns[]     = {1, 2};
+
+/**************************************************************************************************/
+/*                                          内部函数原型                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static void uhos_ble_pal_bench_lock(void)
+{
+    uhos_mutex_wait(g_uhos_ble_pal_bench_ctl.mutex, UHOS_MUTEX_WAIT_FOREVER);
+}
+
+static void uhos_ble_pal_bench_unlock(void)
+{
+    uhos_mutex_release(g_uhos_ble_pal_bench_ctl.mutex);
+}
+
+static uhos_ble_pal_bench_conn_t *uhos_ble_pal_bench_conn_find(uhos_u16 conn_id)
+{
+    uhos_u8 i = 0;
+
+    for (i = 0; i < g_uhos_ble_pal_bench_ctl.conn_num; i++)
+    {
+        if (g_uhos_ble_pal_bench_ctl.conn[i].conn_id == conn_id)
+        {
+            return &g_uhos_ble_pal_bench_ctl.conn[i];
+        }
+    }
+
+    return UHOS_NULL;
+}
+
+/**
+ * @brief       延迟样本升序排序（希尔排序，不额外分配内存）
+ */
+static void uhos_ble_pal_bench_sort(uhos_u32 *data, uhos_u32 num)
+{
+    uhos_u32 gap = 0, i = 0, j = 0, v = 0;
+
+    for (gap = num / 2; gap > 0; gap /= 2)
+    {
+        for (i = gap; i < num; i++)
+        {
+            v = data[i];
+            for (j = i; (j >= gap) && (data[j - gap] > v); j -= gap)
+            {
+                data[j] = data[j - gap];
+            }
+            data[j] = v;
+        }
+    }
+}
+
+/**
+ * @brief       调用被测接口
+ */
+static uhos_ble_status_t uhos_ble_pal_bench_issue(const uhos_ble_bench_case_t *bcase, uhos_u16 conn_id, uhos_u8 *data)
+{
+    switch (bcase->op)
+    {
+    case UHOS_BLE_BENCH_NOTIFY:
+        return uhos_ble_gatts_notify_or_indicate(conn_id, 0, bcase->handle, 0, data, bcase->payload_len);
+    case UHOS_BLE_BENCH_WRITE_CMD:
+        return uhos_ble_gattc_write_without_rsp(conn_id, bcase->handle, data, bcase->payload_len);
+    default:
+        return uhos_ble_gattc_write_with_rsp(conn_id, bcase->handle, data, (uhos_u8)bcase->payload_len);
+    }
+}
+
+/**
+ * @brief       按用例调整MTU与连接间隔，等待生效后记录实际值
+ * @note        MTU只能在连接上交换一次，已交换过的连接保持原值
+ */
+static void uhos_ble_pal_bench_conn_prepare(const uhos_ble_bench_case_t *bcase, const uhos_u16 *conn_handles,
+                                            uhos_u8 num, uhos_ble_bench_result_t *result)
+{
+    uhos_ble_gap_conn_param_t param = {0};
+    uhos_ble_conn_stats_t     stats = {0};
+    uhos_u32                  start = uhos_current_time_get();
+    uhos_bool                 ready = UHOS_FALSE;
+    uhos_u8                   i     = 0;
+
+    param.min_conn_interval = bcase->interval;
+    param.max_conn_interval = bcase->interval;
+    param.conn_sup_timeout  = UHOS_BLE_BENCH_SUP_TIMEOUT;
+
+    for (i = 0; i < num; i++)
+    {
+        if (UHOS_BLE_SUCCESS != uhos_ble_gatts_conn_stats_get(conn_handles[i], &stats))
+        {
+            continue;
+        }
+        if (bcase->mtu && (stats.mtu < bcase->mtu))
+        {
+            uhos_ble_gattc_exchange_mtu(conn_handles[i], bcase->mtu);
+        }
+        if (bcase->interval && (stats.interval != bcase->interval))
+        {
+            uhos_ble_gap_update_conn_params(conn_handles[i], param);
+        }
+    }
+
+    while (!ready)
+    {
+        ready = UHOS_TRUE;
+        result->mtu      = 0xFFFF;
+        result->interval = 0;
+
+        for (i = 0; i < num; i++)
+        {
+            uhos_libc_memset(&stats, 0, sizeof(stats));
+            uhos_ble_gatts_conn_stats_get(conn_handles[i], &stats);
+
+            if ((bcase->mtu && (stats.mtu < bcase->mtu)) || (bcase->interval && (stats.interval != bcase->interval)))
+            {
+                ready = UHOS_FALSE;
+            }
+            result->mtu      = (stats.mtu < result->mtu) ? stats.mtu : result->mtu;
+            result->interval = (stats.interval > result->interval) ? stats.interval : result->interval;
+        }
+
+        if (!ready)
+        {
+            if (uhos_current_time_get() - start >= CONFIG_UHOS_BLE_BENCH_SETTLE_MS)
+            {
+                UHOS_LOGW("params not settled, mtu %d interval %d", result->mtu, result->interval);
+                break;
+            }
+            uhos_thread_sleep(10);
+        }
+    }
+}
+
+/**
+ * @brief       提交操作直到全部完成、连接失效或超时
+ */
+static void uhos_ble_pal_bench_drive(const uhos_ble_bench_case_t *bcase, uhos_u8 *data, uhos_ble_bench_result_t *result)
+{
+    uhos_ble_pal_bench_ctl_t  *ctl      = &g_uhos_ble_pal_bench_ctl;
+    uhos_ble_pal_bench_conn_t *conn     = UHOS_NULL;
+    uhos_u32                   timeout  = bcase->timeout_ms ? bcase->timeout_ms : CONFIG_UHOS_BLE_BENCH_TIMEOUT_MS;
+    uhos_u32                   start    = uhos_current_time_get();
+    uhos_ble_status_t          ret      = UHOS_BLE_SUCCESS;
+    uhos_bool                  progress = UHOS_FALSE;
+    uhos_bool                  finished = UHOS_FALSE;
+    uhos_u8                    i        = 0;
+
+    while (1)
+    {
+        progress = UHOS_FALSE;
+
+        for (i = 0; i < ctl->conn_num; i++)
+        {
+            conn = &ctl->conn[i];
+
+            while (!conn->dead && (conn->submitted < bcase->ops_per_conn))
+            {
+                // 先记录提交时间，完成事件可能先于接口返回到达
+                uhos_ble_pal_bench_lock();
+                if ((conn->count >= CONFIG_UHOS_BLE_BENCH_WINDOW) || (conn->busy_at && (conn->count >= conn->busy_at)))
+                {
+                    uhos_ble_pal_bench_unlock();
+                    break;
+                }
+                conn->busy_at = 0;
+                conn->ts[(conn->head + conn->count) % CONFIG_UHOS_BLE_BENCH_WINDOW] = uhos_bench_now_us();
+                conn->count++;
+                uhos_ble_pal_bench_unlock();
+
+                ret = uhos_ble_pal_bench_issue(bcase, conn->conn_id, data);
+                if (UHOS_BLE_SUCCESS == ret)
+                {
+                    conn->submitted++;
+                    progress = UHOS_TRUE;
+                    continue;
+                }
+
+                // 未提交成功，撤销刚记录的提交时间；BUSY时等待有操作完成再提交，避免空转
+                uhos_ble_pal_bench_lock();
+                conn->count--;
+                if (UHOS_BLE_BUSY == ret)
+                {
+                    conn->busy_at = conn->count;
+                }
+                uhos_ble_pal_bench_unlock();
+
+                if (UHOS_BLE_BUSY == ret)
+                {
+                    result->busy++;
+                    break;
+                }
+
+                UHOS_LOGW("conn %d issue fail, stop", conn->conn_id);
+                result->errors++;
+                conn->dead = 1;
+            }
+        }
+
+        finished = UHOS_TRUE;
+        uhos_ble_pal_bench_lock();
+        for (i = 0; i < ctl->conn_num; i++)
+        {
+            conn = &ctl->conn[i];
+            if ((!conn->dead && (conn->submitted < bcase->ops_per_conn)) || conn->count)
+            {
+                finished = UHOS_FALSE;
+            }
+        }
+        uhos_ble_pal_bench_unlock();
+
+        if (finished)
+        {
+            break;
+        }
+
+        if (uhos_current_time_get() - start >= timeout)
+        {
+            result->timed_out = UHOS_TRUE;
+            break;
+        }
+
+        if (!progress)
+        {
+            uhos_thread_sleep(1);
+        }
+    }
+}
+
+/**
+ * @brief       汇总一个用例的结果
+ */
+static void uhos_ble_pal_bench_summarize(const uhos_ble_bench_case_t *bcase, uhos_u32 start_us,
+                                         uhos_u64 cpu_start, uhos_u32 heap_start, uhos_ble_bench_result_t *result)
+{
+    uhos_ble_pal_bench_ctl_t *ctl = &g_uhos_ble_pal_bench_ctl;
+    uhos_u32                  n   = ctl->sample_num;
+
+    result->ops    = ctl->done + ctl->failed;
+    result->errors += ctl->failed;
+    result->bytes  = ctl->done * bcase->payload_len;
+
+    if (ctl->done)
+    {
+        result->elapsed_us  = ctl->last_done - start_us;
+        result->goodput_bps = result->elapsed_us ?
+                              (uhos_u32)((uhos_u64)result->bytes * 1000000 / result->elapsed_us) : 0;
+    }
+
+    if (n)
+    {
+        uhos_ble_pal_bench_sort(ctl->samples, n);
+        result->lat_p50_us = ctl->samples[(n - 1) * 50 / 100];
+        result->lat_p99_us = ctl->samples[(n - 1) * 99 / 100];
+        result->lat_max_us = ctl->samples[n - 1];
+    }
+
+    if (ctl->env.cpu_us_get && result->bytes)
+    {
+        result->cpu_us_per_kb = (uhos_s32)((ctl->env.cpu_us_get() - cpu_start) * 1024 / result->bytes);
+    }
+
+    if (result->ops)
+    {
+        result->al_allocs_x100 = (uhos_s32)((uhos_u64)ctl->allocs * 100 / result->ops);
+        if (ctl->env.alloc_count_get)
+        {
+            result->heap_allocs_x100 = (uhos_s32)((uhos_u64)(ctl->env.alloc_count_get() - heap_start) * 100 / result->ops);
+        }
+    }
+}
+
+/**
+ * @brief       shell命令：ble_bench <notify|write_cmd|write_req|all> <handle> [ops_per_conn]
+ */
+static void uhos_ble_pal_bench_shell_print(const uhos_char *line)
+{
+    uhos_shell_printf("%s\r\n", line);
+}
+
+static uhos_s32 uhos_ble_pal_bench_shell(int argc, char *argv[])
+{
+    uhos_ble_bench_matrix_t matrix = {0};
+    int                     handle = 0;
+    uhos_u8                 i      = 0;
+
+    if ((argc < 3) || (1 != uhos_libc_sscanf(argv[2], "%i", &handle)))
+    {
+        uhos_shell_printf("usage: ble_bench <notify|write_cmd|write_req|all> <handle> [ops_per_conn]\r\n");
+        return -1;
+    }
+
+    for (i = 0; i < UHOS_BLE_BENCH_OP_MAX; i++)
+    {
+        if ((0 == uhos_libc_strcmp(argv[1], "all")) || (0 == uhos_libc_strcmp(argv[1], g_uhos_ble_bench_op_name[i])))
+        {
+            matrix.op_mask |= (1 << i);
+        }
+    }
+    if (0 == matrix.op_mask)
+    {
+        uhos_shell_printf("unknown op %s\r\n", argv[1]);
+        return -1;
+    }
+
+    matrix.mtus          = g_uhos_ble_bench_mtus;
+    matrix.mtu_num       = UHOS_BLE_BENCH_ARRAY_NUM(g_uhos_ble_bench_mtus);
+    matrix.intervals     = g_uhos_ble_bench_intervals;
+    matrix.interval_num  = UHOS_BLE_BENCH_ARRAY_NUM(g_uhos_ble_bench_intervals);
+    matrix.payloads      = g_uhos_ble_bench_payloads;
+    matrix.payload_num   = UHOS_BLE_BENCH_ARRAY_NUM(g_uhos_ble_bench_payloads);
+    matrix.conns         = g_uhos_ble_bench_conns;
+    matrix.conn_num      = UHOS_BLE_BENCH_ARRAY_NUM(g_uhos_ble_bench_conns);
+    matrix.notify_handle = (uhos_u16)handle;
+    matrix.write_handle  = (uhos_u16)handle;
+    matrix.ops_per_conn  = (argc > 3) ? (uhos_u32)uhos_libc_atoi(argv[3]) : UHOS_BLE_BENCH_SHELL_OPS;
+
+    return (UHOS_BLE_SUCCESS == uhos_ble_bench_matrix_run(&matrix, uhos_ble_pal_bench_shell_print)) ? 0 : -1;
+}
+UHOS_SHELL_EXPORT_CMD(ble_bench, uhos_ble_pal_bench_shell, BLE throughput and latency benchmark);
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       一次操作已完成
+ */
+void uhos_ble_pal_bench_op_done(uhos_u16 conn_id, uhos_u8 op, uhos_bool ok)
+{
+    uhos_ble_pal_bench_ctl_t  *ctl  = &g_uhos_ble_pal_bench_ctl;
+    uhos_ble_pal_bench_conn_t *conn = UHOS_NULL;
+    uhos_u32                   now  = 0;
+
+    if (!ctl->running || (op != ctl->op))
+    {
+        return;
+    }
+
+    now = uhos_bench_now_us();
+
+    uhos_ble_pal_bench_lock();
+
+    conn = uhos_ble_pal_bench_conn_find(conn_id);
+    if (ctl->running && conn && conn->count)
+    {
+        if (ok)
+        {
+            ctl->done++;
+            ctl->last_done = now;
+            if (ctl->sample_num < CONFIG_UHOS_BLE_BENCH_SAMPLE_NUM)
+            {
+                ctl->samples[ctl->sample_num++] = now - conn->ts[conn->head];
+            }
+        }
+        else
+        {
+            ctl->failed++;
+        }
+
+        conn->head = (conn->head + 1) % CONFIG_UHOS_BLE_BENCH_WINDOW;
+        conn->count--;
+    }
+
+    uhos_ble_pal_bench_unlock();
+}
+
+/**
+ * @brief       AL层数据路径上发生了一次内存分配
+ */
+void uhos_ble_pal_bench_alloc(void)
+{
+    if (g_uhos_ble_pal_bench_ctl.running)
+    {
+        g_uhos_ble_pal_bench_ctl.allocs++;
+    }
+}
+
+/**
+ * @brief       设置基准测试的平台环境
+ * @param[in]   env 平台环境
+ * @return      uhos_ble_status_t
+ */
+uhos_ble_status_t uhos_ble_bench_env_set(const uhos_ble_bench_env_t *env)
+{
+    if (g_uhos_ble_pal_bench_ctl.running)
+    {
+        return UHOS_BLE_BUSY;
+    }
+
+    if (env)
+    {
+        g_uhos_ble_pal_bench_ctl.env = *env;
+    }
+    else
+    {
+        uhos_libc_memset(&g_uhos_ble_pal_bench_ctl.env, 0, sizeof(uhos_ble_bench_env_t));
+    }
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       执行单个基准测试用例
+ * @param[in]   bcase   测试用例
+ * @param[out]  result  测试结果
+ * @return      uhos_ble_status_t
+ */
+uhos_ble_status_t uhos_ble_bench_run(const uhos_ble_bench_case_t *bcase, uhos_ble_bench_result_t *result)
+{
+    uhos_ble_pal_bench_ctl_t *ctl        = &g_uhos_ble_pal_bench_ctl;
+    uhos_u16                  handles[CONFIG_UHOS_BLE_MAX_CONN] = {0};
+    uhos_u8                  *data       = UHOS_NULL;
+    uhos_u64                  cpu_start  = 0;
+    uhos_u32                  heap_start = 0;
+    uhos_u32                  start_us   = 0;
+    uhos_u32                  i          = 0;
+    uhos_u8                   num        = 0;
+
+    // 输入参数检查
+    if ((UHOS_NULL == bcase) || (UHOS_NULL == result) || (bcase->op >= UHOS_BLE_BENCH_OP_MAX) ||
+        (0 == bcase->payload_len) || (0 == bcase->conn_num) || (bcase->conn_num > CONFIG_UHOS_BLE_MAX_CONN) ||
+        (0 == bcase->ops_per_conn))
+    {
+        UHOS_LOGE("invalid case");
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_libc_memset(result, 0, sizeof(uhos_ble_bench_result_t));
+    result->status           = UHOS_BLE_ERROR;
+    result->cpu_us_per_kb    = -1;
+    result->heap_allocs_x100 = -1;
+
+    if (ctl->running)
+    {
+        return UHOS_BLE_BUSY;
+    }
+
+    if ((UHOS_NULL == ctl->mutex) && (UHOS_SUCCESS != uhos_mutex_create(&ctl->mutex)))
+    {
+        UHOS_LOGE("create mutex err");
+        return UHOS_BLE_ERROR;
+    }
+
+    // 建立或选取参与测试的连接
+    num = ctl->env.setup ? ctl->env.setup(bcase, handles, bcase->conn_num) :
+          uhos_ble_pal_conn_list(handles, bcase->conn_num);
+    result->conn_num = num;
+    if (num < bcase->conn_num)
+    {
+        UHOS_LOGW("need %d conns, got %d", bcase->conn_num, num);
+        goto exit;
+    }
+
+    uhos_ble_pal_bench_conn_prepare(bcase, handles, num, result);
+    if ((bcase->payload_len + 3 > result->mtu) ||
+        ((UHOS_BLE_BENCH_WRITE_REQ == bcase->op) && (bcase->payload_len > 0xFF)))
+    {
+        UHOS_LOGW("payload %d not fit mtu %d", bcase->payload_len, result->mtu);
+        goto exit;
+    }
+
+    data         = uhos_libc_malloc(bcase->payload_len);
+    ctl->samples = uhos_libc_malloc(CONFIG_UHOS_BLE_BENCH_SAMPLE_NUM * sizeof(uhos_u32));
+    if ((UHOS_NULL == data) || (UHOS_NULL == ctl->samples))
+    {
+        UHOS_LOG_MEM_ALLOC_FAIL();
+        goto exit;
+    }
+    for (i = 0; i < bcase->payload_len; i++)
+    {
+        data[i] = (uhos_u8)i;
+    }
+
+    uhos_ble_pal_bench_lock();
+    uhos_libc_memset(ctl->conn, 0, sizeof(ctl->conn));
+    for (i = 0; i < num; i++)
+    {
+        ctl->conn[i].conn_id = handles[i];
+    }
+    ctl->conn_num   = num;
+    ctl->op         = (uhos_u8)bcase->op;
+    ctl->allocs     = 0;
+    ctl->done       = 0;
+    ctl->failed     = 0;
+    ctl->sample_num = 0;
+    uhos_ble_pal_bench_unlock();
+
+    cpu_start  = ctl->env.cpu_us_get ? ctl->env.cpu_us_get() : 0;
+    heap_start = ctl->env.alloc_count_get ? ctl->env.alloc_count_get() : 0;
+    start_us   = uhos_bench_now_us();
+    ctl->running = 1;
+
+    uhos_ble_pal_bench_drive(bcase, data, result);
+
+    uhos_ble_pal_bench_lock();
+    ctl->running = 0;
+    uhos_ble_pal_bench_unlock();
+
+    uhos_ble_pal_bench_summarize(bcase, start_us, cpu_start, heap_start, result);
+    result->status = (result->timed_out || (0 == result->ops)) ? UHOS_BLE_ERROR : UHOS_BLE_SUCCESS;
+
+exit:
+    uhos_libc_free(data);
+    uhos_libc_free(ctl->samples);
+    ctl->samples = UHOS_NULL;
+
+    if (ctl->env.teardown)
+    {
+        ctl->env.teardown(handles, num);
+    }
+
+    return result->status;
+}
+
+/**
+ * @brief       将用例与结果格式化为一行JSON
+ */
+uhos_s32 uhos_ble_bench_result_json(const uhos_ble_bench_case_t *bcase, const uhos_ble_bench_result_t *result,
+                                    uhos_char *buf, uhos_u32 size)
+{
+    uhos_bench_json_t json     = {0};
+    uhos_char         cpu[16]  = {0};
+    uhos_char         al[16]   = {0};
+    uhos_char         heap[16] = {0};
+    const uhos_char  *status   = "ok";
+
+    if ((UHOS_NULL == bcase) || (UHOS_NULL == result) || (UHOS_NULL == buf) || (bcase->op >= UHOS_BLE_BENCH_OP_MAX))
+    {
+        return 0;
+    }
+
+    if (result->timed_out)
+    {
+        status = "timeout";
+    }
+    else if ((UHOS_BLE_SUCCESS != result->status) && result->errors)
+    {
+        status = "failed";
+    }
+    else if (UHOS_BLE_SUCCESS != result->status)
+    {
+        status = "skipped";
+    }
+
+    // 无法获取的指标输出null，每次操作的分配次数保留两位小数
+    if (result->cpu_us_per_kb >= 0)
+    {
+        uhos_libc_snprintf(cpu, sizeof(cpu), "%d", (int)result->cpu_us_per_kb);
+    }
+    if (result->heap_allocs_x100 >= 0)
+    {
+        uhos_libc_snprintf(heap, sizeof(heap), "%d.%02d", (int)(result->heap_allocs_x100 / 100),
+                           (int)(result->heap_allocs_x100 % 100));
+    }
+    uhos_libc_snprintf(al, sizeof(al), "%d.%02d", (int)(result->al_allocs_x100 / 100),
+                       (int)(result->al_allocs_x100 % 100));
+
+    uhos_bench_json_begin(&json, buf, size);
+    uhos_bench_json_str(&json, "op", g_uhos_ble_bench_op_name[bcase->op]);
+    uhos_bench_json_u32(&json, "mtu", bcase->mtu);
+    uhos_bench_json_u32(&json, "interval", bcase->interval);
+    uhos_bench_json_u32(&json, "payload", bcase->payload_len);
+    uhos_bench_json_u32(&json, "conns", bcase->conn_num);
+    uhos_bench_json_str(&json, "status", status);
+    uhos_bench_json_u32(&json, "mtu_eff", result->mtu);
+    uhos_bench_json_u32(&json, "interval_eff", result->interval);
+    uhos_bench_json_u32(&json, "ops", result->ops);
+    uhos_bench_json_u32(&json, "errors", result->errors);
+    uhos_bench_json_u32(&json, "busy", result->busy);
+    uhos_bench_json_u32(&json, "bytes", result->bytes);
+    uhos_bench_json_u32(&json, "elapsed_us", result->elapsed_us);
+    uhos_bench_json_u32(&json, "goodput_bps", result->goodput_bps);
+    uhos_bench_json_u32(&json, "lat_p50_us", result->lat_p50_us);
+    uhos_bench_json_u32(&json, "lat_p99_us", result->lat_p99_us);
+    uhos_bench_json_u32(&json, "lat_max_us", result->lat_max_us);
+    uhos_bench_json_raw(&json, "cpu_us_per_kb", (result->cpu_us_per_kb >= 0) ? cpu : UHOS_NULL);
+    uhos_bench_json_raw(&json, "al_allocs_per_op", al);
+    uhos_bench_json_raw(&json, "heap_allocs_per_op", (result->heap_allocs_x100 >= 0) ? heap : UHOS_NULL);
+
+    return uhos_bench_json_end(&json);
+}
+
+/**
+ * @brief       按矩阵依次执行基准测试用例
+ */
+uhos_ble_status_t uhos_ble_bench_matrix_run(const uhos_ble_bench_matrix_t *matrix, uhos_bench_print_t print)
+{
+    uhos_ble_bench_case_t   bcase  = {0};
+    uhos_ble_bench_result_t result = {0};
+    uhos_char              *line   = UHOS_NULL;
+    uhos_u8                 op = 0, m = 0, ci = 0, p = 0, c = 0;
+
+    if ((UHOS_NULL == matrix) || (UHOS_NULL == print) || (UHOS_NULL == matrix->mtus) ||
+        (UHOS_NULL == matrix->intervals) || (UHOS_NULL == matrix->payloads) || (UHOS_NULL == matrix->conns))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    line = uhos_libc_malloc(UHOS_BLE_BENCH_JSON_LEN);
+    if (UHOS_NULL == line)
+    {
+        UHOS_LOG_MEM_ALLOC_FAIL();
+        return UHOS_BLE_ERROR;
+    }
+
+    bcase.ops_per_conn = matrix->ops_per_conn;
+    bcase.timeout_ms   = matrix->timeout_ms;
+
+    for (op = 0; op < UHOS_BLE_BENCH_OP_MAX; op++)
+    {
+        if (!(matrix->op_mask & (1 << op)))
+        {
+            continue;
+        }
+
+        bcase.op     = (uhos_ble_bench_op_t)op;
+        bcase.handle = (UHOS_BLE_BENCH_NOTIFY == op) ? matrix->notify_handle : matrix->write_handle;
+
+        for (m = 0; m < matrix->mtu_num; m++)
+        {
+            for (ci = 0; ci < matrix->interval_num; ci++)
+            {
+                for (p = 0; p < matrix->payload_num; p++)
+                {
+                    for (c = 0; c < matrix->conn_num; c++)
+                    {
+                        bcase.mtu         = matrix->mtus[m];
+                        bcase.interval    = matrix->intervals[ci];
+                        bcase.payload_len = matrix->payloads[p];
+                        bcase.conn_num    = matrix->conns[c];
+
+                        // 数据长度超过MTU的组合直接跳过，不建立连接
+                        if (bcase.payload_len + 3 > bcase.mtu)
+                        {
+                            continue;
+                        }
+
+                        uhos_ble_bench_run(&bcase, &result);
+                        uhos_ble_bench_result_json(&bcase, &result, line, UHOS_BLE_BENCH_JSON_LEN);
+                        print(line);
+                    }
+                }
+            }
+        }
+    }
+
+    uhos_libc_free(line);
+
+    return UHOS_BLE_SUCCESS;
+}
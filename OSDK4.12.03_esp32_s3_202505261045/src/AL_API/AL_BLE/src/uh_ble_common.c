@@ -33,6 +33,13 @@
 #include "uh_osal.h"
 #include "uh_log.h"
 
+#include "uh_ble.h"
+#include "uh_ble_common.h"
+#include "uh_ble_gap.h"
+#include "uh_ble_gatt_server.h"
+#include "uh_ble_gatt_client.h"
+#include "uh_ble_daemon.h"
+
 
 /**************************************************************************************************/
 /*                                          外部引用声明                                          */
@@ -88,7 +95,7 @@ uhos_ble_status_t uhos_ble_address_get(uhos_ble_addr_t mac)
 	esp_err_t ret = 0;
     uhos_u8 addr_ptr[6] = {0,};
 
-    if(mac == NULL)
+    if(mac == UHOS_NULL)
         return UHOS_BLE_ERROR;
 
     ret = esp_read_mac(addr_ptr, ESP_MAC_WIFI_STA);
@@ -152,29 +159,10 @@ uhos_ble_status_t uhos_ble_enable(void)
 		return UHOS_BLE_ERROR;
 	}
 
-    ret = esp_ble_gatts_register_callback(NULL);
-    if (ret) {
-        UHOS_LOGE("gatts register error, error code = %x", ret);
-        return UHOS_BLE_ERROR;
-    }
-
-    ret = esp_ble_gattc_register_callback(NULL);
-    if (ret) {
-        UHOS_LOGE("gattc register error, error code = %x", ret);
-        return UHOS_BLE_ERROR;
-    }
-
-    ret = esp_ble_gap_register_callback(NULL);
-    if (ret) {
-        UHOS_LOGE("gap register error, error code = %x", ret);
-        return UHOS_BLE_ERROR;
-    }
-
-    ret = esp_ble_gatts_app_register(0);
-    if (ret) {
-        UHOS_LOGE("gatts app register error, error code = %x", ret);
-        return UHOS_BLE_ERROR;
-    }
+    // 先注册各层协议栈回调再注册应用，保证REG事件能被接收（gatts在初始化中完成注册）
+    uhos_ble_pal_gap_init();
+    uhos_ble_pal_gatts_init();
+    uhos_ble_pal_gattc_init();
 
     ret = esp_ble_gattc_app_register(0);
     if (ret) {
@@ -187,6 +175,9 @@ uhos_ble_status_t uhos_ble_enable(void)
         return UHOS_BLE_ERROR;
     }
 
+    uhos_ble_daemon_init();
+    flag_ble_inited = 1;
+
 	return UHOS_BLE_SUCCESS;
 }
 
@@ -201,6 +192,10 @@ uhos_ble_status_t uhos_ble_disable(void)
   	esp_err_t ret = 0;
 
 	UHOS_LOGI("disable BLE");
+    flag_ble_inited = 0;
+    uhos_ble_daemon_deinit();
+    uhos_ble_pal_gap_deinit();
+
     ret = esp_bluedroid_disable();
     if (ret) {
 		UHOS_LOGE("bluetooth disable failed: = %x", ret);
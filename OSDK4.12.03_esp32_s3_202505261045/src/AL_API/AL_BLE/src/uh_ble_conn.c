@@ -0,0 +1,601 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_conn.c
+ * @author agent (agent@local)
+ * @brief BLE连接表及每连接notify/indicate发送队列的功能实现
+ * @details 以conn_id为键管理连接；每个连接有独立的有界发送队列，
+ *          根据协议栈的CONF/CONGEST事件控制下发节奏，队列满时向调用者返回UHOS_BLE_BUSY
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：BLE连接表及每连接notify/indicate发送队列的功能实现
+ * </table>
+ */
+
+#define LOG_TAG "ble-n"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "esp_gatts_api.h"
+#include "esp_gatt_defs.h"
+#include "esp_bt_defs.h"
+
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_osal.h"
+#include "uh_log.h"
+
+#include "uh_ble.h"
+#include "uh_ble_conn.h"
+#include "uh_ble_conn_policy.h"
+#include "uh_ble_bench.h"
+
+/**************************************************************************************************/
+/*                                          外部引用声明                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+// 每个连接的发送队列深度
+#ifndef CONFIG_UHOS_BLE_CONN_TX_QUEUE_NUM
+#define CONFIG_UHOS_BLE_CONN_TX_QUEUE_NUM   16
+#endif
+
+// 每个连接同时交给协议栈、尚未收到CONF事件的notify包数
+#ifndef CONFIG_UHOS_BLE_CONN_TX_CREDITS
+#define CONFIG_UHOS_BLE_CONN_TX_CREDITS     4
+#endif
+
+#define UHOS_BLE_CONN_DEFAULT_MTU           23
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      待发送的notify/indicate数据
+ */
+typedef struct uhos_ble_pal_conn_tx_item
+{
+    uhos_u16  handle;                                           //<! 特性值句柄
+    uhos_u16  len;                                              //<! 数据长度
+    uhos_bool need_confirm;                                     //<! 是否为indicate
+    uhos_u32  enq_time;                                         //<! 入队时间
+    uhos_u8  *data;                                             //<! 数据
+} uhos_ble_pal_conn_tx_item_t;
+
+/**
+ * @struct      连接表项
+ */
+typedef struct uhos_ble_pal_conn
+{
+    uhos_u8                     used;                           //<! 表项是否有效
+    uhos_u8                     congested;                      //<! 协议栈是否拥塞
+    uhos_u8                     ind_pending;                    //<! 是否有未确认的indicate
+    uhos_u8                     inflight;                       //<! 已下发未完成的包数
+    uhos_u16                    conn_id;                        //<! 连接ID
+    uhos_u16                    gatt_if;                        //<! GATT接口
+    uhos_u16                    mtu;                            //<! MTU
+    uhos_u16                    interval;                       //<! 连接间隔（单位1.25ms），未知时为0
+    uhos_u16                    latency;                        //<! 从设备时延
+    uhos_ble_gap_role_t         role;                           //<! 本端角色
+    uhos_ble_addr_t             bda;                            //<! 对端地址（协议栈字节序）
+    uhos_u32                    connect_time;                   //<! 连接建立时间
+    uhos_u16                    head;                           //<! 发送队列头
+    uhos_u16                    count;                          //<! 发送队列长度
+    uhos_ble_pal_conn_tx_item_t tx_queue[CONFIG_UHOS_BLE_CONN_TX_QUEUE_NUM];    //<! 发送队列
+    uhos_ble_conn_stats_t       stats;                          //<! 统计信息
+} uhos_ble_pal_conn_t;
+
+/**
+ * @struct      连接管理控制块
+ */
+typedef struct uhos_ble_pal_conn_ctl
+{
+    uhos_mutex_t        mutex;                                  //<! 连接表互斥锁
+    uhos_ble_pal_conn_t conn[CONFIG_UHOS_BLE_MAX_CONN];         //<! 连接表
+} uhos_ble_pal_conn_ctl_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_ble_pal_conn_ctl_t g_uhos_ble_pal_conn_ctl = {0};   //<! 连接管理控制块
+
+/**************************************************************************************************/
+/*                                          内部函数原型                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static void uhos_ble_pal_conn_lock(void)
+{
+    uhos_mutex_wait(g_uhos_ble_pal_conn_ctl.mutex, UHOS_MUTEX_WAIT_FOREVER);
+}
+
+static void uhos_ble_pal_conn_unlock(void)
+{
+    uhos_mutex_release(g_uhos_ble_pal_conn_ctl.mutex);
+}
+
+/**
+ * @brief       根据conn_id查找连接（需持锁调用）
+ * @param[in]   conn_id 连接ID
+ * @return      连接表项，未找到返回UHOS_NULL
+ */
+static uhos_ble_pal_conn_t *uhos_ble_pal_conn_find(uhos_u16 conn_id)
+{
+    uhos_u8 i = 0;
+
+    for (i = 0; i < CONFIG_UHOS_BLE_MAX_CONN; i++)
+    {
+        if (g_uhos_ble_pal_conn_ctl.conn[i].used && (g_uhos_ble_pal_conn_ctl.conn[i].conn_id == conn_id))
+        {
+            return &g_uhos_ble_pal_conn_ctl.conn[i];
+        }
+    }
+
+    return UHOS_NULL;
+}
+
+/**
+ * @brief       根据对端地址查找连接（需持锁调用）
+ * @param[in]   bda 对端地址（协议栈字节序）
+ * @return      连接表项，未找到返回UHOS_NULL
+ */
+static uhos_ble_pal_conn_t *uhos_ble_pal_conn_find_by_addr(const uhos_u8 *bda)
+{
+    uhos_u8 i = 0;
+
+    for (i = 0; i < CONFIG_UHOS_BLE_MAX_CONN; i++)
+    {
+        if (g_uhos_ble_pal_conn_ctl.conn[i].used &&
+            (0 == uhos_libc_memcmp(g_uhos_ble_pal_conn_ctl.conn[i].bda, bda, sizeof(uhos_ble_addr_t))))
+        {
+            return &g_uhos_ble_pal_conn_ctl.conn[i];
+        }
+    }
+
+    return UHOS_NULL;
+}
+
+/**
+ * @brief       清空连接的发送队列（需持锁调用）
+ */
+static void uhos_ble_pal_conn_flush(uhos_ble_pal_conn_t *conn)
+{
+    uhos_ble_pal_conn_tx_item_t *item = UHOS_NULL;
+
+    while (conn->count)
+    {
+        item = &conn->tx_queue[conn->head];
+        uhos_libc_free(item->data);
+        item->data = UHOS_NULL;
+
+        conn->head = (conn->head + 1) % CONFIG_UHOS_BLE_CONN_TX_QUEUE_NUM;
+        conn->count--;
+    }
+
+    conn->head = 0;
+}
+
+/**
+ * @brief       在协议栈允许的范围内下发发送队列中的数据（需持锁调用）
+ * @note        notify最多同时下发CONFIG_UHOS_BLE_CONN_TX_CREDITS包；
+ *              indicate需要对端确认，同一时刻只下发一包
+ */
+static void uhos_ble_pal_conn_pump(uhos_ble_pal_conn_t *conn)
+{
+    uhos_ble_pal_conn_tx_item_t *item = UHOS_NULL;
+    esp_err_t                    ret  = ESP_OK;
+
+    while (conn->count && !conn->congested && !conn->ind_pending &&
+           (conn->inflight < CONFIG_UHOS_BLE_CONN_TX_CREDITS))
+    {
+        item = &conn->tx_queue[conn->head];
+
+        if (item->need_confirm && conn->inflight)
+        {
+            // 等待之前的notify完成后再发送indicate，保持顺序
+            break;
+        }
+
+        ret = esp_ble_gatts_send_indicate(conn->gatt_if, conn->conn_id, item->handle,
+                                          item->len, item->data, item->need_confirm);
+        if (ESP_OK != ret)
+        {
+            // 协议栈暂时无法接收，保留数据等待下一次CONF/CONGEST事件
+            UHOS_LOGW("conn %d send fail, 0x%x", conn->conn_id, ret);
+            break;
+        }
+
+        conn->inflight++;
+        conn->ind_pending = item->need_confirm ? 1 : 0;
+        conn->stats.tx_bytes += item->len;
+        conn->stats.tx_packets++;
+        conn->stats.tx_wait_ms += uhos_current_time_get() - item->enq_time;
+
+        // 协议栈已拷贝数据
+        uhos_libc_free(item->data);
+        item->data = UHOS_NULL;
+
+        conn->head = (conn->head + 1) % CONFIG_UHOS_BLE_CONN_TX_QUEUE_NUM;
+        conn->count--;
+    }
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       连接管理初始化
+ */
+void uhos_ble_pal_conn_init(void)
+{
+    uhos_u8 i = 0;
+
+    if (UHOS_NULL == g_uhos_ble_pal_conn_ctl.mutex)
+    {
+        if (UHOS_SUCCESS != uhos_mutex_create(&g_uhos_ble_pal_conn_ctl.mutex))
+        {
+            UHOS_LOGE("create mutex err");
+            return;
+        }
+    }
+
+    uhos_ble_pal_conn_lock();
+    for (i = 0; i < CONFIG_UHOS_BLE_MAX_CONN; i++)
+    {
+        uhos_ble_pal_conn_flush(&g_uhos_ble_pal_conn_ctl.conn[i]);
+        uhos_libc_memset(&g_uhos_ble_pal_conn_ctl.conn[i], 0, sizeof(uhos_ble_pal_conn_t));
+    }
+    uhos_ble_pal_conn_unlock();
+
+    uhos_ble_pal_conn_policy_init();
+}
+
+/**
+ * @brief       记录新建立的连接
+ */
+uhos_ble_status_t uhos_ble_pal_conn_add(uhos_u16 conn_id, uhos_u16 gatt_if, const uhos_u8 *bda, uhos_ble_gap_role_t role)
+{
+    uhos_ble_pal_conn_t *conn = UHOS_NULL;
+    uhos_u8              i    = 0;
+
+    uhos_ble_pal_conn_lock();
+
+    conn = uhos_ble_pal_conn_find(conn_id);
+    for (i = 0; (UHOS_NULL == conn) && (i < CONFIG_UHOS_BLE_MAX_CONN); i++)
+    {
+        if (!g_uhos_ble_pal_conn_ctl.conn[i].used)
+        {
+            conn = &g_uhos_ble_pal_conn_ctl.conn[i];
+        }
+    }
+
+    if (UHOS_NULL == conn)
+    {
+        uhos_ble_pal_conn_unlock();
+        UHOS_LOGE("conn table full, conn %d", conn_id);
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_pal_conn_flush(conn);
+    uhos_libc_memset(conn, 0, sizeof(uhos_ble_pal_conn_t));
+
+    conn->used         = 1;
+    conn->conn_id      = conn_id;
+    conn->gatt_if      = gatt_if;
+    conn->role         = role;
+    conn->mtu          = UHOS_BLE_CONN_DEFAULT_MTU;
+    conn->connect_time = uhos_current_time_get();
+    uhos_libc_memcpy(conn->bda, bda, sizeof(uhos_ble_addr_t));
+
+    uhos_ble_pal_conn_unlock();
+
+    uhos_ble_pal_conn_policy_add(conn_id, bda);
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       删除连接，并丢弃其发送队列中的数据
+ */
+void uhos_ble_pal_conn_remove(uhos_u16 conn_id)
+{
+    uhos_ble_pal_conn_t *conn = UHOS_NULL;
+
+    uhos_ble_pal_conn_lock();
+
+    conn = uhos_ble_pal_conn_find(conn_id);
+    if (conn)
+    {
+        if (conn->count)
+        {
+            UHOS_LOGW("conn %d closed, drop %d queued", conn_id, conn->count);
+        }
+
+        uhos_ble_pal_conn_flush(conn);
+        conn->used = 0;
+    }
+
+    uhos_ble_pal_conn_unlock();
+
+    uhos_ble_pal_conn_policy_remove(conn_id);
+}
+
+/**
+ * @brief       获取连接的对端地址
+ */
+uhos_ble_status_t uhos_ble_pal_conn_addr_get(uhos_u16 conn_id, uhos_ble_addr_t bda)
+{
+    uhos_ble_pal_conn_t *conn = UHOS_NULL;
+
+    uhos_ble_pal_conn_lock();
+
+    conn = uhos_ble_pal_conn_find(conn_id);
+    if (conn)
+    {
+        uhos_libc_memcpy(bda, conn->bda, sizeof(uhos_ble_addr_t));
+    }
+
+    uhos_ble_pal_conn_unlock();
+
+    return conn ? UHOS_BLE_SUCCESS : UHOS_BLE_ERROR;
+}
+
+/**
+ * @brief       更新连接的MTU
+ */
+void uhos_ble_pal_conn_mtu_set(uhos_u16 conn_id, uhos_u16 mtu)
+{
+    uhos_ble_pal_conn_t *conn = UHOS_NULL;
+
+    uhos_ble_pal_conn_lock();
+
+    conn = uhos_ble_pal_conn_find(conn_id);
+    if (conn)
+    {
+        conn->mtu = mtu;
+    }
+
+    uhos_ble_pal_conn_unlock();
+}
+
+/**
+ * @brief       获取连接的MTU
+ */
+uhos_u16 uhos_ble_pal_conn_mtu_get(uhos_u16 conn_id)
+{
+    uhos_ble_pal_conn_t *conn = UHOS_NULL;
+    uhos_u16             mtu  = 0;
+
+    uhos_ble_pal_conn_lock();
+
+    conn = uhos_ble_pal_conn_find(conn_id);
+    if (conn)
+    {
+        mtu = conn->mtu;
+    }
+
+    uhos_ble_pal_conn_unlock();
+
+    return mtu;
+}
+
+/**
+ * @brief       更新连接的连接间隔与从设备时延
+ */
+void uhos_ble_pal_conn_params_update(const uhos_u8 *bda, uhos_u16 interval, uhos_u16 latency)
+{
+    uhos_ble_pal_conn_t *conn = UHOS_NULL;
+
+    uhos_ble_pal_conn_lock();
+
+    conn = uhos_ble_pal_conn_find_by_addr(bda);
+    if (conn)
+    {
+        conn->interval = interval;
+        conn->latency  = latency;
+    }
+
+    uhos_ble_pal_conn_unlock();
+}
+
+/**
+ * @brief       获取当前所有连接的conn_id
+ */
+uhos_u8 uhos_ble_pal_conn_list(uhos_u16 *conn_ids, uhos_u8 max)
+{
+    uhos_u8 i   = 0;
+    uhos_u8 num = 0;
+
+    uhos_ble_pal_conn_lock();
+
+    for (i = 0; (i < CONFIG_UHOS_BLE_MAX_CONN) && (num < max); i++)
+    {
+        if (g_uhos_ble_pal_conn_ctl.conn[i].used)
+        {
+            conn_ids[num++] = g_uhos_ble_pal_conn_ctl.conn[i].conn_id;
+        }
+    }
+
+    uhos_ble_pal_conn_unlock();
+
+    return num;
+}
+
+/**
+ * @brief       协议栈拥塞状态变化
+ */
+void uhos_ble_pal_conn_congest(uhos_u16 conn_id, uhos_bool congested)
+{
+    uhos_ble_pal_conn_t *conn = UHOS_NULL;
+
+    uhos_ble_pal_conn_lock();
+
+    conn = uhos_ble_pal_conn_find(conn_id);
+    if (conn)
+    {
+        conn->congested = congested ? 1 : 0;
+
+        if (congested)
+        {
+            conn->stats.congested++;
+        }
+        else
+        {
+            uhos_ble_pal_conn_pump(conn);
+        }
+    }
+
+    uhos_ble_pal_conn_unlock();
+}
+
+/**
+ * @brief       一包notify/indicate已处理完成，继续发送
+ */
+void uhos_ble_pal_conn_tx_done(uhos_u16 conn_id)
+{
+    uhos_ble_pal_conn_t *conn = UHOS_NULL;
+
+    uhos_ble_pal_conn_lock();
+
+    conn = uhos_ble_pal_conn_find(conn_id);
+    if (conn)
+    {
+        if (conn->inflight)
+        {
+            conn->inflight--;
+        }
+
+        if (0 == conn->inflight)
+        {
+            conn->ind_pending = 0;
+        }
+
+        uhos_ble_pal_conn_pump(conn);
+    }
+
+    uhos_ble_pal_conn_unlock();
+}
+
+/**
+ * @brief       统计收到的写入数据
+ */
+void uhos_ble_pal_conn_rx(uhos_u16 conn_id, uhos_u16 len)
+{
+    uhos_ble_pal_conn_t *conn = UHOS_NULL;
+
+    uhos_ble_pal_conn_lock();
+
+    conn = uhos_ble_pal_conn_find(conn_id);
+    if (conn)
+    {
+        conn->stats.rx_bytes += len;
+        conn->stats.rx_packets++;
+    }
+
+    uhos_ble_pal_conn_unlock();
+}
+
+/**
+ * @brief       将notify/indicate数据放入连接的发送队列
+ */
+uhos_ble_status_t uhos_ble_pal_conn_tx(uhos_u16 conn_id, uhos_u16 handle, uhos_bool need_confirm, const uhos_u8 *data, uhos_u16 len)
+{
+    uhos_ble_pal_conn_t         *conn = UHOS_NULL;
+    uhos_ble_pal_conn_tx_item_t *item = UHOS_NULL;
+    uhos_u8                     *buf  = UHOS_NULL;
+
+    if ((UHOS_NULL == data) || (0 == len))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_pal_conn_lock();
+
+    conn = uhos_ble_pal_conn_find(conn_id);
+    if (UHOS_NULL == conn)
+    {
+        uhos_ble_pal_conn_unlock();
+        UHOS_LOGW("conn %d not found", conn_id);
+        return UHOS_BLE_ERROR;
+    }
+
+    if (len > conn->mtu - 3)
+    {
+        uhos_ble_pal_conn_unlock();
+        UHOS_LOGW("conn %d len %d exceeds mtu %d", conn_id, len, conn->mtu);
+        return UHOS_BLE_ERROR;
+    }
+
+    if (conn->count >= CONFIG_UHOS_BLE_CONN_TX_QUEUE_NUM)
+    {
+        conn->stats.tx_busy++;
+        uhos_ble_pal_conn_unlock();
+        return UHOS_BLE_BUSY;
+    }
+
+    buf = uhos_libc_malloc(len);
+    if (UHOS_NULL == buf)
+    {
+        uhos_ble_pal_conn_unlock();
+        return UHOS_BLE_BUSY;
+    }
+
+    uhos_libc_memcpy(buf, data, len);
+    uhos_ble_pal_bench_alloc();
+
+    item               = &conn->tx_queue[(conn->head + conn->count) % CONFIG_UHOS_BLE_CONN_TX_QUEUE_NUM];
+    item->handle       = handle;
+    item->len          = len;
+    item->need_confirm = need_confirm;
+    item->enq_time     = uhos_current_time_get();
+    item->data         = buf;
+    conn->count++;
+
+    uhos_ble_pal_conn_pump(conn);
+
+    uhos_ble_pal_conn_unlock();
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       获取指定连接的收发统计信息
+ * @param[in]   conn_handle 连接句柄
+ * @param[out]  stats       统计信息
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_gatts_conn_stats_get(uhos_u16 conn_handle, uhos_ble_conn_stats_t *stats)
+{
+    uhos_ble_pal_conn_t *conn = UHOS_NULL;
+
+    if (UHOS_NULL == stats)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_pal_conn_lock();
+
+    conn = uhos_ble_pal_conn_find(conn_handle);
+    if (conn)
+    {
+        uhos_libc_memcpy(stats, &conn->stats, sizeof(uhos_ble_conn_stats_t));
+        stats->duration_ms = uhos_current_time_get() - conn->connect_time;
+        stats->queued      = conn->count;
+        stats->mtu         = conn->mtu;
+        stats->interval    = conn->interval;
+        stats->latency     = conn->latency;
+    }
+
+    uhos_ble_pal_conn_unlock();
+
+    return conn ? UHOS_BLE_SUCCESS : UHOS_BLE_ERROR;
+}
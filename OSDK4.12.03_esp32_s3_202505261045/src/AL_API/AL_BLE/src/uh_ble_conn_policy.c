@@ -0,0 +1,700 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_conn_policy.c
+ * @author agent (agent@local)
+ * @brief BLE连接参数策略的功能实现
+ * @details 每个统计窗口由ble_daemon任务对各连接采样吞吐率、发送排队时延与队列积压，记入每连接的环形历史；
+ *          吞吐率或积压超过突发门限（或用户提示突发）时立即请求短连接间隔并开启数据长度扩展，
+ *          持续idle_hold_ms低于空闲门限后才请求长连接间隔与从设备时延，两个门限之间保持当前档位。
+ *          同一时刻每个连接最多一个未完成的参数更新请求，被拒绝或超时后按次数退避重试。
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：BLE连接参数策略的功能实现
+ * </table>
+ */
+
+#define LOG_TAG "ble-p"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "esp_gap_ble_api.h"
+#include "esp_bt_defs.h"
+
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_osal.h"
+#include "uh_log.h"
+
+#include "uh_ble.h"
+#include "uh_ble_conn.h"
+#include "uh_ble_conn_policy.h"
+
+/**************************************************************************************************/
+/*                                          外部引用声明                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+// 参数更新请求发出后等待完成事件的最长时间，超时视为被拒绝
+#ifndef CONFIG_UHOS_BLE_CONN_POLICY_REQ_TIMEOUT_MS
+#define CONFIG_UHOS_BLE_CONN_POLICY_REQ_TIMEOUT_MS  10000
+#endif
+
+// 请求被拒绝后的退避时间，连续被拒绝时依次加倍，最多加倍UHOS_BLE_CONN_POLICY_RETRY_SHIFT_MAX次
+#ifndef CONFIG_UHOS_BLE_CONN_POLICY_RETRY_MS
+#define CONFIG_UHOS_BLE_CONN_POLICY_RETRY_MS        5000
+#endif
+
+#define UHOS_BLE_CONN_POLICY_RETRY_SHIFT_MAX        3
+
+#define UHOS_BLE_CONN_POLICY_TIME_AFTER(a, b)       ((uhos_s32)((a) - (b)) >= 0)    //<! 时刻a不早于时刻b
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      单个连接的策略状态
+ */
+typedef struct uhos_ble_pal_conn_policy_conn
+{
+    uhos_u8                       used;                         //<! 表项是否有效
+    uhos_u8                       pending;                      //<! 有未完成的参数更新请求
+    uhos_u8                       dle_done;                     //<! 已请求数据长度扩展
+    uhos_u8                       boost;                        //<! 用户提示突发传输
+    uhos_u8                       low;                          //<! 吞吐率低于空闲门限
+    uhos_u8                       fails;                        //<! 连续被拒绝的次数
+    uhos_u16                      conn_id;                      //<! 连接ID
+    uhos_ble_addr_t               bda;                          //<! 对端地址（协议栈字节序）
+    uhos_ble_conn_profile_t       profile;                      //<! 当前生效的档位
+    uhos_ble_conn_profile_t       target;                       //<! 请求中的档位
+    uhos_u32                      req_time;                     //<! 请求发出的时刻
+    uhos_u32                      retry_time;                   //<! 退避结束的时刻
+    uhos_u32                      low_since;                    //<! 吞吐率开始低于空闲门限的时刻
+    uhos_u32                      boost_until;                  //<! 突发提示结束的时刻
+    uhos_u32                      last_time;                    //<! 上一窗口结束的时刻
+    uhos_u32                      last_bytes;                   //<! 上一窗口结束时的累计收发字节数
+    uhos_u32                      last_packets;                 //<! 上一窗口结束时的累计发送包数
+    uhos_u32                      last_wait;                    //<! 上一窗口结束时的累计排队时间
+    uhos_u8                       hist_head;                    //<! 最旧一个窗口的位置
+    uhos_u8                       hist_count;                   //<! 窗口个数
+    uhos_ble_conn_policy_sample_t hist[CONFIG_UHOS_BLE_CONN_POLICY_HISTORY_NUM];   //<! 统计历史
+} uhos_ble_pal_conn_policy_conn_t;
+
+/**
+ * @struct      连接参数策略控制块
+ */
+typedef struct uhos_ble_pal_conn_policy_ctl
+{
+    uhos_mutex_t                    mutex;                      //<! 互斥锁
+    uhos_bool                       kick;                       //<! 下一次tick立即评估
+    uhos_u32                        last_tick;                  //<! 上一次评估的时刻
+    uhos_ble_conn_policy_t          policy;                     //<! 策略
+    uhos_ble_pal_conn_policy_conn_t conn[CONFIG_UHOS_BLE_MAX_CONN];
+} uhos_ble_pal_conn_policy_ctl_t;
+
+/**
+ * @struct      一次待下发的参数更新请求
+ */
+typedef struct uhos_ble_pal_conn_policy_req
+{
+    uhos_u16                     conn_id;
+    uhos_u16                     dle_len;                       //<! 0表示不请求数据长度扩展
+    esp_ble_conn_update_params_t params;
+} uhos_ble_pal_conn_policy_req_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_ble_pal_conn_policy_ctl_t g_uhos_ble_pal_conn_policy_ctl = {
+    .policy = {
+        .enable       = UHOS_TRUE,
+        .burst_bps    = 2000,
+        .burst_queued = 4,
+        .idle_bps     = 200,
+        .idle_hold_ms = 5000,
+        .dle_len      = 251,
+        .burst        = {12, 24, 0, 400},                       // 15~30ms，兼顾iOS对连接参数的限制
+        .idle         = {80, 160, 4, 600},                      // 100~200ms，从设备时延4
+    },
+};
+
+/**************************************************************************************************/
+/*                                          内部函数原型                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static void uhos_ble_pal_conn_policy_lock(void)
+{
+    uhos_mutex_wait(g_uhos_ble_pal_conn_policy_ctl.mutex, UHOS_MUTEX_WAIT_FOREVER);
+}
+
+static void uhos_ble_pal_conn_policy_unlock(void)
+{
+    uhos_mutex_release(g_uhos_ble_pal_conn_policy_ctl.mutex);
+}
+
+/**
+ * @brief       根据conn_id查找策略状态（需持锁调用）
+ */
+static uhos_ble_pal_conn_policy_conn_t *uhos_ble_pal_conn_policy_find(uhos_u16 conn_id)
+{
+    uhos_u8 i = 0;
+
+    for (i = 0; i < CONFIG_UHOS_BLE_MAX_CONN; i++)
+    {
+        if (g_uhos_ble_pal_conn_policy_ctl.conn[i].used && (g_uhos_ble_pal_conn_policy_ctl.conn[i].conn_id == conn_id))
+        {
+            return &g_uhos_ble_pal_conn_policy_ctl.conn[i];
+        }
+    }
+
+    return UHOS_NULL;
+}
+
+/**
+ * @brief       校验一组连接参数（Core Spec Vol 6, Part B, 4.5.2）
+ */
+static uhos_bool uhos_ble_pal_conn_policy_param_valid(const uhos_ble_gap_conn_param_t *param)
+{
+    if ((param->min_conn_interval < 0x0006) || (param->max_conn_interval > 0x0C80) ||
+        (param->min_conn_interval > param->max_conn_interval) || (param->slave_latency > 0x01F3) ||
+        (param->conn_sup_timeout < 0x000A) || (param->conn_sup_timeout > 0x0C80))
+    {
+        return UHOS_FALSE;
+    }
+
+    // 监控超时须大于(1 + latency) * interval_max * 2，单位换算：timeout*10ms，interval*1.25ms
+    return ((uhos_u32)param->conn_sup_timeout * 4 > (1 + (uhos_u32)param->slave_latency) * param->max_conn_interval);
+}
+
+/**
+ * @brief       重新开始一个连接的统计（需持锁调用）
+ */
+static void uhos_ble_pal_conn_policy_reset(uhos_ble_pal_conn_policy_conn_t *pc, const uhos_ble_conn_stats_t *stats,
+                                           uhos_u32 now)
+{
+    pc->last_time    = now;
+    pc->last_bytes   = stats->tx_bytes + stats->rx_bytes;
+    pc->last_packets = stats->tx_packets;
+    pc->last_wait    = stats->tx_wait_ms;
+}
+
+/**
+ * @brief       记录一个统计窗口（需持锁调用）
+ * @return      窗口内的吞吐率（字节/秒）
+ */
+static uhos_u32 uhos_ble_pal_conn_policy_sample(uhos_ble_pal_conn_policy_conn_t *pc, const uhos_ble_conn_stats_t *stats,
+                                                uhos_u32 now)
+{
+    uhos_ble_conn_policy_sample_t *sample = UHOS_NULL;
+    uhos_u32 elapsed = now - pc->last_time;
+    uhos_u32 bytes   = stats->tx_bytes + stats->rx_bytes - pc->last_bytes;
+    uhos_u32 packets = stats->tx_packets - pc->last_packets;
+    uhos_u32 wait    = stats->tx_wait_ms - pc->last_wait;
+    uhos_u32 avg     = (0 != packets) ? (wait / packets) : 0;
+
+    if (pc->hist_count < CONFIG_UHOS_BLE_CONN_POLICY_HISTORY_NUM)
+    {
+        sample = &pc->hist[(pc->hist_head + pc->hist_count) % CONFIG_UHOS_BLE_CONN_POLICY_HISTORY_NUM];
+        pc->hist_count++;
+    }
+    else
+    {
+        sample        = &pc->hist[pc->hist_head];
+        pc->hist_head = (pc->hist_head + 1) % CONFIG_UHOS_BLE_CONN_POLICY_HISTORY_NUM;
+    }
+
+    sample->time_ms       = now;
+    sample->throughput    = (0 != elapsed) ? (uhos_u32)((uhos_u64)bytes * 1000 / elapsed) : 0;
+    sample->tx_latency_ms = (avg > 0xFFFF) ? 0xFFFF : (uhos_u16)avg;
+    sample->queued        = stats->queued;
+    sample->interval      = stats->interval;
+    sample->latency       = stats->latency;
+    sample->profile       = pc->profile;
+
+    uhos_ble_pal_conn_policy_reset(pc, stats, now);
+
+    return sample->throughput;
+}
+
+/**
+ * @brief       根据本窗口的采样决定连接应处的档位（需持锁调用）
+ */
+static uhos_ble_conn_profile_t uhos_ble_pal_conn_policy_decide(uhos_ble_pal_conn_policy_conn_t *pc, uhos_u32 throughput,
+                                                              uhos_u16 queued, uhos_u32 now)
+{
+    const uhos_ble_conn_policy_t *policy = &g_uhos_ble_pal_conn_policy_ctl.policy;
+
+    if (pc->boost && !UHOS_BLE_CONN_POLICY_TIME_AFTER(now, pc->boost_until))
+    {
+        pc->low = 0;
+        return UHOS_BLE_CONN_PROFILE_BURST;
+    }
+    pc->boost = 0;
+
+    if ((throughput >= policy->burst_bps) || (queued >= policy->burst_queued))
+    {
+        pc->low = 0;
+        return UHOS_BLE_CONN_PROFILE_BURST;
+    }
+
+    if (throughput >= policy->idle_bps)
+    {
+        // 两个门限之间：保持当前档位
+        pc->low = 0;
+        return pc->profile;
+    }
+
+    if (!pc->low)
+    {
+        pc->low       = 1;
+        pc->low_since = now;
+    }
+
+    return ((now - pc->low_since) >= policy->idle_hold_ms) ? UHOS_BLE_CONN_PROFILE_IDLE : pc->profile;
+}
+
+/**
+ * @brief       记录请求失败，进入退避（需持锁调用）
+ */
+static void uhos_ble_pal_conn_policy_backoff(uhos_ble_pal_conn_policy_conn_t *pc, uhos_u32 now)
+{
+    uhos_u8 shift = (pc->fails < UHOS_BLE_CONN_POLICY_RETRY_SHIFT_MAX) ? pc->fails : UHOS_BLE_CONN_POLICY_RETRY_SHIFT_MAX;
+
+    if (pc->fails < 0xFF)
+    {
+        pc->fails++;
+    }
+
+    pc->pending    = 0;
+    pc->retry_time = now + ((uhos_u32)CONFIG_UHOS_BLE_CONN_POLICY_RETRY_MS << shift);
+}
+
+/**
+ * @brief       评估一个连接，需要调整时填写请求并标记为等待完成（需持锁调用）
+ * @return      UHOS_TRUE-需要下发req
+ */
+static uhos_bool uhos_ble_pal_conn_policy_eval(uhos_ble_pal_conn_policy_conn_t *pc, const uhos_ble_conn_stats_t *stats,
+                                               uhos_u32 now, uhos_ble_pal_conn_policy_req_t *req)
+{
+    const uhos_ble_conn_policy_t *policy = &g_uhos_ble_pal_conn_policy_ctl.policy;
+    const uhos_ble_gap_conn_param_t *param = UHOS_NULL;
+    uhos_ble_conn_profile_t want = UHOS_BLE_CONN_PROFILE_NONE;
+    uhos_u32 throughput = uhos_ble_pal_conn_policy_sample(pc, stats, now);
+
+    if (!policy->enable || (UHOS_BLE_CONN_PROFILE_MANUAL == pc->profile))
+    {
+        return UHOS_FALSE;
+    }
+
+    if (pc->pending)
+    {
+        if ((now - pc->req_time) >= CONFIG_UHOS_BLE_CONN_POLICY_REQ_TIMEOUT_MS)
+        {
+            UHOS_LOGW("conn %d param update timeout", pc->conn_id);
+            uhos_ble_pal_conn_policy_backoff(pc, now);
+        }
+        return UHOS_FALSE;
+    }
+
+    want = uhos_ble_pal_conn_policy_decide(pc, throughput, stats->queued, now);
+    if ((want == pc->profile) || (UHOS_BLE_CONN_PROFILE_NONE == want) ||
+        ((0 != pc->fails) && !UHOS_BLE_CONN_POLICY_TIME_AFTER(now, pc->retry_time)))
+    {
+        return UHOS_FALSE;
+    }
+
+    param = (UHOS_BLE_CONN_PROFILE_BURST == want) ? &policy->burst : &policy->idle;
+
+    uhos_libc_memset(req, 0, sizeof(uhos_ble_pal_conn_policy_req_t));
+    uhos_libc_memcpy(req->params.bda, pc->bda, sizeof(esp_bd_addr_t));
+    req->conn_id        = pc->conn_id;
+    req->params.min_int = param->min_conn_interval;
+    req->params.max_int = param->max_conn_interval;
+    req->params.latency = param->slave_latency;
+    req->params.timeout = param->conn_sup_timeout;
+    if ((UHOS_BLE_CONN_PROFILE_BURST == want) && (0 != policy->dle_len) && !pc->dle_done)
+    {
+        req->dle_len = policy->dle_len;
+        pc->dle_done = 1;
+    }
+
+    pc->pending  = 1;
+    pc->target   = want;
+    pc->req_time = now;
+
+    UHOS_LOGI("conn %d %d B/s queued %d -> profile %d", pc->conn_id, throughput, stats->queued, want);
+
+    return UHOS_TRUE;
+}
+
+/**
+ * @brief       下发参数更新请求（不持锁调用）
+ */
+static void uhos_ble_pal_conn_policy_issue(uhos_ble_pal_conn_policy_req_t *req)
+{
+    uhos_ble_pal_conn_policy_conn_t *pc = UHOS_NULL;
+    esp_err_t ret = ESP_OK;
+
+    if (0 != req->dle_len)
+    {
+        ret = esp_ble_gap_set_pkt_data_len(req->params.bda, req->dle_len);
+        if (ESP_OK != ret)
+        {
+            UHOS_LOGW("conn %d set pkt data len failed, 0x%x", req->conn_id, ret);
+        }
+    }
+
+    ret = esp_ble_gap_update_conn_params(&req->params);
+    if (ESP_OK == ret)
+    {
+        return;
+    }
+
+    UHOS_LOGW("conn %d update conn params failed, 0x%x", req->conn_id, ret);
+
+    uhos_ble_pal_conn_policy_lock();
+    pc = uhos_ble_pal_conn_policy_find(req->conn_id);
+    if (pc && pc->pending)
+    {
+        uhos_ble_pal_conn_policy_backoff(pc, uhos_current_time_get());
+    }
+    uhos_ble_pal_conn_policy_unlock();
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       连接参数策略初始化
+ */
+void uhos_ble_pal_conn_policy_init(void)
+{
+    if (UHOS_NULL == g_uhos_ble_pal_conn_policy_ctl.mutex)
+    {
+        if (UHOS_SUCCESS != uhos_mutex_create(&g_uhos_ble_pal_conn_policy_ctl.mutex))
+        {
+            UHOS_LOGE("create mutex err");
+            return;
+        }
+    }
+
+    uhos_ble_pal_conn_policy_lock();
+    uhos_libc_memset(g_uhos_ble_pal_conn_policy_ctl.conn, 0, sizeof(g_uhos_ble_pal_conn_policy_ctl.conn));
+    g_uhos_ble_pal_conn_policy_ctl.last_tick = uhos_current_time_get();
+    uhos_ble_pal_conn_policy_unlock();
+}
+
+/**
+ * @brief       新建立的连接纳入策略管理
+ */
+void uhos_ble_pal_conn_policy_add(uhos_u16 conn_id, const uhos_u8 *bda)
+{
+    uhos_ble_pal_conn_policy_conn_t *pc = UHOS_NULL;
+    uhos_ble_conn_stats_t stats = {0};
+    uhos_u8 i = 0;
+
+    if (UHOS_NULL == g_uhos_ble_pal_conn_policy_ctl.mutex)
+    {
+        return;
+    }
+
+    uhos_ble_gatts_conn_stats_get(conn_id, &stats);
+
+    uhos_ble_pal_conn_policy_lock();
+    pc = uhos_ble_pal_conn_policy_find(conn_id);
+    for (i = 0; (UHOS_NULL == pc) && (i < CONFIG_UHOS_BLE_MAX_CONN); i++)
+    {
+        if (!g_uhos_ble_pal_conn_policy_ctl.conn[i].used)
+        {
+            pc = &g_uhos_ble_pal_conn_policy_ctl.conn[i];
+        }
+    }
+
+    if (pc)
+    {
+        uhos_libc_memset(pc, 0, sizeof(uhos_ble_pal_conn_policy_conn_t));
+        pc->used    = 1;
+        pc->conn_id = conn_id;
+        uhos_libc_memcpy(pc->bda, bda, sizeof(uhos_ble_addr_t));
+        uhos_ble_pal_conn_policy_reset(pc, &stats, uhos_current_time_get());
+    }
+    uhos_ble_pal_conn_policy_unlock();
+}
+
+/**
+ * @brief       连接断开，丢弃其策略状态与统计历史
+ */
+void uhos_ble_pal_conn_policy_remove(uhos_u16 conn_id)
+{
+    uhos_ble_pal_conn_policy_conn_t *pc = UHOS_NULL;
+
+    if (UHOS_NULL == g_uhos_ble_pal_conn_policy_ctl.mutex)
+    {
+        return;
+    }
+
+    uhos_ble_pal_conn_policy_lock();
+    pc = uhos_ble_pal_conn_policy_find(conn_id);
+    if (pc)
+    {
+        pc->used = 0;
+    }
+    uhos_ble_pal_conn_policy_unlock();
+}
+
+/**
+ * @brief       用户指定了连接参数，策略不再调整该连接
+ */
+void uhos_ble_pal_conn_policy_pin(uhos_u16 conn_id)
+{
+    uhos_ble_pal_conn_policy_conn_t *pc = UHOS_NULL;
+
+    if (UHOS_NULL == g_uhos_ble_pal_conn_policy_ctl.mutex)
+    {
+        return;
+    }
+
+    uhos_ble_pal_conn_policy_lock();
+    pc = uhos_ble_pal_conn_policy_find(conn_id);
+    if (pc)
+    {
+        pc->profile = UHOS_BLE_CONN_PROFILE_MANUAL;
+        pc->pending = 0;
+    }
+    uhos_ble_pal_conn_policy_unlock();
+}
+
+/**
+ * @brief       连接参数更新完成
+ */
+void uhos_ble_pal_conn_policy_updated(const uhos_u8 *bda, uhos_bool success)
+{
+    uhos_ble_pal_conn_policy_conn_t *pc = UHOS_NULL;
+    uhos_u8 i = 0;
+
+    if (UHOS_NULL == g_uhos_ble_pal_conn_policy_ctl.mutex)
+    {
+        return;
+    }
+
+    uhos_ble_pal_conn_policy_lock();
+    for (i = 0; i < CONFIG_UHOS_BLE_MAX_CONN; i++)
+    {
+        pc = &g_uhos_ble_pal_conn_policy_ctl.conn[i];
+        if (!pc->used || (0 != uhos_libc_memcmp(pc->bda, bda, sizeof(uhos_ble_addr_t))))
+        {
+            continue;
+        }
+
+        if (UHOS_BLE_CONN_PROFILE_MANUAL == pc->profile)
+        {
+            break;
+        }
+
+        if (!pc->pending)
+        {
+            // 对端主动更新了参数，下一窗口重新评估
+            if (success)
+            {
+                pc->profile = UHOS_BLE_CONN_PROFILE_NONE;
+            }
+            break;
+        }
+
+        if (success)
+        {
+            pc->profile = pc->target;
+            pc->pending = 0;
+            pc->fails   = 0;
+        }
+        else
+        {
+            UHOS_LOGW("conn %d profile %d rejected", pc->conn_id, pc->target);
+            uhos_ble_pal_conn_policy_backoff(pc, uhos_current_time_get());
+        }
+        break;
+    }
+    uhos_ble_pal_conn_policy_unlock();
+}
+
+/**
+ * @brief       周期处理（仅ble_daemon任务调用）
+ */
+void uhos_ble_pal_conn_policy_tick(void)
+{
+    uhos_ble_pal_conn_policy_ctl_t *ctl = &g_uhos_ble_pal_conn_policy_ctl;
+    uhos_ble_pal_conn_policy_conn_t *pc = UHOS_NULL;
+    uhos_ble_pal_conn_policy_req_t req;
+    uhos_ble_conn_stats_t stats;
+    uhos_u16 conn_ids[CONFIG_UHOS_BLE_MAX_CONN];
+    uhos_u32 now = uhos_current_time_get();
+    uhos_bool issue = UHOS_FALSE;
+    uhos_u8 num = 0;
+    uhos_u8 i = 0;
+
+    if (UHOS_NULL == ctl->mutex)
+    {
+        return;
+    }
+
+    uhos_ble_pal_conn_policy_lock();
+    if (!ctl->kick && ((now - ctl->last_tick) < CONFIG_UHOS_BLE_CONN_POLICY_PERIOD_MS))
+    {
+        uhos_ble_pal_conn_policy_unlock();
+        return;
+    }
+    ctl->kick      = UHOS_FALSE;
+    ctl->last_tick = now;
+    uhos_ble_pal_conn_policy_unlock();
+
+    num = uhos_ble_pal_conn_list(conn_ids, CONFIG_UHOS_BLE_MAX_CONN);
+    for (i = 0; i < num; i++)
+    {
+        if (UHOS_BLE_SUCCESS != uhos_ble_gatts_conn_stats_get(conn_ids[i], &stats))
+        {
+            continue;
+        }
+
+        uhos_ble_pal_conn_policy_lock();
+        pc    = uhos_ble_pal_conn_policy_find(conn_ids[i]);
+        issue = pc ? uhos_ble_pal_conn_policy_eval(pc, &stats, now, &req) : UHOS_FALSE;
+        uhos_ble_pal_conn_policy_unlock();
+
+        if (issue)
+        {
+            uhos_ble_pal_conn_policy_issue(&req);
+        }
+    }
+}
+
+/**
+ * @brief       设置连接参数策略
+ */
+uhos_ble_status_t uhos_ble_gap_conn_policy_set(const uhos_ble_conn_policy_t *policy)
+{
+    uhos_u8 i = 0;
+
+    if ((UHOS_NULL == policy) || (policy->idle_bps >= policy->burst_bps) || (0 == policy->burst_queued) ||
+        ((0 != policy->dle_len) && ((policy->dle_len < 27) || (policy->dle_len > 251))) ||
+        !uhos_ble_pal_conn_policy_param_valid(&policy->burst) || !uhos_ble_pal_conn_policy_param_valid(&policy->idle))
+    {
+        UHOS_LOGE("invalid conn policy");
+        return UHOS_BLE_ERROR;
+    }
+
+    if (UHOS_NULL == g_uhos_ble_pal_conn_policy_ctl.mutex)
+    {
+        uhos_libc_memcpy(&g_uhos_ble_pal_conn_policy_ctl.policy, policy, sizeof(uhos_ble_conn_policy_t));
+        return UHOS_BLE_SUCCESS;
+    }
+
+    uhos_ble_pal_conn_policy_lock();
+    uhos_libc_memcpy(&g_uhos_ble_pal_conn_policy_ctl.policy, policy, sizeof(uhos_ble_conn_policy_t));
+
+    // 档位参数可能已改变，已建立的连接按新参数重新请求
+    for (i = 0; i < CONFIG_UHOS_BLE_MAX_CONN; i++)
+    {
+        if (g_uhos_ble_pal_conn_policy_ctl.conn[i].used &&
+            (UHOS_BLE_CONN_PROFILE_MANUAL != g_uhos_ble_pal_conn_policy_ctl.conn[i].profile))
+        {
+            g_uhos_ble_pal_conn_policy_ctl.conn[i].profile   = UHOS_BLE_CONN_PROFILE_NONE;
+            g_uhos_ble_pal_conn_policy_ctl.conn[i].low       = 0;
+            g_uhos_ble_pal_conn_policy_ctl.conn[i].fails     = 0;
+        }
+    }
+    g_uhos_ble_pal_conn_policy_ctl.kick = UHOS_TRUE;
+    uhos_ble_pal_conn_policy_unlock();
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       获取当前的连接参数策略
+ */
+uhos_ble_status_t uhos_ble_gap_conn_policy_get(uhos_ble_conn_policy_t *policy)
+{
+    if (UHOS_NULL == policy)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    if (g_uhos_ble_pal_conn_policy_ctl.mutex)
+    {
+        uhos_ble_pal_conn_policy_lock();
+    }
+    uhos_libc_memcpy(policy, &g_uhos_ble_pal_conn_policy_ctl.policy, sizeof(uhos_ble_conn_policy_t));
+    if (g_uhos_ble_pal_conn_policy_ctl.mutex)
+    {
+        uhos_ble_pal_conn_policy_unlock();
+    }
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       提示连接即将开始突发传输
+ */
+uhos_ble_status_t uhos_ble_gap_conn_policy_boost(uhos_u16 conn_handle, uhos_u32 duration_ms)
+{
+    uhos_ble_pal_conn_policy_conn_t *pc = UHOS_NULL;
+
+    if (UHOS_NULL == g_uhos_ble_pal_conn_policy_ctl.mutex)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_pal_conn_policy_lock();
+    pc = uhos_ble_pal_conn_policy_find(conn_handle);
+    if (pc)
+    {
+        pc->boost       = (0 != duration_ms) ? 1 : 0;
+        pc->boost_until = uhos_current_time_get() + duration_ms;
+        g_uhos_ble_pal_conn_policy_ctl.kick = UHOS_TRUE;
+    }
+    uhos_ble_pal_conn_policy_unlock();
+
+    return pc ? UHOS_BLE_SUCCESS : UHOS_BLE_ERROR;
+}
+
+/**
+ * @brief       获取连接最近若干个统计窗口的吞吐率与时延
+ */
+uhos_ble_status_t uhos_ble_gap_conn_policy_history_get(uhos_u16 conn_handle, uhos_ble_conn_policy_sample_t *samples,
+                                                       uhos_u8 *num)
+{
+    uhos_ble_pal_conn_policy_conn_t *pc = UHOS_NULL;
+    uhos_u8 skip = 0;
+    uhos_u8 i = 0;
+
+    if ((UHOS_NULL == samples) || (UHOS_NULL == num) || (UHOS_NULL == g_uhos_ble_pal_conn_policy_ctl.mutex))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_pal_conn_policy_lock();
+    pc = uhos_ble_pal_conn_policy_find(conn_handle);
+    if (pc)
+    {
+        // 容量不足时返回最新的*num个窗口
+        skip = (pc->hist_count > *num) ? (pc->hist_count - *num) : 0;
+        for (i = 0; i + skip < pc->hist_count; i++)
+        {
+            uhos_libc_memcpy(&samples[i], &pc->hist[(pc->hist_head + skip + i) % CONFIG_UHOS_BLE_CONN_POLICY_HISTORY_NUM],
+                             sizeof(uhos_ble_conn_policy_sample_t));
+        }
+        *num = i;
+    }
+    uhos_ble_pal_conn_policy_unlock();
+
+    return pc ? UHOS_BLE_SUCCESS : UHOS_BLE_ERROR;
+}
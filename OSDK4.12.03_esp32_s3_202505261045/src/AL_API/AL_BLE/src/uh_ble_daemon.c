@@ -17,13 +17,6 @@
 /**************************************************************************************************/
 /*                           #include (依次为标准头文件、非标准头文件)                            */
 /**************************************************************************************************/
-#include "arch.h"
-// #include "gap.h"
-#include "sonata_gap_api.h"
-#include "sonata_gatt_api.h"
-#include "sonata_utils_api.h"
-#include "app.h"
-
 #include "uh_types.h"
 #include "uh_libc.h"
 #include "uh_osal.h"
@@ -32,6 +25,10 @@
 #include "uh_ble.h"
 #include "uh_ble_common.h"
 #include "uh_ble_gap.h"
+#include "uh_ble_adv_pack.h"
+#include "uh_ble_conn_policy.h"
+#include "uh_ble_gatt_client.h"
+#include "uh_ble_evt.h"
 #include "uh_ble_daemon.h"
 
 /**************************************************************************************************/
@@ -42,7 +39,11 @@
 /*                                           内部宏定义                                           */
 /**************************************************************************************************/
 #define UHOS_BLE_DAEMON_TASK_NAME       "ble_daemon"
-#define UHOS_BLE_DAEMON_TASK_STACK_SIZE 2 * 1024
+// 守候线程栈大小：所有用户回调（连接、GATT读写、广播上报等）都在该线程中执行，
+// 默认由2KiB增至4KiB；应用回调中使用较多局部变量或调用深度较大时应相应调大
+#ifndef CONFIG_UHOS_BLE_DAEMON_TASK_STACK_SIZE
+#define CONFIG_UHOS_BLE_DAEMON_TASK_STACK_SIZE (4 * 1024)
+#endif
 #define UHOS_BLE_DAEMON_TASK_PRIORITY   5
 
 #define UHOS_BLE_EVENT_SEM_TIMEOUT 50
@@ -69,10 +70,32 @@ static uhos_thread_t g_uhos_ble_pal_daemon_tid = UHOS_NULL; //<! 守护任务的
  */
 static void *uhos_ble_daemon_task(void *p_param)
 {
+    uhos_bool more    = UHOS_FALSE;
+    uhos_u32  timeout = UHOS_BLE_EVENT_SEM_TIMEOUT;
+
     while (1)
     {
+        // 上一轮未投递完时不等待
+        if (!more)
+        {
+            uhos_ble_pal_evt_wait(timeout);
+        }
+
+        // 连接、GATT数据类用户回调事件
+        more = uhos_ble_pal_evt_dispatch();
+
         // 广播数据上报
-        uhos_ble_pal_gap_adv_rpt_handle(UHOS_BLE_EVENT_SEM_TIMEOUT);
+        more = uhos_ble_pal_gap_adv_rpt_handle() || more;
+
+        // 广播透传打包，等待时间不超过下一帧的发送时刻
+        timeout = uhos_ble_pal_adv_pack_tick();
+        timeout = (timeout < UHOS_BLE_EVENT_SEM_TIMEOUT) ? timeout : UHOS_BLE_EVENT_SEM_TIMEOUT;
+
+        // 连接参数策略
+        uhos_ble_pal_conn_policy_tick();
+
+        // GATT client操作超时
+        uhos_ble_pal_gattc_op_tick();
     }
 
     return UHOS_NULL;
@@ -95,8 +118,11 @@ void uhos_ble_daemon_init(void)
         return;
     }
 
+    // 此后的用户回调事件交给守护任务投递
+    uhos_ble_pal_evt_init();
+
     // 创建守护任务
-    attr.stack_size = UHOS_BLE_DAEMON_TASK_STACK_SIZE;
+    attr.stack_size = CONFIG_UHOS_BLE_DAEMON_TASK_STACK_SIZE;
     attr.priority = UHOS_BLE_DAEMON_TASK_PRIORITY;
     attr.name = UHOS_BLE_DAEMON_TASK_NAME;
 
@@ -107,6 +133,7 @@ void uhos_ble_daemon_init(void)
     else
     {
         UHOS_LOGE("ble daemon init failed");
+        uhos_ble_pal_evt_deinit();
     }
 
     return;
@@ -117,6 +144,9 @@ void uhos_ble_daemon_init(void)
  */
 void uhos_ble_daemon_deinit(void)
 {
+    // 丢弃未投递的事件，之后产生的事件也被丢弃并计数
+    uhos_ble_pal_evt_deinit();
+
     // 删除任务
     if (g_uhos_ble_pal_daemon_tid)
     {
@@ -0,0 +1,665 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_evt.c
+ * @author agent (agent@local)
+ * @brief BLE用户回调事件队列的功能实现
+ * @details 协议栈回调中产生的用户事件连同数据拷贝放入按优先级划分的队列，由ble_daemon任务投递，
+ *          避免应用回调阻塞协议栈任务。连接类事件每轮全部投递；GATT数据类事件每轮至多
+ *          CONFIG_UHOS_BLE_EVT_DATA_BUDGET条，且每条之前先检查连接类队列；广播上报在其后按批次投递。
+ *          断连事件投递前先投递该连接仍在排队的数据类事件。队列已满或ble_daemon任务未运行时事件
+ *          被丢弃并计数，不在协议栈上下文回调用户。
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：BLE用户回调事件队列的功能实现
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>连接/断连事件使用预分配的事件，不因内存不足丢失
+ * </table>
+ */
+
+#define LOG_TAG "ble-e"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_osal.h"
+#include "uh_time.h"
+#include "uh_log.h"
+
+#include "uh_ble.h"
+#include "uh_ble_conn.h"
+#include "uh_ble_evt.h"
+
+/**************************************************************************************************/
+/*                                          外部引用声明                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define UHOS_BLE_EVT_PRIO_CONN      0                           //<! 连接类队列
+#define UHOS_BLE_EVT_PRIO_DATA      1                           //<! GATT数据类队列
+#define UHOS_BLE_EVT_PRIO_NUM       2
+
+#define UHOS_BLE_EVT_POOL_CONNECT   0                           //<! 预分配的连接事件
+#define UHOS_BLE_EVT_POOL_DISCONN   1                           //<! 预分配的断连事件
+#define UHOS_BLE_EVT_POOL_NUM       2
+
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      单个优先级的事件队列
+ */
+typedef struct uhos_ble_pal_evt_queue
+{
+    uhos_ble_pal_evt_t *head;
+    uhos_ble_pal_evt_t *tail;
+    uhos_u16            num;
+} uhos_ble_pal_evt_queue_t;
+
+/**
+ * @struct      单个事件分类的统计数据
+ */
+typedef struct uhos_ble_pal_evt_stats
+{
+    uhos_ble_event_stats_t stats;
+    uhos_u64               total_latency_us;
+    uhos_u64               total_cb_us;
+} uhos_ble_pal_evt_stats_t;
+
+/**
+ * @struct      事件队列控制块
+ */
+typedef struct uhos_ble_pal_evt_ctl
+{
+    uhos_mutex_t             mutex;                             //<! 互斥锁，保护队列与统计
+    uhos_sem_t               sem;                               //<! ble_daemon任务的唤醒信号量
+    uhos_u32                 wake_pending;                      //<! 已请求唤醒标志
+    uhos_bool                running;                           //<! 事件交给ble_daemon任务投递
+    uhos_ble_pal_evt_queue_t queue[UHOS_BLE_EVT_PRIO_NUM];
+    uhos_ble_pal_evt_stats_t stats[UHOS_BLE_EVENT_TYPE_NUM];
+    uhos_ble_pal_evt_t      *pool_free[UHOS_BLE_EVT_POOL_NUM];  //<! 空闲的预分配事件，以next链接
+    uhos_u8                  pool_num[UHOS_BLE_EVT_POOL_NUM];   //<! 已分配的预分配事件数
+} uhos_ble_pal_evt_ctl_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_ble_pal_evt_ctl_t g_uhos_ble_pal_evt_ctl = {0};
+
+/**************************************************************************************************/
+/*                                          内部函数原型                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static void uhos_ble_pal_evt_lock(void)
+{
+    uhos_mutex_wait(g_uhos_ble_pal_evt_ctl.mutex, UHOS_MUTEX_WAIT_FOREVER);
+}
+
+static void uhos_ble_pal_evt_unlock(void)
+{
+    uhos_mutex_release(g_uhos_ble_pal_evt_ctl.mutex);
+}
+
+static uhos_u8 uhos_ble_pal_evt_prio(uhos_u8 type)
+{
+    return (UHOS_BLE_EVENT_TYPE_CONN == type) ? UHOS_BLE_EVT_PRIO_CONN : UHOS_BLE_EVT_PRIO_DATA;
+}
+
+/**
+ * @brief       记录一次回调的时延与耗时（调用者持有锁）
+ */
+static void uhos_ble_pal_evt_stats_add(uhos_u8 type, uhos_u16 num, uhos_u32 latency_us, uhos_u32 cb_us)
+{
+    uhos_ble_pal_evt_stats_t *st = &g_uhos_ble_pal_evt_ctl.stats[type];
+
+    st->stats.dispatched += num;
+    st->total_latency_us += (uhos_u64)latency_us * num;
+    st->total_cb_us      += cb_us;
+    if (latency_us > st->stats.max_latency_us)
+    {
+        st->stats.max_latency_us = latency_us;
+    }
+    if (cb_us > st->stats.max_cb_us)
+    {
+        st->stats.max_cb_us = cb_us;
+    }
+    if (cb_us > CONFIG_UHOS_BLE_EVT_CB_BUDGET_US)
+    {
+        st->stats.overruns++;
+    }
+}
+
+/**
+ * @brief       从指定优先级的队列头取出一个事件
+ */
+static uhos_ble_pal_evt_t *uhos_ble_pal_evt_pop(uhos_u8 prio)
+{
+    uhos_ble_pal_evt_queue_t *queue = &g_uhos_ble_pal_evt_ctl.queue[prio];
+    uhos_ble_pal_evt_t       *evt   = UHOS_NULL;
+
+    uhos_ble_pal_evt_lock();
+    evt = queue->head;
+    if (UHOS_NULL != evt)
+    {
+        queue->head = evt->next;
+        if (UHOS_NULL == queue->head)
+        {
+            queue->tail = UHOS_NULL;
+        }
+        queue->num--;
+        g_uhos_ble_pal_evt_ctl.stats[evt->type].stats.depth--;
+    }
+    uhos_ble_pal_evt_unlock();
+
+    return evt;
+}
+
+/**
+ * @brief       取出数据类队列中属于指定连接的全部事件，保持原有顺序
+ */
+static uhos_ble_pal_evt_t *uhos_ble_pal_evt_conn_take(uhos_u16 conn_id)
+{
+    uhos_ble_pal_evt_queue_t *queue = &g_uhos_ble_pal_evt_ctl.queue[UHOS_BLE_EVT_PRIO_DATA];
+    uhos_ble_pal_evt_t       *prev  = UHOS_NULL;
+    uhos_ble_pal_evt_t       *evt   = UHOS_NULL;
+    uhos_ble_pal_evt_t       *next  = UHOS_NULL;
+    uhos_ble_pal_evt_t       *head  = UHOS_NULL;
+    uhos_ble_pal_evt_t       *tail  = UHOS_NULL;
+
+    uhos_ble_pal_evt_lock();
+    for (evt = queue->head; UHOS_NULL != evt; evt = next)
+    {
+        next = evt->next;
+        if (evt->conn_id != conn_id)
+        {
+            prev = evt;
+            continue;
+        }
+
+        if (UHOS_NULL == prev)
+        {
+            queue->head = next;
+        }
+        else
+        {
+            prev->next = next;
+        }
+        if (queue->tail == evt)
+        {
+            queue->tail = prev;
+        }
+        queue->num--;
+        g_uhos_ble_pal_evt_ctl.stats[evt->type].stats.depth--;
+
+        evt->next = UHOS_NULL;
+        if (UHOS_NULL == tail)
+        {
+            head = evt;
+        }
+        else
+        {
+            tail->next = evt;
+        }
+        tail = evt;
+    }
+    uhos_ble_pal_evt_unlock();
+
+    return head;
+}
+
+/**
+ * @brief       补齐预分配的连接/断连事件，每类CONFIG_UHOS_BLE_MAX_CONN个，分配后不再释放
+ */
+static void uhos_ble_pal_evt_pool_fill(void)
+{
+    uhos_ble_pal_evt_ctl_t *ctl  = &g_uhos_ble_pal_evt_ctl;
+    uhos_ble_pal_evt_t     *evt  = UHOS_NULL;
+    uhos_u8                 pool = 0;
+
+    for (pool = 0; pool < UHOS_BLE_EVT_POOL_NUM; pool++)
+    {
+        while (ctl->pool_num[pool] < CONFIG_UHOS_BLE_MAX_CONN)
+        {
+            evt = (uhos_ble_pal_evt_t *)uhos_libc_malloc(sizeof(uhos_ble_pal_evt_t));
+            if (UHOS_NULL == evt)
+            {
+                UHOS_LOG_MEM_ALLOC_FAIL();
+                return;
+            }
+
+            uhos_libc_memset(evt, 0, sizeof(uhos_ble_pal_evt_t));
+            evt->pooled = pool + 1;
+
+            uhos_ble_pal_evt_lock();
+            evt->next            = ctl->pool_free[pool];
+            ctl->pool_free[pool] = evt;
+            ctl->pool_num[pool]++;
+            uhos_ble_pal_evt_unlock();
+        }
+    }
+}
+
+/**
+ * @brief       释放事件，预分配的事件归还空闲链表
+ */
+static void uhos_ble_pal_evt_free(uhos_ble_pal_evt_t *evt)
+{
+    uhos_ble_pal_evt_ctl_t *ctl  = &g_uhos_ble_pal_evt_ctl;
+    uhos_u8                 pool = 0;
+
+    if (!evt->pooled)
+    {
+        uhos_libc_free(evt);
+        return;
+    }
+
+    pool = evt->pooled - 1;
+
+    uhos_ble_pal_evt_lock();
+    evt->next            = ctl->pool_free[pool];
+    ctl->pool_free[pool] = evt;
+    uhos_ble_pal_evt_unlock();
+}
+
+/**
+ * @brief       投递一个出队的事件并释放
+ */
+static void uhos_ble_pal_evt_run(uhos_ble_pal_evt_t *evt)
+{
+    uhos_u32 start   = uhos_ble_pal_evt_now_us();
+    uhos_u32 latency = start - evt->time_us;
+    uhos_u32 cb_us   = 0;
+
+    evt->handler(evt);
+    cb_us = uhos_ble_pal_evt_now_us() - start;
+
+    if (cb_us > CONFIG_UHOS_BLE_EVT_CB_BUDGET_US)
+    {
+        UHOS_LOGW("evt type %d cb %u us over budget", evt->type, cb_us);
+    }
+
+    uhos_ble_pal_evt_lock();
+    uhos_ble_pal_evt_stats_add(evt->type, 1, latency, cb_us);
+    uhos_ble_pal_evt_unlock();
+
+    uhos_ble_pal_evt_free(evt);
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       事件队列初始化
+ */
+void uhos_ble_pal_evt_init(void)
+{
+    uhos_ble_pal_evt_ctl_t *ctl = &g_uhos_ble_pal_evt_ctl;
+
+    if (UHOS_NULL == ctl->mutex)
+    {
+        if (UHOS_SUCCESS != uhos_mutex_create(&ctl->mutex))
+        {
+            UHOS_LOGE("create mutex err");
+            return;
+        }
+    }
+
+    if (UHOS_NULL == ctl->sem)
+    {
+        if (UHOS_SUCCESS != uhos_sem_create(&ctl->sem, 0))
+        {
+            UHOS_LOGE("create sem err");
+            return;
+        }
+    }
+
+    uhos_ble_pal_evt_pool_fill();
+
+    uhos_ble_pal_evt_lock();
+    ctl->running = UHOS_TRUE;
+    uhos_ble_pal_evt_unlock();
+}
+
+/**
+ * @brief       事件队列反初始化，丢弃未投递的事件
+ */
+void uhos_ble_pal_evt_deinit(void)
+{
+    uhos_ble_pal_evt_ctl_t *ctl = &g_uhos_ble_pal_evt_ctl;
+    uhos_ble_pal_evt_t     *evt = UHOS_NULL;
+    uhos_u8                 i   = 0;
+
+    if (UHOS_NULL == ctl->mutex)
+    {
+        return;
+    }
+
+    uhos_ble_pal_evt_lock();
+    ctl->running = UHOS_FALSE;
+    uhos_ble_pal_evt_unlock();
+
+    for (i = 0; i < UHOS_BLE_EVT_PRIO_NUM; i++)
+    {
+        while (UHOS_NULL != (evt = uhos_ble_pal_evt_pop(i)))
+        {
+            uhos_ble_pal_evt_free(evt);
+        }
+    }
+}
+
+/**
+ * @brief       申请一个事件
+ */
+uhos_ble_pal_evt_t *uhos_ble_pal_evt_alloc(uhos_ble_event_type_t type, uhos_u16 conn_id, uhos_u16 len,
+                                           uhos_bool reliable)
+{
+    uhos_ble_pal_evt_ctl_t *ctl = &g_uhos_ble_pal_evt_ctl;
+    uhos_ble_pal_evt_t     *evt = UHOS_NULL;
+    uhos_bool               full = UHOS_FALSE;
+
+    if ((UHOS_NULL == ctl->mutex) || (type >= UHOS_BLE_EVENT_TYPE_NUM))
+    {
+        return UHOS_NULL;
+    }
+
+    // 连接类事件不设上限，数量受连接数约束；reliable事件的数量由调用者保证有界
+    uhos_ble_pal_evt_lock();
+    full = !ctl->running || (!reliable && (UHOS_BLE_EVT_PRIO_DATA == uhos_ble_pal_evt_prio(type)) &&
+                             (ctl->queue[UHOS_BLE_EVT_PRIO_DATA].num >= CONFIG_UHOS_BLE_EVT_DATA_NUM));
+    uhos_ble_pal_evt_unlock();
+
+    if (full)
+    {
+        return UHOS_NULL;
+    }
+
+    evt = (uhos_ble_pal_evt_t *)uhos_libc_malloc(sizeof(uhos_ble_pal_evt_t) + len);
+    if (UHOS_NULL == evt)
+    {
+        return UHOS_NULL;
+    }
+
+    uhos_libc_memset(evt, 0, sizeof(uhos_ble_pal_evt_t));
+    evt->type    = (uhos_u8)type;
+    evt->conn_id = conn_id;
+    evt->len     = len;
+
+    return evt;
+}
+
+/**
+ * @brief       申请一个预分配的连接/断连事件
+ */
+uhos_ble_pal_evt_t *uhos_ble_pal_evt_conn_alloc(uhos_u16 conn_id, uhos_bool disconnect)
+{
+    uhos_ble_pal_evt_ctl_t *ctl    = &g_uhos_ble_pal_evt_ctl;
+    uhos_ble_pal_evt_t     *evt    = UHOS_NULL;
+    uhos_u8                 pool   = disconnect ? UHOS_BLE_EVT_POOL_DISCONN : UHOS_BLE_EVT_POOL_CONNECT;
+    uhos_u8                 pooled = 0;
+
+    if (UHOS_NULL == ctl->mutex)
+    {
+        return UHOS_NULL;
+    }
+
+    uhos_ble_pal_evt_lock();
+    if (ctl->running && (UHOS_NULL != ctl->pool_free[pool]))
+    {
+        evt                  = ctl->pool_free[pool];
+        ctl->pool_free[pool] = evt->next;
+    }
+    uhos_ble_pal_evt_unlock();
+
+    if (UHOS_NULL == evt)
+    {
+        return UHOS_NULL;
+    }
+
+    pooled = evt->pooled;
+    uhos_libc_memset(evt, 0, sizeof(uhos_ble_pal_evt_t));
+    evt->pooled  = pooled;
+    evt->type    = UHOS_BLE_EVENT_TYPE_CONN;
+    evt->conn_id = conn_id;
+
+    return evt;
+}
+
+/**
+ * @brief       事件入队并唤醒ble_daemon任务
+ */
+void uhos_ble_pal_evt_post(uhos_ble_pal_evt_t *evt, uhos_ble_pal_evt_handler_t handler)
+{
+    uhos_ble_pal_evt_ctl_t   *ctl   = &g_uhos_ble_pal_evt_ctl;
+    uhos_ble_pal_evt_queue_t *queue = &ctl->queue[uhos_ble_pal_evt_prio(evt->type)];
+    uhos_ble_event_stats_t   *st    = &ctl->stats[evt->type].stats;
+
+    evt->handler = handler;
+    evt->next    = UHOS_NULL;
+    evt->time_us = uhos_ble_pal_evt_now_us();
+
+    uhos_ble_pal_evt_lock();
+    if (UHOS_NULL == queue->tail)
+    {
+        queue->head = evt;
+    }
+    else
+    {
+        queue->tail->next = evt;
+    }
+    queue->tail = evt;
+    queue->num++;
+
+    st->posted++;
+    st->depth++;
+    if (st->depth > st->max_depth)
+    {
+        st->max_depth = st->depth;
+    }
+    uhos_ble_pal_evt_unlock();
+
+    uhos_ble_pal_evt_wake();
+}
+
+/**
+ * @brief       记录一次无法入队而丢弃的事件
+ */
+void uhos_ble_pal_evt_drop(uhos_ble_event_type_t type)
+{
+    if ((UHOS_NULL == g_uhos_ble_pal_evt_ctl.mutex) || (type >= UHOS_BLE_EVENT_TYPE_NUM))
+    {
+        return;
+    }
+
+    uhos_ble_pal_evt_lock();
+    g_uhos_ble_pal_evt_ctl.stats[type].stats.dropped++;
+    uhos_ble_pal_evt_unlock();
+}
+
+/**
+ * @brief       唤醒ble_daemon任务
+ * @note        任务尚未被唤醒时才释放信号量，避免每个事件一次上下文切换。
+ *              生产者“先发布事件再读唤醒标志”与任务“先清唤醒标志再读事件”是先写后读的交叉访问，
+ *              两端都以SEQ_CST屏障分隔，保证至少一方看到对方的写入，否则唤醒会丢失到信号量超时
+ */
+void uhos_ble_pal_evt_wake(void)
+{
+    uhos_ble_pal_evt_ctl_t *ctl = &g_uhos_ble_pal_evt_ctl;
+
+    if (UHOS_NULL == ctl->sem)
+    {
+        return;
+    }
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (0 == __atomic_exchange_n(&ctl->wake_pending, 1, __ATOMIC_SEQ_CST))
+    {
+        uhos_sem_release(ctl->sem);
+    }
+}
+
+/**
+ * @brief       等待事件或超时
+ */
+void uhos_ble_pal_evt_wait(uhos_u32 timeout)
+{
+    uhos_ble_pal_evt_ctl_t *ctl = &g_uhos_ble_pal_evt_ctl;
+
+    if (UHOS_NULL == ctl->sem)
+    {
+        UHOS_LOGW("ble evt sem is null");
+        uhos_thread_sleep(timeout);
+        return;
+    }
+
+    uhos_sem_wait(ctl->sem, timeout);
+
+    // 先清除唤醒标志再取事件，保证取事件期间新产生的事件能再次唤醒本任务
+    __atomic_store_n(&ctl->wake_pending, 0, __ATOMIC_SEQ_CST);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief       按优先级投递事件
+ */
+uhos_bool uhos_ble_pal_evt_dispatch(void)
+{
+    uhos_ble_pal_evt_ctl_t *ctl    = &g_uhos_ble_pal_evt_ctl;
+    uhos_ble_pal_evt_t     *evt    = UHOS_NULL;
+    uhos_u16                budget = CONFIG_UHOS_BLE_EVT_DATA_BUDGET;
+    uhos_bool               more   = UHOS_FALSE;
+
+    if (UHOS_NULL == ctl->mutex)
+    {
+        return UHOS_FALSE;
+    }
+
+    while (budget > 0)
+    {
+        // 连接类事件优先，每次投递数据类事件之前都先清空
+        while (UHOS_NULL != (evt = uhos_ble_pal_evt_pop(UHOS_BLE_EVT_PRIO_CONN)))
+        {
+            // 断连之前先投递该连接已排队的数据，保证用户不会在断连之后收到它们
+            if (evt->flush)
+            {
+                uhos_ble_pal_evt_t *pending = uhos_ble_pal_evt_conn_take(evt->conn_id);
+                uhos_ble_pal_evt_t *next    = UHOS_NULL;
+
+                for (; UHOS_NULL != pending; pending = next)
+                {
+                    next = pending->next;
+                    uhos_ble_pal_evt_run(pending);
+                }
+            }
+
+            uhos_ble_pal_evt_run(evt);
+        }
+
+        evt = uhos_ble_pal_evt_pop(UHOS_BLE_EVT_PRIO_DATA);
+        if (UHOS_NULL == evt)
+        {
+            break;
+        }
+
+        uhos_ble_pal_evt_run(evt);
+        budget--;
+    }
+
+    uhos_ble_pal_evt_lock();
+    more = (0 != ctl->queue[UHOS_BLE_EVT_PRIO_CONN].num) || (0 != ctl->queue[UHOS_BLE_EVT_PRIO_DATA].num);
+    uhos_ble_pal_evt_unlock();
+
+    return more;
+}
+
+/**
+ * @brief       记录一次由调用者自行投递的回调
+ */
+void uhos_ble_pal_evt_record(uhos_ble_event_type_t type, uhos_u16 num, uhos_u32 latency_us, uhos_u32 cb_us)
+{
+    if ((UHOS_NULL == g_uhos_ble_pal_evt_ctl.mutex) || (type >= UHOS_BLE_EVENT_TYPE_NUM) || (0 == num))
+    {
+        return;
+    }
+
+    uhos_ble_pal_evt_lock();
+    g_uhos_ble_pal_evt_ctl.stats[type].stats.posted += num;
+    uhos_ble_pal_evt_stats_add(type, num, latency_us, cb_us);
+    uhos_ble_pal_evt_unlock();
+}
+
+/**
+ * @brief       微秒时间戳
+ */
+uhos_u32 uhos_ble_pal_evt_now_us(void)
+{
+    struct uhos_timeval tv = {0};
+
+    uhos_gettimeofday(&tv, UHOS_NULL);
+
+    return (uhos_u32)tv.tv_sec * 1000000 + (uhos_u32)tv.tv_usec;
+}
+
+/**
+ * @brief       获取用户回调事件的投递统计信息
+ */
+uhos_ble_status_t uhos_ble_event_stats_get(uhos_ble_event_type_t type, uhos_ble_event_stats_t *stats)
+{
+    uhos_ble_pal_evt_stats_t *st = UHOS_NULL;
+
+    if ((UHOS_NULL == stats) || (type >= UHOS_BLE_EVENT_TYPE_NUM) || (UHOS_NULL == g_uhos_ble_pal_evt_ctl.mutex))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    st = &g_uhos_ble_pal_evt_ctl.stats[type];
+
+    uhos_ble_pal_evt_lock();
+    uhos_libc_memcpy(stats, &st->stats, sizeof(uhos_ble_event_stats_t));
+    if (0 != st->stats.dispatched)
+    {
+        stats->avg_latency_us = (uhos_u32)(st->total_latency_us / st->stats.dispatched);
+        stats->avg_cb_us      = (uhos_u32)(st->total_cb_us / st->stats.dispatched);
+    }
+    uhos_ble_pal_evt_unlock();
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       清零用户回调事件的投递统计信息
+ */
+uhos_ble_status_t uhos_ble_event_stats_reset(void)
+{
+    uhos_ble_pal_evt_stats_t *st    = UHOS_NULL;
+    uhos_u16                  depth = 0;
+    uhos_u8                   i     = 0;
+
+    if (UHOS_NULL == g_uhos_ble_pal_evt_ctl.mutex)
+    {
+        return UHOS_BLE_SUCCESS;
+    }
+
+    uhos_ble_pal_evt_lock();
+    for (i = 0; i < UHOS_BLE_EVENT_TYPE_NUM; i++)
+    {
+        st    = &g_uhos_ble_pal_evt_ctl.stats[i];
+        depth = st->stats.depth;
+        uhos_libc_memset(st, 0, sizeof(uhos_ble_pal_evt_stats_t));
+        st->stats.depth     = depth;
+        st->stats.max_depth = depth;
+    }
+    uhos_ble_pal_evt_unlock();
+
+    return UHOS_BLE_SUCCESS;
+}
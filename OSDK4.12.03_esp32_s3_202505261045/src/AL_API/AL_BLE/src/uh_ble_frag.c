@@ -0,0 +1,575 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_frag.c
+ * @author agent (agent@local)
+ * @brief 基于MTU的大数据分片发送与重组的功能实现
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：基于MTU的大数据分片发送与重组的功能实现
+ * </table>
+ */
+
+#define LOG_TAG "ble-r"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_osal.h"
+#include "uh_log.h"
+
+#include "uh_ble.h"
+#include "uh_ble_frag.h"
+#include "uh_ble_frag_pal.h"
+
+/**************************************************************************************************/
+/*                                          外部引用声明                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+// 默认流水线窗口
+#ifndef CONFIG_UHOS_BLE_FRAG_WINDOW
+#define CONFIG_UHOS_BLE_FRAG_WINDOW         8
+#endif
+
+// 可重组的最大消息长度
+#ifndef CONFIG_UHOS_BLE_FRAG_MAX_LEN
+#define CONFIG_UHOS_BLE_FRAG_MAX_LEN        8192
+#endif
+
+// 同时存在的最大通道数
+#ifndef CONFIG_UHOS_BLE_FRAG_CHANNEL_NUM
+#define CONFIG_UHOS_BLE_FRAG_CHANNEL_NUM    4
+#endif
+
+#define UHOS_BLE_FRAG_ATT_HDR_LEN           3                   //<! ATT notify/write命令头长度
+#define UHOS_BLE_FRAG_WRITE_CMD_MAX         255                 //<! uhos_ble_gattc_write_cmd单次最大长度
+#define UHOS_BLE_FRAG_RETRY_MS              5                   //<! 链路忙时的重试间隔
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_mutex_t     g_uhos_ble_pal_frag_mutex = UHOS_NULL;                          //<! 保护通道表与发送完成计数
+static uhos_ble_frag_t *g_uhos_ble_pal_frag_chs[CONFIG_UHOS_BLE_FRAG_CHANNEL_NUM] = {0}; //<! 已初始化的通道
+
+
+/**************************************************************************************************/
+/*                                          内部函数原型                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static void uhos_ble_frag_lock(void)
+{
+    uhos_mutex_wait(g_uhos_ble_pal_frag_mutex, UHOS_MUTEX_WAIT_FOREVER);
+}
+
+static void uhos_ble_frag_unlock(void)
+{
+    uhos_mutex_release(g_uhos_ble_pal_frag_mutex);
+}
+
+/**
+ * @brief       在通道表中查找通道（需持锁调用）
+ * @return      通道序号，不存在返回CONFIG_UHOS_BLE_FRAG_CHANNEL_NUM
+ */
+static uhos_u8 uhos_ble_frag_slot_find(const uhos_ble_frag_t *ch)
+{
+    uhos_u8 i = 0;
+
+    for (i = 0; i < CONFIG_UHOS_BLE_FRAG_CHANNEL_NUM; i++)
+    {
+        if (g_uhos_ble_pal_frag_chs[i] == ch)
+        {
+            break;
+        }
+    }
+
+    return i;
+}
+
+/**
+ * @brief       获取通道当前可用的单片最大长度（含分片头）
+ * @param[in]   ch  分片通道
+ * @return      单片最大长度，0表示连接不存在
+ */
+static uhos_u16 uhos_ble_frag_chunk_max(const uhos_ble_frag_t *ch)
+{
+    uhos_u16          mtu    = 0;
+    uhos_ble_status_t status = UHOS_BLE_ERROR;
+
+    if (UHOS_BLE_FRAG_LINK_NOTIFY == ch->link)
+    {
+        status = uhos_ble_gatts_mtu_get(ch->conn_handle, &mtu);
+    }
+    else
+    {
+        status = uhos_ble_gattc_mtu_get(ch->conn_handle, &mtu);
+    }
+
+    if ((UHOS_BLE_SUCCESS != status) || (mtu <= UHOS_BLE_FRAG_ATT_HDR_LEN + UHOS_BLE_FRAG_FIRST_HDR_LEN))
+    {
+        return 0;
+    }
+
+    mtu -= UHOS_BLE_FRAG_ATT_HDR_LEN;
+
+    if ((UHOS_BLE_FRAG_LINK_WRITE_CMD == ch->link) && (mtu > UHOS_BLE_FRAG_WRITE_CMD_MAX))
+    {
+        mtu = UHOS_BLE_FRAG_WRITE_CMD_MAX;
+    }
+
+    return mtu;
+}
+
+/**
+ * @brief       流水线窗口已满时等待（仅notify链路，窗口为连接发送队列中的排队数）
+ * @param[in]   ch          分片通道
+ * @param[in]   deadline    截止时间
+ * @return      UHOS_TRUE-可以继续发送，UHOS_FALSE-超时
+ */
+static uhos_bool uhos_ble_frag_window_wait(uhos_ble_frag_t *ch, uhos_u32 deadline)
+{
+    uhos_ble_conn_stats_t conn_stats = {0};
+
+    if (UHOS_BLE_FRAG_LINK_NOTIFY != ch->link)
+    {
+        return UHOS_TRUE;
+    }
+
+    while ((UHOS_BLE_SUCCESS == uhos_ble_gatts_conn_stats_get(ch->conn_handle, &conn_stats)) &&
+           (conn_stats.queued >= ch->window))
+    {
+        if ((uhos_s32)(uhos_current_time_get() - deadline) >= 0)
+        {
+            return UHOS_FALSE;
+        }
+
+        uhos_thread_sleep(UHOS_BLE_FRAG_RETRY_MS);
+    }
+
+    return UHOS_TRUE;
+}
+
+/**
+ * @brief       通过链路发送一个分片
+ */
+static uhos_ble_status_t uhos_ble_frag_tx(uhos_ble_frag_t *ch, uhos_u8 *buf, uhos_u16 len)
+{
+    if (UHOS_BLE_FRAG_LINK_NOTIFY == ch->link)
+    {
+        return uhos_ble_gatts_notify_or_indicate(ch->conn_handle, ch->srv_handle, ch->char_handle, 0, buf, len);
+    }
+
+    return uhos_ble_gattc_write_cmd(ch->conn_handle, ch->char_handle, buf, (uhos_u8)len);
+}
+
+/**
+ * @brief       一个分片已提交给协议栈，计入本段连续发送
+ */
+static void uhos_ble_frag_tx_submitted(uhos_ble_frag_t *ch, uhos_u16 payload)
+{
+    uhos_ble_frag_lock();
+
+    if (0 == ch->tx_unacked)
+    {
+        ch->tx_busy_start = uhos_current_time_get();
+        ch->tx_busy_bytes = 0;
+    }
+
+    ch->tx_unacked++;
+    ch->tx_busy_bytes += payload;
+
+    uhos_ble_frag_unlock();
+}
+
+/**
+ * @brief       丢弃正在重组的消息
+ */
+static void uhos_ble_frag_rx_reset(uhos_ble_frag_t *ch)
+{
+    ch->rx_active = 0;
+    ch->rx_total  = 0;
+    ch->rx_len    = 0;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       分片通道初始化
+ */
+void uhos_ble_pal_frag_init(void)
+{
+    if (UHOS_NULL == g_uhos_ble_pal_frag_mutex)
+    {
+        if (UHOS_SUCCESS != uhos_mutex_create(&g_uhos_ble_pal_frag_mutex))
+        {
+            UHOS_LOGE("create mutex err");
+        }
+    }
+}
+
+/**
+ * @brief       协议栈上报一包notify或写命令发送完成
+ * @note        计入该连接上同类型链路、有未完成分片的通道；未完成分片全部完成时，
+ *              以本段连续发送的开始时间到当前时间计算有效载荷吞吐率
+ */
+void uhos_ble_pal_frag_tx_done(uhos_u16 conn_id, uhos_ble_frag_link_t link)
+{
+    uhos_ble_frag_t *ch      = UHOS_NULL;
+    uhos_u32         elapsed = 0;
+    uhos_u8          i       = 0;
+
+    if (UHOS_NULL == g_uhos_ble_pal_frag_mutex)
+    {
+        return;
+    }
+
+    uhos_ble_frag_lock();
+
+    for (i = 0; i < CONFIG_UHOS_BLE_FRAG_CHANNEL_NUM; i++)
+    {
+        ch = g_uhos_ble_pal_frag_chs[i];
+        if (ch && (ch->conn_handle == conn_id) && (ch->link == link) && ch->tx_unacked)
+        {
+            ch->tx_unacked--;
+            ch->stats.tx_confirmed++;
+
+            if (0 == ch->tx_unacked)
+            {
+                elapsed = uhos_current_time_get() - ch->tx_busy_start;
+                ch->stats.goodput_bps = (uhos_u32)((uhos_u64)ch->tx_busy_bytes * 1000 / (elapsed ? elapsed : 1));
+            }
+            break;
+        }
+    }
+
+    uhos_ble_frag_unlock();
+}
+
+/**
+ * @brief       初始化分片通道
+ */
+uhos_ble_status_t uhos_ble_frag_init(uhos_ble_frag_t     *ch,
+                                     uhos_ble_frag_link_t link,
+                                     uhos_u16             conn_handle,
+                                     uhos_u16             srv_handle,
+                                     uhos_u16             char_handle,
+                                     uhos_u8              window)
+{
+    uhos_u8 slot = 0;
+
+    if ((UHOS_NULL == ch) || (UHOS_NULL == g_uhos_ble_pal_frag_mutex))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_frag_lock();
+
+    slot = uhos_ble_frag_slot_find(ch);
+    if (slot >= CONFIG_UHOS_BLE_FRAG_CHANNEL_NUM)
+    {
+        slot = uhos_ble_frag_slot_find(UHOS_NULL);
+    }
+
+    if (slot >= CONFIG_UHOS_BLE_FRAG_CHANNEL_NUM)
+    {
+        uhos_ble_frag_unlock();
+        UHOS_LOGE("too many frag channels");
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_libc_memset(ch, 0, sizeof(uhos_ble_frag_t));
+
+    ch->link        = link;
+    ch->conn_handle = conn_handle;
+    ch->srv_handle  = srv_handle;
+    ch->char_handle = char_handle;
+    ch->window      = window ? window : CONFIG_UHOS_BLE_FRAG_WINDOW;
+
+    g_uhos_ble_pal_frag_chs[slot] = ch;
+
+    uhos_ble_frag_unlock();
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       释放分片通道的重组缓存
+ */
+void uhos_ble_frag_deinit(uhos_ble_frag_t *ch)
+{
+    uhos_u8 slot = 0;
+
+    if (UHOS_NULL == ch)
+    {
+        return;
+    }
+
+    if (g_uhos_ble_pal_frag_mutex)
+    {
+        uhos_ble_frag_lock();
+
+        slot = uhos_ble_frag_slot_find(ch);
+        if (slot < CONFIG_UHOS_BLE_FRAG_CHANNEL_NUM)
+        {
+            g_uhos_ble_pal_frag_chs[slot] = UHOS_NULL;
+        }
+        ch->tx_unacked = 0;
+
+        uhos_ble_frag_unlock();
+    }
+
+    uhos_libc_free(ch->rx_buf);
+    ch->rx_buf = UHOS_NULL;
+    uhos_ble_frag_rx_reset(ch);
+}
+
+/**
+ * @brief       分片发送一条消息
+ */
+uhos_ble_status_t uhos_ble_frag_send(uhos_ble_frag_t *ch, const uhos_u8 *data, uhos_u32 len, uhos_u32 timeout_ms)
+{
+    uhos_u8          *buf      = UHOS_NULL;
+    uhos_u16          max      = 0;
+    uhos_u16          hdr      = 0;
+    uhos_u16          chunk    = 0;
+    uhos_u32          offset   = 0;
+    uhos_u32          deadline = uhos_current_time_get() + timeout_ms;
+    uhos_ble_status_t status   = UHOS_BLE_SUCCESS;
+
+    if ((UHOS_NULL == ch) || (UHOS_NULL == data) || (0 == len) || (len > 0xFFFF))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    max = uhos_ble_frag_chunk_max(ch);
+    if (0 == max)
+    {
+        // 连接已断开，之前提交的分片不会再有发送完成事件
+        uhos_ble_frag_lock();
+        ch->tx_unacked = 0;
+        uhos_ble_frag_unlock();
+
+        UHOS_LOGW("conn %d not ready", ch->conn_handle);
+        return UHOS_BLE_ERROR;
+    }
+
+    buf = uhos_libc_malloc(max);
+    if (UHOS_NULL == buf)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    while (offset < len)
+    {
+        // 组装分片头
+        buf[0] = ch->tx_seq & UHOS_BLE_FRAG_SEQ_MASK;
+        hdr    = UHOS_BLE_FRAG_HDR_LEN;
+
+        if (0 == offset)
+        {
+            buf[0] |= UHOS_BLE_FRAG_FLAG_FIRST;
+            buf[1]  = (uhos_u8)(len & 0xFF);
+            buf[2]  = (uhos_u8)(len >> 8);
+            hdr     = UHOS_BLE_FRAG_FIRST_HDR_LEN;
+        }
+
+        chunk = max - hdr;
+        if (chunk >= len - offset)
+        {
+            chunk   = (uhos_u16)(len - offset);
+            buf[0] |= UHOS_BLE_FRAG_FLAG_LAST;
+        }
+
+        uhos_libc_memcpy(&buf[hdr], &data[offset], chunk);
+
+        // 窗口已满或链路忙时等待
+        for (;;)
+        {
+            if (!uhos_ble_frag_window_wait(ch, deadline))
+            {
+                status = UHOS_BLE_BUSY;
+                break;
+            }
+
+            // 先计数再提交：发送完成事件可能在提交接口返回前到达
+            uhos_ble_frag_tx_submitted(ch, chunk);
+
+            status = uhos_ble_frag_tx(ch, buf, hdr + chunk);
+            if (UHOS_BLE_SUCCESS == status)
+            {
+                break;
+            }
+
+            uhos_ble_frag_lock();
+            ch->tx_unacked--;
+            ch->tx_busy_bytes -= chunk;
+            uhos_ble_frag_unlock();
+
+            // write without response失败时协议栈不区分拥塞与错误，按链路忙重试
+            if (UHOS_BLE_FRAG_LINK_WRITE_CMD == ch->link)
+            {
+                status = UHOS_BLE_BUSY;
+            }
+
+            if ((UHOS_BLE_BUSY != status) || ((uhos_s32)(uhos_current_time_get() - deadline) >= 0))
+            {
+                break;
+            }
+
+            ch->stats.tx_retries++;
+            uhos_thread_sleep(UHOS_BLE_FRAG_RETRY_MS);
+        }
+
+        if (UHOS_BLE_SUCCESS != status)
+        {
+            UHOS_LOGW("frag send stop at %u/%u, %d", offset, len, status);
+            break;
+        }
+
+        ch->tx_seq++;
+        ch->stats.tx_chunks++;
+        offset += chunk;
+    }
+
+    uhos_libc_free(buf);
+
+    if (UHOS_BLE_SUCCESS == status)
+    {
+        ch->stats.tx_msgs++;
+        ch->stats.tx_bytes += len;
+    }
+
+    return status;
+}
+
+/**
+ * @brief       输入一个收到的分片
+ */
+uhos_ble_status_t uhos_ble_frag_input(uhos_ble_frag_t *ch, const uhos_u8 *data, uhos_u16 len, const uhos_u8 **msg, uhos_u16 *msg_len)
+{
+    uhos_u8  flags = 0;
+    uhos_u8  seq   = 0;
+    uhos_u16 hdr   = UHOS_BLE_FRAG_HDR_LEN;
+    uhos_u16 total = 0;
+
+    if ((UHOS_NULL == ch) || (UHOS_NULL == data) || (len < UHOS_BLE_FRAG_HDR_LEN) || (UHOS_NULL == msg) || (UHOS_NULL == msg_len))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    flags = data[0] & (UHOS_BLE_FRAG_FLAG_FIRST | UHOS_BLE_FRAG_FLAG_LAST);
+    seq   = data[0] & UHOS_BLE_FRAG_SEQ_MASK;
+
+    if (flags & UHOS_BLE_FRAG_FLAG_FIRST)
+    {
+        if (len < UHOS_BLE_FRAG_FIRST_HDR_LEN)
+        {
+            ch->stats.rx_errors++;
+            return UHOS_BLE_ERROR;
+        }
+
+        if (ch->rx_active)
+        {
+            // 上一条消息未收完即开始新消息
+            ch->stats.rx_errors++;
+        }
+
+        total = (uhos_u16)(data[1] | (data[2] << 8));
+        hdr   = UHOS_BLE_FRAG_FIRST_HDR_LEN;
+
+        if ((0 == total) || (total > CONFIG_UHOS_BLE_FRAG_MAX_LEN))
+        {
+            UHOS_LOGW("frag total %d invalid", total);
+            uhos_ble_frag_rx_reset(ch);
+            ch->stats.rx_errors++;
+            return UHOS_BLE_ERROR;
+        }
+
+        if (UHOS_NULL == ch->rx_buf)
+        {
+            ch->rx_buf = uhos_libc_malloc(CONFIG_UHOS_BLE_FRAG_MAX_LEN);
+            if (UHOS_NULL == ch->rx_buf)
+            {
+                return UHOS_BLE_ERROR;
+            }
+        }
+
+        ch->rx_active = 1;
+        ch->rx_total  = total;
+        ch->rx_len    = 0;
+    }
+    else if (!ch->rx_active || (seq != ch->rx_seq))
+    {
+        // 丢片或乱序，丢弃当前消息，等待下一个首片
+        uhos_ble_frag_rx_reset(ch);
+        ch->stats.rx_errors++;
+        return UHOS_BLE_ERROR;
+    }
+
+    if (ch->rx_len + (len - hdr) > ch->rx_total)
+    {
+        uhos_ble_frag_rx_reset(ch);
+        ch->stats.rx_errors++;
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_libc_memcpy(&ch->rx_buf[ch->rx_len], &data[hdr], len - hdr);
+    ch->rx_len += len - hdr;
+    ch->rx_seq  = (seq + 1) & UHOS_BLE_FRAG_SEQ_MASK;
+
+    if (!(flags & UHOS_BLE_FRAG_FLAG_LAST))
+    {
+        return UHOS_BLE_BUSY;
+    }
+
+    if (ch->rx_len != ch->rx_total)
+    {
+        uhos_ble_frag_rx_reset(ch);
+        ch->stats.rx_errors++;
+        return UHOS_BLE_ERROR;
+    }
+
+    *msg     = ch->rx_buf;
+    *msg_len = ch->rx_len;
+
+    ch->stats.rx_msgs++;
+    ch->stats.rx_bytes += ch->rx_len;
+    ch->rx_active = 0;
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       获取分片通道的统计信息
+ */
+uhos_ble_status_t uhos_ble_frag_stats_get(const uhos_ble_frag_t *ch, uhos_ble_frag_stats_t *stats)
+{
+    if ((UHOS_NULL == ch) || (UHOS_NULL == stats) || (UHOS_NULL == g_uhos_ble_pal_frag_mutex))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    // 发送完成计数在协议栈回调中更新
+    uhos_ble_frag_lock();
+    uhos_libc_memcpy(stats, &ch->stats, sizeof(uhos_ble_frag_stats_t));
+    uhos_ble_frag_unlock();
+
+    return UHOS_BLE_SUCCESS;
+}
@@ -36,57 +36,115 @@
 
 #include "uh_ble.h"
 #include "uh_ble_common.h"
+#include "uh_ble_adv_cache.h"
+#include "uh_ble_adv_filter.h"
+#include "uh_ble_adv_pack.h"
+#include "uh_ble_adv_reasm.h"
+#include "uh_ble_conn.h"
+#include "uh_ble_conn_policy.h"
+#include "uh_ble_evt.h"
+#include "uh_ble_gap.h"
+#include "uh_ble_wl.h"
 
 
 /**************************************************************************************************/
 /*                                          外部引用声明                                          */
 /**************************************************************************************************/
-extern ble_adv_param_t ble_adv_param[APP_MAX_ADV_IDX];
 
 
 /**************************************************************************************************/
 /*                                           内部宏定义                                           */
 /**************************************************************************************************/
-#define UHOS_BLE_ADV_RPT_BUF_NUM            20                  //<! 广播上报事件缓存数组大小
+// 广播上报缓存大小，必须为2的幂；产品可通过sdkconfig覆盖
+#ifndef CONFIG_UHOS_BLE_ADV_RPT_BUF_NUM
+#define CONFIG_UHOS_BLE_ADV_RPT_BUF_NUM     64
+#endif
+
+// 单次回调批量上报的最大条数
+#ifndef CONFIG_UHOS_BLE_ADV_RPT_BATCH_MAX
+#define CONFIG_UHOS_BLE_ADV_RPT_BATCH_MAX   16
+#endif
+
+#define UHOS_BLE_ADV_RPT_BUF_NUM            CONFIG_UHOS_BLE_ADV_RPT_BUF_NUM     //<! 广播上报事件缓存数组大小
+#define UHOS_BLE_ADV_RPT_BUF_MASK           (UHOS_BLE_ADV_RPT_BUF_NUM - 1)
+#define UHOS_BLE_ADV_RPT_BATCH_MAX          CONFIG_UHOS_BLE_ADV_RPT_BATCH_MAX   //<! 单批次最大条数
+
+#if (UHOS_BLE_ADV_RPT_BUF_NUM < 2) || (UHOS_BLE_ADV_RPT_BUF_NUM & UHOS_BLE_ADV_RPT_BUF_MASK)
+#error "CONFIG_UHOS_BLE_ADV_RPT_BUF_NUM must be a power of 2"
+#endif
+
+#if (UHOS_BLE_ADV_RPT_BATCH_MAX < 1) || (UHOS_BLE_ADV_RPT_BATCH_MAX > 0xFFFF)
+#error "CONFIG_UHOS_BLE_ADV_RPT_BATCH_MAX out of range"
+#endif
 #define UHOS_BLE_MAC_REVERSE_ENABLE         1
 
 #define UHOS_BLE_MAX_ADV_DATA_LEN                    31                  //<! 广播数据最大长度
 #define UHOS_BLE_MAX_SCAN_RSP_DATA_LEN               31                  //<! 扫描响应数据最大长度
 
-#define UHOS_BLE_HANDLE_CONNECT_NUM                5
+#define UHOS_BLE_CONN_ADV_IDX               0                   //<! 可连接广播的索引
+
+// 扩展广播集个数，与协议栈的CONFIG_BT_BLE_ADV_SETS_NUM（缺省值）保持一致
+#ifndef CONFIG_UHOS_BLE_EXT_ADV_SET_NUM
+#define CONFIG_UHOS_BLE_EXT_ADV_SET_NUM     4
+#endif
+
+#define UHOS_BLE_EXT_ADV_TX_POWER_NONE      127                 //<! 发射功率由控制器决定
+#define UHOS_BLE_EXT_ADV_SID_MASK           0x0F                //<! SID取值范围0~15
 
 /**************************************************************************************************/
 /*                                        内部数据类型定义                                        */
 /**************************************************************************************************/
 /**
- * @enum        GAP层白名单操作类型枚举定义
+ * @enum        GAP层扫描状态枚举定义
+ */
+typedef enum uhos_ble_pal_gap_scan_state
+{
+    UHOS_BLE_PAL_GAP_SCAN_IDLE = 0,                             //<! 未扫描
+    UHOS_BLE_PAL_GAP_SCAN_LEGACY,                               //<! 传统扫描
+    UHOS_BLE_PAL_GAP_SCAN_EXT,                                  //<! 扩展扫描
+} uhos_ble_pal_gap_scan_state_t;
+
+/**
+ * @struct      GAP层扫描控制块
+ * @note        保存扫描参数，白名单同步暂停扫描后按原参数恢复
  */
-typedef enum uhos_ble_pal_gap_white_list_op
+typedef struct uhos_ble_pal_gap_scan_ctl
 {
-    UHOS_BLE_GAP_WHITE_LIST_ADD = 1,                            //<! 添加白名单
-    UHOS_BLE_GAP_WHITE_LIST_DEL,                                //<! 删除白名单
-    UHOS_BLE_GAP_WHITE_LIST_CLEAR                               //<! 清楚白名单
-} uhos_ble_pal_gap_white_list_op_t;
+    uhos_u8                       state;                        //<! 扫描状态，见uhos_ble_pal_gap_scan_state_t
+    uhos_bool                     wl_policy;                    //<! 是否使用控制器白名单过滤策略
+    uhos_u32                      start_time;                   //<! 本次启动扫描的时刻
+    uhos_u32                      duration_ms;                  //<! 本次扫描时长，0表示持续扫描
+    esp_ble_scan_params_t         params;                       //<! 传统扫描参数
+#ifdef CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+    esp_ble_ext_scan_params_t     ext_params;                   //<! 扩展扫描参数
+#endif
+} uhos_ble_pal_gap_scan_ctl_t;
 
 /**
- * @struct      GAP层白名单地址结构定义
+ * @struct      GAP层广播上报缓存单元
+ * @note        seq为单元序号：seq == pos 表示可写，seq == pos + 1 表示可读
  */
-typedef struct uhos_ble_pal_white_list_addr
+typedef struct uhos_ble_pal_gap_adv_rpt_cell
 {
-    uhos_ble_addr_type_t type;                                  //<! 地址类型
-    uhos_ble_addr_t      addr;                                  //<! 地址
-} uhos_ble_pal_white_list_addr_t;
+    uhos_u32                  seq;                              //<! 单元序号
+    uhos_u32                  time_us;                          //<! 写入时刻，用于统计投递时延
+    uhos_ble_gap_adv_report_t report;                           //<! 广播上报数据
+} uhos_ble_pal_gap_adv_rpt_cell_t;
 
 /**
  * @struct      GAP层广播上报事件控制块结构
+ * @note        多生产者单消费者无锁环形队列：协议栈回调（可能来自多个任务）写入，
+ *              ble_daemon任务批量读取；唤醒与其他用户回调事件共用事件队列的信号量
  */
 typedef struct uhos_ble_pal_gap_adv_rpt_ctl
 {
-    uhos_u8                  head;                              //<! 缓存数组头索引
-    uhos_u8                  tail;                              //<! 缓存数组尾索引
-    uhos_u16                 count;                             //<! 缓存计数
-    uhos_sem_t               event_sem_id;                      //<! 缓存同步信号量
-    uhos_ble_gap_evt_param_t item[UHOS_BLE_ADV_RPT_BUF_NUM];    //<! 广播事件缓存数组
+    uhos_u32                        head;                       //<! 读位置，仅消费者访问
+    uhos_u32                        tail;                       //<! 写位置，生产者原子竞争
+    uhos_u8                         batch_enable;               //<! 批量上报开关
+    uhos_bool                       draining;                   //<! 上一轮未取完，仅消费者访问
+    uhos_ble_gap_adv_report_stats_t stats;                      //<! 统计信息
+    uhos_ble_pal_gap_adv_rpt_cell_t cell[UHOS_BLE_ADV_RPT_BUF_NUM];         //<! 广播事件缓存数组
+    uhos_ble_gap_adv_report_t       batch[UHOS_BLE_ADV_RPT_BATCH_MAX];      //<! 批量投递缓存，仅消费者访问
 } uhos_ble_pal_gap_adv_rpt_ctl_t;
 
 /**
@@ -100,24 +158,6 @@ typedef struct uhos_ble_pal_gap_conn_info
     uhos_ble_gap_conn_param_t param;                            //<! 连接参数
 } uhos_ble_pal_gap_conn_info_t;
 
-/**
- * @struct      GAP层的全局控制数据结构
- */
-typedef struct uhos_ble_pal_gap_ctl
-{
-    uhos_u8                        adv_idx;                     //<! 广播索引，可连接/不可连接共2组
-    uhos_u8                        adv_flag;                    //<! 广播标志；1-开启，0-关闭
-    uhos_ble_gap_adv_param_t       adv_param;                   //<! 广播参数
-    uhos_ble_pal_gap_adv_data_t             adv_data;                    //<! 广播数据， 需要实现
-    uhos_ble_pal_gap_scan_rsp_data_t            scan_rsp_data;               //<! 扫描响应数据， 需要实现
-    uhos_ble_pal_gap_adv_rpt_ctl_t adv_rpt_ctl;                 //<! 广播上报事件控制块
-    uhos_u16                       conn_handle;                 //<! 连接句柄
-    uhos_u16                       conn_flag;                   //<! 连接标志；1-连接，0-断开
-    uhos_ble_pal_gap_conn_info_t   conn_info;                   //<! 连接信息
-    uhos_u16                       peer_mtu;                    //<! 对端的MTU
-
-} uhos_ble_pal_gap_ctl_t;
-
 /**
  * @struct GAP层的广播数据结构体     
  */
@@ -142,6 +182,26 @@ typedef struct uhos_ble_pal_gap_scan_rsp_data
 
 } uhos_ble_pal_gap_scan_rsp_data_t;
 
+/**
+ * @struct      GAP层的全局控制数据结构
+ */
+typedef struct uhos_ble_pal_gap_ctl
+{
+    uhos_u8                        adv_idx;                     //<! 广播索引，可连接/不可连接共2组
+    uhos_u8                        adv_flag;                    //<! 广播标志；1-开启，0-关闭
+    uhos_ble_gap_adv_param_t       adv_param;                   //<! 广播参数
+    uhos_ble_pal_gap_adv_data_t             adv_data;                    //<! 广播数据， 需要实现
+    uhos_ble_pal_gap_scan_rsp_data_t            scan_rsp_data;               //<! 扫描响应数据， 需要实现
+    uhos_ble_pal_gap_adv_rpt_ctl_t adv_rpt_ctl;                 //<! 广播上报事件控制块
+    uhos_u16                       conn_handle;                 //<! 连接句柄
+    uhos_u16                       conn_flag;                   //<! 连接标志；1-连接，0-断开
+    uhos_ble_pal_gap_conn_info_t   conn_info;                   //<! 连接信息
+    uhos_u16                       peer_mtu;                    //<! 对端的MTU
+    uhos_u32                       ext_legacy;                  //<! 扩展扫描中以传统PDU上报的广播条数
+    uhos_ble_pal_gap_scan_ctl_t    scan_ctl;                    //<! 扫描控制块
+
+} uhos_ble_pal_gap_ctl_t;
+
 /**************************************************************************************************/
 /*                                        全局(静态)变量                                          */
 /**************************************************************************************************/
@@ -151,8 +211,6 @@ uhos_ble_gap_cb_t      g_uhos_ble_pal_gap_user_cb = UHOS_NULL;  //<! GAP层应
 esp_gatt_if_t esp32_gatts_if = ESP_GATT_IF_NONE;
 esp_gatt_if_t esp32_gattc_if = ESP_GATT_IF_NONE;
 
-static struct gatts_connect_evt_param g_uhos_ble_connect[UHOS_BLE_HANDLE_CONNECT_NUM];
-
 /**************************************************************************************************/
 /*                                          内部函数原型                                          */
 /**************************************************************************************************/
@@ -175,72 +233,147 @@ static void uhos_ble_mac_reverse(uhos_u8 addr[], uhos_u8 size)
 /*                                          内部函数实现                                          */
 /**************************************************************************************************/
 /**
- * @brief       将广播上报事件插入到缓存数组中
- * @param[in]   item    广播上报事件
- * @return      执行结果；0-失败，1-成功
+ * @brief       初始化广播上报缓存，每个单元的序号置为其下标
  */
-static uhos_s32 uhos_ble_pal_gap_adv_rpt_add(uhos_ble_gap_evt_param_t *item)
+static void uhos_ble_pal_gap_adv_rpt_reset(void)
 {
     uhos_ble_pal_gap_adv_rpt_ctl_t *adv_rpt_ctl = &g_uhos_ble_pal_gap_ctl.adv_rpt_ctl;
+    uhos_u32                        i           = 0;
 
-    // 输入参数检查
-    if (UHOS_NULL == item)
+    for (i = 0; i < UHOS_BLE_ADV_RPT_BUF_NUM; i++)
     {
-        return (0);
+        __atomic_store_n(&adv_rpt_ctl->cell[i].seq, i, __ATOMIC_RELAXED);
     }
 
-    // 检查缓存数据是否溢出
-    if (adv_rpt_ctl->count >= UHOS_BLE_ADV_RPT_BUF_NUM)
+    adv_rpt_ctl->head     = 0;
+    adv_rpt_ctl->draining = UHOS_FALSE;
+    __atomic_store_n(&adv_rpt_ctl->tail, 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief       将广播上报事件插入到缓存数组中（可由多个任务并发调用）
+ * @param[in]   report  广播上报数据
+ * @return      执行结果；0-失败（缓存已满，计入丢弃），1-成功
+ */
+static uhos_s32 uhos_ble_pal_gap_adv_rpt_add(const uhos_ble_gap_adv_report_t *report)
+{
+    uhos_ble_pal_gap_adv_rpt_ctl_t  *adv_rpt_ctl = &g_uhos_ble_pal_gap_ctl.adv_rpt_ctl;
+    uhos_ble_pal_gap_adv_rpt_cell_t *cell        = UHOS_NULL;
+    uhos_u32                         pos         = 0;
+    uhos_u32                         seq         = 0;
+    uhos_s32                         dif         = 0;
+
+    // 输入参数检查
+    if (UHOS_NULL == report)
     {
         return (0);
     }
 
-    // 保存广播上报事件数据
-    uhos_libc_memcpy(&adv_rpt_ctl->item[adv_rpt_ctl->tail++],
-                     item,
-                     sizeof(uhos_ble_gap_evt_param_t));
+    __atomic_fetch_add(&adv_rpt_ctl->stats.received, 1, __ATOMIC_RELAXED);
+
+    // 抢占一个可写单元
+    pos = __atomic_load_n(&adv_rpt_ctl->tail, __ATOMIC_RELAXED);
+    for (;;)
+    {
+        cell = &adv_rpt_ctl->cell[pos & UHOS_BLE_ADV_RPT_BUF_MASK];
+        seq  = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE);
+        dif  = (uhos_s32)(seq - pos);
+
+        if (0 == dif)
+        {
+            if (__atomic_compare_exchange_n(&adv_rpt_ctl->tail, &pos, pos + 1, UHOS_TRUE,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if (dif < 0)
+        {
+            // 缓存已满，丢弃本条
+            __atomic_fetch_add(&adv_rpt_ctl->stats.dropped, 1, __ATOMIC_RELAXED);
+            return (0);
+        }
+        else
+        {
+            pos = __atomic_load_n(&adv_rpt_ctl->tail, __ATOMIC_RELAXED);
+        }
+    }
 
-    // 调整缓存数组的控制信息
-    adv_rpt_ctl->tail = (adv_rpt_ctl->tail) % UHOS_BLE_ADV_RPT_BUF_NUM;
-    adv_rpt_ctl->count++;
+    // 保存广播上报事件数据并发布
+    uhos_libc_memcpy(&cell->report, report, sizeof(uhos_ble_gap_adv_report_t));
+    cell->time_us = uhos_ble_pal_evt_now_us();
+    __atomic_store_n(&cell->seq, pos + 1, __ATOMIC_RELEASE);
 
-    // 释放同步信号量
-    uhos_sem_release(adv_rpt_ctl->event_sem_id);
+    uhos_ble_pal_evt_wake();
 
     return (1);
 }
 
 /**
- * @brief       从缓存池中获取一条GAP层的事件数据，该事件是扫描报告数据
- * @param[out]  item    gap层事件数据
+ * @brief       从缓存池中获取一条广播上报数据（仅ble_daemon任务调用）
+ * @param[out]  report  广播上报数据
+ * @param[out]  time_us 写入时刻
  * @return      0-获取失败，1-获取成功
  */
-static uhos_s32 uhos_ble_pal_gap_adv_rpt_get(uhos_ble_gap_evt_param_t *item)
+static uhos_s32 uhos_ble_pal_gap_adv_rpt_get(uhos_ble_gap_adv_report_t *report, uhos_u32 *time_us)
 {
-    uhos_ble_pal_gap_adv_rpt_ctl_t *adv_rpt_ctl = &g_uhos_ble_pal_gap_ctl.adv_rpt_ctl;
+    uhos_ble_pal_gap_adv_rpt_ctl_t  *adv_rpt_ctl = &g_uhos_ble_pal_gap_ctl.adv_rpt_ctl;
+    uhos_ble_pal_gap_adv_rpt_cell_t *cell        = UHOS_NULL;
+    uhos_u32                         pos         = adv_rpt_ctl->head;
 
-    if (UHOS_NULL == item)
+    if (UHOS_NULL == report)
     {
         return (0);
     }
 
-    if (0 == adv_rpt_ctl->count)
+    cell = &adv_rpt_ctl->cell[pos & UHOS_BLE_ADV_RPT_BUF_MASK];
+    if ((uhos_s32)(__atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE) - (pos + 1)) < 0)
     {
         return (0);
     }
 
-    //uh_k_irq_lock(0);
+    uhos_libc_memcpy(report, &cell->report, sizeof(uhos_ble_gap_adv_report_t));
+    *time_us = cell->time_us;
+
+    // 归还单元，供下一轮写入
+    __atomic_store_n(&cell->seq, pos + UHOS_BLE_ADV_RPT_BUF_NUM, __ATOMIC_RELEASE);
+    adv_rpt_ctl->head = pos + 1;
 
-    uhos_libc_memcpy(item,
-                     &adv_rpt_ctl->item[adv_rpt_ctl->head++],
-                     sizeof(uhos_ble_gap_evt_param_t));
+    return (1);
+}
+
+/**
+ * @brief       将本批次的广播数据投递给用户回调
+ * @param[in]   num     本批次条数
+ */
+static void uhos_ble_pal_gap_adv_rpt_deliver(uhos_u16 num)
+{
+    uhos_ble_pal_gap_adv_rpt_ctl_t *adv_rpt_ctl = &g_uhos_ble_pal_gap_ctl.adv_rpt_ctl;
+    uhos_ble_gap_evt_param_t        evt_param   = {0};
+    uhos_u16                        i           = 0;
 
-    adv_rpt_ctl->head = (adv_rpt_ctl->head) % UHOS_BLE_ADV_RPT_BUF_NUM;
-    adv_rpt_ctl->count--;
+    if (adv_rpt_ctl->batch_enable)
+    {
+        evt_param.batch.num     = num;
+        evt_param.batch.reports = adv_rpt_ctl->batch;
+        g_uhos_ble_pal_gap_user_cb(UHOS_BLE_GAP_EVT_ADV_REPORT_BATCH, &evt_param);
+    }
+    else
+    {
+        for (i = 0; i < num; i++)
+        {
+            uhos_libc_memcpy(&evt_param.report, &adv_rpt_ctl->batch[i], sizeof(uhos_ble_gap_adv_report_t));
+            g_uhos_ble_pal_gap_user_cb(UHOS_BLE_GAP_EVT_ADV_REPORT, &evt_param);
+        }
+    }
 
-    //uh_k_irq_unlock(0, 0);
+    __atomic_fetch_add(&adv_rpt_ctl->stats.delivered, num, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&adv_rpt_ctl->stats.batches, 1, __ATOMIC_RELAXED);
 
-    return (1);
+    if (num > adv_rpt_ctl->stats.max_batch)
+    {
+        adv_rpt_ctl->stats.max_batch = num;
+    }
 }
 
 /**
@@ -258,16 +391,30 @@ static void uhos_ble_pal_gap_scan_cb(void *adv_ind, void *rsp_ind) //这个函
     adv_report_src = (esp_ble_gap_cb_param_t *)adv_ind;
     type           = adv_report_src->scan_rst.search_evt & ESP_GAP_SEARCH_INQ_RES_EVT;
 
+    // 白名单超过控制器容量时由主机侧过滤
+    if (uhos_ble_pal_wl_host_drop(adv_report_src->scan_rst.bda))
+    {
+        return;
+    }
+
     // 生成广播上报事件
     uhos_libc_memcpy(&evt_param.report.peer_addr,
                      adv_report_src->scan_rst.bda,
                      ESP_BD_ADDR_LEN);
 
 #if UHOS_BLE_MAC_REVERSE_ENABLE
-    uhos_ble_mac_reverse(&evt_param.report.peer_addr, ESP_BD_ADDR_LEN);
+    uhos_ble_mac_reverse(evt_param.report.peer_addr, ESP_BD_ADDR_LEN);
 #endif
 
-    evt_param.report.addr_type = adv_report_src->scan_rst.ble_addr_type;
+    // 透传规则直接在原始AD数据上匹配，不匹配的广播不做拷贝
+    if (!uhos_ble_pal_adv_filter_match(evt_param.report.peer_addr,
+                                       adv_report_src->scan_rst.ble_adv,
+                                       adv_report_src->scan_rst.adv_data_len + adv_report_src->scan_rst.scan_rsp_len))
+    {
+        return;
+    }
+
+    evt_param.report.addr_type = (uhos_ble_addr_type_t)adv_report_src->scan_rst.ble_addr_type;
 
     if (type == ESP_GAP_SEARCH_INQ_RES_EVT)
     {
@@ -287,95 +434,181 @@ static void uhos_ble_pal_gap_scan_cb(void *adv_ind, void *rsp_ind) //这个函
 
     evt_param.report.rssi = adv_report_src->scan_rst.rssi;
     
+    // 重复的广播数据不再入队
+    if (!uhos_ble_pal_adv_cache_check(&evt_param.report))
+    {
+        return;
+    }
+
     // 将广播上报事件放入缓存
-    uhos_ble_pal_gap_adv_rpt_add(&evt_param);
+    uhos_ble_pal_gap_adv_rpt_add(&evt_param.report);
 
     return;
 }
 
+#ifdef CONFIG_BT_BLE_50_FEATURES_SUPPORTED
 /**
- * @brief       GAP层白名单操作的实现
- * @param[in]   op      操作类型
- * @param[in]   address 白名单地址
- * @return      操作结果
+ * @brief       扩展扫描上报的处理实现
+ * @note        传统PDU转换为普通广播上报，经去重后放入广播上报缓存；
+ *              扩展PDU交给分段重组，整条完成后唤醒ble_daemon任务投递
+ * @param[in]   ext_rpt     协议栈上报的扩展广播（可能只是广播链中的一段）
  */
-static uhos_ble_status_t uhos_ble_pal_gap_set_white_list(
-    uhos_ble_pal_gap_white_list_op_t      op,
-    const uhos_ble_pal_white_list_addr_t *address)
+static void uhos_ble_pal_gap_ext_scan_cb(const esp_ble_gap_ext_adv_reprot_t *ext_rpt)
 {
-    esp_ble_wl_addr_type_t wl_addr_type;
+    uhos_ble_gap_adv_report_t       report = {0};
+    uhos_ble_gap_ext_adv_report_t   frag   = {0};
+    uhos_ble_pal_adv_reasm_status_t status = UHOS_BLE_PAL_ADV_REASM_COMPLETE;
+    uhos_ble_gap_adv_data_type_t    type   = ADV_DATA;
 
-    if (false == uhos_ble_is_inited())
+    type = (ext_rpt->event_type & ESP_BLE_GAP_ADV_REPORT_EXT_SCAN_RSP) ? SCAN_RSP_DATA : ADV_DATA;
+
+    if (uhos_ble_pal_wl_host_drop(ext_rpt->addr))
     {
-        UHOS_LOGW("ble not inited");
-        return UHOS_BLE_ERROR;
+        return;
     }
 
-    /**地址类型 */
-    if(address->type == UHOS_BLE_ADDRESS_TYPE_PUBLIC)
+    if (ext_rpt->event_type & ESP_BLE_GAP_ADV_REPORT_LEGACY_ADV)
     {
-        wl_addr_type = BLE_WL_ADDR_TYPE_PUBLIC;
+        uhos_libc_memcpy(report.peer_addr, ext_rpt->addr, ESP_BD_ADDR_LEN);
+#if UHOS_BLE_MAC_REVERSE_ENABLE
+        uhos_ble_mac_reverse(report.peer_addr, ESP_BD_ADDR_LEN);
+#endif
+
+        report.data_len = (ext_rpt->adv_data_len > sizeof(report.data)) ? sizeof(report.data) : ext_rpt->adv_data_len;
+        if (!uhos_ble_pal_adv_filter_match(report.peer_addr, ext_rpt->adv_data, report.data_len))
+        {
+            return;
+        }
+
+        report.addr_type = (uhos_ble_addr_type_t)ext_rpt->addr_type;
+        report.adv_type  = type;
+        report.rssi      = ext_rpt->rssi;
+        uhos_libc_memcpy(report.data, ext_rpt->adv_data, report.data_len);
+
+        if (!uhos_ble_pal_adv_cache_check(&report))
+        {
+            return;
+        }
+
+        __atomic_fetch_add(&g_uhos_ble_pal_gap_ctl.ext_legacy, 1, __ATOMIC_RELAXED);
+        uhos_ble_pal_gap_adv_rpt_add(&report);
+        return;
     }
-    else
+
+    uhos_libc_memcpy(frag.peer_addr, ext_rpt->addr, ESP_BD_ADDR_LEN);
+#if UHOS_BLE_MAC_REVERSE_ENABLE
+    uhos_ble_mac_reverse(frag.peer_addr, ESP_BD_ADDR_LEN);
+#endif
+
+    frag.addr_type     = (uhos_ble_addr_type_t)ext_rpt->addr_type;
+    frag.adv_type      = type;
+    frag.event_type    = ext_rpt->event_type;
+    frag.primary_phy   = (uhos_ble_gap_phy_t)ext_rpt->primary_phy;
+    frag.secondary_phy = (uhos_ble_gap_phy_t)ext_rpt->secondly_phy;
+    frag.sid           = ext_rpt->sid;
+    frag.tx_power      = (uhos_s8)ext_rpt->tx_power;
+    frag.rssi          = ext_rpt->rssi;
+    frag.data          = ext_rpt->adv_data;
+    frag.data_len      = ext_rpt->adv_data_len;
+
+    if (ESP_BLE_GAP_EXT_ADV_DATA_INCOMPLETE == ext_rpt->data_status)
+    {
+        status = UHOS_BLE_PAL_ADV_REASM_MORE;
+    }
+    else if (ESP_BLE_GAP_EXT_ADV_DATA_TRUNCATED == ext_rpt->data_status)
     {
-        wl_addr_type = BLE_WL_ADDR_TYPE_RANDOM;
+        status = UHOS_BLE_PAL_ADV_REASM_TRUNCATED;
     }
 
-    switch (op)
+    if (uhos_ble_pal_adv_reasm_add(&frag, status))
     {
-        case UHOS_BLE_GAP_WHITE_LIST_ADD:
-        {
-            int          retval;
+        uhos_ble_pal_evt_wake();
+    }
+}
+#endif
 
-            retval = esp_ble_gap_update_whitelist(true, address.addr, wl_addr_type);
+/**
+ * @brief       投递重组完成的扩展广播（仅ble_daemon任务调用）
+ * @note        透传规则在完整载荷上匹配，不匹配的直接归还重组槽
+ */
+static void uhos_ble_pal_gap_ext_rpt_deliver(void)
+{
+    uhos_ble_gap_evt_param_t evt_param = {0};
 
-            if (ESP_OK  != retval)
+    while (uhos_ble_pal_adv_reasm_get(&evt_param.ext_report))
+    {
+        if (uhos_ble_pal_adv_filter_match(evt_param.ext_report.peer_addr, evt_param.ext_report.data,
+                                          evt_param.ext_report.data_len))
+        {
+            uhos_ble_pal_adv_pack_ext_add(&evt_param.ext_report);
+            if (UHOS_NULL != g_uhos_ble_pal_gap_user_cb)
             {
-                UHOS_LOGE("ble white list add fail, 0x%4x", retval);
-                return UHOS_BLE_ERROR;
+                g_uhos_ble_pal_gap_user_cb(UHOS_BLE_GAP_EVT_EXT_ADV_REPORT, &evt_param);
             }
-
-            break;
         }
 
-        case UHOS_BLE_GAP_WHITE_LIST_DEL:
-        {
-            int          retval;
-
-            retval  = esp_ble_gap_update_whitelist(false, address.addr, wl_addr_type);
+        uhos_ble_pal_adv_reasm_put(&evt_param.ext_report);
+    }
+}
 
-            if (ESP_OK  != retval)
-            {
-                UHOS_LOGE("ble white list del fail, 0x%4x", retval);
-                return UHOS_BLE_ERROR;
-            }
+/**
+ * @brief       按保存的扫描参数启动扫描
+ * @param[in]   wl_policy   是否使用控制器白名单过滤策略
+ * @param[in]   duration_ms 扫描时长（毫秒），0表示持续扫描
+ * @return      uhos_ble_status_t 执行结果
+ */
+static uhos_ble_status_t uhos_ble_pal_gap_scan_run(uhos_bool wl_policy, uhos_u32 duration_ms)
+{
+    uhos_ble_pal_gap_scan_ctl_t *scan_ctl = &g_uhos_ble_pal_gap_ctl.scan_ctl;
+    esp_ble_scan_filter_t        policy   = wl_policy ? BLE_SCAN_FILTER_ALLOW_ONLY_WLST : BLE_SCAN_FILTER_ALLOW_ALL;
+    esp_err_t                    ret      = 0;
 
-            break;
+    if (UHOS_BLE_PAL_GAP_SCAN_LEGACY == scan_ctl->state)
+    {
+        scan_ctl->params.scan_filter_policy = policy;
+        ret = esp_ble_gap_set_scan_params(&scan_ctl->params);
+        if (ret){
+            UHOS_LOGE("esp_ble_gap_set_scan_params failed, error code = %x ", ret);
+            return UHOS_BLE_ERROR;
         }
 
-        case UHOS_BLE_GAP_WHITE_LIST_CLEAR:
-        {
-            int retval = esp_ble_gap_clear_whitelist();
-
-            if (ESP_OK != retval)
-            {
-                UHOS_LOGE("ble white list clear fail, 0x%4x", retval);
-                return UHOS_BLE_ERROR;
-            }
-
-            break;
+        // 协议栈单位1s，不足1s按1s计
+        ret = esp_ble_gap_start_scanning((duration_ms + 999) / 1000);
+        if (ret){
+            UHOS_LOGE("esp_ble_gap_start_scanning failed, error code = %x ", ret);
+            return UHOS_BLE_ERROR;
+        }
+    }
+#ifdef CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+    else if (UHOS_BLE_PAL_GAP_SCAN_EXT == scan_ctl->state)
+    {
+        scan_ctl->ext_params.filter_policy = policy;
+        ret = esp_ble_gap_set_ext_scan_params(&scan_ctl->ext_params);
+        if (ret){
+            UHOS_LOGE("esp_ble_gap_set_ext_scan_params failed, error code = %x ", ret);
+            return UHOS_BLE_ERROR;
         }
 
-        default:
-        {
-            UHOS_LOGW("ble white list op 0x%4x unknown", op);
-            break;
+        // 协议栈单位10ms
+        ret = esp_ble_gap_start_ext_scan((duration_ms + 9) / 10, 0);
+        if (ret){
+            UHOS_LOGE("esp_ble_gap_start_ext_scan failed, error code = %x ", ret);
+            return UHOS_BLE_ERROR;
         }
     }
+#endif
+    else
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    scan_ctl->wl_policy   = wl_policy;
+    scan_ctl->start_time  = uhos_current_time_get();
+    scan_ctl->duration_ms = duration_ms;
 
     return UHOS_BLE_SUCCESS;
 }
-    
+
 /**
  * @brief       断连事件的处理实现
  * @param[in]   param   事件参数
@@ -494,8 +727,83 @@ static void uhos_ble_pal_gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble
         UHOS_LOGE("ESP_GAP_BLE_ADV_STOP_COMPLETE_EVT");
         break;
     case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
-        UHOS_LOGE("ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT");
+        UHOS_LOGI("ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT, status %d int %d", param->update_conn_params.status,
+                  param->update_conn_params.conn_int);
+        if (ESP_BT_STATUS_SUCCESS == param->update_conn_params.status)
+        {
+            uhos_ble_pal_conn_params_update(param->update_conn_params.bda, param->update_conn_params.conn_int,
+                                            param->update_conn_params.latency);
+        }
+        uhos_ble_pal_conn_policy_updated(param->update_conn_params.bda,
+                                         (ESP_BT_STATUS_SUCCESS == param->update_conn_params.status));
+        break;
+    case ESP_GAP_BLE_SET_PKT_LENGTH_COMPLETE_EVT:
+        UHOS_LOGI("ESP_GAP_BLE_SET_PKT_LENGTH_COMPLETE_EVT, status %d tx %d rx %d", param->pkt_data_length_cmpl.status,
+                  param->pkt_data_length_cmpl.params.tx_len, param->pkt_data_length_cmpl.params.rx_len);
+        break;
+    case ESP_GAP_BLE_SCAN_RESULT_EVT:
+        if (ESP_GAP_SEARCH_INQ_RES_EVT == param->scan_rst.search_evt)
+        {
+            uhos_ble_pal_gap_scan_cb(param, UHOS_NULL);
+        }
+        else if ((ESP_GAP_SEARCH_INQ_CMPL_EVT == param->scan_rst.search_evt) &&
+                 (UHOS_BLE_PAL_GAP_SCAN_LEGACY == g_uhos_ble_pal_gap_ctl.scan_ctl.state))
+        {
+            g_uhos_ble_pal_gap_ctl.scan_ctl.state = UHOS_BLE_PAL_GAP_SCAN_IDLE;
+        }
+        break;
+    case ESP_GAP_BLE_SCAN_START_COMPLETE_EVT:
+        if (ESP_BT_STATUS_SUCCESS == param->scan_start_cmpl.status)
+        {
+            uhos_ble_pal_wl_scan_started();
+        }
+        break;
+    case ESP_GAP_BLE_UPDATE_WHITELIST_COMPLETE_EVT:
+        UHOS_LOGD("white list op %d, status %d", param->update_whitelist_cmpl.wl_operation,
+                  param->update_whitelist_cmpl.status);
+        uhos_ble_pal_wl_update_done(ESP_BT_STATUS_SUCCESS == param->update_whitelist_cmpl.status);
+        break;
+#ifdef CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+    case ESP_GAP_BLE_EXT_ADV_REPORT_EVT:
+        uhos_ble_pal_gap_ext_scan_cb(&param->ext_adv_report.params);
+        break;
+    case ESP_GAP_BLE_EXT_ADV_SET_PARAMS_COMPLETE_EVT:
+        UHOS_LOGD("ext adv %d set params, status %d", param->ext_adv_set_params.instance,
+                  param->ext_adv_set_params.status);
+        break;
+    case ESP_GAP_BLE_EXT_ADV_DATA_SET_COMPLETE_EVT:
+        UHOS_LOGD("ext adv %d set data, status %d", param->ext_adv_data_set.instance, param->ext_adv_data_set.status);
+        break;
+    case ESP_GAP_BLE_EXT_SCAN_RSP_DATA_SET_COMPLETE_EVT:
+        UHOS_LOGD("ext adv %d set scan rsp, status %d", param->scan_rsp_set.instance, param->scan_rsp_set.status);
+        break;
+    case ESP_GAP_BLE_EXT_ADV_START_COMPLETE_EVT:
+        UHOS_LOGI("ext adv start, status %d", param->ext_adv_start.status);
+        break;
+    case ESP_GAP_BLE_EXT_ADV_STOP_COMPLETE_EVT:
+        UHOS_LOGI("ext adv stop, status %d", param->ext_adv_stop.status);
+        break;
+    case ESP_GAP_BLE_ADV_TERMINATED_EVT:
+        UHOS_LOGI("ext adv %d terminated, status 0x%02x", param->adv_terminate.adv_instance,
+                  param->adv_terminate.status);
+        break;
+    case ESP_GAP_BLE_EXT_SCAN_START_COMPLETE_EVT:
+        UHOS_LOGI("ext scan start, status %d", param->ext_scan_start.status);
+        if (ESP_BT_STATUS_SUCCESS == param->ext_scan_start.status)
+        {
+            uhos_ble_pal_wl_scan_started();
+        }
+        break;
+    case ESP_GAP_BLE_SCAN_TIMEOUT_EVT:
+        if (UHOS_BLE_PAL_GAP_SCAN_EXT == g_uhos_ble_pal_gap_ctl.scan_ctl.state)
+        {
+            g_uhos_ble_pal_gap_ctl.scan_ctl.state = UHOS_BLE_PAL_GAP_SCAN_IDLE;
+        }
         break;
+    case ESP_GAP_BLE_EXT_SCAN_STOP_COMPLETE_EVT:
+        UHOS_LOGI("ext scan stop, status %d", param->ext_scan_stop.status);
+        break;
+#endif
     default:
         break;
     }
@@ -511,21 +819,22 @@ void uhos_ble_pal_gap_init(void)
     uhos_libc_memset(&g_uhos_ble_pal_gap_ctl, 0, sizeof(uhos_ble_pal_gap_ctl_t));
 
     // 默认使用可连接广播的索引
-    g_uhos_ble_pal_gap_ctl.adv_idx = APP_CONN_ADV_IDX;
+    g_uhos_ble_pal_gap_ctl.adv_idx = UHOS_BLE_CONN_ADV_IDX;
 
-    // 创建广播上报事件的同步信号量
-    if (UHOS_SUCCESS != uhos_sem_create(&g_uhos_ble_pal_gap_ctl.adv_rpt_ctl.event_sem_id, 0))
-    {
-        UHOS_LOGE("create sem err");
-    }
+    // 初始化广播上报缓存
+    uhos_ble_pal_gap_adv_rpt_reset();
+    uhos_ble_pal_adv_cache_init();
+    uhos_ble_pal_adv_filter_init();
+    uhos_ble_pal_adv_pack_init();
+    uhos_ble_pal_adv_reasm_init();
+    uhos_ble_pal_wl_init();
+    g_uhos_ble_pal_gap_ctl.adv_rpt_ctl.stats.capacity = UHOS_BLE_ADV_RPT_BUF_NUM;
 
     // 设置协议栈回调函数
     ret = esp_ble_gap_register_callback(uhos_ble_pal_gap_event_handler);
     if (ret){
         UHOS_LOGE("esp_ble_gap_register_callback, error code = %x", ret);
-        return UHOS_BLE_ERROR;
     }
-    return UHOS_BLE_SUCCESS;
 }
 
 /**
@@ -539,80 +848,276 @@ void uhos_ble_pal_gap_deinit(void)
     ret = esp_ble_gap_register_callback(UHOS_NULL);
     if (ret){
         UHOS_LOGE("uhos_ble_pal_gap_deinit fail, error code = %x", ret);
-        return UHOS_BLE_ERROR;
     }
-    return UHOS_BLE_SUCCESS;
 }
 
 /**
- * @brief       处理扫描事件数据
+ * @brief       处理扫描事件数据（仅ble_daemon任务调用，不阻塞）
+ * @note        每次从缓存中取出一个批次（最多UHOS_BLE_ADV_RPT_BATCH_MAX条）投递，
+ *              让出给优先级更高的用户回调事件；随后投递重组完成的扩展广播
+ * @return      UHOS_TRUE-缓存中仍有广播待投递
  */
-void uhos_ble_pal_gap_adv_rpt_handle(uhos_u32 timeout)
+uhos_bool uhos_ble_pal_gap_adv_rpt_handle(void)
 {
-    uhos_ble_gap_evt_param_t item = {0};
+    uhos_ble_pal_gap_adv_rpt_ctl_t *adv_rpt_ctl = &g_uhos_ble_pal_gap_ctl.adv_rpt_ctl;
+    uhos_u32                        first_us    = 0;
+    uhos_u32                        time_us     = 0;
+    uhos_u32                        start_us    = 0;
+    uhos_u16                        num         = 0;
+    uhos_u16                        i           = 0;
 
-    // 信号量未就绪，等待
-    if (UHOS_NULL == g_uhos_ble_pal_gap_ctl.adv_rpt_ctl.event_sem_id)
+    while ((num < UHOS_BLE_ADV_RPT_BATCH_MAX) && uhos_ble_pal_gap_adv_rpt_get(&adv_rpt_ctl->batch[num], &time_us))
     {
-        UHOS_LOGW("ble adv rpt sem is null");
-        uhos_thread_sleep(timeout);
-        return;
+        if (0 == num)
+        {
+            first_us = time_us;
+        }
+        num++;
     }
 
-    // 阻塞在同步信号量上，等待广播上报数据
-    if (UHOS_SUCCESS == uhos_sem_wait(g_uhos_ble_pal_gap_ctl.adv_rpt_ctl.event_sem_id, timeout))
+    if (0 != num)
     {
-        if (UHOS_NULL == g_uhos_ble_pal_gap_user_cb)
+        // 一次唤醒内连续的批次只计一次
+        if (!adv_rpt_ctl->draining)
         {
-            UHOS_LOGW("user gap cb is null");
-            return;
+            __atomic_fetch_add(&adv_rpt_ctl->stats.wakeups, 1, __ATOMIC_RELAXED);
+        }
+
+        // 透传打包与用户回调各自消费同一批次
+        for (i = 0; i < num; i++)
+        {
+            uhos_ble_pal_adv_pack_add(&adv_rpt_ctl->batch[i]);
         }
 
-        if (uhos_ble_pal_gap_adv_rpt_get(&item))
+        if (UHOS_NULL != g_uhos_ble_pal_gap_user_cb)
         {
-            g_uhos_ble_pal_gap_user_cb(UHOS_BLE_GAP_EVT_ADV_REPORT, &item);
+            start_us = uhos_ble_pal_evt_now_us();
+            uhos_ble_pal_gap_adv_rpt_deliver(num);
+            uhos_ble_pal_evt_record(UHOS_BLE_EVENT_TYPE_ADV_REPORT, num, start_us - first_us,
+                                    uhos_ble_pal_evt_now_us() - start_us);
         }
     }
 
-    return;
+    uhos_ble_pal_gap_ext_rpt_deliver();
+
+    adv_rpt_ctl->draining = (UHOS_BLE_ADV_RPT_BATCH_MAX == num);
+
+    return adv_rpt_ctl->draining;
 }
 
 /**
- * @brief       设置广播相关的数据
- * @param[in]   p_data     广播数据
- * @param[in]   dlen       广播数据长度
- * @param[in]   p_sr_data  扫描响应数据
- * @param[in]   srdlen     扫描响应数据长度
- * @return      uplus_ble_status_t 执行结果
+ * @brief       根据连接/断连事件更新GAP层记录的连接信息
  */
-uhos_ble_status_t uhos_ble_gap_adv_data_set(
-    uhos_u8 const *p_data,
-    uhos_u8        dlen,
-    uhos_u8 const *p_sr_data,
-    uhos_u8        srdlen)
+static void uhos_ble_pal_gap_conn_state_update(uhos_ble_gap_evt_t event, const uhos_ble_gap_evt_param_t *param)
 {
-    // 局部变量
-    uhos_ble_pal_gap_adv_data_t  *adv_data_ptr      = &g_uhos_ble_pal_gap_ctl.adv_data;
-    uhos_ble_pal_gap_scan_rsp_data_t *scan_rsp_data_ptr = &g_uhos_ble_pal_gap_ctl.scan_rsp_data;
-    uhos_u8              adv_idx           = g_uhos_ble_pal_gap_ctl.adv_idx;
+    uhos_ble_pal_gap_ctl_t *gap_ctl = &g_uhos_ble_pal_gap_ctl;
 
-    // 输入参数检查
-    if ((UHOS_NULL == p_data) || (dlen < 3))
+    if (UHOS_BLE_GAP_EVT_CONNECTED == event)
     {
-        UHOS_LOGE("adv data invalid");
-        return UHOS_BLE_ERROR;
+        gap_ctl->conn_flag   = 1;
+        gap_ctl->conn_handle = param->conn_handle;
+        uhos_libc_memcpy(&gap_ctl->conn_info, &param->connect, sizeof(uhos_ble_pal_gap_conn_info_t));
+    }
+    else if (gap_ctl->conn_handle == param->conn_handle)
+    {
+        gap_ctl->conn_flag   = 0;
+        gap_ctl->conn_handle = 0;
+        uhos_libc_memset(&gap_ctl->conn_info, 0, sizeof(uhos_ble_pal_gap_conn_info_t));
     }
+}
 
-    // 拷贝广播数据（去除头3个字节）  
-    adv_data_ptr->adv_data_len  = dlen;
-    uhos_libc_memcpy(adv_data_ptr->raw_adv_data, p_data, dlen);
+/**
+ * @brief       投递连接/断连事件给用户回调（ble_daemon任务）
+ */
+static void uhos_ble_pal_gap_conn_evt_handle(uhos_ble_pal_evt_t *evt)
+{
+    uhos_ble_pal_gap_conn_state_update(evt->gap.evt, &evt->gap.param);
 
-    // 拷贝扫描响应数据（如果有）
-    scan_rsp_data_ptr->scan_rsp_data_len = srdlen;
+    if (UHOS_NULL != g_uhos_ble_pal_gap_user_cb)
+    {
+        g_uhos_ble_pal_gap_user_cb(evt->gap.evt, &evt->gap.param);
+    }
+}
 
-    if (0 != srdlen)
+/**
+ * @brief       连接/断连事件入队
+ * @note        使用预分配的事件，不受内存不足影响；队列未运行（ble_daemon任务已停止）或同类事件
+ *              全部在排队时只更新连接信息，丢弃用户回调并计数
+ */
+static void uhos_ble_pal_gap_conn_evt_post(uhos_ble_gap_evt_t event, const uhos_ble_gap_evt_param_t *param)
+{
+    uhos_ble_pal_evt_t *evt = uhos_ble_pal_evt_conn_alloc(param->conn_handle, UHOS_BLE_GAP_EVT_DISCONNET == event);
+
+    if (UHOS_NULL == evt)
     {
-        uhos_libc_memcpy(scan_rsp_data_ptr->raw_scan_rsp_data, p_sr_data, srdlen);
+        UHOS_LOGE("conn %d evt %d dropped", param->conn_handle, event);
+        uhos_ble_pal_gap_conn_state_update(event, param);
+        uhos_ble_pal_evt_drop(UHOS_BLE_EVENT_TYPE_CONN);
+        return;
+    }
+
+    evt->gap.evt = event;
+    evt->flush   = (UHOS_BLE_GAP_EVT_DISCONNET == event);
+    uhos_libc_memcpy(&evt->gap.param, param, sizeof(uhos_ble_gap_evt_param_t));
+    uhos_ble_pal_evt_post(evt, uhos_ble_pal_gap_conn_evt_handle);
+}
+
+/**
+ * @brief       上报连接事件
+ */
+void uhos_ble_pal_gap_conn_report(uhos_u16 conn_id, const uhos_u8 *bda, uhos_ble_gap_role_t role,
+                                  uhos_u16 interval, uhos_u16 latency, uhos_u16 timeout)
+{
+    uhos_ble_gap_evt_param_t evt_param = {0};
+
+    evt_param.conn_handle = conn_id;
+    uhos_libc_memcpy(evt_param.connect.peer_addr, bda, ESP_BD_ADDR_LEN);
+#if UHOS_BLE_MAC_REVERSE_ENABLE
+    uhos_ble_mac_reverse(evt_param.connect.peer_addr, ESP_BD_ADDR_LEN);
+#endif
+    evt_param.connect.type                         = UHOS_BLE_ADDRESS_TYPE_PUBLIC;
+    evt_param.connect.role                         = role;
+    evt_param.connect.conn_param.min_conn_interval = interval;
+    evt_param.connect.conn_param.max_conn_interval = interval;
+    evt_param.connect.conn_param.slave_latency     = latency;
+    evt_param.connect.conn_param.conn_sup_timeout  = timeout;
+
+    uhos_ble_pal_gap_conn_evt_post(UHOS_BLE_GAP_EVT_CONNECTED, &evt_param);
+}
+
+/**
+ * @brief       上报断连事件
+ */
+void uhos_ble_pal_gap_disconn_report(uhos_u16 conn_id, uhos_u16 reason)
+{
+    uhos_ble_gap_evt_param_t evt_param = {0};
+
+    evt_param.conn_handle = conn_id;
+    switch (reason)
+    {
+    case 0x08: // HCI Connection Timeout
+        evt_param.disconnect.reason = UHOS_BLE_CONNECTION_TIMEOUT;
+        break;
+    case 0x13: // HCI Remote User Terminated Connection
+        evt_param.disconnect.reason = UHOS_BLE_REMOTE_USER_TERMINATED;
+        break;
+    case 0x16: // HCI Connection Terminated By Local Host
+        evt_param.disconnect.reason = UHOS_BLE_LOCAL_HOST_TERMINATED;
+        break;
+    default:
+        evt_param.disconnect.reason = UNKNOW_OTHER_ERROR;
+        break;
+    }
+
+    uhos_ble_pal_gap_conn_evt_post(UHOS_BLE_GAP_EVT_DISCONNET, &evt_param);
+}
+
+/**
+ * @brief       是否有进行中的扫描（含暂停中的扫描）
+ */
+uhos_bool uhos_ble_pal_gap_scan_active(uhos_bool *wl_policy)
+{
+    uhos_ble_pal_gap_scan_ctl_t *scan_ctl = &g_uhos_ble_pal_gap_ctl.scan_ctl;
+
+    if (UHOS_NULL != wl_policy)
+    {
+        *wl_policy = scan_ctl->wl_policy;
+    }
+
+    return (UHOS_BLE_PAL_GAP_SCAN_IDLE != scan_ctl->state);
+}
+
+/**
+ * @brief       暂停进行中的扫描，保留扫描参数
+ */
+void uhos_ble_pal_gap_scan_pause(void)
+{
+    uhos_ble_pal_gap_scan_ctl_t *scan_ctl = &g_uhos_ble_pal_gap_ctl.scan_ctl;
+    esp_err_t                    ret      = 0;
+
+    if (UHOS_BLE_PAL_GAP_SCAN_LEGACY == scan_ctl->state)
+    {
+        ret = esp_ble_gap_stop_scanning();
+    }
+#ifdef CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+    else if (UHOS_BLE_PAL_GAP_SCAN_EXT == scan_ctl->state)
+    {
+        ret = esp_ble_gap_stop_ext_scan();
+    }
+#endif
+
+    if (ret){
+        UHOS_LOGE("scan pause failed, error code = %x ", ret);
+    }
+}
+
+/**
+ * @brief       以指定过滤策略恢复暂停的扫描
+ */
+void uhos_ble_pal_gap_scan_resume(uhos_bool wl_policy)
+{
+    uhos_ble_pal_gap_scan_ctl_t *scan_ctl = &g_uhos_ble_pal_gap_ctl.scan_ctl;
+    uhos_u32                     elapsed  = 0;
+    uhos_u32                     remain   = 0;
+
+    if (UHOS_BLE_PAL_GAP_SCAN_IDLE == scan_ctl->state)
+    {
+        return;
+    }
+
+    if (0 != scan_ctl->duration_ms)
+    {
+        elapsed = uhos_current_time_get() - scan_ctl->start_time;
+        if (elapsed >= scan_ctl->duration_ms)
+        {
+            scan_ctl->state = UHOS_BLE_PAL_GAP_SCAN_IDLE;
+            return;
+        }
+        remain = scan_ctl->duration_ms - elapsed;
+    }
+
+    if (UHOS_BLE_SUCCESS != uhos_ble_pal_gap_scan_run(wl_policy, remain))
+    {
+        scan_ctl->state = UHOS_BLE_PAL_GAP_SCAN_IDLE;
+    }
+}
+
+/**
+ * @brief       设置广播相关的数据
+ * @param[in]   p_data     广播数据
+ * @param[in]   dlen       广播数据长度
+ * @param[in]   p_sr_data  扫描响应数据
+ * @param[in]   srdlen     扫描响应数据长度
+ * @return      uplus_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_gap_adv_data_set(
+    uhos_u8 const *p_data,
+    uhos_u8        dlen,
+    uhos_u8 const *p_sr_data,
+    uhos_u8        srdlen)
+{
+    // 局部变量
+    uhos_ble_pal_gap_adv_data_t  *adv_data_ptr      = &g_uhos_ble_pal_gap_ctl.adv_data;
+    uhos_ble_pal_gap_scan_rsp_data_t *scan_rsp_data_ptr = &g_uhos_ble_pal_gap_ctl.scan_rsp_data;
+    uhos_u8              adv_idx           = g_uhos_ble_pal_gap_ctl.adv_idx;
+
+    // 输入参数检查
+    if ((UHOS_NULL == p_data) || (dlen < 3))
+    {
+        UHOS_LOGE("adv data invalid");
+        return UHOS_BLE_ERROR;
+    }
+
+    // 拷贝广播数据（去除头3个字节）  
+    adv_data_ptr->adv_data_len  = dlen;
+    uhos_libc_memcpy(adv_data_ptr->raw_adv_data, p_data, dlen);
+
+    // 拷贝扫描响应数据（如果有）
+    scan_rsp_data_ptr->scan_rsp_data_len = srdlen;
+
+    if (0 != srdlen)
+    {
+        uhos_libc_memcpy(scan_rsp_data_ptr->raw_scan_rsp_data, p_sr_data, srdlen);
     }
 
 #if 1
@@ -628,6 +1133,14 @@ uhos_ble_status_t uhos_ble_gap_adv_data_set(
          UHOS_LOGE("config raw adv data failed, error code = %x ", ret);
     }
 
+    if ((0 == ret) && (0 != srdlen))
+    {
+        ret = esp_ble_gap_config_scan_rsp_data_raw(scan_rsp_data_ptr->raw_scan_rsp_data, scan_rsp_data_ptr->scan_rsp_data_len);
+        if (ret){
+             UHOS_LOGE("config raw scan rsp data failed, error code = %x ", ret);
+        }
+    }
+
 #endif
     return ret == 0 ? UHOS_BLE_SUCCESS : UHOS_BLE_ERROR;
 }
@@ -826,7 +1339,7 @@ uhos_ble_status_t uhos_ble_gap_non_connectable_stop(void)
  */
 uhos_ble_status_t uhos_ble_gap_scan_start(uhos_ble_gap_scan_type_t scan_type, uhos_ble_gap_scan_param_t scan_param)
 {
-    esp_err_t ret = 0;
+    uhos_ble_pal_gap_scan_ctl_t *scan_ctl = &g_uhos_ble_pal_gap_ctl.scan_ctl;
 
     esp_ble_scan_params_t ble_scan_params = {
         .scan_type              = BLE_SCAN_TYPE_ACTIVE,
@@ -843,13 +1356,13 @@ uhos_ble_status_t uhos_ble_gap_scan_start(uhos_ble_gap_scan_type_t scan_type, uh
         return UHOS_BLE_ERROR;
     }
 
-    if(scan_type == UHOS_BLE_GAP_SCAN_TYPE_ACTIVE)
+    if(scan_type == UHOS_BLE_SCAN_TYPE_ACTIVE)
     {
-        hal_scan_param.scan_type = BLE_SCAN_TYPE_ACTIVE;
+        ble_scan_params.scan_type = BLE_SCAN_TYPE_ACTIVE;
     }
-    else if(scan_type == UHOS_BLE_GAP_SCAN_TYPE_PASSIVE)
+    else if(scan_type == UHOS_BLE_SCAN_TYPE_PASSIVE)
     {
-        hal_scan_param.scan_type = BLE_SCAN_TYPE_PASSIVE;
+        ble_scan_params.scan_type = BLE_SCAN_TYPE_PASSIVE;
     }
     else
     {
@@ -857,21 +1370,152 @@ uhos_ble_status_t uhos_ble_gap_scan_start(uhos_ble_gap_scan_type_t scan_type, uh
         return UHOS_BLE_ERROR;
     }
 
-    hal_scan_param.own_addr_type = BLE_ADDR_TYPE_PUBLIC;
-    hal_scan_param.scan_filter_policy = BLE_SCAN_FILTER_ALLOW_ALL;
-    hal_scan_param.scan_interval = scan_param.scan_interval;
-    hal_scan_param.scan_window = scan_param.scan_window;
-    hal_scan_param.scan_duplicate = BLE_SCAN_DUPLICATE_DISABLE;
+    // 扫描间隔与窗口：接口单位1ms，协议栈单位0.625ms
+    ble_scan_params.scan_interval = (uhos_u16)((uhos_u32)scan_param.scan_interval * 8 / 5);
+    ble_scan_params.scan_window   = (uhos_u16)((uhos_u32)scan_param.scan_window * 8 / 5);
+
+    // 过滤策略由白名单影子决定，见uhos_ble_gap_white_list_filter_enable
+    uhos_libc_memcpy(&scan_ctl->params, &ble_scan_params, sizeof(esp_ble_scan_params_t));
+    scan_ctl->state = UHOS_BLE_PAL_GAP_SCAN_LEGACY;
+    if (UHOS_BLE_SUCCESS != uhos_ble_pal_gap_scan_run(uhos_ble_pal_wl_scan_policy(),
+                                                      (uhos_u32)scan_param.timeout * 1000))
+    {
+        scan_ctl->state = UHOS_BLE_PAL_GAP_SCAN_IDLE;
+        return UHOS_BLE_ERROR;
+    }
+
+    return UHOS_BLE_SUCCESS;
+}
 
-    ret = esp_ble_gap_set_scan_params(&ble_scan_params);
+/**
+ * @brief       关闭扫描
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_gap_scan_stop(void)
+{
+    esp_err_t ret = 0;
+
+    if (false == uhos_ble_is_inited())
+    {
+        UHOS_LOGW("ble not inited");
+        return UHOS_BLE_ERROR;
+    }
+
+    g_uhos_ble_pal_gap_ctl.scan_ctl.state = UHOS_BLE_PAL_GAP_SCAN_IDLE;
+
+    ret = esp_ble_gap_stop_scanning();
     if (ret){
-        UHOS_LOGE("esp_ble_gap_set_scan_params failed, error code = %x ", ret);
+        UHOS_LOGE("esp_ble_gap_stop_scanning failed, error code = %x ", ret);
+        return UHOS_BLE_ERROR;
+    }
+
+    return UHOS_BLE_SUCCESS;
+}
+
+#ifdef CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+/**
+ * @brief       设置扩展广播集参数
+ * @param[in]   param 广播集参数
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_gap_ext_adv_param_set(const uhos_ble_gap_ext_adv_param_t *param)
+{
+    esp_err_t ret = 0;
+
+    esp_ble_gap_ext_adv_params_t ext_adv_params = {
+        .type           = ESP_BLE_GAP_SET_EXT_ADV_PROP_NONCONN_NONSCANNABLE_UNDIRECTED,
+        .interval_min   = 0x20,
+        .interval_max   = 0x40,
+        .channel_map    = ADV_CHNL_ALL,
+        .own_addr_type  = BLE_ADDR_TYPE_PUBLIC,
+        .peer_addr_type = BLE_ADDR_TYPE_PUBLIC,
+        .filter_policy  = ADV_FILTER_ALLOW_SCAN_ANY_CON_ANY,
+        .tx_power       = UHOS_BLE_EXT_ADV_TX_POWER_NONE,
+        .primary_phy    = ESP_BLE_GAP_PRI_PHY_1M,
+        .max_skip       = 0,
+        .secondary_phy  = ESP_BLE_GAP_PHY_1M,
+        .sid            = 0,
+        .scan_req_notif = false,
+    };
+
+    if (false == uhos_ble_is_inited())
+    {
+        UHOS_LOGW("ble not inited");
+        return UHOS_BLE_ERROR;
+    }
+
+    // 输入参数检查：扩展PDU不能同时可连接与可扫描，主通道不支持2M PHY
+    if ((UHOS_NULL == param) || (param->instance >= CONFIG_UHOS_BLE_EXT_ADV_SET_NUM) ||
+        (!param->legacy && param->connectable && param->scannable) ||
+        ((UHOS_BLE_PHY_1M != param->primary_phy) && (UHOS_BLE_PHY_CODED != param->primary_phy)))
+    {
+        UHOS_LOGE("ext adv param invalid");
         return UHOS_BLE_ERROR;
     }
 
-    ret = esp_ble_gap_start_scanning();
+    // 依据广播类型配置广播属性
+    if (param->legacy)
+    {
+        // 传统PDU只能在1M PHY上发送，可连接的传统广播必须同时可扫描（ADV_IND）
+        ext_adv_params.type = ESP_BLE_GAP_SET_EXT_ADV_PROP_LEGACY;
+        if (param->connectable)
+        {
+            ext_adv_params.type |= ESP_BLE_GAP_SET_EXT_ADV_PROP_CONNECTABLE | ESP_BLE_GAP_SET_EXT_ADV_PROP_SCANNABLE;
+        }
+        else if (param->scannable)
+        {
+            ext_adv_params.type |= ESP_BLE_GAP_SET_EXT_ADV_PROP_SCANNABLE;
+        }
+    }
+    else
+    {
+        if (param->connectable)
+        {
+            ext_adv_params.type = ESP_BLE_GAP_SET_EXT_ADV_PROP_CONNECTABLE;
+        }
+        else if (param->scannable)
+        {
+            ext_adv_params.type = ESP_BLE_GAP_SET_EXT_ADV_PROP_SCANNABLE;
+        }
+
+        ext_adv_params.primary_phy   = (esp_ble_gap_pri_phy_t)param->primary_phy;
+        ext_adv_params.secondary_phy = (esp_ble_gap_phy_t)(param->secondary_phy ? param->secondary_phy : UHOS_BLE_PHY_1M);
+    }
+
+    // 设置地址类型
+    if (param->own_addr_type == UHOS_BLE_ADDRESS_TYPE_RANDOM)
+    {
+        ext_adv_params.own_addr_type = BLE_ADDR_TYPE_RANDOM;
+    }
+
+    // 设置广播间隔（单位0.625ms）
+    ext_adv_params.interval_min = param->adv_interval_min;
+    ext_adv_params.interval_max = param->adv_interval_max;
+    ext_adv_params.tx_power     = param->tx_power;
+    ext_adv_params.sid          = param->sid & UHOS_BLE_EXT_ADV_SID_MASK;
+
+    // 设置广播通道
+    if (param->ch_mask.ch_37_off)
+    {
+        ext_adv_params.channel_map &= ~ADV_CHNL_37;
+    }
+
+    if (param->ch_mask.ch_38_off)
+    {
+        ext_adv_params.channel_map &= ~ADV_CHNL_38;
+    }
+
+    if (param->ch_mask.ch_39_off)
+    {
+        ext_adv_params.channel_map &= ~ADV_CHNL_39;
+    }
+
+    UHOS_LOGD("ext adv %d type 0x%02x phy %d/%d", param->instance, ext_adv_params.type,
+              ext_adv_params.primary_phy, ext_adv_params.secondary_phy);
+
+    ret = esp_ble_gap_ext_adv_set_params(param->instance, &ext_adv_params);
     if (ret){
-        UHOS_LOGE("esp_ble_gap_start_scanning failed, error code = %x ", ret);
+        UHOS_LOGE("esp_ble_gap_ext_adv_set_params failed, error code = %x ", ret);
         return UHOS_BLE_ERROR;
     }
 
@@ -879,10 +1523,20 @@ uhos_ble_status_t uhos_ble_gap_scan_start(uhos_ble_gap_scan_type_t scan_type, uh
 }
 
 /**
- * @brief       关闭扫描
+ * @brief       设置扩展广播集的广播数据与扫描响应数据
+ * @param[in]   instance   广播集编号
+ * @param[in]   p_data     广播数据
+ * @param[in]   dlen       广播数据长度
+ * @param[in]   p_sr_data  扫描响应数据
+ * @param[in]   srdlen     扫描响应数据长度
  * @return      uhos_ble_status_t 执行结果
  */
-uhos_ble_status_t uhos_ble_gap_scan_stop(void)
+uhos_ble_status_t uhos_ble_gap_ext_adv_data_set(
+    uhos_u8        instance,
+    uhos_u8 const *p_data,
+    uhos_u16       dlen,
+    uhos_u8 const *p_sr_data,
+    uhos_u16       srdlen)
 {
     esp_err_t ret = 0;
 
@@ -892,15 +1546,293 @@ uhos_ble_status_t uhos_ble_gap_scan_stop(void)
         return UHOS_BLE_ERROR;
     }
 
-    ret = esp_ble_gap_stop_scanning();
+    // 输入参数检查
+    if ((instance >= CONFIG_UHOS_BLE_EXT_ADV_SET_NUM) ||
+        (dlen > CONFIG_UHOS_BLE_EXT_ADV_DATA_MAX) || (srdlen > CONFIG_UHOS_BLE_EXT_ADV_DATA_MAX))
+    {
+        UHOS_LOGE("ext adv data invalid");
+        return UHOS_BLE_ERROR;
+    }
+
+    if (UHOS_NULL != p_data)
+    {
+        ret = esp_ble_gap_config_ext_adv_data_raw(instance, dlen, p_data);
+        if (ret){
+            UHOS_LOGE("esp_ble_gap_config_ext_adv_data_raw failed, error code = %x ", ret);
+            return UHOS_BLE_ERROR;
+        }
+    }
+
+    if (UHOS_NULL != p_sr_data)
+    {
+        ret = esp_ble_gap_config_ext_scan_rsp_data_raw(instance, srdlen, p_sr_data);
+        if (ret){
+            UHOS_LOGE("esp_ble_gap_config_ext_scan_rsp_data_raw failed, error code = %x ", ret);
+            return UHOS_BLE_ERROR;
+        }
+    }
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       开启扩展广播集
+ * @param[in]   instance    广播集编号
+ * @param[in]   duration    广播持续时间，Time=N * 10msec，0表示一直广播
+ * @param[in]   max_events  最多广播事件数，0表示不限制
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_gap_ext_adv_start(uhos_u8 instance, uhos_u16 duration, uhos_u8 max_events)
+{
+    esp_err_t             ret     = 0;
+    esp_ble_gap_ext_adv_t ext_adv = {0};
+
+    if (false == uhos_ble_is_inited())
+    {
+        UHOS_LOGW("ble not inited");
+        return UHOS_BLE_ERROR;
+    }
+
+    if (instance >= CONFIG_UHOS_BLE_EXT_ADV_SET_NUM)
+    {
+        UHOS_LOGE("ext adv instance %d invalid", instance);
+        return UHOS_BLE_ERROR;
+    }
+
+    ext_adv.instance   = instance;
+    ext_adv.duration   = duration;
+    ext_adv.max_events = max_events;
+
+    ret = esp_ble_gap_ext_adv_start(1, &ext_adv);
     if (ret){
-        UHOS_LOGE("esp_ble_gap_stop_scanning failed, error code = %x ", ret);
+        UHOS_LOGE("esp_ble_gap_ext_adv_start failed, error code = %x ", ret);
+        return UHOS_BLE_ERROR;
+    }
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       关闭扩展广播集
+ * @param[in]   instance    广播集编号
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_gap_ext_adv_stop(uhos_u8 instance)
+{
+    esp_err_t ret = 0;
+
+    if (false == uhos_ble_is_inited())
+    {
+        UHOS_LOGW("ble not inited");
+        return UHOS_BLE_ERROR;
+    }
+
+    if (instance >= CONFIG_UHOS_BLE_EXT_ADV_SET_NUM)
+    {
+        UHOS_LOGE("ext adv instance %d invalid", instance);
+        return UHOS_BLE_ERROR;
+    }
+
+    ret = esp_ble_gap_ext_adv_stop(1, &instance);
+    if (ret){
+        UHOS_LOGE("esp_ble_gap_ext_adv_stop failed, error code = %x ", ret);
+        return UHOS_BLE_ERROR;
+    }
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       删除扩展广播集
+ * @param[in]   instance    广播集编号
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_gap_ext_adv_remove(uhos_u8 instance)
+{
+    esp_err_t ret = 0;
+
+    if (false == uhos_ble_is_inited())
+    {
+        UHOS_LOGW("ble not inited");
+        return UHOS_BLE_ERROR;
+    }
+
+    if (instance >= CONFIG_UHOS_BLE_EXT_ADV_SET_NUM)
+    {
+        UHOS_LOGE("ext adv instance %d invalid", instance);
+        return UHOS_BLE_ERROR;
+    }
+
+    ret = esp_ble_gap_ext_adv_set_remove(instance);
+    if (ret){
+        UHOS_LOGE("esp_ble_gap_ext_adv_set_remove failed, error code = %x ", ret);
+        return UHOS_BLE_ERROR;
+    }
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       开启扩展扫描
+ * @note        协议栈侧关闭重复过滤，由AL层的去重缓存与分段重组处理
+ * @param[in]   scan_param 扫描参数
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_gap_ext_scan_start(const uhos_ble_gap_ext_scan_param_t *scan_param)
+{
+    uhos_ble_pal_gap_scan_ctl_t *scan_ctl = &g_uhos_ble_pal_gap_ctl.scan_ctl;
+    esp_ble_ext_scan_cfg_t cfg = {0};
+    uhos_u8                phys = 0;
+
+    esp_ble_ext_scan_params_t ext_scan_params = {
+        .own_addr_type  = BLE_ADDR_TYPE_PUBLIC,
+        .filter_policy  = BLE_SCAN_FILTER_ALLOW_ALL,
+        .scan_duplicate = BLE_SCAN_DUPLICATE_DISABLE,
+        .cfg_mask       = 0,
+    };
+
+    if (false == uhos_ble_is_inited())
+    {
+        UHOS_LOGW("ble not inited");
+        return UHOS_BLE_ERROR;
+    }
+
+    if (UHOS_NULL == scan_param)
+    {
+        UHOS_LOGE("ext scan param invalid");
+        return UHOS_BLE_ERROR;
+    }
+
+    if (scan_param->scan_type == UHOS_BLE_SCAN_TYPE_ACTIVE)
+    {
+        cfg.scan_type = BLE_SCAN_TYPE_ACTIVE;
+    }
+    else if (scan_param->scan_type == UHOS_BLE_SCAN_TYPE_PASSIVE)
+    {
+        cfg.scan_type = BLE_SCAN_TYPE_PASSIVE;
+    }
+    else
+    {
+        UHOS_LOGE("scan type invalid");
+        return UHOS_BLE_ERROR;
+    }
+
+    // 扫描间隔与窗口：接口单位1ms，协议栈单位0.625ms
+    cfg.scan_interval = (uhos_u16)((uhos_u32)scan_param->scan_interval * 8 / 5);
+    cfg.scan_window   = (uhos_u16)((uhos_u32)scan_param->scan_window * 8 / 5);
+
+    phys = scan_param->phys ? scan_param->phys : UHOS_BLE_GAP_EXT_SCAN_PHY_1M;
+    if (phys & UHOS_BLE_GAP_EXT_SCAN_PHY_1M)
+    {
+        ext_scan_params.cfg_mask   |= ESP_BLE_GAP_EXT_SCAN_CFG_UNCODE_MASK;
+        ext_scan_params.uncoded_cfg = cfg;
+    }
+    if (phys & UHOS_BLE_GAP_EXT_SCAN_PHY_CODED)
+    {
+        ext_scan_params.cfg_mask |= ESP_BLE_GAP_EXT_SCAN_CFG_CODE_MASK;
+        ext_scan_params.coded_cfg = cfg;
+    }
+
+    // 过滤策略由白名单影子决定；扫描时长接口单位1s
+    uhos_libc_memcpy(&scan_ctl->ext_params, &ext_scan_params, sizeof(esp_ble_ext_scan_params_t));
+    scan_ctl->state = UHOS_BLE_PAL_GAP_SCAN_EXT;
+    if (UHOS_BLE_SUCCESS != uhos_ble_pal_gap_scan_run(uhos_ble_pal_wl_scan_policy(),
+                                                      (uhos_u32)scan_param->timeout * 1000))
+    {
+        scan_ctl->state = UHOS_BLE_PAL_GAP_SCAN_IDLE;
         return UHOS_BLE_ERROR;
     }
 
     return UHOS_BLE_SUCCESS;
 }
 
+/**
+ * @brief       关闭扩展扫描
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_gap_ext_scan_stop(void)
+{
+    esp_err_t ret = 0;
+
+    if (false == uhos_ble_is_inited())
+    {
+        UHOS_LOGW("ble not inited");
+        return UHOS_BLE_ERROR;
+    }
+
+    g_uhos_ble_pal_gap_ctl.scan_ctl.state = UHOS_BLE_PAL_GAP_SCAN_IDLE;
+
+    ret = esp_ble_gap_stop_ext_scan();
+    if (ret){
+        UHOS_LOGE("esp_ble_gap_stop_ext_scan failed, error code = %x ", ret);
+        return UHOS_BLE_ERROR;
+    }
+
+    return UHOS_BLE_SUCCESS;
+}
+#else
+uhos_ble_status_t uhos_ble_gap_ext_adv_param_set(const uhos_ble_gap_ext_adv_param_t *param)
+{
+    UHOS_LOGW("ble 5.0 features not supported");
+    return UHOS_BLE_ERROR;
+}
+
+uhos_ble_status_t uhos_ble_gap_ext_adv_data_set(uhos_u8 instance, uhos_u8 const *p_data, uhos_u16 dlen,
+                                                uhos_u8 const *p_sr_data, uhos_u16 srdlen)
+{
+    UHOS_LOGW("ble 5.0 features not supported");
+    return UHOS_BLE_ERROR;
+}
+
+uhos_ble_status_t uhos_ble_gap_ext_adv_start(uhos_u8 instance, uhos_u16 duration, uhos_u8 max_events)
+{
+    UHOS_LOGW("ble 5.0 features not supported");
+    return UHOS_BLE_ERROR;
+}
+
+uhos_ble_status_t uhos_ble_gap_ext_adv_stop(uhos_u8 instance)
+{
+    UHOS_LOGW("ble 5.0 features not supported");
+    return UHOS_BLE_ERROR;
+}
+
+uhos_ble_status_t uhos_ble_gap_ext_adv_remove(uhos_u8 instance)
+{
+    UHOS_LOGW("ble 5.0 features not supported");
+    return UHOS_BLE_ERROR;
+}
+
+uhos_ble_status_t uhos_ble_gap_ext_scan_start(const uhos_ble_gap_ext_scan_param_t *scan_param)
+{
+    UHOS_LOGW("ble 5.0 features not supported");
+    return UHOS_BLE_ERROR;
+}
+
+uhos_ble_status_t uhos_ble_gap_ext_scan_stop(void)
+{
+    UHOS_LOGW("ble 5.0 features not supported");
+    return UHOS_BLE_ERROR;
+}
+#endif
+
+/**
+ * @brief       获取扩展扫描分段重组的统计信息
+ * @param[out]  stats 统计信息
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_gap_ext_scan_stats_get(uhos_ble_gap_ext_scan_stats_t *stats)
+{
+    if (UHOS_NULL == stats)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_pal_adv_reasm_stats_get(stats);
+    stats->legacy = __atomic_load_n(&g_uhos_ble_pal_gap_ctl.ext_legacy, __ATOMIC_RELAXED);
+
+    return UHOS_BLE_SUCCESS;
+}
+
 /**
  * @brief       获取已有连接
  * @param[in]   conn_handle 连接句柄
@@ -909,23 +1841,15 @@ uhos_ble_status_t uhos_ble_gap_scan_stop(void)
  */
 void uhos_ble_gap_find_connect(uhos_u16 conn_handle, uhos_ble_addr_t remote_bda)
 {
-    uhos_ble_addr_t tmp = {0};
-
-    for (int index = 0; index < UHOS_BLE_HANDLE_CONNECT_NUM; ++index) {
-        if (0 != uhos_libc_memcmp(tmp, g_uhos_ble_connect[index].remote_bda, sizeof(uhos_ble_addr_t)) &&
-            conn_handle == g_uhos_ble_connect[index].conn_id) {
-
-            memcpy(remote_bda, g_uhos_ble_connect[index].remote_bda, sizeof(uhos_ble_addr_t));
-            return;
-        }
+    if (UHOS_BLE_SUCCESS != uhos_ble_pal_conn_addr_get(conn_handle, remote_bda))
+    {
+        uhos_libc_memset(remote_bda, 0, sizeof(esp_bd_addr_t));
     }
-
-    uhos_libc_memcpy(remote_bda, tmp, sizeof(esp_bd_addr_t));
 }
 
 /**
  * @brief       更新连接参数
- * @note        注意：这个接口配置的连接参数并未保存到本地全局数据
+ * @note        注意：这个接口配置的连接参数并未保存到本地全局数据；调用后连接参数策略不再调整该连接
  * @param[in]   conn_handle 连接句柄
  * @param[in]   conn_params 连接参数
  * @return      uhos_ble_status_t 执行结果
@@ -938,6 +1862,7 @@ uhos_ble_status_t uhos_ble_gap_update_conn_params(
     esp_ble_conn_update_params_t params = {0};
     
     uhos_ble_gap_find_connect(conn_handle, params.bda);
+    uhos_ble_pal_conn_policy_pin(conn_handle);
     params.latency = conn_params.slave_latency;
     params.max_int = conn_params.max_conn_interval;    // max_int = 0x20*1.25ms = 40ms
     params.min_int = conn_params.max_conn_interval;    // min_int = 0x10*1.25ms = 20ms
@@ -985,10 +1910,10 @@ uhos_ble_status_t uhos_ble_gap_connect(
     esp_err_t ret = 0;
     esp_bd_addr_t remote_bda;
     
-    uhos_libc_memcpy(remote_bda, uhos_ble_gap_connect_t.remote_addr.addr.addr, ESP_BD_ADDR_LEN);
+    uhos_libc_memcpy(remote_bda, conn_param.peer_addr, ESP_BD_ADDR_LEN);
 
 #if UHOS_BLE_MAC_REVERSE_ENABLE
-    uhos_ble_mac_reverse(app_hal_connect_param.peer_addr.addr.addr, ESP_BD_ADDR_LEN);
+    uhos_ble_mac_reverse(remote_bda, ESP_BD_ADDR_LEN);
 #endif
 
     ret = esp_ble_gattc_open(esp32_gattc_if, remote_bda, BLE_ADDR_TYPE_PUBLIC, true);
@@ -1033,13 +1958,70 @@ uhos_ble_status_t uhos_ble_gap_callback_register(uhos_ble_gap_cb_t cb)
 }
 
 /**
- * @brief       GAP层添加白名单
- * @param[in]   mac     ble的mac地址，16进制格式，6字节
+ * @brief       开启/关闭广播数据批量上报
+ * @param[in]   enable UHOS_TRUE-开启，UHOS_FALSE-关闭
+ * @return      UHOS_BLE_SUCCESS    成功
+ */
+uhos_ble_status_t uhos_ble_gap_adv_report_batch_enable(uhos_bool enable)
+{
+    __atomic_store_n(&g_uhos_ble_pal_gap_ctl.adv_rpt_ctl.batch_enable, enable ? 1 : 0, __ATOMIC_RELAXED);
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       获取广播上报通道的统计信息
+ * @param[out]  stats 统计信息
+ * @return      uhos_ble_status_t 执行结果
+ */
+uhos_ble_status_t uhos_ble_gap_adv_report_stats_get(uhos_ble_gap_adv_report_stats_t *stats)
+{
+    uhos_ble_gap_adv_report_stats_t *src = &g_uhos_ble_pal_gap_ctl.adv_rpt_ctl.stats;
+
+    if (UHOS_NULL == stats)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    stats->received  = __atomic_load_n(&src->received, __ATOMIC_RELAXED);
+    stats->delivered = __atomic_load_n(&src->delivered, __ATOMIC_RELAXED);
+    stats->dropped   = __atomic_load_n(&src->dropped, __ATOMIC_RELAXED);
+    stats->batches   = __atomic_load_n(&src->batches, __ATOMIC_RELAXED);
+    stats->wakeups   = __atomic_load_n(&src->wakeups, __ATOMIC_RELAXED);
+    stats->max_batch = src->max_batch;
+    stats->capacity  = UHOS_BLE_ADV_RPT_BUF_NUM;
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       清零广播上报通道的统计信息
+ * @return      UHOS_BLE_SUCCESS    成功
+ */
+uhos_ble_status_t uhos_ble_gap_adv_report_stats_reset(void)
+{
+    uhos_ble_gap_adv_report_stats_t *src = &g_uhos_ble_pal_gap_ctl.adv_rpt_ctl.stats;
+
+    __atomic_store_n(&src->received, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&src->delivered, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&src->dropped, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&src->batches, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&src->wakeups, 0, __ATOMIC_RELAXED);
+    src->max_batch = 0;
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       GAP层白名单操作的实现
+ * @note        先修改影子白名单，再把差异同步到控制器
+ * @param[in]   op      操作类型
+ * @param[in]   mac     白名单地址，清空时为UHOS_NULL
  * @return      操作结果
  */
-uhos_ble_status_t uhos_ble_gap_white_list_add(uhos_u8 *mac)
+static uhos_ble_status_t uhos_ble_pal_gap_set_white_list(uhos_ble_pal_gap_white_list_op_t op, const uhos_u8 *mac)
 {
-    uhos_ble_pal_white_list_addr_t address;
+    uhos_ble_addr_t addr;
 
     if (false == uhos_ble_is_inited())
     {
@@ -1047,19 +2029,34 @@ uhos_ble_status_t uhos_ble_gap_white_list_add(uhos_u8 *mac)
         return UHOS_BLE_ERROR;
     }
 
-    if (NULL == mac)
+    if (UHOS_NULL != mac)
+    {
+        uhos_libc_memcpy(addr, mac, 6);
+#if UHOS_BLE_MAC_REVERSE_ENABLE
+        uhos_ble_mac_reverse(addr, 6);
+#endif
+    }
+    else if (UHOS_BLE_GAP_WHITE_LIST_CLEAR != op)
     {
         return UHOS_BLE_ERROR;
     }
 
-    address.type = UHOS_BLE_ADDRESS_TYPE_PUBLIC;
-    uhos_libc_memcpy(address.addr, mac, 6);
+    if (UHOS_BLE_SUCCESS != uhos_ble_pal_wl_edit(op, (UHOS_NULL != mac) ? addr : UHOS_NULL))
+    {
+        return UHOS_BLE_ERROR;
+    }
 
-#if UHOS_BLE_MAC_REVERSE_ENABLE
-    uhos_ble_mac_reverse(address.addr, 6);
-#endif
+    return uhos_ble_pal_wl_sync();
+}
 
-    return uhos_ble_pal_gap_set_white_list(UHOS_BLE_GAP_WHITE_LIST_ADD, &address);
+/**
+ * @brief       GAP层添加白名单
+ * @param[in]   mac     ble的mac地址，16进制格式，6字节
+ * @return      操作结果
+ */
+uhos_ble_status_t uhos_ble_gap_white_list_add(uhos_u8 *mac)
+{
+    return uhos_ble_pal_gap_set_white_list(UHOS_BLE_GAP_WHITE_LIST_ADD, mac);
 }
 
 /**
@@ -1069,7 +2066,29 @@ uhos_ble_status_t uhos_ble_gap_white_list_add(uhos_u8 *mac)
  */
 uhos_ble_status_t uhos_ble_gap_white_list_remove(uhos_u8 *mac)
 {
-    uhos_ble_pal_white_list_addr_t address;
+    return uhos_ble_pal_gap_set_white_list(UHOS_BLE_GAP_WHITE_LIST_DEL, mac);
+}
+
+/**
+ * @brief       GAP层清除白名单
+ * @return      操作结果
+ */
+uhos_ble_status_t uhos_ble_gap_white_list_clear(void)
+{
+    return uhos_ble_pal_gap_set_white_list(UHOS_BLE_GAP_WHITE_LIST_CLEAR, UHOS_NULL);
+}
+
+/**
+ * @brief       GAP层批量设置白名单
+ * @param[in]   mac_list    ble的mac地址列表
+ * @param[in]   num         地址个数
+ * @return      操作结果
+ */
+uhos_ble_status_t uhos_ble_gap_white_list_set(const uhos_ble_addr_t *mac_list, uhos_u16 num)
+{
+    uhos_ble_status_t ret  = UHOS_BLE_SUCCESS;
+    uhos_ble_addr_t  *list = UHOS_NULL;
+    uhos_u16          i    = 0;
 
     if (false == uhos_ble_is_inited())
     {
@@ -1077,33 +2096,46 @@ uhos_ble_status_t uhos_ble_gap_white_list_remove(uhos_u8 *mac)
         return UHOS_BLE_ERROR;
     }
 
-    if (NULL == mac)
+    if ((UHOS_NULL == mac_list) && (0 != num))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    if (num > CONFIG_UHOS_BLE_WL_SHADOW_NUM)
     {
+        UHOS_LOGE("white list num %d over %d", num, CONFIG_UHOS_BLE_WL_SHADOW_NUM);
         return UHOS_BLE_ERROR;
     }
 
-    address.type = UHOS_BLE_ADDRESS_TYPE_PUBLIC;
-    uhos_libc_memcpy(address.addr, mac, 6);
+    if (0 != num)
+    {
+        list = (uhos_ble_addr_t *)uhos_libc_malloc(num * sizeof(uhos_ble_addr_t));
+        if (UHOS_NULL == list)
+        {
+            UHOS_LOGE("malloc err");
+            return UHOS_BLE_ERROR;
+        }
 
+        for (i = 0; i < num; i++)
+        {
+            uhos_libc_memcpy(list[i], mac_list[i], 6);
 #if UHOS_BLE_MAC_REVERSE_ENABLE
-    uhos_ble_mac_reverse(address.addr, 6);
+            uhos_ble_mac_reverse(list[i], 6);
 #endif
+        }
+    }
 
-    return uhos_ble_pal_gap_set_white_list(UHOS_BLE_GAP_WHITE_LIST_DEL, &address);
-}
+    ret = uhos_ble_pal_wl_replace(list, num);
+    if (UHOS_NULL != list)
+    {
+        uhos_libc_free(list);
+    }
 
-/**
- * @brief       GAP层清除白名单
- * @return      操作结果
- */
-uhos_ble_status_t uhos_ble_gap_white_list_clear(void)
-{
-    if (false == uhos_ble_is_inited())
+    if (UHOS_BLE_SUCCESS != ret)
     {
-        UHOS_LOGW("ble not inited");
-        return UHOS_BLE_ERROR;
+        return ret;
     }
 
-    return uhos_ble_pal_gap_set_white_list(UHOS_BLE_GAP_WHITE_LIST_CLEAR, UHOS_NULL);
+    return uhos_ble_pal_wl_sync();
 }
 
@@ -2,7 +2,12 @@
  * @copyright Copyright (c) 2021, Haier.Co, Ltd.
  * @file uh_ble_gatt_client.c
  * @author maaiguo (maaiguo@haier.com)
- * @brief 基于HR3010硬件模块的BLE GATT层client端相关功能函数实现
+ * @brief 基于ESP32-S3 Bluedroid协议栈的BLE GATT层client端相关功能函数实现
+ * @details 每个连接维护一个操作队列：发现、读、写请求按提交顺序逐个下发，收到响应后再下发下一个；
+ *          不同连接的队列互相独立，写命令（write without response）不进入队列。
+ *          操作完成时通过统一的完成回调上报结果及耗时。
+ *          发现所有首要服务后对端的属性数据库按对端地址缓存并持久化，重连时服务、特征、描述符发现
+ *          直接由缓存完成；对端支持Database Hash时先读取哈希值校验，收到Service Changed时缓存失效
  * @date 2021-10-26
  *
  * @par History:
@@ -17,12 +22,11 @@
 /**************************************************************************************************/
 /*                           #include (依次为标准头文件、非标准头文件)                            */
 /**************************************************************************************************/
-#include "arch.h"
-// #include "gap.h"
-#include "sonata_gap_api.h"
-#include "sonata_gatt_api.h"
-#include "sonata_utils_api.h"
-#include "app.h"
+#include "esp_gap_ble_api.h"
+#include "esp_gattc_api.h"
+#include "esp_gatt_common_api.h"
+#include "esp_gatt_defs.h"
+#include "esp_bt_defs.h"
 
 #include "uh_types.h"
 #include "uh_libc.h"
@@ -31,383 +35,1792 @@
 
 #include "uh_ble.h"
 #include "uh_ble_common.h"
+#include "uh_ble_conn.h"
+#include "uh_ble_evt.h"
+#include "uh_ble_bench.h"
+#include "uh_ble_frag_pal.h"
+#include "uh_ble_gattc_cache.h"
+#include "uh_ble_gatt_client.h"
 
 
 /**************************************************************************************************/
 /*                                          外部引用声明                                          */
 /**************************************************************************************************/
+extern esp_gatt_if_t esp32_gattc_if;
 
 
 /**************************************************************************************************/
 /*                                           内部宏定义                                           */
 /**************************************************************************************************/
+// 每个连接的操作队列深度
+#ifndef CONFIG_UHOS_BLE_GATTC_OP_QUEUE_NUM
+#define CONFIG_UHOS_BLE_GATTC_OP_QUEUE_NUM  8
+#endif
+
+// 已下发操作等待响应的超时时间（毫秒），默认取ATT事务超时30秒
+#ifndef CONFIG_UHOS_BLE_GATTC_OP_TIMEOUT_MS
+#define CONFIG_UHOS_BLE_GATTC_OP_TIMEOUT_MS 30000
+#endif
+
+// 从协议栈本地缓存中分批读取特征、描述符时每批的数量
+#define UHOS_BLE_GATTC_DB_BATCH_NUM         8
+
+#define UHOS_BLE_GATTC_UUID_CCCD            0x2902
+#define UHOS_BLE_GATTC_UUID_SERVICE_CHANGED 0x2A05
+#define UHOS_BLE_GATTC_UUID_DB_HASH         0x2B2A
 
 
 /**************************************************************************************************/
 /*                                        内部数据类型定义                                        */
 /**************************************************************************************************/
+/**
+ * @enum        发现所有首要服务操作的阶段
+ */
+typedef enum
+{
+    UHOS_BLE_PAL_GATTC_DISC_SEARCH = 0,                         //<! 与对端交互发现服务
+    UHOS_BLE_PAL_GATTC_DISC_VERIFY,                             //<! 读取Database Hash校验缓存
+    UHOS_BLE_PAL_GATTC_DISC_HASH,                               //<! 发现完成后读取Database Hash
+} uhos_ble_pal_gattc_disc_phase_t;
+
+/**
+ * @struct      操作队列中的一项
+ */
+typedef struct uhos_ble_pal_gattc_op_item
+{
+    uhos_ble_gattc_op_t op;                                     //<! 操作请求，op.data指向入队时拷贝的数据
+    uhos_u32            op_id;                                  //<! 操作ID
+    uhos_u32            submit_time;                            //<! 入队时间
+    uhos_u32            issue_time;                             //<! 下发时间
+} uhos_ble_pal_gattc_op_item_t;
+
+/**
+ * @struct      连接的操作队列
+ */
+typedef struct uhos_ble_pal_gattc_conn
+{
+    uhos_u8                      used;                          //<! 表项是否有效
+    uhos_u8                      busy;                          //<! 队首操作已下发，等待响应
+    uhos_u8                      head;                          //<! 队列头
+    uhos_u8                      count;                         //<! 队列长度
+    uhos_u16                     conn_id;                       //<! 连接ID
+    uhos_u16                     cmd_pending;                   //<! 已下发、尚未收到完成事件的写命令数
+    uhos_u16                     cmd_ahead;                     //<! 先于队首写请求下发、尚未完成的写命令数
+    uhos_u8                      disc_phase;                    //<! 发现所有首要服务操作的阶段
+    uhos_u8                      db_valid;                      //<! 属性数据库缓存是否可用
+    uhos_u8                      cache_hit;                     //<! 本次连接的服务发现是否命中缓存
+    uhos_u8                      first_write;                   //<! 是否已完成首次写入
+    uhos_u32                     connect_time;                  //<! 连接建立时间
+    uhos_ble_addr_t              bda;                           //<! 对端地址（协议栈字节序）
+    uhos_ble_pal_gattc_db_t     *db;                            //<! 对端的属性数据库缓存
+    uhos_ble_pal_gattc_op_item_t ops[CONFIG_UHOS_BLE_GATTC_OP_QUEUE_NUM];  //<! 操作队列
+} uhos_ble_pal_gattc_conn_t;
+
+/**
+ * @struct      GATT client控制块
+ */
+typedef struct uhos_ble_pal_gattc_ctl
+{
+    uhos_mutex_t              mutex;                            //<! 操作队列互斥锁
+    uhos_u32                  op_id;                            //<! 最近分配的操作ID
+    uhos_ble_gattc_op_cb_t    op_cb;                            //<! 操作完成回调
+    uhos_ble_gattc_cache_stats_t cache_stats;                   //<! 属性缓存统计
+    uhos_ble_pal_gattc_conn_t conn[CONFIG_UHOS_BLE_MAX_CONN];   //<! 各连接的操作队列
+} uhos_ble_pal_gattc_ctl_t;
+
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_ble_pal_gattc_ctl_t g_uhos_ble_pal_gattc_ctl = {0};     //<! GATT client控制块
+uhos_ble_gattc_callback_t g_uhos_ble_pal_gattc_user_cb = UHOS_NULL; //<! GATT层用户设置的Client端回调函数
+
+
+/**************************************************************************************************/
+/*                                          内部函数原型                                          */
+/**************************************************************************************************/
+static void uhos_ble_pal_gattc_op_kick(uhos_u16 conn_id);
+
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static void uhos_ble_pal_gattc_lock(void)
+{
+    uhos_mutex_wait(g_uhos_ble_pal_gattc_ctl.mutex, UHOS_MUTEX_WAIT_FOREVER);
+}
+
+static void uhos_ble_pal_gattc_unlock(void)
+{
+    uhos_mutex_release(g_uhos_ble_pal_gattc_ctl.mutex);
+}
+
+/**
+ * @brief       创建操作队列互斥锁
+ * @return      uhos_ble_status_t 执行结果
+ */
+static uhos_ble_status_t uhos_ble_pal_gattc_mutex_init(void)
+{
+    if (UHOS_NULL == g_uhos_ble_pal_gattc_ctl.mutex)
+    {
+        if (UHOS_SUCCESS != uhos_mutex_create(&g_uhos_ble_pal_gattc_ctl.mutex))
+        {
+            UHOS_LOGE("create mutex err");
+            return UHOS_BLE_ERROR;
+        }
+    }
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       根据conn_id查找操作队列（需持锁调用）
+ * @param[in]   conn_id 连接ID
+ * @return      操作队列，未找到返回UHOS_NULL
+ */
+static uhos_ble_pal_gattc_conn_t *uhos_ble_pal_gattc_conn_find(uhos_u16 conn_id)
+{
+    uhos_u8 i = 0;
+
+    for (i = 0; i < CONFIG_UHOS_BLE_MAX_CONN; i++)
+    {
+        if (g_uhos_ble_pal_gattc_ctl.conn[i].used && (g_uhos_ble_pal_gattc_ctl.conn[i].conn_id == conn_id))
+        {
+            return &g_uhos_ble_pal_gattc_ctl.conn[i];
+        }
+    }
+
+    return UHOS_NULL;
+}
+
+/**
+ * @brief       UUID转换为协议栈格式
+ */
+static void uhos_ble_pal_gattc_uuid_to_esp(const uhos_ble_uuid_t *src, esp_bt_uuid_t *dst)
+{
+    uhos_libc_memset(dst, 0, sizeof(esp_bt_uuid_t));
+
+    if (UHOS_BLE_UUID_TYPE_16 == src->type)
+    {
+        dst->len         = ESP_UUID_LEN_16;
+        dst->uuid.uuid16 = src->uuid16;
+    }
+    else
+    {
+        dst->len = ESP_UUID_LEN_128;
+        uhos_libc_memcpy(dst->uuid.uuid128, src->uuid128, ESP_UUID_LEN_128);
+    }
+}
+
+/**
+ * @brief       协议栈格式的UUID转换为UHOS格式，32位UUID按蓝牙基础UUID扩展为128位
+ */
+static void uhos_ble_pal_gattc_uuid_from_esp(const esp_bt_uuid_t *src, uhos_ble_uuid_t *dst)
+{
+    static const uhos_u8 base_uuid[ESP_UUID_LEN_128] = {
+        0xFB, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+
+    uhos_libc_memset(dst, 0, sizeof(uhos_ble_uuid_t));
+
+    if (ESP_UUID_LEN_16 == src->len)
+    {
+        dst->type   = UHOS_BLE_UUID_TYPE_16;
+        dst->uuid16 = src->uuid.uuid16;
+    }
+    else if (ESP_UUID_LEN_32 == src->len)
+    {
+        dst->type = UHOS_BLE_UUID_TYPE_128;
+        uhos_libc_memcpy(dst->uuid128, base_uuid, ESP_UUID_LEN_128);
+        dst->uuid128[12] = (uhos_u8)(src->uuid.uuid32);
+        dst->uuid128[13] = (uhos_u8)(src->uuid.uuid32 >> 8);
+        dst->uuid128[14] = (uhos_u8)(src->uuid.uuid32 >> 16);
+        dst->uuid128[15] = (uhos_u8)(src->uuid.uuid32 >> 24);
+    }
+    else
+    {
+        dst->type = UHOS_BLE_UUID_TYPE_128;
+        uhos_libc_memcpy(dst->uuid128, src->uuid.uuid128, ESP_UUID_LEN_128);
+    }
+}
+
+/**
+ * @brief       获取事件参数中携带数据的指针与长度
+ * @return      携带数据的指针的地址，事件不携带数据时返回UHOS_NULL
+ */
+static uhos_u8 **uhos_ble_pal_gattc_evt_data(uhos_ble_gattc_evt_t evt, uhos_ble_gattc_evt_param_t *param, uhos_u16 *len)
+{
+    switch (evt)
+    {
+        case UHOS_BLE_GATTC_EVT_READ_CHAR_VALUE_RESP:
+            *len = param->read_char_value_rsp.len;
+            return &param->read_char_value_rsp.data;
+        case UHOS_BLE_GATTC_EVT_READ_USING_UUID_RESP:
+            *len = param->read_using_uuid_rsp.len;
+            return &param->read_using_uuid_rsp.data;
+        case UHOS_BLE_GATTC_EVT_READ_CHAR_VALUE_BY_UUID_RESP:
+            *len = param->read_char_value_by_uuid_rsp.len;
+            return &param->read_char_value_by_uuid_rsp.data;
+        case UHOS_BLE_GATTC_EVT_NOTIFICATION:
+        case UHOS_BLE_GATTC_EVT_INDICATION:
+            *len = param->notification.len;
+            return &param->notification.pdata;
+        default:
+            *len = 0;
+            return UHOS_NULL;
+    }
+}
+
+static void uhos_ble_pal_gattc_evt_handle(uhos_ble_pal_evt_t *evt)
+{
+    if (g_uhos_ble_pal_gattc_user_cb)
+    {
+        g_uhos_ble_pal_gattc_user_cb(evt->gattc.evt, &evt->gattc.param);
+    }
+}
+
+/**
+ * @brief       向用户上报GATT client事件
+ * @note        事件连同携带数据的拷贝交给ble_daemon任务投递，队列已满时丢弃并计数
+ */
+static void uhos_ble_pal_gattc_evt_report(uhos_ble_gattc_evt_t evt, uhos_ble_gattc_evt_param_t *param)
+{
+    uhos_ble_pal_evt_t *item = UHOS_NULL;
+    uhos_u8           **data = UHOS_NULL;
+    uhos_u16            len  = 0;
+
+    if (UHOS_NULL == g_uhos_ble_pal_gattc_user_cb)
+    {
+        return;
+    }
+
+    data = uhos_ble_pal_gattc_evt_data(evt, param, &len);
+    if ((UHOS_NULL != data) && (UHOS_NULL == *data))
+    {
+        len = 0;
+    }
+
+    item = uhos_ble_pal_evt_alloc(UHOS_BLE_EVENT_TYPE_GATTC, param->conn_handle, len, UHOS_FALSE);
+    if (UHOS_NULL == item)
+    {
+        uhos_ble_pal_evt_drop(UHOS_BLE_EVENT_TYPE_GATTC);
+        return;
+    }
+
+    item->gattc.evt = evt;
+    uhos_libc_memcpy(&item->gattc.param, param, sizeof(uhos_ble_gattc_evt_param_t));
+    if (0 != len)
+    {
+        uhos_libc_memcpy(item->data, *data, len);
+        *uhos_ble_pal_gattc_evt_data(evt, &item->gattc.param, &len) = item->data;
+    }
+    uhos_ble_pal_evt_post(item, uhos_ble_pal_gattc_evt_handle);
+}
+
+static void uhos_ble_pal_gattc_op_result_handle(uhos_ble_pal_evt_t *evt)
+{
+    uhos_ble_gattc_op_cb_t     op_cb  = g_uhos_ble_pal_gattc_ctl.op_cb;
+    uhos_ble_gattc_op_result_t result = {0};
+
+    if (op_cb)
+    {
+        // evt->data不保证按结构体对齐，拷贝后再交给用户
+        uhos_libc_memcpy(&result, evt->data, sizeof(result));
+        op_cb(&result);
+    }
+}
+
+/**
+ * @brief       向用户上报操作结果，与GATT client事件经同一队列投递以保持先后顺序
+ * @note        操作结果数量受操作队列深度约束，不受数据类排队上限限制，仅在内存不足时丢弃
+ */
+static void uhos_ble_pal_gattc_op_result_report(const uhos_ble_gattc_op_result_t *result)
+{
+    uhos_ble_gattc_op_cb_t op_cb = g_uhos_ble_pal_gattc_ctl.op_cb;
+    uhos_ble_pal_evt_t    *item  = UHOS_NULL;
+
+    if (UHOS_NULL == op_cb)
+    {
+        return;
+    }
+
+    item = uhos_ble_pal_evt_alloc(UHOS_BLE_EVENT_TYPE_GATTC, result->conn_handle, sizeof(uhos_ble_gattc_op_result_t),
+                                  UHOS_TRUE);
+    if (UHOS_NULL == item)
+    {
+        UHOS_LOGE("op %u result dropped", result->op_id);
+        uhos_ble_pal_evt_drop(UHOS_BLE_EVENT_TYPE_GATTC);
+        return;
+    }
+
+    uhos_libc_memcpy(item->data, result, sizeof(uhos_ble_gattc_op_result_t));
+    uhos_ble_pal_evt_post(item, uhos_ble_pal_gattc_op_result_handle);
+}
+
+/**
+ * @brief       获取连接当前已下发、等待响应的操作
+ * @param[in]   conn_id 连接ID
+ * @param[out]  type    操作类型
+ * @param[out]  op_id   操作ID
+ * @return      UHOS_TRUE-存在等待响应的操作
+ */
+static uhos_bool uhos_ble_pal_gattc_op_current(uhos_u16 conn_id, uhos_ble_gattc_op_type_t *type, uhos_u32 *op_id)
+{
+    uhos_ble_pal_gattc_conn_t *conn  = UHOS_NULL;
+    uhos_bool                  found = UHOS_FALSE;
+
+    uhos_ble_pal_gattc_lock();
+
+    conn = uhos_ble_pal_gattc_conn_find(conn_id);
+    if (conn && conn->busy)
+    {
+        *type  = conn->ops[conn->head].op.type;
+        *op_id = conn->ops[conn->head].op_id;
+        found  = UHOS_TRUE;
+    }
+
+    uhos_ble_pal_gattc_unlock();
+
+    return found;
+}
+
+/**
+ * @brief       上报操作结束，并释放操作占用的资源
+ * @note        兼容原有事件：为各类操作补发对应的完成事件
+ * @param[in]   conn_id 连接ID
+ * @param[in]   item    已出队的操作
+ * @param[in]   status  操作结果
+ */
+static void uhos_ble_pal_gattc_op_notify(uhos_u16 conn_id, uhos_ble_pal_gattc_op_item_t *item, uhos_ble_status_t status)
+{
+    uhos_ble_gattc_evt_param_t evt_param = {0};
+    uhos_ble_gattc_op_result_t result    = {0};
+    uhos_u32                   now       = uhos_current_time_get();
+
+    evt_param.conn_handle = conn_id;
+    evt_param.common_rsp.succ = (UHOS_BLE_SUCCESS == status);
+
+    switch (item->op.type)
+    {
+        case UHOS_BLE_GATTC_OP_PRIMARY_SERVICE_DISCOVER_ALL:
+        case UHOS_BLE_GATTC_OP_PRIMARY_SERVICE_DISCOVER_BY_UUID:
+            uhos_ble_pal_gattc_evt_report(UHOS_BLE_GATTC_EVT_PRIMARY_SERVICE_DISCOVER_DONE, &evt_param);
+            break;
+
+        case UHOS_BLE_GATTC_OP_CHAR_DISCOVER:
+        case UHOS_BLE_GATTC_OP_CHAR_DISCOVER_BY_UUID:
+            uhos_ble_pal_gattc_evt_report(UHOS_BLE_GATTC_EVT_CHAR_DISCOVER_DONE, &evt_param);
+            break;
+
+        case UHOS_BLE_GATTC_OP_CHAR_DESC_DISCOVER:
+            uhos_ble_pal_gattc_evt_report(UHOS_BLE_GATTC_EVT_CHAR_DESC_DISCOVER_DONE, &evt_param);
+            break;
+
+        case UHOS_BLE_GATTC_OP_READ:
+            // 读取成功时特征值已随READ_CHAR_VALUE_RESP上报
+            if (UHOS_BLE_SUCCESS != status)
+            {
+                uhos_libc_memset(&evt_param.read_char_value_rsp, 0, sizeof(evt_param.read_char_value_rsp));
+                uhos_ble_pal_gattc_evt_report(UHOS_BLE_GATTC_EVT_READ_CHAR_VALUE_RESP, &evt_param);
+            }
+            break;
+
+        case UHOS_BLE_GATTC_OP_READ_BY_UUID:
+            uhos_ble_pal_gattc_evt_report(UHOS_BLE_GATTC_EVT_READ_USING_UUID_DONE, &evt_param);
+            break;
+
+        case UHOS_BLE_GATTC_OP_WRITE:
+            evt_param.write_rsp.succ = (UHOS_BLE_SUCCESS == status);
+            uhos_ble_pal_gattc_evt_report(UHOS_BLE_GATTC_EVT_WRITE_RESP, &evt_param);
+            break;
+
+        case UHOS_BLE_GATTC_OP_EXCHANGE_MTU:
+            uhos_ble_pal_gattc_evt_report(UHOS_BLE_GATTC_EVT_EXCHANGE_MTU_DONE, &evt_param);
+            break;
+
+        default:
+            break;
+    }
+
+    result.conn_handle = conn_id;
+    result.type        = item->op.type;
+    result.op_id       = item->op_id;
+    result.status      = status;
+    result.queue_ms    = item->issue_time - item->submit_time;
+    result.latency_ms  = now - item->issue_time;
+    result.user_data   = item->op.user_data;
+
+    uhos_libc_free((void *)item->op.data);
+    item->op.data = UHOS_NULL;
+
+    uhos_ble_pal_gattc_op_result_report(&result);
+}
+
+/**
+ * @brief       结束连接当前等待响应的操作
+ * @param[in]   conn_id 连接ID
+ * @param[in]   op_id   操作ID，与队首操作不一致时（如连接已断开、队列已清空）忽略
+ * @param[in]   status  操作结果
+ */
+static void uhos_ble_pal_gattc_op_complete(uhos_u16 conn_id, uhos_u32 op_id, uhos_ble_status_t status)
+{
+    uhos_ble_pal_gattc_conn_t   *conn = UHOS_NULL;
+    uhos_ble_pal_gattc_op_item_t item = {0};
+    uhos_bool                    done = UHOS_FALSE;
+
+    uhos_ble_pal_gattc_lock();
+
+    conn = uhos_ble_pal_gattc_conn_find(conn_id);
+    if (conn && conn->busy && (conn->ops[conn->head].op_id == op_id))
+    {
+        item = conn->ops[conn->head];
+        conn->ops[conn->head].op.data = UHOS_NULL;
+
+        conn->head = (conn->head + 1) % CONFIG_UHOS_BLE_GATTC_OP_QUEUE_NUM;
+        conn->count--;
+        conn->busy = 0;
+        done = UHOS_TRUE;
+    }
+
+    uhos_ble_pal_gattc_unlock();
+
+    if (done)
+    {
+        uhos_ble_pal_gattc_op_notify(conn_id, &item, status);
+    }
+}
+
+/**
+ * @brief       判断两个UUID是否相同
+ */
+static uhos_bool uhos_ble_pal_gattc_uuid_equal(const uhos_ble_uuid_t *a, const uhos_ble_uuid_t *b)
+{
+    if (a->type != b->type)
+    {
+        return UHOS_FALSE;
+    }
+
+    if (UHOS_BLE_UUID_TYPE_16 == a->type)
+    {
+        return (a->uuid16 == b->uuid16);
+    }
+
+    return (0 == uhos_libc_memcmp(a->uuid128, b->uuid128, sizeof(a->uuid128)));
+}
+
+/**
+ * @brief       上报发现的特征
+ */
+static void uhos_ble_pal_gattc_char_report(uhos_u16 conn_id, uhos_u16 value_handle, uhos_u8 properties, const uhos_ble_uuid_t *uuid)
+{
+    uhos_ble_gattc_evt_param_t evt_param = {0};
+
+    evt_param.conn_handle = conn_id;
+
+    // 特征声明位于特征值的前一个句柄
+    evt_param.char_disc_rsp.char_handle       = value_handle - 1;
+    evt_param.char_disc_rsp.char_value_handle = value_handle;
+    evt_param.char_disc_rsp.char_properties   = properties;
+    evt_param.char_disc_rsp.char_uuid         = *uuid;
+
+    uhos_ble_pal_gattc_evt_report(UHOS_BLE_GATTC_EVT_CHAR_DISCOVER_RESP, &evt_param);
+}
+
+/**
+ * @brief       上报发现的描述符，CCCD额外上报UHOS_BLE_GATTC_EVT_CCCD_DISCOVER_RESP
+ */
+static void uhos_ble_pal_gattc_desc_report(uhos_u16 conn_id, uhos_u16 handle, const uhos_ble_uuid_t *uuid)
+{
+    uhos_ble_gattc_evt_param_t evt_param = {0};
+
+    evt_param.conn_handle = conn_id;
+
+    evt_param.char_desc_disc_rsp.char_desc_handle = handle;
+    evt_param.char_desc_disc_rsp.char_desc_uuid   = *uuid;
+
+    uhos_ble_pal_gattc_evt_report(UHOS_BLE_GATTC_EVT_CHAR_DESC_DISCOVER_RESP, &evt_param);
+
+    if ((UHOS_BLE_UUID_TYPE_16 == uuid->type) && (UHOS_BLE_GATTC_UUID_CCCD == uuid->uuid16))
+    {
+        uhos_libc_memset(&evt_param, 0, sizeof(evt_param));
+        evt_param.conn_handle = conn_id;
+
+        evt_param.clt_cfg_desc_disc_rsp.desc_handle = handle;
+        evt_param.clt_cfg_desc_disc_rsp.succ        = 1;
+
+        uhos_ble_pal_gattc_evt_report(UHOS_BLE_GATTC_EVT_CCCD_DISCOVER_RESP, &evt_param);
+    }
+}
+
+/**
+ * @brief       获取连接可用的属性数据库缓存
+ * @note        缓存只在连接断开或重新发现时释放，与之相关的操作在同一连接上串行执行
+ * @return      属性数据库，不可用返回UHOS_NULL
+ */
+static uhos_ble_pal_gattc_db_t *uhos_ble_pal_gattc_db_get(uhos_u16 conn_id)
+{
+    uhos_ble_pal_gattc_conn_t *conn = UHOS_NULL;
+    uhos_ble_pal_gattc_db_t   *db   = UHOS_NULL;
+
+    uhos_ble_pal_gattc_lock();
+
+    conn = uhos_ble_pal_gattc_conn_find(conn_id);
+    if (conn && conn->db_valid)
+    {
+        db = conn->db;
+    }
+
+    uhos_ble_pal_gattc_unlock();
+
+    return db;
+}
+
+/**
+ * @brief       由缓存上报首要服务
+ * @param[in]   filter  服务UUID，UHOS_NULL表示上报所有服务
+ */
+static void uhos_ble_pal_gattc_db_svc_report(uhos_u16 conn_id, const uhos_ble_pal_gattc_db_t *db, const uhos_ble_uuid_t *filter)
+{
+    uhos_ble_gattc_evt_param_t evt_param = {0};
+    uhos_u8                    i         = 0;
+
+    for (i = 0; i < db->svc_num; i++)
+    {
+        if (filter && !uhos_ble_pal_gattc_uuid_equal(filter, &db->svcs[i].uuid))
+        {
+            continue;
+        }
+
+        uhos_libc_memset(&evt_param, 0, sizeof(evt_param));
+        evt_param.conn_handle = conn_id;
+
+        evt_param.srv_disc_rsp.primary_srv_range.begin_handle = db->svcs[i].begin_handle;
+        evt_param.srv_disc_rsp.primary_srv_range.end_handle   = db->svcs[i].end_handle;
+        evt_param.srv_disc_rsp.srv_uuid = db->svcs[i].uuid;
+        evt_param.srv_disc_rsp.succ     = 1;
+
+        uhos_ble_pal_gattc_evt_report(UHOS_BLE_GATTC_EVT_PRIMARY_SERVICE_DISCOVER_RESP, &evt_param);
+    }
+}
+
+/**
+ * @brief       在协议栈完成服务发现后，从协议栈缓存中读取对端的完整属性数据库
+ * @return      属性数据库；超出缓存容量或读取失败返回UHOS_NULL
+ */
+static uhos_ble_pal_gattc_db_t *uhos_ble_pal_gattc_db_build(uhos_u16 conn_id, const uhos_u8 *bda)
+{
+    esp_gattc_service_elem_t svcs[UHOS_BLE_GATTC_DB_BATCH_NUM];
+    esp_gattc_char_elem_t    chars[UHOS_BLE_GATTC_DB_BATCH_NUM];
+    esp_gattc_descr_elem_t   descs[UHOS_BLE_GATTC_DB_BATCH_NUM];
+    esp_gatt_status_t        status = ESP_GATT_OK;
+    uhos_ble_pal_gattc_db_t *db     = UHOS_NULL;
+    uhos_u16                 count  = 0;
+    uhos_u16                 offset = 0;
+    uhos_u16                 dcount = 0;
+    uhos_u16                 doff   = 0;
+    uhos_u16                 i      = 0;
+    uhos_u16                 j      = 0;
+
+    db = uhos_libc_zalloc(sizeof(uhos_ble_pal_gattc_db_t));
+    if (UHOS_NULL == db)
+    {
+        UHOS_LOGE("malloc fail");
+        return UHOS_NULL;
+    }
+
+    uhos_libc_memcpy(db->bda, bda, sizeof(uhos_ble_addr_t));
+
+    // 首要服务
+    do
+    {
+        count  = UHOS_BLE_GATTC_DB_BATCH_NUM;
+        status = esp_ble_gattc_get_service(esp32_gattc_if, conn_id, UHOS_NULL, svcs, &count, offset);
+        if (ESP_GATT_OK != status)
+        {
+            break;
+        }
+
+        for (i = 0; i < count; i++)
+        {
+            if (!svcs[i].is_primary)
+            {
+                continue;
+            }
+
+            if (db->svc_num >= CONFIG_UHOS_BLE_GATTC_CACHE_SVC_NUM)
+            {
+                goto overflow;
+            }
+
+            db->svcs[db->svc_num].begin_handle = svcs[i].start_handle;
+            db->svcs[db->svc_num].end_handle   = svcs[i].end_handle;
+            uhos_ble_pal_gattc_uuid_from_esp(&svcs[i].uuid, &db->svcs[db->svc_num].uuid);
+            db->svc_num++;
+        }
+
+        offset += count;
+    } while (UHOS_BLE_GATTC_DB_BATCH_NUM == count);
+
+    // 特征及其描述符
+    offset = 0;
+    do
+    {
+        count  = UHOS_BLE_GATTC_DB_BATCH_NUM;
+        status = esp_ble_gattc_get_all_char(esp32_gattc_if, conn_id, 0x0001, 0xFFFF, chars, &count, offset);
+        if (ESP_GATT_OK != status)
+        {
+            break;
+        }
+
+        for (i = 0; i < count; i++)
+        {
+            if (db->char_num >= CONFIG_UHOS_BLE_GATTC_CACHE_CHAR_NUM)
+            {
+                goto overflow;
+            }
+
+            db->chars[db->char_num].value_handle = chars[i].char_handle;
+            db->chars[db->char_num].properties   = chars[i].properties;
+            uhos_ble_pal_gattc_uuid_from_esp(&chars[i].uuid, &db->chars[db->char_num].uuid);
+            db->char_num++;
+
+            if (ESP_UUID_LEN_16 == chars[i].uuid.len)
+            {
+                if (UHOS_BLE_GATTC_UUID_SERVICE_CHANGED == chars[i].uuid.uuid.uuid16)
+                {
+                    db->sc_handle = chars[i].char_handle;
+                }
+                else if (UHOS_BLE_GATTC_UUID_DB_HASH == chars[i].uuid.uuid.uuid16)
+                {
+                    db->hash_handle = chars[i].char_handle;
+                }
+            }
+
+            doff = 0;
+            do
+            {
+                dcount = UHOS_BLE_GATTC_DB_BATCH_NUM;
+                if (ESP_GATT_OK != esp_ble_gattc_get_all_descr(esp32_gattc_if, conn_id, chars[i].char_handle,
+                                                               descs, &dcount, doff))
+                {
+                    break;
+                }
+
+                for (j = 0; j < dcount; j++)
+                {
+                    if (db->desc_num >= CONFIG_UHOS_BLE_GATTC_CACHE_DESC_NUM)
+                    {
+                        goto overflow;
+                    }
+
+                    db->descs[db->desc_num].handle = descs[j].handle;
+                    uhos_ble_pal_gattc_uuid_from_esp(&descs[j].uuid, &db->descs[db->desc_num].uuid);
+                    db->desc_num++;
+                }
+
+                doff += dcount;
+            } while (UHOS_BLE_GATTC_DB_BATCH_NUM == dcount);
+        }
+
+        offset += count;
+    } while (UHOS_BLE_GATTC_DB_BATCH_NUM == count);
+
+    if (0 == db->svc_num)
+    {
+        uhos_libc_free(db);
+        return UHOS_NULL;
+    }
+
+    return db;
+
+overflow:
+    UHOS_LOGW("conn %d db too large to cache", conn_id);
+    uhos_libc_free(db);
+    return UHOS_NULL;
+}
+
+/**
+ * @brief       发现特征，已缓存时由缓存完成，否则读取协议栈缓存
+ * @note        需在服务发现完成后调用，结果同步上报
+ */
+static uhos_ble_status_t uhos_ble_pal_gattc_char_discover(uhos_u16 conn_id, const uhos_ble_gattc_op_t *op)
+{
+    esp_gattc_char_elem_t    chars[UHOS_BLE_GATTC_DB_BATCH_NUM];
+    esp_bt_uuid_t            uuid   = {0};
+    esp_gatt_status_t        status = ESP_GATT_OK;
+    uhos_ble_pal_gattc_db_t *db     = uhos_ble_pal_gattc_db_get(conn_id);
+    uhos_ble_uuid_t          found  = {0};
+    uhos_u16                 count  = 0;
+    uhos_u16                 offset = 0;
+    uhos_u16                 i      = 0;
+
+    if (db)
+    {
+        for (i = 0; i < db->char_num; i++)
+        {
+            if ((db->chars[i].value_handle < op->range.begin_handle)
+             || (db->chars[i].value_handle > op->range.end_handle)
+             || ((UHOS_BLE_GATTC_OP_CHAR_DISCOVER_BY_UUID == op->type)
+              && !uhos_ble_pal_gattc_uuid_equal(&op->uuid, &db->chars[i].uuid)))
+            {
+                continue;
+            }
+
+            uhos_ble_pal_gattc_char_report(conn_id, db->chars[i].value_handle, db->chars[i].properties, &db->chars[i].uuid);
+        }
+
+        return UHOS_BLE_SUCCESS;
+    }
+
+    uhos_ble_pal_gattc_uuid_to_esp(&op->uuid, &uuid);
+
+    do
+    {
+        count = UHOS_BLE_GATTC_DB_BATCH_NUM;
+
+        if (UHOS_BLE_GATTC_OP_CHAR_DISCOVER_BY_UUID == op->type)
+        {
+            // 协议栈不支持按UUID分批获取，超出一批的同UUID特征被忽略
+            status = esp_ble_gattc_get_char_by_uuid(esp32_gattc_if, conn_id, op->range.begin_handle,
+                                                    op->range.end_handle, uuid, chars, &count);
+        }
+        else
+        {
+            status = esp_ble_gattc_get_all_char(esp32_gattc_if, conn_id, op->range.begin_handle,
+                                                op->range.end_handle, chars, &count, offset);
+        }
+
+        if (ESP_GATT_OK != status)
+        {
+            break;
+        }
+
+        for (i = 0; i < count; i++)
+        {
+            uhos_ble_pal_gattc_uuid_from_esp(&chars[i].uuid, &found);
+            uhos_ble_pal_gattc_char_report(conn_id, chars[i].char_handle, chars[i].properties, &found);
+        }
+
+        offset += count;
+    } while ((UHOS_BLE_GATTC_OP_CHAR_DISCOVER == op->type) && (UHOS_BLE_GATTC_DB_BATCH_NUM == count));
+
+    // 没有特征或已读取到末尾
+    if ((ESP_GATT_OK == status) || (ESP_GATT_NOT_FOUND == status) ||
+        ((0 != offset) && (ESP_GATT_INVALID_OFFSET == status)))
+    {
+        return UHOS_BLE_SUCCESS;
+    }
+
+    UHOS_LOGE("conn %d char discover fail %d", conn_id, status);
+    return UHOS_BLE_ERROR;
+}
+
+/**
+ * @brief       从协议栈缓存中发现一个特征的描述符
+ */
+static uhos_ble_status_t uhos_ble_pal_gattc_desc_discover_of_char(uhos_u16 conn_id, uhos_u16 char_handle)
+{
+    esp_gattc_descr_elem_t descs[UHOS_BLE_GATTC_DB_BATCH_NUM];
+    esp_gatt_status_t      status = ESP_GATT_OK;
+    uhos_ble_uuid_t        found  = {0};
+    uhos_u16               count  = 0;
+    uhos_u16               offset = 0;
+    uhos_u16               i      = 0;
+
+    do
+    {
+        count  = UHOS_BLE_GATTC_DB_BATCH_NUM;
+        status = esp_ble_gattc_get_all_descr(esp32_gattc_if, conn_id, char_handle, descs, &count, offset);
+        if (ESP_GATT_OK != status)
+        {
+            break;
+        }
+
+        for (i = 0; i < count; i++)
+        {
+            uhos_ble_pal_gattc_uuid_from_esp(&descs[i].uuid, &found);
+            uhos_ble_pal_gattc_desc_report(conn_id, descs[i].handle, &found);
+        }
+
+        offset += count;
+    } while (UHOS_BLE_GATTC_DB_BATCH_NUM == count);
+
+    if ((ESP_GATT_OK == status) || (ESP_GATT_NOT_FOUND == status) ||
+        ((0 != offset) && (ESP_GATT_INVALID_OFFSET == status)))
+    {
+        return UHOS_BLE_SUCCESS;
+    }
+
+    return UHOS_BLE_ERROR;
+}
+
+/**
+ * @brief       发现句柄范围内所有特征的描述符，已缓存时由缓存完成，否则读取协议栈缓存
+ */
+static uhos_ble_status_t uhos_ble_pal_gattc_desc_discover(uhos_u16 conn_id, const uhos_ble_gattc_op_t *op)
+{
+    esp_gattc_char_elem_t    chars[UHOS_BLE_GATTC_DB_BATCH_NUM];
+    esp_gatt_status_t        status = ESP_GATT_OK;
+    uhos_ble_pal_gattc_db_t *db     = uhos_ble_pal_gattc_db_get(conn_id);
+    uhos_u16                 count  = 0;
+    uhos_u16                 offset = 0;
+    uhos_u16                 i      = 0;
+
+    if (db)
+    {
+        for (i = 0; i < db->desc_num; i++)
+        {
+            if ((db->descs[i].handle >= op->range.begin_handle) && (db->descs[i].handle <= op->range.end_handle))
+            {
+                uhos_ble_pal_gattc_desc_report(conn_id, db->descs[i].handle, &db->descs[i].uuid);
+            }
+        }
+
+        return UHOS_BLE_SUCCESS;
+    }
+
+    do
+    {
+        count  = UHOS_BLE_GATTC_DB_BATCH_NUM;
+        status = esp_ble_gattc_get_all_char(esp32_gattc_if, conn_id, op->range.begin_handle,
+                                            op->range.end_handle, chars, &count, offset);
+        if (ESP_GATT_OK != status)
+        {
+            break;
+        }
+
+        for (i = 0; i < count; i++)
+        {
+            if (UHOS_BLE_SUCCESS != uhos_ble_pal_gattc_desc_discover_of_char(conn_id, chars[i].char_handle))
+            {
+                UHOS_LOGE("conn %d desc discover fail, char 0x%x", conn_id, chars[i].char_handle);
+                return UHOS_BLE_ERROR;
+            }
+        }
+
+        offset += count;
+    } while (UHOS_BLE_GATTC_DB_BATCH_NUM == count);
+
+    if ((ESP_GATT_OK == status) || (ESP_GATT_NOT_FOUND == status) ||
+        ((0 != offset) && (ESP_GATT_INVALID_OFFSET == status)))
+    {
+        return UHOS_BLE_SUCCESS;
+    }
+
+    UHOS_LOGE("conn %d desc discover fail %d", conn_id, status);
+    return UHOS_BLE_ERROR;
+}
+
+/**
+ * @brief       设置发现所有首要服务操作的阶段
+ */
+static void uhos_ble_pal_gattc_disc_phase_set(uhos_u16 conn_id, uhos_ble_pal_gattc_disc_phase_t phase)
+{
+    uhos_ble_pal_gattc_conn_t *conn = UHOS_NULL;
+
+    uhos_ble_pal_gattc_lock();
+
+    conn = uhos_ble_pal_gattc_conn_find(conn_id);
+    if (conn)
+    {
+        conn->disc_phase = phase;
+    }
+
+    uhos_ble_pal_gattc_unlock();
+}
+
+/**
+ * @brief       记录本次连接的服务发现是否命中缓存
+ */
+static void uhos_ble_pal_gattc_cache_result(uhos_u16 conn_id, uhos_bool hit)
+{
+    uhos_ble_pal_gattc_conn_t *conn = UHOS_NULL;
+
+    uhos_ble_pal_gattc_lock();
+
+    conn = uhos_ble_pal_gattc_conn_find(conn_id);
+    if (conn)
+    {
+        conn->cache_hit = hit ? 1 : 0;
+    }
+
+    if (hit)
+    {
+        g_uhos_ble_pal_gattc_ctl.cache_stats.hits++;
+    }
+    else
+    {
+        g_uhos_ble_pal_gattc_ctl.cache_stats.misses++;
+    }
+
+    uhos_ble_pal_gattc_unlock();
+}
+
+/**
+ * @brief       使对端的属性数据库缓存失效
+ * @param[in]   bda     对端地址（协议栈字节序）
+ */
+static void uhos_ble_pal_gattc_cache_invalidate(const uhos_u8 *bda)
+{
+    uhos_ble_pal_gattc_conn_t *conn = UHOS_NULL;
+    uhos_u8                    i    = 0;
+
+    uhos_ble_pal_gattc_lock();
+
+    for (i = 0; i < CONFIG_UHOS_BLE_MAX_CONN; i++)
+    {
+        conn = &g_uhos_ble_pal_gattc_ctl.conn[i];
+        if (conn->used && conn->db && (0 == uhos_libc_memcmp(conn->bda, bda, sizeof(uhos_ble_addr_t))))
+        {
+            conn->db_valid       = 0;
+            conn->db->hash_valid = 0;
+        }
+    }
+
+    g_uhos_ble_pal_gattc_ctl.cache_stats.invalidations++;
+
+    uhos_ble_pal_gattc_unlock();
+
+    uhos_ble_pal_gattc_cache_remove(bda);
+}
+
+/**
+ * @brief       记录连接的首次写入完成
+ */
+static void uhos_ble_pal_gattc_first_write(uhos_u16 conn_id)
+{
+    uhos_ble_pal_gattc_ctl_t  *ctl  = &g_uhos_ble_pal_gattc_ctl;
+    uhos_ble_pal_gattc_conn_t *conn = UHOS_NULL;
+    uhos_u32                   ttfw = 0;
+
+    uhos_ble_pal_gattc_lock();
+
+    conn = uhos_ble_pal_gattc_conn_find(conn_id);
+    if (conn && !conn->first_write)
+    {
+        conn->first_write = 1;
+        ttfw = uhos_current_time_get() - conn->connect_time;
+
+        if (conn->cache_hit)
+        {
+            ctl->cache_stats.ttfw_hit_ms = ttfw;
+        }
+        else
+        {
+            ctl->cache_stats.ttfw_miss_ms = ttfw;
+        }
+    }
+
+    uhos_ble_pal_gattc_unlock();
+}
+
+/**
+ * @brief       下发发现所有首要服务操作
+ * @note        缓存可用时直接上报；缓存待校验时读取Database Hash；否则与对端交互发现服务
+ */
+static uhos_ble_status_t uhos_ble_pal_gattc_disc_all_issue(uhos_u16 conn_id, uhos_bool *pending)
+{
+    uhos_ble_pal_gattc_conn_t *conn        = UHOS_NULL;
+    uhos_ble_pal_gattc_db_t   *db          = UHOS_NULL;
+    uhos_u16                   hash_handle = 0;
+    esp_err_t                  ret         = ESP_OK;
+
+    uhos_ble_pal_gattc_lock();
+
+    conn = uhos_ble_pal_gattc_conn_find(conn_id);
+    if (conn && conn->db)
+    {
+        if (conn->db_valid)
+        {
+            db = conn->db;
+        }
+        else if (conn->db->hash_valid)
+        {
+            hash_handle = conn->db->hash_handle;
+        }
+    }
+
+    uhos_ble_pal_gattc_unlock();
+
+    if (db)
+    {
+        uhos_ble_pal_gattc_db_svc_report(conn_id, db, UHOS_NULL);
+        uhos_ble_pal_gattc_cache_result(conn_id, UHOS_TRUE);
+        *pending = UHOS_FALSE;
+        return UHOS_BLE_SUCCESS;
+    }
+
+    *pending = UHOS_TRUE;
+
+    if (hash_handle)
+    {
+        uhos_ble_pal_gattc_disc_phase_set(conn_id, UHOS_BLE_PAL_GATTC_DISC_VERIFY);
+        ret = esp_ble_gattc_read_char(esp32_gattc_if, conn_id, hash_handle, ESP_GATT_AUTH_REQ_NONE);
+        if (ESP_OK == ret)
+        {
+            return UHOS_BLE_SUCCESS;
+        }
+    }
+
+    uhos_ble_pal_gattc_disc_phase_set(conn_id, UHOS_BLE_PAL_GATTC_DISC_SEARCH);
+    uhos_ble_pal_gattc_cache_result(conn_id, UHOS_FALSE);
+
+    ret = esp_ble_gattc_search_service(esp32_gattc_if, conn_id, UHOS_NULL);
+    if (ESP_OK != ret)
+    {
+        UHOS_LOGE("conn %d search service fail 0x%x", conn_id, ret);
+        *pending = UHOS_FALSE;
+        return UHOS_BLE_ERROR;
+    }
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       发现所有首要服务时，与对端交互的服务发现完成
+ * @note        从协议栈缓存中生成属性数据库；对端支持Database Hash时先读取哈希值再保存
+ */
+static void uhos_ble_pal_gattc_disc_search_done(uhos_u16 conn_id, uhos_u32 op_id, esp_gatt_status_t status)
+{
+    uhos_ble_pal_gattc_conn_t *conn = UHOS_NULL;
+    uhos_ble_pal_gattc_db_t   *db   = UHOS_NULL;
+    uhos_ble_pal_gattc_db_t   *old  = UHOS_NULL;
+    uhos_ble_addr_t            bda  = {0};
+
+    if (ESP_GATT_OK == status)
+    {
+        uhos_ble_pal_gattc_lock();
+        conn = uhos_ble_pal_gattc_conn_find(conn_id);
+        if (conn)
+        {
+            uhos_libc_memcpy(bda, conn->bda, sizeof(uhos_ble_addr_t));
+        }
+        uhos_ble_pal_gattc_unlock();
 
+        db = conn ? uhos_ble_pal_gattc_db_build(conn_id, bda) : UHOS_NULL;
+    }
 
-/**************************************************************************************************/
-/*                                        全局(静态)变量                                          */
-/**************************************************************************************************/
-static uhos_u8            g_uhos_ble_pal_gattc_op[APP_MAX_CON_IDX] = {0};
-uhos_ble_gattc_callback_t g_uhos_ble_pal_gattc_user_cb = UHOS_NULL; //<! GATT层用户设置的Client端回调函数
+    if (db)
+    {
+        uhos_ble_pal_gattc_lock();
+        conn = uhos_ble_pal_gattc_conn_find(conn_id);
+        if (conn)
+        {
+            old            = conn->db;
+            conn->db       = db;
+            conn->db_valid = 1;
+        }
+        else
+        {
+            old = db;
+            db  = UHOS_NULL;
+        }
+        uhos_ble_pal_gattc_unlock();
 
+        uhos_libc_free(old);
+    }
 
-/**************************************************************************************************/
-/*                                          内部函数原型                                          */
-/**************************************************************************************************/
+    if (db && db->hash_handle)
+    {
+        uhos_ble_pal_gattc_disc_phase_set(conn_id, UHOS_BLE_PAL_GATTC_DISC_HASH);
+        if (ESP_OK == esp_ble_gattc_read_char(esp32_gattc_if, conn_id, db->hash_handle, ESP_GATT_AUTH_REQ_NONE))
+        {
+            return;
+        }
+    }
 
+    if (db)
+    {
+        uhos_ble_pal_gattc_cache_save(db);
+    }
+
+    uhos_ble_pal_gattc_op_complete(conn_id, op_id, (ESP_GATT_OK == status) ? UHOS_BLE_SUCCESS : UHOS_BLE_ERROR);
+    uhos_ble_pal_gattc_op_kick(conn_id);
+}
 
-/**************************************************************************************************/
-/*                                          内部函数实现                                          */
-/**************************************************************************************************/
 /**
- * @brief       协议栈gatt层的回调函数实现
- * @param[in]   event   回调事件
- * @param[in]   param   回调参数
- * @return      无
+ * @brief       发现所有首要服务时读取Database Hash的响应
  */
-static void uhos_ble_pal_gattc_stack_cb(app_ble_gatt_event_t event, app_ble_gatt_event_param_t *param)
+static void uhos_ble_pal_gattc_disc_hash_evt_handle(uhos_u16 conn_id, uhos_u32 op_id, esp_ble_gattc_cb_param_t *param)
 {
-    uhos_u16 conn_id = 0;
-    uhos_ble_gattc_evt_param_t evt_param = {0};
+    uhos_ble_pal_gattc_conn_t *conn  = UHOS_NULL;
+    uhos_ble_pal_gattc_db_t   *db    = UHOS_NULL;
+    uhos_ble_addr_t            bda   = {0};
+    uhos_u8                    phase = UHOS_BLE_PAL_GATTC_DISC_SEARCH;
+    uhos_bool                  ok    = (ESP_GATT_OK == param->read.status)
+                                    && (UHOS_BLE_GATTC_DB_HASH_LEN == param->read.value_len);
+    esp_err_t                  ret   = ESP_OK;
+
+    uhos_ble_pal_gattc_lock();
+    conn = uhos_ble_pal_gattc_conn_find(conn_id);
+    if (conn)
+    {
+        phase = conn->disc_phase;
+        db    = conn->db;
+        uhos_libc_memcpy(bda, conn->bda, sizeof(uhos_ble_addr_t));
+    }
+    uhos_ble_pal_gattc_unlock();
 
-    // 输入参数检查
-    if (UHOS_NULL == param)
+    if (UHOS_NULL == db)
     {
-        UHOS_LOGE("input param is null");
         return;
     }
 
-    // 回调函数检查
-    if (UHOS_NULL == g_uhos_ble_pal_gattc_user_cb)
+    if (UHOS_BLE_PAL_GATTC_DISC_HASH == phase)
     {
-        UHOS_LOGE("no user gattc cb");
+        if (ok)
+        {
+            uhos_libc_memcpy(db->hash, param->read.value, UHOS_BLE_GATTC_DB_HASH_LEN);
+            db->hash_valid = 1;
+        }
+
+        uhos_ble_pal_gattc_cache_save(db);
+        uhos_ble_pal_gattc_op_complete(conn_id, op_id, UHOS_BLE_SUCCESS);
+        uhos_ble_pal_gattc_op_kick(conn_id);
         return;
     }
 
-    // 获取连接句柄
-    conn_id = uhos_ble_pal_conn_id_switch(param->dis_svc.conidx, UHOS_BLE_CONNECT_SWITCH_MODE_INC);
+    if (UHOS_BLE_PAL_GATTC_DISC_VERIFY != phase)
+    {
+        return;
+    }
 
-    // 依据事件类型进行操作
-    switch (event)
+    if (ok && (0 == uhos_libc_memcmp(db->hash, param->read.value, UHOS_BLE_GATTC_DB_HASH_LEN)))
     {
-        case APP_BLE_GATT_EVENT_DISC_SERVICE:
+        uhos_ble_pal_gattc_lock();
+        conn = uhos_ble_pal_gattc_conn_find(conn_id);
+        if (conn)
         {
-            evt_param.conn_handle = conn_id;
+            conn->db_valid = 1;
+        }
+        uhos_ble_pal_gattc_unlock();
 
-            evt_param.srv_disc_rsp.primary_srv_range.begin_handle = param->dis_svc.start_hdl;
-            evt_param.srv_disc_rsp.primary_srv_range.end_handle   = param->dis_svc.end_hdl;
+        uhos_ble_pal_gattc_db_svc_report(conn_id, db, UHOS_NULL);
+        uhos_ble_pal_gattc_cache_result(conn_id, UHOS_TRUE);
+        uhos_ble_pal_gattc_op_complete(conn_id, op_id, UHOS_BLE_SUCCESS);
+        uhos_ble_pal_gattc_op_kick(conn_id);
+        return;
+    }
 
-            if (UPLUG_BLE_UUID_16_LEN == param->dis_svc.uuid_len)
-            {
-                evt_param.srv_disc_rsp.srv_uuid.type = UHOS_BLE_UUID_TYPE_16;
-            }
-            else
-            {
-                evt_param.srv_disc_rsp.srv_uuid.type = UHOS_BLE_UUID_TYPE_128;
-            }
+    // 对端数据库已变化，重新发现
+    UHOS_LOGI("conn %d db hash changed", conn_id);
+    uhos_ble_pal_gattc_cache_invalidate(bda);
+    uhos_ble_pal_gattc_disc_phase_set(conn_id, UHOS_BLE_PAL_GATTC_DISC_SEARCH);
+    uhos_ble_pal_gattc_cache_result(conn_id, UHOS_FALSE);
 
-            uhos_libc_memcpy(evt_param.srv_disc_rsp.srv_uuid.uuid128,
-                             param->dis_svc.uuid,
-                             param->dis_svc.uuid_len);
+    ret = esp_ble_gattc_search_service(esp32_gattc_if, conn_id, UHOS_NULL);
+    if (ESP_OK != ret)
+    {
+        UHOS_LOGE("conn %d search service fail 0x%x", conn_id, ret);
+        uhos_ble_pal_gattc_op_complete(conn_id, op_id, UHOS_BLE_ERROR);
+        uhos_ble_pal_gattc_op_kick(conn_id);
+    }
+}
 
-            evt_param.srv_disc_rsp.succ = 1;
+/**
+ * @brief       将操作下发给协议栈
+ * @param[in]   conn_id 连接ID
+ * @param[in]   op      操作请求
+ * @param[out]  pending UHOS_TRUE-已下发，等待协议栈事件；UHOS_FALSE-已同步完成或下发失败
+ * @return      uhos_ble_status_t 执行结果
+ */
+static uhos_ble_status_t uhos_ble_pal_gattc_op_issue(uhos_u16 conn_id, const uhos_ble_gattc_op_t *op, uhos_bool *pending)
+{
+    uhos_ble_pal_gattc_db_t *db   = UHOS_NULL;
+    esp_bt_uuid_t            uuid = {0};
+    esp_err_t                ret  = ESP_OK;
 
-            g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_PRIMARY_SERVICE_DISCOVER_RESP, &evt_param);
+    *pending = UHOS_TRUE;
 
-            break;
-        }
+    switch (op->type)
+    {
+        case UHOS_BLE_GATTC_OP_PRIMARY_SERVICE_DISCOVER_ALL:
+            return uhos_ble_pal_gattc_disc_all_issue(conn_id, pending);
 
-        case APP_BLE_GATT_EVENT_DISC_SERVICE_DONE:
-        {
-            evt_param.conn_handle = conn_id;
+        case UHOS_BLE_GATTC_OP_PRIMARY_SERVICE_DISCOVER_BY_UUID:
+            db = uhos_ble_pal_gattc_db_get(conn_id);
+            if (db)
+            {
+                uhos_ble_pal_gattc_db_svc_report(conn_id, db, &op->uuid);
+                *pending = UHOS_FALSE;
+                return UHOS_BLE_SUCCESS;
+            }
 
-            evt_param.common_rsp.succ = true;
+            uhos_ble_pal_gattc_uuid_to_esp(&op->uuid, &uuid);
+            ret = esp_ble_gattc_search_service(esp32_gattc_if, conn_id, &uuid);
+            break;
+
+        case UHOS_BLE_GATTC_OP_CHAR_DISCOVER:
+        case UHOS_BLE_GATTC_OP_CHAR_DISCOVER_BY_UUID:
+            *pending = UHOS_FALSE;
+            return uhos_ble_pal_gattc_char_discover(conn_id, op);
 
-            g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_PRIMARY_SERVICE_DISCOVER_DONE, &evt_param);
+        case UHOS_BLE_GATTC_OP_CHAR_DESC_DISCOVER:
+            *pending = UHOS_FALSE;
+            return uhos_ble_pal_gattc_desc_discover(conn_id, op);
 
+        case UHOS_BLE_GATTC_OP_READ:
+            ret = esp_ble_gattc_read_char(esp32_gattc_if, conn_id, op->handle, ESP_GATT_AUTH_REQ_NONE);
             break;
-        }
 
-        case APP_BLE_GATT_EVENT_DISC_ALL_CHAR:
-        case APP_BLE_GATT_EVENT_DISC_CCCD:
-        case APP_BLE_GATT_EVENT_CHAR_DISCOVER:
-        {
-            evt_param.conn_handle = conn_id;
+        case UHOS_BLE_GATTC_OP_READ_BY_UUID:
+            uhos_ble_pal_gattc_uuid_to_esp(&op->uuid, &uuid);
+            ret = esp_ble_gattc_read_by_type(esp32_gattc_if, conn_id, op->range.begin_handle,
+                                             op->range.end_handle, &uuid, ESP_GATT_AUTH_REQ_NONE);
+            break;
 
-            evt_param.char_disc_rsp.char_handle       = param->dis_char.attr_hdl;
-            evt_param.char_disc_rsp.char_properties   = param->dis_char.prop;
-            evt_param.char_disc_rsp.char_value_handle = param->dis_char.pointer_hdl;
+        case UHOS_BLE_GATTC_OP_WRITE:
+            ret = esp_ble_gattc_write_char(esp32_gattc_if, conn_id, op->handle, op->len, (uhos_u8 *)op->data,
+                                           ESP_GATT_WRITE_TYPE_RSP, ESP_GATT_AUTH_REQ_NONE);
+            break;
 
-            if (UPLUG_BLE_UUID_16_LEN == param->dis_char.uuid_len)
+        case UHOS_BLE_GATTC_OP_EXCHANGE_MTU:
+            if (op->len)
             {
-                evt_param.char_disc_rsp.char_uuid.type = UHOS_BLE_UUID_TYPE_16;
+                ret = esp_ble_gatt_set_local_mtu(op->len);
             }
-            else
+            if (ESP_OK == ret)
             {
-                evt_param.char_disc_rsp.char_uuid.type = UHOS_BLE_UUID_TYPE_128;
+                ret = esp_ble_gattc_send_mtu_req(esp32_gattc_if, conn_id);
             }
+            break;
 
-            uhos_libc_memcpy(evt_param.char_disc_rsp.char_uuid.uuid128,
-                             param->dis_char.uuid,
-                             param->dis_char.uuid_len);
+        default:
+            ret = ESP_FAIL;
+            break;
+    }
 
-            if ((APP_BLE_GATT_EVENT_CHAR_DISCOVER == event)
-             || (APP_BLE_GATT_EVENT_DISC_ALL_CHAR == event))
-            {
-                if (g_uhos_ble_pal_gattc_op[param->dis_char.conidx] == UHOS_BLE_GATTC_EVT_CHAR_DISCOVER_RESP)
-                {
-                    g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_CHAR_DISCOVER_RESP, &evt_param);
-                }
-                else
-                {
-                    g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_READ_USING_UUID_RESP, &evt_param);
-                }
-            }
-            else
-            {
-                g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_CCCD_DISCOVER_RESP, &evt_param);
-            }
+    if (ESP_OK != ret)
+    {
+        UHOS_LOGE("conn %d op %d issue fail 0x%x", conn_id, op->type, ret);
+        *pending = UHOS_FALSE;
+        return UHOS_BLE_ERROR;
+    }
 
-            break;
-        }
+    return UHOS_BLE_SUCCESS;
+}
 
-        case APP_BLE_GATT_EVENT_CHAR_DISCOVER_DONE:
-        {
-            evt_param.conn_handle = conn_id;
+/**
+ * @brief       连接空闲时依次下发队列中的操作，直到有一个操作需要等待协议栈响应
+ * @param[in]   conn_id 连接ID
+ */
+static void uhos_ble_pal_gattc_op_kick(uhos_u16 conn_id)
+{
+    uhos_ble_pal_gattc_conn_t   *conn    = UHOS_NULL;
+    uhos_ble_pal_gattc_op_item_t item    = {0};
+    uhos_ble_status_t            status  = UHOS_BLE_SUCCESS;
+    uhos_bool                    pending = UHOS_FALSE;
+    uhos_bool                    next    = UHOS_FALSE;
 
-            evt_param.common_rsp.succ  = true;
+    do
+    {
+        uhos_ble_pal_gattc_lock();
 
-            if (g_uhos_ble_pal_gattc_op[param->dis_char.conidx] == UHOS_BLE_GATTC_EVT_CHAR_DISCOVER_RESP)
-            {
-                g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_CHAR_DISCOVER_DONE, &evt_param);
-            }
-            else
+        next = UHOS_FALSE;
+        conn = uhos_ble_pal_gattc_conn_find(conn_id);
+        if (conn && !conn->busy && conn->count)
+        {
+            conn->busy = 1;
+            conn->ops[conn->head].issue_time = uhos_current_time_get();
+            if (UHOS_BLE_GATTC_OP_WRITE == conn->ops[conn->head].op.type)
             {
-                g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_READ_USING_UUID_RESP, &evt_param);
+                conn->cmd_ahead = conn->cmd_pending;
             }
 
+            item = conn->ops[conn->head];
+            next = UHOS_TRUE;
+        }
+
+        uhos_ble_pal_gattc_unlock();
+
+        if (!next)
+        {
             break;
         }
 
-        case APP_BLE_GATT_EVENT_DISC_CHAR_BY_UUID_DONE:
+        status = uhos_ble_pal_gattc_op_issue(conn_id, &item.op, &pending);
+        if (!pending)
         {
-            evt_param.conn_handle = conn_id;
-            evt_param.common_rsp.succ = true;
+            uhos_ble_pal_gattc_op_complete(conn_id, item.op_id, status);
+        }
+    } while (!pending);
+}
 
-            g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_CHAR_DISCOVER_DONE, &evt_param);
+/**
+ * @brief       对端是否在协议栈的绑定设备列表中
+ */
+static uhos_bool uhos_ble_pal_gattc_peer_bonded(const uhos_u8 *bda)
+{
+    esp_ble_bond_dev_t *list   = UHOS_NULL;
+    uhos_bool           bonded = UHOS_FALSE;
+    int                 num    = esp_ble_get_bond_device_num();
+    int                 i      = 0;
 
-            break;
+    if (num <= 0)
+    {
+        return UHOS_FALSE;
+    }
+
+    list = (esp_ble_bond_dev_t *)uhos_libc_malloc(num * sizeof(esp_ble_bond_dev_t));
+    if (UHOS_NULL == list)
+    {
+        UHOS_LOGE("malloc fail");
+        return UHOS_FALSE;
+    }
+
+    if (ESP_OK == esp_ble_get_bond_device_list(&num, list))
+    {
+        for (i = 0; (i < num) && !bonded; i++)
+        {
+            bonded = (0 == uhos_libc_memcmp(list[i].bd_addr, bda, sizeof(esp_bd_addr_t)));
         }
+    }
+    uhos_libc_free(list);
+
+    return bonded;
+}
+
+/**
+ * @brief       新连接建立，分配操作队列并加载对端的属性数据库缓存
+ * @note        缓存中有Database Hash时，需在发现服务时校验通过后才可使用；
+ *              没有Database Hash时只有已绑定的对端可直接使用，Service Changed只发给已绑定的客户端，
+ *              未绑定的对端升级固件改变属性布局后本端无从得知，须重新发现
+ */
+static void uhos_ble_pal_gattc_conn_open(uhos_u16 conn_id, const uhos_u8 *bda)
+{
+    uhos_ble_pal_gattc_conn_t *conn   = UHOS_NULL;
+    uhos_ble_pal_gattc_db_t   *db     = uhos_ble_pal_gattc_cache_load(bda);
+    uhos_bool                  bonded = (UHOS_NULL != db) ? uhos_ble_pal_gattc_peer_bonded(bda) : UHOS_FALSE;
+    uhos_u8                    i      = 0;
+
+    uhos_ble_pal_gattc_lock();
 
-        case APP_BLE_GATT_EVENT_DISC_DESP:
+    conn = uhos_ble_pal_gattc_conn_find(conn_id);
+    for (i = 0; (UHOS_NULL == conn) && (i < CONFIG_UHOS_BLE_MAX_CONN); i++)
+    {
+        if (!g_uhos_ble_pal_gattc_ctl.conn[i].used)
         {
-            evt_param.conn_handle = conn_id;
+            conn = &g_uhos_ble_pal_gattc_ctl.conn[i];
+        }
+    }
 
-            evt_param.char_desc_disc_rsp.char_desc_handle = param->dis_desc.attr_hdl;
+    if (conn && !conn->used)
+    {
+        uhos_libc_memset(conn, 0, sizeof(uhos_ble_pal_gattc_conn_t));
+        conn->used         = 1;
+        conn->conn_id      = conn_id;
+        conn->connect_time = uhos_current_time_get();
+        conn->db           = db;
+        conn->db_valid     = (db && !(db->hash_handle && db->hash_valid) && bonded) ? 1 : 0;
+        uhos_libc_memcpy(conn->bda, bda, sizeof(uhos_ble_addr_t));
+        db = UHOS_NULL;
+    }
 
-            if(param->dis_desc.uuid_len == UPLUG_BLE_UUID_16_LEN)
-            {
-                evt_param.char_desc_disc_rsp.char_desc_uuid.type = UHOS_BLE_UUID_TYPE_16;
-            }
-            else
-            {
-                evt_param.char_desc_disc_rsp.char_desc_uuid.type = UHOS_BLE_UUID_TYPE_128;
-            }
+    uhos_ble_pal_gattc_unlock();
 
-            uhos_libc_memcpy(evt_param.char_desc_disc_rsp.char_desc_uuid.uuid128,
-                             param->dis_desc.uuid,
-                             param->dis_desc.uuid_len);
+    if (UHOS_NULL == conn)
+    {
+        UHOS_LOGE("gattc conn table full, conn %d", conn_id);
+    }
+
+    uhos_libc_free(db);
+}
+
+/**
+ * @brief       连接断开，以失败结束队列中所有操作并释放操作队列和属性数据库缓存
+ */
+static void uhos_ble_pal_gattc_conn_close(uhos_u16 conn_id)
+{
+    uhos_ble_pal_gattc_conn_t   *conn  = UHOS_NULL;
+    uhos_ble_pal_gattc_db_t     *db    = UHOS_NULL;
+    uhos_ble_pal_gattc_op_item_t items[CONFIG_UHOS_BLE_GATTC_OP_QUEUE_NUM];
+    uhos_u32                     now   = uhos_current_time_get();
+    uhos_u8                      count = 0;
+    uhos_u8                      i     = 0;
 
+    uhos_ble_pal_gattc_lock();
 
-            if (g_uhos_ble_pal_gattc_op[param->dis_desc.conidx] == UHOS_BLE_GATTC_EVT_CHAR_DESC_DISCOVER_RESP)
+    conn = uhos_ble_pal_gattc_conn_find(conn_id);
+    if (conn)
+    {
+        for (i = 0; i < conn->count; i++)
+        {
+            items[i] = conn->ops[(conn->head + i) % CONFIG_UHOS_BLE_GATTC_OP_QUEUE_NUM];
+            if (!conn->busy || (0 != i))
             {
-                g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_CHAR_DESC_DISCOVER_RESP, &evt_param);
+                // 未下发的操作
+                items[i].issue_time = now;
             }
+        }
 
-            break;
+        count = conn->count;
+        db    = conn->db;
+        uhos_libc_memset(conn, 0, sizeof(uhos_ble_pal_gattc_conn_t));
+    }
+
+    uhos_ble_pal_gattc_unlock();
+
+    uhos_libc_free(db);
+
+    for (i = 0; i < count; i++)
+    {
+        uhos_ble_pal_gattc_op_notify(conn_id, &items[i], UHOS_BLE_ERROR);
+    }
+}
+
+/**
+ * @brief       写请求/写命令完成事件的处理
+ * @note        协议栈对写命令同样产生ESP_GATTC_WRITE_CHAR_EVT，且与写请求按下发顺序上报，
+ *              先于队首写请求下发的写命令事件不结束写请求
+ */
+static void uhos_ble_pal_gattc_write_evt_handle(uhos_u16 conn_id, esp_gatt_status_t status)
+{
+    uhos_ble_pal_gattc_conn_t *conn  = UHOS_NULL;
+    uhos_u32                   op_id = 0;
+    uhos_bool                  req   = UHOS_FALSE;
+    uhos_bool                  cmd   = UHOS_FALSE;
+
+    uhos_ble_pal_gattc_lock();
+
+    conn = uhos_ble_pal_gattc_conn_find(conn_id);
+    if (conn)
+    {
+        if (conn->cmd_ahead)
+        {
+            conn->cmd_ahead--;
+            conn->cmd_pending--;
+            cmd = UHOS_TRUE;
+        }
+        else if (conn->busy && (UHOS_BLE_GATTC_OP_WRITE == conn->ops[conn->head].op.type))
+        {
+            op_id = conn->ops[conn->head].op_id;
+            req   = UHOS_TRUE;
+        }
+        else if (conn->cmd_pending)
+        {
+            conn->cmd_pending--;
+            cmd = UHOS_TRUE;
         }
+    }
 
-        case APP_BLE_GATT_EVENT_DISC_DESP_DONE:
+    uhos_ble_pal_gattc_unlock();
+
+    if (req || cmd)
+    {
+        uhos_ble_pal_bench_op_done(conn_id, req ? UHOS_BLE_BENCH_WRITE_REQ : UHOS_BLE_BENCH_WRITE_CMD,
+                                   (ESP_GATT_OK == status));
+    }
+
+    if (cmd)
+    {
+        uhos_ble_pal_frag_tx_done(conn_id, UHOS_BLE_FRAG_LINK_WRITE_CMD);
+    }
+
+    if (req)
+    {
+        if (ESP_GATT_OK == status)
         {
-            evt_param.conn_handle = conn_id;
+            uhos_ble_pal_gattc_first_write(conn_id);
+        }
+
+        uhos_ble_pal_gattc_op_complete(conn_id, op_id, (ESP_GATT_OK == status) ? UHOS_BLE_SUCCESS : UHOS_BLE_ERROR);
+        uhos_ble_pal_gattc_op_kick(conn_id);
+    }
+}
+
+/**
+ * @brief       协议栈gattc层的回调函数实现
+ * @param[in]   event       回调事件
+ * @param[in]   gattc_if    GATT接口
+ * @param[in]   param       回调参数
+ * @return      无
+ */
+static void uhos_ble_pal_gattc_stack_cb(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if, esp_ble_gattc_cb_param_t *param)
+{
+    uhos_ble_gattc_evt_param_t evt_param = {0};
+    uhos_ble_gattc_op_type_t   type      = UHOS_BLE_GATTC_OP_PRIMARY_SERVICE_DISCOVER_ALL;
+    uhos_ble_pal_gattc_db_t   *db        = UHOS_NULL;
+    uhos_u32                   op_id     = 0;
 
-            evt_param.common_rsp.succ  = true;
+    // 输入参数检查
+    if (UHOS_NULL == param)
+    {
+        UHOS_LOGE("input param is null");
+        return;
+    }
 
-            if (g_uhos_ble_pal_gattc_op[param->dis_desc.conidx] == UHOS_BLE_GATTC_EVT_CHAR_DESC_DISCOVER_RESP)
+    // 依据事件类型进行操作
+    switch (event)
+    {
+        case ESP_GATTC_REG_EVT:
+        {
+            if (ESP_GATT_OK == param->reg.status)
             {
-                g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_CHAR_DESC_DISCOVER_DONE, &evt_param);
+                esp32_gattc_if = gattc_if;
+            }
+            else
+            {
+                UHOS_LOGE("gattc reg fail, app_id %d status %d", param->reg.app_id, param->reg.status);
             }
-
             break;
         }
 
-        case APP_BLE_GATT_EVENT_READ_RSP:
+        case ESP_GATTC_CONNECT_EVT:
         {
-            bool flag = true;
+            uhos_ble_pal_gattc_conn_open(param->connect.conn_id, param->connect.remote_bda);
+            break;
+        }
 
-            evt_param.conn_handle = conn_id;
+        case ESP_GATTC_DISCONNECT_EVT:
+        {
+            uhos_ble_pal_gattc_conn_close(param->disconnect.conn_id);
+            break;
+        }
 
-            if (param->read_rsp.status !=0)
+        case ESP_GATTC_SEARCH_RES_EVT:
+        {
+            if (!uhos_ble_pal_gattc_op_current(param->search_res.conn_id, &type, &op_id)
+             || ((UHOS_BLE_GATTC_OP_PRIMARY_SERVICE_DISCOVER_ALL != type)
+              && (UHOS_BLE_GATTC_OP_PRIMARY_SERVICE_DISCOVER_BY_UUID != type))
+             || !param->search_res.is_primary)
             {
-                flag = false;
+                break;
             }
 
-            if (g_uhos_ble_pal_gattc_op[param->read_rsp.conidx] != UHOS_BLE_GATTC_EVT_READ_USING_UUID_RESP)
+            evt_param.conn_handle = param->search_res.conn_id;
+
+            evt_param.srv_disc_rsp.primary_srv_range.begin_handle = param->search_res.start_handle;
+            evt_param.srv_disc_rsp.primary_srv_range.end_handle   = param->search_res.end_handle;
+            uhos_ble_pal_gattc_uuid_from_esp(&param->search_res.srvc_id.uuid, &evt_param.srv_disc_rsp.srv_uuid);
+            evt_param.srv_disc_rsp.succ = 1;
+
+            uhos_ble_pal_gattc_evt_report(UHOS_BLE_GATTC_EVT_PRIMARY_SERVICE_DISCOVER_RESP, &evt_param);
+            break;
+        }
+
+        case ESP_GATTC_SEARCH_CMPL_EVT:
+        {
+            if (!uhos_ble_pal_gattc_op_current(param->search_cmpl.conn_id, &type, &op_id))
             {
-                return;
+                break;
             }
 
-            evt_param.read_char_value_rsp.succ = flag;
-
-            if (flag)
+            if (UHOS_BLE_GATTC_OP_PRIMARY_SERVICE_DISCOVER_ALL == type)
             {
-                evt_param.read_char_value_rsp.data = param->read_rsp.value;
-                evt_param.read_char_value_rsp.len  = param->read_rsp.length;
+                uhos_ble_pal_gattc_disc_search_done(param->search_cmpl.conn_id, op_id, param->search_cmpl.status);
             }
-            else
+            else if (UHOS_BLE_GATTC_OP_PRIMARY_SERVICE_DISCOVER_BY_UUID == type)
             {
-                evt_param.read_char_value_rsp.data = NULL;
-                evt_param.read_char_value_rsp.len  = 0;
+                uhos_ble_pal_gattc_op_complete(param->search_cmpl.conn_id, op_id,
+                    (ESP_GATT_OK == param->search_cmpl.status) ? UHOS_BLE_SUCCESS : UHOS_BLE_ERROR);
+                uhos_ble_pal_gattc_op_kick(param->search_cmpl.conn_id);
             }
-
-            g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_READ_CHAR_VALUE_RESP, &evt_param);
-
             break;
         }
 
-        case APP_BLE_GATT_EVENT_READ_CHAR_VALUE:
+        case ESP_GATTC_READ_CHAR_EVT:
         {
-            evt_param.conn_handle = conn_id;
+            if (!uhos_ble_pal_gattc_op_current(param->read.conn_id, &type, &op_id))
+            {
+                break;
+            }
+
+            if (UHOS_BLE_GATTC_OP_PRIMARY_SERVICE_DISCOVER_ALL == type)
+            {
+                uhos_ble_pal_gattc_disc_hash_evt_handle(param->read.conn_id, op_id, param);
+                break;
+            }
 
-            if (g_uhos_ble_pal_gattc_op[param->read_rsp.conidx] == UHOS_BLE_GATTC_EVT_READ_CHAR_VALUE_RESP)
+            evt_param.conn_handle = param->read.conn_id;
+
+            if ((UHOS_BLE_GATTC_OP_READ == type) && (ESP_GATT_OK == param->read.status))
             {
-                evt_param.read_char_value_rsp.len  = param->read_rsp.length;
-                evt_param.read_char_value_rsp.data = param->read_rsp.value;
+                evt_param.read_char_value_rsp.data = param->read.value;
+                evt_param.read_char_value_rsp.len  = param->read.value_len;
                 evt_param.read_char_value_rsp.succ = 1;
 
-                g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_READ_CHAR_VALUE_RESP, &evt_param);
+                uhos_ble_pal_gattc_evt_report(UHOS_BLE_GATTC_EVT_READ_CHAR_VALUE_RESP, &evt_param);
             }
-            else if (g_uhos_ble_pal_gattc_op[param->read_rsp.conidx] == UHOS_BLE_GATTC_EVT_READ_USING_UUID_RESP)
+            else if ((UHOS_BLE_GATTC_OP_READ_BY_UUID == type) && (ESP_GATT_OK == param->read.status))
             {
-                evt_param.read_using_uuid_rsp.char_value_handle = param->read_rsp.handle;
-                evt_param.read_using_uuid_rsp.len = param->read_rsp.length;
-                evt_param.read_using_uuid_rsp.data = param->read_rsp.value;
+                evt_param.read_using_uuid_rsp.char_value_handle = param->read.handle;
+                evt_param.read_using_uuid_rsp.data = param->read.value;
+                evt_param.read_using_uuid_rsp.len  = param->read.value_len;
 
-                g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_READ_USING_UUID_RESP, &evt_param);
+                uhos_ble_pal_gattc_evt_report(UHOS_BLE_GATTC_EVT_READ_USING_UUID_RESP, &evt_param);
             }
-            else if (g_uhos_ble_pal_gattc_op[param->read_rsp.conidx] == UHOS_BLE_GATTC_EVT_READ_CHAR_VALUE_BY_UUID_RESP)
+            else if ((UHOS_BLE_GATTC_OP_READ != type) && (UHOS_BLE_GATTC_OP_READ_BY_UUID != type))
             {
-                evt_param.read_char_value_by_uuid_rsp.char_value_handle = param->read_rsp.handle;
-                evt_param.read_char_value_by_uuid_rsp.len = param->read_rsp.length;
-                evt_param.read_char_value_by_uuid_rsp.data = param->read_rsp.value;
-                evt_param.read_char_value_by_uuid_rsp.succ = true;
-
-                g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_READ_CHAR_VALUE_BY_UUID_RESP, &evt_param);
+                break;
             }
 
+            uhos_ble_pal_gattc_op_complete(param->read.conn_id, op_id,
+                (ESP_GATT_OK == param->read.status) ? UHOS_BLE_SUCCESS : UHOS_BLE_ERROR);
+            uhos_ble_pal_gattc_op_kick(param->read.conn_id);
             break;
         }
 
-        case APP_BLE_GATT_EVENT_READ_USING_UUID:
+        case ESP_GATTC_WRITE_CHAR_EVT:
         {
+            uhos_ble_pal_gattc_write_evt_handle(param->write.conn_id, param->write.status);
             break;
         }
 
-        case APP_BLE_GATT_EVENT_READ_USING_UUID_DONE:
+        case ESP_GATTC_NOTIFY_EVT:
         {
-            evt_param.conn_handle = conn_id;
+            db = uhos_ble_pal_gattc_db_get(param->notify.conn_id);
+            if (db && db->sc_handle && (db->sc_handle == param->notify.handle))
+            {
+                uhos_ble_pal_gattc_cache_invalidate(db->bda);
+            }
 
-            evt_param.common_rsp.succ = true;
+            evt_param.conn_handle = param->notify.conn_id;
 
-            if (g_uhos_ble_pal_gattc_op[param->read_rsp.conidx] == UHOS_BLE_GATTC_EVT_READ_USING_UUID_RESP)
+            evt_param.notification.handle = param->notify.handle;
+            evt_param.notification.len    = param->notify.value_len;
+            evt_param.notification.pdata  = param->notify.value;
+
+            if (param->notify.is_notify)
             {
-                g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_READ_USING_UUID_DONE, &evt_param);
+                uhos_ble_pal_gattc_evt_report(UHOS_BLE_GATTC_EVT_NOTIFICATION, &evt_param);
             }
-            else if (g_uhos_ble_pal_gattc_op[param->read_rsp.conidx] == UHOS_BLE_GATTC_EVT_READ_CHAR_VALUE_BY_UUID_RESP)
+            else
             {
-                //g_uhos_ble_pal_gattc_user_cb(UPLUS_BLE_GATTC_EVT_READ_USING_UUID_DONE,&evt_param);
+                uhos_ble_pal_gattc_evt_report(UHOS_BLE_GATTC_EVT_INDICATION, &evt_param);
             }
-
             break;
         }
 
-        case APP_BLE_GATT_EVENT_WRITE_RSP:
+        case ESP_GATTC_SRVC_CHG_EVT:
         {
-            evt_param.conn_handle = conn_id;
+            uhos_ble_pal_gattc_cache_invalidate(param->srvc_chg.remote_bda);
+            break;
+        }
 
-            if (param->write_rsp.status != 0)
-            {
-                evt_param.write_rsp.succ = 0;
-            }
-            else
+        case ESP_GATTC_CFG_MTU_EVT:
+        {
+            if (ESP_GATT_OK == param->cfg_mtu.status)
             {
-                evt_param.write_rsp.succ = 1;
+                uhos_ble_pal_conn_mtu_set(param->cfg_mtu.conn_id, param->cfg_mtu.mtu);
             }
 
-            if (g_uhos_ble_pal_gattc_op[param->write_rsp.conidx] == UHOS_BLE_GATTC_EVT_WRITE_RESP)
+            if (uhos_ble_pal_gattc_op_current(param->cfg_mtu.conn_id, &type, &op_id)
+             && (UHOS_BLE_GATTC_OP_EXCHANGE_MTU == type))
             {
-                g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_WRITE_RESP, &evt_param);
+                uhos_ble_pal_gattc_op_complete(param->cfg_mtu.conn_id, op_id,
+                    (ESP_GATT_OK == param->cfg_mtu.status) ? UHOS_BLE_SUCCESS : UHOS_BLE_ERROR);
+                uhos_ble_pal_gattc_op_kick(param->cfg_mtu.conn_id);
             }
-
             break;
         }
 
-        case APP_BLE_GATT_EVENT_NOTIFY_IND:
-        case APP_BLE_GATT_EVENT_INDICATE_IND:
+        default:
         {
-            evt_param.conn_handle = conn_id;
+            break;
+        }
+    }
 
-            evt_param.notification.handle = param->notify_ind.handle;
-            evt_param.notification.len    = param->notify_ind.length;
-            evt_param.notification.pdata  = param->notify_ind.value;
+    return;
+}
 
-            if (event == APP_BLE_GATT_EVENT_NOTIFY_IND)
-            {
-                g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_NOTIFICATION, &evt_param);
-            }
-            else
-            {
-                g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_INDICATION, &evt_param);
-            }
+/**
+ * @brief       提交操作的通用实现
+ */
+static uhos_ble_status_t uhos_ble_pal_gattc_op_post(uhos_u16                       conn_handle,
+                                                    uhos_ble_gattc_op_type_t       type,
+                                                    const uhos_ble_handle_range_t *range,
+                                                    const uhos_ble_uuid_t         *uuid,
+                                                    uhos_u16                       handle,
+                                                    const uhos_u8                 *data,
+                                                    uhos_u16                       len)
+{
+    uhos_ble_gattc_op_t op = {0};
+
+    op.type   = type;
+    op.handle = handle;
+    op.data   = data;
+    op.len    = len;
+
+    if (range)
+    {
+        op.range = *range;
+    }
+
+    if (uuid)
+    {
+        op.uuid = *uuid;
+    }
 
-            break;
-        }
+    return uhos_ble_gattc_op_submit(conn_handle, &op, UHOS_NULL);
+}
 
-        case APP_BLE_GATTC_EVT_EXCHANGE_MTU_DONE:
-        {
 
-            evt_param.conn_handle = conn_id;
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       GATT层Client端初始化
+ * @note        须在esp_ble_gattc_app_register之前调用，否则REG事件无人接收，esp32_gattc_if无法获取
+ */
+void uhos_ble_pal_gattc_init(void)
+{
+    esp_err_t ret = ESP_OK;
 
-            evt_param.common_rsp.succ = true;
+    if (UHOS_BLE_SUCCESS != uhos_ble_pal_gattc_mutex_init())
+    {
+        return;
+    }
 
-            g_uhos_ble_pal_gattc_user_cb(UHOS_BLE_GATTC_EVT_EXCHANGE_MTU_DONE, &evt_param);
+    ret = esp_ble_gattc_register_callback(uhos_ble_pal_gattc_stack_cb);
+    if (ESP_OK != ret)
+    {
+        UHOS_LOGE("gattc register error, error code = %x", ret);
+    }
+}
 
-            break;
-        }
+/**
+ * @brief       检查各连接已下发操作是否超时
+ * @note        由BLE守候线程周期调用；超时的操作以UHOS_BLE_TIMEOUT结束并下发队列中的下一个操作，
+ *              避免对端丢失响应时队列一直阻塞到断开连接
+ */
+void uhos_ble_pal_gattc_op_tick(void)
+{
+    uhos_ble_pal_gattc_conn_t *conn = UHOS_NULL;
+    uhos_u16                   conn_id[CONFIG_UHOS_BLE_MAX_CONN];
+    uhos_u32                   op_id[CONFIG_UHOS_BLE_MAX_CONN];
+    uhos_u32                   now  = uhos_current_time_get();
+    uhos_u8                    num  = 0;
+    uhos_u8                    i    = 0;
+
+    if (UHOS_NULL == g_uhos_ble_pal_gattc_ctl.mutex)
+    {
+        return;
+    }
 
-        case APP_BLE_GATT_EVT_RSSI_IND:
-        {
-            //hal_report_gatt_connect(param->rssi_ind.rssi);
-            break;
-        }
+    uhos_ble_pal_gattc_lock();
 
-        default:
+    for (i = 0; i < CONFIG_UHOS_BLE_MAX_CONN; i++)
+    {
+        conn = &g_uhos_ble_pal_gattc_ctl.conn[i];
+        if (conn->used && conn->busy
+            && ((uhos_u32)(now - conn->ops[conn->head].issue_time) >= CONFIG_UHOS_BLE_GATTC_OP_TIMEOUT_MS))
         {
-            break;
+            conn_id[num] = conn->conn_id;
+            op_id[num]   = conn->ops[conn->head].op_id;
+            num++;
         }
     }
 
-    return;
-}
+    uhos_ble_pal_gattc_unlock();
 
+    for (i = 0; i < num; i++)
+    {
+        UHOS_LOGW("conn %d op %u timeout", conn_id[i], op_id[i]);
+        uhos_ble_pal_gattc_op_complete(conn_id[i], op_id[i], UHOS_BLE_TIMEOUT);
+        uhos_ble_pal_gattc_op_kick(conn_id[i]);
+    }
+}
 
-/**************************************************************************************************/
-/*                                          全局函数实现                                          */
-/**************************************************************************************************/
 /**
  * @brief       注册GATT层client端用户回调函数
  * @param[in]   cb  用户回调函数
@@ -415,135 +1828,190 @@ static void uhos_ble_pal_gattc_stack_cb(app_ble_gatt_event_t event, app_ble_gatt
  */
 uhos_ble_status_t uhos_ble_gattc_callback_register(uhos_ble_gattc_callback_t cb)
 {
+    esp_err_t ret = ESP_OK;
+
+    if (UHOS_BLE_SUCCESS != uhos_ble_pal_gattc_mutex_init())
+    {
+        return UHOS_BLE_ERROR;
+    }
+
     g_uhos_ble_pal_gattc_user_cb = cb;
-    ble_set_gatt_callback(uhos_ble_pal_gattc_stack_cb);
+
+    ret = esp_ble_gattc_register_callback(uhos_ble_pal_gattc_stack_cb);
+    if (ESP_OK != ret)
+    {
+        UHOS_LOGE("gattc register error, error code = %x", ret);
+        return UHOS_BLE_ERROR;
+    }
 
     return UHOS_BLE_SUCCESS;
 }
 
 /**
- * @brief       首要服务发现
- * @param[in]   conn_handle     连接句柄
- * @param[in]   handle_range    服务ID的范围
- * @param[in]   p_srv_uuid      UUID的描述
+ * @brief       注册GATT层client端操作完成回调函数
+ * @param[in]   cb  操作完成回调函数
  * @return      uhos_ble_status_t
  */
-uhos_ble_status_t uhos_ble_gattc_primary_service_discover_all(
-    uhos_u16 conn_handle,
-    void    *req)
+uhos_ble_status_t uhos_ble_gattc_op_callback_register(uhos_ble_gattc_op_cb_t cb)
 {
-    uhos_u8  conidx = 0;
-    uhos_u16 retval = 0;
-
-    // 检查连接状态
-    conidx = uhos_ble_pal_conn_id_switch(conn_handle, UHOS_BLE_CONNECT_SWITCH_MODE_DEC);
-
-    if (!app_get_connect_status(conidx))
+    if (UHOS_BLE_SUCCESS != uhos_ble_pal_gattc_mutex_init())
     {
-        UHOS_LOGE("conn dis 0x%x", conidx);
         return UHOS_BLE_ERROR;
     }
 
-    // 调用协议栈接口
-    g_uhos_ble_pal_gattc_op[conidx] = UHOS_BLE_GATTC_EVT_PRIMARY_SERVICE_DISCOVER_RESP;
-
-    retval = sonata_ble_gatt_disc_all_svc(conidx);
-
-    if (retval != API_SUCCESS)
-    {
-        UHOS_LOGE("primary service discover all fail 0x%4x", retval);
-        return UHOS_BLE_ERROR;
-    }
+    g_uhos_ble_pal_gattc_ctl.op_cb = cb;
 
     return UHOS_BLE_SUCCESS;
 }
 
 /**
- * @brief       通过UUID启动首要服务发现
- * @param[in]   conn_handle     连接句柄
- * @param[in]   handle_range    服务ID的范围
- * @param[in]   p_srv_uuid      UUID的描述
+ * @brief       提交一个GATT client操作
+ * @param[in]   conn_handle 连接句柄
+ * @param[in]   op          操作请求
+ * @param[out]  op_id       分配的操作ID，可为UHOS_NULL
  * @return      uhos_ble_status_t
  */
-uhos_ble_status_t uhos_ble_gattc_primary_service_discover_by_uuid(
-    uhos_u16                 conn_handle,
-    uhos_ble_handle_range_t *handle_range,
-    uhos_ble_uuid_t         *p_srv_uuid)
+uhos_ble_status_t uhos_ble_gattc_op_submit(uhos_u16 conn_handle, const uhos_ble_gattc_op_t *op, uhos_u32 *op_id)
 {
-    uhos_u8  conidx   = 0;
-    uhos_u8  uuid_len = 0;
-    uhos_u16 retval   = 0;
+    uhos_ble_pal_gattc_ctl_t     *ctl  = &g_uhos_ble_pal_gattc_ctl;
+    uhos_ble_pal_gattc_conn_t    *conn = UHOS_NULL;
+    uhos_ble_pal_gattc_op_item_t *item = UHOS_NULL;
+    uhos_u8                      *data = UHOS_NULL;
+    uhos_u32                      id   = 0;
 
-    // 检查连接状态
-    conidx = uhos_ble_pal_conn_id_switch(conn_handle, UHOS_BLE_CONNECT_SWITCH_MODE_DEC);
+    // 输入参数检查
+    if ((UHOS_NULL == op) || (op->type > UHOS_BLE_GATTC_OP_EXCHANGE_MTU))
+    {
+        UHOS_LOGE("invalid op");
+        return UHOS_BLE_ERROR;
+    }
 
-    if (!app_get_connect_status(conidx))
+    if (UHOS_NULL == ctl->mutex)
     {
-        UHOS_LOGE("conn dis 0x%x", conidx);
+        UHOS_LOGE("gattc not inited");
         return UHOS_BLE_ERROR;
     }
 
-    // 获取UUID的长度
-    if (UHOS_BLE_UUID_TYPE_16 == p_srv_uuid->type)
+    // 拷贝写入数据
+    if (UHOS_BLE_GATTC_OP_WRITE == op->type)
+    {
+        if ((UHOS_NULL == op->data) || (0 == op->len))
+        {
+            UHOS_LOGE("invalid write data");
+            return UHOS_BLE_ERROR;
+        }
+
+        data = uhos_libc_malloc(op->len);
+        if (UHOS_NULL == data)
+        {
+            UHOS_LOGE("malloc fail");
+            return UHOS_BLE_ERROR;
+        }
+        uhos_libc_memcpy(data, op->data, op->len);
+        uhos_ble_pal_bench_alloc();
+    }
+
+    // 入队
+    uhos_ble_pal_gattc_lock();
+
+    conn = uhos_ble_pal_gattc_conn_find(conn_handle);
+    if ((UHOS_NULL == conn) || (conn->count >= CONFIG_UHOS_BLE_GATTC_OP_QUEUE_NUM))
     {
-        uuid_len = UPLUG_BLE_UUID_16_LEN;
+        uhos_ble_pal_gattc_unlock();
+        uhos_libc_free(data);
+
+        if (UHOS_NULL == conn)
+        {
+            UHOS_LOGE("conn dis 0x%x", conn_handle);
+            return UHOS_BLE_ERROR;
+        }
+
+        return UHOS_BLE_BUSY;
     }
-    else
+
+    if (0 == ++ctl->op_id)
     {
-        uuid_len = UPLUG_BLE_UUID_128_LEN;
+        ++ctl->op_id;
     }
+    id = ctl->op_id;
 
-    // 通过协议栈接口发现服务
-    g_uhos_ble_pal_gattc_op[conidx] = UHOS_BLE_GATTC_EVT_PRIMARY_SERVICE_DISCOVER_RESP;
+    item = &conn->ops[(conn->head + conn->count) % CONFIG_UHOS_BLE_GATTC_OP_QUEUE_NUM];
+    item->op          = *op;
+    item->op.data     = data;
+    item->op_id       = id;
+    item->submit_time = uhos_current_time_get();
+    item->issue_time  = item->submit_time;
+    conn->count++;
 
-    retval = sonata_ble_gatt_disc_svc_by_uuid(conidx,
-                                              handle_range->begin_handle,
-                                              handle_range->end_handle,
-                                              uuid_len,
-                                              p_srv_uuid->uuid128);
+    uhos_ble_pal_gattc_unlock();
 
-    if (API_SUCCESS != retval)
+    if (op_id)
     {
-        UHOS_LOGE("primary service discover by uuid fail 0x%4x",retval);
-        return UHOS_BLE_ERROR;
+        *op_id = id;
     }
 
+    // 连接空闲时立即下发
+    uhos_ble_pal_gattc_op_kick(conn_handle);
+
     return UHOS_BLE_SUCCESS;
 }
 
 /**
- * @brief       启动服务特征发现
+ * @brief       首要服务发现
  * @param[in]   conn_handle     连接句柄
- * @param[in]   handle_range    句柄范围
+ * @param[in]   req             保留，为兼容原有接口不使用
  * @return      uhos_ble_status_t
  */
-uhos_ble_status_t uhos_ble_gattc_char_discover_of_service(
-    uhos_u16                 conn_handle,
-    uhos_ble_handle_range_t *char_handle_range)
+uhos_ble_status_t uhos_ble_gattc_primary_service_discover_all(
+    uhos_u16 conn_handle,
+    void    *req)
 {
-    uhos_u8  conidx = 0;
-    uhos_u16 retval = 0;
+    (void)req;
 
-    // 检查连接状态
-    conidx = uhos_ble_pal_conn_id_switch(conn_handle, UHOS_BLE_CONNECT_SWITCH_MODE_DEC);
+    return uhos_ble_pal_gattc_op_post(conn_handle, UHOS_BLE_GATTC_OP_PRIMARY_SERVICE_DISCOVER_ALL,
+                                      UHOS_NULL, UHOS_NULL, 0, UHOS_NULL, 0);
+}
 
-    if (!app_get_connect_status(conidx))
+/**
+ * @brief       通过UUID启动首要服务发现
+ * @param[in]   conn_handle     连接句柄
+ * @param[in]   handle_range    服务ID的范围
+ * @param[in]   p_srv_uuid      UUID的描述
+ * @return      uhos_ble_status_t
+ */
+uhos_ble_status_t uhos_ble_gattc_primary_service_discover_by_uuid(
+    uhos_u16                 conn_handle,
+    uhos_ble_handle_range_t *handle_range,
+    uhos_ble_uuid_t         *p_srv_uuid)
+{
+    if (UHOS_NULL == p_srv_uuid)
     {
-        UHOS_LOGE("conn dis 0x%x", conidx);
+        UHOS_LOGE("input param is null");
         return UHOS_BLE_ERROR;
     }
 
-    g_uhos_ble_pal_gattc_op[conidx] = UHOS_BLE_GATTC_EVT_CHAR_DISCOVER_RESP;
-    retval = sonata_ble_gatt_disc_all_characteristic(conidx,
-                                                     char_handle_range->begin_handle,
-                                                     char_handle_range->end_handle);
-    if (API_SUCCESS != retval)
+    return uhos_ble_pal_gattc_op_post(conn_handle, UHOS_BLE_GATTC_OP_PRIMARY_SERVICE_DISCOVER_BY_UUID,
+                                      handle_range, p_srv_uuid, 0, UHOS_NULL, 0);
+}
+
+/**
+ * @brief       启动服务特征发现
+ * @param[in]   conn_handle     连接句柄
+ * @param[in]   handle_range    句柄范围
+ * @return      uhos_ble_status_t
+ */
+uhos_ble_status_t uhos_ble_gattc_char_discover_of_service(
+    uhos_u16                 conn_handle,
+    uhos_ble_handle_range_t *char_handle_range)
+{
+    if (UHOS_NULL == char_handle_range)
     {
-        UHOS_LOGE("char discover of service fail 0x%4x",retval);
+        UHOS_LOGE("input param is null");
         return UHOS_BLE_ERROR;
     }
 
-    return UHOS_BLE_SUCCESS;
+    return uhos_ble_pal_gattc_op_post(conn_handle, UHOS_BLE_GATTC_OP_CHAR_DISCOVER,
+                                      char_handle_range, UHOS_NULL, 0, UHOS_NULL, 0);
 }
 
 
@@ -559,46 +2027,14 @@ uhos_ble_status_t uhos_ble_gattc_char_discover_by_uuid(
     uhos_ble_handle_range_t *handle_range,
     uhos_ble_uuid_t *        p_char_uuid)
 {
-    uhos_u8  conidx   = 0;
-    uhos_u8  uuid_len = 0;
-    uhos_u16 retval   = 0;
-
-    // 检查连接状态
-    conidx = uhos_ble_pal_conn_id_switch(conn_handle, UHOS_BLE_CONNECT_SWITCH_MODE_DEC);
-
-    if(!app_get_connect_status(conidx))
-    {
-        UHOS_LOGE("conn dis 0x%x", conidx);
-        return UHOS_BLE_ERROR;
-    }
-
-    // 获取UUID的长度
-    if (UHOS_BLE_UUID_TYPE_16 == p_char_uuid->type)
-    {
-        uuid_len = UPLUG_BLE_UUID_16_LEN;
-    }
-    else
-    {
-        uuid_len = UPLUG_BLE_UUID_128_LEN;
-    }
-
-    // 调用协议栈接口发现特征
-    g_uhos_ble_pal_gattc_op[conidx] = UHOS_BLE_GATTC_EVT_CHAR_DISCOVER_BY_UUID_RESP;
-
-    retval  = sonata_ble_gatt_disc_characteristic_by_uuid(conidx,
-                                                          handle_range->begin_handle,
-                                                          handle_range->end_handle,
-                                                          uuid_len,
-                                                          p_char_uuid->uuid128);
-
-    if (API_SUCCESS != retval)
+    if ((UHOS_NULL == handle_range) || (UHOS_NULL == p_char_uuid))
     {
-        UHOS_LOGE("gattc char discover by uuid fail 0x%4x", retval);
+        UHOS_LOGE("input param is null");
         return UHOS_BLE_ERROR;
     }
 
-    return UHOS_BLE_SUCCESS;
-
+    return uhos_ble_pal_gattc_op_post(conn_handle, UHOS_BLE_GATTC_OP_CHAR_DISCOVER_BY_UUID,
+                                      handle_range, p_char_uuid, 0, UHOS_NULL, 0);
 }
 
 /**
@@ -611,69 +2047,28 @@ uhos_ble_status_t uhos_ble_gattc_clt_cfg_descriptor_discover(
     uhos_u16                 conn_handle,
     uhos_ble_handle_range_t *handle_range)
 {
-    uhos_u8  conidx = 0;
-    uhos_u16 retval = 0;
-
-    // 检查连接状态
-    conidx = uhos_ble_pal_conn_id_switch(conn_handle, UHOS_BLE_CONNECT_SWITCH_MODE_DEC);
-
-    if(!app_get_connect_status(conidx))
-    {
-        UHOS_LOGE("conn dis 0x%x", conidx);
-        return UHOS_BLE_ERROR;
-    }
-
-    // 调用协议栈接口
-    g_uhos_ble_pal_gattc_op[conidx] = UHOS_BLE_GATTC_EVT_CHAR_DESC_DISCOVER_RESP;
-
-    retval = sonata_ble_gatt_disc_all_descriptor(conidx,
-                                                 handle_range->begin_handle,
-                                                 handle_range->end_handle);
-
-    if (API_SUCCESS != retval)
+    if (UHOS_NULL == handle_range)
     {
-        UHOS_LOGE("char descriptor discover all fail 0x%4x", retval);
+        UHOS_LOGE("input param is null");
         return UHOS_BLE_ERROR;
     }
 
-    return UHOS_BLE_SUCCESS;
+    return uhos_ble_pal_gattc_op_post(conn_handle, UHOS_BLE_GATTC_OP_CHAR_DESC_DISCOVER,
+                                      handle_range, UHOS_NULL, 0, UHOS_NULL, 0);
 }
 
 /**
  * @brief       读取特征值
- * @param[in]   conn_handle     连接ID
- * @param[in]   handle_range    句柄范围
+ * @param[in]   conn_handle         连接ID
+ * @param[in]   char_value_handle   特征值句柄
  * @return      uhos_ble_status_t
  */
 uhos_ble_status_t uhos_ble_gattc_read_char_value(
     uhos_u16 conn_handle,
     uhos_u16 char_value_handle)
 {
-    uhos_u8  conidx = 0;
-    uhos_u16 retval = 0;
-
-    // 连接状态检查
-    conidx = uhos_ble_pal_conn_id_switch(conn_handle, UHOS_BLE_CONNECT_SWITCH_MODE_DEC);
-
-    if (!app_get_connect_status(conidx))
-    {
-        UHOS_LOGE("conn dis 0x%x", conidx);
-        return UHOS_BLE_ERROR;
-    }
-
-    // 调用协议栈接口
-    g_uhos_ble_pal_gattc_op[conidx] = UHOS_BLE_GATTC_EVT_READ_CHAR_VALUE_RESP;
-
-    retval = sonata_ble_gatt_read_by_handle(conidx, char_value_handle);
-
-    if (API_SUCCESS != retval)
-    {
-        UHOS_LOGE("read char value fail 0x%4x", retval);
-
-        return UHOS_BLE_ERROR;
-    }
-
-    return UHOS_BLE_SUCCESS;
+    return uhos_ble_pal_gattc_op_post(conn_handle, UHOS_BLE_GATTC_OP_READ,
+                                      UHOS_NULL, UHOS_NULL, char_value_handle, UHOS_NULL, 0);
 }
 
 /**
@@ -688,46 +2083,14 @@ uhos_ble_status_t uhos_ble_gattc_read_char_value_by_uuid(
     uhos_ble_handle_range_t *handle_range,
     uhos_ble_uuid_t         *p_char_uuid)
 {
-    uhos_u8  conidx   = 0;
-    uhos_u8  uuid_len = 0;
-    uhos_u16 retval   = 0;
-
-    // 检查连接状态
-    conidx = uhos_ble_pal_conn_id_switch(conn_handle, UHOS_BLE_CONNECT_SWITCH_MODE_DEC);
-
-    if (!app_get_connect_status(conidx))
-    {
-        UHOS_LOGE("conn dis 0x%x", conidx);
-        return UHOS_BLE_ERROR;
-    }
-
-    // 获取UUID的长度
-    if (UHOS_BLE_UUID_TYPE_16 == p_char_uuid->type)
-    {
-        uuid_len = UPLUG_BLE_UUID_16_LEN;
-    }
-    else
+    if ((UHOS_NULL == handle_range) || (UHOS_NULL == p_char_uuid))
     {
-        uuid_len = UPLUG_BLE_UUID_128_LEN;
-    }
-
-    // 调用协议栈接口
-    g_uhos_ble_pal_gattc_op[conidx] = UHOS_BLE_GATTC_EVT_READ_USING_UUID_RESP;
-
-    retval = sonata_ble_gatt_read_by_uuid(conidx,
-                                          0,
-                                          handle_range->begin_handle,
-                                          handle_range->end_handle,
-                                          uuid_len,
-                                          p_char_uuid->uuid128);
-
-    if (API_SUCCESS != retval)
-    {
-        UHOS_LOGE("read char value by uuid fail 0x%4x", retval);
+        UHOS_LOGE("input param is null");
         return UHOS_BLE_ERROR;
     }
 
-    return UHOS_BLE_SUCCESS;
+    return uhos_ble_pal_gattc_op_post(conn_handle, UHOS_BLE_GATTC_OP_READ_BY_UUID,
+                                      handle_range, p_char_uuid, 0, UHOS_NULL, 0);
 }
 
 /**
@@ -744,41 +2107,18 @@ uhos_ble_status_t uhos_ble_gattc_write_with_rsp(
     uhos_u8 *p_value,
     uhos_u8  len)
 {
-    uhos_u8  conidx = 0;
-    uhos_u16 retval = 0;
-
-    // 检查连接状态
-    conidx = uhos_ble_pal_conn_id_switch(conn_handle, UHOS_BLE_CONNECT_SWITCH_MODE_DEC);
-
-    if (!app_get_connect_status(conidx))
-    {
-        UHOS_LOGE("conn dis 0x%x", conidx);
-        return UHOS_BLE_ERROR;
-    }
-
-    // 调用协议栈接口
-    g_uhos_ble_pal_gattc_op[conidx] = UHOS_BLE_GATTC_EVT_WRITE_RESP;
-
-    retval = sonata_ble_gatt_write(conidx,handle, 0, 0, len, p_value);
-
-    if (API_SUCCESS != retval)
-    {
-        UHOS_LOGE("gattc write with rsp fail 0x%4x", retval);
-        // uh_ble_asr_gattc_optimize(0);
-
-        return UHOS_BLE_ERROR;
-    }
-
-    return UHOS_BLE_SUCCESS;
+    return uhos_ble_pal_gattc_op_post(conn_handle, UHOS_BLE_GATTC_OP_WRITE,
+                                      UHOS_NULL, UHOS_NULL, handle, p_value, len);
 }
 
 /**
  * @brief       GTAA层client写特征值（无响应）
+ * @note        不进入操作队列，可与队列中的操作穿插下发
  * @param[in]   conn_handle 连接句柄
  * @param[in]   handle      特性句柄
  * @param[in]   p_value     写入数据
  * @param[in]   len         写入数据字节数
- * @return      uhos_ble_status_t
+ * @return      uhos_ble_status_t；协议栈队列已满返回UHOS_BLE_BUSY，可稍后重试
  */
 uhos_ble_status_t uhos_ble_gattc_write_without_rsp(
     uhos_u16 conn_handle,
@@ -786,27 +2126,56 @@ uhos_ble_status_t uhos_ble_gattc_write_without_rsp(
     uhos_u8* p_value,
     uhos_u16 len)
 {
-    uhos_u8  conidx = 0;
-    uhos_u16 retval = 0;
+    uhos_ble_pal_gattc_conn_t *conn   = UHOS_NULL;
+    esp_err_t                  retval = ESP_OK;
 
-    // 检查连接状态
-    conidx = uhos_ble_pal_conn_id_switch(conn_handle, UHOS_BLE_CONNECT_SWITCH_MODE_DEC);
+    if (UHOS_NULL == g_uhos_ble_pal_gattc_ctl.mutex)
+    {
+        UHOS_LOGE("gattc not inited");
+        return UHOS_BLE_ERROR;
+    }
+
+    // 检查连接状态；先计数再下发，避免完成事件先于计数到达
+    uhos_ble_pal_gattc_lock();
+    conn = uhos_ble_pal_gattc_conn_find(conn_handle);
+    if (conn)
+    {
+        conn->cmd_pending++;
+    }
+    uhos_ble_pal_gattc_unlock();
 
-    if (!app_get_connect_status(conidx))
+    if (UHOS_NULL == conn)
     {
-        UHOS_LOGE("conn dis 0x%x", conidx);
+        UHOS_LOGE("conn dis 0x%x", conn_handle);
         return UHOS_BLE_ERROR;
     }
 
     // 调用协议栈接口
-    retval = sonata_ble_gatt_write_no_response(conidx, char_value_handle, 0, 0, len, p_value);
+    retval = esp_ble_gattc_write_char(esp32_gattc_if, conn_handle, char_value_handle, len, p_value,
+                                      ESP_GATT_WRITE_TYPE_NO_RSP, ESP_GATT_AUTH_REQ_NONE);
 
-    if (API_SUCCESS != retval)
+    if (ESP_OK != retval)
     {
-        UHOS_LOGE("gattc write with rsp fail 0x%4x", retval);
+        uhos_ble_pal_gattc_lock();
+        conn = uhos_ble_pal_gattc_conn_find(conn_handle);
+        if (conn && conn->cmd_pending)
+        {
+            conn->cmd_pending--;
+        }
+        uhos_ble_pal_gattc_unlock();
+
+        // ESP_FAIL表示协议栈队列暂时无法接收
+        if (ESP_FAIL == retval)
+        {
+            return UHOS_BLE_BUSY;
+        }
+
+        UHOS_LOGE("gattc write without rsp fail 0x%4x", retval);
         return UHOS_BLE_ERROR;
     }
 
+    uhos_ble_pal_gattc_first_write(conn_handle);
+
     return UHOS_BLE_SUCCESS;
 }
 
@@ -824,37 +2193,92 @@ uhos_ble_status_t uhos_ble_gattc_write_cmd(
     uhos_u8 *p_value,
     uhos_u8  len)
 {
-    return UHOS_BLE_ERROR;
+    return uhos_ble_gattc_write_without_rsp(conn_handle, handle, p_value, len);
 }
 
+/**
+ * @brief       发起MTU交换
+ * @param[in]   conn_handle 连接句柄
+ * @param[in]   mtu         本端MTU，0表示使用协议栈当前设置
+ * @return      uhos_ble_status_t
+ */
 uhos_ble_status_t uhos_ble_gattc_exchange_mtu(
     uhos_u16 conn_handle,
     uhos_u16 mtu)
 {
-    uhos_u8 conidx = uhos_ble_pal_conn_id_switch(conn_handle, UHOS_BLE_CONNECT_SWITCH_MODE_DEC);
+    return uhos_ble_pal_gattc_op_post(conn_handle, UHOS_BLE_GATTC_OP_EXCHANGE_MTU,
+                                      UHOS_NULL, UHOS_NULL, 0, UHOS_NULL, mtu);
+}
 
-    if(!app_get_connect_status(conidx))
+/**
+ * @brief       获取连接的MTU
+ * @param[in]   conn_handle 连接句柄
+ * @param[out]  mtu_size    MTU
+ * @return      uhos_ble_status_t
+ */
+uhos_ble_status_t uhos_ble_gattc_mtu_get(uhos_u16 conn_handle, uhos_u16 *mtu_size)
+{
+    if (UHOS_NULL == mtu_size)
     {
-        // APP_HAL_TRC("con dis 0x%x\r\n",conidx);
-        UHOS_LOGW("ble not inited");
         return UHOS_BLE_ERROR;
     }
 
-    uhos_u16 retval = sonata_ble_gatt_exchange_mtu(conidx);
-    if(retval != API_SUCCESS)
+    *mtu_size = uhos_ble_pal_conn_mtu_get(conn_handle);
+
+    return (0 == *mtu_size) ? UHOS_BLE_ERROR : UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       获取GATT client属性缓存的统计信息
+ * @param[out]  stats   统计信息
+ * @return      uhos_ble_status_t
+ */
+uhos_ble_status_t uhos_ble_gattc_cache_stats_get(uhos_ble_gattc_cache_stats_t *stats)
+{
+    if ((UHOS_NULL == stats) || (UHOS_NULL == g_uhos_ble_pal_gattc_ctl.mutex))
     {
-        UHOS_LOGW("exchange mtu fail 0x%4x\r\n", retval);
         return UHOS_BLE_ERROR;
     }
+
+    uhos_ble_pal_gattc_lock();
+    *stats = g_uhos_ble_pal_gattc_ctl.cache_stats;
+    uhos_ble_pal_gattc_unlock();
+
     return UHOS_BLE_SUCCESS;
 }
 
-uhos_ble_status_t uhos_ble_gattc_mtu_get(uhos_u16 conn_handle, uhos_u16 *mtu_size)
+/**
+ * @brief       清除GATT client属性缓存
+ * @note        已连接的对端在下一次发现所有首要服务时重新发现并缓存
+ * @param[in]   addr    对端地址，UHOS_NULL表示所有对端
+ * @return      uhos_ble_status_t
+ */
+uhos_ble_status_t uhos_ble_gattc_cache_clear(const uhos_u8 *addr)
 {
+    uhos_ble_pal_gattc_conn_t *conn = UHOS_NULL;
+    uhos_u8                    i    = 0;
+
+    if (UHOS_NULL == g_uhos_ble_pal_gattc_ctl.mutex)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_pal_gattc_lock();
+
+    for (i = 0; i < CONFIG_UHOS_BLE_MAX_CONN; i++)
+    {
+        conn = &g_uhos_ble_pal_gattc_ctl.conn[i];
+        if (conn->used && conn->db
+         && ((UHOS_NULL == addr) || (0 == uhos_libc_memcmp(conn->bda, addr, sizeof(uhos_ble_addr_t)))))
+        {
+            conn->db_valid       = 0;
+            conn->db->hash_valid = 0;
+        }
+    }
 
-    uhos_u16 conidx = uhos_ble_pal_conn_id_switch(conn_handle, UHOS_BLE_CONNECT_SWITCH_MODE_DEC);
+    uhos_ble_pal_gattc_unlock();
 
-    *mtu_size = app_ble_get_con_mtu((uhos_u8)conidx);
+    uhos_ble_pal_gattc_cache_remove(addr);
 
     return UHOS_BLE_SUCCESS;
 }
@@ -36,6 +36,12 @@
 
 #include "uh_ble.h"
 #include "uh_ble_common.h"
+#include "uh_ble_conn.h"
+#include "uh_ble_evt.h"
+#include "uh_ble_gap.h"
+#include "uh_ble_gatt_server.h"
+#include "uh_ble_bench.h"
+#include "uh_ble_frag_pal.h"
 
 
 /**************************************************************************************************/
@@ -57,60 +63,79 @@
 #define UHOS_BLE_HAL_CHR_PERM_READABLE      0x01
 #define UHOS_BLE_HAL_CHR_PERM_WRITABLE      0x02
 
-#define APP_MAX_SERVICE_NUM                 10
+#define UHOS_BLE_PAL_GATTS_APP_ID           0
 
-#define UHOS_BLE_HAL_PROFILE_NUM 2
-#define UHOS_BLE_HAL_PROFILE_A_APP_ID 0
-#define UHOS_BLE_HAL_PROFILE_B_APP_ID 1
-
-#define GATTS_SERVICE_UUID_TEST_A   0x00FF
-#define GATTS_CHAR_UUID_TEST_A      0xFF01
-#define GATTS_DESCR_UUID_TEST_A     0x3333
-#define GATTS_NUM_HANDLE_TEST_A     4
-
-static esp_attr_value_t heart_rate_attr = {
-    .attr_max_len = 2,
-    .attr_len     = sizeof(heart_rate_val),
-    .attr_value   = heart_rate_val,
-};
+#define UHOS_BLE_PAL_GATTS_CHAR_VAL_LEN     12          //<! 每个特征在属性表中自带的值：声明1 + CCCD2 + 扩展属性2 + 格式7
 
 /**************************************************************************************************/
 /*                                        内部数据类型定义                                        */
 /**************************************************************************************************/
-typedef struct uhos_ble_gatts_profile_inst {
-    esp_gatts_cb_t gatts_cb;
-    uint16_t gatts_if;
-    uint16_t app_id;
-    uint16_t conn_id;
-    uint16_t service_handle;
-    esp_gatt_srvc_id_t service_id;
-    uint16_t char_handle;
-    esp_bt_uuid_t char_uuid;
-    esp_gatt_perm_t perm;
-    esp_gatt_char_prop_t property;
-    uint16_t descr_handle;
-    esp_bt_uuid_t descr_uuid;
-}uhos_ble_gatts_profile_inst_t;
-
-///Declare the static function
-static void gatts_profile_a_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param);
-
-static uhos_ble_gatts_profile_inst_t uhos_ble_profile_tab[UHOS_BLE_HAL_PROFILE_NUM] = {
-    [UHOS_BLE_HAL_PROFILE_A_APP_ID] = {
-        .gatts_cb = gatts_profile_a_event_handler,
-        .gatts_if = ESP_GATT_IF_NONE,       /* Not get the gatt_if, so initial is ESP_GATT_IF_NONE */
-    },
-    [UHOS_BLE_HAL_PROFILE_B_APP_ID] = {
-        .gatts_cb = NULL,                   /* This demo does not implement, similar as profile A */
-        .gatts_if = ESP_GATT_IF_NONE,       /* Not get the gatt_if, so initial is ESP_GATT_IF_NONE */
-    },
-};
+/**
+ * @enum        属性在服务中的角色
+ */
+typedef enum
+{
+    UHOS_BLE_PAL_GATTS_ATTR_NONE = 0,                           //<! 句柄未被本端服务使用
+    UHOS_BLE_PAL_GATTS_ATTR_SERVICE,                            //<! 服务声明
+    UHOS_BLE_PAL_GATTS_ATTR_CHAR_DECL,                          //<! 特征声明
+    UHOS_BLE_PAL_GATTS_ATTR_CHAR_VALUE,                         //<! 特征值
+    UHOS_BLE_PAL_GATTS_ATTR_CCCD,                               //<! 客户端特征配置描述符
+    UHOS_BLE_PAL_GATTS_ATTR_DESC,                               //<! 其他描述符
+} uhos_ble_pal_gatts_attr_kind_t;
+
+/**
+ * @struct      句柄查找表项，以(句柄 - 起始句柄)为下标
+ */
+typedef struct uhos_ble_pal_gatts_attr
+{
+    uhos_u8 kind;                                               //<! uhos_ble_pal_gatts_attr_kind_t
+    uhos_u8 srv;                                                //<! 服务在g_uhos_ble_pal_gatts_srv中的下标
+    uhos_u8 chr;                                                //<! 特征在服务p_char_db中的下标
+} uhos_ble_pal_gatts_attr_t;
+
+/**
+ * @enum        服务的创建状态
+ */
+typedef enum
+{
+    UHOS_BLE_PAL_GATTS_SRV_PENDING = 0,                         //<! 等待应用注册完成
+    UHOS_BLE_PAL_GATTS_SRV_CREATING,                            //<! 属性表已提交协议栈
+    UHOS_BLE_PAL_GATTS_SRV_STARTED,                             //<! 句柄已分配，服务已启动
+    UHOS_BLE_PAL_GATTS_SRV_FAILED,                              //<! 创建失败
+} uhos_ble_pal_gatts_srv_state_t;
+
+/**
+ * @struct      本端服务
+ */
+typedef struct uhos_ble_pal_gatts_srv
+{
+    uhos_ble_gatts_srv_db_t *db;                                //<! 用户的服务描述，句柄回填到其中
+    uhos_ble_gatts_cb_t      cb;                                //<! 服务的回调，UHOS_NULL时使用全局回调
+    uhos_u8                  state;                             //<! uhos_ble_pal_gatts_srv_state_t
+    uhos_u16                 attr_num;                          //<! 属性表的属性个数
+    esp_gatts_attr_db_t     *tab;                               //<! 提交给协议栈的属性表，创建完成后释放
+    uhos_u8                 *vals;                              //<! 属性表引用的声明及描述符的值
+} uhos_ble_pal_gatts_srv_t;
 
 /**************************************************************************************************/
 /*                                        全局(静态)变量                                          */
 /**************************************************************************************************/
 uhos_ble_gatts_cb_t g_uhos_ble_pal_gatts_user_cb = UHOS_NULL;   //<! GATT层用户设置的server端回调函数
 
+static esp_gatt_if_t             g_uhos_ble_pal_gatts_if = ESP_GATT_IF_NONE;
+static uhos_ble_pal_gatts_srv_t  g_uhos_ble_pal_gatts_srv[CONFIG_UHOS_BLE_GATTS_SRV_NUM];
+static uhos_u8                   g_uhos_ble_pal_gatts_srv_num = 0;
+static uhos_ble_pal_gatts_attr_t g_uhos_ble_pal_gatts_attr[CONFIG_UHOS_BLE_GATTS_ATTR_NUM];
+static uhos_u16                  g_uhos_ble_pal_gatts_base = 0;  //<! 查找表下标0对应的句柄，0表示未确定
+
+static const uhos_u16 g_uhos_ble_pal_gatts_pri_uuid  = ESP_GATT_UUID_PRI_SERVICE;
+static const uhos_u16 g_uhos_ble_pal_gatts_sec_uuid  = ESP_GATT_UUID_SEC_SERVICE;
+static const uhos_u16 g_uhos_ble_pal_gatts_decl_uuid = ESP_GATT_UUID_CHAR_DECLARE;
+static const uhos_u16 g_uhos_ble_pal_gatts_cccd_uuid = ESP_GATT_UUID_CHAR_CLIENT_CONFIG;
+static const uhos_u16 g_uhos_ble_pal_gatts_ext_uuid  = ESP_GATT_UUID_CHAR_EXT_PROP;
+static const uhos_u16 g_uhos_ble_pal_gatts_desc_uuid = ESP_GATT_UUID_CHAR_DESCRIPTION;
+static const uhos_u16 g_uhos_ble_pal_gatts_cpf_uuid  = ESP_GATT_UUID_CHAR_PRESENT_FORMAT;
+
 
 /**************************************************************************************************/
 /*                                          内部函数原型                                          */
@@ -120,211 +145,578 @@ uhos_ble_gatts_cb_t g_uhos_ble_pal_gatts_user_cb = UHOS_NULL;   //<! GATT层用
 /**************************************************************************************************/
 /*                                          内部函数实现                                          */
 /**************************************************************************************************/
+static uhos_bool uhos_ble_pal_gatts_char_has_cccd(const uhos_ble_gatts_char_db_t *chr)
+{
+    return (0 != (chr->char_property & (UHOS_BLE_CHAR_PROP_NOTIFY | UHOS_BLE_CHAR_PROP_INDICATE)));
+}
+
 /**
- * @brief       向协议栈添加一个服务
- * @param[in]   p_srv_db    蓝牙服务描述数据
- * @return      uhos_ble_status_t
+ * @brief       计算特征在属性表中占用的属性个数：声明、值以及各描述符
  */
-static uhos_ble_status_t uhos_ble_pal_gatts_add_service(uhos_ble_gatts_srv_db_t *p_srv_db, uhos_u8 id)
+static uhos_u16 uhos_ble_pal_gatts_char_attr_num(const uhos_ble_gatts_char_db_t *chr)
 {
-    // uhos_ble_profile_tab[id].gatts_cb = NULL;
-    // uhos_ble_profile_tab[id].gatts_if = ESP_GATT_IF_NONE;
+    uhos_u16 num = 2;
 
-    uhos_ble_profile_tab[id].app_id = id;
+    num += uhos_ble_pal_gatts_char_has_cccd(chr) ? 1 : 0;
+    num += (UHOS_NULL != chr->char_desc_db.extend_prop) ? 1 : 0;
+    num += (UHOS_NULL != chr->char_desc_db.user_desc) ? 1 : 0;
+    num += (UHOS_NULL != chr->char_desc_db.char_format) ? 1 : 0;
 
-    // uhos_ble_profile_tab[id].conn_id = id;
-    // uhos_ble_profile_tab[id].service_handle = id;
+    return num;
+}
 
-    if(p_srv_db->srv_type == UHOS_BLE_PRIMARY_SERVICE)
+static void uhos_ble_pal_gatts_attr_set(esp_gatts_attr_db_t *attr, uhos_bool auto_rsp, const uhos_u16 *uuid16,
+                                        esp_gatt_perm_t perm, uhos_u16 max_len, uhos_u16 len, uhos_u8 *value)
+{
+    attr->attr_control.auto_rsp = auto_rsp ? ESP_GATT_AUTO_RSP : ESP_GATT_RSP_BY_APP;
+    attr->att_desc.uuid_length  = ESP_UUID_LEN_16;
+    attr->att_desc.uuid_p       = (uhos_u8 *)uuid16;
+    attr->att_desc.perm         = perm;
+    attr->att_desc.max_length   = max_len;
+    attr->att_desc.length       = len;
+    attr->att_desc.value        = value;
+}
+
+/**
+ * @brief       填写特征值属性，需要授权的特征由应用回复读写请求
+ */
+static void uhos_ble_pal_gatts_value_set(esp_gatts_attr_db_t *attr, uhos_ble_gatts_char_db_t *chr)
+{
+    esp_gatt_perm_t perm = 0;
+
+    if (chr->char_property & UHOS_BLE_CHAR_PROP_READ)
+    {
+        perm |= ESP_GATT_PERM_READ;
+    }
+    if (chr->char_property & (UHOS_BLE_CHAR_PROP_WRITE | UHOS_BLE_CHAR_PROP_WRITE_WITHOUT_RESP |
+                              UHOS_BLE_CHAR_PROP_AUTH_SIGNED_WRITE))
+    {
+        perm |= ESP_GATT_PERM_WRITE;
+    }
+
+    attr->attr_control.auto_rsp = (chr->rd_author || chr->wr_author) ? ESP_GATT_RSP_BY_APP : ESP_GATT_AUTO_RSP;
+    attr->att_desc.perm         = perm;
+    attr->att_desc.max_length   = (0 != chr->char_value_len) ? chr->char_value_len : ESP_GATT_MAX_ATTR_LEN;
+    attr->att_desc.length       = (UHOS_NULL != chr->p_value) ? chr->char_value_len : 0;
+    attr->att_desc.value        = chr->p_value;
+    if (UHOS_BLE_UUID_TYPE_16 == chr->char_uuid.type)
     {
-        uhos_ble_profile_tab[id].service_id.is_primary = UHOS_TRUE;
+        attr->att_desc.uuid_length = ESP_UUID_LEN_16;
+        attr->att_desc.uuid_p      = (uhos_u8 *)&chr->char_uuid.uuid16;
     }
-    else if(p_srv_db->srv_type == UHOS_BLE_SECONDARY_SERVICE)
+    else
     {
-        uhos_ble_profile_tab[id].service_id.is_primary = UHOS_FALSE;
+        attr->att_desc.uuid_length = ESP_UUID_LEN_128;
+        attr->att_desc.uuid_p      = chr->char_uuid.uuid128;
     }
+}
 
-    uhos_ble_profile_tab[id].service_id.id.inst_id = 0x00;
+/**
+ * @brief       将服务描述转换为协议栈的属性表
+ * @note        属性顺序：服务声明，各特征依次为特征声明、特征值、CCCD、扩展属性、用户描述、格式描述；
+ *              CCCD在特征支持notify或indicate时自动添加，其余描述符按char_desc_db添加
+ * @param[in]   srv     本端服务
+ * @return      uhos_ble_status_t
+ */
+static uhos_ble_status_t uhos_ble_pal_gatts_tab_build(uhos_ble_pal_gatts_srv_t *srv)
+{
+    uhos_ble_gatts_srv_db_t *db  = srv->db;
+    uhos_ble_gatts_char_db_t *chr = UHOS_NULL;
+    esp_gatts_attr_db_t *attr     = UHOS_NULL;
+    uhos_u8 *val                  = UHOS_NULL;
+    uhos_u16 num                  = 1;
+    uhos_u8 i                     = 0;
+
+    for (i = 0; i < db->char_num; i++)
+    {
+        num += uhos_ble_pal_gatts_char_attr_num(&db->p_char_db[i]);
+    }
 
-    if(p_srv_db->srv_uuid.type == UHOS_BLE_UUID_TYPE_16)
+    srv->tab  = uhos_libc_malloc(num * sizeof(esp_gatts_attr_db_t));
+    srv->vals = uhos_libc_malloc(db->char_num * UHOS_BLE_PAL_GATTS_CHAR_VAL_LEN + 1);
+    if ((UHOS_NULL == srv->tab) || (UHOS_NULL == srv->vals))
     {
-        uhos_ble_profile_tab[id].service_id.id.uuid.len = ESP_UUID_LEN_16;
-        uhos_ble_profile_tab[id].service_id.id.uuid.uuid.uuid16 = p_srv_db->srv_uuid.uuid16;
+        uhos_libc_free(srv->tab);
+        uhos_libc_free(srv->vals);
+        srv->tab  = UHOS_NULL;
+        srv->vals = UHOS_NULL;
+        return UHOS_BLE_ERROR;
     }
-    else if(p_srv_db->srv_uuid.type == UHOS_BLE_UUID_TYPE_128)
+    uhos_libc_memset(srv->tab, 0, num * sizeof(esp_gatts_attr_db_t));
+    srv->attr_num = num;
+
+    attr = srv->tab;
+    uhos_ble_pal_gatts_attr_set(attr, UHOS_TRUE,
+                                (UHOS_BLE_SECONDARY_SERVICE == db->srv_type) ? &g_uhos_ble_pal_gatts_sec_uuid :
+                                &g_uhos_ble_pal_gatts_pri_uuid, ESP_GATT_PERM_READ, ESP_UUID_LEN_128,
+                                (UHOS_BLE_UUID_TYPE_16 == db->srv_uuid.type) ? ESP_UUID_LEN_16 : ESP_UUID_LEN_128,
+                                (UHOS_BLE_UUID_TYPE_16 == db->srv_uuid.type) ? (uhos_u8 *)&db->srv_uuid.uuid16 :
+                                db->srv_uuid.uuid128);
+    attr++;
+
+    for (i = 0; i < db->char_num; i++)
     {
-        uhos_ble_profile_tab[id].service_id.id.uuid.len = ESP_UUID_LEN_128;
-        uhos_libc_memcpy(uhos_ble_profile_tab[id].service_id.id.uuid.uuid.uuid16
-                        ,p_srv_db->srv_uuid.uuid128
-                        ,ESP_UUID_LEN_128);
+        chr = &db->p_char_db[i];
+        val = &srv->vals[i * UHOS_BLE_PAL_GATTS_CHAR_VAL_LEN];
+
+        // 特征属性位与协议栈一致，直接作为特征声明的值
+        val[0] = chr->char_property;
+        uhos_ble_pal_gatts_attr_set(attr++, UHOS_TRUE, &g_uhos_ble_pal_gatts_decl_uuid, ESP_GATT_PERM_READ,
+                                    1, 1, &val[0]);
+        uhos_ble_pal_gatts_value_set(attr++, chr);
+
+        if (uhos_ble_pal_gatts_char_has_cccd(chr))
+        {
+            val[1] = 0;
+            val[2] = 0;
+            uhos_ble_pal_gatts_attr_set(attr++, UHOS_TRUE, &g_uhos_ble_pal_gatts_cccd_uuid,
+                                        ESP_GATT_PERM_READ | ESP_GATT_PERM_WRITE, 2, 2, &val[1]);
+        }
+        if (UHOS_NULL != chr->char_desc_db.extend_prop)
+        {
+            val[3] = (chr->char_desc_db.extend_prop->reliable_write ? 0x01 : 0) |
+                     (chr->char_desc_db.extend_prop->writeable ? 0x02 : 0);
+            val[4] = 0;
+            uhos_ble_pal_gatts_attr_set(attr++, UHOS_TRUE, &g_uhos_ble_pal_gatts_ext_uuid, ESP_GATT_PERM_READ,
+                                        2, 2, &val[3]);
+        }
+        if (UHOS_NULL != chr->char_desc_db.user_desc)
+        {
+            uhos_ble_pal_gatts_attr_set(attr++, UHOS_TRUE, &g_uhos_ble_pal_gatts_desc_uuid, ESP_GATT_PERM_READ,
+                                        chr->char_desc_db.user_desc->len, chr->char_desc_db.user_desc->len,
+                                        (uhos_u8 *)chr->char_desc_db.user_desc->string);
+        }
+        if (UHOS_NULL != chr->char_desc_db.char_format)
+        {
+            val[5]  = chr->char_desc_db.char_format->format;
+            val[6]  = chr->char_desc_db.char_format->exponent;
+            val[7]  = (uhos_u8)chr->char_desc_db.char_format->unit;
+            val[8]  = (uhos_u8)(chr->char_desc_db.char_format->unit >> 8);
+            val[9]  = chr->char_desc_db.char_format->name_space;
+            val[10] = (uhos_u8)chr->char_desc_db.char_format->desc;
+            val[11] = (uhos_u8)(chr->char_desc_db.char_format->desc >> 8);
+            uhos_ble_pal_gatts_attr_set(attr++, UHOS_TRUE, &g_uhos_ble_pal_gatts_cpf_uuid, ESP_GATT_PERM_READ,
+                                        7, 7, &val[5]);
+        }
     }
 
-    // uhos_ble_profile_tab[id].char_handle = id;
+    return UHOS_BLE_SUCCESS;
+}
 
-    if(p_srv_db->p_char_db->char_uuid.type == UHOS_BLE_UUID_TYPE_16)
+static void uhos_ble_pal_gatts_tab_free(uhos_ble_pal_gatts_srv_t *srv)
+{
+    uhos_libc_free(srv->tab);
+    uhos_libc_free(srv->vals);
+    srv->tab  = UHOS_NULL;
+    srv->vals = UHOS_NULL;
+}
+
+/**
+ * @brief       向协议栈提交服务的属性表，以服务下标作为服务实例ID，创建结果在CREAT_ATTR_TAB_EVT中返回
+ * @param[in]   idx     服务在g_uhos_ble_pal_gatts_srv中的下标
+ */
+static void uhos_ble_pal_gatts_srv_create(uhos_u8 idx)
+{
+    uhos_ble_pal_gatts_srv_t *srv = &g_uhos_ble_pal_gatts_srv[idx];
+    esp_err_t ret;
+
+    if (UHOS_BLE_SUCCESS != uhos_ble_pal_gatts_tab_build(srv))
+    {
+        UHOS_LOGE("srv %d build attr tab failed", idx);
+        srv->state = UHOS_BLE_PAL_GATTS_SRV_FAILED;
+        return;
+    }
+
+    srv->state = UHOS_BLE_PAL_GATTS_SRV_CREATING;
+    ret = esp_ble_gatts_create_attr_tab(srv->tab, g_uhos_ble_pal_gatts_if, srv->attr_num, idx);
+    if (ret)
     {
-        uhos_ble_profile_tab[id].char_uuid.len = ESP_UUID_LEN_16;
-        uhos_ble_profile_tab[id].char_uuid.uuid.uuid16 = p_srv_db->p_char_db->char_uuid.uuid16;
+        UHOS_LOGE("esp_ble_gatts_create_attr_tab failed, error code = %x", ret);
+        uhos_ble_pal_gatts_tab_free(srv);
+        srv->state = UHOS_BLE_PAL_GATTS_SRV_FAILED;
     }
-    else if(p_srv_db->p_char_db->char_uuid.type == UHOS_BLE_UUID_TYPE_128)
+}
+
+/**
+ * @brief       属性表创建完成：回填句柄，建立句柄查找表并启动服务
+ */
+static void uhos_ble_pal_gatts_srv_created(struct gatts_add_attr_tab_evt_param *param)
+{
+    uhos_ble_pal_gatts_srv_t *srv = UHOS_NULL;
+    uhos_ble_pal_gatts_attr_t *attr = UHOS_NULL;
+    uhos_ble_gatts_char_db_t *chr = UHOS_NULL;
+    uhos_u16 pos                  = 1;
+    uhos_u16 i                    = 0;
+    uhos_u16 n                    = 0;
+    uhos_u8 c                     = 0;
+
+    if (param->svc_inst_id >= g_uhos_ble_pal_gatts_srv_num)
     {
-        uhos_ble_profile_tab[id].char_uuid.len = ESP_UUID_LEN_128;
-        uhos_libc_memcpy(uhos_ble_profile_tab[id].char_uuid.uuid.uuid16
-                        ,p_srv_db->p_char_db->char_uuid.uuid128
-                        ,ESP_UUID_LEN_128);
+        return;
     }
+    srv = &g_uhos_ble_pal_gatts_srv[param->svc_inst_id];
+    uhos_ble_pal_gatts_tab_free(srv);
 
-    uhos_ble_profile_tab[id].perm = ESP_GATT_PERM_READ | ESP_GATT_PERM_WRITE;
+    if ((ESP_GATT_OK != param->status) || (param->num_handle != srv->attr_num))
+    {
+        UHOS_LOGE("srv %d create attr tab failed, status %d num %d", param->svc_inst_id, param->status,
+                  param->num_handle);
+        srv->state = UHOS_BLE_PAL_GATTS_SRV_FAILED;
+        return;
+    }
 
-    if(p_srv_db->p_char_db->char_property & UHOS_BLE_CHAR_PROP_BROADCAST)
+    if (0 == g_uhos_ble_pal_gatts_base)
     {
-        uhos_ble_profile_tab[id].property |= ESP_GATT_CHAR_PROP_BIT_BROADCAST; 
+        g_uhos_ble_pal_gatts_base = param->handles[0];
+    }
+    for (i = 0; i < param->num_handle; i++)
+    {
+        if ((param->handles[i] < g_uhos_ble_pal_gatts_base) ||
+            (param->handles[i] - g_uhos_ble_pal_gatts_base >= CONFIG_UHOS_BLE_GATTS_ATTR_NUM))
+        {
+            UHOS_LOGE("srv %d handle %d out of lookup table", param->svc_inst_id, param->handles[i]);
+            srv->state = UHOS_BLE_PAL_GATTS_SRV_FAILED;
+            return;
+        }
     }
-    if(p_srv_db->p_char_db->char_property & UHOS_BLE_CHAR_PROP_READ)
+
+    attr       = &g_uhos_ble_pal_gatts_attr[param->handles[0] - g_uhos_ble_pal_gatts_base];
+    attr->kind = UHOS_BLE_PAL_GATTS_ATTR_SERVICE;
+    attr->srv  = param->svc_inst_id;
+    srv->db->srv_handle = param->handles[0];
+
+    // 与uhos_ble_pal_gatts_tab_build的属性顺序一致
+    for (c = 0; c < srv->db->char_num; c++)
     {
-        uhos_ble_profile_tab[id].property |= ESP_GATT_CHAR_PROP_BIT_READ; 
+        chr = &srv->db->p_char_db[c];
+        n   = uhos_ble_pal_gatts_char_attr_num(chr);
+        for (i = 0; i < n; i++)
+        {
+            attr       = &g_uhos_ble_pal_gatts_attr[param->handles[pos + i] - g_uhos_ble_pal_gatts_base];
+            attr->srv  = param->svc_inst_id;
+            attr->chr  = c;
+            attr->kind = (0 == i) ? UHOS_BLE_PAL_GATTS_ATTR_CHAR_DECL :
+                         (1 == i) ? UHOS_BLE_PAL_GATTS_ATTR_CHAR_VALUE :
+                         ((2 == i) && uhos_ble_pal_gatts_char_has_cccd(chr)) ? UHOS_BLE_PAL_GATTS_ATTR_CCCD :
+                         UHOS_BLE_PAL_GATTS_ATTR_DESC;
+        }
+        chr->char_value_handle = param->handles[pos + 1];
+        pos += n;
     }
-    if(p_srv_db->p_char_db->char_property & UHOS_BLE_CHAR_PROP_WRITE_WITHOUT_RESP)
+
+    srv->state = UHOS_BLE_PAL_GATTS_SRV_STARTED;
+    esp_ble_gatts_start_service(param->handles[0]);
+}
+
+/**
+ * @brief       按句柄查找属性，O(1)
+ * @return      查找表项，句柄不属于本端服务时返回UHOS_NULL
+ */
+static const uhos_ble_pal_gatts_attr_t *uhos_ble_pal_gatts_attr_find(uhos_u16 handle)
+{
+    const uhos_ble_pal_gatts_attr_t *attr = UHOS_NULL;
+
+    if ((0 == g_uhos_ble_pal_gatts_base) || (handle < g_uhos_ble_pal_gatts_base) ||
+        (handle - g_uhos_ble_pal_gatts_base >= CONFIG_UHOS_BLE_GATTS_ATTR_NUM))
     {
-        uhos_ble_profile_tab[id].property |= ESP_GATT_CHAR_PROP_BIT_WRITE_NR; 
+        return UHOS_NULL;
     }
-    if(p_srv_db->p_char_db->char_property & UHOS_BLE_CHAR_PROP_WRITE)
+
+    attr = &g_uhos_ble_pal_gatts_attr[handle - g_uhos_ble_pal_gatts_base];
+    return (UHOS_BLE_PAL_GATTS_ATTR_NONE != attr->kind) ? attr : UHOS_NULL;
+}
+
+static uhos_ble_gatts_cb_t uhos_ble_pal_gatts_cb_get(const uhos_ble_pal_gatts_attr_t *attr)
+{
+    uhos_ble_gatts_cb_t cb = g_uhos_ble_pal_gatts_srv[attr->srv].cb;
+
+    return (UHOS_NULL != cb) ? cb : g_uhos_ble_pal_gatts_user_cb;
+}
+
+static uhos_ble_gatts_char_db_t *uhos_ble_pal_gatts_char_get(const uhos_ble_pal_gatts_attr_t *attr)
+{
+    return &g_uhos_ble_pal_gatts_srv[attr->srv].db->p_char_db[attr->chr];
+}
+
+/**
+ * @brief       对端写本端属性：特征值上报WRITE事件，CCCD上报CCCD_UPDATE事件；
+ *              由应用回复的特征值在用户回调同意后保存并回复
+ */
+static void uhos_ble_pal_gatts_write(esp_gatt_if_t gatts_if, struct gatts_write_evt_param *param)
+{
+    const uhos_ble_pal_gatts_attr_t *attr = uhos_ble_pal_gatts_attr_find(param->handle);
+    uhos_ble_gatts_char_db_t *chr         = UHOS_NULL;
+    uhos_ble_gatts_cb_t cb                = UHOS_NULL;
+    uhos_ble_gatts_evt_param_t evt_param;
+    uhos_ble_status_t ret                 = UHOS_BLE_SUCCESS;
+    uhos_bool by_app                      = UHOS_FALSE;
+
+    if ((UHOS_NULL == attr) ||
+        ((UHOS_BLE_PAL_GATTS_ATTR_CHAR_VALUE != attr->kind) && (UHOS_BLE_PAL_GATTS_ATTR_CCCD != attr->kind)))
     {
-        uhos_ble_profile_tab[id].property |= ESP_GATT_CHAR_PROP_BIT_WRITE; 
+        return;
     }
-    if(p_srv_db->p_char_db->char_property & UHOS_BLE_CHAR_PROP_NOTIFY)
+
+    chr    = uhos_ble_pal_gatts_char_get(attr);
+    cb     = uhos_ble_pal_gatts_cb_get(attr);
+    by_app = (UHOS_BLE_PAL_GATTS_ATTR_CHAR_VALUE == attr->kind) && (chr->rd_author || chr->wr_author);
+
+    if (param->is_prep)
     {
-        uhos_ble_profile_tab[id].property |= ESP_GATT_CHAR_PROP_BIT_NOTIFY; 
+        // 本端不缓存队列写，由应用回复的属性直接拒绝
+        if (by_app && param->need_rsp)
+        {
+            esp_ble_gatts_send_response(gatts_if, param->conn_id, param->trans_id, ESP_GATT_REQ_NOT_SUPPORTED,
+                                        UHOS_NULL);
+        }
+        return;
     }
-    if(p_srv_db->p_char_db->char_property & UHOS_BLE_CHAR_PROP_INDICATE)
+
+    uhos_libc_memset(&evt_param, 0, sizeof(evt_param));
+    evt_param.conn_handle        = param->conn_id;
+    evt_param.write.value_handle = chr->char_value_handle;
+    evt_param.write.offset       = (uhos_u8)param->offset;
+    evt_param.write.data         = param->value;
+    evt_param.write.len          = param->len;
+
+    if (UHOS_BLE_PAL_GATTS_ATTR_CCCD == attr->kind)
     {
-        uhos_ble_profile_tab[id].property |= ESP_GATT_CHAR_PROP_BIT_INDICATE; 
+        evt_param.cccd = (param->len >= 2) ? (param->value[0] | (param->value[1] << 8)) : 0;
+        if (UHOS_NULL != cb)
+        {
+            cb(UHOS_BLE_GATTS_EVT_CCCD_UPDATE, &evt_param);
+        }
+        return;
     }
-    if(p_srv_db->p_char_db->char_property & UHOS_BLE_CHAR_PROP_AUTH_SIGNED_WRITE)
+
+    if (UHOS_NULL != cb)
     {
-        uhos_ble_profile_tab[id].property |= ESP_GATT_CHAR_PROP_BIT_AUTH; 
+        ret = cb(UHOS_BLE_GATTS_EVT_WRITE, &evt_param);
     }
-    if(p_srv_db->p_char_db->char_property & UHOS_BLE_CHAR_PROP_EXTENDED_PROPERTIES)
+    if (!by_app)
     {
-        uhos_ble_profile_tab[id].property |= ESP_GATT_CHAR_PROP_BIT_EXT_PROP; 
+        return;
     }
 
-    // uhos_ble_profile_tab[id].descr_handle = id;
-    // uhos_ble_profile_tab[id].descr_uuid.len = id;
-    // uhos_ble_profile_tab[id].descr_uuid.uuid.uuid16 = id;
+    // 未要求写授权时写入总是成功
+    if (!chr->wr_author)
+    {
+        ret = UHOS_BLE_SUCCESS;
+    }
+    if (UHOS_BLE_SUCCESS == ret)
+    {
+        esp_ble_gatts_set_attr_value(param->handle, param->len, param->value);
+    }
+    if (param->need_rsp)
+    {
+        esp_ble_gatts_send_response(gatts_if, param->conn_id, param->trans_id,
+                                    (UHOS_BLE_SUCCESS == ret) ? ESP_GATT_OK : ESP_GATT_WRITE_NOT_PERMIT, UHOS_NULL);
+    }
 }
 
-static void uhos_ble_gatts_profile_a_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param) 
+/**
+ * @brief       对端读由应用回复的特征值：要求读授权时向用户回调取值，否则回复协议栈保存的值
+ */
+static void uhos_ble_pal_gatts_read(esp_gatt_if_t gatts_if, struct gatts_read_evt_param *param)
 {
-    esp_err_t ret;
+    const uhos_ble_pal_gatts_attr_t *attr = UHOS_NULL;
+    uhos_ble_gatts_char_db_t *chr         = UHOS_NULL;
+    uhos_ble_gatts_cb_t cb                = UHOS_NULL;
+    uhos_ble_gatts_evt_param_t evt_param;
+    esp_gatt_status_t status              = ESP_GATT_OK;
+    esp_gatt_rsp_t *rsp                   = UHOS_NULL;
+    const uhos_u8 *data                   = UHOS_NULL;
+    uhos_u8 *user_data                    = UHOS_NULL;
+    uhos_u16 len                          = 0;
+
+    if (!param->need_rsp)
+    {
+        return;
+    }
 
-    switch (event) 
+    attr = uhos_ble_pal_gatts_attr_find(param->handle);
+    if ((UHOS_NULL == attr) || (UHOS_BLE_PAL_GATTS_ATTR_CHAR_VALUE != attr->kind))
     {
-    case ESP_GATTS_REG_EVT:
-        UHOS_LOGI("REGISTER_APP_EVT, status %d, app_id %d\n", param->reg.status, param->reg.app_id);
+        esp_ble_gatts_send_response(gatts_if, param->conn_id, param->trans_id, ESP_GATT_INVALID_HANDLE, UHOS_NULL);
+        return;
+    }
 
-        esp_ble_gatts_create_service(gatts_if, &uhos_ble_profile_tab[UHOS_BLE_HAL_PROFILE_A_APP_ID].service_id, GATTS_NUM_HANDLE_TEST_A);
-        break;
-    case ESP_GATTS_CREATE_EVT:
-        //service has been created, now add characteristic declaration
-        ret = esp_ble_gatts_add_char(gl_profile_tab[HEART_PROFILE_APP_ID].service_handle, &gl_profile_tab[HEART_PROFILE_APP_ID].char_uuid,
-                            ESP_GATT_PERM_READ,
-                            ESP_GATT_CHAR_PROP_BIT_READ | ESP_GATT_CHAR_PROP_BIT_INDICATE,
-                            &heart_rate_attr, NULL);
-        if (ret) {
-            ESP_LOGE(GATTS_TAG, "add char failed, error code = %x", ret);
+    chr = uhos_ble_pal_gatts_char_get(attr);
+    cb  = uhos_ble_pal_gatts_cb_get(attr);
+    if (chr->rd_author)
+    {
+        uhos_libc_memset(&evt_param, 0, sizeof(evt_param));
+        evt_param.conn_handle       = param->conn_id;
+        evt_param.read.value_handle = chr->char_value_handle;
+        evt_param.read.offset       = (uhos_u8)param->offset;
+        evt_param.read.data         = &user_data;
+        evt_param.read.len          = &len;
+        if ((UHOS_NULL == cb) || (UHOS_BLE_SUCCESS != cb(UHOS_BLE_GATTS_EVT_READ, &evt_param)))
+        {
+            status = ESP_GATT_READ_NOT_PERMIT;
         }
-        break;
-    case ESP_GATTS_ADD_CHAR_EVT: {
-        uint16_t length = 0;
-        const uint8_t *prf_char;
+        data = user_data;
+    }
+    else if (ESP_GATT_OK != esp_ble_gatts_get_attr_value(param->handle, &len, &data))
+    {
+        status = ESP_GATT_INVALID_HANDLE;
+    }
 
-        UHOS_LOGI( "ADD_CHAR_EVT, status %d,  attr_handle %d, service_handle %d\n",
-                param->add_char.status, param->add_char.attr_handle, param->add_char.service_handle);
+    if ((ESP_GATT_OK == status) && (param->offset > len))
+    {
+        status = ESP_GATT_INVALID_OFFSET;
+    }
 
-        esp_err_t get_attr_ret = esp_ble_gatts_get_attr_value(param->add_char.attr_handle,  &length, &prf_char);
-        if (get_attr_ret == ESP_FAIL){
-            UHOS_LOGI("ILLEGAL HANDLE");
+    rsp = (ESP_GATT_OK == status) ? uhos_libc_malloc(sizeof(esp_gatt_rsp_t)) : UHOS_NULL;
+    if (UHOS_NULL != rsp)
+    {
+        uhos_libc_memset(rsp, 0, sizeof(esp_gatt_rsp_t));
+        len -= param->offset;
+        len  = (len > ESP_GATT_MAX_ATTR_LEN) ? ESP_GATT_MAX_ATTR_LEN : len;
+        rsp->attr_value.handle = param->handle;
+        rsp->attr_value.offset = param->offset;
+        rsp->attr_value.len    = len;
+        if ((UHOS_NULL != data) && (0 != len))
+        {
+            uhos_libc_memcpy(rsp->attr_value.value, data + param->offset, len);
         }
+    }
+    else if (ESP_GATT_OK == status)
+    {
+        status = ESP_GATT_NO_RESOURCES;
+    }
+
+    esp_ble_gatts_send_response(gatts_if, param->conn_id, param->trans_id, status, rsp);
+    uhos_libc_free(rsp);
+}
 
-        UHOS_LOGI( "the gatts demo char length = %x\n", length);
-        for(int i = 0; i < length; i++){
-            UHOS_LOGI("prf_char[%x] =%x\n",i,prf_char[i]);
+static void uhos_ble_pal_gatts_write_handle(uhos_ble_pal_evt_t *evt)
+{
+    uhos_ble_pal_gatts_write(evt->gatts.gatts_if, &evt->gatts.write);
+}
+
+static void uhos_ble_pal_gatts_read_handle(uhos_ble_pal_evt_t *evt)
+{
+    uhos_ble_pal_gatts_read(evt->gatts.gatts_if, &evt->gatts.read);
+}
+
+/**
+ * @brief       对端读写请求连同写入数据的拷贝交给ble_daemon任务处理
+ * @note        队列已满时丢弃请求并计数；需要响应的请求回复ESP_GATT_BUSY，由对端稍后重试
+ */
+static void uhos_ble_pal_gatts_req_post(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if,
+                                        esp_ble_gatts_cb_param_t *param)
+{
+    uhos_u16 len            = (ESP_GATTS_WRITE_EVT == event) ? param->write.len : 0;
+    uhos_u16 conn_id        = (ESP_GATTS_WRITE_EVT == event) ? param->write.conn_id : param->read.conn_id;
+    uhos_ble_pal_evt_t *evt = uhos_ble_pal_evt_alloc(UHOS_BLE_EVENT_TYPE_GATTS, conn_id, len, UHOS_FALSE);
+
+    if (UHOS_NULL == evt)
+    {
+        uhos_ble_pal_evt_drop(UHOS_BLE_EVENT_TYPE_GATTS);
+        if (ESP_GATTS_READ_EVT == event)
+        {
+            esp_ble_gatts_send_response(gatts_if, conn_id, param->read.trans_id, ESP_GATT_BUSY, UHOS_NULL);
         }
-        esp_err_t add_descr_ret = esp_ble_gatts_add_char_descr(uhos_ble_profile_tab[UHOS_BLE_HAL_PROFILE_A_APP_ID].service_handle, &uhos_ble_profile_tab[UHOS_BLE_HAL_PROFILE_A_APP_ID].descr_uuid,
-                                                                ESP_GATT_PERM_READ | ESP_GATT_PERM_WRITE, NULL, NULL);
-        if (add_descr_ret){
-            UHOS_LOGI("add char descr failed, error code =%x", add_descr_ret);
+        else if (param->write.need_rsp)
+        {
+            esp_ble_gatts_send_response(gatts_if, conn_id, param->write.trans_id, ESP_GATT_BUSY, UHOS_NULL);
         }
-        break;
+        return;
     }
-    case ESP_GATTS_ADD_CHAR_DESCR_EVT:
-        uhos_ble_profile_tab[UHOS_BLE_HAL_PROFILE_A_APP_ID].descr_handle = param->add_char_descr.attr_handle;
-        UHOS_LOGI("ADD_DESCR_EVT, status %d, attr_handle %d, service_handle %d\n",
-                 param->add_char_descr.status, param->add_char_descr.attr_handle, param->add_char_descr.service_handle);
+
+    evt->gatts.gatts_if = gatts_if;
+    if (ESP_GATTS_WRITE_EVT == event)
+    {
+        uhos_libc_memcpy(&evt->gatts.write, &param->write, sizeof(struct gatts_write_evt_param));
+        uhos_libc_memcpy(evt->data, param->write.value, len);
+        evt->gatts.write.value = evt->data;
+        uhos_ble_pal_evt_post(evt, uhos_ble_pal_gatts_write_handle);
+    }
+    else
+    {
+        uhos_libc_memcpy(&evt->gatts.read, &param->read, sizeof(struct gatts_read_evt_param));
+        uhos_ble_pal_evt_post(evt, uhos_ble_pal_gatts_read_handle);
+    }
+}
+
+static void uhos_ble_gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param)
+{
+    uhos_u8 i = 0;
+
+    switch (event)
+    {
+    case ESP_GATTS_REG_EVT:
+        UHOS_LOGI("REGISTER_APP_EVT, status %d, app_id %d", param->reg.status, param->reg.app_id);
+        if ((ESP_GATT_OK != param->reg.status) || (UHOS_BLE_PAL_GATTS_APP_ID != param->reg.app_id))
+        {
+            break;
+        }
+
+        // 应用注册前设置的服务在此统一创建
+        g_uhos_ble_pal_gatts_if = gatts_if;
+        for (i = 0; i < g_uhos_ble_pal_gatts_srv_num; i++)
+        {
+            if (UHOS_BLE_PAL_GATTS_SRV_PENDING == g_uhos_ble_pal_gatts_srv[i].state)
+            {
+                uhos_ble_pal_gatts_srv_create(i);
+            }
+        }
         break;
-    case ESP_GATTS_DELETE_EVT:
+    case ESP_GATTS_CREAT_ATTR_TAB_EVT:
+        uhos_ble_pal_gatts_srv_created(&param->add_attr_tab);
         break;
     case ESP_GATTS_START_EVT:
-        UHOS_LOGI("SERVICE_START_EVT, status %d, service_handle %d\n",
+        UHOS_LOGI("SERVICE_START_EVT, status %d, service_handle %d",
                  param->start.status, param->start.service_handle);
         break;
-    case ESP_GATTS_STOP_EVT:
-        break;
-    case ESP_GATTS_CONNECT_EVT: {
-        esp_ble_conn_update_params_t conn_params = {0};
-        memcpy(conn_params.bda, param->connect.remote_bda, sizeof(esp_bd_addr_t));
-        /* For the IOS system, please reference the apple official documents about the ble connection parameters restrictions. */
-        uhos_ble_profile_tab[UHOS_BLE_HAL_PROFILE_A_APP_ID].conn_id = param->connect.conn_id;
-        //start sent the update connection parameters to the peer device.
-        esp_ble_gap_update_conn_params(&conn_params);
+    case ESP_GATTS_CONNECT_EVT:
+        uhos_ble_pal_conn_add(param->connect.conn_id, gatts_if, param->connect.remote_bda,
+                              (0 == param->connect.link_role) ? UHOS_BLE_GAP_CENTRAL : UHOS_BLE_GAP_PERIPHERAL);
+        uhos_ble_pal_conn_params_update(param->connect.remote_bda, param->connect.conn_params.interval,
+                                        param->connect.conn_params.latency);
+        uhos_ble_pal_gap_conn_report(param->connect.conn_id, param->connect.remote_bda,
+                                     (0 == param->connect.link_role) ? UHOS_BLE_GAP_CENTRAL : UHOS_BLE_GAP_PERIPHERAL,
+                                     param->connect.conn_params.interval, param->connect.conn_params.latency,
+                                     param->connect.conn_params.timeout);
         break;
-    }
     case ESP_GATTS_DISCONNECT_EVT:
         UHOS_LOGI("ESP_GATTS_DISCONNECT_EVT, disconnect reason 0x%x", param->disconnect.reason);
+        uhos_ble_pal_conn_remove(param->disconnect.conn_id);
+        uhos_ble_pal_gap_disconn_report(param->disconnect.conn_id, param->disconnect.reason);
+        break;
+    case ESP_GATTS_MTU_EVT:
+        uhos_ble_pal_conn_mtu_set(param->mtu.conn_id, param->mtu.mtu);
+        break;
+    case ESP_GATTS_WRITE_EVT:
+        uhos_ble_pal_conn_rx(param->write.conn_id, param->write.len);
+        uhos_ble_pal_gatts_req_post(event, gatts_if, param);
+        break;
+    case ESP_GATTS_EXEC_WRITE_EVT:
+        esp_ble_gatts_send_response(gatts_if, param->exec_write.conn_id, param->exec_write.trans_id, ESP_GATT_OK,
+                                    UHOS_NULL);
+        break;
+    case ESP_GATTS_READ_EVT:
+        uhos_ble_pal_gatts_req_post(event, gatts_if, param);
         break;
     case ESP_GATTS_CONF_EVT:
-        UHOS_LOGI("ESP_GATTS_CONF_EVT, status %d attr_handle %d", param->conf.status, param->conf.handle);
+        // notify下发完成或indicate收到确认，继续发送该连接队列中的数据
+        if (ESP_GATT_OK != param->conf.status)
+        {
+            UHOS_LOGW("ESP_GATTS_CONF_EVT, status %d attr_handle %d", param->conf.status, param->conf.handle);
+        }
+        uhos_ble_pal_bench_op_done(param->conf.conn_id, UHOS_BLE_BENCH_NOTIFY, (ESP_GATT_OK == param->conf.status));
+        uhos_ble_pal_frag_tx_done(param->conf.conn_id, UHOS_BLE_FRAG_LINK_NOTIFY);
+        uhos_ble_pal_conn_tx_done(param->conf.conn_id);
         break;
-    case ESP_GATTS_OPEN_EVT:
-    case ESP_GATTS_CANCEL_OPEN_EVT:
-    case ESP_GATTS_CLOSE_EVT:
-    case ESP_GATTS_LISTEN_EVT:
     case ESP_GATTS_CONGEST_EVT:
+        uhos_ble_pal_conn_congest(param->congest.conn_id, param->congest.congested);
+        break;
     default:
         break;
     }
 }
 
-static void uhos_ble_gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param)
-{
-    /* If event is register event, store the gatts_if for each profile */
-    if (event == ESP_GATTS_REG_EVT) {
-        if (param->reg.status == ESP_GATT_OK) {
-            uhos_ble_profile_tab[param->reg.app_id].gatts_if = gatts_if;
-        } else {
-            UHOS_LOGI("Reg app failed, app_id %04x, status %d\n",
-                    param->reg.app_id,
-                    param->reg.status);
-            return;
-        }
-    }
-
-    /* If the gatts_if equal to profile A, call profile A cb handler,
-     * so here call each profile's callback */
-    do {
-        int idx;
-        for (idx = 0; idx < UHOS_BLE_HAL_PROFILE_NUM; idx++) {
-            if (gatts_if == ESP_GATT_IF_NONE || /* ESP_GATT_IF_NONE, not specify a certain gatt_if, need to call every profile cb function */
-                    gatts_if == uhos_ble_profile_tab[idx].gatts_if) {
-                if (uhos_ble_profile_tab[idx].gatts_cb) {
-                    uhos_ble_profile_tab[idx].gatts_cb(event, gatts_if, param);
-                }
-            }
-        }
-    } while (0);
-}
-
 /**************************************************************************************************/
 /*                                          全局函数实现                                          */
 /**************************************************************************************************/
@@ -335,18 +727,19 @@ void uhos_ble_pal_gatts_init(void)
 {
     esp_err_t ret;
 
+    uhos_ble_pal_conn_init();
+    uhos_ble_pal_frag_init();
+
     ret = esp_ble_gatts_register_callback(uhos_ble_gatts_event_handler);
     if (ret){
          UHOS_LOGE("esp_ble_gatts_register_callback failed, error code = %x ", ret);
-         return UHOS_BLE_ERROR;
+         return;
     }
 
-    ret = esp_ble_gatts_app_register(UHOS_BLE_HAL_PROFILE_A_APP_ID);
+    ret = esp_ble_gatts_app_register(UHOS_BLE_PAL_GATTS_APP_ID);
     if (ret){
          UHOS_LOGE("esp_ble_gatts_app_register failed, error code = %x ", ret);
-         return UHOS_BLE_ERROR;
     }
-    return UHOS_BLE_SUCCESS;
 }
 
 /**
@@ -381,34 +774,64 @@ uhos_ble_status_t uhos_ble_gatts_callback_register(uhos_ble_gatts_cb_t cb)
  }
 
 /**
- * @brief       设置GATT层Server端的服务框架
+ * @brief       设置GATT层Server端的服务框架，服务使用uhos_ble_gatts_callback_register注册的回调
  * @param[in]   service_database 服务数据集合
  * @return      uhos_ble_status_t
  */
 uhos_ble_status_t uhos_ble_gatts_service_set(uhos_ble_gatts_db_t *service_database)
 {
-    uhos_ble_gatts_srv_db_t *p_srv_db;
-    uhos_u8                  srv_num = 0;
-    uhos_ble_status_t        status;
-
-    srv_num = service_database->srv_num;
+    return uhos_ble_gatts_service_add(service_database, UHOS_NULL);
+}
 
-    if (srv_num > APP_MAX_SERVICE_NUM || srv_num == 0)
+/**
+ * @brief       添加一组服务，并指定这组服务的读写事件回调
+ * @param[in]   service_database 服务数据集合
+ * @param[in]   cb               回调函数，UHOS_NULL表示使用全局回调
+ * @return      uhos_ble_status_t
+ */
+uhos_ble_status_t uhos_ble_gatts_service_add(uhos_ble_gatts_db_t *service_database, uhos_ble_gatts_cb_t cb)
+{
+    uhos_ble_gatts_srv_db_t *p_srv_db = UHOS_NULL;
+    uhos_ble_pal_gatts_srv_t *srv     = UHOS_NULL;
+    uhos_u8 i                         = 0;
+    uhos_u8 c                         = 0;
+
+    if ((UHOS_NULL == service_database) || (UHOS_NULL == service_database->p_srv_db) ||
+        (0 == service_database->srv_num) ||
+        (service_database->srv_num > CONFIG_UHOS_BLE_GATTS_SRV_NUM - g_uhos_ble_pal_gatts_srv_num))
     {
         UHOS_LOGW("srv num limited");
         return UHOS_BLE_ERROR;
     }
 
-    for (int i = 0; i < srv_num; i++)
+    for (i = 0; i < service_database->srv_num; i++)
     {
-
         p_srv_db = &service_database->p_srv_db[i];
-        status   = uhos_ble_pal_gatts_add_service(p_srv_db, i);
+        if ((0 != p_srv_db->char_num) && (UHOS_NULL == p_srv_db->p_char_db))
+        {
+            UHOS_LOGW("srv %d char db null", i);
+            return UHOS_BLE_ERROR;
+        }
+        for (c = 0; c < p_srv_db->char_num; c++)
+        {
+            p_srv_db->p_char_db[c].char_value_handle = 0;
+        }
+        p_srv_db->srv_handle = 0;
+    }
 
-        if (UHOS_BLE_SUCCESS != status)
+    for (i = 0; i < service_database->srv_num; i++)
+    {
+        srv = &g_uhos_ble_pal_gatts_srv[g_uhos_ble_pal_gatts_srv_num];
+        uhos_libc_memset(srv, 0, sizeof(uhos_ble_pal_gatts_srv_t));
+        srv->db    = &service_database->p_srv_db[i];
+        srv->cb    = cb;
+        srv->state = UHOS_BLE_PAL_GATTS_SRV_PENDING;
+        g_uhos_ble_pal_gatts_srv_num++;
+
+        // 应用已注册时立即创建，否则等待REG_EVT
+        if (ESP_GATT_IF_NONE != g_uhos_ble_pal_gatts_if)
         {
-            UHOS_LOGW("ble add service failed, %d", i);
-            continue;
+            uhos_ble_pal_gatts_srv_create(g_uhos_ble_pal_gatts_srv_num - 1);
         }
     }
 
@@ -433,28 +856,8 @@ uhos_ble_status_t uhos_ble_gatts_notify_or_indicate(
     uhos_u8 *p_value,
     uhos_u16 len)
 {
-    // uhos_u16 conidx = uhos_ble_pal_conn_id_switch(conn_handle, UHOS_BLE_CONNECT_SWITCH_MODE_DEC);
-    // uhos_u16 handler = 0;
-    // uhos_u16 att_offset = 0;
-    // int      start_handler = srv_handle;
-
-    // handler    = start_handler >> 8;
-    // att_offset = (char_value_handle & 0xFF);
-
-    if (offset == 0)
-    {
-        //app_ble_gatt_data_send_notify((uhos_u8)conidx, handler, att_offset, len, p_value);
-        esp_ble_gatts_send_indicate(gatts_if, param->write.conn_id, gl_profile_tab[HEART_PROFILE_APP_ID].char_handle,
-                                        len, p_value, false);
-    }
-    else
-    {
-        //app_ble_gatt_data_send_indicate((uhos_u8)conidx, handler, att_offset, len, p_value);
-        esp_ble_gatts_send_indicate(gatts_if, param->write.conn_id, gl_profile_tab[HEART_PROFILE_APP_ID].char_handle,
-                                        len, p_value, true);
-    }
-
-    return UHOS_BLE_SUCCESS;
+    // offset为0发送notify，否则发送indicate；数据进入该连接自己的发送队列
+    return uhos_ble_pal_conn_tx(conn_handle, char_value_handle, (0 != offset), p_value, len);
 }
 
 /**
@@ -483,8 +886,14 @@ uhos_ble_status_t uhos_ble_gatts_mtu_default_set(uhos_u16 mtu)
  */
 uhos_ble_status_t uhos_ble_gatts_mtu_get(uhos_u16 conn_handle, uhos_u16 *mtu_size)
 {
-    // uhos_u16 conidx = uhos_ble_pal_conn_id_switch(conn_handle, UHOS_BLE_CONNECT_SWITCH_MODE_DEC);
-    // *mtu_size = app_ble_get_con_mtu((uhos_u8)conidx);
+    uhos_u16 mtu = uhos_ble_pal_conn_mtu_get(conn_handle);
+
+    if ((UHOS_NULL == mtu_size) || (0 == mtu))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    *mtu_size = mtu;
 
     return UHOS_BLE_SUCCESS;
 }
@@ -0,0 +1,234 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_gattc_cache.c
+ * @author agent (agent@local)
+ * @brief GATT client端对端属性数据库缓存的持久化实现
+ * @details 每个对端一个文件，文件名由对端地址生成；文件内容为文件头加属性数据库，
+ *          文件头中的校验和用于识别损坏或版本不一致的缓存
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：GATT client端对端属性数据库缓存的持久化实现
+ * </table>
+ */
+
+#define LOG_TAG "ble-d"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_fs.h"
+#include "uh_dirent.h"
+
+#include "uh_ble.h"
+#include "uh_ble_gattc_cache.h"
+
+/**************************************************************************************************/
+/*                                          外部引用声明                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+// 缓存文件所在目录
+#ifndef CONFIG_UHOS_BLE_GATTC_CACHE_DIR
+#define CONFIG_UHOS_BLE_GATTC_CACHE_DIR     "/data/ble_gattc"
+#endif
+
+#define UHOS_BLE_GATTC_CACHE_PREFIX         "db_"
+#define UHOS_BLE_GATTC_CACHE_PATH_LEN       64
+#define UHOS_BLE_GATTC_CACHE_MAGIC          0x55474443  // "UGDC"
+#define UHOS_BLE_GATTC_CACHE_VERSION        1
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      缓存文件头
+ */
+typedef struct uhos_ble_pal_gattc_cache_hdr
+{
+    uhos_u32 magic;                                             //<! 魔数
+    uhos_u16 version;                                           //<! 格式版本
+    uhos_u16 size;                                              //<! 属性数据库长度
+    uhos_u32 checksum;                                          //<! 属性数据库的FNV-1a校验和
+} uhos_ble_pal_gattc_cache_hdr_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          内部函数原型                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       计算FNV-1a校验和
+ */
+static uhos_u32 uhos_ble_pal_gattc_cache_checksum(const uhos_u8 *data, uhos_u32 len)
+{
+    uhos_u32 hash = 2166136261u;
+    uhos_u32 i    = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief       生成对端的缓存文件路径
+ */
+static void uhos_ble_pal_gattc_cache_path(const uhos_u8 *bda, uhos_char *path, uhos_u32 size)
+{
+    uhos_libc_snprintf(path, size, "%s/%s%02x%02x%02x%02x%02x%02x", CONFIG_UHOS_BLE_GATTC_CACHE_DIR,
+                       UHOS_BLE_GATTC_CACHE_PREFIX, bda[0], bda[1], bda[2], bda[3], bda[4], bda[5]);
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       读取对端的属性数据库缓存
+ */
+uhos_ble_pal_gattc_db_t *uhos_ble_pal_gattc_cache_load(const uhos_u8 *bda)
+{
+    uhos_ble_pal_gattc_cache_hdr_t hdr = {0};
+    uhos_ble_pal_gattc_db_t       *db  = UHOS_NULL;
+    uhos_char                      path[UHOS_BLE_GATTC_CACHE_PATH_LEN];
+    uhos_s32                       fd  = -1;
+
+    uhos_ble_pal_gattc_cache_path(bda, path, sizeof(path));
+
+    fd = uhos_open(path, UHOS_O_RDONLY);
+    if (fd < 0)
+    {
+        return UHOS_NULL;
+    }
+
+    db = uhos_libc_malloc(sizeof(uhos_ble_pal_gattc_db_t));
+    if (UHOS_NULL == db)
+    {
+        UHOS_LOGE("malloc fail");
+        uhos_close(fd);
+        return UHOS_NULL;
+    }
+
+    if ((sizeof(hdr) != uhos_read(fd, &hdr, sizeof(hdr)))
+     || (UHOS_BLE_GATTC_CACHE_MAGIC != hdr.magic)
+     || (UHOS_BLE_GATTC_CACHE_VERSION != hdr.version)
+     || (sizeof(uhos_ble_pal_gattc_db_t) != hdr.size)
+     || (sizeof(uhos_ble_pal_gattc_db_t) != uhos_read(fd, db, sizeof(uhos_ble_pal_gattc_db_t)))
+     || (hdr.checksum != uhos_ble_pal_gattc_cache_checksum((const uhos_u8 *)db, sizeof(uhos_ble_pal_gattc_db_t)))
+     || (0 != uhos_libc_memcmp(db->bda, bda, sizeof(uhos_ble_addr_t)))
+     || (db->svc_num > CONFIG_UHOS_BLE_GATTC_CACHE_SVC_NUM)
+     || (db->char_num > CONFIG_UHOS_BLE_GATTC_CACHE_CHAR_NUM)
+     || (db->desc_num > CONFIG_UHOS_BLE_GATTC_CACHE_DESC_NUM))
+    {
+        UHOS_LOGW("drop invalid cache %s", path);
+        uhos_close(fd);
+        uhos_libc_free(db);
+        uhos_unlink(path);
+        return UHOS_NULL;
+    }
+
+    uhos_close(fd);
+
+    return db;
+}
+
+/**
+ * @brief       保存对端的属性数据库缓存
+ */
+uhos_ble_status_t uhos_ble_pal_gattc_cache_save(const uhos_ble_pal_gattc_db_t *db)
+{
+    uhos_ble_pal_gattc_cache_hdr_t hdr = {0};
+    uhos_char                      path[UHOS_BLE_GATTC_CACHE_PATH_LEN];
+    uhos_s32                       fd  = -1;
+    uhos_bool                      ok  = UHOS_FALSE;
+
+    if (UHOS_NULL == db)
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    hdr.magic    = UHOS_BLE_GATTC_CACHE_MAGIC;
+    hdr.version  = UHOS_BLE_GATTC_CACHE_VERSION;
+    hdr.size     = sizeof(uhos_ble_pal_gattc_db_t);
+    hdr.checksum = uhos_ble_pal_gattc_cache_checksum((const uhos_u8 *)db, sizeof(uhos_ble_pal_gattc_db_t));
+
+    // 目录已存在时创建失败，忽略
+    uhos_mkdir(CONFIG_UHOS_BLE_GATTC_CACHE_DIR);
+
+    uhos_ble_pal_gattc_cache_path(db->bda, path, sizeof(path));
+
+    fd = uhos_open(path, UHOS_O_WRONLY | UHOS_O_CREAT | UHOS_O_TRUNC);
+    if (fd < 0)
+    {
+        UHOS_LOGE("open %s fail %d", path, fd);
+        return UHOS_BLE_ERROR;
+    }
+
+    ok = (sizeof(hdr) == uhos_write(fd, &hdr, sizeof(hdr)))
+      && (sizeof(uhos_ble_pal_gattc_db_t) == uhos_write(fd, db, sizeof(uhos_ble_pal_gattc_db_t)));
+
+    uhos_close(fd);
+
+    if (!ok)
+    {
+        UHOS_LOGE("write %s fail", path);
+        uhos_unlink(path);
+        return UHOS_BLE_ERROR;
+    }
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       删除对端的属性数据库缓存
+ */
+void uhos_ble_pal_gattc_cache_remove(const uhos_u8 *bda)
+{
+    uhos_dir_t    *dir   = UHOS_NULL;
+    uhos_dirent_t *entry = UHOS_NULL;
+    uhos_char      path[UHOS_BLE_GATTC_CACHE_PATH_LEN];
+
+    if (bda)
+    {
+        uhos_ble_pal_gattc_cache_path(bda, path, sizeof(path));
+        uhos_unlink(path);
+        return;
+    }
+
+    dir = uhos_opendir(CONFIG_UHOS_BLE_GATTC_CACHE_DIR);
+    if (UHOS_NULL == dir)
+    {
+        return;
+    }
+
+    while (UHOS_NULL != (entry = uhos_readdir(dir)))
+    {
+        if (0 == uhos_libc_strncmp(entry->d_name, UHOS_BLE_GATTC_CACHE_PREFIX,
+                                   uhos_libc_strlen(UHOS_BLE_GATTC_CACHE_PREFIX)))
+        {
+            uhos_libc_snprintf(path, sizeof(path), "%s/%s", CONFIG_UHOS_BLE_GATTC_CACHE_DIR, entry->d_name);
+            uhos_unlink(path);
+        }
+    }
+
+    uhos_closedir(dir);
+}
@@ -0,0 +1,651 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_ble_wl.c
+ * @author agent (agent@local)
+ * @brief BLE白名单影子的功能实现
+ * @details 应用对白名单的修改先落在按地址排序的影子表上，同步时与控制器白名单的镜像做归并比较，
+ *          只下发差异（差异比整表重写还多时改为清空后重写）。控制器在扫描使用白名单时拒绝修改，
+ *          因此只有扫描正在使用白名单、或扫描过滤策略需要切换时才暂停扫描，整批差异在同一个窗口内下发。
+ *          地址数超过控制器容量时不再修改控制器，扫描改为不过滤，由扫描回调按影子表丢弃广播。
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：BLE白名单影子的功能实现
+ * </table>
+ */
+
+#define LOG_TAG "ble-w"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "esp_gap_ble_api.h"
+#include "esp_bt_defs.h"
+
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_osal.h"
+#include "uh_log.h"
+
+#include "uh_ble.h"
+#include "uh_ble_common.h"
+#include "uh_ble_gap.h"
+#include "uh_ble_wl.h"
+
+/**************************************************************************************************/
+/*                                          外部引用声明                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define UHOS_BLE_WL_ADDR_LEN    6
+
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      白名单影子控制块
+ * @note        地址均为协议栈字节序，shadow与ctrl按memcmp升序排列
+ */
+typedef struct uhos_ble_pal_wl_ctl
+{
+    uhos_mutex_t                    mutex;                      //<! 互斥锁
+    uhos_bool                       filter;                     //<! 扫描只上报白名单设备
+    uhos_bool                       host_filter;                //<! 由主机侧过滤
+    uhos_bool                       dirty;                      //<! 控制器白名单与镜像可能不一致，需整表重写
+    uhos_bool                       paused;                     //<! 扫描已为同步暂停，等待重新启动
+    uhos_u32                        pause_time;                 //<! 暂停扫描的时刻
+    uhos_u16                        capacity;                   //<! 控制器白名单容量
+    uhos_u16                        shadow_num;
+    uhos_u16                        ctrl_num;
+    uhos_ble_addr_t                 shadow[CONFIG_UHOS_BLE_WL_SHADOW_NUM];  //<! 应用设置的白名单
+    uhos_ble_addr_t                 ctrl[CONFIG_UHOS_BLE_WL_SHADOW_NUM];    //<! 控制器白名单的镜像
+    uhos_ble_gap_white_list_stats_t stats;                      //<! 统计信息
+} uhos_ble_pal_wl_ctl_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_ble_pal_wl_ctl_t g_uhos_ble_pal_wl_ctl = {0};
+
+/**************************************************************************************************/
+/*                                          内部函数原型                                          */
+/**************************************************************************************************/
+
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static void uhos_ble_pal_wl_lock(void)
+{
+    uhos_mutex_wait(g_uhos_ble_pal_wl_ctl.mutex, UHOS_MUTEX_WAIT_FOREVER);
+}
+
+static void uhos_ble_pal_wl_unlock(void)
+{
+    uhos_mutex_release(g_uhos_ble_pal_wl_ctl.mutex);
+}
+
+/**
+ * @brief       在有序表中二分查找地址
+ * @param[out]  pos 找到时为地址位置，未找到时为插入位置
+ * @return      是否找到
+ */
+static uhos_bool uhos_ble_pal_wl_search(const uhos_ble_addr_t *list, uhos_u16 num, const uhos_u8 *addr,
+                                        uhos_u16 *pos)
+{
+    uhos_u16 lo = 0;
+    uhos_u16 hi = num;
+    uhos_u16 mid = 0;
+    uhos_s32 cmp = 0;
+
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+        cmp = uhos_libc_memcmp(list[mid], addr, UHOS_BLE_WL_ADDR_LEN);
+        if (0 == cmp)
+        {
+            *pos = mid;
+            return UHOS_TRUE;
+        }
+
+        if (cmp < 0)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    *pos = lo;
+    return UHOS_FALSE;
+}
+
+/**
+ * @brief       有序插入，已存在时不重复插入
+ * @return      UHOS_FALSE表示表已满
+ */
+static uhos_bool uhos_ble_pal_wl_insert(uhos_ble_addr_t *list, uhos_u16 *num, const uhos_u8 *addr)
+{
+    uhos_u16 pos = 0;
+
+    if (uhos_ble_pal_wl_search(list, *num, addr, &pos))
+    {
+        return UHOS_TRUE;
+    }
+
+    if (*num >= CONFIG_UHOS_BLE_WL_SHADOW_NUM)
+    {
+        return UHOS_FALSE;
+    }
+
+    uhos_libc_memmove(&list[pos + 1], &list[pos], (*num - pos) * sizeof(uhos_ble_addr_t));
+    uhos_libc_memcpy(list[pos], addr, UHOS_BLE_WL_ADDR_LEN);
+    (*num)++;
+
+    return UHOS_TRUE;
+}
+
+static void uhos_ble_pal_wl_erase(uhos_ble_addr_t *list, uhos_u16 *num, const uhos_u8 *addr)
+{
+    uhos_u16 pos = 0;
+
+    if (uhos_ble_pal_wl_search(list, *num, addr, &pos))
+    {
+        (*num)--;
+        uhos_libc_memmove(&list[pos], &list[pos + 1], (*num - pos) * sizeof(uhos_ble_addr_t));
+    }
+}
+
+/**
+ * @brief       下发单个添加/删除操作，并同步更新控制器镜像
+ */
+static uhos_ble_status_t uhos_ble_pal_wl_ctrl_update(uhos_bool add, const uhos_u8 *addr)
+{
+    uhos_ble_pal_wl_ctl_t *ctl = &g_uhos_ble_pal_wl_ctl;
+    esp_err_t ret = 0;
+
+    ret = esp_ble_gap_update_whitelist(add, (uhos_u8 *)addr, BLE_WL_ADDR_TYPE_PUBLIC);
+    if (ESP_OK != ret)
+    {
+        UHOS_LOGE("ble white list %s fail, 0x%4x", add ? "add" : "del", ret);
+        ctl->dirty = UHOS_TRUE;
+        return UHOS_BLE_ERROR;
+    }
+
+    if (add)
+    {
+        uhos_ble_pal_wl_insert(ctl->ctrl, &ctl->ctrl_num, addr);
+        ctl->stats.adds++;
+    }
+    else
+    {
+        uhos_ble_pal_wl_erase(ctl->ctrl, &ctl->ctrl_num, addr);
+        ctl->stats.removes++;
+    }
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       清空控制器白名单
+ */
+static uhos_ble_status_t uhos_ble_pal_wl_ctrl_clear(void)
+{
+    uhos_ble_pal_wl_ctl_t *ctl = &g_uhos_ble_pal_wl_ctl;
+    esp_err_t ret = 0;
+
+    ret = esp_ble_gap_clear_whitelist();
+    if (ESP_OK != ret)
+    {
+        UHOS_LOGE("ble white list clear fail, 0x%4x", ret);
+        ctl->dirty = UHOS_TRUE;
+        return UHOS_BLE_ERROR;
+    }
+
+    ctl->ctrl_num = 0;
+    ctl->dirty    = UHOS_FALSE;
+    ctl->stats.clears++;
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       计算影子与控制器镜像的差异操作数
+ * @param[out]  rewrite 整表重写（清空后逐个添加）是否更省
+ * @return      需要下发的操作数
+ */
+static uhos_u16 uhos_ble_pal_wl_diff(uhos_bool *rewrite)
+{
+    uhos_ble_pal_wl_ctl_t *ctl = &g_uhos_ble_pal_wl_ctl;
+    uhos_u16 i = 0;
+    uhos_u16 j = 0;
+    uhos_u16 ops = 0;
+    uhos_s32 cmp = 0;
+
+    while ((i < ctl->shadow_num) || (j < ctl->ctrl_num))
+    {
+        if (i == ctl->shadow_num)
+        {
+            cmp = 1;
+        }
+        else if (j == ctl->ctrl_num)
+        {
+            cmp = -1;
+        }
+        else
+        {
+            cmp = uhos_libc_memcmp(ctl->shadow[i], ctl->ctrl[j], UHOS_BLE_WL_ADDR_LEN);
+        }
+
+        if (0 == cmp)
+        {
+            i++;
+            j++;
+            continue;
+        }
+
+        if (cmp < 0)
+        {
+            i++;
+        }
+        else
+        {
+            j++;
+        }
+        ops++;
+    }
+
+    *rewrite = UHOS_FALSE;
+    if (ctl->dirty)
+    {
+        *rewrite = UHOS_TRUE;
+        return ctl->shadow_num + 1;
+    }
+
+    if ((0 != ops) && (ctl->shadow_num + 1 < ops))
+    {
+        *rewrite = UHOS_TRUE;
+        return ctl->shadow_num + 1;
+    }
+
+    return ops;
+}
+
+/**
+ * @brief       把差异下发到控制器
+ * @note        先删后加，避免控制器白名单在中途溢出
+ */
+static uhos_ble_status_t uhos_ble_pal_wl_apply(uhos_bool rewrite)
+{
+    uhos_ble_pal_wl_ctl_t *ctl = &g_uhos_ble_pal_wl_ctl;
+    uhos_u16 i = 0;
+    uhos_u16 pos = 0;
+
+    if (rewrite)
+    {
+        if (UHOS_BLE_SUCCESS != uhos_ble_pal_wl_ctrl_clear())
+        {
+            return UHOS_BLE_ERROR;
+        }
+    }
+
+    // 镜像在删除时会前移，从尾部开始遍历
+    for (i = ctl->ctrl_num; i > 0; i--)
+    {
+        if (!uhos_ble_pal_wl_search(ctl->shadow, ctl->shadow_num, ctl->ctrl[i - 1], &pos))
+        {
+            if (UHOS_BLE_SUCCESS != uhos_ble_pal_wl_ctrl_update(UHOS_FALSE, ctl->ctrl[i - 1]))
+            {
+                return UHOS_BLE_ERROR;
+            }
+        }
+    }
+
+    for (i = 0; i < ctl->shadow_num; i++)
+    {
+        if (!uhos_ble_pal_wl_search(ctl->ctrl, ctl->ctrl_num, ctl->shadow[i], &pos))
+        {
+            if (UHOS_BLE_SUCCESS != uhos_ble_pal_wl_ctrl_update(UHOS_TRUE, ctl->shadow[i]))
+            {
+                return UHOS_BLE_ERROR;
+            }
+        }
+    }
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       白名单影子初始化，控制器白名单视为空
+ */
+void uhos_ble_pal_wl_init(void)
+{
+    uhos_ble_pal_wl_ctl_t *ctl = &g_uhos_ble_pal_wl_ctl;
+
+    if (UHOS_NULL == ctl->mutex)
+    {
+        if (UHOS_SUCCESS != uhos_mutex_create(&ctl->mutex))
+        {
+            UHOS_LOGE("create mutex err");
+            return;
+        }
+    }
+
+    uhos_ble_pal_wl_lock();
+    ctl->host_filter = UHOS_FALSE;
+    ctl->dirty       = UHOS_FALSE;
+    ctl->paused      = UHOS_FALSE;
+    ctl->capacity    = 0;
+    ctl->shadow_num  = 0;
+    ctl->ctrl_num    = 0;
+    uhos_libc_memset(&ctl->stats, 0, sizeof(ctl->stats));
+    uhos_ble_pal_wl_unlock();
+}
+
+/**
+ * @brief       修改影子白名单
+ */
+uhos_ble_status_t uhos_ble_pal_wl_edit(uhos_ble_pal_gap_white_list_op_t op, const uhos_u8 *addr)
+{
+    uhos_ble_pal_wl_ctl_t *ctl = &g_uhos_ble_pal_wl_ctl;
+    uhos_ble_status_t ret = UHOS_BLE_SUCCESS;
+
+    if ((UHOS_NULL == ctl->mutex) || ((UHOS_BLE_GAP_WHITE_LIST_CLEAR != op) && (UHOS_NULL == addr)))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_pal_wl_lock();
+    switch (op)
+    {
+        case UHOS_BLE_GAP_WHITE_LIST_ADD:
+            if (!uhos_ble_pal_wl_insert(ctl->shadow, &ctl->shadow_num, addr))
+            {
+                UHOS_LOGE("white list full");
+                ret = UHOS_BLE_ERROR;
+            }
+            break;
+
+        case UHOS_BLE_GAP_WHITE_LIST_DEL:
+            uhos_ble_pal_wl_erase(ctl->shadow, &ctl->shadow_num, addr);
+            break;
+
+        case UHOS_BLE_GAP_WHITE_LIST_CLEAR:
+            ctl->shadow_num = 0;
+            break;
+
+        default:
+            ret = UHOS_BLE_ERROR;
+            break;
+    }
+    uhos_ble_pal_wl_unlock();
+
+    return ret;
+}
+
+/**
+ * @brief       以地址列表整体替换影子白名单
+ */
+uhos_ble_status_t uhos_ble_pal_wl_replace(const uhos_ble_addr_t *list, uhos_u16 num)
+{
+    uhos_ble_pal_wl_ctl_t *ctl = &g_uhos_ble_pal_wl_ctl;
+    uhos_ble_addr_t *tmp = UHOS_NULL;
+    uhos_u16 tmp_num = 0;
+    uhos_u16 i = 0;
+
+    if ((UHOS_NULL == ctl->mutex) || ((0 != num) && (UHOS_NULL == list)))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    // 先在临时表中排序去重，失败时影子保持不变
+    tmp = (uhos_ble_addr_t *)uhos_libc_malloc(sizeof(ctl->shadow));
+    if (UHOS_NULL == tmp)
+    {
+        UHOS_LOGE("malloc err");
+        return UHOS_BLE_ERROR;
+    }
+
+    for (i = 0; i < num; i++)
+    {
+        if (!uhos_ble_pal_wl_insert(tmp, &tmp_num, list[i]))
+        {
+            UHOS_LOGE("white list over %d", CONFIG_UHOS_BLE_WL_SHADOW_NUM);
+            uhos_libc_free(tmp);
+            return UHOS_BLE_ERROR;
+        }
+    }
+
+    uhos_ble_pal_wl_lock();
+    uhos_libc_memcpy(ctl->shadow, tmp, tmp_num * sizeof(uhos_ble_addr_t));
+    ctl->shadow_num = tmp_num;
+    uhos_ble_pal_wl_unlock();
+
+    uhos_libc_free(tmp);
+
+    return UHOS_BLE_SUCCESS;
+}
+
+/**
+ * @brief       将影子白名单与控制器白名单的差异在一个扫描暂停窗口内下发
+ */
+uhos_ble_status_t uhos_ble_pal_wl_sync(void)
+{
+    uhos_ble_pal_wl_ctl_t *ctl = &g_uhos_ble_pal_wl_ctl;
+    uhos_ble_status_t ret = UHOS_BLE_SUCCESS;
+    uhos_bool rewrite = UHOS_FALSE;
+    uhos_bool cur_policy = UHOS_FALSE;
+    uhos_bool want_policy = UHOS_FALSE;
+    uhos_bool host = UHOS_FALSE;
+    uhos_bool pause = UHOS_FALSE;
+    uhos_u16  avail = 0;
+    uhos_u16  ops = 0;
+
+    if ((UHOS_NULL == ctl->mutex) || !uhos_ble_is_inited())
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_pal_wl_lock();
+
+    // 控制器上报的是剩余空间
+    if (ESP_OK == esp_ble_gap_get_whitelist_size(&avail))
+    {
+        ctl->capacity = avail + ctl->ctrl_num;
+    }
+
+    host        = (ctl->shadow_num > ctl->capacity);
+    want_policy = (ctl->filter && !host);
+    ops         = host ? 0 : uhos_ble_pal_wl_diff(&rewrite);
+
+    if (uhos_ble_pal_gap_scan_active(&cur_policy))
+    {
+        pause = ((cur_policy && (0 != ops)) || (cur_policy != want_policy));
+    }
+
+    if (pause)
+    {
+        ctl->stats.windows++;
+        ctl->paused     = UHOS_TRUE;
+        ctl->pause_time = uhos_current_time_get();
+        uhos_ble_pal_gap_scan_pause();
+    }
+
+    if (0 != ops)
+    {
+        ctl->stats.syncs++;
+        ret = uhos_ble_pal_wl_apply(rewrite);
+        if (UHOS_BLE_SUCCESS != ret)
+        {
+            // 控制器白名单不完整时不能用于过滤
+            ctl->stats.failures++;
+            host        = ctl->filter;
+            want_policy = UHOS_FALSE;
+        }
+    }
+
+    if (host != ctl->host_filter)
+    {
+        UHOS_LOGI("white list %d/%d, host filter %d", ctl->shadow_num, ctl->capacity, host);
+    }
+    ctl->host_filter = host;
+
+    if (pause)
+    {
+        uhos_ble_pal_gap_scan_resume(want_policy);
+
+        // 扫描已到期或恢复失败时不再等待重新启动
+        if (!uhos_ble_pal_gap_scan_active(UHOS_NULL))
+        {
+            ctl->paused = UHOS_FALSE;
+        }
+    }
+    uhos_ble_pal_wl_unlock();
+
+    return ret;
+}
+
+/**
+ * @brief       扫描是否应使用控制器白名单过滤策略
+ */
+uhos_bool uhos_ble_pal_wl_scan_policy(void)
+{
+    uhos_ble_pal_wl_ctl_t *ctl = &g_uhos_ble_pal_wl_ctl;
+    uhos_bool policy = UHOS_FALSE;
+
+    if (UHOS_NULL == ctl->mutex)
+    {
+        return UHOS_FALSE;
+    }
+
+    uhos_ble_pal_wl_lock();
+    policy = (ctl->filter && !ctl->host_filter && !ctl->dirty);
+    uhos_ble_pal_wl_unlock();
+
+    return policy;
+}
+
+/**
+ * @brief       主机侧过滤：判断广播是否应丢弃
+ */
+uhos_bool uhos_ble_pal_wl_host_drop(const uhos_u8 *bda)
+{
+    uhos_ble_pal_wl_ctl_t *ctl = &g_uhos_ble_pal_wl_ctl;
+    uhos_bool drop = UHOS_FALSE;
+    uhos_u16  pos = 0;
+
+    // 未开启主机侧过滤时不加锁，避免扫描回调争用
+    if (!__atomic_load_n(&ctl->host_filter, __ATOMIC_RELAXED) || (UHOS_NULL == ctl->mutex))
+    {
+        return UHOS_FALSE;
+    }
+
+    uhos_ble_pal_wl_lock();
+    if (ctl->host_filter && !uhos_ble_pal_wl_search(ctl->shadow, ctl->shadow_num, bda, &pos))
+    {
+        ctl->stats.host_filtered++;
+        drop = UHOS_TRUE;
+    }
+    uhos_ble_pal_wl_unlock();
+
+    return drop;
+}
+
+/**
+ * @brief       控制器白名单更新完成
+ */
+void uhos_ble_pal_wl_update_done(uhos_bool success)
+{
+    uhos_ble_pal_wl_ctl_t *ctl = &g_uhos_ble_pal_wl_ctl;
+
+    if (success || (UHOS_NULL == ctl->mutex))
+    {
+        return;
+    }
+
+    uhos_ble_pal_wl_lock();
+    ctl->stats.failures++;
+    ctl->dirty = UHOS_TRUE;
+    uhos_ble_pal_wl_unlock();
+}
+
+/**
+ * @brief       扫描已启动
+ */
+void uhos_ble_pal_wl_scan_started(void)
+{
+    uhos_ble_pal_wl_ctl_t *ctl = &g_uhos_ble_pal_wl_ctl;
+    uhos_u32 downtime = 0;
+
+    if (UHOS_NULL == ctl->mutex)
+    {
+        return;
+    }
+
+    uhos_ble_pal_wl_lock();
+    if (ctl->paused)
+    {
+        ctl->paused   = UHOS_FALSE;
+        downtime      = uhos_current_time_get() - ctl->pause_time;
+        ctl->stats.last_downtime_ms   = downtime;
+        ctl->stats.total_downtime_ms += downtime;
+        if (downtime > ctl->stats.max_downtime_ms)
+        {
+            ctl->stats.max_downtime_ms = downtime;
+        }
+    }
+    uhos_ble_pal_wl_unlock();
+}
+
+/**
+ * @brief       设置扫描是否只上报白名单设备的广播
+ */
+uhos_ble_status_t uhos_ble_gap_white_list_filter_enable(uhos_bool enable)
+{
+    uhos_ble_pal_wl_ctl_t *ctl = &g_uhos_ble_pal_wl_ctl;
+
+    if (false == uhos_ble_is_inited())
+    {
+        UHOS_LOGW("ble not inited");
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_pal_wl_lock();
+    ctl->filter = enable ? UHOS_TRUE : UHOS_FALSE;
+    uhos_ble_pal_wl_unlock();
+
+    return uhos_ble_pal_wl_sync();
+}
+
+/**
+ * @brief       获取白名单的统计信息
+ */
+uhos_ble_status_t uhos_ble_gap_white_list_stats_get(uhos_ble_gap_white_list_stats_t *stats)
+{
+    uhos_ble_pal_wl_ctl_t *ctl = &g_uhos_ble_pal_wl_ctl;
+
+    if ((UHOS_NULL == stats) || (UHOS_NULL == ctl->mutex))
+    {
+        return UHOS_BLE_ERROR;
+    }
+
+    uhos_ble_pal_wl_lock();
+    uhos_libc_memcpy(stats, &ctl->stats, sizeof(uhos_ble_gap_white_list_stats_t));
+    stats->num         = ctl->shadow_num;
+    stats->capacity    = ctl->capacity;
+    stats->host_filter = ctl->host_filter;
+    uhos_ble_pal_wl_unlock();
+
+    return UHOS_BLE_SUCCESS;
+}
@@ -0,0 +1,512 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file linux_posix_fs.c
+ * @author agent (agent@local)
+ * @brief 基于POSIX文件接口的文件系统适配层实现，用于在Linux主机上运行与测试SDK
+ * @details 设备上的绝对路径映射到主机目录CONFIG_UHOS_FS_LINUX_ROOT之下，例如"/data/ble_gattc"
+ *          对应"<root>/data/ble_gattc"，测试之间互不影响，也不会写到主机的根目录；
+ *          uh_fs_types.h中的打开标志、文件类型与Linux取值一致，直接透传
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：基于POSIX文件接口的文件系统适配层实现，用于在Linux主机上运行与测试SDK
+ * </table>
+ */
+
+#define LOG_TAG "linux_fs"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+
+#include "uh_types.h"
+#include "uh_fs.h"
+#include "uh_dirent.h"
+#include "uh_log.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#ifndef CONFIG_UHOS_FS_LINUX_ROOT
+#define CONFIG_UHOS_FS_LINUX_ROOT   "/tmp/uhos_fs"              //<! 设备文件系统在主机上的根目录
+#endif
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      目录流
+ * @note        uhos_dirent_t的d_name为柔性数组，与名字缓冲区放在同一个联合体中保证空间
+ */
+struct uhos_dir_s
+{
+    DIR *dir;                                                   //<! 主机目录流
+    union
+    {
+        uhos_dirent_t ent;                                      //<! 最近一次读出的目录项
+        uhos_u8       raw[sizeof(uhos_dirent_t) + NAME_MAX + 1];
+    } u;
+};
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       把设备路径映射为主机路径，相对路径相对于当前工作目录，不做映射
+ * @return      0-成功，-1-路径过长
+ */
+static int linux_posix_fs_path(const uhos_char *path, char *out, size_t size)
+{
+    int len = 0;
+
+    if (UHOS_NULL == path)
+    {
+        return -1;
+    }
+
+    if ('/' == path[0])
+    {
+        len = snprintf(out, size, "%s%s", CONFIG_UHOS_FS_LINUX_ROOT, path);
+    }
+    else
+    {
+        len = snprintf(out, size, "%s", path);
+    }
+
+    return ((len < 0) || ((size_t)len >= size)) ? -1 : 0;
+}
+
+/**
+ * @brief       逐级创建目录，已存在的目录不算错误
+ */
+static int linux_posix_fs_mkdirs(char *path)
+{
+    char *p = path + 1;
+
+    for (; *p; p++)
+    {
+        if ('/' != *p)
+        {
+            continue;
+        }
+
+        *p = '\0';
+        if ((0 != mkdir(path, 0755)) && (EEXIST != errno))
+        {
+            *p = '/';
+            return -1;
+        }
+        *p = '/';
+    }
+
+    return ((0 == mkdir(path, 0755)) || (EEXIST == errno)) ? 0 : -1;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+/****************FS-FILE*********************/
+uhos_s32 uhos_fs_init(uhos_void)
+{
+    char root[] = CONFIG_UHOS_FS_LINUX_ROOT;
+
+    if (0 != linux_posix_fs_mkdirs(root))
+    {
+        UHOS_LOGE("mkdir %s fail %d", root, errno);
+        return -1;
+    }
+
+    return 0;
+}
+
+uhos_s32 uhos_open(const uhos_char *path, uhos_s32 flags)
+{
+    char real[PATH_MAX];
+
+    if (0 != linux_posix_fs_path(path, real, sizeof(real)))
+    {
+        return -1;
+    }
+
+    return open(real, flags | O_CLOEXEC, 0644);
+}
+
+uhos_s32 uhos_close(uhos_s32 fd)
+{
+    return close(fd);
+}
+
+uhos_s32 uhos_read(uhos_s32 fd, uhos_void *buf, uhos_u32 nbytes)
+{
+    return (uhos_s32)read(fd, buf, nbytes);
+}
+
+uhos_s32 uhos_write(uhos_s32 fd, const uhos_void *buf, uhos_u32 nbytes)
+{
+    return (uhos_s32)write(fd, buf, nbytes);
+}
+
+uhos_s32 uhos_ioctl(uhos_s32 fd, uhos_s32 cmd, ...)
+{
+    va_list ap;
+    void   *arg = UHOS_NULL;
+
+    va_start(ap, cmd);
+    arg = va_arg(ap, void *);
+    va_end(ap);
+
+    return ioctl(fd, (unsigned long)cmd, arg);
+}
+
+uhos_s32 uhos_do_pollfd(uhos_s32 fd, uhos_s32 flag, uhos_poll_notify_t notify, uhos_void *fds, uhos_void *arg)
+{
+    (void)fd;
+    (void)flag;
+    (void)notify;
+    (void)fds;
+    (void)arg;
+
+    // 主机上由select/poll直接等待描述符，不需要文件系统注册通知
+    return -1;
+}
+
+uhos_s32 uhos_lseek(uhos_s32 fd, uhos_s32 offset, uhos_s32 whence)
+{
+    return (uhos_s32)lseek(fd, offset, whence);
+}
+
+uhos_s32 uhos_sync(uhos_s32 fd)
+{
+    return fsync(fd);
+}
+
+uhos_void uhos_allsync(uhos_void)
+{
+    sync();
+}
+
+uhos_s32 uhos_stat(const uhos_char *path, uhos_stat_t *st)
+{
+    char        real[PATH_MAX];
+    struct stat hst;
+
+    if ((UHOS_NULL == st) || (0 != linux_posix_fs_path(path, real, sizeof(real))) || (0 != stat(real, &hst)))
+    {
+        return -1;
+    }
+
+    st->st_mode    = (uhos_u16)(hst.st_mode & UHOS_S_IFMT);
+    st->st_size    = (uhos_u32)hst.st_size;
+    st->st_actime  = (uhos_time_t)hst.st_atime;
+    st->st_modtime = (uhos_time_t)hst.st_mtime;
+    st->st_blksize = (uhos_size_t)hst.st_blksize;
+    st->st_blocks  = (uhos_u64)hst.st_blocks;
+
+    return 0;
+}
+
+uhos_s32 uhos_fstat(uhos_s32 fd, uhos_stat_t *st)
+{
+    struct stat hst;
+
+    if ((UHOS_NULL == st) || (0 != fstat(fd, &hst)))
+    {
+        return -1;
+    }
+
+    st->st_mode    = (uhos_u16)(hst.st_mode & UHOS_S_IFMT);
+    st->st_size    = (uhos_u32)hst.st_size;
+    st->st_actime  = (uhos_time_t)hst.st_atime;
+    st->st_modtime = (uhos_time_t)hst.st_mtime;
+    st->st_blksize = (uhos_size_t)hst.st_blksize;
+    st->st_blocks  = (uhos_u64)hst.st_blocks;
+
+    return 0;
+}
+
+uhos_s32 uhos_link(const uhos_char *oldpath, const uhos_char *newpath)
+{
+    char real_old[PATH_MAX];
+    char real_new[PATH_MAX];
+
+    if ((0 != linux_posix_fs_path(oldpath, real_old, sizeof(real_old))) ||
+        (0 != linux_posix_fs_path(newpath, real_new, sizeof(real_new))))
+    {
+        return -1;
+    }
+
+    return link(real_old, real_new);
+}
+
+uhos_s32 uhos_unlink(const uhos_char *path)
+{
+    char real[PATH_MAX];
+
+    if (0 != linux_posix_fs_path(path, real, sizeof(real)))
+    {
+        return -1;
+    }
+
+    return unlink(real);
+}
+
+uhos_s32 uhos_remove(const uhos_char *path)
+{
+    char real[PATH_MAX];
+
+    if (0 != linux_posix_fs_path(path, real, sizeof(real)))
+    {
+        return -1;
+    }
+
+    return remove(real);
+}
+
+uhos_s32 uhos_rename(const uhos_char *oldpath, const uhos_char *newpath)
+{
+    char real_old[PATH_MAX];
+    char real_new[PATH_MAX];
+
+    if ((0 != linux_posix_fs_path(oldpath, real_old, sizeof(real_old))) ||
+        (0 != linux_posix_fs_path(newpath, real_new, sizeof(real_new))))
+    {
+        return -1;
+    }
+
+    return rename(real_old, real_new);
+}
+
+uhos_s32 uhos_access(const uhos_char *path, uhos_s32 amode)
+{
+    char real[PATH_MAX];
+
+    if (0 != linux_posix_fs_path(path, real, sizeof(real)))
+    {
+        return -1;
+    }
+
+    return access(real, amode);
+}
+
+uhos_s32 uhos_fcntl(uhos_s32 fd, uhos_s32 cmd, ...)
+{
+    va_list ap;
+    int     arg = 0;
+
+    if (UHOS_F_GETFL == cmd)
+    {
+        return fcntl(fd, F_GETFL);
+    }
+
+    if (UHOS_F_SETFL == cmd)
+    {
+        va_start(ap, cmd);
+        arg = va_arg(ap, int);
+        va_end(ap);
+        return fcntl(fd, F_SETFL, arg);
+    }
+
+    return -1;
+}
+
+uhos_s32 uhos_utime(const uhos_char *path, const uhos_utimbuf_t *times)
+{
+    char           real[PATH_MAX];
+    struct utimbuf buf;
+
+    if (0 != linux_posix_fs_path(path, real, sizeof(real)))
+    {
+        return -1;
+    }
+
+    if (UHOS_NULL == times)
+    {
+        return utime(real, UHOS_NULL);
+    }
+
+    buf.actime  = (time_t)times->actime;
+    buf.modtime = (time_t)times->modtime;
+
+    return utime(real, &buf);
+}
+
+/****************FS-DIR**********************/
+uhos_dir_t *uhos_opendir(const uhos_char *path)
+{
+    char               real[PATH_MAX];
+    struct uhos_dir_s *dir = UHOS_NULL;
+
+    if (0 != linux_posix_fs_path(path, real, sizeof(real)))
+    {
+        return UHOS_NULL;
+    }
+
+    dir = calloc(1, sizeof(struct uhos_dir_s));
+    if (UHOS_NULL == dir)
+    {
+        UHOS_LOGE("malloc fail");
+        return UHOS_NULL;
+    }
+
+    dir->dir = opendir(real);
+    if (UHOS_NULL == dir->dir)
+    {
+        free(dir);
+        return UHOS_NULL;
+    }
+
+    // 目录流对调用者不透明，句柄即控制块地址
+    return (uhos_dir_t *)dir;
+}
+
+uhos_s32 uhos_closedir(uhos_dir_t *dir)
+{
+    struct uhos_dir_s *ctx = (struct uhos_dir_s *)dir;
+    int                ret = 0;
+
+    if (UHOS_NULL == ctx)
+    {
+        return -1;
+    }
+
+    ret = closedir(ctx->dir);
+    free(ctx);
+
+    return ret;
+}
+
+uhos_dirent_t *uhos_readdir(uhos_dir_t *dir)
+{
+    struct uhos_dir_s *ctx = (struct uhos_dir_s *)dir;
+    struct dirent     *ent = UHOS_NULL;
+
+    if (UHOS_NULL == ctx)
+    {
+        return UHOS_NULL;
+    }
+
+    ent = readdir(ctx->dir);
+    if (UHOS_NULL == ent)
+    {
+        return UHOS_NULL;
+    }
+
+    ctx->u.ent.d_ino  = (uhos_s32)ent->d_ino;
+    ctx->u.ent.d_type = ent->d_type;
+    snprintf(ctx->u.ent.d_name, NAME_MAX + 1, "%s", ent->d_name);
+
+    return &ctx->u.ent;
+}
+
+uhos_s32 uhos_mkdir(const uhos_char *path)
+{
+    char  real[PATH_MAX];
+    char *slash = UHOS_NULL;
+
+    if (0 != linux_posix_fs_path(path, real, sizeof(real)))
+    {
+        return -1;
+    }
+
+    // 上级目录（如"/data"）在设备上由分区挂载点提供，主机上一并创建
+    slash = strrchr(real, '/');
+    if (slash && (slash != real))
+    {
+        *slash = '\0';
+        if (0 != linux_posix_fs_mkdirs(real))
+        {
+            return -1;
+        }
+        *slash = '/';
+    }
+
+    return mkdir(real, 0755);
+}
+
+uhos_s32 uhos_rmdir(const uhos_char *path)
+{
+    char real[PATH_MAX];
+
+    if (0 != linux_posix_fs_path(path, real, sizeof(real)))
+    {
+        return -1;
+    }
+
+    return rmdir(real);
+}
+
+uhos_void uhos_rewinddir(uhos_dir_t *dir)
+{
+    struct uhos_dir_s *ctx = (struct uhos_dir_s *)dir;
+
+    if (ctx)
+    {
+        rewinddir(ctx->dir);
+    }
+}
+
+uhos_s32 uhos_telldir(uhos_dir_t *dir)
+{
+    struct uhos_dir_s *ctx = (struct uhos_dir_s *)dir;
+
+    return ctx ? (uhos_s32)telldir(ctx->dir) : -1;
+}
+
+uhos_void uhos_seekdir(uhos_dir_t *dir, uhos_s32 loc)
+{
+    struct uhos_dir_s *ctx = (struct uhos_dir_s *)dir;
+
+    if (ctx)
+    {
+        seekdir(ctx->dir, loc);
+    }
+}
+
+uhos_s32 uhos_chdir(const uhos_char *path)
+{
+    char real[PATH_MAX];
+
+    if (0 != linux_posix_fs_path(path, real, sizeof(real)))
+    {
+        return -1;
+    }
+
+    return chdir(real);
+}
+
+uhos_char *uhos_getcwd(uhos_char *buf, uhos_u32 size)
+{
+    char   real[PATH_MAX];
+    size_t root = strlen(CONFIG_UHOS_FS_LINUX_ROOT);
+
+    if ((UHOS_NULL == buf) || (UHOS_NULL == getcwd(real, sizeof(real))))
+    {
+        return UHOS_NULL;
+    }
+
+    // 位于映射根目录之下时去掉前缀，返回设备路径
+    if ((0 == strncmp(real, CONFIG_UHOS_FS_LINUX_ROOT, root)) && (('/' == real[root]) || ('\0' == real[root])))
+    {
+        snprintf(buf, size, "%s", ('\0' == real[root]) ? "/" : real + root);
+    }
+    else
+    {
+        snprintf(buf, size, "%s", real);
+    }
+
+    return buf;
+}
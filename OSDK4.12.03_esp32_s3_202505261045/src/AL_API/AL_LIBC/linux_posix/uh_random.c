@@ -0,0 +1,50 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_random.c
+ * @author agent (agent@local)
+ * @brief 随机数生成的Linux实现，用于在Linux主机上运行与测试SDK
+ * @details 设备上的实现为un_random.c（esp_random），这里使用内核的getrandom
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：随机数生成的Linux实现，用于在Linux主机上运行与测试SDK
+ * </table>
+ */
+
+#define LOG_TAG "linux_random"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include <errno.h>
+#include <sys/random.h>
+
+#include "uh_types.h"
+#include "uh_random.h"
+#include "uh_log.h"
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+void uhos_random_generate(uhos_u8 *output, uhos_u32 output_len)
+{
+    ssize_t  ret = 0;
+    uhos_u32 off = 0;
+
+    while (off < output_len)
+    {
+        ret = getrandom(output + off, output_len - off, 0);
+        if (ret < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            UHOS_LOGE("getrandom failed, errno %d", errno);
+            return;
+        }
+        off += (uhos_u32)ret;
+    }
+}
@@ -0,0 +1,440 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_net_poller.c
+ * @author agent (agent@local)
+ * @brief 基于lwIP socket的poller实现，用于ESP32
+ * @details lwIP没有epoll；netconn的事件回调由socket层私有的event_callback占用，替换它需要依赖
+ *          lwip/priv头文件与struct lwip_sock的私有字段，这些字段随lwIP版本变化，因此本实现不挂接该回调，
+ *          而是作为接口兼容层在lwIP select之上维护持久的注册表：注册时更新常驻的读写fd set，
+ *          等待时只拷贝一次fd set，返回后只遍历注册表中的fd。每次等待的代价仍与注册fd数相关
+ *          （lwIP select内部同样逐个检查），只是不再随FD_SETSIZE线性扫描，调用者也无需每次重建fd set；
+ *          需要与就绪fd数相关的等待代价时应使用Linux平台的epoll实现。
+ *          注册表变化时通过本地回环UDP socket唤醒正在等待的任务，使修改立即生效
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：基于lwIP socket的poller实现，用于ESP32
+ * </table>
+ */
+
+#define LOG_TAG "esp32_poll"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "lwip/sockets.h"
+
+#include "uh_types.h"
+#include "uh_al_net.h"
+#include "uh_libc.h"
+#include "uh_mutex.h"
+#include "uh_time.h"
+#include "uh_log.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#ifndef CONFIG_UHOS_NET_POLLER_DEF_FDS
+#define CONFIG_UHOS_NET_POLLER_DEF_FDS 16                       // 未指定容量时的注册表初始大小
+#endif
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      fd注册信息
+ */
+typedef struct
+{
+    uhos_s32   fd;                                              //<! 文件描述符
+    uhos_u32   events;                                          //<! 关注的事件
+    uhos_void *data;                                            //<! 用户数据
+} esp32_net_poller_entry_t;
+
+/**
+ * @struct      poller控制块
+ */
+struct uhos_net_poller_s
+{
+    uhos_mutex_t              lock;                             //<! 保护注册表与常驻fd set
+    esp32_net_poller_entry_t *entry;                            //<! 注册表，前num项有效
+    uhos_u32                  num;                              //<! 注册的fd数
+    uhos_u32                  cap;                              //<! 注册表容量
+    uhos_u32                  start;                            //<! 下次从该项开始收集，就绪数超过输出数组时轮转
+    fd_set                    rd_set;                           //<! 常驻读fd set
+    fd_set                    wr_set;                           //<! 常驻写fd set
+    uhos_s32                  max_fd;                           //<! 注册fd与唤醒fd中的最大值
+    uhos_s32                  wake_fd;                          //<! 本地回环唤醒socket
+    uhos_u8                   waiting;                          //<! 是否有任务阻塞在select中
+};
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static void esp32_net_poller_lock(struct uhos_net_poller_s *poller)
+{
+    uhos_mutex_wait(poller->lock, UHOS_MUTEX_WAIT_FOREVER);
+}
+
+static void esp32_net_poller_unlock(struct uhos_net_poller_s *poller)
+{
+    uhos_mutex_release(poller->lock);
+}
+
+/**
+ * @brief       创建绑定到回环地址并连接到自身的UDP socket，用于唤醒select
+ */
+static uhos_s32 esp32_net_poller_wake_open(void)
+{
+    struct sockaddr_in addr = {0};
+    socklen_t          len  = sizeof(addr);
+    int                fd   = -1;
+    int                nb   = 1;
+
+    fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port        = 0;
+    if ((0 != bind(fd, (struct sockaddr *)&addr, sizeof(addr))) ||
+        (0 != getsockname(fd, (struct sockaddr *)&addr, &len)) ||
+        (0 != connect(fd, (struct sockaddr *)&addr, sizeof(addr))))
+    {
+        close(fd);
+        return -1;
+    }
+    ioctlsocket(fd, FIONBIO, &nb);
+
+    return fd;
+}
+
+/**
+ * @brief       唤醒阻塞在select中的任务，调用者持有锁
+ */
+static void esp32_net_poller_wake(struct uhos_net_poller_s *poller)
+{
+    uhos_u8 byte = 0;
+
+    if (poller->waiting)
+    {
+        send(poller->wake_fd, &byte, sizeof(byte), 0);
+        poller->waiting = 0;
+    }
+}
+
+static void esp32_net_poller_wake_drain(struct uhos_net_poller_s *poller)
+{
+    uhos_u8 buf[8];
+
+    while (recv(poller->wake_fd, buf, sizeof(buf), 0) > 0)
+    {
+    }
+}
+
+static esp32_net_poller_entry_t *esp32_net_poller_find(struct uhos_net_poller_s *poller, uhos_s32 fd)
+{
+    uhos_u32 i = 0;
+
+    for (i = 0; i < poller->num; i++)
+    {
+        if (poller->entry[i].fd == fd)
+        {
+            return &poller->entry[i];
+        }
+    }
+
+    return UHOS_NULL;
+}
+
+/**
+ * @brief       按注册信息更新常驻fd set，调用者持有锁
+ */
+static void esp32_net_poller_set(struct uhos_net_poller_s *poller, uhos_s32 fd, uhos_u32 events)
+{
+    FD_CLR(fd, &poller->rd_set);
+    FD_CLR(fd, &poller->wr_set);
+
+    if (events & UHOS_NET_POLL_IN)
+    {
+        FD_SET(fd, &poller->rd_set);
+    }
+    if (events & UHOS_NET_POLL_OUT)
+    {
+        FD_SET(fd, &poller->wr_set);
+    }
+}
+
+/**
+ * @brief       注册表已满时扩容一倍，调用者持有锁
+ */
+static uhos_s32 esp32_net_poller_reserve(struct uhos_net_poller_s *poller)
+{
+    esp32_net_poller_entry_t *entry = UHOS_NULL;
+
+    if (poller->num < poller->cap)
+    {
+        return 0;
+    }
+
+    entry = uhos_libc_realloc(poller->entry, poller->cap * 2 * sizeof(esp32_net_poller_entry_t));
+    if (UHOS_NULL == entry)
+    {
+        return -1;
+    }
+    poller->entry = entry;
+    poller->cap  *= 2;
+
+    return 0;
+}
+
+static void esp32_net_poller_max_update(struct uhos_net_poller_s *poller)
+{
+    uhos_u32 i = 0;
+
+    poller->max_fd = poller->wake_fd;
+    for (i = 0; i < poller->num; i++)
+    {
+        if (poller->entry[i].fd > poller->max_fd)
+        {
+            poller->max_fd = poller->entry[i].fd;
+        }
+    }
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_net_poller_t uhos_net_poller_create(uhos_u32 max_fds)
+{
+    struct uhos_net_poller_s *poller = UHOS_NULL;
+
+    poller = uhos_libc_zalloc(sizeof(struct uhos_net_poller_s));
+    if (UHOS_NULL == poller)
+    {
+        return UHOS_NULL;
+    }
+
+    poller->cap     = max_fds ? max_fds : CONFIG_UHOS_NET_POLLER_DEF_FDS;
+    poller->entry   = uhos_libc_calloc(poller->cap, sizeof(esp32_net_poller_entry_t));
+    poller->wake_fd = esp32_net_poller_wake_open();
+    if ((UHOS_NULL == poller->entry) || (poller->wake_fd < 0) || (UHOS_SUCCESS != uhos_mutex_create(&poller->lock)))
+    {
+        UHOS_LOGE("poller create failed");
+        if (poller->wake_fd >= 0)
+        {
+            close(poller->wake_fd);
+        }
+        uhos_libc_free(poller->entry);
+        uhos_libc_free(poller);
+        return UHOS_NULL;
+    }
+
+    FD_ZERO(&poller->rd_set);
+    FD_ZERO(&poller->wr_set);
+    FD_SET(poller->wake_fd, &poller->rd_set);
+    poller->max_fd = poller->wake_fd;
+
+    return poller;
+}
+
+uhos_s32 uhos_net_poller_ctl(uhos_net_poller_t poller, uhos_u8 op, uhos_s32 fd, uhos_u32 events, uhos_void *data)
+{
+    esp32_net_poller_entry_t *entry = UHOS_NULL;
+    uhos_s32                  ret   = -1;
+
+    if ((UHOS_NULL == poller) || (fd < 0) || (fd >= FD_SETSIZE) || (fd == poller->wake_fd))
+    {
+        return -1;
+    }
+
+    esp32_net_poller_lock(poller);
+    entry = esp32_net_poller_find(poller, fd);
+    switch (op)
+    {
+        case UHOS_NET_POLL_CTL_ADD:
+            if ((UHOS_NULL != entry) || (0 != esp32_net_poller_reserve(poller)))
+            {
+                break;
+            }
+            entry         = &poller->entry[poller->num++];
+            entry->fd     = fd;
+            entry->events = events;
+            entry->data   = data;
+            esp32_net_poller_set(poller, fd, events);
+            if (fd > poller->max_fd)
+            {
+                poller->max_fd = fd;
+            }
+            ret = 0;
+            break;
+
+        case UHOS_NET_POLL_CTL_MOD:
+            if (UHOS_NULL == entry)
+            {
+                break;
+            }
+            entry->events = events;
+            entry->data   = data;
+            esp32_net_poller_set(poller, fd, events);
+            ret = 0;
+            break;
+
+        case UHOS_NET_POLL_CTL_DEL:
+            if (UHOS_NULL == entry)
+            {
+                break;
+            }
+            esp32_net_poller_set(poller, fd, 0);
+            *entry = poller->entry[--poller->num];
+            esp32_net_poller_max_update(poller);
+            ret = 0;
+            break;
+
+        default:
+            break;
+    }
+
+    if (0 == ret)
+    {
+        esp32_net_poller_wake(poller);
+    }
+    esp32_net_poller_unlock(poller);
+
+    if (0 != ret)
+    {
+        UHOS_LOGW("poller ctl op %d fd %d failed", op, fd);
+    }
+
+    return ret;
+}
+
+uhos_s32 uhos_net_poller_wait(uhos_net_poller_t poller, uhos_net_poll_event_t *events, uhos_s32 max_events, uhos_s32 timeout_ms)
+{
+    fd_set          rd_set;
+    fd_set          wr_set;
+    fd_set          ex_set;
+    struct timeval  tv       = {0};
+    struct timeval *ptv      = UHOS_NULL;
+    uhos_u32        deadline = 0;
+    uhos_s32        remain   = timeout_ms;
+    uhos_s32        max      = 0;
+    uhos_s32        num      = 0;
+    uhos_s32        cnt      = 0;
+    uhos_u32        i        = 0;
+    uhos_u32        start    = 0;
+
+    if ((UHOS_NULL == poller) || (UHOS_NULL == events) || (max_events <= 0))
+    {
+        return -1;
+    }
+
+    deadline = uhos_current_time_get() + (uhos_u32)timeout_ms;
+
+    // 仅被注册表修改唤醒时，以剩余时间按新的fd set重新等待
+    while (1)
+    {
+        if (remain >= 0)
+        {
+            tv.tv_sec  = remain / 1000;
+            tv.tv_usec = (remain % 1000) * 1000;
+            ptv        = &tv;
+        }
+
+        esp32_net_poller_lock(poller);
+        rd_set          = poller->rd_set;
+        wr_set          = poller->wr_set;
+        ex_set          = poller->rd_set;
+        max             = poller->max_fd;
+        poller->waiting = 1;
+        esp32_net_poller_unlock(poller);
+
+        num = select(max + 1, &rd_set, &wr_set, &ex_set, ptv);
+
+        esp32_net_poller_lock(poller);
+        poller->waiting = 0;
+        if (num <= 0)
+        {
+            esp32_net_poller_unlock(poller);
+            return (num < 0) ? -1 : 0;
+        }
+
+        if (FD_ISSET(poller->wake_fd, &rd_set))
+        {
+            esp32_net_poller_wake_drain(poller);
+            num--;
+        }
+        if (FD_ISSET(poller->wake_fd, &ex_set))
+        {
+            num--;
+        }
+
+        // 只遍历注册表，且找齐select报告的就绪数即停止
+        start = (poller->start < poller->num) ? poller->start : 0;
+        for (i = 0; (i < poller->num) && (num > 0) && (cnt < max_events); i++)
+        {
+            esp32_net_poller_entry_t *entry = &poller->entry[(start + i) % poller->num];
+            uhos_u32                  ev    = 0;
+
+            // select返回后注册表可能已被修改，只上报仍关注的事件
+            if ((entry->events & UHOS_NET_POLL_IN) && FD_ISSET(entry->fd, &rd_set))
+            {
+                ev |= UHOS_NET_POLL_IN;
+                num--;
+            }
+            if ((entry->events & UHOS_NET_POLL_OUT) && FD_ISSET(entry->fd, &wr_set))
+            {
+                ev |= UHOS_NET_POLL_OUT;
+                num--;
+            }
+            if ((entry->events & UHOS_NET_POLL_IN) && FD_ISSET(entry->fd, &ex_set))
+            {
+                ev |= UHOS_NET_POLL_ERR;
+                num--;
+            }
+            if (0 == ev)
+            {
+                continue;
+            }
+
+            events[cnt].fd     = entry->fd;
+            events[cnt].events = ev;
+            events[cnt].data   = entry->data;
+            cnt++;
+        }
+        poller->start = (poller->num > 0) ? ((start + i) % poller->num) : 0;
+        esp32_net_poller_unlock(poller);
+
+        if (cnt > 0)
+        {
+            return cnt;
+        }
+
+        if (timeout_ms >= 0)
+        {
+            remain = (uhos_s32)(deadline - uhos_current_time_get());
+            if (remain <= 0)
+            {
+                return 0;
+            }
+        }
+    }
+}
+
+uhos_void uhos_net_poller_destroy(uhos_net_poller_t poller)
+{
+    if (UHOS_NULL == poller)
+    {
+        return;
+    }
+
+    close(poller->wake_fd);
+    uhos_mutex_delete(poller->lock);
+    uhos_libc_free(poller->entry);
+    uhos_libc_free(poller);
+}
@@ -0,0 +1,75 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_net_sendmsg.c
+ * @author agent (agent@local)
+ * @brief 聚合发送uhos_net_sendmsg/uhos_net_writev的lwIP实现
+ * @details lwIP的sendmsg对TCP按iovec逐段写入发送缓冲，UDP则组成一个报文，数据不经过中间buffer；
+ *          uhos_sockaddr与lwIP的sockaddr布局一致，直接使用。
+ *          ESP-IDF的VFS不转发writev，uhos_net_writev同样走sendmsg
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：聚合发送uhos_net_sendmsg/uhos_net_writev的lwIP实现
+ * </table>
+ */
+
+#define LOG_TAG "esp32_net"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include <errno.h>
+
+#include "lwip/sockets.h"
+
+#include "uh_types.h"
+#include "uh_al_net.h"
+#include "uh_log.h"
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_ssize_t uhos_net_sendmsg(uhos_s32 fd, const struct uhos_msghdr *message, uhos_s32 flags)
+{
+    struct iovec  iov[CONFIG_UHOS_NET_IOV_MAX];
+    struct msghdr msg = {0};
+    uhos_size_t   i   = 0;
+
+    if ((UHOS_NULL == message) || (message->msg_iovlen > CONFIG_UHOS_NET_IOV_MAX) ||
+        ((message->msg_iovlen > 0) && (UHOS_NULL == message->msg_iov)))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    for (i = 0; i < message->msg_iovlen; i++)
+    {
+        iov[i].iov_base = message->msg_iov[i].iov_base;
+        iov[i].iov_len  = message->msg_iov[i].iov_len;
+    }
+
+    msg.msg_name    = message->msg_name;
+    msg.msg_namelen = (socklen_t)message->msg_namelen;
+    msg.msg_iov     = iov;
+    msg.msg_iovlen  = (int)message->msg_iovlen;
+
+    return (uhos_ssize_t)sendmsg(fd, &msg, flags);
+}
+
+uhos_ssize_t uhos_net_writev(uhos_s32 fd, const struct uhos_iovec *iov, uhos_s32 iovcnt)
+{
+    struct uhos_msghdr msg = {0};
+
+    if (iovcnt < 0)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    msg.msg_iov    = (struct uhos_iovec *)iov;
+    msg.msg_iovlen = (uhos_size_t)iovcnt;
+
+    return uhos_net_sendmsg(fd, &msg, 0);
+}
@@ -0,0 +1,129 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_http_bench.h
+ * @author agent (agent@local)
+ * @brief HTTP连接池请求时延基准测试的接口头文件，对比每请求建连、连接复用与流水线
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：HTTP连接池请求时延基准测试的接口头文件
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>输出与计时改用uh_bench.h
+ * </table>
+ */
+
+#ifndef __UH_HTTP_BENCH_H__
+#define __UH_HTTP_BENCH_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_bench.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+// 矩阵中每个用例的请求数
+#ifndef CONFIG_UHOS_HTTP_BENCH_REQUESTS
+#define CONFIG_UHOS_HTTP_BENCH_REQUESTS     50
+#endif
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+/**
+ * @enum        请求方式
+ */
+typedef enum
+{
+    UHOS_HTTP_BENCH_NO_POOL = 0,                                //<! 连接池不缓存连接，每个请求新建连接
+    UHOS_HTTP_BENCH_POOLED,                                     //<! 逐个uhos_http_request，复用空闲连接
+    UHOS_HTTP_BENCH_BATCH,                                      //<! uhos_http_request_batch，复用连接并流水线发送
+    UHOS_HTTP_BENCH_MODE_MAX,
+} uhos_http_bench_mode_t;
+
+/**
+ * @struct      被测服务器
+ */
+typedef struct uhos_http_bench_target
+{
+    const uhos_char *host;                                      //<! 服务器域名或点分十进制IP地址
+    uhos_u16         port;                                      //<! 服务器端口
+    uhos_u8          https;                                     //<! 1-HTTPS，0-HTTP
+    const uhos_char *path;                                      //<! 请求路径，服务器须以Content-Length或chunked响应
+    const uhos_u8   *ca_cert;                                   //<! HTTPS使用的CA证书，可为NULL
+    uhos_size_t      ca_cert_len;
+} uhos_http_bench_target_t;
+
+/**
+ * @struct      基准测试用例
+ */
+typedef struct uhos_http_bench_case
+{
+    uhos_http_bench_mode_t mode;                                //<! 请求方式
+    uhos_u32               requests;                            //<! GET请求数
+} uhos_http_bench_case_t;
+
+/**
+ * @struct      基准测试结果
+ */
+typedef struct uhos_http_bench_result
+{
+    uhos_s32 status;                                            //<! 0-成功，-1-失败
+    uhos_u32 requests;                                          //<! 成功的请求数
+    uhos_u32 elapsed_us;                                        //<! 总耗时
+    uhos_u32 avg_us;                                            //<! 平均每个请求的耗时
+    uhos_u32 max_us;                                            //<! 单次调用的最大耗时，批量方式为一批的耗时
+    uhos_u32 connects;                                          //<! 新建的TCP连接数
+    uhos_u32 handshakes;                                        //<! TLS握手数
+    uhos_u32 reused;                                            //<! 复用空闲连接的请求数
+    uhos_u32 pipelined;                                         //<! 流水线发出的请求数
+} uhos_http_bench_result_t;
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       对服务器执行一个用例
+ * @note        连接池由用例初始化与反初始化，调用前不能已初始化
+ * @param[in]   target  被测服务器
+ * @param[in]   bcase   用例
+ * @param[out]  result  结果
+ * @return      0-成功，-1-失败
+ */
+uhos_s32 uhos_http_bench_run(const uhos_http_bench_target_t *target, const uhos_http_bench_case_t *bcase,
+                             uhos_http_bench_result_t *result);
+
+/**
+ * @brief       将用例与结果格式化为一行JSON
+ * @return      写入的字符数
+ */
+uhos_s32 uhos_http_bench_result_json(const uhos_http_bench_target_t *target, const uhos_http_bench_case_t *bcase,
+                                     const uhos_http_bench_result_t *result, uhos_char *buf, uhos_u32 size);
+
+/**
+ * @brief       依次执行三种请求方式的用例，每个用例输出一行JSON
+ * @param[in]   target  被测服务器
+ * @param[in]   print   输出回调
+ * @return      0-全部成功，-1-有用例失败
+ */
+uhos_s32 uhos_http_bench_matrix_run(const uhos_http_bench_target_t *target, uhos_bench_print_t print);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_HTTP_BENCH_H__
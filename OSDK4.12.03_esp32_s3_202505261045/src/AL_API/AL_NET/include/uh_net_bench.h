@@ -0,0 +1,115 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_net_bench.h
+ * @author agent (agent@local)
+ * @brief 协议帧发送吞吐基准测试的接口头文件，对比拷贝拼帧与聚合发送
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：协议帧发送吞吐基准测试的接口头文件，对比拷贝拼帧与聚合发送
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>输出与计时改用uh_bench.h
+ * </table>
+ */
+
+#ifndef __UH_NET_BENCH_H__
+#define __UH_NET_BENCH_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_bench.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+// 矩阵中每个用例发送的帧数
+#ifndef CONFIG_UHOS_NET_BENCH_FRAMES
+#define CONFIG_UHOS_NET_BENCH_FRAMES        20000
+#endif
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+/**
+ * @enum        拼帧方式
+ */
+typedef enum
+{
+    UHOS_NET_BENCH_COPY = 0,                                    //<! 申请连续buffer，拷贝协议头与负载后发送
+    UHOS_NET_BENCH_IOV,                                         //<! 协议头与负载作为两个iovec聚合发送
+    UHOS_NET_BENCH_MODE_MAX,
+} uhos_net_bench_mode_t;
+
+/**
+ * @struct      基准测试用例
+ */
+typedef struct uhos_net_bench_case
+{
+    uhos_net_bench_mode_t mode;                                 //<! 拼帧方式
+    uhos_u16              hdr_len;                              //<! 协议头长度
+    uhos_u32              payload_len;                          //<! 负载长度
+    uhos_u32              frames;                               //<! 发送帧数
+} uhos_net_bench_case_t;
+
+/**
+ * @struct      基准测试结果
+ */
+typedef struct uhos_net_bench_result
+{
+    uhos_s32 status;                                            //<! 0-成功，-1-发送失败
+    uhos_u32 frames;                                            //<! 完整发出的帧数
+    uhos_u32 bytes;                                             //<! 发出的字节数
+    uhos_u32 elapsed_us;                                        //<! 耗时
+    uhos_u32 frames_per_sec;                                    //<! 帧速率
+    uhos_u32 goodput_kbps;                                      //<! 吞吐（kbit/s）
+    uhos_u32 calls;                                             //<! 发送接口调用次数（含部分发送后的续发）
+    uhos_u32 allocs;                                            //<! 拼帧申请内存的次数
+} uhos_net_bench_result_t;
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       在已连接的流式套接字上执行一个用例
+ * @note        接收端由调用者排空，否则发送会阻塞在发送缓冲满
+ * @param[in]   fd      已连接的阻塞套接字
+ * @param[in]   bcase   用例
+ * @param[out]  result  结果
+ * @return      0-成功，-1-失败
+ */
+uhos_s32 uhos_net_bench_run(uhos_s32 fd, const uhos_net_bench_case_t *bcase, uhos_net_bench_result_t *result);
+
+/**
+ * @brief       将用例与结果格式化为一行JSON
+ * @return      写入的字符数
+ */
+uhos_s32 uhos_net_bench_result_json(const uhos_net_bench_case_t *bcase, const uhos_net_bench_result_t *result,
+                                    uhos_char *buf, uhos_u32 size);
+
+/**
+ * @brief       依次执行两种拼帧方式在不同负载长度下的用例，每个用例输出一行JSON
+ * @param[in]   fd      已连接的阻塞套接字
+ * @param[in]   print   输出回调
+ * @return      0-全部成功，-1-有用例失败
+ */
+uhos_s32 uhos_net_bench_matrix_run(uhos_s32 fd, uhos_bench_print_t print);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_NET_BENCH_H__
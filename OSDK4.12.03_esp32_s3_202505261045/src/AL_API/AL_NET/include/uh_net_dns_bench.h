@@ -0,0 +1,100 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_net_dns_bench.h
+ * @author agent (agent@local)
+ * @brief 域名解析缓存对重连耗时影响的基准测试接口头文件
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：域名解析缓存对重连耗时影响的基准测试接口头文件
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>输出与计时改用uh_bench.h
+ * </table>
+ */
+
+#ifndef __UH_NET_DNS_BENCH_H__
+#define __UH_NET_DNS_BENCH_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_bench.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+// 矩阵中每个用例的重连次数
+#ifndef CONFIG_UHOS_NET_DNS_BENCH_RUNS
+#define CONFIG_UHOS_NET_DNS_BENCH_RUNS      50
+#endif
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+/**
+ * @struct      基准测试用例
+ */
+typedef struct uhos_net_dns_bench_case
+{
+    uhos_u8  cached;                                            //<! 0-每次重连前清除缓存，1-缓存命中
+    uhos_u32 delay_ms;                                          //<! 桩DNS服务器的应答延时，模拟上游时延
+    uhos_u32 runs;                                              //<! 重连次数
+} uhos_net_dns_bench_case_t;
+
+/**
+ * @struct      基准测试结果
+ */
+typedef struct uhos_net_dns_bench_result
+{
+    uhos_s32 status;                                            //<! 0-成功，-1-失败
+    uhos_u32 runs;                                              //<! 完成的重连次数
+    uhos_u32 avg_us;                                            //<! 解析加TCP建连的平均耗时
+    uhos_u32 max_us;                                            //<! 解析加TCP建连的最大耗时
+    uhos_u32 queries;                                           //<! 桩DNS服务器收到的查询数
+} uhos_net_dns_bench_result_t;
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       执行一个用例：在回环地址上启动桩DNS服务器与TCP监听，以桩服务器初始化解析器，
+ *              每次重连先uhos_net_resolve再建立TCP连接
+ * @note        解析器由用例初始化与反初始化，调用前不能已初始化
+ * @param[in]   bcase   用例
+ * @param[out]  result  结果
+ * @return      0-成功，-1-失败
+ */
+uhos_s32 uhos_net_dns_bench_run(const uhos_net_dns_bench_case_t *bcase, uhos_net_dns_bench_result_t *result);
+
+/**
+ * @brief       将用例与结果格式化为一行JSON
+ * @return      写入的字符数
+ */
+uhos_s32 uhos_net_dns_bench_result_json(const uhos_net_dns_bench_case_t *bcase, const uhos_net_dns_bench_result_t *result,
+                                        uhos_char *buf, uhos_u32 size);
+
+/**
+ * @brief       依次执行不同上游时延下缓存未命中与命中的用例，每个用例输出一行JSON
+ * @param[in]   print   输出回调
+ * @return      0-全部成功，-1-有用例失败
+ */
+uhos_s32 uhos_net_dns_bench_matrix_run(uhos_bench_print_t print);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_NET_DNS_BENCH_H__
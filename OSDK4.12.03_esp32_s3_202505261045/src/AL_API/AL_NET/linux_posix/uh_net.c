@@ -0,0 +1,583 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_net.c
+ * @author agent (agent@local)
+ * @brief 基于BSD socket的网络适配层实现，用于在Linux主机上运行与测试SDK
+ * @details 覆盖SDK开源部分用到的socket、地址转换、字节序与select接口；
+ *          uhos_sockaddr沿用lwIP的{len, family}布局，进出内核时转换；
+ *          socket选项的level与名字为SDK自定义取值，逐个映射到Linux的取值，
+ *          SO_OPT_NONBLOCK对应fcntl的O_NONBLOCK；
+ *          发送统一带MSG_NOSIGNAL，对端关闭时返回错误而不是触发SIGPIPE，与lwIP行为一致
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：基于BSD socket的网络适配层实现，用于在Linux主机上运行与测试SDK
+ * </table>
+ */
+
+#define LOG_TAG "linux_net"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <string.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "uh_types.h"
+#include "uh_al_net.h"
+#include "uh_log.h"
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       SDK地址转换为内核布局
+ * @note        uhos_sockaddr/uhos_sockaddr_in首字节为长度、次字节为协议族；
+ *              uhos_sockaddr_in6首部为16位协议族，次字节为0，原样使用
+ * @return      内核地址长度，0表示地址无效
+ */
+static socklen_t linux_net_addr_to_host(struct sockaddr_storage *dst, const struct uhos_sockaddr *src, uhos_socklen_t len)
+{
+    const uhos_u8 *addr = (const uhos_u8 *)src;
+
+    if ((UHOS_NULL == src) || (len < 2) || ((uhos_size_t)len > sizeof(struct sockaddr_storage)))
+    {
+        return 0;
+    }
+
+    memset(dst, 0, sizeof(struct sockaddr_storage));
+    memcpy(dst, src, len);
+    if (0 != addr[1])
+    {
+        dst->ss_family = addr[1];
+    }
+
+    return (socklen_t)len;
+}
+
+/**
+ * @brief       内核地址转换为SDK布局，按调用者缓冲区长度截断
+ */
+static uhos_void linux_net_addr_from_host(struct uhos_sockaddr *dst, uhos_socklen_t *len, const struct sockaddr_storage *src,
+                                          socklen_t src_len)
+{
+    uhos_u8 *addr = (uhos_u8 *)dst;
+
+    if ((UHOS_NULL == dst) || (UHOS_NULL == len))
+    {
+        return;
+    }
+
+    if (*len <= 0)
+    {
+        src_len = 0;
+    }
+    else if (src_len > (socklen_t)*len)
+    {
+        src_len = (socklen_t)*len;
+    }
+    memcpy(dst, src, src_len);
+    if ((AF_INET == src->ss_family) && (src_len >= 2))
+    {
+        addr[0] = (uhos_u8)sizeof(struct uhos_sockaddr_in);
+        addr[1] = AF_INET;
+    }
+    *len = (uhos_socklen_t)src_len;
+}
+
+/**
+ * @brief       SDK的socket选项映射为Linux的level与名字
+ * @return      0-已映射，-1-不支持
+ */
+static uhos_s32 linux_net_opt_map(uhos_s32 level, uhos_s32 optname, int *host_level, int *host_name)
+{
+    static const int sol_socket[] = {
+        [SO_OPT_KEEPALIVE] = SO_KEEPALIVE, [SO_OPT_BROADCAST] = SO_BROADCAST, [SO_OPT_REUSEADDR] = SO_REUSEADDR,
+        [SO_OPT_SNDTIMEO] = SO_SNDTIMEO,   [SO_OPT_RCVTIMEO] = SO_RCVTIMEO,   [SO_OPT_ERROR] = SO_ERROR,
+        [SO_OPT_REUSEPORT] = SO_REUSEPORT,
+    };
+    static const int sol_ip[] = {
+        [SO_IP_MULTICAST_TTL] = IP_MULTICAST_TTL,   [SO_IP_MULTICAST_IF] = IP_MULTICAST_IF,
+        [SO_IP_MULTICAST_LOOP] = IP_MULTICAST_LOOP, [SO_IP_ADD_MEMBERSHIP] = IP_ADD_MEMBERSHIP,
+        [SO_IP_DROP_MEMBERSHIP] = IP_DROP_MEMBERSHIP, [UHOS_IP_TTL] = IP_TTL,
+        [UHOS_IP_PKTINFO] = IP_PKTINFO,
+    };
+    static const int sol_tcp[] = {
+        [SO_TCP_NODELAY] = TCP_NODELAY, [SO_TCP_MAXSEG] = TCP_MAXSEG,
+    };
+    const int *table = UHOS_NULL;
+    uhos_s32   num   = 0;
+
+    switch (level)
+    {
+    case UHOS_SOL_SOCKET:
+        *host_level = SOL_SOCKET;
+        table       = sol_socket;
+        num         = (uhos_s32)(sizeof(sol_socket) / sizeof(sol_socket[0]));
+        break;
+    case UHOS_SOL_IP:
+        *host_level = IPPROTO_IP;
+        table       = sol_ip;
+        num         = (uhos_s32)(sizeof(sol_ip) / sizeof(sol_ip[0]));
+        break;
+    case UHOS_SOL_TCP:
+        *host_level = IPPROTO_TCP;
+        table       = sol_tcp;
+        num         = (uhos_s32)(sizeof(sol_tcp) / sizeof(sol_tcp[0]));
+        break;
+    default:
+        return -1;
+    }
+
+    if ((optname <= 0) || (optname >= num) || (0 == table[optname]))
+    {
+        return -1;
+    }
+    *host_name = table[optname];
+
+    return 0;
+}
+
+static uhos_s32 linux_net_nonblock_set(uhos_s32 sockfd, const uhos_void *optval, uhos_s32 optlen)
+{
+    int flags = 0;
+
+    if ((UHOS_NULL == optval) || (optlen < (uhos_s32)sizeof(int)))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    flags = fcntl(sockfd, F_GETFL, 0);
+    if (flags < 0)
+    {
+        return -1;
+    }
+    flags = (0 != *(const int *)optval) ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK);
+
+    return (0 == fcntl(sockfd, F_SETFL, flags)) ? 0 : -1;
+}
+
+/**
+ * @brief       SDK的fd集合转换为内核fd_set
+ * @return      0-成功，-1-fd超出FD_SETSIZE
+ */
+static uhos_s32 linux_net_fdset_to_host(fd_set *dst, uhos_void *src, uhos_s32 nfds)
+{
+    uhos_s32 fd = 0;
+
+    FD_ZERO(dst);
+    for (fd = 0; (UHOS_NULL != src) && (fd < nfds); fd++)
+    {
+        if (uhos_net_fd_isset(fd, src))
+        {
+            if (fd >= FD_SETSIZE)
+            {
+                return -1;
+            }
+            FD_SET(fd, dst);
+        }
+    }
+
+    return 0;
+}
+
+static uhos_void linux_net_fdset_from_host(uhos_void *dst, fd_set *src, uhos_s32 nfds)
+{
+    uhos_s32 fd = 0;
+
+    if (UHOS_NULL == dst)
+    {
+        return;
+    }
+
+    uhos_net_fd_zero(dst);
+    for (fd = 0; (fd < nfds) && (fd < FD_SETSIZE); fd++)
+    {
+        if (FD_ISSET(fd, src))
+        {
+            uhos_net_fd_set(fd, dst);
+        }
+    }
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_s32 uhos_net_socket(uhos_s32 domain, uhos_s32 type, uhos_s32 protocol)
+{
+    // 协议族、类型与协议号的取值与Linux一致
+    return socket(domain, type, protocol);
+}
+
+uhos_s32 uhos_net_close(uhos_s32 sockfd)
+{
+    return close(sockfd);
+}
+
+uhos_s32 uhos_net_bind(uhos_s32 sockfd, const struct uhos_sockaddr *addr, uhos_socklen_t addrlen)
+{
+    struct sockaddr_storage host;
+    socklen_t               len = linux_net_addr_to_host(&host, addr, addrlen);
+
+    if (0 == len)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    return bind(sockfd, (struct sockaddr *)&host, len);
+}
+
+uhos_s32 uhos_net_listen(uhos_s32 sockfd, uhos_s32 backlog)
+{
+    return listen(sockfd, backlog);
+}
+
+uhos_s32 uhos_net_accept(uhos_s32 sockfd, struct uhos_sockaddr *addr, uhos_socklen_t *addrlen)
+{
+    struct sockaddr_storage host;
+    socklen_t               len = sizeof(host);
+    int                     fd  = accept(sockfd, (struct sockaddr *)&host, &len);
+
+    if (fd >= 0)
+    {
+        linux_net_addr_from_host(addr, addrlen, &host, len);
+    }
+
+    return fd;
+}
+
+uhos_s32 uhos_net_connect(uhos_s32 sockfd, const struct uhos_sockaddr *addr, uhos_socklen_t addrlen)
+{
+    struct sockaddr_storage host;
+    socklen_t               len = linux_net_addr_to_host(&host, addr, addrlen);
+
+    if (0 == len)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    return connect(sockfd, (struct sockaddr *)&host, len);
+}
+
+uhos_s32 uhos_net_send(uhos_s32 sockfd, const uhos_void *buf, uhos_size_t len, uhos_s32 flags)
+{
+    return (uhos_s32)send(sockfd, buf, len, flags | MSG_NOSIGNAL);
+}
+
+uhos_s32 uhos_net_sendto(uhos_s32 sockfd, const uhos_void *buf, uhos_size_t len, uhos_s32 flags,
+                         const struct uhos_sockaddr *addr, uhos_socklen_t addrlen)
+{
+    struct sockaddr_storage host;
+    socklen_t               host_len = 0;
+
+    if (UHOS_NULL == addr)
+    {
+        return (uhos_s32)sendto(sockfd, buf, len, flags | MSG_NOSIGNAL, UHOS_NULL, 0);
+    }
+
+    host_len = linux_net_addr_to_host(&host, addr, addrlen);
+    if (0 == host_len)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    return (uhos_s32)sendto(sockfd, buf, len, flags | MSG_NOSIGNAL, (struct sockaddr *)&host, host_len);
+}
+
+uhos_s32 uhos_net_recv(uhos_s32 sockfd, uhos_void *buf, uhos_size_t len, uhos_s32 flags)
+{
+    return (uhos_s32)recv(sockfd, buf, len, flags);
+}
+
+uhos_ssize_t uhos_net_recvfrom(uhos_s32 sockfd, uhos_void *buf, uhos_size_t len, uhos_s32 flags,
+                               struct uhos_sockaddr *src_addr, uhos_socklen_t *addrlen)
+{
+    struct sockaddr_storage host;
+    socklen_t               host_len = sizeof(host);
+    ssize_t                 ret      = recvfrom(sockfd, buf, len, flags, (struct sockaddr *)&host, &host_len);
+
+    if (ret >= 0)
+    {
+        linux_net_addr_from_host(src_addr, addrlen, &host, host_len);
+    }
+
+    return (uhos_ssize_t)ret;
+}
+
+uhos_s32 uhos_net_setsockopt(uhos_s32 sockfd, uhos_s32 level, uhos_s32 optname, const uhos_void *optval, uhos_s32 optlen)
+{
+    const struct uhos_timeval *utv        = UHOS_NULL;
+    struct timeval             tv         = {0};
+    int                        host_level = 0;
+    int                        host_name  = 0;
+
+    if ((UHOS_SOL_SOCKET == level) && (SO_OPT_NONBLOCK == optname))
+    {
+        return linux_net_nonblock_set(sockfd, optval, optlen);
+    }
+
+    if (0 != linux_net_opt_map(level, optname, &host_level, &host_name))
+    {
+        UHOS_LOGD("setsockopt level %d opt %d not supported", (int)level, (int)optname);
+        return 0;
+    }
+
+    // uhos_timeval的成员为32位，64位主机上与timeval布局不同
+    if ((SOL_SOCKET == host_level) && ((SO_SNDTIMEO == host_name) || (SO_RCVTIMEO == host_name)))
+    {
+        if ((UHOS_NULL == optval) || (optlen < (uhos_s32)sizeof(struct uhos_timeval)))
+        {
+            errno = EINVAL;
+            return -1;
+        }
+        utv        = (const struct uhos_timeval *)optval;
+        tv.tv_sec  = utv->tv_sec;
+        tv.tv_usec = utv->tv_usec;
+        return setsockopt(sockfd, host_level, host_name, &tv, sizeof(tv));
+    }
+
+    return setsockopt(sockfd, host_level, host_name, optval, (socklen_t)optlen);
+}
+
+uhos_s32 uhos_net_getsockopt(uhos_s32 sockfd, uhos_s32 level, uhos_s32 optname, const uhos_void *optval, uhos_u32 *optlen)
+{
+    struct timeval tv         = {0};
+    socklen_t      len        = 0;
+    int            host_level = 0;
+    int            host_name  = 0;
+    int            flags      = 0;
+    int            ret        = 0;
+
+    if ((UHOS_NULL == optval) || (UHOS_NULL == optlen))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    if ((UHOS_SOL_SOCKET == level) && (SO_OPT_NONBLOCK == optname))
+    {
+        flags = fcntl(sockfd, F_GETFL, 0);
+        if ((flags < 0) || (*optlen < sizeof(int)))
+        {
+            return -1;
+        }
+        *(int *)optval = (0 != (flags & O_NONBLOCK)) ? 1 : 0;
+        *optlen        = sizeof(int);
+        return 0;
+    }
+
+    if (0 != linux_net_opt_map(level, optname, &host_level, &host_name))
+    {
+        UHOS_LOGD("getsockopt level %d opt %d not supported", (int)level, (int)optname);
+        return 0;
+    }
+
+    if ((SOL_SOCKET == host_level) && ((SO_SNDTIMEO == host_name) || (SO_RCVTIMEO == host_name)))
+    {
+        if (*optlen < sizeof(struct uhos_timeval))
+        {
+            errno = EINVAL;
+            return -1;
+        }
+        len = sizeof(tv);
+        ret = getsockopt(sockfd, host_level, host_name, &tv, &len);
+        if (0 == ret)
+        {
+            ((struct uhos_timeval *)optval)->tv_sec  = (uhos_s32)tv.tv_sec;
+            ((struct uhos_timeval *)optval)->tv_usec = (uhos_s32)tv.tv_usec;
+            *optlen                                  = sizeof(struct uhos_timeval);
+        }
+        return ret;
+    }
+
+    len = (socklen_t)*optlen;
+    ret = getsockopt(sockfd, host_level, host_name, (uhos_void *)optval, &len);
+    if (0 == ret)
+    {
+        *optlen = (uhos_u32)len;
+    }
+
+    return ret;
+}
+
+uhos_u32 uhos_net_htonl(uhos_u32 hostlong)
+{
+    return htonl(hostlong);
+}
+
+uhos_u32 uhos_net_ntohl(uhos_u32 netlong)
+{
+    return ntohl(netlong);
+}
+
+uhos_u16 uhos_net_htons(uhos_u16 hostshort)
+{
+    return htons(hostshort);
+}
+
+uhos_u16 uhos_net_ntohs(uhos_u16 netshort)
+{
+    return ntohs(netshort);
+}
+
+uhos_s32 uhos_net_aton(const uhos_char *str_ip, struct uhos_in_addr *inp)
+{
+    struct in_addr addr = {0};
+
+    if ((UHOS_NULL == str_ip) || (UHOS_NULL == inp) || (0 == inet_aton(str_ip, &addr)))
+    {
+        return 0;
+    }
+    inp->s_addr = addr.s_addr;
+
+    return 1;
+}
+
+uhos_char *uhos_net_ntop(uhos_s32 af, const uhos_void *cp, uhos_char *buf, uhos_socklen_t len)
+{
+    return (uhos_char *)inet_ntop(af, cp, buf, (socklen_t)len);
+}
+
+uhos_s32 uhos_net_pton(uhos_s32 af, const uhos_char *src, uhos_void *buf)
+{
+    return inet_pton(af, src, buf);
+}
+
+uhos_char *uhos_net_inet_ntoa(struct uhos_in_addr in)
+{
+    struct in_addr addr = {0};
+
+    addr.s_addr = in.s_addr;
+
+    return inet_ntoa(addr);
+}
+
+uhos_u32 uhos_net_inet_addr(const uhos_char *cp)
+{
+    return (uhos_u32)inet_addr(cp);
+}
+
+uhos_s32 uhos_net_select(uhos_s32 nfds, uhos_void *readfds, uhos_void *writefds, uhos_void *exceptfds, struct uhos_timeval *timeout)
+{
+    fd_set         rfds;
+    fd_set         wfds;
+    fd_set         efds;
+    struct timeval tv  = {0};
+    int            ret = 0;
+
+    if ((nfds < 0) || (nfds > CONFIG_UHOS_FD_SETSIZE) || (0 != linux_net_fdset_to_host(&rfds, readfds, nfds)) ||
+        (0 != linux_net_fdset_to_host(&wfds, writefds, nfds)) || (0 != linux_net_fdset_to_host(&efds, exceptfds, nfds)))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    if (UHOS_NULL != timeout)
+    {
+        tv.tv_sec  = timeout->tv_sec;
+        tv.tv_usec = timeout->tv_usec;
+    }
+
+    ret = select(nfds, readfds ? &rfds : UHOS_NULL, writefds ? &wfds : UHOS_NULL, exceptfds ? &efds : UHOS_NULL,
+                 timeout ? &tv : UHOS_NULL);
+    if (ret >= 0)
+    {
+        linux_net_fdset_from_host(readfds, &rfds, nfds);
+        linux_net_fdset_from_host(writefds, &wfds, nfds);
+        linux_net_fdset_from_host(exceptfds, &efds, nfds);
+    }
+
+    return ret;
+}
+
+uhos_void uhos_net_fd_zero(uhos_void *set)
+{
+    memset(set, 0, sizeof(uhos_fd_set));
+}
+
+uhos_void uhos_net_fd_clr(uhos_s32 fd, uhos_void *set)
+{
+    if ((fd >= 0) && (fd < CONFIG_UHOS_FD_SETSIZE))
+    {
+        ((uhos_fd_set *)set)->fd_bits[fd / 8] &= (uhos_u8)~(1U << (fd % 8));
+    }
+}
+
+uhos_void uhos_net_fd_set(uhos_s32 fd, uhos_void *set)
+{
+    if ((fd >= 0) && (fd < CONFIG_UHOS_FD_SETSIZE))
+    {
+        ((uhos_fd_set *)set)->fd_bits[fd / 8] |= (uhos_u8)(1U << (fd % 8));
+    }
+}
+
+uhos_s32 uhos_net_fd_isset(uhos_s32 fd, uhos_void *set)
+{
+    if ((fd < 0) || (fd >= CONFIG_UHOS_FD_SETSIZE))
+    {
+        return 0;
+    }
+
+    return (0 != (((uhos_fd_set *)set)->fd_bits[fd / 8] & (1U << (fd % 8)))) ? 1 : 0;
+}
+
+uhos_u32 uhos_net_fd_size(uhos_void)
+{
+    return CONFIG_UHOS_FD_SETSIZE;
+}
+
+uhos_s32 uhos_net_getsockname(uhos_s32 fd, struct uhos_sockaddr *addr, uhos_socklen_t *len)
+{
+    struct sockaddr_storage host;
+    socklen_t               host_len = sizeof(host);
+    int                     ret      = getsockname(fd, (struct sockaddr *)&host, &host_len);
+
+    if (0 == ret)
+    {
+        linux_net_addr_from_host(addr, len, &host, host_len);
+    }
+
+    return ret;
+}
+
+uhos_s32 uhos_net_getpeername(uhos_s32 fd, struct uhos_sockaddr *addr, uhos_socklen_t *len)
+{
+    struct sockaddr_storage host;
+    socklen_t               host_len = sizeof(host);
+    int                     ret      = getpeername(fd, (struct sockaddr *)&host, &host_len);
+
+    if (0 == ret)
+    {
+        linux_net_addr_from_host(addr, len, &host, host_len);
+    }
+
+    return ret;
+}
+
+uhos_s32 uhos_net_dns_config(uhos_u8 op, uhos_char *dns_server)
+{
+    // 主机的DNS服务器由系统配置，不支持读取与设置
+    (void)op;
+    (void)dns_server;
+
+    return -1;
+}
+
+uhos_s32 uhos_net_errno_get(uhos_void)
+{
+    return errno;
+}
@@ -0,0 +1,305 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_net_poller.c
+ * @author agent (agent@local)
+ * @brief 基于epoll的poller实现，用于Linux主机
+ * @details fd注册一次后由内核维护就绪列表，每次等待的代价只与就绪fd数相关；
+ *          用户数据保存在按fd下标的槽位表中，epoll只携带fd，
+ *          避免注销后仍在返回途中的事件访问已释放的注册信息
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：基于epoll的poller实现，用于Linux主机
+ * </table>
+ */
+
+#define LOG_TAG "linux_poll"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include "uh_types.h"
+#include "uh_al_net.h"
+#include "uh_log.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define LINUX_NET_POLLER_DEF_FDS 64                             // 槽位表初始容量
+#define LINUX_NET_POLLER_BATCH   64                             // 单次epoll_wait取回的最大事件数
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      fd注册信息
+ */
+typedef struct
+{
+    uhos_u32   events;                                          //<! 关注的事件
+    uhos_void *data;                                            //<! 用户数据
+    uhos_u8    used;                                            //<! 是否已注册
+} linux_net_poller_slot_t;
+
+/**
+ * @struct      poller控制块
+ */
+struct uhos_net_poller_s
+{
+    int                      epfd;                              //<! epoll实例
+    pthread_mutex_t          lock;                              //<! 保护槽位表
+    linux_net_poller_slot_t *slots;                             //<! 按fd下标的注册信息
+    uhos_u32                 cap;                               //<! 槽位表容量
+};
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static uhos_u32 linux_net_poller_to_epoll(uhos_u32 events)
+{
+    uhos_u32 ev = 0;
+
+    if (events & UHOS_NET_POLL_IN)
+    {
+        ev |= EPOLLIN | EPOLLRDHUP;
+    }
+    if (events & UHOS_NET_POLL_OUT)
+    {
+        ev |= EPOLLOUT;
+    }
+
+    return ev;
+}
+
+static uhos_u32 linux_net_poller_from_epoll(uhos_u32 ev)
+{
+    uhos_u32 events = 0;
+
+    // 对端半关闭时read返回0，按可读上报
+    if (ev & (EPOLLIN | EPOLLRDHUP | EPOLLPRI))
+    {
+        events |= UHOS_NET_POLL_IN;
+    }
+    if (ev & EPOLLOUT)
+    {
+        events |= UHOS_NET_POLL_OUT;
+    }
+    if (ev & EPOLLERR)
+    {
+        events |= UHOS_NET_POLL_ERR;
+    }
+    if (ev & EPOLLHUP)
+    {
+        events |= UHOS_NET_POLL_HUP;
+    }
+
+    return events;
+}
+
+/**
+ * @brief       扩容槽位表使其能容纳fd，调用者持有锁
+ */
+static uhos_s32 linux_net_poller_reserve(struct uhos_net_poller_s *poller, uhos_s32 fd)
+{
+    linux_net_poller_slot_t *slots = UHOS_NULL;
+    uhos_u32                 cap   = poller->cap;
+
+    if ((uhos_u32)fd < cap)
+    {
+        return 0;
+    }
+
+    while (cap <= (uhos_u32)fd)
+    {
+        cap *= 2;
+    }
+
+    slots = realloc(poller->slots, cap * sizeof(linux_net_poller_slot_t));
+    if (UHOS_NULL == slots)
+    {
+        return -1;
+    }
+    memset(&slots[poller->cap], 0, (cap - poller->cap) * sizeof(linux_net_poller_slot_t));
+
+    poller->slots = slots;
+    poller->cap   = cap;
+
+    return 0;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_net_poller_t uhos_net_poller_create(uhos_u32 max_fds)
+{
+    struct uhos_net_poller_s *poller = UHOS_NULL;
+
+    poller = calloc(1, sizeof(struct uhos_net_poller_s));
+    if (UHOS_NULL == poller)
+    {
+        return UHOS_NULL;
+    }
+
+    poller->cap   = (max_fds > LINUX_NET_POLLER_DEF_FDS) ? max_fds : LINUX_NET_POLLER_DEF_FDS;
+    poller->slots = calloc(poller->cap, sizeof(linux_net_poller_slot_t));
+    poller->epfd  = epoll_create1(EPOLL_CLOEXEC);
+    if ((UHOS_NULL == poller->slots) || (poller->epfd < 0))
+    {
+        UHOS_LOGE("poller create failed, errno %d", errno);
+        if (poller->epfd >= 0)
+        {
+            close(poller->epfd);
+        }
+        free(poller->slots);
+        free(poller);
+        return UHOS_NULL;
+    }
+    pthread_mutex_init(&poller->lock, UHOS_NULL);
+
+    return poller;
+}
+
+uhos_s32 uhos_net_poller_ctl(uhos_net_poller_t poller, uhos_u8 op, uhos_s32 fd, uhos_u32 events, uhos_void *data)
+{
+    struct epoll_event ev  = {0};
+    uhos_s32           ret = -1;
+
+    if ((UHOS_NULL == poller) || (fd < 0))
+    {
+        return -1;
+    }
+
+    ev.events  = linux_net_poller_to_epoll(events);
+    ev.data.fd = fd;
+
+    pthread_mutex_lock(&poller->lock);
+    switch (op)
+    {
+        case UHOS_NET_POLL_CTL_ADD:
+            if ((0 != linux_net_poller_reserve(poller, fd)) || poller->slots[fd].used)
+            {
+                break;
+            }
+            if (0 != epoll_ctl(poller->epfd, EPOLL_CTL_ADD, fd, &ev))
+            {
+                break;
+            }
+            poller->slots[fd].events = events;
+            poller->slots[fd].data   = data;
+            poller->slots[fd].used   = 1;
+            ret                      = 0;
+            break;
+
+        case UHOS_NET_POLL_CTL_MOD:
+            if (((uhos_u32)fd >= poller->cap) || !poller->slots[fd].used)
+            {
+                break;
+            }
+            if (0 != epoll_ctl(poller->epfd, EPOLL_CTL_MOD, fd, &ev))
+            {
+                break;
+            }
+            poller->slots[fd].events = events;
+            poller->slots[fd].data   = data;
+            ret                      = 0;
+            break;
+
+        case UHOS_NET_POLL_CTL_DEL:
+            if (((uhos_u32)fd >= poller->cap) || !poller->slots[fd].used)
+            {
+                break;
+            }
+            // fd已被关闭时内核已自动移除，忽略EBADF/ENOENT
+            epoll_ctl(poller->epfd, EPOLL_CTL_DEL, fd, &ev);
+            memset(&poller->slots[fd], 0, sizeof(linux_net_poller_slot_t));
+            ret = 0;
+            break;
+
+        default:
+            break;
+    }
+    pthread_mutex_unlock(&poller->lock);
+
+    if (0 != ret)
+    {
+        UHOS_LOGW("poller ctl op %d fd %d failed, errno %d", op, fd, errno);
+    }
+
+    return ret;
+}
+
+uhos_s32 uhos_net_poller_wait(uhos_net_poller_t poller, uhos_net_poll_event_t *events, uhos_s32 max_events, uhos_s32 timeout_ms)
+{
+    struct epoll_event ev[LINUX_NET_POLLER_BATCH];
+    uhos_s32           num = 0;
+    uhos_s32           cnt = 0;
+    uhos_s32           i   = 0;
+
+    if ((UHOS_NULL == poller) || (UHOS_NULL == events) || (max_events <= 0))
+    {
+        return -1;
+    }
+
+    if (max_events > LINUX_NET_POLLER_BATCH)
+    {
+        max_events = LINUX_NET_POLLER_BATCH;
+    }
+
+    do
+    {
+        num = epoll_wait(poller->epfd, ev, max_events, timeout_ms);
+        if (num < 0)
+        {
+            if (EINTR == errno)
+            {
+                return 0;
+            }
+            return -1;
+        }
+
+        pthread_mutex_lock(&poller->lock);
+        for (i = 0; i < num; i++)
+        {
+            linux_net_poller_slot_t *slot = UHOS_NULL;
+            uhos_s32                 fd   = ev[i].data.fd;
+
+            // 等待返回后已被其他线程注销的fd不再上报
+            if (((uhos_u32)fd >= poller->cap) || !poller->slots[fd].used)
+            {
+                continue;
+            }
+            slot = &poller->slots[fd];
+
+            events[cnt].fd     = fd;
+            events[cnt].events = linux_net_poller_from_epoll(ev[i].events) &
+                                 (slot->events | UHOS_NET_POLL_ERR | UHOS_NET_POLL_HUP);
+            events[cnt].data   = slot->data;
+            cnt++;
+        }
+        pthread_mutex_unlock(&poller->lock);
+    } while ((0 == cnt) && (num > 0) && (timeout_ms < 0));
+
+    return cnt;
+}
+
+uhos_void uhos_net_poller_destroy(uhos_net_poller_t poller)
+{
+    if (UHOS_NULL == poller)
+    {
+        return;
+    }
+
+    close(poller->epfd);
+    pthread_mutex_destroy(&poller->lock);
+    free(poller->slots);
+    free(poller);
+}
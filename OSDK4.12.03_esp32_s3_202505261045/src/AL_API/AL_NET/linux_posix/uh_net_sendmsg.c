@@ -0,0 +1,127 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_net_sendmsg.c
+ * @author agent (agent@local)
+ * @brief 聚合发送uhos_net_sendmsg/uhos_net_writev的Linux实现
+ * @details uhos_iovec转换为栈上的iovec数组后直接交给内核sendmsg/writev，数据本身不拷贝；
+ *          uhos_sockaddr沿用lwIP的{len, family}布局，发送前转换为内核的sockaddr
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：聚合发送uhos_net_sendmsg/uhos_net_writev的Linux实现
+ * </table>
+ */
+
+#define LOG_TAG "linux_net"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include "uh_types.h"
+#include "uh_al_net.h"
+#include "uh_log.h"
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static uhos_s32 linux_net_iov_convert(struct iovec *dst, const struct uhos_iovec *src, uhos_size_t cnt)
+{
+    uhos_size_t i = 0;
+
+    if ((cnt > CONFIG_UHOS_NET_IOV_MAX) || ((cnt > 0) && (UHOS_NULL == src)))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    for (i = 0; i < cnt; i++)
+    {
+        dst[i].iov_base = src[i].iov_base;
+        dst[i].iov_len  = src[i].iov_len;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       目的地址转换为内核布局
+ * @note        uhos_sockaddr/uhos_sockaddr_in首字节为长度、次字节为协议族；
+ *              uhos_sockaddr_in6首部为16位协议族，次字节为0，原样使用
+ */
+static socklen_t linux_net_addr_convert(struct sockaddr_storage *dst, const uhos_void *src, uhos_socklen_t len)
+{
+    const uhos_u8 *addr = (const uhos_u8 *)src;
+
+    if ((len < 2) || ((uhos_size_t)len > sizeof(struct sockaddr_storage)))
+    {
+        return 0;
+    }
+
+    memcpy(dst, src, len);
+    if (0 != addr[1])
+    {
+        dst->ss_family = addr[1];
+    }
+
+    return (socklen_t)len;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_ssize_t uhos_net_sendmsg(uhos_s32 fd, const struct uhos_msghdr *message, uhos_s32 flags)
+{
+    struct iovec            iov[CONFIG_UHOS_NET_IOV_MAX];
+    struct sockaddr_storage addr;
+    struct msghdr           msg = {0};
+
+    if (UHOS_NULL == message)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    if (0 != linux_net_iov_convert(iov, message->msg_iov, message->msg_iovlen))
+    {
+        return -1;
+    }
+    msg.msg_iov    = iov;
+    msg.msg_iovlen = message->msg_iovlen;
+
+    if (UHOS_NULL != message->msg_name)
+    {
+        msg.msg_namelen = linux_net_addr_convert(&addr, message->msg_name, message->msg_namelen);
+        if (0 == msg.msg_namelen)
+        {
+            errno = EINVAL;
+            return -1;
+        }
+        msg.msg_name = &addr;
+    }
+
+    // 对端关闭时返回错误而不是触发SIGPIPE，与lwIP行为一致
+    return (uhos_ssize_t)sendmsg(fd, &msg, flags | MSG_NOSIGNAL);
+}
+
+uhos_ssize_t uhos_net_writev(uhos_s32 fd, const struct uhos_iovec *iov, uhos_s32 iovcnt)
+{
+    struct uhos_msghdr msg = {0};
+
+    if (iovcnt < 0)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    msg.msg_iov    = (struct uhos_iovec *)iov;
+    msg.msg_iovlen = (uhos_size_t)iovcnt;
+
+    return uhos_net_sendmsg(fd, &msg, 0);
+}
@@ -0,0 +1,204 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_http_bench.c
+ * @author agent (agent@local)
+ * @brief HTTP连接池请求时延基准测试的功能实现
+ * @details 每个用例以对应配置初始化连接池，向同一服务器发出GET请求，统计耗时与连接池计数的变化。
+ *          每请求建连的用例把空闲连接上限设为0，等价于不使用连接池的旧流程；
+ *          批量用例每次提交CONFIG_UHOS_HTTP_PIPELINE_DEPTH个请求
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：HTTP连接池请求时延基准测试的功能实现
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>输出与计时改用uh_bench.h
+ * </table>
+ */
+
+#define LOG_TAG "http-bench"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_http.h"
+#include "uh_bench.h"
+
+#include "uh_http_bench.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define UHOS_HTTP_BENCH_TIMEOUT_MS          5000
+
+// JSON行的最大长度
+#define UHOS_HTTP_BENCH_JSON_LEN            256
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static const uhos_char *g_uhos_http_bench_mode_name[UHOS_HTTP_BENCH_MODE_MAX] = {"no_pool", "pooled", "batch"};
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_s32 uhos_http_bench_run(const uhos_http_bench_target_t *target, const uhos_http_bench_case_t *bcase,
+                             uhos_http_bench_result_t *result)
+{
+    uhos_http_req_t        reqs[CONFIG_UHOS_HTTP_PIPELINE_DEPTH];
+    uhos_http_rsp_t        rsps[CONFIG_UHOS_HTTP_PIPELINE_DEPTH];
+    uhos_http_pool_cfg_t   cfg   = {0};
+    uhos_http_pool_stats_t stats = {0};
+    uhos_u32               start = 0;
+    uhos_u32               begin = 0;
+    uhos_u32               cost  = 0;
+    uhos_u32               num   = 0;
+    uhos_u32               i     = 0;
+
+    if ((UHOS_NULL == target) || (UHOS_NULL == bcase) || (UHOS_NULL == result) || (bcase->mode >= UHOS_HTTP_BENCH_MODE_MAX))
+    {
+        return -1;
+    }
+
+    uhos_libc_memset(result, 0, sizeof(uhos_http_bench_result_t));
+    result->status = -1;
+
+    cfg.ca_cert      = target->ca_cert;
+    cfg.ca_cert_len  = target->ca_cert_len;
+    cfg.max_conns    = (UHOS_HTTP_BENCH_NO_POOL == bcase->mode) ? 0 : CONFIG_UHOS_HTTP_POOL_MAX;
+    cfg.max_per_host = CONFIG_UHOS_HTTP_POOL_PER_HOST;
+    cfg.idle_ms      = CONFIG_UHOS_HTTP_IDLE_MS;
+    if (0 != uhos_http_pool_init(&cfg))
+    {
+        UHOS_LOGE("http pool init failed, already initialized?");
+        return -1;
+    }
+
+    // 响应体丢弃，只计时
+    uhos_libc_memset(reqs, 0, sizeof(reqs));
+    uhos_libc_memset(rsps, 0, sizeof(rsps));
+    for (i = 0; i < CONFIG_UHOS_HTTP_PIPELINE_DEPTH; i++)
+    {
+        reqs[i].method     = "GET";
+        reqs[i].host       = target->host;
+        reqs[i].port       = target->port;
+        reqs[i].https      = target->https;
+        reqs[i].path       = target->path;
+        reqs[i].timeout_ms = UHOS_HTTP_BENCH_TIMEOUT_MS;
+    }
+
+    begin = uhos_bench_now_us();
+    while (result->requests < bcase->requests)
+    {
+        num = 1;
+        if (UHOS_HTTP_BENCH_BATCH == bcase->mode)
+        {
+            num = bcase->requests - result->requests;
+            num = (num < CONFIG_UHOS_HTTP_PIPELINE_DEPTH) ? num : CONFIG_UHOS_HTTP_PIPELINE_DEPTH;
+        }
+
+        start = uhos_bench_now_us();
+        if (UHOS_HTTP_BENCH_BATCH == bcase->mode)
+        {
+            i = uhos_http_request_batch(reqs, rsps, num);
+        }
+        else
+        {
+            i = (0 == uhos_http_request(&reqs[0], &rsps[0])) ? 1 : 0;
+        }
+        cost = uhos_bench_now_us() - start;
+
+        result->requests += i;
+        if (cost > result->max_us)
+        {
+            result->max_us = cost;
+        }
+        if (i < num)
+        {
+            break;
+        }
+    }
+    result->elapsed_us = uhos_bench_now_us() - begin;
+    if (result->requests == bcase->requests)
+    {
+        result->status = 0;
+    }
+    if (result->requests > 0)
+    {
+        result->avg_us = result->elapsed_us / result->requests;
+    }
+
+    uhos_http_pool_stats_get(&stats);
+    result->connects   = stats.connects;
+    result->handshakes = stats.handshakes;
+    result->reused     = stats.reused;
+    result->pipelined  = stats.pipelined;
+    uhos_http_pool_deinit();
+
+    if (0 != result->status)
+    {
+        UHOS_LOGE("bench %s failed after %u requests", g_uhos_http_bench_mode_name[bcase->mode], (unsigned)result->requests);
+    }
+
+    return result->status;
+}
+
+uhos_s32 uhos_http_bench_result_json(const uhos_http_bench_target_t *target, const uhos_http_bench_case_t *bcase,
+                                     const uhos_http_bench_result_t *result, uhos_char *buf, uhos_u32 size)
+{
+    uhos_bench_json_t json = {0};
+
+    if ((UHOS_NULL == target) || (UHOS_NULL == bcase) || (UHOS_NULL == result) || (UHOS_NULL == buf) ||
+        (bcase->mode >= UHOS_HTTP_BENCH_MODE_MAX))
+    {
+        return 0;
+    }
+
+    uhos_bench_json_begin(&json, buf, size);
+    uhos_bench_json_str(&json, "scheme", target->https ? "https" : "http");
+    uhos_bench_json_str(&json, "mode", g_uhos_http_bench_mode_name[bcase->mode]);
+    uhos_bench_json_status(&json, result->status);
+    uhos_bench_json_u32(&json, "requests", result->requests);
+    uhos_bench_json_u32(&json, "elapsed_us", result->elapsed_us);
+    uhos_bench_json_u32(&json, "avg_us", result->avg_us);
+    uhos_bench_json_u32(&json, "max_us", result->max_us);
+    uhos_bench_json_u32(&json, "connects", result->connects);
+    uhos_bench_json_u32(&json, "handshakes", result->handshakes);
+    uhos_bench_json_u32(&json, "reused", result->reused);
+    uhos_bench_json_u32(&json, "pipelined", result->pipelined);
+
+    return uhos_bench_json_end(&json);
+}
+
+uhos_s32 uhos_http_bench_matrix_run(const uhos_http_bench_target_t *target, uhos_bench_print_t print)
+{
+    uhos_http_bench_case_t   bcase  = {0};
+    uhos_http_bench_result_t result = {0};
+    uhos_char                line[UHOS_HTTP_BENCH_JSON_LEN];
+    uhos_s32                 ret    = 0;
+    uhos_u8                  mode   = 0;
+
+    if ((UHOS_NULL == target) || (UHOS_NULL == print))
+    {
+        return -1;
+    }
+
+    bcase.requests = CONFIG_UHOS_HTTP_BENCH_REQUESTS;
+
+    for (mode = 0; mode < UHOS_HTTP_BENCH_MODE_MAX; mode++)
+    {
+        bcase.mode = (uhos_http_bench_mode_t)mode;
+
+        if (0 != uhos_http_bench_run(target, &bcase, &result))
+        {
+            ret = -1;
+        }
+        uhos_http_bench_result_json(target, &bcase, &result, line, sizeof(line));
+        print(line);
+    }
+
+    return ret;
+}
@@ -0,0 +1,1402 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_http_pool.c
+ * @author agent (agent@local)
+ * @brief HTTP/HTTPS客户端与连接池的实现
+ * @details 连接按(host, port, https)归类，请求完成且服务器允许保持连接时放回空闲链表（最近使用的在前），
+ *          超过总数或单服务器上限时关闭最久未使用的连接。
+ *          复用前用零超时的select检查连接：空闲连接上可读意味着服务器已关闭（FIN或close_notify），直接丢弃。
+ *          每个连接自带接收缓冲，响应头在缓冲内解析，流水线请求的后续响应可能已部分位于缓冲中
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：HTTP/HTTPS客户端与连接池的实现
+ * </table>
+ */
+
+#define LOG_TAG "http"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_time.h"
+#include "uh_mutex.h"
+#include "uh_log.h"
+#include "uh_al_net.h"
+#include "uh_tls.h"
+#include "uh_http.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+// 服务器域名最大长度（含结束符）
+#ifndef CONFIG_UHOS_HTTP_HOST_LEN
+#define CONFIG_UHOS_HTTP_HOST_LEN           64
+#endif
+
+// 每个连接的接收缓冲，响应头须能完整放入
+#ifndef CONFIG_UHOS_HTTP_RX_BUF
+#define CONFIG_UHOS_HTTP_RX_BUF             2048
+#endif
+
+// 请求行与固定请求头预留的长度
+#define UHOS_HTTP_HEAD_RESERVE              128
+
+// chunk长度行的最大长度
+#define UHOS_HTTP_LINE_LEN                  64
+
+// 服务器声明的Keep-Alive超时之前提前关闭的余量
+#define UHOS_HTTP_KEEPALIVE_MARGIN_MS       1000
+
+// 接收响应的结果
+#define UHOS_HTTP_RECV_OK                   0
+#define UHOS_HTTP_RECV_ERROR                (-1)
+#define UHOS_HTTP_RECV_NODATA               (-2)                // 连接在收到任何响应数据前断开
+
+/**************************************************************************************************/
+/*                                         内部类型定义                                           */
+/**************************************************************************************************/
+/**
+ * @struct      连接
+ */
+typedef struct uhos_http_conn
+{
+    struct uhos_http_conn *next;                                //<! 空闲链表
+    uhos_char              host[CONFIG_UHOS_HTTP_HOST_LEN];
+    uhos_u16               port;
+    uhos_u8                https;
+    uhos_u8                pipeline;                            //<! 服务器已以HTTP/1.1保持连接响应
+    uhos_u8                keep;                                //<! 最近一个响应后连接可继续使用
+    uhos_u8                session;                             //<! tls会话已更新到会话缓存
+    uhos_s32               fd;
+    uhos_void             *tls;
+    uhos_u32               served;                              //<! 已完成的请求数
+    uhos_u32               timeout_ms;                          //<! 当前的套接字收发超时
+    uhos_u32               idle_since;
+    uhos_u32               idle_ms;                             //<! 本连接的空闲保留时间
+    uhos_u32               rx_off;
+    uhos_u32               rx_len;
+    uhos_u8                rx[CONFIG_UHOS_HTTP_RX_BUF];
+} uhos_http_conn_t;
+
+/**
+ * @struct      响应头解析结果
+ */
+typedef struct uhos_http_head
+{
+    uhos_s32  status;
+    uhos_u8   minor;                                            //<! HTTP/1.x的x
+    uhos_u8   chunked;
+    uhos_u8   conn_close;
+    uhos_u8   conn_keep;
+    uhos_s32  content_length;                                   //<! -1表示未给出
+    uhos_u8   bad_length;                                       //<! Content-Length非法、溢出或多个值不一致
+    uhos_s32  ka_timeout;                                       //<! Keep-Alive: timeout=，-1表示未给出
+    uhos_s32  ka_max;                                           //<! Keep-Alive: max=，-1表示未给出
+} uhos_http_head_t;
+
+/**
+ * @struct      连接池
+ */
+typedef struct uhos_http_pool
+{
+    uhos_bool              inited;
+    uhos_mutex_t           mutex;                               //<! 保护idle、idle_num与stats
+    uhos_http_pool_cfg_t   cfg;
+    uhos_void             *ca_store;                            //<! cfg.ca_cert预先解析的证书库，各连接共用
+    uhos_http_conn_t      *idle;                                //<! 空闲连接，最近使用的在前
+    uhos_u8                idle_num;
+    uhos_http_pool_stats_t stats;
+} uhos_http_pool_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_http_pool_t g_uhos_http_pool;
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static uhos_void uhos_http_lock(uhos_void)
+{
+    uhos_mutex_wait(g_uhos_http_pool.mutex, UHOS_MUTEX_WAIT_FOREVER);
+}
+
+static uhos_void uhos_http_unlock(uhos_void)
+{
+    uhos_mutex_release(g_uhos_http_pool.mutex);
+}
+
+/**
+ * @brief       距截止时间的剩余毫秒数，已超时返回0
+ */
+static uhos_u32 uhos_http_remain(uhos_u32 deadline)
+{
+    uhos_s32 left = (uhos_s32)(deadline - uhos_current_time_get());
+
+    return (left > 0) ? (uhos_u32)left : 0;
+}
+
+static uhos_u16 uhos_http_port(const uhos_http_req_t *req)
+{
+    if (0 != req->port)
+    {
+        return req->port;
+    }
+
+    return req->https ? 443 : 80;
+}
+
+/**
+ * @brief       幂等方法的请求可以安全地重发与流水线发送
+ */
+static uhos_bool uhos_http_idempotent(const uhos_http_req_t *req)
+{
+    return (0 == uhos_libc_strcmp(req->method, "GET")) || (0 == uhos_libc_strcmp(req->method, "HEAD")) ||
+           (0 == uhos_libc_strcmp(req->method, "PUT")) || (0 == uhos_libc_strcmp(req->method, "DELETE")) ||
+           (0 == uhos_libc_strcmp(req->method, "OPTIONS"));
+}
+
+static uhos_bool uhos_http_conn_match(const uhos_http_conn_t *conn, const uhos_http_req_t *req)
+{
+    return (conn->port == uhos_http_port(req)) && (conn->https == req->https) &&
+           (0 == uhos_libc_strcmp(conn->host, req->host));
+}
+
+static uhos_bool uhos_http_same_server(const uhos_http_req_t *a, const uhos_http_req_t *b)
+{
+    return (uhos_http_port(a) == uhos_http_port(b)) && (a->https == b->https) &&
+           (0 == uhos_libc_strcmp(a->host, b->host));
+}
+
+static uhos_void uhos_http_conn_close(uhos_http_conn_t *conn)
+{
+    if (UHOS_NULL != conn->tls)
+    {
+        uhos_tls_uninit(conn->tls);
+    }
+    if (conn->fd >= 0)
+    {
+        uhos_net_close(conn->fd);
+    }
+    uhos_libc_free(conn);
+}
+
+static uhos_void uhos_http_conn_close_list(uhos_http_conn_t *list)
+{
+    uhos_http_conn_t *next = UHOS_NULL;
+
+    while (UHOS_NULL != list)
+    {
+        next = list->next;
+        uhos_http_conn_close(list);
+        list = next;
+    }
+}
+
+/**
+ * @brief       设置套接字收发超时，与当前值相同时不重复设置
+ */
+static uhos_void uhos_http_conn_timeout(uhos_http_conn_t *conn, uhos_u32 timeout_ms)
+{
+    struct uhos_timeval tv = {0};
+
+    // 0在套接字选项中表示永不超时
+    if (0 == timeout_ms)
+    {
+        timeout_ms = 1;
+    }
+    if (timeout_ms == conn->timeout_ms)
+    {
+        return;
+    }
+
+    tv.tv_sec  = timeout_ms / 1000;
+    tv.tv_usec = (timeout_ms % 1000) * 1000;
+    uhos_net_setsockopt(conn->fd, UHOS_SOL_SOCKET, SO_OPT_RCVTIMEO, &tv, sizeof(tv));
+    uhos_net_setsockopt(conn->fd, UHOS_SOL_SOCKET, SO_OPT_SNDTIMEO, &tv, sizeof(tv));
+    conn->timeout_ms = timeout_ms;
+}
+
+/**
+ * @brief       建立到req所指服务器的连接，HTTPS时完成TLS握手
+ */
+static uhos_http_conn_t *uhos_http_conn_open(const uhos_http_req_t *req, uhos_u32 deadline)
+{
+    uhos_http_pool_t       *pool   = &g_uhos_http_pool;
+    uhos_http_conn_t       *conn   = UHOS_NULL;
+    uhos_net_dns_result_t   res    = {0};
+    struct uhos_sockaddr_in addr   = {0};
+    uhos_s32                on     = 1;
+    uhos_s32                ret    = 0;
+    uhos_bool               resume = UHOS_FALSE;
+    uhos_u8                 i      = 0;
+
+    if (uhos_libc_strlen(req->host) >= CONFIG_UHOS_HTTP_HOST_LEN)
+    {
+        UHOS_LOGE("host too long");
+        return UHOS_NULL;
+    }
+
+    if (UHOS_NET_DNS_OK != uhos_net_resolve(req->host, &res, uhos_http_remain(deadline)))
+    {
+        UHOS_LOGW("resolve %s failed %d", req->host, (int)res.status);
+        return UHOS_NULL;
+    }
+
+    conn = uhos_libc_zalloc(sizeof(uhos_http_conn_t));
+    if (UHOS_NULL == conn)
+    {
+        UHOS_LOG_MEM_ALLOC_FAIL();
+        return UHOS_NULL;
+    }
+    uhos_libc_strncpy(conn->host, req->host, sizeof(conn->host) - 1);
+    conn->port  = uhos_http_port(req);
+    conn->https = req->https;
+    conn->fd    = -1;
+
+    addr.sin_len    = sizeof(struct uhos_sockaddr_in);
+    addr.sin_family = UHOS_AF_INET;
+    addr.sin_port   = uhos_net_htons(conn->port);
+
+    // 依次尝试解析出的各个地址
+    for (i = 0; (i < res.num) && (conn->fd < 0); i++)
+    {
+        conn->fd = uhos_net_socket(UHOS_AF_INET, UHOS_SOCK_STREAM, UHOS_IPPROTO_TCP);
+        if (conn->fd < 0)
+        {
+            break;
+        }
+        conn->timeout_ms = 0;
+        uhos_http_conn_timeout(conn, uhos_http_remain(deadline));
+
+        addr.sin_addr = res.addr[i];
+        if (0 != uhos_net_connect(conn->fd, (struct uhos_sockaddr *)&addr, sizeof(addr)))
+        {
+            uhos_net_close(conn->fd);
+            conn->fd = -1;
+        }
+    }
+    if (conn->fd < 0)
+    {
+        UHOS_LOGW("connect %s:%u failed", req->host, (unsigned)conn->port);
+        goto fail;
+    }
+    uhos_net_setsockopt(conn->fd, UHOS_SOL_TCP, SO_TCP_NODELAY, &on, sizeof(on));
+
+    uhos_http_lock();
+    pool->stats.connects++;
+    uhos_http_unlock();
+
+    if (!conn->https)
+    {
+        return conn;
+    }
+
+    conn->tls = uhos_tls_init();
+    if (UHOS_NULL == conn->tls)
+    {
+        goto fail;
+    }
+    if ((UHOS_NULL != pool->ca_store) && (0 != uhos_tls_set_ca_store(conn->tls, pool->ca_store)))
+    {
+        goto fail;
+    }
+    if ((0 != uhos_tls_set_connected_socket(conn->tls, conn->fd)) || (0 != uhos_tls_start(conn->tls)))
+    {
+        goto fail;
+    }
+    resume = (0 == uhos_tls_session_cache_resume(conn->tls, conn->host, conn->port));
+
+    do
+    {
+        ret = uhos_tls_handshake(conn->tls);
+    } while (((UHOS_TLS_RET_WANT_READ == ret) || (UHOS_TLS_RET_WANT_WRITE == ret)) && (uhos_http_remain(deadline) > 0));
+
+    if (UHOS_TLS_RET_OK != ret)
+    {
+        UHOS_LOGW("handshake %s failed %d", req->host, (int)ret);
+        if (resume)
+        {
+            uhos_tls_session_cache_remove(conn->host, conn->port);
+        }
+        goto fail;
+    }
+
+    uhos_http_lock();
+    pool->stats.handshakes++;
+    if (uhos_tls_session_reused(conn->tls))
+    {
+        pool->stats.resumed++;
+    }
+    uhos_http_unlock();
+
+    return conn;
+
+fail:
+    uhos_http_conn_close(conn);
+    return UHOS_NULL;
+}
+
+/**
+ * @brief       检查空闲连接是否仍可用：可读说明服务器已关闭或发来了非预期的数据
+ */
+static uhos_bool uhos_http_conn_alive(uhos_http_conn_t *conn)
+{
+    uhos_fd_set         rfds;
+    struct uhos_timeval tv = {0};
+
+    if ((UHOS_NULL != conn->tls) && (uhos_tls_get_avail_bytes(conn->tls) > 0))
+    {
+        return UHOS_FALSE;
+    }
+
+    uhos_net_fd_zero(&rfds);
+    uhos_net_fd_set(conn->fd, &rfds);
+
+    return 0 == uhos_net_select(conn->fd + 1, &rfds, UHOS_NULL, UHOS_NULL, &tv);
+}
+
+/**
+ * @brief       从空闲链表摘下所有超时的连接，调用者持锁
+ * @return      摘下的连接链表，由调用者在锁外关闭
+ */
+static uhos_http_conn_t *uhos_http_pool_expire(uhos_u32 now)
+{
+    uhos_http_pool_t  *pool    = &g_uhos_http_pool;
+    uhos_http_conn_t **pp      = &pool->idle;
+    uhos_http_conn_t  *expired = UHOS_NULL;
+    uhos_http_conn_t  *conn    = UHOS_NULL;
+
+    while (UHOS_NULL != *pp)
+    {
+        conn = *pp;
+        if ((uhos_u32)(now - conn->idle_since) >= conn->idle_ms)
+        {
+            *pp        = conn->next;
+            conn->next = expired;
+            expired    = conn;
+            pool->idle_num--;
+            pool->stats.evicted++;
+        }
+        else
+        {
+            pp = &conn->next;
+        }
+    }
+
+    return expired;
+}
+
+/**
+ * @brief       取出一个可复用的空闲连接
+ */
+static uhos_http_conn_t *uhos_http_pool_take(const uhos_http_req_t *req)
+{
+    uhos_http_pool_t  *pool    = &g_uhos_http_pool;
+    uhos_http_conn_t **pp      = UHOS_NULL;
+    uhos_http_conn_t  *conn    = UHOS_NULL;
+    uhos_http_conn_t  *expired = UHOS_NULL;
+
+    if (!pool->inited)
+    {
+        return UHOS_NULL;
+    }
+
+    for (;;)
+    {
+        uhos_http_lock();
+        expired = uhos_http_pool_expire(uhos_current_time_get());
+        for (pp = &pool->idle; UHOS_NULL != *pp; pp = &(*pp)->next)
+        {
+            if (uhos_http_conn_match(*pp, req))
+            {
+                conn       = *pp;
+                *pp        = conn->next;
+                conn->next = UHOS_NULL;
+                pool->idle_num--;
+                break;
+            }
+        }
+        uhos_http_unlock();
+        uhos_http_conn_close_list(expired);
+
+        if ((UHOS_NULL == conn) || uhos_http_conn_alive(conn))
+        {
+            return conn;
+        }
+
+        UHOS_LOGD("idle conn to %s closed by peer", conn->host);
+        uhos_http_conn_close(conn);
+        conn = UHOS_NULL;
+        uhos_http_lock();
+        pool->stats.evicted++;
+        uhos_http_unlock();
+    }
+}
+
+/**
+ * @brief       请求完成后归还连接，不能复用或池已满时关闭
+ */
+static uhos_void uhos_http_pool_put(uhos_http_conn_t *conn)
+{
+    uhos_http_pool_t  *pool    = &g_uhos_http_pool;
+    uhos_http_conn_t **pp      = UHOS_NULL;
+    uhos_http_conn_t **oldest  = UHOS_NULL;
+    uhos_http_conn_t **host    = UHOS_NULL;                     // 同一服务器最久未使用的连接
+    uhos_http_conn_t  *victim  = UHOS_NULL;
+    uhos_http_conn_t  *expired = UHOS_NULL;
+    uhos_u8            same    = 0;
+
+    // 响应之后还有未读的数据说明与服务器的交互已错位
+    if (!pool->inited || (0 == pool->cfg.max_conns) || !conn->keep || (conn->rx_off != conn->rx_len))
+    {
+        uhos_http_conn_close(conn);
+        return;
+    }
+    conn->rx_off     = 0;
+    conn->rx_len     = 0;
+    conn->idle_since = uhos_current_time_get();
+
+    uhos_http_lock();
+    expired = uhos_http_pool_expire(conn->idle_since);
+    for (pp = &pool->idle; UHOS_NULL != *pp; pp = &(*pp)->next)
+    {
+        oldest = pp;
+        if ((conn->port == (*pp)->port) && (conn->https == (*pp)->https) && (0 == uhos_libc_strcmp(conn->host, (*pp)->host)))
+        {
+            host = pp;
+            same++;
+        }
+    }
+
+    if (same >= pool->cfg.max_per_host)
+    {
+        pp = host;
+    }
+    else if (pool->idle_num >= pool->cfg.max_conns)
+    {
+        pp = oldest;
+    }
+    else
+    {
+        pp = UHOS_NULL;
+    }
+    if (UHOS_NULL != pp)
+    {
+        victim = *pp;
+        *pp    = victim->next;
+        pool->idle_num--;
+        pool->stats.evicted++;
+    }
+
+    conn->next = pool->idle;
+    pool->idle = conn;
+    pool->idle_num++;
+    uhos_http_unlock();
+
+    if (UHOS_NULL != victim)
+    {
+        uhos_http_conn_close(victim);
+    }
+    uhos_http_conn_close_list(expired);
+}
+
+/**
+ * @brief       发送iovec数组中的全部数据
+ * @return      0-成功，-1-失败
+ */
+static uhos_s32 uhos_http_conn_send(uhos_http_conn_t *conn, struct uhos_iovec *iov, uhos_s32 iovcnt, uhos_u32 deadline)
+{
+    uhos_s32 sent = 0;
+
+    while (iovcnt > 0)
+    {
+        if (UHOS_NULL != conn->tls)
+        {
+            sent = uhos_tls_sendv(conn->tls, iov, iovcnt);
+            if ((UHOS_TLS_RET_WANT_READ == sent) || (UHOS_TLS_RET_WANT_WRITE == sent))
+            {
+                if (0 == uhos_http_remain(deadline))
+                {
+                    return -1;
+                }
+                continue;
+            }
+        }
+        else
+        {
+            sent = (uhos_s32)uhos_net_writev(conn->fd, iov, iovcnt);
+        }
+        if (sent <= 0)
+        {
+            return -1;
+        }
+
+        while ((iovcnt > 0) && ((uhos_size_t)sent >= iov->iov_len))
+        {
+            sent -= (uhos_s32)iov->iov_len;
+            iov++;
+            iovcnt--;
+        }
+        if (iovcnt > 0)
+        {
+            iov->iov_base = (uhos_u8 *)iov->iov_base + sent;
+            iov->iov_len -= (uhos_size_t)sent;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       接收数据
+ * @return      >0-接收的字节数，0-连接已关闭，-1-失败或超时
+ */
+static uhos_s32 uhos_http_conn_recv(uhos_http_conn_t *conn, uhos_u8 *buf, uhos_size_t len, uhos_u32 deadline)
+{
+    uhos_u32 remain = 0;
+    uhos_s32 ret    = 0;
+
+    for (;;)
+    {
+        remain = uhos_http_remain(deadline);
+        if (0 == remain)
+        {
+            return -1;
+        }
+        if (remain < conn->timeout_ms)
+        {
+            uhos_http_conn_timeout(conn, remain);
+        }
+
+        if (UHOS_NULL == conn->tls)
+        {
+            ret = uhos_net_recv(conn->fd, buf, len, 0);
+            return (ret >= 0) ? ret : -1;
+        }
+
+        ret = uhos_tls_recv(conn->tls, buf, len);
+        if ((UHOS_TLS_RET_WANT_READ != ret) && (UHOS_TLS_RET_WANT_WRITE != ret))
+        {
+            return (ret >= 0) ? ret : -1;
+        }
+    }
+}
+
+/**
+ * @brief       向接收缓冲追加数据，缓冲已满时返回-1
+ * @return      同uhos_http_conn_recv
+ */
+static uhos_s32 uhos_http_conn_fill(uhos_http_conn_t *conn, uhos_u32 deadline)
+{
+    uhos_s32 ret = 0;
+
+    if (conn->rx_off > 0)
+    {
+        uhos_libc_memmove(conn->rx, &conn->rx[conn->rx_off], conn->rx_len - conn->rx_off);
+        conn->rx_len -= conn->rx_off;
+        conn->rx_off  = 0;
+    }
+    if (conn->rx_len == sizeof(conn->rx))
+    {
+        return -1;
+    }
+
+    ret = uhos_http_conn_recv(conn, &conn->rx[conn->rx_len], sizeof(conn->rx) - conn->rx_len, deadline);
+    if (ret > 0)
+    {
+        conn->rx_len += (uhos_u32)ret;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief       在接收缓冲中查找"\r\n"
+ * @return      相对rx_off的位置，未找到返回-1
+ */
+static uhos_s32 uhos_http_find_crlf(const uhos_http_conn_t *conn, uhos_u32 from)
+{
+    uhos_u32 i = 0;
+
+    for (i = conn->rx_off + from; i + 1 < conn->rx_len; i++)
+    {
+        if (('\r' == conn->rx[i]) && ('\n' == conn->rx[i + 1]))
+        {
+            return (uhos_s32)(i - conn->rx_off);
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief       读取一行（不含"\r\n"），超长部分截断
+ * @return      0-成功，-1-失败
+ */
+static uhos_s32 uhos_http_read_line(uhos_http_conn_t *conn, uhos_char *line, uhos_u32 size, uhos_u32 deadline)
+{
+    uhos_s32 pos = 0;
+    uhos_u32 len = 0;
+
+    while ((pos = uhos_http_find_crlf(conn, 0)) < 0)
+    {
+        if (uhos_http_conn_fill(conn, deadline) <= 0)
+        {
+            return -1;
+        }
+    }
+
+    len = ((uhos_u32)pos < size - 1) ? (uhos_u32)pos : size - 1;
+    uhos_libc_memcpy(line, &conn->rx[conn->rx_off], len);
+    line[len]     = '\0';
+    conn->rx_off += (uhos_u32)pos + 2;
+
+    return 0;
+}
+
+/**
+ * @brief       value中是否包含token（逗号分隔，不区分大小写）
+ */
+static uhos_bool uhos_http_has_token(const uhos_char *value, const uhos_char *token)
+{
+    uhos_size_t len = uhos_libc_strlen(token);
+
+    while ('\0' != *value)
+    {
+        while ((' ' == *value) || (',' == *value))
+        {
+            value++;
+        }
+        if ((0 == uhos_libc_strncasecmp(value, token, len)) &&
+            (('\0' == value[len]) || (',' == value[len]) || (' ' == value[len]) || (';' == value[len])))
+        {
+            return UHOS_TRUE;
+        }
+        while (('\0' != *value) && (',' != *value))
+        {
+            value++;
+        }
+    }
+
+    return UHOS_FALSE;
+}
+
+/**
+ * @brief       解析"timeout=5, max=100"中指定参数的值
+ * @return      参数值，未给出返回-1
+ */
+static uhos_s32 uhos_http_param(const uhos_char *value, const uhos_char *name)
+{
+    uhos_size_t len = uhos_libc_strlen(name);
+
+    while ('\0' != *value)
+    {
+        while ((' ' == *value) || (',' == *value))
+        {
+            value++;
+        }
+        if ((0 == uhos_libc_strncasecmp(value, name, len)) && ('=' == value[len]))
+        {
+            return uhos_libc_atoi(&value[len + 1]);
+        }
+        while (('\0' != *value) && (',' != *value))
+        {
+            value++;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief       解析Content-Length，只接受十进制数字且不超过uhos_s32，重复给出时须相同
+ */
+static uhos_void uhos_http_parse_length(uhos_http_head_t *head, const uhos_char *value)
+{
+    uhos_char    *end = UHOS_NULL;
+    unsigned long len = 0;
+
+    // strtoul会跳过空白并接受正负号，这里要求以数字开头
+    if ((*value >= '0') && (*value <= '9'))
+    {
+        len = uhos_libc_strtoul(value, &end, 10);
+        while ((' ' == *end) || ('\t' == *end))
+        {
+            end++;
+        }
+    }
+    if ((UHOS_NULL == end) || ('\0' != *end) || (len > INT32_MAX) ||
+        ((head->content_length >= 0) && ((unsigned long)head->content_length != len)))
+    {
+        UHOS_LOGE("bad content-length \"%s\"", value);
+        head->bad_length = UHOS_TRUE;
+        return;
+    }
+
+    head->content_length = (uhos_s32)len;
+}
+
+/**
+ * @brief       解析一行响应头
+ */
+static uhos_void uhos_http_parse_field(uhos_http_head_t *head, uhos_char *line)
+{
+    uhos_char *value = uhos_libc_strchr(line, ':');
+
+    if (UHOS_NULL == value)
+    {
+        return;
+    }
+    *value++ = '\0';
+    while ((' ' == *value) || ('\t' == *value))
+    {
+        value++;
+    }
+
+    if (0 == uhos_libc_strcasecmp(line, "Content-Length"))
+    {
+        uhos_http_parse_length(head, value);
+    }
+    else if (0 == uhos_libc_strcasecmp(line, "Transfer-Encoding"))
+    {
+        head->chunked = uhos_http_has_token(value, "chunked");
+    }
+    else if (0 == uhos_libc_strcasecmp(line, "Connection"))
+    {
+        head->conn_close = uhos_http_has_token(value, "close");
+        head->conn_keep  = uhos_http_has_token(value, "keep-alive");
+    }
+    else if (0 == uhos_libc_strcasecmp(line, "Keep-Alive"))
+    {
+        head->ka_timeout = uhos_http_param(value, "timeout");
+        head->ka_max     = uhos_http_param(value, "max");
+    }
+}
+
+/**
+ * @brief       读取并解析响应头，跳过1xx响应
+ * @return      UHOS_HTTP_RECV_XXX
+ */
+static uhos_s32 uhos_http_read_head(uhos_http_conn_t *conn, uhos_http_head_t *head, uhos_u32 deadline)
+{
+    uhos_bool  got  = (conn->rx_off != conn->rx_len);
+    uhos_char *line = UHOS_NULL;
+    uhos_s32   pos  = 0;
+    uhos_s32   end  = 0;
+    uhos_s32   ret  = 0;
+
+    do
+    {
+        uhos_libc_memset(head, 0, sizeof(uhos_http_head_t));
+        head->content_length = -1;
+        head->ka_timeout     = -1;
+        head->ka_max         = -1;
+
+        // 响应头须完整位于接收缓冲中
+        for (;;)
+        {
+            for (end = 0; (pos = uhos_http_find_crlf(conn, (uhos_u32)end)) >= 0; end = pos + 2)
+            {
+                if (pos == end)
+                {
+                    break;
+                }
+            }
+            if ((pos >= 0) && (pos == end))
+            {
+                break;
+            }
+
+            ret = uhos_http_conn_fill(conn, deadline);
+            if (ret <= 0)
+            {
+                if (conn->rx_len == sizeof(conn->rx))
+                {
+                    UHOS_LOGE("response head exceeds %u", (unsigned)sizeof(conn->rx));
+                }
+                return got ? UHOS_HTTP_RECV_ERROR : UHOS_HTTP_RECV_NODATA;
+            }
+            got = UHOS_TRUE;
+        }
+
+        // 逐行切分，行尾"\r\n"替换为结束符
+        line = (uhos_char *)&conn->rx[conn->rx_off];
+        conn->rx_off += (uhos_u32)end + 2;
+        line[end] = '\0';
+        for (pos = 0; pos < end; pos++)
+        {
+            if ('\r' == line[pos])
+            {
+                line[pos] = '\0';
+            }
+        }
+
+        if ((0 != uhos_libc_strncmp(line, "HTTP/1.", 7)) || (' ' != line[8]))
+        {
+            UHOS_LOGE("bad status line");
+            return UHOS_HTTP_RECV_ERROR;
+        }
+        head->minor  = (uhos_u8)(line[7] - '0');
+        head->status = uhos_libc_atoi(&line[9]);
+
+        for (line += uhos_libc_strlen(line) + 2; line < (uhos_char *)&conn->rx[conn->rx_off - 2];
+             line += uhos_libc_strlen(line) + 2)
+        {
+            uhos_http_parse_field(head, line);
+        }
+    } while ((head->status >= 100) && (head->status < 200));
+
+    return UHOS_HTTP_RECV_OK;
+}
+
+/**
+ * @brief       保存响应体，buffer不足时丢弃超出部分
+ */
+static uhos_void uhos_http_store(uhos_http_rsp_t *rsp, const uhos_u8 *data, uhos_size_t len)
+{
+    uhos_size_t space = (UHOS_NULL != rsp->buf) ? rsp->buf_size - rsp->body_len : 0;
+    uhos_size_t copy  = (len < space) ? len : space;
+
+    if (copy > 0)
+    {
+        uhos_libc_memcpy(&rsp->buf[rsp->body_len], data, copy);
+        rsp->body_len += copy;
+    }
+    rsp->total_len += len;
+}
+
+/**
+ * @brief       读取len字节的响应体，接收缓冲已空且用户buffer放得下时直接接收到用户buffer
+ * @return      0-成功，-1-失败
+ */
+static uhos_s32 uhos_http_read_body(uhos_http_conn_t *conn, uhos_http_rsp_t *rsp, uhos_size_t len, uhos_u32 deadline)
+{
+    uhos_size_t n   = 0;
+    uhos_s32    ret = 0;
+
+    while (len > 0)
+    {
+        if (conn->rx_off == conn->rx_len)
+        {
+            conn->rx_off = 0;
+            conn->rx_len = 0;
+            if ((UHOS_NULL != rsp->buf) && (rsp->buf_size - rsp->body_len >= len))
+            {
+                ret = uhos_http_conn_recv(conn, &rsp->buf[rsp->body_len], len, deadline);
+                if (ret <= 0)
+                {
+                    return -1;
+                }
+                rsp->body_len  += (uhos_size_t)ret;
+                rsp->total_len += (uhos_size_t)ret;
+                len            -= (uhos_size_t)ret;
+                continue;
+            }
+            if (uhos_http_conn_fill(conn, deadline) <= 0)
+            {
+                return -1;
+            }
+        }
+
+        n = conn->rx_len - conn->rx_off;
+        if (n > len)
+        {
+            n = len;
+        }
+        uhos_http_store(rsp, &conn->rx[conn->rx_off], n);
+        conn->rx_off += (uhos_u32)n;
+        len          -= n;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       读取chunked编码的响应体
+ * @return      0-成功，-1-失败
+ */
+static uhos_s32 uhos_http_read_chunked(uhos_http_conn_t *conn, uhos_http_rsp_t *rsp, uhos_u32 deadline)
+{
+    uhos_char   line[UHOS_HTTP_LINE_LEN];
+    uhos_size_t size = 0;
+    uhos_char  *p    = UHOS_NULL;
+    uhos_u8     digit = 0;
+
+    for (;;)
+    {
+        if (0 != uhos_http_read_line(conn, line, sizeof(line), deadline))
+        {
+            return -1;
+        }
+
+        size = 0;
+        for (p = line; '\0' != *p; p++)
+        {
+            if ((*p >= '0') && (*p <= '9'))
+            {
+                digit = (uhos_u8)(*p - '0');
+            }
+            else if ((*p >= 'a') && (*p <= 'f'))
+            {
+                digit = (uhos_u8)(*p - 'a' + 10);
+            }
+            else if ((*p >= 'A') && (*p <= 'F'))
+            {
+                digit = (uhos_u8)(*p - 'A' + 10);
+            }
+            else
+            {
+                break;
+            }
+            if (size > 0x7FFFFFF)
+            {
+                return -1;
+            }
+            size = (size << 4) | digit;
+        }
+        if (p == line)
+        {
+            UHOS_LOGE("bad chunk size");
+            return -1;
+        }
+
+        if (0 == size)
+        {
+            break;
+        }
+        if ((0 != uhos_http_read_body(conn, rsp, size, deadline)) ||
+            (0 != uhos_http_read_line(conn, line, sizeof(line), deadline)))
+        {
+            return -1;
+        }
+    }
+
+    // 跳过trailer直到空行
+    do
+    {
+        if (0 != uhos_http_read_line(conn, line, sizeof(line), deadline))
+        {
+            return -1;
+        }
+    } while ('\0' != line[0]);
+
+    return 0;
+}
+
+/**
+ * @brief       读取直到服务器关闭连接的响应体
+ * @return      0-成功，-1-失败
+ */
+static uhos_s32 uhos_http_read_until_close(uhos_http_conn_t *conn, uhos_http_rsp_t *rsp, uhos_u32 deadline)
+{
+    uhos_s32 ret = 0;
+
+    for (;;)
+    {
+        uhos_http_store(rsp, &conn->rx[conn->rx_off], conn->rx_len - conn->rx_off);
+        conn->rx_off = 0;
+        conn->rx_len = 0;
+
+        ret = uhos_http_conn_fill(conn, deadline);
+        if (0 == ret)
+        {
+            return 0;
+        }
+        if (ret < 0)
+        {
+            return -1;
+        }
+    }
+}
+
+/**
+ * @brief       接收一个完整的响应，并确定连接能否继续使用
+ * @return      UHOS_HTTP_RECV_XXX
+ */
+static uhos_s32 uhos_http_read_rsp(uhos_http_conn_t *conn, const uhos_http_req_t *req, uhos_http_rsp_t *rsp, uhos_u32 deadline)
+{
+    uhos_http_pool_t *pool = &g_uhos_http_pool;
+    uhos_http_head_t  head = {0};
+    uhos_u32          idle = 0;
+    uhos_s32          ret  = 0;
+
+    conn->keep = UHOS_FALSE;
+
+    ret = uhos_http_read_head(conn, &head, deadline);
+    if (UHOS_HTTP_RECV_OK != ret)
+    {
+        return ret;
+    }
+    rsp->status = head.status;
+
+    // 长度不可信时无法确定响应边界，按协议错误关闭连接
+    if (head.bad_length)
+    {
+        return UHOS_HTTP_RECV_ERROR;
+    }
+
+    if ((0 == uhos_libc_strcmp(req->method, "HEAD")) || (204 == head.status) || (304 == head.status))
+    {
+        ret = 0;
+    }
+    else if (head.chunked)
+    {
+        ret = uhos_http_read_chunked(conn, rsp, deadline);
+    }
+    else if (head.content_length >= 0)
+    {
+        ret = uhos_http_read_body(conn, rsp, (uhos_size_t)head.content_length, deadline);
+    }
+    else
+    {
+        // 没有长度信息的响应体以连接关闭结束
+        return (0 == uhos_http_read_until_close(conn, rsp, deadline)) ? UHOS_HTTP_RECV_OK : UHOS_HTTP_RECV_ERROR;
+    }
+    if (0 != ret)
+    {
+        return UHOS_HTTP_RECV_ERROR;
+    }
+
+    // HTTP/1.1默认保持连接，HTTP/1.0须显式声明
+    conn->keep = (head.minor >= 1) ? !head.conn_close : head.conn_keep;
+    // 同时给出chunked与Content-Length时中间设备可能按不同方式分帧，不再复用该连接
+    if ((0 == head.ka_max) || (head.chunked && (head.content_length >= 0)))
+    {
+        conn->keep = UHOS_FALSE;
+    }
+    conn->pipeline = conn->keep && (head.minor >= 1);
+
+    idle = pool->cfg.idle_ms;
+    if (head.ka_timeout > 0)
+    {
+        uhos_u32 server = (uhos_u32)head.ka_timeout * 1000;
+
+        server = (server > UHOS_HTTP_KEEPALIVE_MARGIN_MS) ? server - UHOS_HTTP_KEEPALIVE_MARGIN_MS : server / 2;
+        if (server < idle)
+        {
+            idle = server;
+        }
+    }
+    conn->idle_ms = idle;
+
+    return UHOS_HTTP_RECV_OK;
+}
+
+/**
+ * @brief       组装并发送一个请求
+ * @return      0-成功，-1-失败
+ */
+static uhos_s32 uhos_http_send_req(uhos_http_conn_t *conn, const uhos_http_req_t *req, uhos_u32 deadline)
+{
+    struct uhos_iovec iov[2];
+    uhos_char        *head = UHOS_NULL;
+    uhos_size_t       size = 0;
+    uhos_s32          len  = 0;
+    uhos_s32          ret  = 0;
+
+    size = uhos_libc_strlen(req->method) + uhos_libc_strlen(req->path) + uhos_libc_strlen(req->host) +
+           ((UHOS_NULL != req->headers) ? uhos_libc_strlen(req->headers) : 0) + UHOS_HTTP_HEAD_RESERVE;
+    head = uhos_libc_malloc(size);
+    if (UHOS_NULL == head)
+    {
+        UHOS_LOG_MEM_ALLOC_FAIL();
+        return -1;
+    }
+
+    len = uhos_libc_snprintf(head, size, "%s %s HTTP/1.1\r\nHost: %s", req->method, req->path, req->host);
+    if (uhos_http_port(req) != (req->https ? 443 : 80))
+    {
+        len += uhos_libc_snprintf(&head[len], size - len, ":%u", (unsigned)uhos_http_port(req));
+    }
+    len += uhos_libc_snprintf(&head[len], size - len, "\r\nConnection: %s\r\n",
+                              (0 != g_uhos_http_pool.cfg.max_conns) ? "keep-alive" : "close");
+    if ((req->body_len > 0) || (0 == uhos_libc_strcmp(req->method, "POST")) || (0 == uhos_libc_strcmp(req->method, "PUT")))
+    {
+        len += uhos_libc_snprintf(&head[len], size - len, "Content-Length: %u\r\n", (unsigned)req->body_len);
+    }
+    len += uhos_libc_snprintf(&head[len], size - len, "%s\r\n", (UHOS_NULL != req->headers) ? req->headers : "");
+
+    iov[0].iov_base = head;
+    iov[0].iov_len  = (uhos_size_t)len;
+    iov[1].iov_base = (uhos_void *)req->body;
+    iov[1].iov_len  = req->body_len;
+    ret = uhos_http_conn_send(conn, iov, (req->body_len > 0) ? 2 : 1, deadline);
+    uhos_libc_free(head);
+
+    return ret;
+}
+
+/**
+ * @brief       在一个连接上依次发出num个请求，再依次接收响应
+ * @param[out]  result  第一个未完成请求的失败原因，UHOS_HTTP_RECV_XXX
+ * @return      完成的请求数
+ */
+static uhos_u32 uhos_http_exchange(uhos_http_conn_t *conn, const uhos_http_req_t *reqs, uhos_http_rsp_t *rsps,
+                                   uhos_u32 num, uhos_u32 start, uhos_s32 *result)
+{
+    uhos_http_pool_t *pool = &g_uhos_http_pool;
+    uhos_u32          sent = 0;
+    uhos_u32          done = 0;
+
+    *result = UHOS_HTTP_RECV_OK;
+
+    for (done = 0; done < num; done++)
+    {
+        rsps[done].status    = 0;
+        rsps[done].body_len  = 0;
+        rsps[done].total_len = 0;
+    }
+
+    for (sent = 0; sent < num; sent++)
+    {
+        if (0 != uhos_http_send_req(conn, &reqs[sent], start + reqs[sent].timeout_ms))
+        {
+            break;
+        }
+    }
+    if (0 == sent)
+    {
+        // 发送失败与未收到数据同样说明连接已不可用
+        *result    = UHOS_HTTP_RECV_NODATA;
+        conn->keep = UHOS_FALSE;
+        return 0;
+    }
+
+    done = 0;
+    while (done < sent)
+    {
+        *result = uhos_http_read_rsp(conn, &reqs[done], &rsps[done], start + reqs[done].timeout_ms);
+        if (UHOS_HTTP_RECV_OK != *result)
+        {
+            conn->keep = UHOS_FALSE;
+            break;
+        }
+
+        uhos_http_lock();
+        pool->stats.requests++;
+        if (conn->served > 0)
+        {
+            pool->stats.reused++;
+        }
+        if (done > 0)
+        {
+            pool->stats.pipelined++;
+        }
+        uhos_http_unlock();
+        conn->served++;
+        done++;
+
+        // TLS1.3的会话票据在握手后发送，收到响应时已处理
+        if ((UHOS_NULL != conn->tls) && !conn->session)
+        {
+            conn->session = (0 == uhos_tls_session_cache_update(conn->tls, conn->host, conn->port));
+        }
+
+        if (!conn->keep)
+        {
+            break;
+        }
+    }
+    if ((UHOS_HTTP_RECV_OK == *result) && (done < num))
+    {
+        // 服务器关闭了连接或有请求未发出，后续请求未被处理
+        *result = UHOS_HTTP_RECV_NODATA;
+    }
+
+    return done;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_s32 uhos_http_pool_init(const uhos_http_pool_cfg_t *cfg)
+{
+    uhos_http_pool_t *pool = &g_uhos_http_pool;
+
+    if (pool->inited)
+    {
+        return 0;
+    }
+
+    uhos_libc_memset(pool, 0, sizeof(uhos_http_pool_t));
+    if (UHOS_NULL != cfg)
+    {
+        pool->cfg = *cfg;
+    }
+    else
+    {
+        pool->cfg.max_conns    = CONFIG_UHOS_HTTP_POOL_MAX;
+        pool->cfg.max_per_host = CONFIG_UHOS_HTTP_POOL_PER_HOST;
+        pool->cfg.idle_ms      = CONFIG_UHOS_HTTP_IDLE_MS;
+    }
+    if (0 == pool->cfg.max_per_host)
+    {
+        pool->cfg.max_per_host = pool->cfg.max_conns;
+    }
+
+    if ((UHOS_NULL != pool->cfg.ca_cert) && (pool->cfg.ca_cert_len > 0))
+    {
+        pool->ca_store = uhos_tls_store_create(pool->cfg.ca_cert, pool->cfg.ca_cert_len, UHOS_NULL, 0, UHOS_NULL, 0);
+        if (UHOS_NULL == pool->ca_store)
+        {
+            UHOS_LOGE("bad ca cert");
+            return -1;
+        }
+    }
+
+    if (UHOS_SUCCESS != uhos_mutex_create(&pool->mutex))
+    {
+        UHOS_LOGE("mutex create failed");
+        uhos_tls_store_release(pool->ca_store);
+        pool->ca_store = UHOS_NULL;
+        return -1;
+    }
+    pool->inited = UHOS_TRUE;
+
+    return 0;
+}
+
+uhos_void uhos_http_pool_deinit(uhos_void)
+{
+    uhos_http_pool_t *pool = &g_uhos_http_pool;
+    uhos_http_conn_t *idle = UHOS_NULL;
+
+    if (!pool->inited)
+    {
+        return;
+    }
+
+    uhos_http_lock();
+    pool->inited   = UHOS_FALSE;
+    idle           = pool->idle;
+    pool->idle     = UHOS_NULL;
+    pool->idle_num = 0;
+    uhos_http_unlock();
+
+    uhos_http_conn_close_list(idle);
+    uhos_mutex_delete(pool->mutex);
+    pool->mutex = UHOS_NULL;
+    // 仍持有证书库的tls句柄释放时归还各自的引用
+    uhos_tls_store_release(pool->ca_store);
+    pool->ca_store = UHOS_NULL;
+}
+
+uhos_u32 uhos_http_request_batch(const uhos_http_req_t *reqs, uhos_http_rsp_t *rsps, uhos_u32 num)
+{
+    uhos_http_pool_t *pool    = &g_uhos_http_pool;
+    uhos_http_conn_t *conn    = UHOS_NULL;
+    uhos_bool         reused  = UHOS_FALSE;
+    uhos_u32          retried = num;                            // 已重试过的请求下标
+    uhos_u32          start   = 0;
+    uhos_u32          window  = 0;
+    uhos_u32          done    = 0;
+    uhos_u32          i       = 0;
+    uhos_s32          result  = 0;
+
+    if ((UHOS_NULL == reqs) || (UHOS_NULL == rsps) || !pool->inited)
+    {
+        return 0;
+    }
+
+    while (i < num)
+    {
+        if ((UHOS_NULL == reqs[i].method) || (UHOS_NULL == reqs[i].host) || (UHOS_NULL == reqs[i].path))
+        {
+            break;
+        }
+
+        // 重试时使用新连接
+        start  = uhos_current_time_get();
+        conn   = (retried != i) ? uhos_http_pool_take(&reqs[i]) : UHOS_NULL;
+        reused = (UHOS_NULL != conn);
+        if (!reused)
+        {
+            conn = uhos_http_conn_open(&reqs[i], start + reqs[i].timeout_ms);
+            if (UHOS_NULL == conn)
+            {
+                break;
+            }
+        }
+        uhos_http_conn_timeout(conn, reqs[i].timeout_ms);
+
+        // 只在服务器已表明支持保持连接的连接上流水线发送幂等请求
+        window = 1;
+        if (conn->pipeline && uhos_http_idempotent(&reqs[i]))
+        {
+            while ((i + window < num) && (window < CONFIG_UHOS_HTTP_PIPELINE_DEPTH) &&
+                   (UHOS_NULL != reqs[i + window].method) && (UHOS_NULL != reqs[i + window].host) &&
+                   (UHOS_NULL != reqs[i + window].path) && uhos_http_same_server(&reqs[i], &reqs[i + window]) &&
+                   uhos_http_idempotent(&reqs[i + window]))
+            {
+                window++;
+            }
+        }
+
+        done = uhos_http_exchange(conn, &reqs[i], &rsps[i], window, start, &result);
+        uhos_http_pool_put(conn);
+        i += done;
+
+        if (done == window)
+        {
+            continue;
+        }
+
+        // 请求已发出但服务器在响应前关闭了连接：流水线中排在关闭之后的请求服务器不会处理，
+        // 复用的空闲连接可能恰好被服务器超时关闭，两种情况下幂等请求都可以换新连接重发
+        if ((UHOS_HTTP_RECV_NODATA == result) && uhos_http_idempotent(&reqs[i]) && ((done > 0) || reused) && (retried != i))
+        {
+            if (0 == done)
+            {
+                retried = i;
+                uhos_http_lock();
+                pool->stats.retries++;
+                uhos_http_unlock();
+            }
+            continue;
+        }
+
+        UHOS_LOGW("%s %s%s failed %d", reqs[i].method, reqs[i].host, reqs[i].path, (int)result);
+        break;
+    }
+
+    return i;
+}
+
+uhos_s32 uhos_http_request(const uhos_http_req_t *req, uhos_http_rsp_t *rsp)
+{
+    return (1 == uhos_http_request_batch(req, rsp, 1)) ? 0 : -1;
+}
+
+uhos_void uhos_http_pool_evict(uhos_void)
+{
+    uhos_http_conn_t *expired = UHOS_NULL;
+
+    if (!g_uhos_http_pool.inited)
+    {
+        return;
+    }
+
+    uhos_http_lock();
+    expired = uhos_http_pool_expire(uhos_current_time_get());
+    uhos_http_unlock();
+
+    uhos_http_conn_close_list(expired);
+}
+
+uhos_void uhos_http_pool_stats_get(uhos_http_pool_stats_t *stats)
+{
+    if ((UHOS_NULL == stats) || !g_uhos_http_pool.inited)
+    {
+        return;
+    }
+
+    uhos_http_lock();
+    *stats = g_uhos_http_pool.stats;
+    uhos_http_unlock();
+}
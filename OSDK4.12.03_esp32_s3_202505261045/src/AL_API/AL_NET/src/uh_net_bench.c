@@ -0,0 +1,235 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_net_bench.c
+ * @author agent (agent@local)
+ * @brief 协议帧发送吞吐基准测试的功能实现
+ * @details 拷贝拼帧按现有调用方式，每帧申请连续buffer、拷贝协议头与负载后发送；
+ *          聚合发送把协议头与负载作为两个iovec交给uhos_net_writev。
+ *          两种方式都经uhos_net_writev发出，差异只在拼帧的拷贝与内存申请
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：协议帧发送吞吐基准测试的功能实现
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>输出与计时改用uh_bench.h
+ * </table>
+ */
+
+#define LOG_TAG "net-bench"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_al_net.h"
+#include "uh_bench.h"
+
+#include "uh_net_bench.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+// 矩阵用例的协议头长度
+#define UHOS_NET_BENCH_HDR_LEN              16
+
+// JSON行的最大长度
+#define UHOS_NET_BENCH_JSON_LEN             256
+
+#define UHOS_NET_BENCH_ARRAY_NUM(a)         (sizeof(a) / sizeof((a)[0]))
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static const uhos_char *g_uhos_net_bench_mode_name[UHOS_NET_BENCH_MODE_MAX] = {"copy", "iov"};
+static const uhos_u32   g_uhos_net_bench_payloads[] = {64, 512, 1400, 8192};
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       发送完整的iovec数组，部分发送时跳过已发出的数据续发
+ * @return      0-成功，-1-失败
+ */
+static uhos_s32 uhos_net_bench_writev_all(uhos_s32 fd, struct uhos_iovec *iov, uhos_s32 iovcnt, uhos_net_bench_result_t *result)
+{
+    uhos_ssize_t sent = 0;
+
+    while (iovcnt > 0)
+    {
+        sent = uhos_net_writev(fd, iov, iovcnt);
+        result->calls++;
+        if (sent <= 0)
+        {
+            return -1;
+        }
+        result->bytes += (uhos_u32)sent;
+
+        while ((iovcnt > 0) && ((uhos_size_t)sent >= iov->iov_len))
+        {
+            sent -= (uhos_ssize_t)iov->iov_len;
+            iov++;
+            iovcnt--;
+        }
+        if (iovcnt > 0)
+        {
+            iov->iov_base = (uhos_u8 *)iov->iov_base + sent;
+            iov->iov_len -= (uhos_size_t)sent;
+        }
+    }
+
+    return 0;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_s32 uhos_net_bench_run(uhos_s32 fd, const uhos_net_bench_case_t *bcase, uhos_net_bench_result_t *result)
+{
+    struct uhos_iovec iov[2];
+    uhos_u8          *hdr     = UHOS_NULL;
+    uhos_u8          *payload = UHOS_NULL;
+    uhos_u8          *frame   = UHOS_NULL;
+    uhos_u32          start   = 0;
+    uhos_u32          i       = 0;
+
+    if ((UHOS_NULL == bcase) || (UHOS_NULL == result) || (bcase->mode >= UHOS_NET_BENCH_MODE_MAX))
+    {
+        return -1;
+    }
+
+    uhos_libc_memset(result, 0, sizeof(uhos_net_bench_result_t));
+    result->status = -1;
+
+    hdr     = uhos_libc_malloc(bcase->hdr_len + 1);
+    payload = uhos_libc_malloc(bcase->payload_len + 1);
+    if ((UHOS_NULL == hdr) || (UHOS_NULL == payload))
+    {
+        UHOS_LOG_MEM_ALLOC_FAIL();
+        goto exit;
+    }
+    uhos_libc_memset(hdr, 0xA5, bcase->hdr_len);
+    uhos_libc_memset(payload, 0x5A, bcase->payload_len);
+
+    start = uhos_bench_now_us();
+    for (i = 0; i < bcase->frames; i++)
+    {
+        if (UHOS_NET_BENCH_COPY == bcase->mode)
+        {
+            frame = uhos_libc_malloc(bcase->hdr_len + bcase->payload_len);
+            if (UHOS_NULL == frame)
+            {
+                UHOS_LOG_MEM_ALLOC_FAIL();
+                goto exit;
+            }
+            result->allocs++;
+            uhos_libc_memcpy(frame, hdr, bcase->hdr_len);
+            uhos_libc_memcpy(frame + bcase->hdr_len, payload, bcase->payload_len);
+
+            iov[0].iov_base = frame;
+            iov[0].iov_len  = bcase->hdr_len + bcase->payload_len;
+            if (0 != uhos_net_bench_writev_all(fd, iov, 1, result))
+            {
+                goto exit;
+            }
+            uhos_libc_free(frame);
+            frame = UHOS_NULL;
+        }
+        else
+        {
+            iov[0].iov_base = hdr;
+            iov[0].iov_len  = bcase->hdr_len;
+            iov[1].iov_base = payload;
+            iov[1].iov_len  = bcase->payload_len;
+            if (0 != uhos_net_bench_writev_all(fd, iov, 2, result))
+            {
+                goto exit;
+            }
+        }
+        result->frames++;
+    }
+    result->elapsed_us = uhos_bench_now_us() - start;
+    result->status     = 0;
+
+    if (result->elapsed_us > 0)
+    {
+        result->frames_per_sec = (uhos_u32)((uhos_u64)result->frames * 1000000 / result->elapsed_us);
+        result->goodput_kbps   = (uhos_u32)((uhos_u64)result->bytes * 8000 / result->elapsed_us);
+    }
+
+exit:
+    if (0 != result->status)
+    {
+        UHOS_LOGE("bench %s payload %u failed after %u frames", g_uhos_net_bench_mode_name[bcase->mode],
+                  (unsigned)bcase->payload_len, (unsigned)result->frames);
+    }
+    uhos_libc_free(frame);
+    uhos_libc_free(payload);
+    uhos_libc_free(hdr);
+
+    return result->status;
+}
+
+uhos_s32 uhos_net_bench_result_json(const uhos_net_bench_case_t *bcase, const uhos_net_bench_result_t *result,
+                                    uhos_char *buf, uhos_u32 size)
+{
+    uhos_bench_json_t json = {0};
+
+    if ((UHOS_NULL == bcase) || (UHOS_NULL == result) || (UHOS_NULL == buf) || (bcase->mode >= UHOS_NET_BENCH_MODE_MAX))
+    {
+        return 0;
+    }
+
+    uhos_bench_json_begin(&json, buf, size);
+    uhos_bench_json_str(&json, "mode", g_uhos_net_bench_mode_name[bcase->mode]);
+    uhos_bench_json_u32(&json, "hdr", bcase->hdr_len);
+    uhos_bench_json_u32(&json, "payload", bcase->payload_len);
+    uhos_bench_json_status(&json, result->status);
+    uhos_bench_json_u32(&json, "frames", result->frames);
+    uhos_bench_json_u32(&json, "bytes", result->bytes);
+    uhos_bench_json_u32(&json, "elapsed_us", result->elapsed_us);
+    uhos_bench_json_u32(&json, "frames_per_sec", result->frames_per_sec);
+    uhos_bench_json_u32(&json, "goodput_kbps", result->goodput_kbps);
+    uhos_bench_json_u32(&json, "calls", result->calls);
+    uhos_bench_json_u32(&json, "allocs", result->allocs);
+
+    return uhos_bench_json_end(&json);
+}
+
+uhos_s32 uhos_net_bench_matrix_run(uhos_s32 fd, uhos_bench_print_t print)
+{
+    uhos_net_bench_case_t   bcase  = {0};
+    uhos_net_bench_result_t result = {0};
+    uhos_char               line[UHOS_NET_BENCH_JSON_LEN];
+    uhos_s32                ret    = 0;
+    uhos_u32                p      = 0;
+    uhos_u8                 mode   = 0;
+
+    if (UHOS_NULL == print)
+    {
+        return -1;
+    }
+
+    bcase.hdr_len = UHOS_NET_BENCH_HDR_LEN;
+    bcase.frames  = CONFIG_UHOS_NET_BENCH_FRAMES;
+
+    for (p = 0; p < UHOS_NET_BENCH_ARRAY_NUM(g_uhos_net_bench_payloads); p++)
+    {
+        for (mode = 0; mode < UHOS_NET_BENCH_MODE_MAX; mode++)
+        {
+            bcase.mode        = (uhos_net_bench_mode_t)mode;
+            bcase.payload_len = g_uhos_net_bench_payloads[p];
+
+            if (0 != uhos_net_bench_run(fd, &bcase, &result))
+            {
+                ret = -1;
+            }
+            uhos_net_bench_result_json(&bcase, &result, line, sizeof(line));
+            print(line);
+        }
+    }
+
+    return ret;
+}
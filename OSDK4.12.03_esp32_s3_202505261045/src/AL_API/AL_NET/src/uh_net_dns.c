@@ -0,0 +1,1313 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_net_dns.c
+ * @author agent (agent@local)
+ * @brief 异步域名解析与TTL缓存的功能实现
+ * @details uhos_net_getaddrinfo阻塞且不返回TTL，这里直接通过UDP向DNS服务器查询A记录：
+ *          每个进行中的查询一个UDP socket，注册到解析线程的poller，超时后轮换服务器重传；
+ *          只接受来源地址与端口为本查询已发送过的服务器的应答，防止路径外伪造应答污染缓存；
+ *          相同域名的查询合并为一个，结果按应答中的TTL缓存，NXDOMAIN/无地址按SOA的minimum缓存。
+ *          缓存中每个地址单独记录来源与过期时间，DNS与HTTP-DNS的结果互不覆盖、合并返回；
+ *          地址过期后在宽限期内仍直接返回并在后台刷新，刷新失败时继续使用过期地址
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：异步域名解析与TTL缓存的功能实现
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>各接口持锁后重新检查解析器状态，避免与deinit并发时访问已释放的缓存与poller
+ * </table>
+ */
+
+#define LOG_TAG "net-dns"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_random.h"
+#include "uh_osal.h"
+#include "uh_log.h"
+#include "uh_al_net.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+// 缓存的域名数，满后淘汰最久未使用的域名
+#ifndef CONFIG_UHOS_NET_DNS_CACHE_NUM
+#define CONFIG_UHOS_NET_DNS_CACHE_NUM       16
+#endif
+
+// 域名最大长度（含结束符）
+#ifndef CONFIG_UHOS_NET_DNS_NAME_LEN
+#define CONFIG_UHOS_NET_DNS_NAME_LEN        128
+#endif
+
+// 最多配置的DNS服务器数
+#ifndef CONFIG_UHOS_NET_DNS_SERVER_NUM
+#define CONFIG_UHOS_NET_DNS_SERVER_NUM      3
+#endif
+
+// 单次查询的应答超时（毫秒），超时后向下一个服务器重传
+#ifndef CONFIG_UHOS_NET_DNS_TIMEOUT_MS
+#define CONFIG_UHOS_NET_DNS_TIMEOUT_MS      1500
+#endif
+
+// 每个域名查询的最大发送次数
+#ifndef CONFIG_UHOS_NET_DNS_TRIES
+#define CONFIG_UHOS_NET_DNS_TRIES           3
+#endif
+
+// TTL的上下限（秒），避免过短的TTL导致频繁查询、过长的TTL导致地址长期不更新
+#ifndef CONFIG_UHOS_NET_DNS_TTL_MIN
+#define CONFIG_UHOS_NET_DNS_TTL_MIN         30
+#endif
+#ifndef CONFIG_UHOS_NET_DNS_TTL_MAX
+#define CONFIG_UHOS_NET_DNS_TTL_MAX         86400
+#endif
+
+// 没有SOA时NXDOMAIN/无地址结果的缓存时间（秒），以及其上限
+#ifndef CONFIG_UHOS_NET_DNS_NEG_TTL
+#define CONFIG_UHOS_NET_DNS_NEG_TTL         60
+#endif
+#ifndef CONFIG_UHOS_NET_DNS_NEG_TTL_MAX
+#define CONFIG_UHOS_NET_DNS_NEG_TTL_MAX     300
+#endif
+
+// 地址过期后仍可返回的宽限期（秒）
+#ifndef CONFIG_UHOS_NET_DNS_STALE_SEC
+#define CONFIG_UHOS_NET_DNS_STALE_SEC       3600
+#endif
+
+#define UHOS_NET_DNS_TASK_NAME              "net_dns"
+#define UHOS_NET_DNS_TASK_STACK_SIZE        3 * 1024
+#define UHOS_NET_DNS_TASK_PRIORITY          5
+
+// 解析线程的最长等待时间（毫秒），新查询的重传时刻与退出标志在此间隔内得到处理
+#define UHOS_NET_DNS_TICK_MS                200
+
+#define UHOS_NET_DNS_PORT                   53
+#define UHOS_NET_DNS_ADDR_STR_LEN           24                  // "ip:port"字符串长度
+#define UHOS_NET_DNS_MSG_LEN                512
+#define UHOS_NET_DNS_HDR_LEN                12
+#define UHOS_NET_DNS_TYPE_A                 1
+#define UHOS_NET_DNS_TYPE_SOA               6
+#define UHOS_NET_DNS_CLASS_IN               1
+#define UHOS_NET_DNS_RCODE_NXDOMAIN         3
+
+#define UHOS_NET_DNS_SRC_DNS                0x01                // 地址来自DNS应答
+#define UHOS_NET_DNS_SRC_HTTP               0x02                // 地址来自HTTP-DNS
+#define UHOS_NET_DNS_ENTRY_ADDR_NUM         (CONFIG_UHOS_NET_DNS_ADDR_MAX * 2)
+
+#define UHOS_NET_DNS_TIME_AFTER(a, b)       ((uhos_s32)((a) - (b)) > 0)
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      缓存的地址
+ */
+typedef struct
+{
+    uhos_u32 ip;                                                //<! IPv4地址，网络字节序
+    uhos_u32 expire;                                            //<! 过期时刻（毫秒）
+    uhos_u8  src;                                               //<! 来源，UHOS_NET_DNS_SRC_XXX
+} uhos_net_dns_addr_t;
+
+/**
+ * @struct      域名缓存
+ */
+typedef struct
+{
+    uhos_char           host[CONFIG_UHOS_NET_DNS_NAME_LEN];     //<! 域名，空串表示未使用
+    uhos_u32            last_use;                               //<! 最近使用时刻，用于淘汰
+    uhos_u32            neg_expire;                             //<! 域名不存在结果的过期时刻
+    uhos_u8             neg;                                    //<! 是否缓存了域名不存在
+    uhos_u8             num;                                    //<! 地址个数
+    uhos_net_dns_addr_t addr[UHOS_NET_DNS_ENTRY_ADDR_NUM];      //<! 地址，每个来源各自记录
+} uhos_net_dns_entry_t;
+
+/**
+ * @struct      等待查询结果的回调
+ */
+typedef struct uhos_net_dns_waiter
+{
+    struct uhos_net_dns_waiter *next;
+    uhos_net_dns_cb_t           cb;                             //<! 结果回调
+    uhos_void                  *arg;                            //<! 用户参数
+} uhos_net_dns_waiter_t;
+
+/**
+ * @struct      DNS服务器
+ */
+typedef struct
+{
+    uhos_u32 ip;                                                //<! 网络字节序
+    uhos_u16 port;                                              //<! 主机字节序
+} uhos_net_dns_server_t;
+
+/**
+ * @struct      进行中的查询
+ */
+typedef struct uhos_net_dns_query
+{
+    struct uhos_net_dns_query *next;
+    uhos_net_dns_waiter_t     *waiters;                         //<! 等待结果的回调，后台刷新时为空
+    uhos_s32                   fd;                              //<! 查询使用的UDP socket
+    uhos_u16                   id;                              //<! 报文ID
+    uhos_u8                    tries;                           //<! 已发送次数
+    uhos_u8                    server;                          //<! 下次使用的服务器
+    uhos_u32                   deadline;                        //<! 本次发送的超时时刻
+    uhos_net_dns_server_t      sent[CONFIG_UHOS_NET_DNS_TRIES]; //<! 各次发送的服务器，前tries项有效
+    uhos_char                  host[CONFIG_UHOS_NET_DNS_NAME_LEN];
+} uhos_net_dns_query_t;
+
+/**
+ * @struct      同步解析的等待对象，由调用者与回调各持有一个引用
+ */
+typedef struct
+{
+    uhos_sem_t            sem;
+    uhos_u32              refs;
+    uhos_net_dns_result_t result;
+} uhos_net_dns_sync_t;
+
+/**
+ * @struct      解析器控制块
+ */
+typedef struct
+{
+    uhos_mutex_t              mutex;                            //<! 保护以下所有成员
+    uhos_sem_t                exit_sem;                         //<! 解析线程已退出循环
+    uhos_thread_t             tid;                              //<! 解析线程
+    uhos_net_poller_t         poller;                           //<! 查询socket的poller
+    volatile uhos_u8          running;                          //<! 解析线程是否运行
+    uhos_u8                   server_num;                       //<! 配置的服务器数，0表示使用系统DNS
+    uhos_net_dns_server_t     server[CONFIG_UHOS_NET_DNS_SERVER_NUM];
+    uhos_net_dns_query_t     *queries;                          //<! 进行中的查询
+    uhos_net_dns_entry_t     *cache;                            //<! 域名缓存
+    uhos_net_resolver_stats_t stats;                            //<! 统计
+} uhos_net_dns_ctl_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_net_dns_ctl_t g_uhos_net_dns_ctl = {0};
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static void uhos_net_dns_lock(void)
+{
+    uhos_mutex_wait(g_uhos_net_dns_ctl.mutex, UHOS_MUTEX_WAIT_FOREVER);
+}
+
+static void uhos_net_dns_unlock(void)
+{
+    uhos_mutex_release(g_uhos_net_dns_ctl.mutex);
+}
+
+/**
+ * @brief       解析器是否可用，调用者持锁
+ * @note        持锁前的running检查只用于快速返回；deinit在持锁时清除running并释放缓存与poller，
+ *              持锁后须重新检查
+ */
+static uhos_bool uhos_net_dns_ready(void)
+{
+    return (g_uhos_net_dns_ctl.running && (UHOS_NULL != g_uhos_net_dns_ctl.cache) &&
+            (UHOS_NULL != g_uhos_net_dns_ctl.poller)) ? UHOS_TRUE : UHOS_FALSE;
+}
+
+static uhos_u16 uhos_net_dns_get16(const uhos_u8 *p)
+{
+    return (uhos_u16)((p[0] << 8) | p[1]);
+}
+
+static uhos_u32 uhos_net_dns_get32(const uhos_u8 *p)
+{
+    return ((uhos_u32)p[0] << 24) | ((uhos_u32)p[1] << 16) | ((uhos_u32)p[2] << 8) | p[3];
+}
+
+static uhos_u32 uhos_net_dns_clamp(uhos_u32 value, uhos_u32 min, uhos_u32 max)
+{
+    return (value < min) ? min : ((value > max) ? max : value);
+}
+
+/**
+ * @brief       解析"ip[:port],ip[:port]"格式的服务器列表
+ */
+static uhos_u8 uhos_net_dns_server_parse(const uhos_char *servers, uhos_net_dns_server_t *server)
+{
+    uhos_char ip[UHOS_NET_DNS_ADDR_STR_LEN];
+    uhos_u8   num = 0;
+    uhos_u32  len = 0;
+
+    while ((UHOS_NULL != servers) && ('\0' != *servers) && (num < CONFIG_UHOS_NET_DNS_SERVER_NUM))
+    {
+        len = 0;
+        while (('\0' != servers[len]) && (',' != servers[len]) && (':' != servers[len]) && (len < sizeof(ip) - 1))
+        {
+            ip[len] = servers[len];
+            len++;
+        }
+        ip[len]          = '\0';
+        servers         += len;
+        server[num].ip   = uhos_net_inet_addr(ip);
+        server[num].port = UHOS_NET_DNS_PORT;
+        if (':' == *servers)
+        {
+            server[num].port = (uhos_u16)uhos_libc_atoi(++servers);
+        }
+        while (('\0' != *servers) && (',' != *servers))
+        {
+            servers++;
+        }
+        if (',' == *servers)
+        {
+            servers++;
+        }
+
+        if ((0xFFFFFFFF != server[num].ip) && (0 != server[num].port))
+        {
+            num++;
+        }
+    }
+
+    return num;
+}
+
+/**
+ * @brief       取第index个服务器，未配置服务器时使用系统DNS
+ */
+static uhos_s32 uhos_net_dns_server_get(uhos_u8 index, struct uhos_sockaddr_in *addr)
+{
+    uhos_net_dns_ctl_t *ctl    = &g_uhos_net_dns_ctl;
+    uhos_net_dns_server_t server = {0};
+    uhos_char           ip[UHOS_NET_DNS_ADDR_STR_LEN] = {0};
+
+    if (ctl->server_num > 0)
+    {
+        server = ctl->server[index % ctl->server_num];
+    }
+    else
+    {
+        if ((0 != uhos_net_dns_config(OP_GET, ip)) || (1 != uhos_net_dns_server_parse(ip, &server)))
+        {
+            return -1;
+        }
+    }
+
+    uhos_libc_memset(addr, 0, sizeof(struct uhos_sockaddr_in));
+    addr->sin_len         = sizeof(struct uhos_sockaddr_in);
+    addr->sin_family      = UHOS_AF_INET;
+    addr->sin_port        = uhos_net_htons(server.port);
+    addr->sin_addr.s_addr = server.ip;
+
+    return 0;
+}
+
+/**
+ * @brief       构造A记录查询报文
+ * @return      报文长度，域名非法时返回-1
+ */
+static uhos_s32 uhos_net_dns_build(uhos_u8 *buf, uhos_u16 id, const uhos_char *host)
+{
+    uhos_u32 pos   = UHOS_NET_DNS_HDR_LEN;
+    uhos_u32 label = 0;
+
+    uhos_libc_memset(buf, 0, UHOS_NET_DNS_HDR_LEN);
+    buf[0] = (uhos_u8)(id >> 8);
+    buf[1] = (uhos_u8)id;
+    buf[2] = 0x01;                                              // RD
+    buf[5] = 1;                                                 // QDCOUNT
+
+    while ('\0' != *host)
+    {
+        label = 0;
+        while (('\0' != host[label]) && ('.' != host[label]))
+        {
+            label++;
+        }
+        if ((0 == label) || (label > 63) || (pos + 1 + label + 5 > UHOS_NET_DNS_MSG_LEN))
+        {
+            return -1;
+        }
+        buf[pos++] = (uhos_u8)label;
+        uhos_libc_memcpy(&buf[pos], host, label);
+        pos  += label;
+        host += label;
+        if ('.' == *host)
+        {
+            host++;
+        }
+    }
+
+    buf[pos++] = 0;
+    buf[pos++] = 0;
+    buf[pos++] = UHOS_NET_DNS_TYPE_A;
+    buf[pos++] = 0;
+    buf[pos++] = UHOS_NET_DNS_CLASS_IN;
+
+    return (uhos_s32)pos;
+}
+
+/**
+ * @brief       读取报文中的域名（支持压缩指针），转换为点分格式
+ * @param[in,out] off   域名的起始位置，返回时为域名之后的位置
+ * @param[out]  name    域名，为UHOS_NULL时只跳过
+ * @return      0-成功，-1-报文非法
+ */
+static uhos_s32 uhos_net_dns_name_read(const uhos_u8 *msg, uhos_u32 len, uhos_u32 *off, uhos_char *name, uhos_u32 size)
+{
+    uhos_u32 pos   = *off;
+    uhos_u32 out   = 0;
+    uhos_u32 jumps = 0;
+    uhos_u8  jumped = 0;
+
+    while (pos < len)
+    {
+        uhos_u8 label = msg[pos];
+
+        if (0 == label)
+        {
+            if (!jumped)
+            {
+                *off = pos + 1;
+            }
+            if (UHOS_NULL != name)
+            {
+                name[(out > 0) ? out - 1 : 0] = '\0';
+            }
+            return 0;
+        }
+
+        if (0xC0 == (label & 0xC0))
+        {
+            if ((pos + 1 >= len) || (++jumps > 16))
+            {
+                return -1;
+            }
+            if (!jumped)
+            {
+                *off = pos + 2;
+            }
+            jumped = 1;
+            pos    = ((label & 0x3F) << 8) | msg[pos + 1];
+            continue;
+        }
+
+        if ((label > 63) || (pos + 1 + label > len))
+        {
+            return -1;
+        }
+        if (UHOS_NULL != name)
+        {
+            if (out + label + 1 > size)
+            {
+                return -1;
+            }
+            uhos_libc_memcpy(&name[out], &msg[pos + 1], label);
+            out        += label;
+            name[out++] = '.';
+        }
+        pos += 1 + label;
+    }
+
+    return -1;
+}
+
+/**
+ * @brief       解析应答报文
+ * @param[out]  ip      A记录地址
+ * @param[out]  num     地址个数
+ * @param[out]  ttl     A记录TTL的最小值，或否定结果的缓存时间（秒）
+ * @return      UHOS_NET_DNS_XXX；报文与查询不匹配时返回1
+ */
+static uhos_s32 uhos_net_dns_parse(const uhos_u8 *msg, uhos_u32 len, const uhos_net_dns_query_t *query,
+                                   uhos_u32 *ip, uhos_u8 *num, uhos_u32 *ttl)
+{
+    uhos_char name[CONFIG_UHOS_NET_DNS_NAME_LEN];
+    uhos_u32  pos    = UHOS_NET_DNS_HDR_LEN;
+    uhos_u32  neg    = CONFIG_UHOS_NET_DNS_NEG_TTL;
+    uhos_u16  qd     = 0;
+    uhos_u16  an     = 0;
+    uhos_u16  ns     = 0;
+    uhos_u16  i      = 0;
+    uhos_u8   rcode  = 0;
+
+    if ((len < UHOS_NET_DNS_HDR_LEN) || (uhos_net_dns_get16(msg) != query->id) || !(msg[2] & 0x80))
+    {
+        return 1;
+    }
+
+    rcode = msg[3] & 0x0F;
+    qd    = uhos_net_dns_get16(&msg[4]);
+    an    = uhos_net_dns_get16(&msg[6]);
+    ns    = uhos_net_dns_get16(&msg[8]);
+
+    // 问题部分需与查询的域名一致，防止错配的应答污染缓存
+    if (1 != qd)
+    {
+        return 1;
+    }
+    if ((0 != uhos_net_dns_name_read(msg, len, &pos, name, sizeof(name))) || (pos + 4 > len) ||
+        (0 != uhos_libc_strcasecmp(name, query->host)))
+    {
+        return 1;
+    }
+    pos += 4;
+
+    if ((0 != rcode) && (UHOS_NET_DNS_RCODE_NXDOMAIN != rcode))
+    {
+        return UHOS_NET_DNS_ERROR;
+    }
+
+    *num = 0;
+    *ttl = CONFIG_UHOS_NET_DNS_TTL_MAX;
+    for (i = 0; i < an + ns; i++)
+    {
+        uhos_u16 type  = 0;
+        uhos_u16 cls   = 0;
+        uhos_u32 rrttl = 0;
+        uhos_u16 rdlen = 0;
+
+        if ((0 != uhos_net_dns_name_read(msg, len, &pos, UHOS_NULL, 0)) || (pos + 10 > len))
+        {
+            break;
+        }
+        type  = uhos_net_dns_get16(&msg[pos]);
+        cls   = uhos_net_dns_get16(&msg[pos + 2]);
+        rrttl = uhos_net_dns_get32(&msg[pos + 4]);
+        rdlen = uhos_net_dns_get16(&msg[pos + 8]);
+        pos  += 10;
+        if (pos + rdlen > len)
+        {
+            break;
+        }
+
+        if ((i < an) && (UHOS_NET_DNS_TYPE_A == type) && (UHOS_NET_DNS_CLASS_IN == cls) && (4 == rdlen))
+        {
+            if (*num < CONFIG_UHOS_NET_DNS_ADDR_MAX)
+            {
+                uhos_libc_memcpy(&ip[*num], &msg[pos], 4);
+                (*num)++;
+            }
+            *ttl = (rrttl < *ttl) ? rrttl : *ttl;
+        }
+        else if ((i >= an) && (UHOS_NET_DNS_TYPE_SOA == type))
+        {
+            // RFC 2308：否定结果的缓存时间取SOA记录TTL与minimum字段的较小值
+            uhos_u32 soa = pos;
+
+            if ((0 == uhos_net_dns_name_read(msg, pos + rdlen, &soa, UHOS_NULL, 0)) &&
+                (0 == uhos_net_dns_name_read(msg, pos + rdlen, &soa, UHOS_NULL, 0)) && (soa + 20 <= pos + rdlen))
+            {
+                uhos_u32 minimum = uhos_net_dns_get32(&msg[soa + 16]);
+
+                neg = (rrttl < minimum) ? rrttl : minimum;
+            }
+        }
+        pos += rdlen;
+    }
+
+    if (*num > 0)
+    {
+        *ttl = uhos_net_dns_clamp(*ttl, CONFIG_UHOS_NET_DNS_TTL_MIN, CONFIG_UHOS_NET_DNS_TTL_MAX);
+        return UHOS_NET_DNS_OK;
+    }
+
+    *ttl = uhos_net_dns_clamp(neg, 1, CONFIG_UHOS_NET_DNS_NEG_TTL_MAX);
+    return UHOS_NET_DNS_NOTFOUND;
+}
+
+static uhos_net_dns_entry_t *uhos_net_dns_cache_find(const uhos_char *host)
+{
+    uhos_u32 i = 0;
+
+    for (i = 0; i < CONFIG_UHOS_NET_DNS_CACHE_NUM; i++)
+    {
+        if (('\0' != g_uhos_net_dns_ctl.cache[i].host[0]) && (0 == uhos_libc_strcasecmp(g_uhos_net_dns_ctl.cache[i].host, host)))
+        {
+            return &g_uhos_net_dns_ctl.cache[i];
+        }
+    }
+
+    return UHOS_NULL;
+}
+
+/**
+ * @brief       查找域名缓存，不存在时占用空闲项或淘汰最久未使用的项
+ */
+static uhos_net_dns_entry_t *uhos_net_dns_cache_get(const uhos_char *host, uhos_u32 now)
+{
+    uhos_net_dns_entry_t *entry = uhos_net_dns_cache_find(host);
+    uhos_net_dns_entry_t *lru   = UHOS_NULL;
+    uhos_u32              i     = 0;
+
+    if (UHOS_NULL != entry)
+    {
+        return entry;
+    }
+
+    for (i = 0; i < CONFIG_UHOS_NET_DNS_CACHE_NUM; i++)
+    {
+        entry = &g_uhos_net_dns_ctl.cache[i];
+        if ('\0' == entry->host[0])
+        {
+            lru = entry;
+            break;
+        }
+        if ((UHOS_NULL == lru) || UHOS_NET_DNS_TIME_AFTER(lru->last_use, entry->last_use))
+        {
+            lru = entry;
+        }
+    }
+
+    uhos_libc_memset(lru, 0, sizeof(uhos_net_dns_entry_t));
+    uhos_libc_strncpy(lru->host, host, sizeof(lru->host) - 1);
+    lru->last_use = now;
+
+    return lru;
+}
+
+/**
+ * @brief       以新结果替换某一来源的地址，其他来源的地址不变
+ */
+static void uhos_net_dns_cache_put(uhos_net_dns_entry_t *entry, uhos_u8 src, const uhos_u32 *ip, uhos_u8 num,
+                                   uhos_u32 ttl_sec, uhos_u32 now)
+{
+    uhos_u8 keep = 0;
+    uhos_u8 i    = 0;
+
+    num = (num < CONFIG_UHOS_NET_DNS_ADDR_MAX) ? num : CONFIG_UHOS_NET_DNS_ADDR_MAX;
+
+    // 原地去掉该来源的旧地址，其他来源的地址（至多CONFIG_UHOS_NET_DNS_ADDR_MAX个）后移给新结果让位
+    for (i = 0; i < entry->num; i++)
+    {
+        if (entry->addr[i].src != src)
+        {
+            entry->addr[keep++] = entry->addr[i];
+        }
+    }
+    uhos_libc_memmove(&entry->addr[num], entry->addr, keep * sizeof(uhos_net_dns_addr_t));
+
+    // 新结果在前
+    for (i = 0; i < num; i++)
+    {
+        entry->addr[i].ip     = ip[i];
+        entry->addr[i].expire = now + ttl_sec * 1000;
+        entry->addr[i].src    = src;
+    }
+    entry->num = num + keep;
+    if (num > 0)
+    {
+        entry->neg = 0;
+    }
+}
+
+/**
+ * @brief       收集在deadline之后过期的地址，两个来源的相同地址只返回一次
+ */
+static void uhos_net_dns_cache_collect(const uhos_net_dns_entry_t *entry, uhos_u32 deadline, uhos_net_dns_result_t *result)
+{
+    uhos_u8 i = 0;
+    uhos_u8 j = 0;
+
+    for (i = 0; (i < entry->num) && (result->num < CONFIG_UHOS_NET_DNS_ADDR_MAX); i++)
+    {
+        if (!UHOS_NET_DNS_TIME_AFTER(entry->addr[i].expire, deadline))
+        {
+            continue;
+        }
+        for (j = 0; (j < result->num) && (result->addr[j].s_addr != entry->addr[i].ip); j++)
+        {
+        }
+        if (j == result->num)
+        {
+            result->addr[result->num++].s_addr = entry->addr[i].ip;
+        }
+    }
+}
+
+/**
+ * @brief       从缓存生成结果
+ * @return      UHOS_TRUE-需要（重新）查询
+ */
+static uhos_bool uhos_net_dns_cache_result(uhos_net_dns_entry_t *entry, uhos_u32 now, uhos_net_dns_result_t *result)
+{
+    uhos_libc_memset(result, 0, sizeof(uhos_net_dns_result_t));
+    result->status = UHOS_NET_DNS_ERROR;
+    if (UHOS_NULL == entry)
+    {
+        return UHOS_TRUE;
+    }
+    entry->last_use = now;
+
+    uhos_net_dns_cache_collect(entry, now, result);
+    if (result->num > 0)
+    {
+        result->status = UHOS_NET_DNS_OK;
+        return UHOS_FALSE;
+    }
+
+    if (entry->neg && UHOS_NET_DNS_TIME_AFTER(entry->neg_expire, now))
+    {
+        result->status = UHOS_NET_DNS_NOTFOUND;
+        return UHOS_FALSE;
+    }
+
+    uhos_net_dns_cache_collect(entry, now - CONFIG_UHOS_NET_DNS_STALE_SEC * 1000, result);
+    if (result->num > 0)
+    {
+        result->status = UHOS_NET_DNS_OK;
+        result->stale  = 1;
+    }
+
+    return UHOS_TRUE;
+}
+
+static uhos_net_dns_query_t *uhos_net_dns_query_find(const uhos_char *host)
+{
+    uhos_net_dns_query_t *query = g_uhos_net_dns_ctl.queries;
+
+    while ((UHOS_NULL != query) && (0 != uhos_libc_strcasecmp(query->host, host)))
+    {
+        query = query->next;
+    }
+
+    return query;
+}
+
+/**
+ * @brief       向下一个服务器发送查询，调用者持有锁
+ */
+static uhos_s32 uhos_net_dns_query_send(uhos_net_dns_query_t *query, uhos_u32 now)
+{
+    struct uhos_sockaddr_in addr = {0};
+    uhos_u8                 msg[UHOS_NET_DNS_MSG_LEN];
+    uhos_s32                len  = 0;
+
+    query->tries++;
+    query->deadline = now + CONFIG_UHOS_NET_DNS_TIMEOUT_MS;
+
+    len = uhos_net_dns_build(msg, query->id, query->host);
+    if ((len < 0) || (0 != uhos_net_dns_server_get(query->server++, &addr)))
+    {
+        return -1;
+    }
+    query->sent[query->tries - 1].ip   = addr.sin_addr.s_addr;
+    query->sent[query->tries - 1].port = uhos_net_ntohs(addr.sin_port);
+
+    g_uhos_net_dns_ctl.stats.queries++;
+    if (uhos_net_sendto(query->fd, msg, (uhos_size_t)len, 0, (struct uhos_sockaddr *)&addr, sizeof(addr)) != len)
+    {
+        UHOS_LOGW("dns send %s failed", query->host);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       发起查询，调用者持有锁
+ */
+static uhos_net_dns_query_t *uhos_net_dns_query_start(const uhos_char *host, uhos_u32 now)
+{
+    uhos_net_dns_ctl_t   *ctl   = &g_uhos_net_dns_ctl;
+    uhos_net_dns_query_t *query = UHOS_NULL;
+
+    query = uhos_libc_zalloc(sizeof(uhos_net_dns_query_t));
+    if (UHOS_NULL == query)
+    {
+        UHOS_LOG_MEM_ALLOC_FAIL();
+        return UHOS_NULL;
+    }
+
+    uhos_libc_strncpy(query->host, host, sizeof(query->host) - 1);
+    // 随机的报文ID与每次新建socket得到的随机源端口共同抵御应答伪造
+    uhos_random_generate((uhos_u8 *)&query->id, sizeof(query->id));
+    query->server = (uhos_u8)(query->id % CONFIG_UHOS_NET_DNS_SERVER_NUM);
+    query->fd     = uhos_net_socket(UHOS_AF_INET, UHOS_SOCK_DGRAM, UHOS_IPPROTO_UDP);
+    if (query->fd < 0)
+    {
+        uhos_libc_free(query);
+        return UHOS_NULL;
+    }
+
+    if ((0 != uhos_net_dns_query_send(query, now)) ||
+        (0 != uhos_net_poller_ctl(ctl->poller, UHOS_NET_POLL_CTL_ADD, query->fd, UHOS_NET_POLL_IN, query)))
+    {
+        uhos_net_close(query->fd);
+        uhos_libc_free(query);
+        return UHOS_NULL;
+    }
+
+    query->next  = ctl->queries;
+    ctl->queries = query;
+
+    return query;
+}
+
+/**
+ * @brief       结束查询并更新缓存，调用者持有锁
+ * @param[in]   status  查询结果，UHOS_NET_DNS_OK/NOTFOUND时写入缓存
+ * @param[out]  result  合并缓存后交给回调的结果
+ * @return      需要在锁外回调并释放的等待者
+ */
+static uhos_net_dns_waiter_t *uhos_net_dns_query_finish(uhos_net_dns_query_t *query, uhos_s32 status, const uhos_u32 *ip,
+                                                        uhos_u8 num, uhos_u32 ttl, uhos_u32 now, uhos_net_dns_result_t *result)
+{
+    uhos_net_dns_ctl_t    *ctl     = &g_uhos_net_dns_ctl;
+    uhos_net_dns_query_t **pp      = &ctl->queries;
+    uhos_net_dns_entry_t  *entry   = UHOS_NULL;
+    uhos_net_dns_waiter_t *waiters = query->waiters;
+
+    while ((UHOS_NULL != *pp) && (*pp != query))
+    {
+        pp = &(*pp)->next;
+    }
+    if (UHOS_NULL != *pp)
+    {
+        *pp = query->next;
+    }
+    uhos_net_poller_ctl(ctl->poller, UHOS_NET_POLL_CTL_DEL, query->fd, 0, UHOS_NULL);
+    uhos_net_close(query->fd);
+
+    if ((UHOS_NET_DNS_OK == status) || (UHOS_NET_DNS_NOTFOUND == status))
+    {
+        entry = uhos_net_dns_cache_get(query->host, now);
+        uhos_net_dns_cache_put(entry, UHOS_NET_DNS_SRC_DNS, ip, num, ttl, now);
+        if (UHOS_NET_DNS_NOTFOUND == status)
+        {
+            entry->neg        = 1;
+            entry->neg_expire = now + ttl * 1000;
+        }
+    }
+    else
+    {
+        entry = uhos_net_dns_cache_find(query->host);
+    }
+
+    // 合并HTTP-DNS地址；查询失败时继续使用宽限期内的过期地址
+    uhos_net_dns_cache_result(entry, now, result);
+    if ((UHOS_NET_DNS_OK != result->status) && (UHOS_NET_DNS_NOTFOUND != status))
+    {
+        result->status = status;
+    }
+
+    uhos_libc_free(query);
+
+    return waiters;
+}
+
+static void uhos_net_dns_waiters_call(const uhos_char *host, uhos_net_dns_waiter_t *waiters, const uhos_net_dns_result_t *result)
+{
+    uhos_net_dns_waiter_t *waiter = UHOS_NULL;
+
+    while (UHOS_NULL != waiters)
+    {
+        waiter  = waiters;
+        waiters = waiters->next;
+        waiter->cb(host, result, waiter->arg);
+        uhos_libc_free(waiter);
+    }
+}
+
+/**
+ * @brief       应答的来源是否为本查询发送过的服务器，调用者持有锁
+ */
+static uhos_bool uhos_net_dns_from_server(const uhos_net_dns_query_t *query, const struct uhos_sockaddr_in *from)
+{
+    uhos_u8 i = 0;
+
+    if (UHOS_AF_INET != from->sin_family)
+    {
+        return UHOS_FALSE;
+    }
+
+    for (i = 0; (i < query->tries) && (i < CONFIG_UHOS_NET_DNS_TRIES); i++)
+    {
+        if ((query->sent[i].ip == from->sin_addr.s_addr) && (query->sent[i].port == uhos_net_ntohs(from->sin_port)))
+        {
+            return UHOS_TRUE;
+        }
+    }
+
+    return UHOS_FALSE;
+}
+
+/**
+ * @brief       处理可读的查询socket
+ * @note        查询只在解析线程中结束并释放，poller返回的查询一定有效
+ */
+static void uhos_net_dns_recv(uhos_net_dns_query_t *query)
+{
+    uhos_net_dns_result_t   result   = {0};
+    uhos_net_dns_waiter_t  *waiters  = UHOS_NULL;
+    struct uhos_sockaddr_in from     = {0};
+    uhos_socklen_t          from_len = sizeof(from);
+    uhos_char               host[CONFIG_UHOS_NET_DNS_NAME_LEN];
+    uhos_u8                 msg[UHOS_NET_DNS_MSG_LEN];
+    uhos_u32                ip[CONFIG_UHOS_NET_DNS_ADDR_MAX];
+    uhos_u32                ttl      = 0;
+    uhos_u32                now      = 0;
+    uhos_ssize_t            len      = 0;
+    uhos_s32                status   = 0;
+    uhos_u8                 num      = 0;
+
+    uhos_net_dns_lock();
+    len = uhos_net_recvfrom(query->fd, msg, sizeof(msg), 0, (struct uhos_sockaddr *)&from, &from_len);
+    if (len <= 0)
+    {
+        uhos_net_dns_unlock();
+        return;
+    }
+
+    // 未连接的UDP socket会收到任意来源的报文，只接受所查询服务器的应答
+    if (!uhos_net_dns_from_server(query, &from))
+    {
+        g_uhos_net_dns_ctl.stats.rejected++;
+        UHOS_LOGW("dns reply for %s from unexpected source dropped", query->host);
+        uhos_net_dns_unlock();
+        return;
+    }
+
+    status = uhos_net_dns_parse(msg, (uhos_u32)len, query, ip, &num, &ttl);
+    if (1 == status)
+    {
+        uhos_net_dns_unlock();
+        return;
+    }
+
+    // 服务器拒绝时尽快换下一个服务器重试
+    now = uhos_current_time_get();
+    if ((UHOS_NET_DNS_ERROR == status) && (query->tries < CONFIG_UHOS_NET_DNS_TRIES))
+    {
+        uhos_net_dns_query_send(query, now);
+        uhos_net_dns_unlock();
+        return;
+    }
+
+    uhos_libc_strncpy(host, query->host, sizeof(host) - 1);
+    host[sizeof(host) - 1] = '\0';
+    waiters = uhos_net_dns_query_finish(query, status, ip, num, ttl, now, &result);
+    uhos_net_dns_unlock();
+
+    uhos_net_dns_waiters_call(host, waiters, &result);
+}
+
+/**
+ * @brief       重传或结束超时的查询
+ * @return      距下一个超时时刻的毫秒数
+ */
+static uhos_s32 uhos_net_dns_timer(void)
+{
+    uhos_net_dns_result_t  result  = {0};
+    uhos_net_dns_waiter_t *waiters = UHOS_NULL;
+    uhos_net_dns_query_t  *query   = UHOS_NULL;
+    uhos_char              host[CONFIG_UHOS_NET_DNS_NAME_LEN];
+    uhos_s32               wait    = UHOS_NET_DNS_TICK_MS;
+    uhos_u32               now     = 0;
+
+    while (1)
+    {
+        uhos_net_dns_lock();
+        now   = uhos_current_time_get();
+        query = g_uhos_net_dns_ctl.queries;
+        while ((UHOS_NULL != query) && UHOS_NET_DNS_TIME_AFTER(query->deadline, now))
+        {
+            if ((uhos_s32)(query->deadline - now) < wait)
+            {
+                wait = (uhos_s32)(query->deadline - now);
+            }
+            query = query->next;
+        }
+
+        if (UHOS_NULL == query)
+        {
+            uhos_net_dns_unlock();
+            return wait;
+        }
+
+        if ((query->tries < CONFIG_UHOS_NET_DNS_TRIES) && (0 == uhos_net_dns_query_send(query, now)))
+        {
+            uhos_net_dns_unlock();
+            continue;
+        }
+
+        UHOS_LOGW("dns query %s timeout", query->host);
+        g_uhos_net_dns_ctl.stats.timeouts++;
+        uhos_libc_strncpy(host, query->host, sizeof(host) - 1);
+        host[sizeof(host) - 1] = '\0';
+        waiters = uhos_net_dns_query_finish(query, UHOS_NET_DNS_TIMEOUT, UHOS_NULL, 0, 0, now, &result);
+        uhos_net_dns_unlock();
+
+        uhos_net_dns_waiters_call(host, waiters, &result);
+    }
+}
+
+/**
+ * @brief       解析线程
+ */
+static void *uhos_net_dns_task(void *param)
+{
+    uhos_net_poll_event_t events[4];
+    uhos_s32              timeout = UHOS_NET_DNS_TICK_MS;
+    uhos_s32              num     = 0;
+    uhos_s32              i       = 0;
+    uhos_thread_t         tid     = UHOS_NULL;
+
+    (void)param;
+
+    while (g_uhos_net_dns_ctl.running)
+    {
+        num = uhos_net_poller_wait(g_uhos_net_dns_ctl.poller, events, 4, timeout);
+        for (i = 0; i < num; i++)
+        {
+            uhos_net_dns_recv((uhos_net_dns_query_t *)events[i].data);
+        }
+
+        timeout = uhos_net_dns_timer();
+    }
+
+    // 线程句柄在创建返回后才写入，退出时再读取
+    tid = g_uhos_net_dns_ctl.tid;
+    uhos_sem_release(g_uhos_net_dns_ctl.exit_sem);
+    uhos_thread_delete(tid);
+
+    return UHOS_NULL;
+}
+
+static void uhos_net_dns_sync_put(uhos_net_dns_sync_t *sync)
+{
+    if (0 == __atomic_sub_fetch(&sync->refs, 1, __ATOMIC_ACQ_REL))
+    {
+        uhos_sem_delete(sync->sem);
+        uhos_libc_free(sync);
+    }
+}
+
+static void uhos_net_dns_sync_cb(const uhos_char *host, const uhos_net_dns_result_t *result, uhos_void *arg)
+{
+    uhos_net_dns_sync_t *sync = (uhos_net_dns_sync_t *)arg;
+
+    (void)host;
+
+    sync->result = *result;
+    uhos_sem_release(sync->sem);
+    uhos_net_dns_sync_put(sync);
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_s32 uhos_net_resolver_init(const uhos_char *servers)
+{
+    uhos_net_dns_ctl_t *ctl  = &g_uhos_net_dns_ctl;
+    uhos_thread_attr_t  attr = {0};
+
+    if (ctl->running)
+    {
+        UHOS_LOGW("resolver already init");
+        return 0;
+    }
+
+    if (UHOS_NULL == ctl->mutex)
+    {
+        uhos_mutex_create(&ctl->mutex);
+    }
+
+    ctl->server_num = uhos_net_dns_server_parse(servers, ctl->server);
+    uhos_libc_memset(&ctl->stats, 0, sizeof(ctl->stats));
+
+    ctl->cache  = uhos_libc_calloc(CONFIG_UHOS_NET_DNS_CACHE_NUM, sizeof(uhos_net_dns_entry_t));
+    ctl->poller = uhos_net_poller_create(CONFIG_UHOS_NET_DNS_CACHE_NUM);
+    if ((UHOS_NULL == ctl->mutex) || (UHOS_NULL == ctl->cache) || (UHOS_NULL == ctl->poller) ||
+        (UHOS_SUCCESS != uhos_sem_create(&ctl->exit_sem, 0)))
+    {
+        goto fail;
+    }
+
+    attr.stack_size = UHOS_NET_DNS_TASK_STACK_SIZE;
+    attr.priority   = UHOS_NET_DNS_TASK_PRIORITY;
+    attr.name       = UHOS_NET_DNS_TASK_NAME;
+    ctl->running    = 1;
+    if (UHOS_SUCCESS != uhos_thread_create(&ctl->tid, uhos_net_dns_task, UHOS_NULL, &attr))
+    {
+        ctl->running = 0;
+        goto fail;
+    }
+
+    UHOS_LOGI("resolver init ok, %d servers", ctl->server_num);
+    return 0;
+
+fail:
+    UHOS_LOGE("resolver init failed");
+    if (UHOS_NULL != ctl->exit_sem)
+    {
+        uhos_sem_delete(ctl->exit_sem);
+        ctl->exit_sem = UHOS_NULL;
+    }
+    uhos_net_poller_destroy(ctl->poller);
+    ctl->poller = UHOS_NULL;
+    uhos_libc_free(ctl->cache);
+    ctl->cache = UHOS_NULL;
+
+    return -1;
+}
+
+uhos_void uhos_net_resolver_deinit(uhos_void)
+{
+    uhos_net_dns_ctl_t    *ctl    = &g_uhos_net_dns_ctl;
+    uhos_net_dns_result_t  result = {0};
+    uhos_net_dns_waiter_t *waiters = UHOS_NULL;
+    uhos_char              host[CONFIG_UHOS_NET_DNS_NAME_LEN];
+
+    if (!ctl->running)
+    {
+        return;
+    }
+
+    // 持锁清除，此后持锁的接口都能看到解析器已停止
+    uhos_net_dns_lock();
+    ctl->running = 0;
+    uhos_net_dns_unlock();
+
+    uhos_sem_wait(ctl->exit_sem, UHOS_SEM_WAIT_FOREVER);
+    uhos_sem_delete(ctl->exit_sem);
+    ctl->exit_sem = UHOS_NULL;
+    ctl->tid      = UHOS_NULL;
+
+    uhos_net_dns_lock();
+    while (UHOS_NULL != ctl->queries)
+    {
+        uhos_libc_strncpy(host, ctl->queries->host, sizeof(host) - 1);
+        host[sizeof(host) - 1] = '\0';
+        waiters = uhos_net_dns_query_finish(ctl->queries, UHOS_NET_DNS_ERROR, UHOS_NULL, 0, 0,
+                                            uhos_current_time_get(), &result);
+        uhos_net_dns_unlock();
+        uhos_net_dns_waiters_call(host, waiters, &result);
+        uhos_net_dns_lock();
+    }
+
+    uhos_net_poller_destroy(ctl->poller);
+    ctl->poller = UHOS_NULL;
+    uhos_libc_free(ctl->cache);
+    ctl->cache = UHOS_NULL;
+    uhos_net_dns_unlock();
+
+    UHOS_LOGI("resolver deinit");
+}
+
+uhos_s32 uhos_net_resolve_async(const uhos_char *host, uhos_net_dns_cb_t cb, uhos_void *arg)
+{
+    uhos_net_dns_ctl_t    *ctl    = &g_uhos_net_dns_ctl;
+    uhos_net_dns_result_t  result = {0};
+    uhos_net_dns_query_t  *query  = UHOS_NULL;
+    uhos_net_dns_waiter_t *waiter = UHOS_NULL;
+    uhos_u32               now    = 0;
+    uhos_u32               ip     = 0;
+
+    if ((UHOS_NULL == host) || (UHOS_NULL == cb) || ('\0' == host[0]) ||
+        (uhos_libc_strlen(host) >= CONFIG_UHOS_NET_DNS_NAME_LEN))
+    {
+        return -1;
+    }
+
+    // IP地址字面量无需查询
+    ip = uhos_net_inet_addr(host);
+    if (0xFFFFFFFF != ip)
+    {
+        result.status         = UHOS_NET_DNS_OK;
+        result.num            = 1;
+        result.addr[0].s_addr = ip;
+        cb(host, &result, arg);
+        return 0;
+    }
+
+    if (!ctl->running)
+    {
+        return -1;
+    }
+
+    uhos_net_dns_lock();
+    if (!uhos_net_dns_ready())
+    {
+        uhos_net_dns_unlock();
+        return -1;
+    }
+
+    now = uhos_current_time_get();
+    if (!uhos_net_dns_cache_result(uhos_net_dns_cache_find(host), now, &result) ||
+        (UHOS_NET_DNS_OK == result.status))
+    {
+        if (result.stale)
+        {
+            // 后台刷新，合并到进行中的查询
+            ctl->stats.stale_hits++;
+            if (UHOS_NULL == uhos_net_dns_query_find(host))
+            {
+                uhos_net_dns_query_start(host, now);
+            }
+        }
+        else if (UHOS_NET_DNS_OK == result.status)
+        {
+            ctl->stats.hits++;
+        }
+        else
+        {
+            ctl->stats.neg_hits++;
+        }
+        uhos_net_dns_unlock();
+
+        cb(host, &result, arg);
+        return 0;
+    }
+
+    waiter = uhos_libc_zalloc(sizeof(uhos_net_dns_waiter_t));
+    if (UHOS_NULL == waiter)
+    {
+        uhos_net_dns_unlock();
+        UHOS_LOG_MEM_ALLOC_FAIL();
+        return -1;
+    }
+    waiter->cb  = cb;
+    waiter->arg = arg;
+
+    query = uhos_net_dns_query_find(host);
+    if (UHOS_NULL != query)
+    {
+        ctl->stats.merged++;
+    }
+    else
+    {
+        ctl->stats.misses++;
+        query = uhos_net_dns_query_start(host, now);
+        if (UHOS_NULL == query)
+        {
+            uhos_net_dns_unlock();
+            uhos_libc_free(waiter);
+            return -1;
+        }
+    }
+    waiter->next   = query->waiters;
+    query->waiters = waiter;
+    uhos_net_dns_unlock();
+
+    return 1;
+}
+
+uhos_s32 uhos_net_resolve(const uhos_char *host, uhos_net_dns_result_t *result, uhos_u32 timeout_ms)
+{
+    uhos_net_dns_sync_t *sync = UHOS_NULL;
+    uhos_s32             ret  = 0;
+
+    if (UHOS_NULL == result)
+    {
+        return UHOS_NET_DNS_ERROR;
+    }
+    uhos_libc_memset(result, 0, sizeof(uhos_net_dns_result_t));
+    result->status = UHOS_NET_DNS_ERROR;
+
+    sync = uhos_libc_zalloc(sizeof(uhos_net_dns_sync_t));
+    if ((UHOS_NULL == sync) || (UHOS_SUCCESS != uhos_sem_create(&sync->sem, 0)))
+    {
+        uhos_libc_free(sync);
+        return UHOS_NET_DNS_ERROR;
+    }
+    sync->refs = 2;
+
+    ret = uhos_net_resolve_async(host, uhos_net_dns_sync_cb, sync);
+    if (ret < 0)
+    {
+        uhos_sem_delete(sync->sem);
+        uhos_libc_free(sync);
+        return UHOS_NET_DNS_ERROR;
+    }
+
+    if (UHOS_SUCCESS == uhos_sem_wait(sync->sem, timeout_ms))
+    {
+        *result = sync->result;
+    }
+    else
+    {
+        result->status = UHOS_NET_DNS_TIMEOUT;
+    }
+    uhos_net_dns_sync_put(sync);
+
+    return result->status;
+}
+
+uhos_s32 uhos_net_resolver_httpdns_update(const uhos_char *host, const struct uhos_in_addr *addr, uhos_u8 num, uhos_u32 ttl_sec)
+{
+    uhos_u32 ip[CONFIG_UHOS_NET_DNS_ADDR_MAX];
+    uhos_u32 now = 0;
+    uhos_u8  i   = 0;
+
+    if ((UHOS_NULL == host) || ((num > 0) && (UHOS_NULL == addr)) ||
+        (uhos_libc_strlen(host) >= CONFIG_UHOS_NET_DNS_NAME_LEN) || !g_uhos_net_dns_ctl.running)
+    {
+        return -1;
+    }
+
+    num = (num < CONFIG_UHOS_NET_DNS_ADDR_MAX) ? num : CONFIG_UHOS_NET_DNS_ADDR_MAX;
+    for (i = 0; i < num; i++)
+    {
+        ip[i] = addr[i].s_addr;
+    }
+
+    uhos_net_dns_lock();
+    if (!uhos_net_dns_ready())
+    {
+        uhos_net_dns_unlock();
+        return -1;
+    }
+
+    now = uhos_current_time_get();
+    uhos_net_dns_cache_put(uhos_net_dns_cache_get(host, now), UHOS_NET_DNS_SRC_HTTP, ip, num,
+                           uhos_net_dns_clamp(ttl_sec, 1, CONFIG_UHOS_NET_DNS_TTL_MAX), now);
+    uhos_net_dns_unlock();
+
+    return 0;
+}
+
+uhos_void uhos_net_resolver_flush(const uhos_char *host)
+{
+    uhos_net_dns_entry_t *entry = UHOS_NULL;
+
+    if (!g_uhos_net_dns_ctl.running)
+    {
+        return;
+    }
+
+    uhos_net_dns_lock();
+    if (!uhos_net_dns_ready())
+    {
+        uhos_net_dns_unlock();
+        return;
+    }
+
+    if (UHOS_NULL == host)
+    {
+        uhos_libc_memset(g_uhos_net_dns_ctl.cache, 0, CONFIG_UHOS_NET_DNS_CACHE_NUM * sizeof(uhos_net_dns_entry_t));
+    }
+    else if (UHOS_NULL != (entry = uhos_net_dns_cache_find(host)))
+    {
+        uhos_libc_memset(entry, 0, sizeof(uhos_net_dns_entry_t));
+    }
+    uhos_net_dns_unlock();
+}
+
+uhos_s32 uhos_net_resolver_stats_get(uhos_net_resolver_stats_t *stats)
+{
+    if ((UHOS_NULL == stats) || (UHOS_NULL == g_uhos_net_dns_ctl.mutex))
+    {
+        return -1;
+    }
+
+    uhos_net_dns_lock();
+    *stats = g_uhos_net_dns_ctl.stats;
+    uhos_net_dns_unlock();
+
+    return 0;
+}
@@ -0,0 +1,433 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_net_dns_bench.c
+ * @author agent (agent@local)
+ * @brief 域名解析缓存对重连耗时影响的基准测试功能实现
+ * @details 桩DNS服务器在回环地址上按用例的时延应答A记录（127.0.0.1），模拟上游DNS；
+ *          每次重连计时uhos_net_resolve与TCP建连之和。缓存未命中的用例每次重连前清除该域名，
+ *          与按次调用uhos_net_getaddrinfo的旧流程等价；缓存命中的用例预先解析一次
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：域名解析缓存对重连耗时影响的基准测试功能实现
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>输出与计时改用uh_bench.h
+ * </table>
+ */
+
+#define LOG_TAG "dns-bench"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_osal.h"
+#include "uh_log.h"
+#include "uh_al_net.h"
+#include "uh_bench.h"
+
+#include "uh_net_dns_bench.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define UHOS_NET_DNS_BENCH_HOST             "bench.example"
+#define UHOS_NET_DNS_BENCH_TTL              300
+#define UHOS_NET_DNS_BENCH_TIMEOUT_MS       5000
+
+#define UHOS_NET_DNS_BENCH_TASK_NAME        "dns_bench"
+#define UHOS_NET_DNS_BENCH_TASK_STACK_SIZE  3 * 1024
+#define UHOS_NET_DNS_BENCH_TASK_PRIORITY    5
+
+#define UHOS_NET_DNS_BENCH_MSG_LEN          512
+#define UHOS_NET_DNS_BENCH_HDR_LEN          12
+#define UHOS_NET_DNS_BENCH_ANSWER_LEN       16
+
+// JSON行的最大长度
+#define UHOS_NET_DNS_BENCH_JSON_LEN         256
+
+#define UHOS_NET_DNS_BENCH_ARRAY_NUM(a)     (sizeof(a) / sizeof((a)[0]))
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      桩DNS服务器
+ */
+typedef struct
+{
+    uhos_s32                fd;
+    struct uhos_sockaddr_in addr;                               //<! 绑定的回环地址与端口
+    uhos_thread_t           tid;
+    uhos_sem_t              exit_sem;                           //<! 服务线程已退出循环
+    volatile uhos_u8        running;
+    uhos_u32                delay_ms;
+    uhos_u32                queries;
+} uhos_net_dns_bench_srv_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_net_dns_bench_srv_t g_uhos_net_dns_bench_srv;
+static const uhos_u32           g_uhos_net_dns_bench_delays[] = {0, 20, 100};
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       把查询改写为只含一条A记录的应答
+ * @return      应答长度，-1表示不是可应答的查询
+ */
+static uhos_s32 uhos_net_dns_bench_answer(uhos_u8 *msg, uhos_s32 len)
+{
+    // 指向问题区域名（偏移12）的压缩指针，TYPE A，CLASS IN，TTL，RDLENGTH 4，127.0.0.1
+    static const uhos_u8 answer[UHOS_NET_DNS_BENCH_ANSWER_LEN] = {
+        0xC0, 0x0C, 0x00, 0x01, 0x00, 0x01,
+        (UHOS_NET_DNS_BENCH_TTL >> 24) & 0xFF, (UHOS_NET_DNS_BENCH_TTL >> 16) & 0xFF,
+        (UHOS_NET_DNS_BENCH_TTL >> 8) & 0xFF, UHOS_NET_DNS_BENCH_TTL & 0xFF,
+        0x00, 0x04, 127, 0, 0, 1};
+    uhos_s32 pos = UHOS_NET_DNS_BENCH_HDR_LEN;
+
+    if (len <= UHOS_NET_DNS_BENCH_HDR_LEN)
+    {
+        return -1;
+    }
+
+    while ((pos < len) && (0 != msg[pos]))
+    {
+        pos += msg[pos] + 1;
+    }
+    pos += 5;                                                   // 结束符、QTYPE、QCLASS
+    if ((pos > len) || (pos + UHOS_NET_DNS_BENCH_ANSWER_LEN > UHOS_NET_DNS_BENCH_MSG_LEN))
+    {
+        return -1;
+    }
+
+    msg[2]  = 0x81;                                             // QR、RD
+    msg[3]  = 0x80;                                             // RA，RCODE 0
+    msg[6]  = 0;
+    msg[7]  = 1;                                                // ANCOUNT
+    msg[8]  = 0;
+    msg[9]  = 0;
+    msg[10] = 0;
+    msg[11] = 0;
+    uhos_libc_memcpy(&msg[pos], answer, UHOS_NET_DNS_BENCH_ANSWER_LEN);
+
+    return pos + UHOS_NET_DNS_BENCH_ANSWER_LEN;
+}
+
+/**
+ * @brief       桩DNS服务线程
+ */
+static void *uhos_net_dns_bench_srv_task(void *param)
+{
+    uhos_net_dns_bench_srv_t *srv = (uhos_net_dns_bench_srv_t *)param;
+    struct uhos_sockaddr_in   from;
+    uhos_socklen_t            from_len = 0;
+    uhos_u8                   msg[UHOS_NET_DNS_BENCH_MSG_LEN];
+    uhos_ssize_t              len      = 0;
+    uhos_s32                  rsp_len  = 0;
+    uhos_thread_t             tid      = UHOS_NULL;
+
+    while (srv->running)
+    {
+        from_len = sizeof(from);
+        len      = uhos_net_recvfrom(srv->fd, msg, sizeof(msg), 0, (struct uhos_sockaddr *)&from, &from_len);
+        if (!srv->running)
+        {
+            break;
+        }
+        rsp_len = uhos_net_dns_bench_answer(msg, (uhos_s32)len);
+        if (rsp_len < 0)
+        {
+            continue;
+        }
+
+        srv->queries++;
+        if (srv->delay_ms > 0)
+        {
+            uhos_thread_sleep(srv->delay_ms);
+        }
+        uhos_net_sendto(srv->fd, msg, rsp_len, 0, (struct uhos_sockaddr *)&from, from_len);
+    }
+
+    // 线程句柄在创建返回后才写入，退出时再读取
+    tid = srv->tid;
+    uhos_sem_release(srv->exit_sem);
+    uhos_thread_delete(tid);
+
+    return UHOS_NULL;
+}
+
+/**
+ * @brief       在回环地址的临时端口上创建socket
+ * @return      socket，-1表示失败
+ */
+static uhos_s32 uhos_net_dns_bench_bind(uhos_s32 type, struct uhos_sockaddr_in *addr)
+{
+    uhos_socklen_t len = sizeof(struct uhos_sockaddr_in);
+    uhos_s32       fd  = uhos_net_socket(UHOS_AF_INET, type, 0);
+
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    uhos_libc_memset(addr, 0, sizeof(struct uhos_sockaddr_in));
+    addr->sin_family      = UHOS_AF_INET;
+    addr->sin_addr.s_addr = uhos_net_htonl(UHOS_INADDR_LOOPBACK);
+    if ((0 != uhos_net_bind(fd, (struct uhos_sockaddr *)addr, sizeof(struct uhos_sockaddr_in))) ||
+        (0 != uhos_net_getsockname(fd, (struct uhos_sockaddr *)addr, &len)))
+    {
+        uhos_net_close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+/**
+ * @brief       启动桩DNS服务器
+ * @return      0-成功，-1-失败
+ */
+static uhos_s32 uhos_net_dns_bench_srv_start(uhos_u32 delay_ms)
+{
+    uhos_net_dns_bench_srv_t *srv  = &g_uhos_net_dns_bench_srv;
+    uhos_thread_attr_t        attr = {0};
+
+    uhos_libc_memset(srv, 0, sizeof(uhos_net_dns_bench_srv_t));
+    srv->delay_ms = delay_ms;
+    srv->running  = 1;
+
+    srv->fd = uhos_net_dns_bench_bind(UHOS_SOCK_DGRAM, &srv->addr);
+    if (srv->fd < 0)
+    {
+        return -1;
+    }
+    if (UHOS_SUCCESS != uhos_sem_create(&srv->exit_sem, 0))
+    {
+        uhos_net_close(srv->fd);
+        return -1;
+    }
+
+    attr.stack_size = UHOS_NET_DNS_BENCH_TASK_STACK_SIZE;
+    attr.priority   = UHOS_NET_DNS_BENCH_TASK_PRIORITY;
+    attr.name       = UHOS_NET_DNS_BENCH_TASK_NAME;
+    if (UHOS_SUCCESS != uhos_thread_create(&srv->tid, uhos_net_dns_bench_srv_task, srv, &attr))
+    {
+        uhos_sem_delete(srv->exit_sem);
+        uhos_net_close(srv->fd);
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       停止桩DNS服务器，向其发送一个空报文唤醒阻塞的接收
+ */
+static uhos_void uhos_net_dns_bench_srv_stop(uhos_void)
+{
+    uhos_net_dns_bench_srv_t *srv  = &g_uhos_net_dns_bench_srv;
+    uhos_u8                   wake = 0;
+    uhos_s32                  fd   = uhos_net_socket(UHOS_AF_INET, UHOS_SOCK_DGRAM, 0);
+
+    srv->running = 0;
+    if (fd >= 0)
+    {
+        uhos_net_sendto(fd, &wake, sizeof(wake), 0, (struct uhos_sockaddr *)&srv->addr, sizeof(srv->addr));
+        uhos_net_close(fd);
+    }
+
+    uhos_sem_wait(srv->exit_sem, UHOS_SEM_WAIT_FOREVER);
+    uhos_sem_delete(srv->exit_sem);
+    uhos_net_close(srv->fd);
+}
+
+/**
+ * @brief       解析并连接到监听端口，计一次重连耗时
+ * @return      0-成功，-1-失败
+ */
+static uhos_s32 uhos_net_dns_bench_reconnect(uhos_s32 listen_fd, uhos_u16 port, uhos_u32 *elapsed_us)
+{
+    uhos_net_dns_result_t   dns   = {0};
+    struct uhos_sockaddr_in addr  = {0};
+    uhos_u32                start = uhos_bench_now_us();
+    uhos_s32                fd    = -1;
+    uhos_s32                ret   = -1;
+
+    if ((UHOS_NET_DNS_OK != uhos_net_resolve(UHOS_NET_DNS_BENCH_HOST, &dns, UHOS_NET_DNS_BENCH_TIMEOUT_MS)) || (0 == dns.num))
+    {
+        return -1;
+    }
+
+    fd = uhos_net_socket(UHOS_AF_INET, UHOS_SOCK_STREAM, 0);
+    if (fd < 0)
+    {
+        return -1;
+    }
+    addr.sin_family = UHOS_AF_INET;
+    addr.sin_port   = port;
+    addr.sin_addr   = dns.addr[0];
+    if (0 == uhos_net_connect(fd, (struct uhos_sockaddr *)&addr, sizeof(addr)))
+    {
+        *elapsed_us = uhos_bench_now_us() - start;
+        ret         = 0;
+    }
+    uhos_net_close(fd);
+
+    // 已完成握手的连接在监听队列中，取出后关闭
+    if (0 == ret)
+    {
+        fd = uhos_net_accept(listen_fd, UHOS_NULL, UHOS_NULL);
+        if (fd >= 0)
+        {
+            uhos_net_close(fd);
+        }
+    }
+
+    return ret;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_s32 uhos_net_dns_bench_run(const uhos_net_dns_bench_case_t *bcase, uhos_net_dns_bench_result_t *result)
+{
+    struct uhos_sockaddr_in listen_addr = {0};
+    uhos_char               servers[24];
+    uhos_u64                total       = 0;
+    uhos_u32                elapsed     = 0;
+    uhos_s32                listen_fd   = -1;
+    uhos_u32                i           = 0;
+
+    if ((UHOS_NULL == bcase) || (UHOS_NULL == result))
+    {
+        return -1;
+    }
+
+    uhos_libc_memset(result, 0, sizeof(uhos_net_dns_bench_result_t));
+    result->status = -1;
+
+    if (0 != uhos_net_dns_bench_srv_start(bcase->delay_ms))
+    {
+        UHOS_LOGE("stub dns server start failed");
+        return -1;
+    }
+    uhos_libc_snprintf(servers, sizeof(servers), "127.0.0.1:%u", (unsigned)uhos_net_ntohs(g_uhos_net_dns_bench_srv.addr.sin_port));
+    if (0 != uhos_net_resolver_init(servers))
+    {
+        UHOS_LOGE("resolver init failed, already initialized?");
+        uhos_net_dns_bench_srv_stop();
+        return -1;
+    }
+
+    listen_fd = uhos_net_dns_bench_bind(UHOS_SOCK_STREAM, &listen_addr);
+    if ((listen_fd < 0) || (0 != uhos_net_listen(listen_fd, 4)))
+    {
+        goto exit;
+    }
+
+    if (bcase->cached && (0 != uhos_net_dns_bench_reconnect(listen_fd, listen_addr.sin_port, &elapsed)))
+    {
+        goto exit;
+    }
+
+    for (i = 0; i < bcase->runs; i++)
+    {
+        if (!bcase->cached)
+        {
+            uhos_net_resolver_flush(UHOS_NET_DNS_BENCH_HOST);
+        }
+        if (0 != uhos_net_dns_bench_reconnect(listen_fd, listen_addr.sin_port, &elapsed))
+        {
+            goto exit;
+        }
+        total += elapsed;
+        if (elapsed > result->max_us)
+        {
+            result->max_us = elapsed;
+        }
+        result->runs++;
+    }
+    result->status = 0;
+
+exit:
+    if (result->runs > 0)
+    {
+        result->avg_us = (uhos_u32)(total / result->runs);
+    }
+    if (0 != result->status)
+    {
+        UHOS_LOGE("bench %s delay %u failed after %u runs", bcase->cached ? "cached" : "uncached",
+                  (unsigned)bcase->delay_ms, (unsigned)result->runs);
+    }
+    if (listen_fd >= 0)
+    {
+        uhos_net_close(listen_fd);
+    }
+    uhos_net_resolver_deinit();
+    uhos_net_dns_bench_srv_stop();
+    result->queries = g_uhos_net_dns_bench_srv.queries;
+
+    return result->status;
+}
+
+uhos_s32 uhos_net_dns_bench_result_json(const uhos_net_dns_bench_case_t *bcase, const uhos_net_dns_bench_result_t *result,
+                                        uhos_char *buf, uhos_u32 size)
+{
+    uhos_bench_json_t json = {0};
+
+    if ((UHOS_NULL == bcase) || (UHOS_NULL == result) || (UHOS_NULL == buf))
+    {
+        return 0;
+    }
+
+    uhos_bench_json_begin(&json, buf, size);
+    uhos_bench_json_str(&json, "cache", bcase->cached ? "cached" : "uncached");
+    uhos_bench_json_u32(&json, "delay_ms", bcase->delay_ms);
+    uhos_bench_json_status(&json, result->status);
+    uhos_bench_json_u32(&json, "runs", result->runs);
+    uhos_bench_json_u32(&json, "avg_us", result->avg_us);
+    uhos_bench_json_u32(&json, "max_us", result->max_us);
+    uhos_bench_json_u32(&json, "queries", result->queries);
+
+    return uhos_bench_json_end(&json);
+}
+
+uhos_s32 uhos_net_dns_bench_matrix_run(uhos_bench_print_t print)
+{
+    uhos_net_dns_bench_case_t   bcase  = {0};
+    uhos_net_dns_bench_result_t result = {0};
+    uhos_char                   line[UHOS_NET_DNS_BENCH_JSON_LEN];
+    uhos_s32                    ret    = 0;
+    uhos_u32                    d      = 0;
+    uhos_u8                     cached = 0;
+
+    if (UHOS_NULL == print)
+    {
+        return -1;
+    }
+
+    bcase.runs = CONFIG_UHOS_NET_DNS_BENCH_RUNS;
+
+    for (d = 0; d < UHOS_NET_DNS_BENCH_ARRAY_NUM(g_uhos_net_dns_bench_delays); d++)
+    {
+        for (cached = 0; cached < 2; cached++)
+        {
+            bcase.cached   = cached;
+            bcase.delay_ms = g_uhos_net_dns_bench_delays[d];
+
+            if (0 != uhos_net_dns_bench_run(&bcase, &result))
+            {
+                ret = -1;
+            }
+            uhos_net_dns_bench_result_json(&bcase, &result, line, sizeof(line));
+            print(line);
+        }
+    }
+
+    return ret;
+}
@@ -0,0 +1,532 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file linux_posix.c
+ * @author agent (agent@local)
+ * @brief 基于POSIX线程库的OS适配层实现，用于在Linux主机上运行与测试SDK
+ * @details 线程、信号量、互斥体分别基于pthread、条件变量与递归互斥体实现；
+ *          uhos_current_time_get基于CLOCK_MONOTONIC，不受系统授时影响
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：基于POSIX线程库的OS适配层实现，用于在Linux主机上运行与测试SDK
+ * </table>
+ */
+
+#define LOG_TAG "linux_os"
+
+// pthread_setname_np为GNU扩展，须在包含任何系统头文件之前定义
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "uh_types.h"
+#include "uh_osal.h"
+#include "uh_log.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define LINUX_POSIX_THREAD_NAME_LEN 16
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      线程控制块
+ */
+struct uhos_thread_s
+{
+    pthread_t tid;                                              //<! pthread线程ID
+    void *(*entry)(void *);                                     //<! 线程函数
+    void     *arg;                                              //<! 线程参数
+    uhos_char name[LINUX_POSIX_THREAD_NAME_LEN];                //<! 线程名称
+};
+
+/**
+ * @struct      计数信号量
+ */
+struct uhos_sem_s
+{
+    pthread_mutex_t lock;                                       //<! 保护count
+    pthread_cond_t  cond;                                       //<! 等待count非零
+    uhos_u32        count;                                      //<! 可用标记数
+};
+
+/**
+ * @struct      递归互斥体
+ */
+struct uhos_mutex_s
+{
+    pthread_mutex_t lock;                                       //<! 递归互斥体
+};
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static pthread_key_t  g_linux_posix_thread_key;                 //<! 当前线程的控制块
+static pthread_once_t g_linux_posix_thread_once = PTHREAD_ONCE_INIT;
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static void linux_posix_thread_key_init(void)
+{
+    pthread_key_create(&g_linux_posix_thread_key, UHOS_NULL);
+}
+
+static void *linux_posix_thread_entry(void *arg)
+{
+    struct uhos_thread_s *thread = (struct uhos_thread_s *)arg;
+
+    pthread_setspecific(g_linux_posix_thread_key, thread);
+
+    return thread->entry(thread->arg);
+}
+
+/**
+ * @brief       计算从现在开始millisec毫秒后的CLOCK_MONOTONIC绝对时间
+ */
+static void linux_posix_deadline(struct timespec *ts, uhos_u32 millisec)
+{
+    clock_gettime(CLOCK_MONOTONIC, ts);
+
+    ts->tv_sec  += millisec / 1000;
+    ts->tv_nsec += (long)(millisec % 1000) * 1000000L;
+    if (ts->tv_nsec >= 1000000000L)
+    {
+        ts->tv_sec  += 1;
+        ts->tv_nsec -= 1000000000L;
+    }
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+/****************OS-TIME*********************/
+
+uhos_time_t uhos_time(uhos_time_t *in_time)
+{
+    uhos_time_t now = (uhos_time_t)time(UHOS_NULL);
+
+    if (in_time)
+    {
+        *in_time = now;
+    }
+
+    return now;
+}
+
+struct uhos_tm *uhos_gmtime(const uhos_time_t *in_time)
+{
+    static struct uhos_tm out;
+    struct tm             tm  = {0};
+    time_t                sec = (time_t)*in_time;
+
+    gmtime_r(&sec, &tm);
+
+    out.tm_sec   = tm.tm_sec;
+    out.tm_min   = tm.tm_min;
+    out.tm_hour  = tm.tm_hour;
+    out.tm_mday  = tm.tm_mday;
+    out.tm_mon   = tm.tm_mon;
+    out.tm_year  = tm.tm_year;
+    out.tm_wday  = tm.tm_wday;
+    out.tm_yday  = tm.tm_yday;
+    out.tm_isdst = tm.tm_isdst;
+
+    return &out;
+}
+
+struct uhos_tm *uhos_localtime(const uhos_time_t *in_time)
+{
+    static struct uhos_tm out;
+    struct tm             tm  = {0};
+    time_t                sec = (time_t)*in_time;
+
+    localtime_r(&sec, &tm);
+
+    out.tm_sec   = tm.tm_sec;
+    out.tm_min   = tm.tm_min;
+    out.tm_hour  = tm.tm_hour;
+    out.tm_mday  = tm.tm_mday;
+    out.tm_mon   = tm.tm_mon;
+    out.tm_year  = tm.tm_year;
+    out.tm_wday  = tm.tm_wday;
+    out.tm_yday  = tm.tm_yday;
+    out.tm_isdst = tm.tm_isdst;
+
+    return &out;
+}
+
+uhos_s32 uhos_gettimeofday(struct uhos_timeval *tv, struct uhos_timezone *tz)
+{
+    struct timeval now;
+
+    if (UHOS_NULL == tv)
+    {
+        return (-1);
+    }
+
+    gettimeofday(&now, UHOS_NULL);
+    tv->tv_sec  = (uhos_s32)now.tv_sec;
+    tv->tv_usec = (uhos_s32)now.tv_usec;
+
+    if (tz)
+    {
+        tz->tz_minuteswest = 0;
+        tz->tz_dsttime     = 0;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief 当前硬件启动后的计数毫秒数， 此数值在启动后持续增长，不受授时等操作影响
+ * @return 自启动的毫秒数
+ */
+uhos_u32 uhos_current_time_get(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uhos_u32)((uhos_u64)ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+uhos_s32 uhos_real_time_get(struct uhos_timespec *real_time)
+{
+    struct timespec ts;
+
+    if (UHOS_NULL == real_time)
+    {
+        return UHOS_FAILURE;
+    }
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    real_time->tv_sec  = (uhos_s32)ts.tv_sec;
+    real_time->tv_nsec = (uhos_s32)ts.tv_nsec;
+
+    return UHOS_SUCCESS;
+}
+
+/****************OS-THREAD*********************/
+
+/**
+ * @brief 线程创建
+ * @note  线程以分离状态运行；stack_size为0时使用系统默认值，优先级被忽略
+ */
+uhos_s32 uhos_thread_create(uhos_thread_t *thread, void *(*startroutine)(void *), void *arg, const uhos_thread_attr_t *attr)
+{
+    struct uhos_thread_s *th = UHOS_NULL;
+    pthread_attr_t        pattr;
+
+    if ((UHOS_NULL == thread) || (UHOS_NULL == startroutine))
+    {
+        return UHOS_FAILURE;
+    }
+
+    pthread_once(&g_linux_posix_thread_once, linux_posix_thread_key_init);
+
+    th = calloc(1, sizeof(struct uhos_thread_s));
+    if (UHOS_NULL == th)
+    {
+        return UHOS_FAILURE;
+    }
+
+    th->entry = startroutine;
+    th->arg   = arg;
+    if (attr && attr->name)
+    {
+        strncpy(th->name, attr->name, sizeof(th->name) - 1);
+    }
+
+    pthread_attr_init(&pattr);
+    pthread_attr_setdetachstate(&pattr, PTHREAD_CREATE_DETACHED);
+    if (attr && (attr->stack_size >= PTHREAD_STACK_MIN))
+    {
+        pthread_attr_setstacksize(&pattr, attr->stack_size);
+    }
+
+    if (0 != pthread_create(&th->tid, &pattr, linux_posix_thread_entry, th))
+    {
+        pthread_attr_destroy(&pattr);
+        free(th);
+        return UHOS_FAILURE;
+    }
+
+    pthread_attr_destroy(&pattr);
+    pthread_setname_np(th->tid, th->name[0] ? th->name : "uhos");
+
+    *thread = th;
+
+    return UHOS_SUCCESS;
+}
+
+/**
+ * @brief 终止线程的执行并将其从活动线程中删除
+ * @note  删除其他线程时，在该线程的下一个取消点生效
+ */
+uhos_s32 uhos_thread_delete(uhos_thread_t thread)
+{
+    if (UHOS_NULL == thread)
+    {
+        pthread_exit(UHOS_NULL);
+    }
+
+    if (pthread_equal(thread->tid, pthread_self()))
+    {
+        free(thread);
+        pthread_exit(UHOS_NULL);
+    }
+
+    pthread_cancel(thread->tid);
+    free(thread);
+
+    return UHOS_SUCCESS;
+}
+
+uhos_thread_t uhos_thread_getid(void)
+{
+    pthread_once(&g_linux_posix_thread_once, linux_posix_thread_key_init);
+
+    return (uhos_thread_t)pthread_getspecific(g_linux_posix_thread_key);
+}
+
+uhos_u64 uhos_thread_gettid(void)
+{
+    return (uhos_u64)syscall(SYS_gettid);
+}
+
+const uhos_char *uhos_thread_get_name(uhos_thread_t thread)
+{
+    return thread ? thread->name : UHOS_NULL;
+}
+
+uhos_s32 uhos_thread_sleep(uhos_u32 milliseconds)
+{
+    struct timespec ts;
+
+    ts.tv_sec  = milliseconds / 1000;
+    ts.tv_nsec = (long)(milliseconds % 1000) * 1000000L;
+
+    while ((0 != nanosleep(&ts, &ts)) && (EINTR == errno))
+    {
+    }
+
+    return UHOS_SUCCESS;
+}
+
+/****************OS-SEMAPHORE*********************/
+
+uhos_s32 uhos_sem_create(uhos_sem_t *sem, uhos_u32 initial_count)
+{
+    struct uhos_sem_s *s = UHOS_NULL;
+    pthread_condattr_t cattr;
+
+    if (UHOS_NULL == sem)
+    {
+        return UHOS_FAILURE;
+    }
+
+    s = calloc(1, sizeof(struct uhos_sem_s));
+    if (UHOS_NULL == s)
+    {
+        return UHOS_FAILURE;
+    }
+
+    pthread_condattr_init(&cattr);
+    pthread_condattr_setclock(&cattr, CLOCK_MONOTONIC);
+    pthread_cond_init(&s->cond, &cattr);
+    pthread_condattr_destroy(&cattr);
+    pthread_mutex_init(&s->lock, UHOS_NULL);
+    s->count = initial_count;
+
+    *sem = s;
+
+    return UHOS_SUCCESS;
+}
+
+uhos_s32 uhos_sem_delete(uhos_sem_t sem)
+{
+    if (UHOS_NULL == sem)
+    {
+        return UHOS_FAILURE;
+    }
+
+    pthread_cond_destroy(&sem->cond);
+    pthread_mutex_destroy(&sem->lock);
+    free(sem);
+
+    return UHOS_SUCCESS;
+}
+
+uhos_u32 uhos_sem_count(uhos_sem_t sem)
+{
+    uhos_u32 count = 0;
+
+    pthread_mutex_lock(&sem->lock);
+    count = sem->count;
+    pthread_mutex_unlock(&sem->lock);
+
+    return count;
+}
+
+/**
+ * @return uhos_s32         0 : 成功
+ *                          -1: 失败
+ *                          110: 超时
+ */
+uhos_s32 uhos_sem_wait(uhos_sem_t sem, uhos_u32 millisec)
+{
+    struct timespec deadline;
+    uhos_s32        ret = UHOS_SUCCESS;
+
+    if (UHOS_NULL == sem)
+    {
+        return UHOS_FAILURE;
+    }
+
+    if (UHOS_SEM_WAIT_FOREVER != millisec)
+    {
+        linux_posix_deadline(&deadline, millisec);
+    }
+
+    pthread_mutex_lock(&sem->lock);
+
+    while (0 == sem->count)
+    {
+        if (UHOS_SEM_WAIT_FOREVER == millisec)
+        {
+            pthread_cond_wait(&sem->cond, &sem->lock);
+        }
+        else if (ETIMEDOUT == pthread_cond_timedwait(&sem->cond, &sem->lock, &deadline))
+        {
+            ret = UHOS_SEM_TIME_OUT;
+            break;
+        }
+    }
+
+    if (UHOS_SUCCESS == ret)
+    {
+        sem->count--;
+    }
+
+    pthread_mutex_unlock(&sem->lock);
+
+    return ret;
+}
+
+uhos_s32 uhos_sem_release(uhos_sem_t sem)
+{
+    if (UHOS_NULL == sem)
+    {
+        return UHOS_FAILURE;
+    }
+
+    pthread_mutex_lock(&sem->lock);
+    sem->count++;
+    pthread_cond_signal(&sem->cond);
+    pthread_mutex_unlock(&sem->lock);
+
+    return UHOS_SUCCESS;
+}
+
+/****************OS-MUTEX*********************/
+
+uhos_s32 uhos_mutex_create(uhos_mutex_t *mutex)
+{
+    struct uhos_mutex_s *m = UHOS_NULL;
+    pthread_mutexattr_t  mattr;
+
+    if (UHOS_NULL == mutex)
+    {
+        return UHOS_FAILURE;
+    }
+
+    m = calloc(1, sizeof(struct uhos_mutex_s));
+    if (UHOS_NULL == m)
+    {
+        return UHOS_FAILURE;
+    }
+
+    pthread_mutexattr_init(&mattr);
+    pthread_mutexattr_settype(&mattr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&m->lock, &mattr);
+    pthread_mutexattr_destroy(&mattr);
+
+    *mutex = m;
+
+    return UHOS_SUCCESS;
+}
+
+uhos_s32 uhos_mutex_delete(uhos_mutex_t mutex)
+{
+    if (UHOS_NULL == mutex)
+    {
+        return UHOS_FAILURE;
+    }
+
+    pthread_mutex_destroy(&mutex->lock);
+    free(mutex);
+
+    return UHOS_SUCCESS;
+}
+
+uhos_s32 uhos_mutex_wait(uhos_mutex_t mutex, uhos_u32 millisec)
+{
+    struct timespec deadline;
+    int             ret = 0;
+
+    if (UHOS_NULL == mutex)
+    {
+        return UHOS_FAILURE;
+    }
+
+    if (UHOS_MUTEX_WAIT_FOREVER == millisec)
+    {
+        ret = pthread_mutex_lock(&mutex->lock);
+    }
+    else if (UHOS_MUTEX_WAIT_NONE == millisec)
+    {
+        ret = pthread_mutex_trylock(&mutex->lock);
+    }
+    else
+    {
+        // pthread_mutex_timedlock使用CLOCK_REALTIME
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec  += millisec / 1000;
+        deadline.tv_nsec += (long)(millisec % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L)
+        {
+            deadline.tv_sec  += 1;
+            deadline.tv_nsec -= 1000000000L;
+        }
+        ret = pthread_mutex_timedlock(&mutex->lock, &deadline);
+    }
+
+    return (0 == ret) ? UHOS_SUCCESS : UHOS_FAILURE;
+}
+
+uhos_s32 uhos_mutex_release(uhos_mutex_t mutex)
+{
+    if (UHOS_NULL == mutex)
+    {
+        return UHOS_FAILURE;
+    }
+
+    return (0 == pthread_mutex_unlock(&mutex->lock)) ? UHOS_SUCCESS : UHOS_FAILURE;
+}
@@ -0,0 +1,289 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_crypt.c
+ * @author agent (agent@local)
+ * @brief 基于ESP-IDF mbedtls(3.x)的uh_crypt实现
+ * @details 开启CONFIG_MBEDTLS_HARDWARE_AES/CONFIG_MBEDTLS_HARDWARE_GCM时，mbedtls_aes_xxx与mbedtls_gcm_xxx
+ *          由芯片AES外设完成，较大的数据经DMA处理，CPU只负责不足一块的首尾部分。
+ *          加密与解密秘钥分别保存在两个上下文中，同一句柄可先后设置两种秘钥
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：基于ESP-IDF mbedtls(3.x)的uh_crypt实现
+ * </table>
+ */
+
+#define LOG_TAG "esp32_crypt"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include <string.h>
+
+#include "mbedtls/aes.h"
+#include "mbedtls/gcm.h"
+
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_crypt.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define ESP32_AES_BLOCK         16
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      aes句柄
+ */
+typedef struct
+{
+    mbedtls_aes_context enc;
+    mbedtls_aes_context dec;
+    uhos_bool           has_enc;
+    uhos_bool           has_dec;
+} esp32_aes_t;
+
+/**
+ * @struct      gcm句柄
+ */
+typedef struct
+{
+    mbedtls_gcm_context gcm;
+    uhos_bool           has_key;
+    uhos_bool           started;                                //<! starts之后、finish之前
+    uhos_bool           enc;
+} esp32_gcm_t;
+
+/**************************************************************************************************/
+/*                                          外部函数实现                                          */
+/**************************************************************************************************/
+uhos_void *uhos_aes_init(uhos_void)
+{
+    esp32_aes_t *aes = (esp32_aes_t *)uhos_libc_malloc(sizeof(esp32_aes_t));
+
+    if (UHOS_NULL == aes)
+    {
+        return UHOS_NULL;
+    }
+
+    uhos_libc_memset(aes, 0, sizeof(esp32_aes_t));
+    mbedtls_aes_init(&aes->enc);
+    mbedtls_aes_init(&aes->dec);
+
+    return aes;
+}
+
+uhos_void uhos_aes_free(uhos_void *ctx)
+{
+    esp32_aes_t *aes = (esp32_aes_t *)ctx;
+
+    if (UHOS_NULL == aes)
+    {
+        return;
+    }
+
+    mbedtls_aes_free(&aes->enc);
+    mbedtls_aes_free(&aes->dec);
+    uhos_libc_free(aes);
+}
+
+uhos_s32 uhos_aes_setkey_dec(uhos_void *ctx, const uhos_u8 *key, uhos_u32 keybits)
+{
+    esp32_aes_t *aes = (esp32_aes_t *)ctx;
+
+    if ((UHOS_NULL == aes) || (UHOS_NULL == key))
+    {
+        return -1;
+    }
+
+    aes->has_dec = (0 == mbedtls_aes_setkey_dec(&aes->dec, key, keybits));
+    return aes->has_dec ? 0 : -1;
+}
+
+uhos_s32 uhos_aes_setkey_enc(uhos_void *ctx, const uhos_u8 *key, uhos_u32 keybits)
+{
+    esp32_aes_t *aes = (esp32_aes_t *)ctx;
+
+    if ((UHOS_NULL == aes) || (UHOS_NULL == key))
+    {
+        return -1;
+    }
+
+    aes->has_enc = (0 == mbedtls_aes_setkey_enc(&aes->enc, key, keybits));
+    return aes->has_enc ? 0 : -1;
+}
+
+uhos_s32 uhos_aes_crypt_cbc(uhos_void *ctx, UHOS_AES_CRYPT_E crypt_mode, uhos_size_t length, uhos_u8 iv[16], const uhos_u8 *input, uhos_u8 *output)
+{
+    esp32_aes_t *aes = (esp32_aes_t *)ctx;
+    uhos_s32     ret = 0;
+
+    if ((UHOS_NULL == aes) || (UHOS_NULL == iv))
+    {
+        return -1;
+    }
+
+    if (UHOS_AES_ENCRYPT == crypt_mode)
+    {
+        ret = aes->has_enc ? mbedtls_aes_crypt_cbc(&aes->enc, MBEDTLS_AES_ENCRYPT, length, iv, input, output) : -1;
+    }
+    else
+    {
+        ret = aes->has_dec ? mbedtls_aes_crypt_cbc(&aes->dec, MBEDTLS_AES_DECRYPT, length, iv, input, output) : -1;
+    }
+
+    return (0 == ret) ? 0 : -1;
+}
+
+uhos_s32 uhos_aes_crypt_ctr(uhos_void *ctx, uhos_size_t length, uhos_size_t *nc_off, uhos_u8 nonce_counter[16], uhos_u8 stream_block[16],
+                            const uhos_u8 *input, uhos_u8 *output)
+{
+    esp32_aes_t *aes = (esp32_aes_t *)ctx;
+
+    if ((UHOS_NULL == aes) || !aes->has_enc || (UHOS_NULL == nc_off) || (*nc_off >= ESP32_AES_BLOCK))
+    {
+        return -1;
+    }
+
+    if (0 != mbedtls_aes_crypt_ctr(&aes->enc, length, nc_off, nonce_counter, stream_block, input, output))
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+uhos_void *uhos_aes_gcm_init(uhos_void)
+{
+    esp32_gcm_t *gcm = (esp32_gcm_t *)uhos_libc_malloc(sizeof(esp32_gcm_t));
+
+    if (UHOS_NULL == gcm)
+    {
+        return UHOS_NULL;
+    }
+
+    uhos_libc_memset(gcm, 0, sizeof(esp32_gcm_t));
+    mbedtls_gcm_init(&gcm->gcm);
+
+    return gcm;
+}
+
+uhos_void uhos_aes_gcm_free(uhos_void *ctx)
+{
+    esp32_gcm_t *gcm = (esp32_gcm_t *)ctx;
+
+    if (UHOS_NULL == gcm)
+    {
+        return;
+    }
+
+    mbedtls_gcm_free(&gcm->gcm);
+    uhos_libc_free(gcm);
+}
+
+uhos_s32 uhos_aes_gcm_setkey(uhos_void *ctx, const uhos_u8 *key, uhos_u32 keybits)
+{
+    esp32_gcm_t *gcm = (esp32_gcm_t *)ctx;
+
+    if ((UHOS_NULL == gcm) || (UHOS_NULL == key))
+    {
+        return -1;
+    }
+
+    gcm->started = UHOS_FALSE;
+    gcm->has_key = (0 == mbedtls_gcm_setkey(&gcm->gcm, MBEDTLS_CIPHER_ID_AES, key, keybits));
+    return gcm->has_key ? 0 : -1;
+}
+
+uhos_s32 uhos_aes_gcm_starts(uhos_void *ctx, UHOS_AES_CRYPT_E crypt_mode, const uhos_u8 *iv, uhos_size_t iv_len, const uhos_u8 *add,
+                             uhos_size_t add_len)
+{
+    esp32_gcm_t *gcm = (esp32_gcm_t *)ctx;
+
+    if ((UHOS_NULL == gcm) || !gcm->has_key || (UHOS_NULL == iv) || (0 == iv_len) || ((UHOS_NULL == add) && (add_len > 0)))
+    {
+        return -1;
+    }
+
+    gcm->enc     = (UHOS_AES_ENCRYPT == crypt_mode);
+    gcm->started = UHOS_FALSE;
+
+    if (0 != mbedtls_gcm_starts(&gcm->gcm, gcm->enc ? MBEDTLS_GCM_ENCRYPT : MBEDTLS_GCM_DECRYPT, iv, iv_len))
+    {
+        return -1;
+    }
+    if ((add_len > 0) && (0 != mbedtls_gcm_update_ad(&gcm->gcm, add, add_len)))
+    {
+        return -1;
+    }
+
+    gcm->started = UHOS_TRUE;
+    return 0;
+}
+
+uhos_s32 uhos_aes_gcm_update(uhos_void *ctx, uhos_size_t length, const uhos_u8 *input, uhos_u8 *output)
+{
+    esp32_gcm_t *gcm  = (esp32_gcm_t *)ctx;
+    size_t       olen = 0;
+
+    if ((UHOS_NULL == gcm) || !gcm->started || ((length > 0) && ((UHOS_NULL == input) || (UHOS_NULL == output))))
+    {
+        return -1;
+    }
+    if (0 == length)
+    {
+        return 0;
+    }
+
+    // mbedtls 3.x的GCM内部缓存不足一块的状态，输出长度总是等于输入长度
+    if ((0 != mbedtls_gcm_update(&gcm->gcm, input, length, output, length, &olen)) || (olen != length))
+    {
+        gcm->started = UHOS_FALSE;
+        return -1;
+    }
+
+    return 0;
+}
+
+uhos_s32 uhos_aes_gcm_finish(uhos_void *ctx, uhos_u8 *tag, uhos_size_t tag_len)
+{
+    esp32_gcm_t *gcm  = (esp32_gcm_t *)ctx;
+    uhos_u8      calc[ESP32_AES_BLOCK];
+    size_t       olen = 0;
+    uhos_u8      diff = 0;
+    uhos_size_t  i    = 0;
+
+    if ((UHOS_NULL == gcm) || !gcm->started || (UHOS_NULL == tag) || (tag_len < 4) || (tag_len > ESP32_AES_BLOCK))
+    {
+        return -1;
+    }
+    gcm->started = UHOS_FALSE;
+
+    if (0 != mbedtls_gcm_finish(&gcm->gcm, UHOS_NULL, 0, &olen, gcm->enc ? tag : calc, tag_len))
+    {
+        return -1;
+    }
+    if (gcm->enc)
+    {
+        return 0;
+    }
+
+    // 常量时间比较
+    for (i = 0; i < tag_len; i++)
+    {
+        diff |= calc[i] ^ tag[i];
+    }
+    if (0 != diff)
+    {
+        UHOS_LOGW("gcm tag mismatch");
+        return -1;
+    }
+
+    return 0;
+}
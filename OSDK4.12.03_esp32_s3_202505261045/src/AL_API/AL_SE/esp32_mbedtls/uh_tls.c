@@ -0,0 +1,961 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_tls.c
+ * @author agent (agent@local)
+ * @brief 基于ESP-IDF mbedtls(3.x)的uh_tls实现
+ * @details set接口解析并保存设置值，uhos_tls_start时完成mbedtls配置并使设置生效。
+ *          随机数使用芯片硬件随机数发生器，每个句柄不再单独持有entropy/ctr_drbg上下文。
+ *          会话用mbedtls_ssl_session_save序列化，包含TLS1.2的会话ID或会话票据(RFC 5077)、TLS1.3的票据及密钥；
+ *          mbedtls没有查询是否恢复了会话的公开接口，恢复会话的握手(TLS1.2与TLS1.3)服务器不发送证书，
+ *          因此以设置了会话且证书校验回调未被调用判断为恢复；不校验服务器证书时无法判断，按完整握手处理。
+ *          会话缓存的配置区含会话密钥，只存放在加密的NVS分区CONFIG_UHOS_TLS_NVS_PARTITION中，
+ *          密钥来自nvs_keys分区；未开启CONFIG_NVS_ENCRYPTION或分区表中没有这两个分区时读写返回-1，会话只缓存在内存中。
+ *          证书库中解析好的证书链与私钥由各句柄的mbedtls_ssl_config直接引用，握手期间只读；
+ *          RSA私钥签名时更新盲化参数，多线程并发握手依赖MBEDTLS_THREADING_C(ESP-IDF默认开启)的互斥保护
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：基于ESP-IDF mbedtls(3.x)的uh_tls实现
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>会话缓存配置区改存加密的NVS分区，未配置NVS加密时不落盘
+ * </table>
+ */
+
+#define LOG_TAG "esp32_tls"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "esp_partition.h"
+#include "esp_random.h"
+#include "lwip/sockets.h"
+#include "mbedtls/error.h"
+#include "mbedtls/net_sockets.h"
+#include "mbedtls/oid.h"
+#include "mbedtls/pk.h"
+#include "mbedtls/ssl.h"
+#include "mbedtls/x509_crt.h"
+#include "nvs.h"
+#include "nvs_flash.h"
+
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_tls.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define ESP32_TLS_NVS_NAMESPACE "uh_tls"
+#define ESP32_TLS_NVS_KEY_LEN   16
+
+/**
+ * 存放会话缓存配置区的NVS分区，须在分区表中与nvs_keys分区一起定义，例如：
+ *   uh_tls,   data, nvs,      , 0x4000,
+ *   nvs_keys, data, nvs_keys, , 0x1000, encrypted
+ * nvs_keys分区的密钥首次使用时生成，其机密性依赖flash加密
+ */
+#ifndef CONFIG_UHOS_TLS_NVS_PARTITION
+#define CONFIG_UHOS_TLS_NVS_PARTITION "uh_tls"
+#endif
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      证书库，创建后只读
+ */
+typedef struct
+{
+    uhos_s32           refs;
+    mbedtls_x509_crt   ca;
+    mbedtls_x509_crt   own;
+    mbedtls_pk_context key;
+    uhos_u8            has_ca;
+    uhos_u8            has_own;
+} esp32_tls_store_t;
+
+/**
+ * @struct      tls句柄
+ */
+typedef struct
+{
+    mbedtls_ssl_context  ssl;
+    mbedtls_ssl_config   conf;
+    mbedtls_x509_crt     ca;
+    mbedtls_x509_crt     own;
+    mbedtls_pk_context   key;
+    mbedtls_ssl_session *session;                               //<! 待恢复的会话
+    int                 *ciphers;                               //<! 以0结尾的mbedtls套件ID
+    int                  fd;
+    uhos_u8              has_ca;
+    uhos_u8              has_own;
+    uhos_u8              started;
+    uhos_u8              restored;                              //<! 已为握手设置了恢复的会话
+    uhos_u8              verified;                              //<! 握手中校验过服务器证书
+    esp32_tls_store_t   *store;                                 //<! 设置后忽略ca、own
+} esp32_tls_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+// 按UHOS_TLS_CIPHERSUITES_E顺序
+static const int g_esp32_tls_cipher_ids[] = {
+    MBEDTLS_TLS_RSA_WITH_AES_128_CBC_SHA256,
+    MBEDTLS_TLS_RSA_WITH_AES_256_CBC_SHA256,
+    MBEDTLS_TLS_DHE_RSA_WITH_AES_256_CBC_SHA256,
+    MBEDTLS_TLS_RSA_WITH_AES_256_GCM_SHA384,
+    MBEDTLS_TLS_DHE_RSA_WITH_AES_256_GCM_SHA384,
+    MBEDTLS_TLS_ECDHE_ECDSA_WITH_AES_256_CBC_SHA384,
+    MBEDTLS_TLS_ECDH_ECDSA_WITH_AES_256_CBC_SHA384,
+    MBEDTLS_TLS_ECDHE_RSA_WITH_AES_256_CBC_SHA384,
+    MBEDTLS_TLS_ECDH_RSA_WITH_AES_256_CBC_SHA384,
+    MBEDTLS_TLS_ECDHE_ECDSA_WITH_AES_256_GCM_SHA384,
+    MBEDTLS_TLS_ECDH_ECDSA_WITH_AES_256_GCM_SHA384,
+    MBEDTLS_TLS_ECDHE_RSA_WITH_AES_256_GCM_SHA384,
+    MBEDTLS_TLS_ECDH_RSA_WITH_AES_256_GCM_SHA384,
+};
+
+static uhos_tls_store_stat_t g_esp32_tls_stat;                // 各字段以__atomic访问
+
+static pthread_once_t g_esp32_tls_nvs_once  = PTHREAD_ONCE_INIT;
+static uhos_bool      g_esp32_tls_nvs_ready = UHOS_FALSE;       // 加密分区已初始化
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static int esp32_tls_rng(void *ctx, unsigned char *buf, size_t len)
+{
+    esp_fill_random(buf, len);
+    return 0;
+}
+
+/**
+ * @brief       证书校验回调，只记录握手中收到并校验了服务器证书，不修改校验结果
+ */
+static int esp32_tls_verify(void *ctx, mbedtls_x509_crt *crt, int depth, uint32_t *flags)
+{
+    (void)crt;
+    (void)depth;
+    (void)flags;
+
+    ((esp32_tls_t *)ctx)->verified = 1;
+
+    return 0;
+}
+
+static int esp32_tls_bio_send(void *ctx, const unsigned char *buf, size_t len)
+{
+    int ret = send(((esp32_tls_t *)ctx)->fd, buf, len, 0);
+
+    if (ret >= 0)
+    {
+        return ret;
+    }
+
+    return ((EAGAIN == errno) || (EWOULDBLOCK == errno) || (EINTR == errno)) ? MBEDTLS_ERR_SSL_WANT_WRITE : MBEDTLS_ERR_NET_SEND_FAILED;
+}
+
+static int esp32_tls_bio_recv(void *ctx, unsigned char *buf, size_t len)
+{
+    int ret = recv(((esp32_tls_t *)ctx)->fd, buf, len, 0);
+
+    if (ret >= 0)
+    {
+        return ret;
+    }
+
+    return ((EAGAIN == errno) || (EWOULDBLOCK == errno) || (EINTR == errno)) ? MBEDTLS_ERR_SSL_WANT_READ : MBEDTLS_ERR_NET_RECV_FAILED;
+}
+
+/**
+ * @brief       将mbedtls的返回值转换为UHOS_TLS_RET_E
+ */
+static uhos_s32 esp32_tls_error(int ret)
+{
+    switch (ret)
+    {
+        case MBEDTLS_ERR_SSL_WANT_READ:
+#ifdef MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET
+        case MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET:
+#endif
+            return UHOS_TLS_RET_WANT_READ;
+
+        case MBEDTLS_ERR_SSL_WANT_WRITE:
+            return UHOS_TLS_RET_WANT_WRITE;
+
+        case MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY:
+            return 0;
+
+        default:
+            UHOS_LOGD("mbedtls error -0x%04x", (unsigned)-ret);
+            return UHOS_TLS_RET_ERROR;
+    }
+}
+
+/**
+ * @brief       解析证书，PEM须以'\0'结尾，缺少结尾时补齐后再解析
+ */
+static int esp32_tls_parse_crt(mbedtls_x509_crt *crt, const uhos_u8 *buf, uhos_size_t len)
+{
+    uhos_u8 *copy = UHOS_NULL;
+    int      ret  = 0;
+
+    if ((len > 0) && ('-' == buf[0]) && ('\0' != buf[len - 1]))
+    {
+        copy = uhos_libc_malloc(len + 1);
+        if (UHOS_NULL == copy)
+        {
+            return MBEDTLS_ERR_X509_ALLOC_FAILED;
+        }
+        uhos_libc_memcpy(copy, buf, len);
+        copy[len] = '\0';
+        ret       = mbedtls_x509_crt_parse(crt, copy, len + 1);
+        uhos_libc_free(copy);
+        return ret;
+    }
+
+    return mbedtls_x509_crt_parse(crt, buf, len);
+}
+
+/**
+ * @brief       解析私钥，PEM同样须以'\0'结尾
+ */
+static int esp32_tls_parse_key(mbedtls_pk_context *key, const uhos_u8 *buf, uhos_size_t len)
+{
+    uhos_u8 *copy = UHOS_NULL;
+    int      ret  = 0;
+
+    if ((len > 0) && ('-' == buf[0]) && ('\0' != buf[len - 1]))
+    {
+        copy = uhos_libc_malloc(len + 1);
+        if (UHOS_NULL == copy)
+        {
+            return MBEDTLS_ERR_PK_ALLOC_FAILED;
+        }
+        uhos_libc_memcpy(copy, buf, len);
+        copy[len] = '\0';
+        ret       = mbedtls_pk_parse_key(key, copy, len + 1, UHOS_NULL, 0, esp32_tls_rng, UHOS_NULL);
+        uhos_libc_free(copy);
+        return ret;
+    }
+
+    return mbedtls_pk_parse_key(key, buf, len, UHOS_NULL, 0, esp32_tls_rng, UHOS_NULL);
+}
+
+static uhos_s32 esp32_tls_crt_cn(const mbedtls_x509_crt *crt, uhos_u8 *cert_cn_buf, uhos_size_t cert_cn_buf_len)
+{
+    const mbedtls_x509_name *name = UHOS_NULL;
+
+    for (name = &crt->subject; UHOS_NULL != name; name = name->next)
+    {
+        if ((UHOS_NULL != name->oid.p) && (0 == MBEDTLS_OID_CMP(MBEDTLS_OID_AT_CN, &name->oid)))
+        {
+            if (name->val.len >= cert_cn_buf_len)
+            {
+                return -1;
+            }
+            uhos_libc_memcpy(cert_cn_buf, name->val.p, name->val.len);
+            cert_cn_buf[name->val.len] = '\0';
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief       清除旧版本以明文写在默认NVS分区中的会话数据
+ */
+static void esp32_tls_nvs_plain_erase(void)
+{
+    nvs_handle_t nvs = 0;
+
+    if (ESP_OK == nvs_open(ESP32_TLS_NVS_NAMESPACE, NVS_READWRITE, &nvs))
+    {
+        if ((ESP_OK == nvs_erase_all(nvs)) && (ESP_OK == nvs_commit(nvs)))
+        {
+            UHOS_LOGI("plaintext session zone erased");
+        }
+        nvs_close(nvs);
+    }
+}
+
+/**
+ * @brief       以nvs_keys分区的密钥初始化加密的会话分区，只执行一次
+ */
+static void esp32_tls_nvs_init(void)
+{
+#if defined(CONFIG_NVS_ENCRYPTION)
+    const esp_partition_t *keys = UHOS_NULL;
+    nvs_sec_cfg_t          cfg;
+    esp_err_t              err  = ESP_OK;
+#endif
+
+    esp32_tls_nvs_plain_erase();
+
+#if defined(CONFIG_NVS_ENCRYPTION)
+    keys = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_NVS_KEYS, UHOS_NULL);
+    if (UHOS_NULL == keys)
+    {
+        UHOS_LOGW("no nvs_keys partition, tls sessions kept in RAM only");
+        return;
+    }
+
+    err = nvs_flash_read_security_cfg(keys, &cfg);
+    if (ESP_ERR_NVS_KEYS_NOT_INITIALIZED == err)
+    {
+        err = nvs_flash_generate_keys(keys, &cfg);
+    }
+    if (ESP_OK != err)
+    {
+        UHOS_LOGW("nvs keys unavailable 0x%x, tls sessions kept in RAM only", (unsigned)err);
+        return;
+    }
+
+    err = nvs_flash_secure_init_partition(CONFIG_UHOS_TLS_NVS_PARTITION, &cfg);
+    if ((ESP_ERR_NVS_NO_FREE_PAGES == err) || (ESP_ERR_NVS_NEW_VERSION_FOUND == err))
+    {
+        // 分区内只有可丢弃的会话缓存
+        if (ESP_OK == nvs_flash_erase_partition(CONFIG_UHOS_TLS_NVS_PARTITION))
+        {
+            err = nvs_flash_secure_init_partition(CONFIG_UHOS_TLS_NVS_PARTITION, &cfg);
+        }
+    }
+    uhos_libc_memset(&cfg, 0, sizeof(cfg));
+    if (ESP_OK != err)
+    {
+        UHOS_LOGW("nvs partition %s init failed 0x%x, tls sessions kept in RAM only", CONFIG_UHOS_TLS_NVS_PARTITION,
+                  (unsigned)err);
+        return;
+    }
+
+    g_esp32_tls_nvs_ready = UHOS_TRUE;
+#else
+    UHOS_LOGW("CONFIG_NVS_ENCRYPTION off, tls sessions kept in RAM only");
+#endif
+}
+
+/**
+ * @brief       打开加密的会话分区
+ * @return      0-成功，-1-未配置NVS加密或打开失败
+ */
+static int esp32_tls_nvs_open(nvs_open_mode_t mode, nvs_handle_t *nvs)
+{
+    esp_err_t err = ESP_OK;
+
+    pthread_once(&g_esp32_tls_nvs_once, esp32_tls_nvs_init);
+    if (!g_esp32_tls_nvs_ready)
+    {
+        return -1;
+    }
+
+    err = nvs_open_from_partition(CONFIG_UHOS_TLS_NVS_PARTITION, ESP32_TLS_NVS_NAMESPACE, mode, nvs);
+    if ((ESP_OK != err) && (ESP_ERR_NVS_NOT_FOUND != err))
+    {
+        UHOS_LOGW("nvs open failed 0x%x", (unsigned)err);
+    }
+
+    return (ESP_OK == err) ? 0 : -1;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_void *uhos_tls_init(uhos_void)
+{
+    esp32_tls_t *tls = uhos_libc_zalloc(sizeof(esp32_tls_t));
+
+    if (UHOS_NULL == tls)
+    {
+        UHOS_LOG_MEM_ALLOC_FAIL();
+        return UHOS_NULL;
+    }
+
+    mbedtls_ssl_init(&tls->ssl);
+    mbedtls_ssl_config_init(&tls->conf);
+    mbedtls_x509_crt_init(&tls->ca);
+    mbedtls_x509_crt_init(&tls->own);
+    mbedtls_pk_init(&tls->key);
+    tls->fd = -1;
+
+    return tls;
+}
+
+uhos_s32 uhos_tls_uninit(uhos_void *handle)
+{
+    esp32_tls_t *tls = handle;
+
+    if (UHOS_NULL == tls)
+    {
+        return -1;
+    }
+
+    mbedtls_ssl_free(&tls->ssl);
+    mbedtls_ssl_config_free(&tls->conf);
+    mbedtls_x509_crt_free(&tls->ca);
+    mbedtls_x509_crt_free(&tls->own);
+    mbedtls_pk_free(&tls->key);
+    if (UHOS_NULL != tls->session)
+    {
+        mbedtls_ssl_session_free(tls->session);
+        uhos_libc_free(tls->session);
+    }
+    if (tls->started && (UHOS_NULL == tls->store))
+    {
+        __atomic_add_fetch(&g_esp32_tls_stat.ctx_free, 1, __ATOMIC_RELAXED);
+    }
+    // ssl、conf释放后才归还证书库，conf引用其中的证书
+    uhos_tls_store_release(tls->store);
+    uhos_libc_free(tls->ciphers);
+    uhos_libc_free(tls);
+
+    return 0;
+}
+
+uhos_s32 uhos_tls_start(uhos_void *handle)
+{
+    esp32_tls_t        *tls   = handle;
+    esp32_tls_store_t  *store = UHOS_NULL;
+    mbedtls_x509_crt   *ca    = UHOS_NULL;
+    mbedtls_x509_crt   *own   = UHOS_NULL;
+    mbedtls_pk_context *key   = UHOS_NULL;
+    int                 ret   = 0;
+
+    if ((UHOS_NULL == tls) || (tls->fd < 0) || tls->started)
+    {
+        return -1;
+    }
+
+    ret = mbedtls_ssl_config_defaults(&tls->conf, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_STREAM, MBEDTLS_SSL_PRESET_DEFAULT);
+    if (0 != ret)
+    {
+        return -1;
+    }
+    mbedtls_ssl_conf_rng(&tls->conf, esp32_tls_rng, UHOS_NULL);
+
+    store = tls->store;
+    if (UHOS_NULL != store)
+    {
+        ca  = store->has_ca ? &store->ca : UHOS_NULL;
+        own = store->has_own ? &store->own : UHOS_NULL;
+        key = &store->key;
+    }
+    else
+    {
+        ca  = tls->has_ca ? &tls->ca : UHOS_NULL;
+        own = tls->has_own ? &tls->own : UHOS_NULL;
+        key = &tls->key;
+    }
+
+    if (UHOS_NULL != ca)
+    {
+        mbedtls_ssl_conf_ca_chain(&tls->conf, ca, UHOS_NULL);
+        mbedtls_ssl_conf_authmode(&tls->conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+        mbedtls_ssl_conf_verify(&tls->conf, esp32_tls_verify, tls);
+    }
+    else
+    {
+        mbedtls_ssl_conf_authmode(&tls->conf, MBEDTLS_SSL_VERIFY_NONE);
+    }
+    if ((UHOS_NULL != own) && (0 != mbedtls_ssl_conf_own_cert(&tls->conf, own, key)))
+    {
+        return -1;
+    }
+    if (UHOS_NULL != tls->ciphers)
+    {
+        mbedtls_ssl_conf_ciphersuites(&tls->conf, tls->ciphers);
+    }
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+    mbedtls_ssl_conf_session_tickets(&tls->conf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+#endif
+
+    ret = mbedtls_ssl_setup(&tls->ssl, &tls->conf);
+    if (0 != ret)
+    {
+        UHOS_LOGE("ssl setup failed -0x%04x", (unsigned)-ret);
+        return -1;
+    }
+    mbedtls_ssl_set_bio(&tls->ssl, tls, esp32_tls_bio_send, esp32_tls_bio_recv, UHOS_NULL);
+    tls->started = 1;
+    __atomic_add_fetch((UHOS_NULL != store) ? &g_esp32_tls_stat.ctx_shared : &g_esp32_tls_stat.ctx_new, 1, __ATOMIC_RELAXED);
+
+    if (UHOS_NULL != tls->session)
+    {
+        ret = mbedtls_ssl_set_session(&tls->ssl, tls->session);
+        mbedtls_ssl_session_free(tls->session);
+        uhos_libc_free(tls->session);
+        tls->session  = UHOS_NULL;
+        tls->restored = (0 == ret);
+    }
+
+    return 0;
+}
+
+uhos_s32 uhos_tls_handshake(uhos_void *handle)
+{
+    esp32_tls_t *tls = handle;
+    int          ret = 0;
+
+    if ((UHOS_NULL == tls) || !tls->started)
+    {
+        return UHOS_TLS_RET_ERROR;
+    }
+
+    ret = mbedtls_ssl_handshake(&tls->ssl);
+    if (0 == ret)
+    {
+        return UHOS_TLS_RET_OK;
+    }
+
+    ret = esp32_tls_error(ret);
+    if (0 == ret)
+    {
+        ret = UHOS_TLS_RET_ERROR;
+    }
+    if (UHOS_TLS_RET_ERROR == ret)
+    {
+        UHOS_LOGW("handshake failed, verify 0x%x", (unsigned)mbedtls_ssl_get_verify_result(&tls->ssl));
+    }
+
+    return ret;
+}
+
+uhos_s32 uhos_tls_send(uhos_void *handle, const uhos_u8 *data, uhos_size_t data_len)
+{
+    esp32_tls_t *tls = handle;
+    int          ret = 0;
+
+    if ((UHOS_NULL == tls) || !tls->started || (UHOS_NULL == data) || (0 == data_len))
+    {
+        return UHOS_TLS_RET_ERROR;
+    }
+
+    ret = mbedtls_ssl_write(&tls->ssl, data, data_len);
+    if (ret > 0)
+    {
+        return ret;
+    }
+    ret = esp32_tls_error(ret);
+
+    return (0 == ret) ? UHOS_TLS_RET_ERROR : ret;
+}
+
+uhos_s32 uhos_tls_recv(uhos_void *handle, uhos_u8 *data, uhos_size_t data_len)
+{
+    esp32_tls_t *tls = handle;
+    int          ret = 0;
+
+    if ((UHOS_NULL == tls) || !tls->started || (UHOS_NULL == data) || (0 == data_len))
+    {
+        return UHOS_TLS_RET_ERROR;
+    }
+
+    ret = mbedtls_ssl_read(&tls->ssl, data, data_len);
+    if (ret >= 0)
+    {
+        return ret;
+    }
+
+    return esp32_tls_error(ret);
+}
+
+uhos_s32 uhos_tls_get_avail_bytes(uhos_void *tls_handle)
+{
+    esp32_tls_t *tls = tls_handle;
+
+    if ((UHOS_NULL == tls) || !tls->started)
+    {
+        return 0;
+    }
+
+    return (uhos_s32)mbedtls_ssl_get_bytes_avail(&tls->ssl);
+}
+
+uhos_s32 uhos_tls_set_connected_socket(uhos_void *handle, uhos_s32 socket_fd)
+{
+    esp32_tls_t *tls = handle;
+
+    if ((UHOS_NULL == tls) || (socket_fd < 0))
+    {
+        return -1;
+    }
+    tls->fd = socket_fd;
+
+    return 0;
+}
+
+uhos_s32 uhos_tls_set_ciphersuites(uhos_void *handle, uhos_s32 *ciphersuites, uhos_u32 ciphersuites_count)
+{
+    esp32_tls_t *tls = handle;
+    int         *ids = UHOS_NULL;
+    uhos_u32     num = 0;
+    uhos_u32     i   = 0;
+
+    if ((UHOS_NULL == tls) || (UHOS_NULL == ciphersuites) || (0 == ciphersuites_count))
+    {
+        return -1;
+    }
+
+    ids = uhos_libc_zalloc((ciphersuites_count + 1) * sizeof(int));
+    if (UHOS_NULL == ids)
+    {
+        UHOS_LOG_MEM_ALLOC_FAIL();
+        return -1;
+    }
+    for (i = 0; i < ciphersuites_count; i++)
+    {
+        if ((ciphersuites[i] >= 0) &&
+            ((uhos_u32)ciphersuites[i] < sizeof(g_esp32_tls_cipher_ids) / sizeof(g_esp32_tls_cipher_ids[0])))
+        {
+            ids[num++] = g_esp32_tls_cipher_ids[ciphersuites[i]];
+        }
+    }
+    if (0 == num)
+    {
+        uhos_libc_free(ids);
+        return -1;
+    }
+
+    // mbedtls只保存指针，须在句柄释放前保持有效
+    uhos_libc_free(tls->ciphers);
+    tls->ciphers = ids;
+
+    return 0;
+}
+
+uhos_s32 uhos_tls_set_ca_cert(uhos_void *handle, const uhos_u8 *ca_cert, uhos_size_t ca_cert_len)
+{
+    esp32_tls_t *tls = handle;
+    int          ret = 0;
+
+    if ((UHOS_NULL == tls) || (UHOS_NULL == ca_cert) || (0 == ca_cert_len))
+    {
+        return -1;
+    }
+
+    // PEM中有部分证书解析失败时返回正数，至少有一个证书可用即可
+    ret = esp32_tls_parse_crt(&tls->ca, ca_cert, ca_cert_len);
+    if ((ret < 0) || (UHOS_NULL == tls->ca.raw.p))
+    {
+        UHOS_LOGE("bad ca cert -0x%04x", (unsigned)-ret);
+        return -1;
+    }
+    tls->has_ca = 1;
+
+    return 0;
+}
+
+uhos_s32 uhos_tls_set_own_cert(uhos_void *handle, const uhos_u8 *own_cert, uhos_size_t own_cert_len, const uhos_u8 *priv_key, uhos_size_t priv_key_len)
+{
+    esp32_tls_t *tls = handle;
+    int          ret = 0;
+
+    if ((UHOS_NULL == tls) || (UHOS_NULL == own_cert) || (0 == own_cert_len) || (UHOS_NULL == priv_key) || (0 == priv_key_len))
+    {
+        return -1;
+    }
+
+    if (0 != esp32_tls_parse_crt(&tls->own, own_cert, own_cert_len))
+    {
+        return -1;
+    }
+
+    ret = esp32_tls_parse_key(&tls->key, priv_key, priv_key_len);
+    if (0 != ret)
+    {
+        UHOS_LOGE("bad private key -0x%04x", (unsigned)-ret);
+        return -1;
+    }
+    tls->has_own = 1;
+
+    return 0;
+}
+
+uhos_s32 uhos_tls_get_cert_cn(uhos_u8 *cert_buf, uhos_size_t cert_buf_len, uhos_u8 *cert_cn_buf, uhos_size_t cert_cn_buf_len)
+{
+    mbedtls_x509_crt crt;
+    uhos_s32         ret = -1;
+
+    if ((UHOS_NULL == cert_buf) || (UHOS_NULL == cert_cn_buf) || (0 == cert_cn_buf_len))
+    {
+        return -1;
+    }
+
+    mbedtls_x509_crt_init(&crt);
+    if (0 == esp32_tls_parse_crt(&crt, cert_buf, cert_buf_len))
+    {
+        ret = esp32_tls_crt_cn(&crt, cert_cn_buf, cert_cn_buf_len);
+    }
+    mbedtls_x509_crt_free(&crt);
+
+    return ret;
+}
+
+uhos_void *uhos_tls_store_create(const uhos_u8 *ca_cert, uhos_size_t ca_cert_len, const uhos_u8 *own_cert, uhos_size_t own_cert_len,
+                                 const uhos_u8 *priv_key, uhos_size_t priv_key_len)
+{
+    esp32_tls_store_t *store = UHOS_NULL;
+    int                ret   = 0;
+
+    if (((UHOS_NULL == ca_cert) || (0 == ca_cert_len)) && ((UHOS_NULL == own_cert) || (0 == own_cert_len)))
+    {
+        return UHOS_NULL;
+    }
+
+    store = uhos_libc_zalloc(sizeof(esp32_tls_store_t));
+    if (UHOS_NULL == store)
+    {
+        UHOS_LOG_MEM_ALLOC_FAIL();
+        return UHOS_NULL;
+    }
+    store->refs = 1;
+    __atomic_add_fetch(&g_esp32_tls_stat.stores, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&g_esp32_tls_stat.ctx_new, 1, __ATOMIC_RELAXED);
+    mbedtls_x509_crt_init(&store->ca);
+    mbedtls_x509_crt_init(&store->own);
+    mbedtls_pk_init(&store->key);
+
+    if ((UHOS_NULL != ca_cert) && (ca_cert_len > 0))
+    {
+        // PEM中有部分证书解析失败时返回正数，至少有一个证书可用即可
+        ret = esp32_tls_parse_crt(&store->ca, ca_cert, ca_cert_len);
+        if ((ret < 0) || (UHOS_NULL == store->ca.raw.p))
+        {
+            UHOS_LOGE("bad ca cert -0x%04x", (unsigned)-ret);
+            goto fail;
+        }
+        store->has_ca = 1;
+    }
+    if ((UHOS_NULL != own_cert) && (own_cert_len > 0))
+    {
+        if ((UHOS_NULL == priv_key) || (0 == priv_key_len) || (0 != esp32_tls_parse_crt(&store->own, own_cert, own_cert_len)))
+        {
+            UHOS_LOGE("bad own cert");
+            goto fail;
+        }
+        ret = esp32_tls_parse_key(&store->key, priv_key, priv_key_len);
+        if (0 != ret)
+        {
+            UHOS_LOGE("bad private key -0x%04x", (unsigned)-ret);
+            goto fail;
+        }
+        store->has_own = 1;
+    }
+
+    return store;
+
+fail:
+    uhos_tls_store_release(store);
+    return UHOS_NULL;
+}
+
+uhos_void uhos_tls_store_release(uhos_void *store)
+{
+    esp32_tls_store_t *s = store;
+
+    if ((UHOS_NULL == s) || (0 != __atomic_sub_fetch(&s->refs, 1, __ATOMIC_ACQ_REL)))
+    {
+        return;
+    }
+
+    mbedtls_x509_crt_free(&s->ca);
+    mbedtls_x509_crt_free(&s->own);
+    mbedtls_pk_free(&s->key);
+    uhos_libc_free(s);
+    __atomic_sub_fetch(&g_esp32_tls_stat.stores, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&g_esp32_tls_stat.ctx_free, 1, __ATOMIC_RELAXED);
+}
+
+uhos_s32 uhos_tls_store_get_cert_cn(uhos_void *store, uhos_u8 *cert_cn_buf, uhos_size_t cert_cn_buf_len)
+{
+    esp32_tls_store_t *s = store;
+
+    if ((UHOS_NULL == s) || !s->has_own || (UHOS_NULL == cert_cn_buf) || (0 == cert_cn_buf_len))
+    {
+        return -1;
+    }
+
+    return esp32_tls_crt_cn(&s->own, cert_cn_buf, cert_cn_buf_len);
+}
+
+uhos_s32 uhos_tls_set_ca_store(uhos_void *handle, uhos_void *store)
+{
+    esp32_tls_t       *tls = handle;
+    esp32_tls_store_t *s   = store;
+
+    if ((UHOS_NULL == tls) || tls->started)
+    {
+        return -1;
+    }
+
+    if (UHOS_NULL != s)
+    {
+        __atomic_add_fetch(&s->refs, 1, __ATOMIC_RELAXED);
+    }
+    uhos_tls_store_release(tls->store);
+    tls->store = s;
+
+    return 0;
+}
+
+uhos_s32 uhos_tls_store_get_refs(uhos_void *store)
+{
+    esp32_tls_store_t *s = store;
+
+    return (UHOS_NULL != s) ? __atomic_load_n(&s->refs, __ATOMIC_ACQUIRE) : -1;
+}
+
+uhos_s32 uhos_tls_store_get_stat(uhos_tls_store_stat_t *stat)
+{
+    if (UHOS_NULL == stat)
+    {
+        return -1;
+    }
+
+    stat->stores     = __atomic_load_n(&g_esp32_tls_stat.stores, __ATOMIC_RELAXED);
+    stat->ctx_new    = __atomic_load_n(&g_esp32_tls_stat.ctx_new, __ATOMIC_RELAXED);
+    stat->ctx_free   = __atomic_load_n(&g_esp32_tls_stat.ctx_free, __ATOMIC_RELAXED);
+    stat->ctx_shared = __atomic_load_n(&g_esp32_tls_stat.ctx_shared, __ATOMIC_RELAXED);
+
+    return 0;
+}
+
+uhos_s32 uhos_tls_session_save(uhos_void *handle, uhos_u8 *buf, uhos_size_t buf_len)
+{
+    esp32_tls_t        *tls     = handle;
+    mbedtls_ssl_session session;
+    size_t              olen    = 0;
+    int                 ret     = 0;
+
+    if ((UHOS_NULL == tls) || !tls->started)
+    {
+        return -1;
+    }
+
+    mbedtls_ssl_session_init(&session);
+    ret = mbedtls_ssl_get_session(&tls->ssl, &session);
+    if (0 == ret)
+    {
+        ret = mbedtls_ssl_session_save(&session, buf, (UHOS_NULL != buf) ? buf_len : 0, &olen);
+        if ((UHOS_NULL == buf) && (MBEDTLS_ERR_SSL_BUFFER_TOO_SMALL == ret))
+        {
+            ret = 0;
+        }
+    }
+    mbedtls_ssl_session_free(&session);
+
+    return ((0 == ret) && (olen > 0)) ? (uhos_s32)olen : -1;
+}
+
+uhos_s32 uhos_tls_session_restore(uhos_void *handle, const uhos_u8 *buf, uhos_size_t buf_len)
+{
+    esp32_tls_t         *tls     = handle;
+    mbedtls_ssl_session *session = UHOS_NULL;
+    int                  ret     = 0;
+
+    if ((UHOS_NULL == tls) || (UHOS_NULL == buf) || (0 == buf_len))
+    {
+        return -1;
+    }
+
+    session = uhos_libc_malloc(sizeof(mbedtls_ssl_session));
+    if (UHOS_NULL == session)
+    {
+        UHOS_LOG_MEM_ALLOC_FAIL();
+        return -1;
+    }
+    mbedtls_ssl_session_init(session);
+    if (0 != mbedtls_ssl_session_load(session, buf, buf_len))
+    {
+        mbedtls_ssl_session_free(session);
+        uhos_libc_free(session);
+        return -1;
+    }
+
+    if (!tls->started)
+    {
+        if (UHOS_NULL != tls->session)
+        {
+            mbedtls_ssl_session_free(tls->session);
+            uhos_libc_free(tls->session);
+        }
+        tls->session = session;
+        return 0;
+    }
+
+    ret = mbedtls_ssl_set_session(&tls->ssl, session);
+    mbedtls_ssl_session_free(session);
+    uhos_libc_free(session);
+    tls->restored = (0 == ret);
+
+    return (0 == ret) ? 0 : -1;
+}
+
+uhos_s32 uhos_tls_session_reused(uhos_void *handle)
+{
+    esp32_tls_t *tls = handle;
+
+    if ((UHOS_NULL == tls) || !tls->started || !mbedtls_ssl_is_handshake_over(&tls->ssl))
+    {
+        return 0;
+    }
+
+    // 不校验服务器证书时完整握手也不会调用校验回调，无法区分
+    return (tls->restored && (UHOS_NULL != tls->store ? tls->store->has_ca : tls->has_ca) && !tls->verified) ? 1 : 0;
+}
+
+uhos_s32 uhos_tls_session_zone_read(uhos_u8 zone, uhos_u8 *buf, uhos_size_t len)
+{
+    nvs_handle_t nvs  = 0;
+    char         key[ESP32_TLS_NVS_KEY_LEN];
+    size_t       size = len;
+    esp_err_t    err  = ESP_OK;
+
+    if ((UHOS_NULL == buf) || (0 == len))
+    {
+        return -1;
+    }
+
+    if (0 != esp32_tls_nvs_open(NVS_READONLY, &nvs))
+    {
+        return -1;
+    }
+    snprintf(key, sizeof(key), "zone%u", (unsigned)zone);
+    err = nvs_get_blob(nvs, key, buf, &size);
+    nvs_close(nvs);
+
+    return (ESP_OK == err) ? 0 : -1;
+}
+
+uhos_s32 uhos_tls_session_zone_write(uhos_u8 zone, const uhos_u8 *buf, uhos_size_t len)
+{
+    nvs_handle_t nvs = 0;
+    char         key[ESP32_TLS_NVS_KEY_LEN];
+    esp_err_t    err = ESP_OK;
+
+    if ((UHOS_NULL == buf) || (0 == len))
+    {
+        return -1;
+    }
+
+    if (0 != esp32_tls_nvs_open(NVS_READWRITE, &nvs))
+    {
+        return -1;
+    }
+    snprintf(key, sizeof(key), "zone%u", (unsigned)zone);
+    err = nvs_set_blob(nvs, key, buf, len);
+    if (ESP_OK == err)
+    {
+        err = nvs_commit(nvs);
+    }
+    nvs_close(nvs);
+
+    return (ESP_OK == err) ? 0 : -1;
+}
@@ -0,0 +1,133 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_verify.c
+ * @author agent (agent@local)
+ * @brief 基于ESP-IDF mbedtls(3.x)的uh_verify实现
+ * @details md句柄即mbedtls_md_context_t。开启CONFIG_MBEDTLS_HARDWARE_SHA时SHA1/SHA224/SHA256/SHA384/SHA512
+ *          由芯片SHA外设计算。mbedtls 3.x的mbedtls_md_type_t与UHOS_MD_TYPE_E取值不同，按类型逐一映射
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：基于ESP-IDF mbedtls(3.x)的uh_verify实现
+ * </table>
+ */
+
+#define LOG_TAG "esp32_verify"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "mbedtls/md.h"
+
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_verify.h"
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static const mbedtls_md_info_t *esp32_md_get(UHOS_MD_TYPE_E md_type)
+{
+    switch (md_type)
+    {
+        case UHOS_MD_MD5:
+            return mbedtls_md_info_from_type(MBEDTLS_MD_MD5);
+        case UHOS_MD_SHA1:
+            return mbedtls_md_info_from_type(MBEDTLS_MD_SHA1);
+        case UHOS_MD_SHA224:
+            return mbedtls_md_info_from_type(MBEDTLS_MD_SHA224);
+        case UHOS_MD_SHA256:
+            return mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
+        case UHOS_MD_SHA384:
+            return mbedtls_md_info_from_type(MBEDTLS_MD_SHA384);
+        case UHOS_MD_SHA512:
+            return mbedtls_md_info_from_type(MBEDTLS_MD_SHA512);
+        case UHOS_MD_RIPEMD160:
+            return mbedtls_md_info_from_type(MBEDTLS_MD_RIPEMD160);
+        default:
+            return UHOS_NULL;                                   // mbedtls 3.x已移除MD2/MD4
+    }
+}
+
+/**************************************************************************************************/
+/*                                          外部函数实现                                          */
+/**************************************************************************************************/
+uhos_void *uhos_md_init(UHOS_MD_TYPE_E md_type)
+{
+    const mbedtls_md_info_t *info = esp32_md_get(md_type);
+    mbedtls_md_context_t    *ctx  = UHOS_NULL;
+
+    if (UHOS_NULL == info)
+    {
+        return UHOS_NULL;
+    }
+
+    ctx = (mbedtls_md_context_t *)uhos_libc_malloc(sizeof(mbedtls_md_context_t));
+    if (UHOS_NULL == ctx)
+    {
+        return UHOS_NULL;
+    }
+
+    mbedtls_md_init(ctx);
+    if ((0 != mbedtls_md_setup(ctx, info, 0)) || (0 != mbedtls_md_starts(ctx)))
+    {
+        UHOS_LOGE("md %d setup failed", md_type);
+        mbedtls_md_free(ctx);
+        uhos_libc_free(ctx);
+        return UHOS_NULL;
+    }
+
+    return ctx;
+}
+
+uhos_void uhos_md_update(uhos_void *md_ctx, uhos_u8 *buf, uhos_size_t len)
+{
+    if ((UHOS_NULL == md_ctx) || ((UHOS_NULL == buf) && (len > 0)))
+    {
+        return;
+    }
+
+    mbedtls_md_update((mbedtls_md_context_t *)md_ctx, buf, len);
+}
+
+uhos_s32 uhos_md_get_size(UHOS_MD_TYPE_E md_type)
+{
+    const mbedtls_md_info_t *info = esp32_md_get(md_type);
+
+    if (UHOS_NULL == info)
+    {
+        return -1;
+    }
+
+    return mbedtls_md_get_size(info);
+}
+
+uhos_void uhos_md_finish(uhos_void *md_ctx, uhos_u8 *output)
+{
+    if (UHOS_NULL == md_ctx)
+    {
+        return;
+    }
+
+    if (UHOS_NULL != output)
+    {
+        mbedtls_md_finish((mbedtls_md_context_t *)md_ctx, output);
+    }
+    mbedtls_md_free((mbedtls_md_context_t *)md_ctx);
+    uhos_libc_free(md_ctx);
+}
+
+uhos_s32 uhos_md_hmac(UHOS_MD_TYPE_E md_type, const uhos_u8 *key, uhos_size_t keylen, const uhos_u8 *input, uhos_size_t ilen, uhos_u8 *output)
+{
+    const mbedtls_md_info_t *info = esp32_md_get(md_type);
+
+    if (UHOS_NULL == info)
+    {
+        return MBEDTLS_ERR_MD_BAD_INPUT_DATA;
+    }
+
+    return mbedtls_md_hmac(info, key, keylen, input, ilen, output);
+}
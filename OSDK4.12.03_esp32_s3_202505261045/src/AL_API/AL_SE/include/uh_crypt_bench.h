@@ -0,0 +1,111 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_crypt_bench.h
+ * @author agent (agent@local)
+ * @brief aes各模式、各消息长度吞吐率基准测试的接口头文件
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：aes加解密测试与基准测试的接口头文件
+ * </table>
+ */
+
+#ifndef __UH_CRYPT_BENCH_H__
+#define __UH_CRYPT_BENCH_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_bench.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+// 基准测试每个用例处理的总字节数
+#ifndef CONFIG_UHOS_CRYPT_BENCH_BYTES
+#define CONFIG_UHOS_CRYPT_BENCH_BYTES       (256 * 1024)
+#endif
+
+// 基准测试的最大消息长度
+#define UHOS_CRYPT_BENCH_SIZE_MAX           4096
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+/**
+ * @enum        加密模式
+ */
+typedef enum
+{
+    UHOS_CRYPT_BENCH_CBC = 0,                                   //<! uhos_aes_crypt_cbc
+    UHOS_CRYPT_BENCH_CTR,                                       //<! uhos_aes_crypt_ctr
+    UHOS_CRYPT_BENCH_GCM,                                       //<! 每条消息starts、update、finish
+    UHOS_CRYPT_BENCH_MODE_MAX,
+} uhos_crypt_bench_mode_t;
+
+/**
+ * @struct      基准测试用例
+ */
+typedef struct uhos_crypt_bench_case
+{
+    uhos_crypt_bench_mode_t mode;                               //<! 加密模式
+    uhos_u32                keybits;                            //<! 秘钥bit位数
+    uhos_u32                size;                               //<! 每条消息的长度，16的倍数，不超过UHOS_CRYPT_BENCH_SIZE_MAX
+    uhos_u32                bytes;                              //<! 处理的总字节数
+} uhos_crypt_bench_case_t;
+
+/**
+ * @struct      基准测试结果
+ */
+typedef struct uhos_crypt_bench_result
+{
+    uhos_s32 status;                                            //<! 0-成功，-1-失败
+    uhos_u32 msgs;                                              //<! 处理的消息数
+    uhos_u32 elapsed_us;                                        //<! 总耗时
+    uhos_u32 kbps;                                              //<! 吞吐率，千字节每秒
+} uhos_crypt_bench_result_t;
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       执行一个基准测试用例
+ * @param[in]   bcase   用例
+ * @param[out]  result  结果
+ * @return      0-成功，-1-失败
+ */
+uhos_s32 uhos_crypt_bench_run(const uhos_crypt_bench_case_t *bcase, uhos_crypt_bench_result_t *result);
+
+/**
+ * @brief       将用例与结果格式化为一行JSON
+ * @return      写入的字符数
+ */
+uhos_s32 uhos_crypt_bench_result_json(const uhos_crypt_bench_case_t *bcase, const uhos_crypt_bench_result_t *result, uhos_char *buf,
+                                      uhos_u32 size);
+
+/**
+ * @brief       依次执行各加密模式与消息长度的用例，每个用例输出一行JSON
+ * @param[in]   print   输出回调
+ * @return      0-全部成功，-1-有用例失败
+ */
+uhos_s32 uhos_crypt_bench_matrix_run(uhos_bench_print_t print);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_CRYPT_BENCH_H__
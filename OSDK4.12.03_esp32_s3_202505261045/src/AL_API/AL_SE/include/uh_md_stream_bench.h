@@ -0,0 +1,136 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_md_stream_bench.h
+ * @author agent (agent@local)
+ * @brief 流式摘要与写完后读回计算摘要的耗时对比基准测试的接口头文件
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：流式摘要耗时对比基准测试的接口头文件
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>输出与计时改用uh_bench.h
+ * </table>
+ */
+
+#ifndef __UH_MD_STREAM_BENCH_H__
+#define __UH_MD_STREAM_BENCH_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_bench.h"
+#include "uh_verify.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+// 矩阵中的镜像长度
+#ifndef CONFIG_UHOS_MD_STREAM_BENCH_LEN
+#define CONFIG_UHOS_MD_STREAM_BENCH_LEN     (1024 * 1024)
+#endif
+
+// 矩阵中每次写入的长度
+#ifndef CONFIG_UHOS_MD_STREAM_BENCH_CHUNK
+#define CONFIG_UHOS_MD_STREAM_BENCH_CHUNK   4096
+#endif
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+/**
+ * @enum        摘要方式
+ */
+typedef enum
+{
+    UHOS_MD_STREAM_BENCH_READBACK = 0,                          //<! 写完后读回整个镜像及各子固件计算摘要
+    UHOS_MD_STREAM_BENCH_STREAM,                                //<! 按顺序写入，写入时计算
+    UHOS_MD_STREAM_BENCH_SWAPPED,                               //<! 第2、3段交换顺序写入，从空缺处起结束时读回
+    UHOS_MD_STREAM_BENCH_REWRITE,                               //<! 写到一半时重写第1段，结束时全部读回
+    UHOS_MD_STREAM_BENCH_MODE_MAX,
+} uhos_md_stream_bench_mode_t;
+
+/**
+ * @brief       写入存储的回调
+ * @return      0-成功，-1-失败
+ */
+typedef uhos_s32 (*uhos_md_stream_bench_write_t)(uhos_u32 offset, const uhos_u8 *buf, uhos_u32 len, uhos_void *arg);
+
+/**
+ * @struct      被测存储，如OTA分区
+ */
+typedef struct uhos_md_stream_bench_target
+{
+    uhos_md_stream_bench_write_t write;                         //<! 写入
+    uhos_md_read_cb_t            read;                          //<! 读回
+    uhos_void                   *arg;                           //<! 回调参数
+} uhos_md_stream_bench_target_t;
+
+/**
+ * @struct      基准测试用例
+ */
+typedef struct uhos_md_stream_bench_case
+{
+    uhos_md_stream_bench_mode_t mode;                           //<! 摘要方式
+    uhos_u32                    image_len;                      //<! 镜像长度，chunk的整数倍且不少于4段
+    uhos_u32                    chunk;                          //<! 每次写入的长度
+} uhos_md_stream_bench_case_t;
+
+/**
+ * @struct      基准测试结果
+ */
+typedef struct uhos_md_stream_bench_result
+{
+    uhos_s32 status;                                            //<! 0-摘要与参考值一致，-1-不一致或出错
+    uhos_u32 write_us;                                          //<! 写入全部数据的耗时，流式方式含写入时的摘要计算
+    uhos_u32 ready_us;                                          //<! 写完到全部摘要可用的耗时
+    uhos_u32 streamed;                                          //<! 写入时计算摘要的字节数
+    uhos_u32 read_back;                                         //<! 写完后读回的字节数
+} uhos_md_stream_bench_result_t;
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       执行一个用例：按偏移生成镜像数据写入存储，以SHA256计算整体摘要，
+ *              另以SHA256、SHA256、MD5计算三个子固件区间及一个空区间的摘要，与直接对生成数据计算的参考值比较
+ * @param[in]   target  被测存储，长度不小于image_len
+ * @param[in]   bcase   用例
+ * @param[out]  result  结果
+ * @return      0-成功，-1-失败
+ */
+uhos_s32 uhos_md_stream_bench_run(const uhos_md_stream_bench_target_t *target, const uhos_md_stream_bench_case_t *bcase,
+                                  uhos_md_stream_bench_result_t *result);
+
+/**
+ * @brief       将用例与结果格式化为一行JSON
+ * @return      写入的字符数
+ */
+uhos_s32 uhos_md_stream_bench_result_json(const uhos_md_stream_bench_case_t *bcase, const uhos_md_stream_bench_result_t *result,
+                                          uhos_char *buf, uhos_u32 size);
+
+/**
+ * @brief       依次执行四种摘要方式的用例，每个用例输出一行JSON
+ * @param[in]   target  被测存储，长度不小于CONFIG_UHOS_MD_STREAM_BENCH_LEN
+ * @param[in]   print   输出回调
+ * @return      0-全部成功，-1-有用例失败
+ */
+uhos_s32 uhos_md_stream_bench_matrix_run(const uhos_md_stream_bench_target_t *target, uhos_bench_print_t print);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_MD_STREAM_BENCH_H__
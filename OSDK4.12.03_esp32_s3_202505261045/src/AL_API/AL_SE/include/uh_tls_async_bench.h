@@ -0,0 +1,121 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_tls_async_bench.h
+ * @author agent (agent@local)
+ * @brief 异步tls握手并发测试的接口头文件，在一个或多个事件循环中同时握手多个连接
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：异步tls握手并发测试的接口头文件
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>输出与计时改用uh_bench.h
+ * </table>
+ */
+
+#ifndef __UH_TLS_ASYNC_BENCH_H__
+#define __UH_TLS_ASYNC_BENCH_H__
+
+/**************************************************************************************************/
+/*                         #include (依次为标准库头文件、非标准库头文件)                          */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_bench.h"
+
+/**************************************************************************************************/
+/*                                        其他条件编译选项                                        */
+/**************************************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**************************************************************************************************/
+/*                                          全局宏定义                                            */
+/**************************************************************************************************/
+// 一个用例最多同时握手的连接数
+#ifndef CONFIG_UHOS_TLS_ASYNC_BENCH_LINKS
+#define CONFIG_UHOS_TLS_ASYNC_BENCH_LINKS   32
+#endif
+
+// 最多的事件循环数
+#define UHOS_TLS_ASYNC_BENCH_LOOPS_MAX      2
+
+
+/**************************************************************************************************/
+/*                                       全局数据类型定义                                         */
+/**************************************************************************************************/
+/**
+ * @struct      被测服务器
+ */
+typedef struct uhos_tls_async_bench_target
+{
+    const uhos_char *ip;                                        //<! 服务器点分十进制IP地址
+    uhos_u16         port;                                      //<! 服务器端口
+    const uhos_u8   *ca_cert;                                   //<! CA证书
+    uhos_size_t      ca_cert_len;
+} uhos_tls_async_bench_target_t;
+
+/**
+ * @struct      测试用例
+ */
+typedef struct uhos_tls_async_bench_case
+{
+    uhos_u32 links;                                             //<! 同时握手的连接数，平均分到各事件循环
+    uhos_u32 loops;                                             //<! 事件循环数，每个一个线程与一个poller
+    uhos_u32 stalled;                                           //<! 每个事件循环中连接到不应答的本地端口、应超时的连接数
+    uhos_u32 timeout_ms;                                        //<! 握手超时
+} uhos_tls_async_bench_case_t;
+
+/**
+ * @struct      测试结果
+ */
+typedef struct uhos_tls_async_bench_result
+{
+    uhos_s32 status;                                            //<! 0-结果与预期一致，-1-不一致或出错
+    uhos_u32 ok;                                                //<! 握手成功数
+    uhos_u32 failed;                                            //<! 握手失败数
+    uhos_u32 timeout;                                           //<! 握手超时数
+    uhos_u32 foreign;                                           //<! 在其他事件循环线程中回调的次数，应为0
+    uhos_u32 repeated;                                          //<! 同一连接重复回调的次数，应为0
+    uhos_u32 elapsed_us;                                        //<! 从发起握手到全部结束的耗时
+    uhos_u32 max_us;                                            //<! 成功握手中最慢的完成时刻
+} uhos_tls_async_bench_result_t;
+
+
+/**************************************************************************************************/
+/*                                         全局函数原型                                           */
+/**************************************************************************************************/
+/**
+ * @brief       执行一个用例：先以阻塞方式建立全部TCP连接，再在各事件循环线程中发起异步握手，
+ *              以uhos_tls_handshake_poll驱动到该循环上的握手全部结束
+ * @param[in]   target  被测服务器
+ * @param[in]   bcase   用例
+ * @param[out]  result  结果
+ * @return      0-成功，-1-失败
+ */
+uhos_s32 uhos_tls_async_bench_run(const uhos_tls_async_bench_target_t *target, const uhos_tls_async_bench_case_t *bcase,
+                                  uhos_tls_async_bench_result_t *result);
+
+/**
+ * @brief       将用例与结果格式化为一行JSON
+ * @return      写入的字符数
+ */
+uhos_s32 uhos_tls_async_bench_result_json(const uhos_tls_async_bench_case_t *bcase, const uhos_tls_async_bench_result_t *result,
+                                          uhos_char *buf, uhos_u32 size);
+
+/**
+ * @brief       依次执行一个与两个事件循环、有无超时连接的用例，每个用例CONFIG_UHOS_TLS_ASYNC_BENCH_LINKS个连接，
+ *              每个用例输出一行JSON
+ * @param[in]   target  被测服务器
+ * @param[in]   print   输出回调
+ * @return      0-全部成功，-1-有用例失败
+ */
+uhos_s32 uhos_tls_async_bench_matrix_run(const uhos_tls_async_bench_target_t *target, uhos_bench_print_t print);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __UH_TLS_ASYNC_BENCH_H__
@@ -0,0 +1,465 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_crypt.c
+ * @author agent (agent@local)
+ * @brief 基于OpenSSL EVP的uh_crypt实现，用于Linux主机
+ * @details EVP按CPU特性选择AES-NI/VAES或查表实现。秘钥在setkey时只扩展一次，
+ *          每次加解密只重设iv，CBC/CTR/GCM的整块数据一次交给EVP处理；
+ *          CTR不足一块的首尾部分按保存的密钥流块逐字节处理，分段结果与一次处理相同
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：基于OpenSSL EVP的uh_crypt实现，用于Linux主机
+ * </table>
+ */
+
+#define LOG_TAG "linux_crypt"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include <openssl/evp.h>
+
+#include "uh_types.h"
+#include "uh_log.h"
+#include "uh_crypt.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define LINUX_AES_BLOCK         16
+#define LINUX_AES_CHUNK         0x40000000                      // EVP长度参数为int，超长数据分块处理
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      aes句柄
+ */
+typedef struct
+{
+    EVP_CIPHER_CTX *ecb;                                        //<! 加密秘钥，生成CTR首尾的密钥流块
+    EVP_CIPHER_CTX *ctr;                                        //<! 加密秘钥
+    EVP_CIPHER_CTX *cbc_enc;                                    //<! 加密秘钥
+    EVP_CIPHER_CTX *cbc_dec;                                    //<! 解密秘钥
+    uhos_bool       has_enc;
+    uhos_bool       has_dec;
+    uhos_u8         ctr_next[LINUX_AES_BLOCK];                  //<! ctr内部状态对应的计数器，与传入的一致时不重设iv
+    uhos_u8         cbc_next[2][LINUX_AES_BLOCK];               //<! cbc_dec/cbc_enc内部状态对应的iv
+    uhos_bool       ctr_valid;
+    uhos_bool       cbc_valid[2];
+} linux_aes_t;
+
+/**
+ * @struct      gcm句柄
+ */
+typedef struct
+{
+    EVP_CIPHER_CTX *ctx;
+    uhos_bool       has_key;
+    uhos_bool       started;                                    //<! starts之后、finish之前
+    int             enc;
+    uhos_size_t     iv_len;                                     //<! 当前设置的iv长度，不变时不重设
+} linux_gcm_t;
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static const EVP_CIPHER *linux_aes_cipher(char mode, uhos_u32 keybits)
+{
+    switch (keybits)
+    {
+        case 128:
+            return ('e' == mode) ? EVP_aes_128_ecb() : ('c' == mode) ? EVP_aes_128_cbc() : ('t' == mode) ? EVP_aes_128_ctr() : EVP_aes_128_gcm();
+        case 192:
+            return ('e' == mode) ? EVP_aes_192_ecb() : ('c' == mode) ? EVP_aes_192_cbc() : ('t' == mode) ? EVP_aes_192_ctr() : EVP_aes_192_gcm();
+        case 256:
+            return ('e' == mode) ? EVP_aes_256_ecb() : ('c' == mode) ? EVP_aes_256_cbc() : ('t' == mode) ? EVP_aes_256_ctr() : EVP_aes_256_gcm();
+        default:
+            return NULL;
+    }
+}
+
+/**
+ * @brief       设置秘钥，关闭填充
+ */
+static int linux_aes_key(EVP_CIPHER_CTX *ctx, char mode, const uhos_u8 *key, uhos_u32 keybits, int enc)
+{
+    const EVP_CIPHER *cipher = linux_aes_cipher(mode, keybits);
+
+    if ((NULL == cipher) || (1 != EVP_CipherInit_ex(ctx, cipher, NULL, key, NULL, enc)))
+    {
+        return -1;
+    }
+    EVP_CIPHER_CTX_set_padding(ctx, 0);
+
+    return 0;
+}
+
+static int linux_aes_update(EVP_CIPHER_CTX *ctx, uhos_u8 *output, const uhos_u8 *input, uhos_size_t length)
+{
+    uhos_size_t n    = 0;
+    int         olen = 0;
+
+    while (length > 0)
+    {
+        n = (length > LINUX_AES_CHUNK) ? LINUX_AES_CHUNK : length;
+        if (1 != EVP_CipherUpdate(ctx, output, &olen, input, (int)n))
+        {
+            return -1;
+        }
+        input += n;
+        output += n;
+        length -= n;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       128位大端计数器加n
+ */
+static void linux_aes_counter_add(uhos_u8 counter[16], uhos_size_t n)
+{
+    int i = LINUX_AES_BLOCK - 1;
+    uhos_u64 sum = 0;
+
+    for (; (i >= 0) && (n > 0); i--)
+    {
+        sum        = (uhos_u64)counter[i] + (n & 0xFF);
+        counter[i] = (uhos_u8)sum;
+        n          = (n >> 8) + (uhos_size_t)(sum >> 8);
+    }
+}
+
+/**************************************************************************************************/
+/*                                          外部函数实现                                          */
+/**************************************************************************************************/
+uhos_void *uhos_aes_init(uhos_void)
+{
+    linux_aes_t *aes = calloc(1, sizeof(linux_aes_t));
+
+    if (NULL == aes)
+    {
+        return NULL;
+    }
+
+    aes->ecb     = EVP_CIPHER_CTX_new();
+    aes->ctr     = EVP_CIPHER_CTX_new();
+    aes->cbc_enc = EVP_CIPHER_CTX_new();
+    aes->cbc_dec = EVP_CIPHER_CTX_new();
+    if ((NULL == aes->ecb) || (NULL == aes->ctr) || (NULL == aes->cbc_enc) || (NULL == aes->cbc_dec))
+    {
+        uhos_aes_free(aes);
+        return NULL;
+    }
+
+    return aes;
+}
+
+uhos_void uhos_aes_free(uhos_void *ctx)
+{
+    linux_aes_t *aes = (linux_aes_t *)ctx;
+
+    if (NULL == aes)
+    {
+        return;
+    }
+
+    EVP_CIPHER_CTX_free(aes->ecb);
+    EVP_CIPHER_CTX_free(aes->ctr);
+    EVP_CIPHER_CTX_free(aes->cbc_enc);
+    EVP_CIPHER_CTX_free(aes->cbc_dec);
+    free(aes);
+}
+
+uhos_s32 uhos_aes_setkey_dec(uhos_void *ctx, const uhos_u8 *key, uhos_u32 keybits)
+{
+    linux_aes_t *aes = (linux_aes_t *)ctx;
+
+    if ((NULL == aes) || (NULL == key))
+    {
+        return -1;
+    }
+
+    aes->cbc_valid[UHOS_AES_DECRYPT] = UHOS_FALSE;
+    aes->has_dec                     = (0 == linux_aes_key(aes->cbc_dec, 'c', key, keybits, 0));
+    return aes->has_dec ? 0 : -1;
+}
+
+uhos_s32 uhos_aes_setkey_enc(uhos_void *ctx, const uhos_u8 *key, uhos_u32 keybits)
+{
+    linux_aes_t *aes = (linux_aes_t *)ctx;
+
+    if ((NULL == aes) || (NULL == key))
+    {
+        return -1;
+    }
+
+    aes->ctr_valid                   = UHOS_FALSE;
+    aes->cbc_valid[UHOS_AES_ENCRYPT] = UHOS_FALSE;
+    aes->has_enc = (0 == linux_aes_key(aes->ecb, 'e', key, keybits, 1)) && (0 == linux_aes_key(aes->ctr, 't', key, keybits, 1)) &&
+                   (0 == linux_aes_key(aes->cbc_enc, 'c', key, keybits, 1));
+    return aes->has_enc ? 0 : -1;
+}
+
+uhos_s32 uhos_aes_crypt_cbc(uhos_void *ctx, UHOS_AES_CRYPT_E crypt_mode, uhos_size_t length, uhos_u8 iv[16], const uhos_u8 *input, uhos_u8 *output)
+{
+    linux_aes_t    *aes = (linux_aes_t *)ctx;
+    EVP_CIPHER_CTX *evp = NULL;
+    int             dir = (UHOS_AES_ENCRYPT == crypt_mode) ? 1 : 0;
+    uhos_u8         next_iv[LINUX_AES_BLOCK];
+
+    if ((NULL == aes) || (NULL == iv) || (0 != (length % LINUX_AES_BLOCK)))
+    {
+        return -1;
+    }
+    if (0 == length)
+    {
+        return 0;
+    }
+
+    if (UHOS_AES_ENCRYPT == crypt_mode)
+    {
+        if (!aes->has_enc)
+        {
+            return -1;
+        }
+        evp = aes->cbc_enc;
+    }
+    else
+    {
+        if (!aes->has_dec)
+        {
+            return -1;
+        }
+        evp = aes->cbc_dec;
+        // 原地解密会覆盖最后一个密文块，先保存为下一个iv
+        memcpy(next_iv, input + length - LINUX_AES_BLOCK, LINUX_AES_BLOCK);
+    }
+
+    // 接续上一次调用时EVP内部的iv即为传入的iv，省去重设
+    if (!aes->cbc_valid[dir] || (0 != memcmp(iv, aes->cbc_next[dir], LINUX_AES_BLOCK)))
+    {
+        if (1 != EVP_CipherInit_ex(evp, NULL, NULL, NULL, iv, -1))
+        {
+            return -1;
+        }
+    }
+    aes->cbc_valid[dir] = UHOS_FALSE;
+    if (0 != linux_aes_update(evp, output, input, length))
+    {
+        return -1;
+    }
+
+    memcpy(iv, dir ? output + length - LINUX_AES_BLOCK : next_iv, LINUX_AES_BLOCK);
+    memcpy(aes->cbc_next[dir], iv, LINUX_AES_BLOCK);
+    aes->cbc_valid[dir] = UHOS_TRUE;
+    return 0;
+}
+
+uhos_s32 uhos_aes_crypt_ctr(uhos_void *ctx, uhos_size_t length, uhos_size_t *nc_off, uhos_u8 nonce_counter[16], uhos_u8 stream_block[16],
+                            const uhos_u8 *input, uhos_u8 *output)
+{
+    linux_aes_t *aes    = (linux_aes_t *)ctx;
+    uhos_size_t  n      = 0;
+    uhos_size_t  blocks = 0;
+    int          olen   = 0;
+
+    if ((NULL == aes) || !aes->has_enc || (NULL == nc_off) || (*nc_off >= LINUX_AES_BLOCK) || (NULL == nonce_counter) || (NULL == stream_block))
+    {
+        return -1;
+    }
+
+    // 上一段剩余的密钥流
+    n = *nc_off;
+    while ((n != 0) && (length > 0))
+    {
+        *output++ = *input++ ^ stream_block[n];
+        n         = (n + 1) & (LINUX_AES_BLOCK - 1);
+        length--;
+    }
+
+    blocks = length / LINUX_AES_BLOCK;
+    if (blocks > 0)
+    {
+        if (!aes->ctr_valid || (0 != memcmp(nonce_counter, aes->ctr_next, LINUX_AES_BLOCK)))
+        {
+            if (1 != EVP_CipherInit_ex(aes->ctr, NULL, NULL, NULL, nonce_counter, -1))
+            {
+                return -1;
+            }
+        }
+        aes->ctr_valid = UHOS_FALSE;
+        if (0 != linux_aes_update(aes->ctr, output, input, blocks * LINUX_AES_BLOCK))
+        {
+            return -1;
+        }
+        linux_aes_counter_add(nonce_counter, blocks);
+        memcpy(aes->ctr_next, nonce_counter, LINUX_AES_BLOCK);
+        aes->ctr_valid = UHOS_TRUE;
+        input += blocks * LINUX_AES_BLOCK;
+        output += blocks * LINUX_AES_BLOCK;
+        length -= blocks * LINUX_AES_BLOCK;
+    }
+
+    // 不足一块的尾部，密钥流块留给下一段
+    if (length > 0)
+    {
+        if (1 != EVP_CipherUpdate(aes->ecb, stream_block, &olen, nonce_counter, LINUX_AES_BLOCK))
+        {
+            return -1;
+        }
+        linux_aes_counter_add(nonce_counter, 1);
+        for (n = 0; n < length; n++)
+        {
+            output[n] = input[n] ^ stream_block[n];
+        }
+    }
+
+    *nc_off = n;
+    return 0;
+}
+
+uhos_void *uhos_aes_gcm_init(uhos_void)
+{
+    linux_gcm_t *gcm = calloc(1, sizeof(linux_gcm_t));
+
+    if (NULL == gcm)
+    {
+        return NULL;
+    }
+
+    gcm->ctx = EVP_CIPHER_CTX_new();
+    if (NULL == gcm->ctx)
+    {
+        free(gcm);
+        return NULL;
+    }
+
+    return gcm;
+}
+
+uhos_void uhos_aes_gcm_free(uhos_void *ctx)
+{
+    linux_gcm_t *gcm = (linux_gcm_t *)ctx;
+
+    if (NULL == gcm)
+    {
+        return;
+    }
+
+    EVP_CIPHER_CTX_free(gcm->ctx);
+    free(gcm);
+}
+
+uhos_s32 uhos_aes_gcm_setkey(uhos_void *ctx, const uhos_u8 *key, uhos_u32 keybits)
+{
+    linux_gcm_t *gcm = (linux_gcm_t *)ctx;
+
+    if ((NULL == gcm) || (NULL == key))
+    {
+        return -1;
+    }
+
+    gcm->started = UHOS_FALSE;
+    gcm->iv_len  = 12;                                          // EVP默认的iv长度
+    gcm->has_key = (0 == linux_aes_key(gcm->ctx, 'g', key, keybits, 1));
+    return gcm->has_key ? 0 : -1;
+}
+
+uhos_s32 uhos_aes_gcm_starts(uhos_void *ctx, UHOS_AES_CRYPT_E crypt_mode, const uhos_u8 *iv, uhos_size_t iv_len, const uhos_u8 *add,
+                             uhos_size_t add_len)
+{
+    linux_gcm_t *gcm  = (linux_gcm_t *)ctx;
+    int          olen = 0;
+
+    if ((NULL == gcm) || !gcm->has_key || (NULL == iv) || (0 == iv_len) || (iv_len > 128) || ((NULL == add) && (add_len > 0)))
+    {
+        return -1;
+    }
+
+    gcm->enc     = (UHOS_AES_ENCRYPT == crypt_mode) ? 1 : 0;
+    gcm->started = UHOS_FALSE;
+
+    // 秘钥已在setkey时扩展，这里只设置iv与方向
+    if (iv_len != gcm->iv_len)
+    {
+        if (1 != EVP_CIPHER_CTX_ctrl(gcm->ctx, EVP_CTRL_GCM_SET_IVLEN, (int)iv_len, NULL))
+        {
+            return -1;
+        }
+        gcm->iv_len = iv_len;
+    }
+    if (1 != EVP_CipherInit_ex(gcm->ctx, NULL, NULL, NULL, iv, gcm->enc))
+    {
+        return -1;
+    }
+
+    while (add_len > 0)
+    {
+        olen = (add_len > LINUX_AES_CHUNK) ? LINUX_AES_CHUNK : (int)add_len;
+        if (1 != EVP_CipherUpdate(gcm->ctx, NULL, &olen, add, olen))
+        {
+            return -1;
+        }
+        add += olen;
+        add_len -= olen;
+    }
+
+    gcm->started = UHOS_TRUE;
+    return 0;
+}
+
+uhos_s32 uhos_aes_gcm_update(uhos_void *ctx, uhos_size_t length, const uhos_u8 *input, uhos_u8 *output)
+{
+    linux_gcm_t *gcm = (linux_gcm_t *)ctx;
+
+    if ((NULL == gcm) || !gcm->started || ((length > 0) && ((NULL == input) || (NULL == output))))
+    {
+        return -1;
+    }
+
+    if (0 != linux_aes_update(gcm->ctx, output, input, length))
+    {
+        gcm->started = UHOS_FALSE;
+        return -1;
+    }
+
+    return 0;
+}
+
+uhos_s32 uhos_aes_gcm_finish(uhos_void *ctx, uhos_u8 *tag, uhos_size_t tag_len)
+{
+    linux_gcm_t *gcm  = (linux_gcm_t *)ctx;
+    uhos_u8      last[LINUX_AES_BLOCK];
+    int          olen = 0;
+
+    if ((NULL == gcm) || !gcm->started || (NULL == tag) || (tag_len < 4) || (tag_len > LINUX_AES_BLOCK))
+    {
+        return -1;
+    }
+    gcm->started = UHOS_FALSE;
+
+    if (gcm->enc)
+    {
+        if ((1 != EVP_CipherFinal_ex(gcm->ctx, last, &olen)) || (1 != EVP_CIPHER_CTX_ctrl(gcm->ctx, EVP_CTRL_GCM_GET_TAG, (int)tag_len, tag)))
+        {
+            return -1;
+        }
+        return 0;
+    }
+
+    if ((1 != EVP_CIPHER_CTX_ctrl(gcm->ctx, EVP_CTRL_GCM_SET_TAG, (int)tag_len, tag)) || (1 != EVP_CipherFinal_ex(gcm->ctx, last, &olen)))
+    {
+        UHOS_LOGW("gcm tag mismatch");
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,977 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_tls.c
+ * @author agent (agent@local)
+ * @brief 基于OpenSSL的uh_tls实现，用于Linux主机
+ * @details set接口只保存设置值，uhos_tls_start时创建SSL_CTX与SSL并使设置生效。
+ *          套接字读写经自定义BIO完成，发送使用MSG_NOSIGNAL，对端已关闭时返回错误而不是触发SIGPIPE。
+ *          会话以DER编码导出，TLS1.2的会话ID、会话票据与TLS1.3的PSK票据均可恢复。
+ *          证书库预先解析证书并创建已加载证书的SSL_CTX，不限定加密套件的句柄直接共用该SSL_CTX，
+ *          限定了套件的句柄新建SSL_CTX，共用证书库的X509_STORE与设备证书、私钥。
+ *          本模块创建的SSL_CTX以ex_data标记，引用全部释放、真正销毁时计入uhos_tls_store_get_stat的统计。
+ *          会话缓存的配置区存放在CONFIG_UHOS_TLS_SESSION_DIR下的文件中，先写临时文件再改名，掉电不会留下半个文件
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：基于OpenSSL的uh_tls实现，用于Linux主机
+ * </table>
+ */
+
+#define LOG_TAG "linux_tls"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <openssl/err.h>
+#include <openssl/pem.h>
+#include <openssl/ssl.h>
+#include <openssl/x509.h>
+
+#include "uh_types.h"
+#include "uh_log.h"
+#include "uh_tls.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define LINUX_TLS_CIPHER_LIST_LEN 512                           // 加密套件名称列表的最大长度
+#define LINUX_TLS_ZONE_PATH_LEN   256
+
+// 会话缓存配置区文件所在目录
+#ifndef CONFIG_UHOS_TLS_SESSION_DIR
+#define CONFIG_UHOS_TLS_SESSION_DIR "."
+#endif
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      证书库，创建后只读
+ */
+typedef struct
+{
+    uhos_s32    refs;
+    X509_STORE *ca;                                             //<! NULL表示不校验服务器
+    X509       *own;
+    EVP_PKEY   *key;
+    SSL_CTX    *ctx;                                            //<! 已加载以上证书的SSL_CTX
+} linux_tls_store_t;
+
+/**
+ * @struct      tls句柄
+ */
+typedef struct
+{
+    SSL_CTX           *ctx;
+    SSL               *ssl;
+    int                fd;
+    const uhos_u8     *ca_cert;                                 //<! 以下为set接口保存的设置值
+    uhos_size_t        ca_cert_len;
+    const uhos_u8     *own_cert;
+    uhos_size_t        own_cert_len;
+    const uhos_u8     *priv_key;
+    uhos_size_t        priv_key_len;
+    char              *ciphers;                                 //<! OpenSSL格式的加密套件列表
+    SSL_SESSION       *session;                                 //<! start前设置的待恢复会话
+    linux_tls_store_t *store;                                   //<! 设置后忽略ca_cert、own_cert
+} linux_tls_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+// 按UHOS_TLS_CIPHERSUITES_E顺序，OpenSSL不支持静态ECDH套件，对应NULL
+static const char *g_linux_tls_cipher_names[] = {
+    "AES128-SHA256",
+    "AES256-SHA256",
+    "DHE-RSA-AES256-SHA256",
+    "AES256-GCM-SHA384",
+    "DHE-RSA-AES256-GCM-SHA384",
+    "ECDHE-ECDSA-AES256-SHA384",
+    NULL,
+    "ECDHE-RSA-AES256-SHA384",
+    NULL,
+    "ECDHE-ECDSA-AES256-GCM-SHA384",
+    NULL,
+    "ECDHE-RSA-AES256-GCM-SHA384",
+    NULL,
+};
+
+static BIO_METHOD    *g_linux_tls_bio_method;
+static pthread_once_t g_linux_tls_bio_once = PTHREAD_ONCE_INIT;
+
+static uhos_tls_store_stat_t g_linux_tls_stat;                // 各字段以__atomic访问
+static int                   g_linux_tls_ctx_index = -1;      // 标记本模块创建的SSL_CTX，销毁时计数
+static pthread_once_t        g_linux_tls_ctx_once  = PTHREAD_ONCE_INIT;
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static int linux_tls_bio_write(BIO *bio, const char *data, int len)
+{
+    int fd  = (int)(intptr_t)BIO_get_data(bio);
+    int ret = (int)send(fd, data, (size_t)len, MSG_NOSIGNAL);
+
+    BIO_clear_retry_flags(bio);
+    if ((ret < 0) && ((EAGAIN == errno) || (EWOULDBLOCK == errno) || (EINTR == errno)))
+    {
+        BIO_set_retry_write(bio);
+    }
+
+    return ret;
+}
+
+static int linux_tls_bio_read(BIO *bio, char *data, int len)
+{
+    int fd  = (int)(intptr_t)BIO_get_data(bio);
+    int ret = (int)recv(fd, data, (size_t)len, 0);
+
+    BIO_clear_retry_flags(bio);
+    if ((ret < 0) && ((EAGAIN == errno) || (EWOULDBLOCK == errno) || (EINTR == errno)))
+    {
+        BIO_set_retry_read(bio);
+    }
+
+    return ret;
+}
+
+static long linux_tls_bio_ctrl(BIO *bio, int cmd, long num, void *ptr)
+{
+    (void)bio;
+    (void)num;
+    (void)ptr;
+
+    return (BIO_CTRL_FLUSH == cmd) ? 1 : 0;
+}
+
+static int linux_tls_bio_create(BIO *bio)
+{
+    BIO_set_init(bio, 1);
+    return 1;
+}
+
+static void linux_tls_bio_method_init(void)
+{
+    BIO_METHOD *method = BIO_meth_new(BIO_get_new_index() | BIO_TYPE_SOURCE_SINK, "uhos_tls_socket");
+
+    if (NULL != method)
+    {
+        BIO_meth_set_write(method, linux_tls_bio_write);
+        BIO_meth_set_read(method, linux_tls_bio_read);
+        BIO_meth_set_ctrl(method, linux_tls_bio_ctrl);
+        BIO_meth_set_create(method, linux_tls_bio_create);
+    }
+    g_linux_tls_bio_method = method;
+}
+
+/**
+ * @brief       创建绑定到fd的BIO
+ */
+static BIO *linux_tls_bio_new(int fd)
+{
+    BIO *bio = NULL;
+
+    pthread_once(&g_linux_tls_bio_once, linux_tls_bio_method_init);
+    if (NULL == g_linux_tls_bio_method)
+    {
+        return NULL;
+    }
+
+    bio = BIO_new(g_linux_tls_bio_method);
+    if (NULL != bio)
+    {
+        BIO_set_data(bio, (void *)(intptr_t)fd);
+    }
+
+    return bio;
+}
+
+/**
+ * @brief       将OpenSSL的返回值转换为UHOS_TLS_RET_E
+ */
+static uhos_s32 linux_tls_error(linux_tls_t *tls, int ret)
+{
+    switch (SSL_get_error(tls->ssl, ret))
+    {
+        case SSL_ERROR_WANT_READ:
+            return UHOS_TLS_RET_WANT_READ;
+
+        case SSL_ERROR_WANT_WRITE:
+            return UHOS_TLS_RET_WANT_WRITE;
+
+        case SSL_ERROR_ZERO_RETURN:
+            return 0;
+
+        default:
+            UHOS_LOGD("ssl error %lu errno %d", ERR_peek_last_error(), errno);
+            ERR_clear_error();
+            return UHOS_TLS_RET_ERROR;
+    }
+}
+
+/**
+ * @brief       解析PEM或DER格式的证书，PEM可包含多个证书
+ * @return      证书个数，失败返回0
+ */
+static int linux_tls_load_certs(const uhos_u8 *buf, uhos_size_t len, X509_STORE *store, X509 **first)
+{
+    BIO  *bio = BIO_new_mem_buf(buf, (int)len);
+    X509 *crt = NULL;
+    int   num = 0;
+
+    if (NULL == bio)
+    {
+        return 0;
+    }
+
+    while (NULL != (crt = PEM_read_bio_X509(bio, NULL, NULL, NULL)))
+    {
+        if (NULL != store)
+        {
+            X509_STORE_add_cert(store, crt);
+        }
+        if ((NULL != first) && (NULL == *first))
+        {
+            *first = crt;
+        }
+        else
+        {
+            X509_free(crt);
+        }
+        num++;
+    }
+    BIO_free(bio);
+
+    if (0 == num)
+    {
+        const unsigned char *p = buf;
+
+        crt = d2i_X509(NULL, &p, (long)len);
+        if (NULL != crt)
+        {
+            if (NULL != store)
+            {
+                X509_STORE_add_cert(store, crt);
+            }
+            if (NULL != first)
+            {
+                *first = crt;
+            }
+            else
+            {
+                X509_free(crt);
+            }
+            num = 1;
+        }
+    }
+    ERR_clear_error();
+
+    return num;
+}
+
+/**
+ * @brief       解析客户端证书与私钥，PEM或DER格式
+ */
+static int linux_tls_load_own(const uhos_u8 *own_cert, uhos_size_t own_cert_len, const uhos_u8 *priv_key, uhos_size_t priv_key_len,
+                              X509 **crt, EVP_PKEY **key)
+{
+    BIO                 *bio = NULL;
+    const unsigned char *p   = priv_key;
+
+    *crt = NULL;
+    *key = NULL;
+    if (0 == linux_tls_load_certs(own_cert, own_cert_len, NULL, crt))
+    {
+        return -1;
+    }
+
+    bio = BIO_new_mem_buf(priv_key, (int)priv_key_len);
+    if (NULL != bio)
+    {
+        *key = PEM_read_bio_PrivateKey(bio, NULL, NULL, NULL);
+        BIO_free(bio);
+    }
+    if (NULL == *key)
+    {
+        *key = d2i_AutoPrivateKey(NULL, &p, (long)priv_key_len);
+    }
+    ERR_clear_error();
+
+    if (NULL == *key)
+    {
+        X509_free(*crt);
+        *crt = NULL;
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       SSL_CTX使用客户端证书与私钥，SSL_CTX各自增加引用
+ */
+static int linux_tls_ctx_use_own(SSL_CTX *ctx, X509 *crt, EVP_PKEY *key)
+{
+    if ((1 != SSL_CTX_use_certificate(ctx, crt)) || (1 != SSL_CTX_use_PrivateKey(ctx, key)))
+    {
+        ERR_clear_error();
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       SSL_CTX使用证书库中的证书，不重新解析
+ */
+static int linux_tls_ctx_use_store(SSL_CTX *ctx, linux_tls_store_t *store)
+{
+    if (NULL != store->ca)
+    {
+        SSL_CTX_set1_cert_store(ctx, store->ca);
+        SSL_CTX_set_verify(ctx, SSL_VERIFY_PEER, NULL);
+    }
+
+    return (NULL != store->own) ? linux_tls_ctx_use_own(ctx, store->own, store->key) : 0;
+}
+
+/**
+ * @brief       SSL_CTX的引用全部释放、真正销毁时由OpenSSL回调
+ */
+static void linux_tls_ctx_ex_free(void *parent, void *ptr, CRYPTO_EX_DATA *ad, int idx, long argl, void *argp)
+{
+    (void)parent;
+    (void)ad;
+    (void)idx;
+    (void)argl;
+    (void)argp;
+
+    if (NULL != ptr)
+    {
+        __atomic_add_fetch(&g_linux_tls_stat.ctx_free, 1, __ATOMIC_RELAXED);
+    }
+}
+
+static void linux_tls_ctx_index_init(void)
+{
+    g_linux_tls_ctx_index = SSL_CTX_get_ex_new_index(0, NULL, NULL, NULL, linux_tls_ctx_ex_free);
+}
+
+static SSL_CTX *linux_tls_ctx_new(void)
+{
+    SSL_CTX *ctx = SSL_CTX_new(TLS_client_method());
+
+    if (NULL == ctx)
+    {
+        return NULL;
+    }
+    __atomic_add_fetch(&g_linux_tls_stat.ctx_new, 1, __ATOMIC_RELAXED);
+    pthread_once(&g_linux_tls_ctx_once, linux_tls_ctx_index_init);
+    if (g_linux_tls_ctx_index >= 0)
+    {
+        SSL_CTX_set_ex_data(ctx, g_linux_tls_ctx_index, &g_linux_tls_stat);
+    }
+#ifdef SSL_OP_IGNORE_UNEXPECTED_EOF
+    // 对端未发close_notify直接关闭连接时按连接关闭处理
+    SSL_CTX_set_options(ctx, SSL_OP_IGNORE_UNEXPECTED_EOF);
+#endif
+    SSL_CTX_set_mode(ctx, SSL_MODE_ENABLE_PARTIAL_WRITE | SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_OFF);
+
+    return ctx;
+}
+
+static int linux_tls_crt_cn(X509 *crt, uhos_u8 *cert_cn_buf, uhos_size_t cert_cn_buf_len)
+{
+    return (X509_NAME_get_text_by_NID(X509_get_subject_name(crt), NID_commonName, (char *)cert_cn_buf, (int)cert_cn_buf_len) > 0) ? 0 : -1;
+}
+
+static void linux_tls_store_free(linux_tls_store_t *store)
+{
+    __atomic_sub_fetch(&g_linux_tls_stat.stores, 1, __ATOMIC_RELAXED);
+    SSL_CTX_free(store->ctx);
+    X509_STORE_free(store->ca);
+    X509_free(store->own);
+    EVP_PKEY_free(store->key);
+    free(store);
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_void *uhos_tls_init(uhos_void)
+{
+    linux_tls_t *tls = calloc(1, sizeof(linux_tls_t));
+
+    if (NULL == tls)
+    {
+        UHOS_LOG_MEM_ALLOC_FAIL();
+        return UHOS_NULL;
+    }
+    tls->fd = -1;
+
+    return tls;
+}
+
+uhos_s32 uhos_tls_uninit(uhos_void *handle)
+{
+    linux_tls_t *tls = handle;
+
+    if (NULL == tls)
+    {
+        return -1;
+    }
+
+    if (NULL != tls->ssl)
+    {
+        // 套接字由调用者关闭，不等待对端的close_notify
+        SSL_set_quiet_shutdown(tls->ssl, 1);
+        SSL_shutdown(tls->ssl);
+        SSL_free(tls->ssl);
+    }
+    SSL_CTX_free(tls->ctx);
+    SSL_SESSION_free(tls->session);
+    uhos_tls_store_release(tls->store);
+    free(tls->ciphers);
+    free(tls);
+
+    return 0;
+}
+
+uhos_s32 uhos_tls_start(uhos_void *handle)
+{
+    linux_tls_t *tls = handle;
+    BIO         *bio = NULL;
+
+    if ((NULL == tls) || (tls->fd < 0) || (NULL != tls->ssl))
+    {
+        return -1;
+    }
+
+    if ((NULL != tls->store) && (NULL == tls->ciphers))
+    {
+        // 共用证书库的SSL_CTX，省去逐个连接创建SSL_CTX及解析证书
+        SSL_CTX_up_ref(tls->store->ctx);
+        tls->ctx = tls->store->ctx;
+        __atomic_add_fetch(&g_linux_tls_stat.ctx_shared, 1, __ATOMIC_RELAXED);
+    }
+    else
+    {
+        tls->ctx = linux_tls_ctx_new();
+        if (NULL == tls->ctx)
+        {
+            return -1;
+        }
+    }
+
+    if (NULL != tls->store)
+    {
+        if ((tls->ctx != tls->store->ctx) && (0 != linux_tls_ctx_use_store(tls->ctx, tls->store)))
+        {
+            return -1;
+        }
+    }
+    else
+    {
+        if (NULL != tls->ca_cert)
+        {
+            if (0 == linux_tls_load_certs(tls->ca_cert, tls->ca_cert_len, SSL_CTX_get_cert_store(tls->ctx), NULL))
+            {
+                UHOS_LOGE("bad ca cert");
+                return -1;
+            }
+            SSL_CTX_set_verify(tls->ctx, SSL_VERIFY_PEER, NULL);
+        }
+        if (NULL != tls->own_cert)
+        {
+            X509     *crt = NULL;
+            EVP_PKEY *key = NULL;
+            int       ret = linux_tls_load_own(tls->own_cert, tls->own_cert_len, tls->priv_key, tls->priv_key_len, &crt, &key);
+
+            if (0 == ret)
+            {
+                ret = linux_tls_ctx_use_own(tls->ctx, crt, key);
+                X509_free(crt);
+                EVP_PKEY_free(key);
+            }
+            if (0 != ret)
+            {
+                UHOS_LOGE("bad own cert or key");
+                return -1;
+            }
+        }
+    }
+    if (NULL != tls->ciphers)
+    {
+        // 可选的套件均为TLS1.2套件
+        SSL_CTX_set_max_proto_version(tls->ctx, TLS1_2_VERSION);
+        if (1 != SSL_CTX_set_cipher_list(tls->ctx, tls->ciphers))
+        {
+            ERR_clear_error();
+            return -1;
+        }
+    }
+
+    tls->ssl = SSL_new(tls->ctx);
+    bio      = linux_tls_bio_new(tls->fd);
+    if ((NULL == tls->ssl) || (NULL == bio))
+    {
+        BIO_free(bio);
+        return -1;
+    }
+    SSL_set_bio(tls->ssl, bio, bio);
+    SSL_set_connect_state(tls->ssl);
+
+    if (NULL != tls->session)
+    {
+        SSL_set_session(tls->ssl, tls->session);
+        SSL_SESSION_free(tls->session);
+        tls->session = NULL;
+    }
+
+    return 0;
+}
+
+uhos_s32 uhos_tls_handshake(uhos_void *handle)
+{
+    linux_tls_t *tls = handle;
+    int          ret = 0;
+
+    if ((NULL == tls) || (NULL == tls->ssl))
+    {
+        return UHOS_TLS_RET_ERROR;
+    }
+
+    ret = SSL_do_handshake(tls->ssl);
+    if (1 == ret)
+    {
+        return UHOS_TLS_RET_OK;
+    }
+
+    ret = linux_tls_error(tls, ret);
+    if (0 == ret)
+    {
+        ret = UHOS_TLS_RET_ERROR;
+    }
+    if (UHOS_TLS_RET_ERROR == ret)
+    {
+        UHOS_LOGW("handshake failed, verify %ld", SSL_get_verify_result(tls->ssl));
+    }
+
+    return ret;
+}
+
+uhos_s32 uhos_tls_send(uhos_void *handle, const uhos_u8 *data, uhos_size_t data_len)
+{
+    linux_tls_t *tls = handle;
+    int          ret = 0;
+
+    if ((NULL == tls) || (NULL == tls->ssl) || (NULL == data) || (0 == data_len))
+    {
+        return UHOS_TLS_RET_ERROR;
+    }
+
+    ret = SSL_write(tls->ssl, data, (int)data_len);
+    if (ret > 0)
+    {
+        return ret;
+    }
+    ret = linux_tls_error(tls, ret);
+
+    return (0 == ret) ? UHOS_TLS_RET_ERROR : ret;
+}
+
+uhos_s32 uhos_tls_recv(uhos_void *handle, uhos_u8 *data, uhos_size_t data_len)
+{
+    linux_tls_t *tls = handle;
+    int          ret = 0;
+
+    if ((NULL == tls) || (NULL == tls->ssl) || (NULL == data) || (0 == data_len))
+    {
+        return UHOS_TLS_RET_ERROR;
+    }
+
+    ret = SSL_read(tls->ssl, data, (int)data_len);
+    if (ret > 0)
+    {
+        return ret;
+    }
+
+    return linux_tls_error(tls, ret);
+}
+
+uhos_s32 uhos_tls_get_avail_bytes(uhos_void *tls_handle)
+{
+    linux_tls_t *tls = tls_handle;
+
+    if ((NULL == tls) || (NULL == tls->ssl))
+    {
+        return 0;
+    }
+
+    return SSL_pending(tls->ssl);
+}
+
+uhos_s32 uhos_tls_set_connected_socket(uhos_void *handle, uhos_s32 socket_fd)
+{
+    linux_tls_t *tls = handle;
+
+    if ((NULL == tls) || (socket_fd < 0))
+    {
+        return -1;
+    }
+    tls->fd = socket_fd;
+
+    return 0;
+}
+
+uhos_s32 uhos_tls_set_ciphersuites(uhos_void *handle, uhos_s32 *ciphersuites, uhos_u32 ciphersuites_count)
+{
+    linux_tls_t *tls = handle;
+    char        *list = NULL;
+    size_t       len  = 0;
+    uhos_u32     i    = 0;
+
+    if ((NULL == tls) || (NULL == ciphersuites) || (0 == ciphersuites_count))
+    {
+        return -1;
+    }
+
+    list = calloc(1, LINUX_TLS_CIPHER_LIST_LEN);
+    if (NULL == list)
+    {
+        return -1;
+    }
+
+    for (i = 0; i < ciphersuites_count; i++)
+    {
+        const char *name = NULL;
+
+        if ((ciphersuites[i] >= 0) &&
+            ((size_t)ciphersuites[i] < sizeof(g_linux_tls_cipher_names) / sizeof(g_linux_tls_cipher_names[0])))
+        {
+            name = g_linux_tls_cipher_names[ciphersuites[i]];
+        }
+        if (NULL == name)
+        {
+            UHOS_LOGW("ciphersuite %d not supported", (int)ciphersuites[i]);
+            continue;
+        }
+        len += (size_t)snprintf(&list[len], LINUX_TLS_CIPHER_LIST_LEN - len, "%s%s", (len > 0) ? ":" : "", name);
+    }
+
+    if (0 == len)
+    {
+        free(list);
+        return -1;
+    }
+    free(tls->ciphers);
+    tls->ciphers = list;
+
+    return 0;
+}
+
+uhos_s32 uhos_tls_set_ca_cert(uhos_void *handle, const uhos_u8 *ca_cert, uhos_size_t ca_cert_len)
+{
+    linux_tls_t *tls = handle;
+
+    if ((NULL == tls) || (NULL == ca_cert) || (0 == ca_cert_len))
+    {
+        return -1;
+    }
+    tls->ca_cert     = ca_cert;
+    tls->ca_cert_len = ca_cert_len;
+
+    return 0;
+}
+
+uhos_s32 uhos_tls_set_own_cert(uhos_void *handle, const uhos_u8 *own_cert, uhos_size_t own_cert_len, const uhos_u8 *priv_key, uhos_size_t priv_key_len)
+{
+    linux_tls_t *tls = handle;
+
+    if ((NULL == tls) || (NULL == own_cert) || (0 == own_cert_len) || (NULL == priv_key) || (0 == priv_key_len))
+    {
+        return -1;
+    }
+    tls->own_cert     = own_cert;
+    tls->own_cert_len = own_cert_len;
+    tls->priv_key     = priv_key;
+    tls->priv_key_len = priv_key_len;
+
+    return 0;
+}
+
+uhos_s32 uhos_tls_get_cert_cn(uhos_u8 *cert_buf, uhos_size_t cert_buf_len, uhos_u8 *cert_cn_buf, uhos_size_t cert_cn_buf_len)
+{
+    X509 *crt = NULL;
+    int   ret = -1;
+
+    if ((NULL == cert_buf) || (NULL == cert_cn_buf) || (0 == cert_cn_buf_len))
+    {
+        return -1;
+    }
+
+    if (0 == linux_tls_load_certs(cert_buf, cert_buf_len, NULL, &crt))
+    {
+        return -1;
+    }
+    ret = linux_tls_crt_cn(crt, cert_cn_buf, cert_cn_buf_len);
+    X509_free(crt);
+
+    return ret;
+}
+
+uhos_void *uhos_tls_store_create(const uhos_u8 *ca_cert, uhos_size_t ca_cert_len, const uhos_u8 *own_cert, uhos_size_t own_cert_len,
+                                 const uhos_u8 *priv_key, uhos_size_t priv_key_len)
+{
+    linux_tls_store_t *store = NULL;
+
+    if (((NULL == ca_cert) || (0 == ca_cert_len)) && ((NULL == own_cert) || (0 == own_cert_len)))
+    {
+        return UHOS_NULL;
+    }
+
+    store = calloc(1, sizeof(linux_tls_store_t));
+    if (NULL == store)
+    {
+        UHOS_LOG_MEM_ALLOC_FAIL();
+        return UHOS_NULL;
+    }
+    store->refs = 1;
+    __atomic_add_fetch(&g_linux_tls_stat.stores, 1, __ATOMIC_RELAXED);
+
+    if ((NULL != ca_cert) && (ca_cert_len > 0))
+    {
+        store->ca = X509_STORE_new();
+        if ((NULL == store->ca) || (0 == linux_tls_load_certs(ca_cert, ca_cert_len, store->ca, NULL)))
+        {
+            UHOS_LOGE("bad ca cert");
+            linux_tls_store_free(store);
+            return UHOS_NULL;
+        }
+    }
+    if ((NULL != own_cert) && (own_cert_len > 0) &&
+        ((NULL == priv_key) || (0 == priv_key_len) ||
+         (0 != linux_tls_load_own(own_cert, own_cert_len, priv_key, priv_key_len, &store->own, &store->key))))
+    {
+        UHOS_LOGE("bad own cert or key");
+        linux_tls_store_free(store);
+        return UHOS_NULL;
+    }
+
+    store->ctx = linux_tls_ctx_new();
+    if ((NULL == store->ctx) || (0 != linux_tls_ctx_use_store(store->ctx, store)))
+    {
+        linux_tls_store_free(store);
+        return UHOS_NULL;
+    }
+
+    return store;
+}
+
+uhos_void uhos_tls_store_release(uhos_void *store)
+{
+    linux_tls_store_t *s = store;
+
+    if ((NULL != s) && (0 == __atomic_sub_fetch(&s->refs, 1, __ATOMIC_ACQ_REL)))
+    {
+        linux_tls_store_free(s);
+    }
+}
+
+uhos_s32 uhos_tls_store_get_cert_cn(uhos_void *store, uhos_u8 *cert_cn_buf, uhos_size_t cert_cn_buf_len)
+{
+    linux_tls_store_t *s = store;
+
+    if ((NULL == s) || (NULL == s->own) || (NULL == cert_cn_buf) || (0 == cert_cn_buf_len))
+    {
+        return -1;
+    }
+
+    return linux_tls_crt_cn(s->own, cert_cn_buf, cert_cn_buf_len);
+}
+
+uhos_s32 uhos_tls_set_ca_store(uhos_void *handle, uhos_void *store)
+{
+    linux_tls_t       *tls = handle;
+    linux_tls_store_t *s   = store;
+
+    if ((NULL == tls) || (NULL != tls->ssl))
+    {
+        return -1;
+    }
+
+    if (NULL != s)
+    {
+        __atomic_add_fetch(&s->refs, 1, __ATOMIC_RELAXED);
+    }
+    uhos_tls_store_release(tls->store);
+    tls->store = s;
+
+    return 0;
+}
+
+uhos_s32 uhos_tls_store_get_refs(uhos_void *store)
+{
+    linux_tls_store_t *s = store;
+
+    return (NULL != s) ? __atomic_load_n(&s->refs, __ATOMIC_ACQUIRE) : -1;
+}
+
+uhos_s32 uhos_tls_store_get_stat(uhos_tls_store_stat_t *stat)
+{
+    if (NULL == stat)
+    {
+        return -1;
+    }
+
+    stat->stores     = __atomic_load_n(&g_linux_tls_stat.stores, __ATOMIC_RELAXED);
+    stat->ctx_new    = __atomic_load_n(&g_linux_tls_stat.ctx_new, __ATOMIC_RELAXED);
+    stat->ctx_free   = __atomic_load_n(&g_linux_tls_stat.ctx_free, __ATOMIC_RELAXED);
+    stat->ctx_shared = __atomic_load_n(&g_linux_tls_stat.ctx_shared, __ATOMIC_RELAXED);
+
+    return 0;
+}
+
+uhos_s32 uhos_tls_session_save(uhos_void *handle, uhos_u8 *buf, uhos_size_t buf_len)
+{
+    linux_tls_t   *tls     = handle;
+    SSL_SESSION   *session = NULL;
+    unsigned char *p       = buf;
+    int            len     = 0;
+
+    if ((NULL == tls) || (NULL == tls->ssl))
+    {
+        return -1;
+    }
+
+    session = SSL_get_session(tls->ssl);
+    if ((NULL == session) || !SSL_SESSION_is_resumable(session))
+    {
+        return -1;
+    }
+
+    len = i2d_SSL_SESSION(session, NULL);
+    if ((len <= 0) || (NULL == buf))
+    {
+        return (len > 0) ? len : -1;
+    }
+    if ((uhos_size_t)len > buf_len)
+    {
+        return -1;
+    }
+
+    return i2d_SSL_SESSION(session, &p);
+}
+
+uhos_s32 uhos_tls_session_restore(uhos_void *handle, const uhos_u8 *buf, uhos_size_t buf_len)
+{
+    linux_tls_t         *tls     = handle;
+    SSL_SESSION         *session = NULL;
+    const unsigned char *p       = buf;
+    int                  ret     = 0;
+
+    if ((NULL == tls) || (NULL == buf) || (0 == buf_len))
+    {
+        return -1;
+    }
+
+    session = d2i_SSL_SESSION(NULL, &p, (long)buf_len);
+    if (NULL == session)
+    {
+        ERR_clear_error();
+        return -1;
+    }
+
+    if (NULL == tls->ssl)
+    {
+        SSL_SESSION_free(tls->session);
+        tls->session = session;
+        return 0;
+    }
+
+    ret = SSL_set_session(tls->ssl, session);
+    SSL_SESSION_free(session);
+
+    return (1 == ret) ? 0 : -1;
+}
+
+uhos_s32 uhos_tls_session_reused(uhos_void *handle)
+{
+    linux_tls_t *tls = handle;
+
+    if ((NULL == tls) || (NULL == tls->ssl))
+    {
+        return 0;
+    }
+
+    return SSL_session_reused(tls->ssl) ? 1 : 0;
+}
+
+uhos_s32 uhos_tls_session_zone_read(uhos_u8 zone, uhos_u8 *buf, uhos_size_t len)
+{
+    char    path[LINUX_TLS_ZONE_PATH_LEN];
+    ssize_t ret = 0;
+    int     fd  = -1;
+
+    if ((NULL == buf) || (0 == len))
+    {
+        return -1;
+    }
+
+    snprintf(path, sizeof(path), "%s/uh_tls_zone%u.bin", CONFIG_UHOS_TLS_SESSION_DIR, (unsigned)zone);
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return -1;
+    }
+    ret = read(fd, buf, len);
+    close(fd);
+
+    return (ret > 0) ? 0 : -1;
+}
+
+uhos_s32 uhos_tls_session_zone_write(uhos_u8 zone, const uhos_u8 *buf, uhos_size_t len)
+{
+    char    path[LINUX_TLS_ZONE_PATH_LEN];
+    char    tmp[LINUX_TLS_ZONE_PATH_LEN + 4];
+    ssize_t ret = 0;
+    int     fd  = -1;
+
+    if ((NULL == buf) || (0 == len))
+    {
+        return -1;
+    }
+
+    snprintf(path, sizeof(path), "%s/uh_tls_zone%u.bin", CONFIG_UHOS_TLS_SESSION_DIR, (unsigned)zone);
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+
+    // 数据含会话密钥，只允许属主读写
+    fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0)
+    {
+        UHOS_LOGW("open %s failed, errno %d", tmp, errno);
+        return -1;
+    }
+    ret = write(fd, buf, len);
+    if ((ret != (ssize_t)len) || (0 != fsync(fd)))
+    {
+        close(fd);
+        unlink(tmp);
+        return -1;
+    }
+    close(fd);
+
+    return (0 == rename(tmp, path)) ? 0 : -1;
+}
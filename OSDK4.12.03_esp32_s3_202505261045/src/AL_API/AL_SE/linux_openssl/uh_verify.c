@@ -0,0 +1,148 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_verify.c
+ * @author agent (agent@local)
+ * @brief 基于OpenSSL EVP的uh_verify实现，用于Linux主机
+ * @details md句柄即EVP_MD_CTX。OpenSSL 3默认provider不提供MD2/MD4/RIPEMD160时，uhos_md_init返回NULL
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：基于OpenSSL EVP的uh_verify实现，用于Linux主机
+ * </table>
+ */
+
+#define LOG_TAG "linux_verify"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+#include "uh_types.h"
+#include "uh_log.h"
+#include "uh_verify.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define LINUX_MD_ERR_BAD_INPUT  (-0x5100)                       // 与mbedtls的MBEDTLS_ERR_MD_BAD_INPUT_DATA一致
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static const EVP_MD *linux_md_get(UHOS_MD_TYPE_E md_type)
+{
+    switch (md_type)
+    {
+        case UHOS_MD_MD4:
+            return EVP_md4();
+        case UHOS_MD_MD5:
+            return EVP_md5();
+        case UHOS_MD_SHA1:
+            return EVP_sha1();
+        case UHOS_MD_SHA224:
+            return EVP_sha224();
+        case UHOS_MD_SHA256:
+            return EVP_sha256();
+        case UHOS_MD_SHA384:
+            return EVP_sha384();
+        case UHOS_MD_SHA512:
+            return EVP_sha512();
+        case UHOS_MD_RIPEMD160:
+            return EVP_ripemd160();
+        default:
+            return NULL;
+    }
+}
+
+/**************************************************************************************************/
+/*                                          外部函数实现                                          */
+/**************************************************************************************************/
+uhos_void *uhos_md_init(UHOS_MD_TYPE_E md_type)
+{
+    const EVP_MD *md  = linux_md_get(md_type);
+    EVP_MD_CTX   *ctx = NULL;
+
+    if (NULL == md)
+    {
+        return NULL;
+    }
+
+    ctx = EVP_MD_CTX_new();
+    if ((NULL == ctx) || (1 != EVP_DigestInit_ex(ctx, md, NULL)))
+    {
+        UHOS_LOGE("md %d not available", md_type);
+        EVP_MD_CTX_free(ctx);
+        return NULL;
+    }
+
+    return ctx;
+}
+
+uhos_void uhos_md_update(uhos_void *md_ctx, uhos_u8 *buf, uhos_size_t len)
+{
+    if ((NULL == md_ctx) || ((NULL == buf) && (len > 0)))
+    {
+        return;
+    }
+
+    EVP_DigestUpdate((EVP_MD_CTX *)md_ctx, buf, len);
+}
+
+uhos_s32 uhos_md_get_size(UHOS_MD_TYPE_E md_type)
+{
+    switch (md_type)
+    {
+        case UHOS_MD_MD2:
+        case UHOS_MD_MD4:
+        case UHOS_MD_MD5:
+            return 16;
+        case UHOS_MD_SHA1:
+        case UHOS_MD_RIPEMD160:
+            return 20;
+        case UHOS_MD_SHA224:
+            return 28;
+        case UHOS_MD_SHA256:
+            return 32;
+        case UHOS_MD_SHA384:
+            return 48;
+        case UHOS_MD_SHA512:
+            return 64;
+        default:
+            return -1;
+    }
+}
+
+uhos_void uhos_md_finish(uhos_void *md_ctx, uhos_u8 *output)
+{
+    if (NULL == md_ctx)
+    {
+        return;
+    }
+
+    if (NULL != output)
+    {
+        EVP_DigestFinal_ex((EVP_MD_CTX *)md_ctx, output, NULL);
+    }
+    EVP_MD_CTX_free((EVP_MD_CTX *)md_ctx);
+}
+
+uhos_s32 uhos_md_hmac(UHOS_MD_TYPE_E md_type, const uhos_u8 *key, uhos_size_t keylen, const uhos_u8 *input, uhos_size_t ilen, uhos_u8 *output)
+{
+    const EVP_MD *md = linux_md_get(md_type);
+
+    if ((NULL == md) || (NULL == output) || ((NULL == key) && (keylen > 0)) || ((NULL == input) && (ilen > 0)) || (keylen > 0x7FFFFFFF))
+    {
+        return LINUX_MD_ERR_BAD_INPUT;
+    }
+
+    if (NULL == HMAC(md, key, (int)keylen, input, ilen, output, NULL))
+    {
+        return LINUX_MD_ERR_BAD_INPUT;
+    }
+
+    return 0;
+}
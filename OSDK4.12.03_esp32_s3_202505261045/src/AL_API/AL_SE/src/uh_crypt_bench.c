@@ -0,0 +1,214 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_crypt_bench.c
+ * @author agent (agent@local)
+ * @brief aes各模式、各消息长度吞吐率基准测试的功能实现
+ * @details 每个用例设置一次秘钥，对同一buffer原地加密直到处理完指定字节数。
+ *          CBC与CTR每条消息调用一次加密接口，GCM每条消息依次调用starts、update、finish，
+ *          计入每条消息的iv设置与认证标签开销
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：aes各模式、各消息长度吞吐率基准测试的功能实现
+ * </table>
+ */
+
+#define LOG_TAG "crypt-bench"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_crypt.h"
+
+#include "uh_bench.h"
+#include "uh_crypt_bench.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define UHOS_CRYPT_BENCH_BLOCK_LEN          16
+#define UHOS_CRYPT_BENCH_IV_LEN             12
+#define UHOS_CRYPT_BENCH_TAG_LEN            16
+
+// JSON行的最大长度
+#define UHOS_CRYPT_BENCH_JSON_LEN           256
+
+#define UHOS_CRYPT_BENCH_ARRAY_NUM(a)       (sizeof(a) / sizeof((a)[0]))
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static const uhos_char *g_uhos_crypt_bench_mode_name[UHOS_CRYPT_BENCH_MODE_MAX] = {"cbc", "ctr", "gcm"};
+static const uhos_u32   g_uhos_crypt_bench_sizes[]                              = {16, 64, 256, 1024, 4096};
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       加密一条消息
+ */
+static uhos_s32 uhos_crypt_bench_once(uhos_void *ctx, uhos_crypt_bench_mode_t mode, uhos_u8 *buf, uhos_u32 size)
+{
+    static const uhos_u8 nonce[UHOS_CRYPT_BENCH_IV_LEN] = {0};
+    uhos_u8              iv[UHOS_CRYPT_BENCH_BLOCK_LEN] = {0};
+    uhos_u8              stream[UHOS_CRYPT_BENCH_BLOCK_LEN];
+    uhos_u8              tag[UHOS_CRYPT_BENCH_TAG_LEN];
+    uhos_size_t          off                            = 0;
+
+    if (UHOS_CRYPT_BENCH_CBC == mode)
+    {
+        return uhos_aes_crypt_cbc(ctx, UHOS_AES_ENCRYPT, size, iv, buf, buf);
+    }
+    if (UHOS_CRYPT_BENCH_CTR == mode)
+    {
+        return uhos_aes_crypt_ctr(ctx, size, &off, iv, stream, buf, buf);
+    }
+
+    if ((0 != uhos_aes_gcm_starts(ctx, UHOS_AES_ENCRYPT, nonce, sizeof(nonce), UHOS_NULL, 0)) ||
+        (0 != uhos_aes_gcm_update(ctx, size, buf, buf)))
+    {
+        return -1;
+    }
+
+    return uhos_aes_gcm_finish(ctx, tag, sizeof(tag));
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_s32 uhos_crypt_bench_run(const uhos_crypt_bench_case_t *bcase, uhos_crypt_bench_result_t *result)
+{
+    static const uhos_u8 key[32]  = {0};
+    uhos_void           *ctx      = UHOS_NULL;
+    uhos_u8             *buf      = UHOS_NULL;
+    uhos_u32             start    = 0;
+    uhos_u32             done     = 0;
+    uhos_s32             ret      = 0;
+
+    if ((UHOS_NULL == bcase) || (UHOS_NULL == result) || (bcase->mode >= UHOS_CRYPT_BENCH_MODE_MAX) || (0 == bcase->size) ||
+        (bcase->size > UHOS_CRYPT_BENCH_SIZE_MAX) || (0 != (bcase->size % UHOS_CRYPT_BENCH_BLOCK_LEN)) || (bcase->keybits > 256))
+    {
+        return -1;
+    }
+
+    uhos_libc_memset(result, 0, sizeof(uhos_crypt_bench_result_t));
+    result->status = -1;
+
+    buf = (uhos_u8 *)uhos_libc_malloc(bcase->size);
+    ctx = (UHOS_CRYPT_BENCH_GCM == bcase->mode) ? uhos_aes_gcm_init() : uhos_aes_init();
+    if ((UHOS_NULL == buf) || (UHOS_NULL == ctx))
+    {
+        goto out;
+    }
+    uhos_libc_memset(buf, 0x5A, bcase->size);
+
+    ret = (UHOS_CRYPT_BENCH_GCM == bcase->mode) ? uhos_aes_gcm_setkey(ctx, key, bcase->keybits)
+                                                : uhos_aes_setkey_enc(ctx, key, bcase->keybits);
+    if (0 != ret)
+    {
+        goto out;
+    }
+
+    start = uhos_bench_now_us();
+    for (done = 0; done < bcase->bytes; done += bcase->size)
+    {
+        if (0 != uhos_crypt_bench_once(ctx, bcase->mode, buf, bcase->size))
+        {
+            goto out;
+        }
+        result->msgs++;
+    }
+    result->elapsed_us = uhos_bench_now_us() - start;
+    if (result->elapsed_us > 0)
+    {
+        result->kbps = (uhos_u32)((uhos_u64)done * 1000000 / 1024 / result->elapsed_us);
+    }
+    result->status = 0;
+
+out:
+    if (UHOS_NULL != ctx)
+    {
+        if (UHOS_CRYPT_BENCH_GCM == bcase->mode)
+        {
+            uhos_aes_gcm_free(ctx);
+        }
+        else
+        {
+            uhos_aes_free(ctx);
+        }
+    }
+    if (UHOS_NULL != buf)
+    {
+        uhos_libc_free(buf);
+    }
+
+    if (0 != result->status)
+    {
+        UHOS_LOGE("bench %s size %u failed", g_uhos_crypt_bench_mode_name[bcase->mode], (unsigned)bcase->size);
+    }
+
+    return result->status;
+}
+
+uhos_s32 uhos_crypt_bench_result_json(const uhos_crypt_bench_case_t *bcase, const uhos_crypt_bench_result_t *result, uhos_char *buf,
+                                      uhos_u32 size)
+{
+    uhos_bench_json_t json;
+
+    if ((UHOS_NULL == bcase) || (UHOS_NULL == result) || (UHOS_NULL == buf) || (bcase->mode >= UHOS_CRYPT_BENCH_MODE_MAX))
+    {
+        return 0;
+    }
+
+    uhos_bench_json_begin(&json, buf, size);
+    uhos_bench_json_str(&json, "mode", g_uhos_crypt_bench_mode_name[bcase->mode]);
+    uhos_bench_json_u32(&json, "keybits", bcase->keybits);
+    uhos_bench_json_u32(&json, "size", bcase->size);
+    uhos_bench_json_status(&json, result->status);
+    uhos_bench_json_u32(&json, "msgs", result->msgs);
+    uhos_bench_json_u32(&json, "elapsed_us", result->elapsed_us);
+    uhos_bench_json_u32(&json, "kbps", result->kbps);
+
+    return uhos_bench_json_end(&json);
+}
+
+uhos_s32 uhos_crypt_bench_matrix_run(uhos_bench_print_t print)
+{
+    uhos_crypt_bench_case_t   bcase  = {0};
+    uhos_crypt_bench_result_t result = {0};
+    uhos_char                 line[UHOS_CRYPT_BENCH_JSON_LEN];
+    uhos_s32                  ret    = 0;
+    uhos_u8                   mode   = 0;
+    uhos_u32                  i      = 0;
+
+    if (UHOS_NULL == print)
+    {
+        return -1;
+    }
+
+    bcase.keybits = 128;
+    bcase.bytes   = CONFIG_UHOS_CRYPT_BENCH_BYTES;
+
+    for (mode = 0; mode < UHOS_CRYPT_BENCH_MODE_MAX; mode++)
+    {
+        for (i = 0; i < UHOS_CRYPT_BENCH_ARRAY_NUM(g_uhos_crypt_bench_sizes); i++)
+        {
+            bcase.mode = (uhos_crypt_bench_mode_t)mode;
+            bcase.size = g_uhos_crypt_bench_sizes[i];
+
+            if (0 != uhos_crypt_bench_run(&bcase, &result))
+            {
+                ret = -1;
+            }
+            uhos_crypt_bench_result_json(&bcase, &result, line, sizeof(line));
+            print(line);
+        }
+    }
+
+    return ret;
+}
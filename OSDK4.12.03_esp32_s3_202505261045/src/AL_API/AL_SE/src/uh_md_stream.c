@@ -0,0 +1,330 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_md_stream.c
+ * @author agent (agent@local)
+ * @brief 流式摘要，写入数据的同时计算整体及各区间(子固件)的摘要，基于各平台的uhos_md_xxx
+ * @details OTA镜像通常按偏移顺序写入，每段写入时即送入整体摘要及与之相交的区间摘要，
+ *          写完最后一段摘要即已算完，省去下载完成后把整个镜像(及各子固件)从flash读回再计算。
+ *          未按顺序写入的部分在结束时读回补算；重写了已计算的数据时全部读回重算
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：流式摘要，写入数据的同时计算整体及各区间(子固件)的摘要，基于各平台的uhos_md_xxx
+ * </table>
+ */
+
+#define LOG_TAG "md_stream"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_verify.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+// 结束时读回数据使用的buffer大小
+#ifndef CONFIG_UHOS_MD_STREAM_READ_LEN
+#define CONFIG_UHOS_MD_STREAM_READ_LEN  4096
+#endif
+
+#define UHOS_MD_STREAM_DIGEST_MAX       64                      // SHA512
+
+/**************************************************************************************************/
+/*                                         内部类型定义                                           */
+/**************************************************************************************************/
+/**
+ * @struct      一个摘要：整体数据或一个区间
+ */
+typedef struct
+{
+    uhos_u32       offset;
+    uhos_u32       len;
+    UHOS_MD_TYPE_E md_type;
+    uhos_void     *md;                                          //<! NULL表示不计算或已完成
+    uhos_u8        digest[UHOS_MD_STREAM_DIGEST_MAX];
+} uhos_md_stream_part_t;
+
+/**
+ * @struct      流式摘要
+ */
+typedef struct
+{
+    uhos_u32               total_len;
+    uhos_u32               next;                                //<! [0, next)已按顺序计算
+    uhos_bool              rewrite;                             //<! 重写了已计算的数据
+    uhos_bool              finished;
+    uhos_u16               num;                                 //<! parts个数，parts[0]为整体数据，range_num为255时为256
+    uhos_md_stream_stats_t stats;
+    uhos_md_stream_part_t *parts;
+} uhos_md_stream_t;
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       结束各摘要的计算，释放uhos_md句柄
+ */
+static uhos_void uhos_md_stream_close(uhos_md_stream_t *stream)
+{
+    uhos_md_stream_part_t *part = stream->parts;
+    uhos_u16               i    = 0;
+
+    for (i = 0; i < stream->num; i++, part++)
+    {
+        if (part->md)
+        {
+            uhos_md_finish(part->md, part->digest);
+            part->md = UHOS_NULL;
+        }
+    }
+}
+
+static uhos_s32 uhos_md_stream_open(uhos_md_stream_t *stream)
+{
+    uhos_md_stream_part_t *part = stream->parts;
+    uhos_u16               i    = 0;
+
+    for (i = 0; i < stream->num; i++, part++)
+    {
+        // 长度为0的区间同样计算，结束时得到空数据的摘要
+        if (UHOS_MD_NONE == part->md_type)
+        {
+            continue;
+        }
+
+        part->md = uhos_md_init(part->md_type);
+        if (UHOS_NULL == part->md)
+        {
+            UHOS_LOGE("md init failed, type %d", part->md_type);
+            uhos_md_stream_close(stream);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       将[offset, offset + len)的数据送入整体摘要及与之相交的区间摘要
+ */
+static uhos_void uhos_md_stream_feed(uhos_md_stream_t *stream, uhos_u32 offset, const uhos_u8 *buf, uhos_u32 len)
+{
+    uhos_md_stream_part_t *part  = stream->parts;
+    uhos_u32               end   = offset + len;
+    uhos_u32               start = 0;
+    uhos_u32               stop  = 0;
+    uhos_u16               i     = 0;
+
+    for (i = 0; i < stream->num; i++, part++)
+    {
+        if (UHOS_NULL == part->md)
+        {
+            continue;
+        }
+
+        start = (offset > part->offset) ? offset : part->offset;
+        stop  = (end < part->offset + part->len) ? end : part->offset + part->len;
+        if (start < stop)
+        {
+            uhos_md_update(part->md, (uhos_u8 *)buf + (start - offset), stop - start);
+        }
+    }
+}
+
+/**************************************************************************************************/
+/*                                          外部函数实现                                          */
+/**************************************************************************************************/
+uhos_void *uhos_md_stream_init(UHOS_MD_TYPE_E md_type, uhos_u32 total_len, const uhos_md_range_t *ranges, uhos_u8 range_num)
+{
+    uhos_md_stream_t *stream = UHOS_NULL;
+    uhos_u16          num    = (uhos_u16)range_num + 1;
+    uhos_u16          i      = 0;
+
+    if ((UHOS_NULL == ranges) && (range_num > 0))
+    {
+        return UHOS_NULL;
+    }
+    for (i = 0; i < range_num; i++)
+    {
+        if ((ranges[i].offset > total_len) || (ranges[i].len > total_len - ranges[i].offset))
+        {
+            UHOS_LOGE("range %d out of bounds", i);
+            return UHOS_NULL;
+        }
+    }
+
+    stream = (uhos_md_stream_t *)uhos_libc_malloc(sizeof(uhos_md_stream_t) + num * sizeof(uhos_md_stream_part_t));
+    if (UHOS_NULL == stream)
+    {
+        return UHOS_NULL;
+    }
+    uhos_libc_memset(stream, 0, sizeof(uhos_md_stream_t) + num * sizeof(uhos_md_stream_part_t));
+
+    stream->total_len = total_len;
+    stream->num       = num;
+    stream->parts     = (uhos_md_stream_part_t *)(stream + 1);
+
+    stream->parts[0].len     = total_len;
+    stream->parts[0].md_type = md_type;
+    for (i = 0; i < range_num; i++)
+    {
+        stream->parts[i + 1].offset  = ranges[i].offset;
+        stream->parts[i + 1].len     = ranges[i].len;
+        stream->parts[i + 1].md_type = ranges[i].md_type;
+    }
+
+    if (0 != uhos_md_stream_open(stream))
+    {
+        uhos_libc_free(stream);
+        return UHOS_NULL;
+    }
+
+    return stream;
+}
+
+uhos_s32 uhos_md_stream_update(uhos_void *handle, uhos_u32 offset, const uhos_u8 *buf, uhos_size_t len)
+{
+    uhos_md_stream_t *stream = (uhos_md_stream_t *)handle;
+
+    if ((UHOS_NULL == stream) || stream->finished || ((UHOS_NULL == buf) && (len > 0)) || (offset > stream->total_len) ||
+        (len > stream->total_len - offset))
+    {
+        return -1;
+    }
+
+    if (stream->rewrite || (0 == len))
+    {
+        return 0;
+    }
+
+    if (offset == stream->next)
+    {
+        uhos_md_stream_feed(stream, offset, buf, (uhos_u32)len);
+        stream->next += (uhos_u32)len;
+        stream->stats.streamed += (uhos_u32)len;
+    }
+    else if (offset < stream->next)
+    {
+        // 摘要无法撤回已送入的数据，只能结束时全部读回重算
+        UHOS_LOGW("rewrite at %u (hashed up to %u), digest will be recomputed", offset, stream->next);
+        stream->rewrite = UHOS_TRUE;
+    }
+    // offset > next：中间有未写入的数据，从next起结束时读回计算
+
+    return 0;
+}
+
+uhos_s32 uhos_md_stream_finish(uhos_void *handle, uhos_md_read_cb_t read_cb, uhos_void *arg)
+{
+    uhos_md_stream_t *stream = (uhos_md_stream_t *)handle;
+    uhos_u8          *buf    = UHOS_NULL;
+    uhos_u32          n      = 0;
+
+    if ((UHOS_NULL == stream) || stream->finished)
+    {
+        return -1;
+    }
+
+    if (stream->rewrite)
+    {
+        uhos_md_stream_close(stream);
+        if (0 != uhos_md_stream_open(stream))
+        {
+            return -1;
+        }
+        stream->next           = 0;
+        stream->stats.streamed = 0;
+        stream->rewrite        = UHOS_FALSE;
+    }
+
+    if (stream->next < stream->total_len)
+    {
+        if (UHOS_NULL == read_cb)
+        {
+            UHOS_LOGE("%u bytes not hashed and no read_cb", stream->total_len - stream->next);
+            return -1;
+        }
+
+        buf = (uhos_u8 *)uhos_libc_malloc(CONFIG_UHOS_MD_STREAM_READ_LEN);
+        if (UHOS_NULL == buf)
+        {
+            return -1;
+        }
+
+        while (stream->next < stream->total_len)
+        {
+            n = stream->total_len - stream->next;
+            n = (n > CONFIG_UHOS_MD_STREAM_READ_LEN) ? CONFIG_UHOS_MD_STREAM_READ_LEN : n;
+            if (0 != read_cb(stream->next, buf, n, arg))
+            {
+                UHOS_LOGE("read back at %u failed", stream->next);
+                uhos_libc_free(buf);
+                return -1;
+            }
+            uhos_md_stream_feed(stream, stream->next, buf, n);
+            stream->next += n;
+            stream->stats.read_back += n;
+        }
+
+        uhos_libc_free(buf);
+    }
+
+    uhos_md_stream_close(stream);
+    stream->finished = UHOS_TRUE;
+    UHOS_LOGI("digest done, streamed %u, read back %u", stream->stats.streamed, stream->stats.read_back);
+
+    return 0;
+}
+
+uhos_s32 uhos_md_stream_digest(uhos_void *handle, uhos_s32 index, uhos_u8 *output)
+{
+    uhos_md_stream_t      *stream = (uhos_md_stream_t *)handle;
+    uhos_md_stream_part_t *part   = UHOS_NULL;
+    uhos_s32               size   = 0;
+
+    if ((UHOS_NULL == stream) || !stream->finished || (UHOS_NULL == output) || (index < -1) || (index + 1 >= stream->num))
+    {
+        return -1;
+    }
+
+    part = &stream->parts[index + 1];
+    size = uhos_md_get_size(part->md_type);
+    if ((UHOS_MD_NONE == part->md_type) || (size <= 0) || (size > UHOS_MD_STREAM_DIGEST_MAX))
+    {
+        return -1;
+    }
+
+    uhos_libc_memcpy(output, part->digest, size);
+    return size;
+}
+
+uhos_void uhos_md_stream_stats_get(uhos_void *handle, uhos_md_stream_stats_t *stats)
+{
+    uhos_md_stream_t *stream = (uhos_md_stream_t *)handle;
+
+    if ((UHOS_NULL == stream) || (UHOS_NULL == stats))
+    {
+        return;
+    }
+
+    *stats = stream->stats;
+}
+
+uhos_void uhos_md_stream_free(uhos_void *handle)
+{
+    uhos_md_stream_t *stream = (uhos_md_stream_t *)handle;
+
+    if (UHOS_NULL == stream)
+    {
+        return;
+    }
+
+    uhos_md_stream_close(stream);
+    uhos_libc_free(stream);
+}
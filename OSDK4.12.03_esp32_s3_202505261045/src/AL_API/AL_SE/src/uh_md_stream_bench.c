@@ -0,0 +1,350 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_md_stream_bench.c
+ * @author agent (agent@local)
+ * @brief 流式摘要与写完后读回计算摘要的耗时对比基准测试的功能实现
+ * @details 镜像数据按偏移生成，不占用整块内存；参考摘要直接对生成的数据计算，不计入耗时。
+ *          读回方式与改动前的OTA流程相同：写完后整体读回一次，再逐个子固件读回一次；
+ *          两种方式的写入耗时都包含生成数据的时间
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：流式摘要耗时对比基准测试的功能实现
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>输出与计时改用uh_bench.h
+ * </table>
+ */
+
+#define LOG_TAG "md-stream-bench"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_verify.h"
+#include "uh_bench.h"
+
+#include "uh_md_stream_bench.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+// 三个子固件区间与一个空区间
+#define UHOS_MD_STREAM_BENCH_RANGES         4
+
+#define UHOS_MD_STREAM_BENCH_DIGEST_MAX     32                  // SHA256
+#define UHOS_MD_STREAM_BENCH_LEN_MIN        4096
+#define UHOS_MD_STREAM_BENCH_CHUNKS_MIN     4
+
+// JSON行的最大长度
+#define UHOS_MD_STREAM_BENCH_JSON_LEN       256
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static const uhos_char *g_uhos_md_stream_bench_mode_name[UHOS_MD_STREAM_BENCH_MODE_MAX] = {"readback", "stream", "swapped",
+                                                                                          "rewrite"};
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       生成[offset, offset + len)的镜像数据
+ */
+static uhos_void uhos_md_stream_bench_fill(uhos_u32 offset, uhos_u8 *buf, uhos_u32 len)
+{
+    uhos_u32 i = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        buf[i] = (uhos_u8)(((offset + i) * 0x9E3779B1u) >> 24);
+    }
+}
+
+/**
+ * @brief       子固件区间：三段不与写入边界对齐的区间，及一个空区间
+ */
+static uhos_void uhos_md_stream_bench_ranges(uhos_u32 len, uhos_md_range_t *ranges)
+{
+    ranges[0].offset  = 256;
+    ranges[0].len     = len / 8 * 3 - 256;
+    ranges[0].md_type = UHOS_MD_SHA256;
+    ranges[1].offset  = len / 8 * 3;
+    ranges[1].len     = len / 8 * 3;
+    ranges[1].md_type = UHOS_MD_SHA256;
+    ranges[2].offset  = len / 4 * 3;
+    ranges[2].len     = len / 4 - 100;
+    ranges[2].md_type = UHOS_MD_MD5;
+    ranges[3].offset  = len / 2;
+    ranges[3].len     = 0;
+    ranges[3].md_type = UHOS_MD_SHA256;
+}
+
+/**
+ * @brief       计算一个区间的摘要
+ * @param[in]   target  从存储读回，为NULL时直接对生成的数据计算
+ * @param[out]  read    累加读回的字节数，可为NULL
+ * @return      0-成功，-1-失败
+ */
+static uhos_s32 uhos_md_stream_bench_hash(const uhos_md_stream_bench_target_t *target, const uhos_md_range_t *range, uhos_u8 *buf,
+                                          uhos_u32 chunk, uhos_u8 *output, uhos_u32 *read)
+{
+    uhos_void *md  = uhos_md_init(range->md_type);
+    uhos_u32   off = range->offset;
+    uhos_u32   end = range->offset + range->len;
+    uhos_u32   n   = 0;
+
+    if (UHOS_NULL == md)
+    {
+        return -1;
+    }
+
+    for (; off < end; off += n)
+    {
+        n = ((end - off) > chunk) ? chunk : (end - off);
+        if (UHOS_NULL == target)
+        {
+            uhos_md_stream_bench_fill(off, buf, n);
+        }
+        else if (0 != target->read(off, buf, n, target->arg))
+        {
+            uhos_md_finish(md, output);
+            return -1;
+        }
+        else if (UHOS_NULL != read)
+        {
+            *read += n;
+        }
+        uhos_md_update(md, buf, n);
+    }
+    uhos_md_finish(md, output);
+
+    return 0;
+}
+
+/**
+ * @brief       生成并写入一段，流式方式同时送入摘要
+ */
+static uhos_s32 uhos_md_stream_bench_write(const uhos_md_stream_bench_target_t *target, uhos_void *stream, uhos_u32 offset,
+                                           uhos_u8 *buf, uhos_u32 len)
+{
+    uhos_md_stream_bench_fill(offset, buf, len);
+    if (0 != target->write(offset, buf, len, target->arg))
+    {
+        return -1;
+    }
+    if ((UHOS_NULL != stream) && (0 != uhos_md_stream_update(stream, offset, buf, len)))
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       按用例的顺序写入全部数据
+ */
+static uhos_s32 uhos_md_stream_bench_write_all(const uhos_md_stream_bench_target_t *target, const uhos_md_stream_bench_case_t *bcase,
+                                               uhos_void *stream, uhos_u8 *buf)
+{
+    uhos_u32 num = bcase->image_len / bcase->chunk;
+    uhos_u32 k   = 0;
+    uhos_u32 i   = 0;
+
+    for (k = 0; k < num; k++)
+    {
+        i = k;
+        if (UHOS_MD_STREAM_BENCH_SWAPPED == bcase->mode)
+        {
+            i = (1 == k) ? 2 : ((2 == k) ? 1 : k);
+        }
+        if (0 != uhos_md_stream_bench_write(target, stream, i * bcase->chunk, buf, bcase->chunk))
+        {
+            return -1;
+        }
+
+        if ((UHOS_MD_STREAM_BENCH_REWRITE == bcase->mode) && (k == num / 2) &&
+            (0 != uhos_md_stream_bench_write(target, stream, bcase->chunk, buf, bcase->chunk)))
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_s32 uhos_md_stream_bench_run(const uhos_md_stream_bench_target_t *target, const uhos_md_stream_bench_case_t *bcase,
+                                  uhos_md_stream_bench_result_t *result)
+{
+    uhos_md_range_t        ranges[UHOS_MD_STREAM_BENCH_RANGES + 1];
+    uhos_u8                ref[UHOS_MD_STREAM_BENCH_RANGES + 1][UHOS_MD_STREAM_BENCH_DIGEST_MAX];
+    uhos_u8                digest[UHOS_MD_STREAM_BENCH_DIGEST_MAX];
+    uhos_md_stream_stats_t stats  = {0};
+    uhos_void             *stream = UHOS_NULL;
+    uhos_u8               *buf    = UHOS_NULL;
+    uhos_u32               start  = 0;
+    uhos_s32               size   = 0;
+    uhos_u32               i      = 0;
+
+    if ((UHOS_NULL == target) || (UHOS_NULL == target->write) || (UHOS_NULL == target->read) || (UHOS_NULL == bcase) ||
+        (UHOS_NULL == result) || (bcase->mode >= UHOS_MD_STREAM_BENCH_MODE_MAX) || (0 == bcase->chunk) ||
+        (bcase->image_len < UHOS_MD_STREAM_BENCH_LEN_MIN) || (0 != (bcase->image_len % bcase->chunk)) ||
+        (bcase->image_len / bcase->chunk < UHOS_MD_STREAM_BENCH_CHUNKS_MIN))
+    {
+        return -1;
+    }
+
+    uhos_libc_memset(result, 0, sizeof(uhos_md_stream_bench_result_t));
+    result->status = -1;
+
+    buf = (uhos_u8 *)uhos_libc_malloc(bcase->chunk);
+    if (UHOS_NULL == buf)
+    {
+        return -1;
+    }
+
+    // ranges[0]为整体数据，其后为子固件区间
+    ranges[0].offset  = 0;
+    ranges[0].len     = bcase->image_len;
+    ranges[0].md_type = UHOS_MD_SHA256;
+    uhos_md_stream_bench_ranges(bcase->image_len, &ranges[1]);
+    for (i = 0; i <= UHOS_MD_STREAM_BENCH_RANGES; i++)
+    {
+        if (0 != uhos_md_stream_bench_hash(UHOS_NULL, &ranges[i], buf, bcase->chunk, ref[i], UHOS_NULL))
+        {
+            goto out;
+        }
+    }
+
+    if (UHOS_MD_STREAM_BENCH_READBACK == bcase->mode)
+    {
+        start = uhos_bench_now_us();
+        if (0 != uhos_md_stream_bench_write_all(target, bcase, UHOS_NULL, buf))
+        {
+            goto out;
+        }
+        result->write_us = uhos_bench_now_us() - start;
+
+        start = uhos_bench_now_us();
+        for (i = 0; i <= UHOS_MD_STREAM_BENCH_RANGES; i++)
+        {
+            size = uhos_md_get_size(ranges[i].md_type);
+            if ((0 != uhos_md_stream_bench_hash(target, &ranges[i], buf, bcase->chunk, digest, &result->read_back)) ||
+                (0 != uhos_libc_memcmp(digest, ref[i], size)))
+            {
+                goto out;
+            }
+        }
+        result->ready_us = uhos_bench_now_us() - start;
+        result->status   = 0;
+        goto out;
+    }
+
+    stream = uhos_md_stream_init(UHOS_MD_SHA256, bcase->image_len, &ranges[1], UHOS_MD_STREAM_BENCH_RANGES);
+    if (UHOS_NULL == stream)
+    {
+        goto out;
+    }
+
+    start = uhos_bench_now_us();
+    if (0 != uhos_md_stream_bench_write_all(target, bcase, stream, buf))
+    {
+        goto out;
+    }
+    result->write_us = uhos_bench_now_us() - start;
+
+    start = uhos_bench_now_us();
+    if (0 != uhos_md_stream_finish(stream, target->read, target->arg))
+    {
+        goto out;
+    }
+    result->ready_us = uhos_bench_now_us() - start;
+
+    uhos_md_stream_stats_get(stream, &stats);
+    result->streamed  = stats.streamed;
+    result->read_back = stats.read_back;
+
+    for (i = 0; i <= UHOS_MD_STREAM_BENCH_RANGES; i++)
+    {
+        size = uhos_md_stream_digest(stream, (uhos_s32)i - 1, digest);
+        if ((size != uhos_md_get_size(ranges[i].md_type)) || (0 != uhos_libc_memcmp(digest, ref[i], size)))
+        {
+            goto out;
+        }
+    }
+    result->status = 0;
+
+out:
+    if (UHOS_NULL != stream)
+    {
+        uhos_md_stream_free(stream);
+    }
+    uhos_libc_free(buf);
+
+    if (0 != result->status)
+    {
+        UHOS_LOGE("bench %s failed", g_uhos_md_stream_bench_mode_name[bcase->mode]);
+    }
+
+    return result->status;
+}
+
+uhos_s32 uhos_md_stream_bench_result_json(const uhos_md_stream_bench_case_t *bcase, const uhos_md_stream_bench_result_t *result,
+                                          uhos_char *buf, uhos_u32 size)
+{
+    uhos_bench_json_t json = {0};
+
+    if ((UHOS_NULL == bcase) || (UHOS_NULL == result) || (UHOS_NULL == buf) || (bcase->mode >= UHOS_MD_STREAM_BENCH_MODE_MAX))
+    {
+        return 0;
+    }
+
+    uhos_bench_json_begin(&json, buf, size);
+    uhos_bench_json_str(&json, "mode", g_uhos_md_stream_bench_mode_name[bcase->mode]);
+    uhos_bench_json_u32(&json, "image_len", bcase->image_len);
+    uhos_bench_json_u32(&json, "chunk", bcase->chunk);
+    uhos_bench_json_status(&json, result->status);
+    uhos_bench_json_u32(&json, "write_us", result->write_us);
+    uhos_bench_json_u32(&json, "ready_us", result->ready_us);
+    uhos_bench_json_u32(&json, "streamed", result->streamed);
+    uhos_bench_json_u32(&json, "read_back", result->read_back);
+
+    return uhos_bench_json_end(&json);
+}
+
+uhos_s32 uhos_md_stream_bench_matrix_run(const uhos_md_stream_bench_target_t *target, uhos_bench_print_t print)
+{
+    uhos_md_stream_bench_case_t   bcase  = {0};
+    uhos_md_stream_bench_result_t result = {0};
+    uhos_char                     line[UHOS_MD_STREAM_BENCH_JSON_LEN];
+    uhos_s32                      ret    = 0;
+    uhos_u8                       mode   = 0;
+
+    if ((UHOS_NULL == target) || (UHOS_NULL == print))
+    {
+        return -1;
+    }
+
+    bcase.image_len = CONFIG_UHOS_MD_STREAM_BENCH_LEN;
+    bcase.chunk     = CONFIG_UHOS_MD_STREAM_BENCH_CHUNK;
+
+    for (mode = 0; mode < UHOS_MD_STREAM_BENCH_MODE_MAX; mode++)
+    {
+        bcase.mode = (uhos_md_stream_bench_mode_t)mode;
+
+        if (0 != uhos_md_stream_bench_run(target, &bcase, &result))
+        {
+            ret = -1;
+        }
+        uhos_md_stream_bench_result_json(&bcase, &result, line, sizeof(line));
+        print(line);
+    }
+
+    return ret;
+}
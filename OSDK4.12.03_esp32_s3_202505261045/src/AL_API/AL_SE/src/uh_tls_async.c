@@ -0,0 +1,479 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_tls_async.c
+ * @author agent (agent@local)
+ * @brief 基于uhos_net_poller的异步tls握手，基于各平台uhos_tls_handshake的WANT_READ/WANT_WRITE返回值
+ * @details 每个进行中的握手只占一个握手对象，套接字按握手需要的方向注册到poller，
+ *          就绪时由事件循环推进，完成或超时后注销套接字并回调。
+ *          多个连接在同一线程中并发握手，不再需要每个连接一个阻塞线程及其任务栈。
+ *          进行中的握手在一个链表中，由锁保护，可有多个事件循环线程各用一个poller；
+ *          超时检查与uhos_tls_handshake_poll只处理所给poller上的握手。
+ *          回调在锁外调用，回调中可能结束其他握手，因此分发一批就绪事件时，每个事件都按握手对象地址与
+ *          创建序号重新在链表中查找，已结束（即使内存已被新的握手复用）的事件被忽略
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：基于uhos_net_poller的异步tls握手，基于各平台uhos_tls_handshake的WANT_READ/WANT_WRITE返回值
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>uhos_tls_handshake_start的重复检查与入链表在同一次持锁内完成
+ * </table>
+ */
+
+#define LOG_TAG "tls_async"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_time.h"
+#include "uh_mutex.h"
+#include "uh_log.h"
+#include "uh_al_net.h"
+#include "uh_tls.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+// uhos_tls_handshake_poll每次等待取回的最多事件数
+#ifndef CONFIG_UHOS_TLS_ASYNC_EVENTS
+#define CONFIG_UHOS_TLS_ASYNC_EVENTS    16
+#endif
+
+/**************************************************************************************************/
+/*                                         内部类型定义                                           */
+/**************************************************************************************************/
+/**
+ * @struct      进行中的握手
+ */
+typedef struct uhos_tls_hs
+{
+    struct uhos_tls_hs     *next;
+    uhos_u32                id;                                 //<! 创建序号，识别已释放后被复用的内存
+    uhos_void              *handle;
+    uhos_net_poller_t       poller;
+    uhos_s32                fd;
+    uhos_u32                events;                             //<! 当前在poller上关注的事件
+    uhos_bool               timed;                              //<! 是否设置了超时
+    uhos_u32                deadline;
+    uhos_tls_handshake_cb_t cb;
+    uhos_void              *arg;
+} uhos_tls_hs_t;
+
+/**
+ * @struct      异步握手的全局状态
+ */
+typedef struct
+{
+    uhos_bool      inited;
+    uhos_mutex_t   mutex;                                       //<! 保护以下成员
+    uhos_tls_hs_t *list;
+    uhos_u32       seq;
+} uhos_tls_hs_ctl_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_tls_hs_ctl_t g_uhos_tls_hs_ctl;
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static uhos_void uhos_tls_hs_lock(uhos_void)
+{
+    uhos_mutex_wait(g_uhos_tls_hs_ctl.mutex, UHOS_MUTEX_WAIT_FOREVER);
+}
+
+static uhos_void uhos_tls_hs_unlock(uhos_void)
+{
+    uhos_mutex_release(g_uhos_tls_hs_ctl.mutex);
+}
+
+/**
+ * @brief       按握手对象地址（id不为0时同时比较创建序号）或tls句柄查找，调用者持锁
+ */
+static uhos_tls_hs_t *uhos_tls_hs_find(uhos_void *data, uhos_u32 id, uhos_void *handle)
+{
+    uhos_tls_hs_t *hs = g_uhos_tls_hs_ctl.list;
+
+    for (; hs; hs = hs->next)
+    {
+        if (((uhos_void *)hs == data) && ((0 == id) || (hs->id == id)))
+        {
+            return hs;
+        }
+        if (handle && (hs->handle == handle))
+        {
+            return hs;
+        }
+    }
+
+    return UHOS_NULL;
+}
+
+/**
+ * @brief       移出链表，调用者持锁
+ */
+static uhos_void uhos_tls_hs_unlink(uhos_tls_hs_t *hs)
+{
+    uhos_tls_hs_t **pp = &g_uhos_tls_hs_ctl.list;
+
+    for (; *pp; pp = &(*pp)->next)
+    {
+        if (*pp == hs)
+        {
+            *pp = hs->next;
+            break;
+        }
+    }
+}
+
+/**
+ * @brief       注销套接字并释放已移出链表的握手对象
+ */
+static uhos_void uhos_tls_hs_free(uhos_tls_hs_t *hs)
+{
+    uhos_net_poller_ctl(hs->poller, UHOS_NET_POLL_CTL_DEL, hs->fd, 0, UHOS_NULL);
+    uhos_libc_free(hs);
+}
+
+/**
+ * @brief       结束握手并回调，回调在锁外调用
+ */
+static uhos_void uhos_tls_hs_finish(uhos_tls_hs_t *hs, uhos_s32 result)
+{
+    uhos_void              *handle = hs->handle;
+    uhos_tls_handshake_cb_t cb     = hs->cb;
+    uhos_void              *arg    = hs->arg;
+
+    uhos_tls_hs_lock();
+    uhos_tls_hs_unlink(hs);
+    uhos_tls_hs_unlock();
+
+    uhos_tls_hs_free(hs);
+    cb(handle, result, arg);
+}
+
+/**
+ * @brief       握手一次，返回下一步需要关注的事件
+ * @return      UHOS_NET_POLL_IN/OUT，握手结束时返回0并在*result中给出结果
+ */
+static uhos_u32 uhos_tls_hs_once(uhos_void *handle, uhos_s32 *result)
+{
+    uhos_s32 ret = uhos_tls_handshake(handle);
+
+    if (UHOS_TLS_RET_WANT_READ == ret)
+    {
+        return UHOS_NET_POLL_IN;
+    }
+    if (UHOS_TLS_RET_WANT_WRITE == ret)
+    {
+        return UHOS_NET_POLL_OUT;
+    }
+
+    *result = (UHOS_TLS_RET_OK == ret) ? UHOS_TLS_RET_OK : UHOS_TLS_RET_ERROR;
+    return 0;
+}
+
+/**
+ * @brief       推进一个握手
+ * @param[in]   data    就绪事件的用户数据
+ * @param[in]   id      取回事件时该握手的创建序号，0表示不比较
+ * @param[in]   events  就绪事件
+ * @return      事件属于进行中的握手返回0，否则返回-1
+ */
+static uhos_s32 uhos_tls_hs_step(uhos_void *data, uhos_u32 id, uhos_u32 events)
+{
+    uhos_tls_hs_t *hs     = UHOS_NULL;
+    uhos_u32       want   = 0;
+    uhos_s32       result = UHOS_TLS_RET_ERROR;
+
+    if (!g_uhos_tls_hs_ctl.inited)
+    {
+        return -1;
+    }
+
+    // 同一握手只在其事件循环线程中推进与结束，查找到之后不会被其他线程释放
+    uhos_tls_hs_lock();
+    hs = uhos_tls_hs_find(data, id, UHOS_NULL);
+    uhos_tls_hs_unlock();
+    if (UHOS_NULL == hs)
+    {
+        return -1;
+    }
+
+    want = uhos_tls_hs_once(hs->handle, &result);
+    if (0 == want)
+    {
+        uhos_tls_hs_finish(hs, result);
+        return 0;
+    }
+
+    // 对端已挂断或套接字出错而握手仍在等待，不会再有进展
+    if (events & (UHOS_NET_POLL_ERR | UHOS_NET_POLL_HUP))
+    {
+        UHOS_LOGW("fd %d hangup during handshake", hs->fd);
+        uhos_tls_hs_finish(hs, UHOS_TLS_RET_ERROR);
+        return 0;
+    }
+
+    if (want != hs->events)
+    {
+        if (0 != uhos_net_poller_ctl(hs->poller, UHOS_NET_POLL_CTL_MOD, hs->fd, want, hs))
+        {
+            uhos_tls_hs_finish(hs, UHOS_TLS_RET_ERROR);
+            return 0;
+        }
+        hs->events = want;
+    }
+
+    return 0;
+}
+
+/**************************************************************************************************/
+/*                                          外部函数实现                                          */
+/**************************************************************************************************/
+uhos_s32 uhos_tls_handshake_init(uhos_void)
+{
+    uhos_tls_hs_ctl_t *ctl = &g_uhos_tls_hs_ctl;
+
+    if (ctl->inited)
+    {
+        return 0;
+    }
+
+    if (UHOS_SUCCESS != uhos_mutex_create(&ctl->mutex))
+    {
+        UHOS_LOGE("mutex create failed");
+        return -1;
+    }
+    ctl->inited = UHOS_TRUE;
+
+    return 0;
+}
+
+uhos_s32 uhos_tls_handshake_start(uhos_void *handle, struct uhos_net_poller_s *poller, uhos_s32 socket_fd, uhos_u32 timeout_ms,
+                                  uhos_tls_handshake_cb_t cb, uhos_void *arg)
+{
+    uhos_tls_hs_ctl_t *ctl    = &g_uhos_tls_hs_ctl;
+    uhos_tls_hs_t     *hs     = UHOS_NULL;
+    uhos_u32           events = 0;
+    uhos_s32           result = UHOS_TLS_RET_ERROR;
+    uhos_bool          busy   = UHOS_FALSE;
+
+    if ((UHOS_NULL == handle) || (UHOS_NULL == poller) || (socket_fd < 0) || (UHOS_NULL == cb))
+    {
+        return -1;
+    }
+    if (!ctl->inited)
+    {
+        UHOS_LOGE("uhos_tls_handshake_init not called");
+        return -1;
+    }
+
+    hs = (uhos_tls_hs_t *)uhos_libc_malloc(sizeof(uhos_tls_hs_t));
+    if (UHOS_NULL == hs)
+    {
+        return -1;
+    }
+    uhos_libc_memset(hs, 0, sizeof(uhos_tls_hs_t));
+    hs->handle = handle;
+    hs->poller = poller;
+    hs->fd     = socket_fd;
+    hs->cb     = cb;
+    hs->arg    = arg;
+
+    // 检查与入链表在同一次持锁内完成，同一句柄并发发起时只有一个成功；
+    // 入链表时尚未注册且未设超时，step与超时检查都不会处理该握手
+    uhos_tls_hs_lock();
+    busy = (UHOS_NULL != uhos_tls_hs_find(UHOS_NULL, 0, handle));
+    if (!busy)
+    {
+        hs->id = ++ctl->seq;
+        if (0 == hs->id)
+        {
+            hs->id = ++ctl->seq;
+        }
+        hs->next  = ctl->list;
+        ctl->list = hs;
+    }
+    uhos_tls_hs_unlock();
+    if (busy)
+    {
+        UHOS_LOGE("handshake already in progress");
+        uhos_libc_free(hs);
+        return -1;
+    }
+
+    events = uhos_tls_hs_once(handle, &result);
+    if (0 == events)
+    {
+        uhos_tls_hs_lock();
+        uhos_tls_hs_unlink(hs);
+        uhos_tls_hs_unlock();
+        uhos_libc_free(hs);
+        cb(handle, result, arg);
+        return 0;
+    }
+
+    uhos_tls_hs_lock();
+    hs->events = events;
+    if (timeout_ms > 0)
+    {
+        hs->timed    = UHOS_TRUE;
+        hs->deadline = uhos_current_time_get() + timeout_ms;
+    }
+    uhos_tls_hs_unlock();
+
+    if (0 != uhos_net_poller_ctl(poller, UHOS_NET_POLL_CTL_ADD, socket_fd, events, hs))
+    {
+        UHOS_LOGE("poller add fd %d failed", socket_fd);
+        uhos_tls_hs_lock();
+        uhos_tls_hs_unlink(hs);
+        uhos_tls_hs_unlock();
+        uhos_libc_free(hs);
+        return -1;
+    }
+
+    return 1;
+}
+
+uhos_s32 uhos_tls_handshake_step(uhos_void *data, uhos_u32 events)
+{
+    return uhos_tls_hs_step(data, 0, events);
+}
+
+uhos_s32 uhos_tls_handshake_check_timeout(struct uhos_net_poller_s *poller)
+{
+    uhos_tls_hs_t *hs      = UHOS_NULL;
+    uhos_tls_hs_t *expired = UHOS_NULL;
+    uhos_u32       now     = uhos_current_time_get();
+    uhos_s32       next    = -1;
+    uhos_s32       left    = 0;
+
+    if (!g_uhos_tls_hs_ctl.inited || (UHOS_NULL == poller))
+    {
+        return -1;
+    }
+
+    // 回调中可能发起或取消其他握手，每结束一个超时的握手后从头重新遍历
+    do
+    {
+        expired = UHOS_NULL;
+        next    = -1;
+
+        uhos_tls_hs_lock();
+        for (hs = g_uhos_tls_hs_ctl.list; hs; hs = hs->next)
+        {
+            if ((hs->poller != poller) || !hs->timed)
+            {
+                continue;
+            }
+
+            left = (uhos_s32)(hs->deadline - now);
+            if (left <= 0)
+            {
+                expired = hs;
+                break;
+            }
+            if ((next < 0) || (left < next))
+            {
+                next = left;
+            }
+        }
+        uhos_tls_hs_unlock();
+
+        if (UHOS_NULL != expired)
+        {
+            UHOS_LOGW("fd %d handshake timeout", expired->fd);
+            uhos_tls_hs_finish(expired, UHOS_TLS_RET_TIMEOUT);
+        }
+    } while (UHOS_NULL != expired);
+
+    return next;
+}
+
+uhos_s32 uhos_tls_handshake_cancel(uhos_void *handle)
+{
+    uhos_tls_hs_t *hs = UHOS_NULL;
+
+    if ((UHOS_NULL == handle) || !g_uhos_tls_hs_ctl.inited)
+    {
+        return -1;
+    }
+
+    uhos_tls_hs_lock();
+    hs = uhos_tls_hs_find(UHOS_NULL, 0, handle);
+    if (UHOS_NULL != hs)
+    {
+        uhos_tls_hs_unlink(hs);
+    }
+    uhos_tls_hs_unlock();
+    if (UHOS_NULL == hs)
+    {
+        return -1;
+    }
+
+    uhos_tls_hs_free(hs);
+    return 0;
+}
+
+uhos_s32 uhos_tls_handshake_poll(struct uhos_net_poller_s *poller, uhos_s32 timeout_ms)
+{
+    uhos_net_poll_event_t events[CONFIG_UHOS_TLS_ASYNC_EVENTS];
+    uhos_u32              ids[CONFIG_UHOS_TLS_ASYNC_EVENTS];
+    uhos_tls_hs_t        *hs   = UHOS_NULL;
+    uhos_s32              next = -1;
+    uhos_s32              num  = 0;
+    uhos_s32              i    = 0;
+
+    if (!g_uhos_tls_hs_ctl.inited || (UHOS_NULL == poller))
+    {
+        return -1;
+    }
+
+    next = uhos_tls_handshake_check_timeout(poller);
+
+    if ((next >= 0) && ((timeout_ms < 0) || (next < timeout_ms)))
+    {
+        timeout_ms = next;
+    }
+
+    num = uhos_net_poller_wait(poller, events, CONFIG_UHOS_TLS_ASYNC_EVENTS, timeout_ms);
+    if (num < 0)
+    {
+        return -1;
+    }
+
+    // 取回事件时记下各握手的创建序号，前面事件的回调结束了后面的握手时，其内存可能已被释放或复用
+    uhos_tls_hs_lock();
+    for (i = 0; i < num; i++)
+    {
+        hs     = uhos_tls_hs_find(events[i].data, 0, UHOS_NULL);
+        ids[i] = ((UHOS_NULL != hs) && (hs->poller == poller)) ? hs->id : 0;
+    }
+    uhos_tls_hs_unlock();
+
+    for (i = 0; i < num; i++)
+    {
+        if (0 != ids[i])
+        {
+            uhos_tls_hs_step(events[i].data, ids[i], events[i].events);
+        }
+    }
+    uhos_tls_handshake_check_timeout(poller);
+
+    num = 0;
+    uhos_tls_hs_lock();
+    for (hs = g_uhos_tls_hs_ctl.list; hs; hs = hs->next)
+    {
+        if (hs->poller == poller)
+        {
+            num++;
+        }
+    }
+    uhos_tls_hs_unlock();
+
+    return num;
+}
@@ -0,0 +1,483 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_tls_async_bench.c
+ * @author agent (agent@local)
+ * @brief 异步tls握手并发测试的功能实现
+ * @details 全部连接共用一个证书库，TCP连接以阻塞方式建立后设为非阻塞，各事件循环线程等待同一信号后
+ *          发起各自的握手，再以uhos_tls_handshake_poll驱动到结束。
+ *          超时连接连到本地一个只监听不应答的端口，用于检查超时只在所属事件循环中回调，
+ *          且不拖慢同一循环中其他连接的握手
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：异步tls握手并发测试的功能实现
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>输出与计时改用uh_bench.h
+ * </table>
+ */
+
+#define LOG_TAG "tls-async-bench"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_osal.h"
+#include "uh_log.h"
+#include "uh_al_net.h"
+#include "uh_tls.h"
+#include "uh_bench.h"
+
+#include "uh_tls_async_bench.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+#define UHOS_TLS_ASYNC_BENCH_TASK_NAME          "tls_async_bench"
+#define UHOS_TLS_ASYNC_BENCH_TASK_STACK_SIZE    8 * 1024
+#define UHOS_TLS_ASYNC_BENCH_TASK_PRIORITY      5
+
+// 每个事件循环最多的超时连接数
+#define UHOS_TLS_ASYNC_BENCH_STALLED_MAX        4
+
+// 矩阵用例的握手超时
+#define UHOS_TLS_ASYNC_BENCH_TIMEOUT_MS         1000
+
+// JSON行的最大长度
+#define UHOS_TLS_ASYNC_BENCH_JSON_LEN           256
+
+#define UHOS_TLS_ASYNC_BENCH_ARRAY_NUM(a)       (sizeof(a) / sizeof((a)[0]))
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+struct uhos_tls_async_bench_loop;
+
+/**
+ * @struct      一个连接
+ */
+typedef struct
+{
+    struct uhos_tls_async_bench_loop *loop;                     //<! 所属事件循环
+    uhos_s32                          fd;
+    uhos_void                        *tls;
+    uhos_u32                          done;                     //<! 回调次数
+    uhos_s32                          result;
+    uhos_u32                          done_us;                  //<! 回调时刻，相对发起时刻
+    uhos_u8                           foreign;                  //<! 在其他线程中回调
+} uhos_tls_async_bench_link_t;
+
+/**
+ * @struct      一个事件循环
+ */
+typedef struct uhos_tls_async_bench_loop
+{
+    uhos_net_poller_t            poller;
+    uhos_thread_t                tid;
+    uhos_u64                     thread_id;                     //<! 事件循环线程的系统线程号
+    uhos_sem_t                   start_sem;                     //<! 全部线程创建后同时开始
+    uhos_sem_t                   exit_sem;                      //<! 该循环上的握手已全部结束
+    uhos_u8                      running;
+    uhos_u32                     timeout_ms;
+    uhos_tls_async_bench_link_t *links;
+    uhos_u32                     num;
+} uhos_tls_async_bench_loop_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_u32       g_uhos_tls_async_bench_start_us;
+static const uhos_u32 g_uhos_tls_async_bench_loops[]   = {1, 2};
+static const uhos_u32 g_uhos_tls_async_bench_stalled[] = {0, 2};
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       握手完成回调
+ */
+static uhos_void uhos_tls_async_bench_cb(uhos_void *handle, uhos_s32 result, uhos_void *arg)
+{
+    uhos_tls_async_bench_link_t *link = (uhos_tls_async_bench_link_t *)arg;
+
+    (void)handle;
+
+    link->done++;
+    link->result  = result;
+    link->done_us = uhos_bench_now_us() - g_uhos_tls_async_bench_start_us;
+    if (uhos_thread_gettid() != link->loop->thread_id)
+    {
+        link->foreign = 1;
+    }
+}
+
+/**
+ * @brief       事件循环线程
+ */
+static void *uhos_tls_async_bench_loop_task(void *param)
+{
+    uhos_tls_async_bench_loop_t *loop = (uhos_tls_async_bench_loop_t *)param;
+    uhos_tls_async_bench_link_t *link = UHOS_NULL;
+    uhos_thread_t                tid  = UHOS_NULL;
+    uhos_u32                     i    = 0;
+
+    loop->thread_id = uhos_thread_gettid();
+    uhos_sem_wait(loop->start_sem, UHOS_SEM_WAIT_FOREVER);
+
+    for (i = 0; i < loop->num; i++)
+    {
+        link = &loop->links[i];
+        if (uhos_tls_handshake_start(link->tls, loop->poller, link->fd, loop->timeout_ms, uhos_tls_async_bench_cb, link) < 0)
+        {
+            UHOS_LOGE("fd %d handshake start failed", link->fd);
+        }
+    }
+
+    while (uhos_tls_handshake_poll(loop->poller, -1) > 0)
+    {
+    }
+
+    // 线程句柄在创建返回后才写入，开始信号在全部线程创建后才发出
+    tid = loop->tid;
+    uhos_sem_release(loop->exit_sem);
+    uhos_thread_delete(tid);
+
+    return UHOS_NULL;
+}
+
+/**
+ * @brief       以阻塞方式连接，成功后设为非阻塞
+ * @return      socket，-1表示失败
+ */
+static uhos_s32 uhos_tls_async_bench_connect(const struct uhos_sockaddr_in *addr)
+{
+    uhos_s32 fd = uhos_net_socket(UHOS_AF_INET, UHOS_SOCK_STREAM, 0);
+    uhos_s32 on = 1;
+
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    if ((0 != uhos_net_connect(fd, (const struct uhos_sockaddr *)addr, sizeof(struct uhos_sockaddr_in))) ||
+        (0 != uhos_net_setsockopt(fd, UHOS_SOL_SOCKET, SO_OPT_NONBLOCK, &on, sizeof(on))))
+    {
+        uhos_net_close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+/**
+ * @brief       在回环地址的临时端口上监听，只接受连接、不应答
+ * @return      socket，-1表示失败
+ */
+static uhos_s32 uhos_tls_async_bench_listen(uhos_u32 backlog, struct uhos_sockaddr_in *addr)
+{
+    uhos_socklen_t len = sizeof(struct uhos_sockaddr_in);
+    uhos_s32       fd  = uhos_net_socket(UHOS_AF_INET, UHOS_SOCK_STREAM, 0);
+
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    uhos_libc_memset(addr, 0, sizeof(struct uhos_sockaddr_in));
+    addr->sin_family      = UHOS_AF_INET;
+    addr->sin_addr.s_addr = uhos_net_htonl(UHOS_INADDR_LOOPBACK);
+    if ((0 != uhos_net_bind(fd, (struct uhos_sockaddr *)addr, sizeof(struct uhos_sockaddr_in))) ||
+        (0 != uhos_net_listen(fd, (uhos_s32)backlog)) ||
+        (0 != uhos_net_getsockname(fd, (struct uhos_sockaddr *)addr, &len)))
+    {
+        uhos_net_close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+/**
+ * @brief       统计各连接的回调
+ */
+static uhos_void uhos_tls_async_bench_tally(const uhos_tls_async_bench_link_t *links, uhos_u32 num,
+                                            uhos_tls_async_bench_result_t *result)
+{
+    uhos_u32 i = 0;
+
+    for (i = 0; i < num; i++)
+    {
+        if (0 == links[i].done)
+        {
+            continue;
+        }
+
+        result->repeated += links[i].done - 1;
+        result->foreign  += links[i].foreign;
+        if (UHOS_TLS_RET_OK == links[i].result)
+        {
+            result->ok++;
+            if (links[i].done_us > result->max_us)
+            {
+                result->max_us = links[i].done_us;
+            }
+        }
+        else if (UHOS_TLS_RET_TIMEOUT == links[i].result)
+        {
+            result->timeout++;
+        }
+        else
+        {
+            result->failed++;
+        }
+    }
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_s32 uhos_tls_async_bench_run(const uhos_tls_async_bench_target_t *target, const uhos_tls_async_bench_case_t *bcase,
+                                  uhos_tls_async_bench_result_t *result)
+{
+    uhos_tls_async_bench_loop_t  loops[UHOS_TLS_ASYNC_BENCH_LOOPS_MAX];
+    uhos_tls_async_bench_link_t *links     = UHOS_NULL;
+    uhos_tls_async_bench_link_t *link      = UHOS_NULL;
+    uhos_thread_attr_t           attr      = {0};
+    struct uhos_sockaddr_in      srv_addr  = {0};
+    struct uhos_sockaddr_in      mute_addr = {0};
+    uhos_void                   *store     = UHOS_NULL;
+    uhos_s32                     mute_fd   = -1;
+    uhos_u32                     total     = 0;
+    uhos_u32                     per_loop  = 0;
+    uhos_u32                     i         = 0;
+    uhos_u32                     j         = 0;
+
+    if ((UHOS_NULL == target) || (UHOS_NULL == bcase) || (UHOS_NULL == result) || (0 == bcase->loops) ||
+        (bcase->loops > UHOS_TLS_ASYNC_BENCH_LOOPS_MAX) || (bcase->links < bcase->loops) ||
+        (bcase->links > CONFIG_UHOS_TLS_ASYNC_BENCH_LINKS) || (bcase->stalled > UHOS_TLS_ASYNC_BENCH_STALLED_MAX) ||
+        ((bcase->stalled > 0) && (0 == bcase->timeout_ms)))
+    {
+        return -1;
+    }
+
+    uhos_libc_memset(result, 0, sizeof(uhos_tls_async_bench_result_t));
+    uhos_libc_memset(loops, 0, sizeof(loops));
+    result->status = -1;
+
+    if (0 != uhos_tls_handshake_init())
+    {
+        return -1;
+    }
+
+    // 各事件循环的连接连续存放：先是正常连接，后是超时连接
+    per_loop = bcase->links / bcase->loops + bcase->stalled + 1;
+    total    = per_loop * bcase->loops;
+    links    = (uhos_tls_async_bench_link_t *)uhos_libc_malloc(total * sizeof(uhos_tls_async_bench_link_t));
+    store    = uhos_tls_store_create(target->ca_cert, target->ca_cert_len, UHOS_NULL, 0, UHOS_NULL, 0);
+    if ((UHOS_NULL == links) || (UHOS_NULL == store))
+    {
+        goto out;
+    }
+    uhos_libc_memset(links, 0, total * sizeof(uhos_tls_async_bench_link_t));
+    for (i = 0; i < total; i++)
+    {
+        links[i].fd = -1;
+    }
+
+    if (bcase->stalled > 0)
+    {
+        mute_fd = uhos_tls_async_bench_listen(bcase->stalled * bcase->loops, &mute_addr);
+        if (mute_fd < 0)
+        {
+            goto out;
+        }
+    }
+
+    srv_addr.sin_family      = UHOS_AF_INET;
+    srv_addr.sin_port        = uhos_net_htons(target->port);
+    srv_addr.sin_addr.s_addr = uhos_net_inet_addr(target->ip);
+
+    for (i = 0; i < bcase->loops; i++)
+    {
+        loops[i].links      = &links[i * per_loop];
+        loops[i].num        = bcase->links / bcase->loops + ((i < bcase->links % bcase->loops) ? 1 : 0);
+        loops[i].timeout_ms = bcase->timeout_ms;
+        for (j = 0; j < loops[i].num + bcase->stalled; j++)
+        {
+            link       = &loops[i].links[j];
+            link->loop = &loops[i];
+            link->fd   = uhos_tls_async_bench_connect((j < loops[i].num) ? &srv_addr : &mute_addr);
+            link->tls  = uhos_tls_init();
+            if ((link->fd < 0) || (UHOS_NULL == link->tls) || (0 != uhos_tls_set_ca_store(link->tls, store)) ||
+                (0 != uhos_tls_set_connected_socket(link->tls, link->fd)) || (0 != uhos_tls_start(link->tls)))
+            {
+                UHOS_LOGE("link %u prepare failed", (unsigned)j);
+                goto out;
+            }
+        }
+        loops[i].num += bcase->stalled;
+
+        loops[i].poller = uhos_net_poller_create(loops[i].num);
+        if (UHOS_NULL == loops[i].poller)
+        {
+            goto out;
+        }
+    }
+
+    attr.stack_size = UHOS_TLS_ASYNC_BENCH_TASK_STACK_SIZE;
+    attr.priority   = UHOS_TLS_ASYNC_BENCH_TASK_PRIORITY;
+    attr.name       = UHOS_TLS_ASYNC_BENCH_TASK_NAME;
+    for (i = 0; i < bcase->loops; i++)
+    {
+        if (UHOS_SUCCESS != uhos_sem_create(&loops[i].start_sem, 0))
+        {
+            break;
+        }
+        if (UHOS_SUCCESS != uhos_sem_create(&loops[i].exit_sem, 0))
+        {
+            uhos_sem_delete(loops[i].start_sem);
+            break;
+        }
+        if (UHOS_SUCCESS != uhos_thread_create(&loops[i].tid, uhos_tls_async_bench_loop_task, &loops[i], &attr))
+        {
+            uhos_sem_delete(loops[i].start_sem);
+            uhos_sem_delete(loops[i].exit_sem);
+            break;
+        }
+        loops[i].running = 1;
+    }
+
+    g_uhos_tls_async_bench_start_us = uhos_bench_now_us();
+    for (i = 0; i < bcase->loops; i++)
+    {
+        if (loops[i].running)
+        {
+            uhos_sem_release(loops[i].start_sem);
+        }
+    }
+    for (i = 0; i < bcase->loops; i++)
+    {
+        if (loops[i].running)
+        {
+            uhos_sem_wait(loops[i].exit_sem, UHOS_SEM_WAIT_FOREVER);
+            uhos_sem_delete(loops[i].start_sem);
+            uhos_sem_delete(loops[i].exit_sem);
+        }
+    }
+    result->elapsed_us = uhos_bench_now_us() - g_uhos_tls_async_bench_start_us;
+
+    for (i = 0; i < bcase->loops; i++)
+    {
+        uhos_tls_async_bench_tally(loops[i].links, loops[i].num, result);
+    }
+    if ((result->ok == bcase->links) && (result->timeout == bcase->stalled * bcase->loops) && (0 == result->failed) &&
+        (0 == result->foreign) && (0 == result->repeated))
+    {
+        result->status = 0;
+    }
+
+out:
+    for (i = 0; i < bcase->loops; i++)
+    {
+        if (UHOS_NULL != loops[i].poller)
+        {
+            uhos_net_poller_destroy(loops[i].poller);
+        }
+    }
+    for (i = 0; (UHOS_NULL != links) && (i < total); i++)
+    {
+        if (UHOS_NULL != links[i].tls)
+        {
+            uhos_tls_uninit(links[i].tls);
+        }
+        if (links[i].fd >= 0)
+        {
+            uhos_net_close(links[i].fd);
+        }
+    }
+    if (mute_fd >= 0)
+    {
+        uhos_net_close(mute_fd);
+    }
+    if (UHOS_NULL != store)
+    {
+        uhos_tls_store_release(store);
+    }
+    if (UHOS_NULL != links)
+    {
+        uhos_libc_free(links);
+    }
+
+    if (0 != result->status)
+    {
+        UHOS_LOGE("bench loops %u failed: ok %u failed %u timeout %u foreign %u repeated %u", (unsigned)bcase->loops,
+                  (unsigned)result->ok, (unsigned)result->failed, (unsigned)result->timeout, (unsigned)result->foreign,
+                  (unsigned)result->repeated);
+    }
+
+    return result->status;
+}
+
+uhos_s32 uhos_tls_async_bench_result_json(const uhos_tls_async_bench_case_t *bcase, const uhos_tls_async_bench_result_t *result,
+                                          uhos_char *buf, uhos_u32 size)
+{
+    uhos_bench_json_t json = {0};
+
+    if ((UHOS_NULL == bcase) || (UHOS_NULL == result) || (UHOS_NULL == buf))
+    {
+        return 0;
+    }
+
+    uhos_bench_json_begin(&json, buf, size);
+    uhos_bench_json_u32(&json, "links", bcase->links);
+    uhos_bench_json_u32(&json, "loops", bcase->loops);
+    uhos_bench_json_u32(&json, "stalled", bcase->stalled);
+    uhos_bench_json_status(&json, result->status);
+    uhos_bench_json_u32(&json, "ok", result->ok);
+    uhos_bench_json_u32(&json, "failed", result->failed);
+    uhos_bench_json_u32(&json, "timeout", result->timeout);
+    uhos_bench_json_u32(&json, "foreign", result->foreign);
+    uhos_bench_json_u32(&json, "repeated", result->repeated);
+    uhos_bench_json_u32(&json, "elapsed_us", result->elapsed_us);
+    uhos_bench_json_u32(&json, "max_us", result->max_us);
+
+    return uhos_bench_json_end(&json);
+}
+
+uhos_s32 uhos_tls_async_bench_matrix_run(const uhos_tls_async_bench_target_t *target, uhos_bench_print_t print)
+{
+    uhos_tls_async_bench_case_t   bcase  = {0};
+    uhos_tls_async_bench_result_t result = {0};
+    uhos_char                     line[UHOS_TLS_ASYNC_BENCH_JSON_LEN];
+    uhos_s32                      ret    = 0;
+    uhos_u32                      i      = 0;
+    uhos_u32                      j      = 0;
+
+    if ((UHOS_NULL == target) || (UHOS_NULL == print))
+    {
+        return -1;
+    }
+
+    bcase.links      = CONFIG_UHOS_TLS_ASYNC_BENCH_LINKS;
+    bcase.timeout_ms = UHOS_TLS_ASYNC_BENCH_TIMEOUT_MS;
+
+    for (i = 0; i < UHOS_TLS_ASYNC_BENCH_ARRAY_NUM(g_uhos_tls_async_bench_loops); i++)
+    {
+        for (j = 0; j < UHOS_TLS_ASYNC_BENCH_ARRAY_NUM(g_uhos_tls_async_bench_stalled); j++)
+        {
+            bcase.loops   = g_uhos_tls_async_bench_loops[i];
+            bcase.stalled = g_uhos_tls_async_bench_stalled[j];
+
+            if (0 != uhos_tls_async_bench_run(target, &bcase, &result))
+            {
+                ret = -1;
+            }
+            uhos_tls_async_bench_result_json(&bcase, &result, line, sizeof(line));
+            print(line);
+        }
+    }
+
+    return ret;
+}
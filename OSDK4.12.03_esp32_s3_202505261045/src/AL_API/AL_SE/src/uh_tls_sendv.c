@@ -0,0 +1,127 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_tls_sendv.c
+ * @author agent (agent@local)
+ * @brief tls聚合发送uhos_tls_sendv的实现，基于各平台的uhos_tls_send
+ * @details 每次uhos_tls_send产生至少一个tls记录，逐段发送协议头会使每个头单独占用一个记录
+ *          （额外的记录头、MAC与一次加密调用）。这里把小于合并缓冲的相邻数据段拷贝到栈上合并后发送，
+ *          不小于合并缓冲的数据段直接从原buffer发送。
+ *          合并方式只由剩余数据决定，按接口要求以相同剩余数据重试时，重试的记录与上次完全一致
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：tls聚合发送uhos_tls_sendv的实现，基于各平台的uhos_tls_send
+ * </table>
+ */
+
+#define LOG_TAG "tls_sendv"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_al_net.h"
+#include "uh_tls.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+// 合并缓冲大小，位于调用者栈上
+#ifndef CONFIG_UHOS_TLS_SENDV_COALESCE
+#define CONFIG_UHOS_TLS_SENDV_COALESCE 512
+#endif
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       发送一段数据并累计已发送字节数
+ * @return      UHOS_TRUE-全部发送，可以继续；UHOS_FALSE-应返回*ret
+ */
+static uhos_bool uhos_tls_sendv_put(uhos_void *handle, const uhos_u8 *data, uhos_size_t len, uhos_s32 *total, uhos_s32 *ret)
+{
+    uhos_s32 sent = uhos_tls_send(handle, data, len);
+
+    if (sent <= 0)
+    {
+        // 已有数据发出时先返回已发送字节数，错误在下次调用时再上报
+        *ret = (*total > 0) ? *total : sent;
+        return UHOS_FALSE;
+    }
+
+    *total += sent;
+    if ((uhos_size_t)sent < len)
+    {
+        *ret = *total;
+        return UHOS_FALSE;
+    }
+
+    return UHOS_TRUE;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_s32 uhos_tls_sendv(uhos_void *handle, const struct uhos_iovec *iov, uhos_s32 iovcnt)
+{
+    uhos_u8        buf[CONFIG_UHOS_TLS_SENDV_COALESCE];
+    uhos_size_t    fill  = 0;
+    uhos_s32       total = 0;
+    uhos_s32       ret   = 0;
+    uhos_s32       i     = 0;
+
+    if ((UHOS_NULL == handle) || (UHOS_NULL == iov) || (iovcnt <= 0))
+    {
+        return UHOS_TLS_RET_ERROR;
+    }
+
+    for (i = 0; i < iovcnt; i++)
+    {
+        const uhos_u8 *data = (const uhos_u8 *)iov[i].iov_base;
+        uhos_size_t    len  = iov[i].iov_len;
+
+        while (len > 0)
+        {
+            uhos_size_t copy = 0;
+
+            // 大段数据不经过合并缓冲
+            if ((0 == fill) && (len >= sizeof(buf)))
+            {
+                if (!uhos_tls_sendv_put(handle, data, len, &total, &ret))
+                {
+                    return ret;
+                }
+                break;
+            }
+
+            copy = sizeof(buf) - fill;
+            if (copy > len)
+            {
+                copy = len;
+            }
+            uhos_libc_memcpy(&buf[fill], data, copy);
+            fill += copy;
+            data += copy;
+            len  -= copy;
+
+            if (fill == sizeof(buf))
+            {
+                if (!uhos_tls_sendv_put(handle, buf, fill, &total, &ret))
+                {
+                    return ret;
+                }
+                fill = 0;
+            }
+        }
+    }
+
+    if ((fill > 0) && !uhos_tls_sendv_put(handle, buf, fill, &total, &ret))
+    {
+        return ret;
+    }
+
+    return total;
+}
@@ -0,0 +1,481 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file uh_tls_session.c
+ * @author agent (agent@local)
+ * @brief 按服务器缓存tls会话，基于各平台的uhos_tls_session_save/restore
+ * @details 每个服务器(host, port)保存一个会话，满时替换最久未使用的。
+ *          指定配置区时启动加载，重启或低功耗唤醒后的首次连接即可恢复会话；配置区由各平台的
+ *          uhos_tls_session_zone_read/write存储。只有新增服务器或完整握手换了新会话时才需写回，
+ *          恢复会话的握手（如TLS1.3每次下发新票据）只更新内存；新服务器占用空闲项时立即写回，
+ *          其他变化距上次写回不足CONFIG_UHOS_TLS_SESSION_PERSIST_MIN_MS时推迟到之后的更新，避免频繁擦写flash。
+ *          配置区数据带魔数、版本与CRC32，校验失败时按空缓存处理
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：按服务器缓存tls会话，基于各平台的uhos_tls_session_save/restore
+ * </table>
+ */
+
+#define LOG_TAG "tls_sess"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_mutex.h"
+#include "uh_time.h"
+#include "uh_log.h"
+#include "uh_tls.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+// 缓存的服务器数
+#ifndef CONFIG_UHOS_TLS_SESSION_CACHE_NUM
+#define CONFIG_UHOS_TLS_SESSION_CACHE_NUM   2
+#endif
+
+// 单个会话的最大长度，会话中保留了服务器证书时可达1~2KB
+#ifndef CONFIG_UHOS_TLS_SESSION_LEN
+#define CONFIG_UHOS_TLS_SESSION_LEN         1536
+#endif
+
+// 配置区大小
+#ifndef CONFIG_UHOS_TLS_SESSION_ZONE_SIZE
+#define CONFIG_UHOS_TLS_SESSION_ZONE_SIZE   4096
+#endif
+
+// 两次写配置区的最小间隔（毫秒）
+#ifndef CONFIG_UHOS_TLS_SESSION_PERSIST_MIN_MS
+#define CONFIG_UHOS_TLS_SESSION_PERSIST_MIN_MS  (10 * 60 * 1000)
+#endif
+
+#define UHOS_TLS_SESSION_HOST_LEN           64
+#define UHOS_TLS_SESSION_MAGIC              0x55545353          // "UTSS"
+#define UHOS_TLS_SESSION_VERSION            1
+
+// 配置区头：魔数(4) 版本(1) 会话数(1) 保留(2) 数据长度(4) CRC32(4)
+#define UHOS_TLS_SESSION_HDR_LEN            16
+// 每个会话：host(64) port(2) len(2) 会话数据
+#define UHOS_TLS_SESSION_ITEM_LEN           (UHOS_TLS_SESSION_HOST_LEN + 4)
+
+/**************************************************************************************************/
+/*                                         内部类型定义                                           */
+/**************************************************************************************************/
+/**
+ * @struct      缓存项
+ */
+typedef struct
+{
+    uhos_char host[UHOS_TLS_SESSION_HOST_LEN];
+    uhos_u16  port;
+    uhos_u16  len;                                              //<! 0表示空闲
+    uhos_u32  used;                                             //<! 最近使用序号，用于替换
+    uhos_u8  *data;
+} uhos_tls_session_item_t;
+
+/**
+ * @struct      会话缓存
+ */
+typedef struct
+{
+    uhos_bool               inited;
+    uhos_u8                 zone;
+    uhos_mutex_t            mutex;                              //<! 保护以下成员
+    uhos_u32                seq;
+    uhos_bool               dirty;                              //<! 有未写入配置区的变化
+    uhos_bool               written;                            //<! 本次启动后已写过配置区
+    uhos_u32                written_ms;                         //<! 上次写配置区的时刻
+    uhos_tls_session_item_t items[CONFIG_UHOS_TLS_SESSION_CACHE_NUM];
+} uhos_tls_session_cache_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static uhos_tls_session_cache_t g_uhos_tls_session_cache;
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static uhos_void uhos_tls_session_lock(uhos_void)
+{
+    uhos_mutex_wait(g_uhos_tls_session_cache.mutex, UHOS_MUTEX_WAIT_FOREVER);
+}
+
+static uhos_void uhos_tls_session_unlock(uhos_void)
+{
+    uhos_mutex_release(g_uhos_tls_session_cache.mutex);
+}
+
+static uhos_u32 uhos_tls_session_crc32(const uhos_u8 *data, uhos_u32 len)
+{
+    uhos_u32 crc = 0xFFFFFFFF;
+    uhos_u8  bit = 0;
+
+    while (len--)
+    {
+        crc ^= *data++;
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+
+    return ~crc;
+}
+
+static uhos_void uhos_tls_session_put_u16(uhos_u8 *p, uhos_u16 v)
+{
+    p[0] = (uhos_u8)v;
+    p[1] = (uhos_u8)(v >> 8);
+}
+
+static uhos_void uhos_tls_session_put_u32(uhos_u8 *p, uhos_u32 v)
+{
+    uhos_tls_session_put_u16(p, (uhos_u16)v);
+    uhos_tls_session_put_u16(p + 2, (uhos_u16)(v >> 16));
+}
+
+static uhos_u16 uhos_tls_session_get_u16(const uhos_u8 *p)
+{
+    return (uhos_u16)(p[0] | (p[1] << 8));
+}
+
+static uhos_u32 uhos_tls_session_get_u32(const uhos_u8 *p)
+{
+    return uhos_tls_session_get_u16(p) | ((uhos_u32)uhos_tls_session_get_u16(p + 2) << 16);
+}
+
+static uhos_void uhos_tls_session_item_clear(uhos_tls_session_item_t *item)
+{
+    uhos_libc_free(item->data);
+    uhos_libc_memset(item, 0, sizeof(uhos_tls_session_item_t));
+}
+
+static uhos_tls_session_item_t *uhos_tls_session_find(const uhos_char *host, uhos_u16 port)
+{
+    uhos_tls_session_item_t *item = g_uhos_tls_session_cache.items;
+    uhos_u8                  i    = 0;
+
+    for (i = 0; i < CONFIG_UHOS_TLS_SESSION_CACHE_NUM; i++, item++)
+    {
+        if ((item->len > 0) && (item->port == port) && (0 == uhos_libc_strcmp(item->host, host)))
+        {
+            return item;
+        }
+    }
+
+    return UHOS_NULL;
+}
+
+/**
+ * @brief       取空闲项，没有时取最久未使用的项
+ */
+static uhos_tls_session_item_t *uhos_tls_session_victim(uhos_void)
+{
+    uhos_tls_session_item_t *items  = g_uhos_tls_session_cache.items;
+    uhos_tls_session_item_t *victim = &items[0];
+    uhos_u8                  i      = 0;
+
+    for (i = 0; i < CONFIG_UHOS_TLS_SESSION_CACHE_NUM; i++)
+    {
+        if (0 == items[i].len)
+        {
+            return &items[i];
+        }
+        if ((uhos_s32)(items[i].used - victim->used) < 0)
+        {
+            victim = &items[i];
+        }
+    }
+
+    return victim;
+}
+
+/**
+ * @brief       将缓存序列化为配置区格式，调用者持锁
+ * @return      数据长度，失败返回0
+ */
+static uhos_u32 uhos_tls_session_pack(uhos_u8 *buf)
+{
+    uhos_tls_session_item_t *item = g_uhos_tls_session_cache.items;
+    uhos_u32                 off  = UHOS_TLS_SESSION_HDR_LEN;
+    uhos_u8                  num  = 0;
+    uhos_u8                  i    = 0;
+
+    for (i = 0; i < CONFIG_UHOS_TLS_SESSION_CACHE_NUM; i++, item++)
+    {
+        if ((0 == item->len) || (off + UHOS_TLS_SESSION_ITEM_LEN + item->len > CONFIG_UHOS_TLS_SESSION_ZONE_SIZE))
+        {
+            continue;
+        }
+        uhos_libc_memcpy(&buf[off], item->host, UHOS_TLS_SESSION_HOST_LEN);
+        uhos_tls_session_put_u16(&buf[off + UHOS_TLS_SESSION_HOST_LEN], item->port);
+        uhos_tls_session_put_u16(&buf[off + UHOS_TLS_SESSION_HOST_LEN + 2], item->len);
+        off += UHOS_TLS_SESSION_ITEM_LEN;
+        uhos_libc_memcpy(&buf[off], item->data, item->len);
+        off += item->len;
+        num++;
+    }
+
+    uhos_tls_session_put_u32(&buf[0], UHOS_TLS_SESSION_MAGIC);
+    buf[4] = UHOS_TLS_SESSION_VERSION;
+    buf[5] = num;
+    uhos_tls_session_put_u16(&buf[6], 0);
+    uhos_tls_session_put_u32(&buf[8], off - UHOS_TLS_SESSION_HDR_LEN);
+    uhos_tls_session_put_u32(&buf[12], uhos_tls_session_crc32(&buf[UHOS_TLS_SESSION_HDR_LEN], off - UHOS_TLS_SESSION_HDR_LEN));
+
+    return off;
+}
+
+/**
+ * @brief       从配置区数据恢复缓存，调用者持锁
+ */
+static uhos_void uhos_tls_session_unpack(const uhos_u8 *buf)
+{
+    uhos_tls_session_item_t *item = g_uhos_tls_session_cache.items;
+    uhos_u32                 len  = uhos_tls_session_get_u32(&buf[8]);
+    uhos_u32                 off  = UHOS_TLS_SESSION_HDR_LEN;
+    uhos_u8                  num  = buf[5];
+
+    if ((UHOS_TLS_SESSION_MAGIC != uhos_tls_session_get_u32(&buf[0])) || (UHOS_TLS_SESSION_VERSION != buf[4]))
+    {
+        return;
+    }
+    if ((len > CONFIG_UHOS_TLS_SESSION_ZONE_SIZE - UHOS_TLS_SESSION_HDR_LEN) ||
+        (uhos_tls_session_get_u32(&buf[12]) != uhos_tls_session_crc32(&buf[UHOS_TLS_SESSION_HDR_LEN], len)))
+    {
+        UHOS_LOGW("session zone corrupted");
+        return;
+    }
+
+    len += UHOS_TLS_SESSION_HDR_LEN;
+    while ((num-- > 0) && (item < &g_uhos_tls_session_cache.items[CONFIG_UHOS_TLS_SESSION_CACHE_NUM]) &&
+           (off + UHOS_TLS_SESSION_ITEM_LEN <= len))
+    {
+        uhos_u16 size = uhos_tls_session_get_u16(&buf[off + UHOS_TLS_SESSION_HOST_LEN + 2]);
+
+        if ((0 == size) || (size > CONFIG_UHOS_TLS_SESSION_LEN) || (off + UHOS_TLS_SESSION_ITEM_LEN + size > len))
+        {
+            break;
+        }
+        item->data = uhos_libc_malloc(size);
+        if (UHOS_NULL == item->data)
+        {
+            UHOS_LOG_MEM_ALLOC_FAIL();
+            break;
+        }
+        uhos_libc_memcpy(item->host, &buf[off], UHOS_TLS_SESSION_HOST_LEN);
+        item->host[UHOS_TLS_SESSION_HOST_LEN - 1] = '\0';
+        item->port = uhos_tls_session_get_u16(&buf[off + UHOS_TLS_SESSION_HOST_LEN]);
+        off       += UHOS_TLS_SESSION_ITEM_LEN;
+        uhos_libc_memcpy(item->data, &buf[off], size);
+        item->len  = size;
+        off       += size;
+        item++;
+    }
+}
+
+/**
+ * @brief       将有变化的缓存写入配置区
+ * @param[in]   force   UHOS_FALSE时距上次写入不足CONFIG_UHOS_TLS_SESSION_PERSIST_MIN_MS则推迟
+ */
+static uhos_void uhos_tls_session_persist(uhos_bool force)
+{
+    uhos_tls_session_cache_t *cache = &g_uhos_tls_session_cache;
+    uhos_u8                  *buf   = UHOS_NULL;
+    uhos_u32                  now   = 0;
+    uhos_u32                  len   = 0;
+
+    if ((0 == cache->zone) || !cache->dirty)
+    {
+        return;
+    }
+
+    buf = uhos_libc_zalloc(CONFIG_UHOS_TLS_SESSION_ZONE_SIZE);
+    if (UHOS_NULL == buf)
+    {
+        UHOS_LOG_MEM_ALLOC_FAIL();
+        return;
+    }
+
+    uhos_tls_session_lock();
+    now = uhos_current_time_get();
+    if (cache->dirty && (force || !cache->written || (now - cache->written_ms >= CONFIG_UHOS_TLS_SESSION_PERSIST_MIN_MS)))
+    {
+        len               = uhos_tls_session_pack(buf);
+        cache->dirty      = UHOS_FALSE;
+        cache->written    = UHOS_TRUE;
+        cache->written_ms = now;
+    }
+    uhos_tls_session_unlock();
+
+    if ((len > 0) && (0 != uhos_tls_session_zone_write(cache->zone, buf, len)))
+    {
+        UHOS_LOGW("session zone %u write failed", (unsigned)cache->zone);
+    }
+    uhos_libc_free(buf);
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+uhos_s32 uhos_tls_session_cache_init(uhos_u8 zone)
+{
+    uhos_tls_session_cache_t *cache = &g_uhos_tls_session_cache;
+    uhos_u8                  *buf   = UHOS_NULL;
+
+    if (cache->inited)
+    {
+        return 0;
+    }
+
+    if (UHOS_SUCCESS != uhos_mutex_create(&cache->mutex))
+    {
+        UHOS_LOGE("mutex create failed");
+        return -1;
+    }
+    cache->zone = zone;
+
+    if (0 != zone)
+    {
+        buf = uhos_libc_zalloc(CONFIG_UHOS_TLS_SESSION_ZONE_SIZE);
+        if (UHOS_NULL == buf)
+        {
+            UHOS_LOG_MEM_ALLOC_FAIL();
+        }
+        else if (0 == uhos_tls_session_zone_read(zone, buf, CONFIG_UHOS_TLS_SESSION_ZONE_SIZE))
+        {
+            uhos_tls_session_unpack(buf);
+        }
+        uhos_libc_free(buf);
+    }
+    cache->inited = UHOS_TRUE;
+
+    return 0;
+}
+
+uhos_s32 uhos_tls_session_cache_resume(uhos_void *handle, const uhos_char *host, uhos_u16 port)
+{
+    uhos_tls_session_cache_t *cache = &g_uhos_tls_session_cache;
+    uhos_tls_session_item_t  *item  = UHOS_NULL;
+    uhos_s32                  ret   = -1;
+
+    if (!cache->inited || (UHOS_NULL == handle) || (UHOS_NULL == host))
+    {
+        return -1;
+    }
+
+    uhos_tls_session_lock();
+    item = uhos_tls_session_find(host, port);
+    if (UHOS_NULL != item)
+    {
+        item->used = ++cache->seq;
+        ret        = uhos_tls_session_restore(handle, item->data, item->len);
+    }
+    uhos_tls_session_unlock();
+
+    return ret;
+}
+
+uhos_s32 uhos_tls_session_cache_update(uhos_void *handle, const uhos_char *host, uhos_u16 port)
+{
+    uhos_tls_session_cache_t *cache   = &g_uhos_tls_session_cache;
+    uhos_tls_session_item_t  *item    = UHOS_NULL;
+    uhos_u8                  *data    = UHOS_NULL;
+    uhos_bool                 force   = UHOS_FALSE;
+    uhos_s32                  len     = 0;
+
+    if (!cache->inited || (UHOS_NULL == handle) || (UHOS_NULL == host) ||
+        (uhos_libc_strlen(host) >= UHOS_TLS_SESSION_HOST_LEN))
+    {
+        return -1;
+    }
+
+    len = uhos_tls_session_save(handle, UHOS_NULL, 0);
+    if ((len <= 0) || (len > CONFIG_UHOS_TLS_SESSION_LEN))
+    {
+        return -1;
+    }
+    data = uhos_libc_malloc((uhos_size_t)len);
+    if (UHOS_NULL == data)
+    {
+        UHOS_LOG_MEM_ALLOC_FAIL();
+        return -1;
+    }
+    len = uhos_tls_session_save(handle, data, (uhos_size_t)len);
+    if (len <= 0)
+    {
+        uhos_libc_free(data);
+        return -1;
+    }
+
+    uhos_tls_session_lock();
+    item = uhos_tls_session_find(host, port);
+    if ((UHOS_NULL != item) && (item->len == (uhos_u16)len) && (0 == uhos_libc_memcmp(item->data, data, (uhos_size_t)len)))
+    {
+        // 会话未变化，只补写之前推迟的变化
+        item->used = ++cache->seq;
+        uhos_tls_session_unlock();
+        uhos_libc_free(data);
+        uhos_tls_session_persist(UHOS_FALSE);
+        return 0;
+    }
+    // 新增服务器或完整握手得到了新会话时须写回；恢复会话的握手换发的票据只更新内存
+    if ((UHOS_NULL == item) || !uhos_tls_session_reused(handle))
+    {
+        cache->dirty = UHOS_TRUE;
+    }
+    if (UHOS_NULL == item)
+    {
+        // 占用空闲项时立即写回，缓存满后替换服务器与会话更新一样受写入间隔限制
+        item  = uhos_tls_session_victim();
+        force = (0 == item->len);
+    }
+    uhos_tls_session_item_clear(item);
+    uhos_libc_strncpy(item->host, host, UHOS_TLS_SESSION_HOST_LEN - 1);
+    item->port = port;
+    item->len  = (uhos_u16)len;
+    item->data = data;
+    item->used = ++cache->seq;
+    uhos_tls_session_unlock();
+
+    uhos_tls_session_persist(force);
+
+    return 0;
+}
+
+uhos_void uhos_tls_session_cache_remove(const uhos_char *host, uhos_u16 port)
+{
+    uhos_tls_session_cache_t *cache   = &g_uhos_tls_session_cache;
+    uhos_tls_session_item_t  *item    = UHOS_NULL;
+    uhos_bool                 removed = UHOS_FALSE;
+    uhos_u8                   i       = 0;
+
+    if (!cache->inited)
+    {
+        return;
+    }
+
+    uhos_tls_session_lock();
+    for (i = 0; i < CONFIG_UHOS_TLS_SESSION_CACHE_NUM; i++)
+    {
+        item = &cache->items[i];
+        if ((item->len > 0) && ((UHOS_NULL == host) || ((item->port == port) && (0 == uhos_libc_strcmp(item->host, host)))))
+        {
+            uhos_tls_session_item_clear(item);
+            removed      = UHOS_TRUE;
+            cache->dirty = UHOS_TRUE;
+        }
+    }
+    uhos_tls_session_unlock();
+
+    // 避免重启后再次加载服务器已拒绝的会话
+    if (removed)
+    {
+        uhos_tls_session_persist(UHOS_TRUE);
+    }
+}
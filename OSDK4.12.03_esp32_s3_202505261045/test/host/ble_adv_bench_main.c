@@ -0,0 +1,34 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file ble_adv_bench_main.c
+ * @author agent (agent@local)
+ * @brief 主机测试程序：回放内置抓包数据，运行广播透传过滤的基准测试
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：主机测试程序：回放内置抓包数据，运行广播透传过滤的基准测试
+ * </table>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "uh_types.h"
+#include "uh_bench.h"
+#include "uh_ble.h"
+#include "uh_ble_adv_bench.h"
+
+static void ble_adv_bench_print(const uhos_char *line)
+{
+    printf("%s\n", line);
+    fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+    uhos_u32 rounds = (argc > 1) ? (uhos_u32)atoi(argv[1]) : 0;
+
+    return (UHOS_BLE_SUCCESS == uhos_ble_adv_bench_matrix_run(rounds, ble_adv_bench_print)) ? 0 : 1;
+}
@@ -0,0 +1,84 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file ble_bench_main.c
+ * @author agent (agent@local)
+ * @brief 主机测试程序：在BLE模拟器上运行GATT吞吐与延迟基准测试矩阵
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：主机测试程序：在BLE模拟器上运行GATT吞吐与延迟基准测试矩阵
+ * </table>
+ */
+
+#include <stdio.h>
+
+#include "uh_types.h"
+#include "uh_osal.h"
+#include "uh_bench.h"
+#include "uh_ble.h"
+#include "uh_ble_bench.h"
+#include "uh_ble_sim.h"
+
+#define BLE_BENCH_NOTIFY_HANDLE     0x2A        //<! 本端notify特征值句柄（唯一服务的第一个特征）
+#define BLE_BENCH_WRITE_HANDLE      0x12        //<! 虚拟对端的可写特征值句柄
+
+static void ble_bench_print(const uhos_char *line)
+{
+    printf("%s\n", line);
+    fflush(stdout);
+}
+
+int main(void)
+{
+    static uhos_u8                  value[20];
+    static const uhos_u16           mtus[]      = {23, 247};
+    static const uhos_u16           intervals[] = {12};
+    static const uhos_u16           payloads[]  = {20, 244};
+    static const uhos_u8            conns[]     = {1, 2};
+    uhos_ble_gatts_char_db_t        chars[1]    = {0};
+    uhos_ble_gatts_srv_db_t         srv         = {0};
+    uhos_ble_gatts_db_t             db          = {&srv, 1};
+    uhos_ble_bench_matrix_t         matrix      = {0};
+    uhos_ble_status_t               ret         = UHOS_BLE_ERROR;
+
+    chars[0].char_uuid.type   = UHOS_BLE_UUID_TYPE_16;
+    chars[0].char_uuid.uuid16 = 0xFFF1;
+    chars[0].char_property    = 0x10;
+    chars[0].p_value          = value;
+    chars[0].char_value_len   = sizeof(value);
+    srv.srv_type              = UHOS_BLE_PRIMARY_SERVICE;
+    srv.srv_uuid.type         = UHOS_BLE_UUID_TYPE_16;
+    srv.srv_uuid.uuid16       = 0xFFF0;
+    srv.char_num              = 1;
+    srv.p_char_db             = chars;
+    uhos_ble_gatts_service_set(&db);
+
+    if (UHOS_BLE_SUCCESS != uhos_ble_enable())
+    {
+        return 1;
+    }
+    uhos_thread_sleep(100);
+
+    matrix.op_mask       = (1 << UHOS_BLE_BENCH_NOTIFY) | (1 << UHOS_BLE_BENCH_WRITE_CMD) | (1 << UHOS_BLE_BENCH_WRITE_REQ);
+    matrix.mtus          = mtus;
+    matrix.mtu_num       = sizeof(mtus) / sizeof(mtus[0]);
+    matrix.intervals     = intervals;
+    matrix.interval_num  = sizeof(intervals) / sizeof(intervals[0]);
+    matrix.payloads      = payloads;
+    matrix.payload_num   = sizeof(payloads) / sizeof(payloads[0]);
+    matrix.conns         = conns;
+    matrix.conn_num      = sizeof(conns) / sizeof(conns[0]);
+    matrix.notify_handle = BLE_BENCH_NOTIFY_HANDLE;
+    matrix.write_handle  = BLE_BENCH_WRITE_HANDLE;
+    matrix.ops_per_conn  = 50;
+    matrix.timeout_ms    = 10000;
+
+    uhos_ble_bench_env_set(uhos_ble_sim_bench_env_get());
+    ret = uhos_ble_bench_matrix_run(&matrix, ble_bench_print);
+
+    uhos_ble_disable();
+
+    return (UHOS_BLE_SUCCESS == ret) ? 0 : 1;
+}
@@ -0,0 +1,44 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file ble_sim_cache_main.c
+ * @author agent (agent@local)
+ * @brief 主机测试程序：在BLE模拟器上运行GATT client属性缓存测试
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：主机测试程序：在BLE模拟器上运行GATT client属性缓存测试
+ * </table>
+ */
+
+#include <stdio.h>
+
+#include "uh_types.h"
+#include "uh_osal.h"
+#include "uh_fs.h"
+#include "uh_ble.h"
+#include "uh_ble_sim.h"
+
+static void ble_sim_cache_print(const uhos_char *line)
+{
+    printf("%s\n", line);
+    fflush(stdout);
+}
+
+int main(void)
+{
+    uhos_ble_status_t ret = UHOS_BLE_ERROR;
+
+    if ((0 != uhos_fs_init()) || (UHOS_BLE_SUCCESS != uhos_ble_enable()))
+    {
+        return 1;
+    }
+    uhos_thread_sleep(100);
+
+    ret = uhos_ble_sim_cache_test_run(ble_sim_cache_print);
+
+    uhos_ble_disable();
+
+    return (UHOS_BLE_SUCCESS == ret) ? 0 : 1;
+}
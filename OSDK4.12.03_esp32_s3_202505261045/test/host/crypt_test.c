@@ -0,0 +1,456 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file crypt_test.c
+ * @author agent (agent@local)
+ * @brief 主机测试程序：aes加解密的已知答案测试与各模式吞吐率基准测试
+ * @details CBC、CTR向量取自NIST SP 800-38A附录F，GCM向量取自GCM规范的测试用例1、2、4、16。
+ *          每个向量先一次加密，再把明文复制到同一buffer按1、14、17、31字节的非对齐长度分段原地加密，
+ *          最后解密；CBC分段长度须为16的倍数，只分为首块与其余部分
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：aes加解密的已知答案测试
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>由库源文件移为主机测试程序，附带运行吞吐率基准测试
+ * </table>
+ */
+
+#define LOG_TAG "crypt-test"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include <stdio.h>
+
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_crypt.h"
+
+#include "uh_bench.h"
+#include "uh_crypt_bench.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+// 向量的最大明文长度
+#define UHOS_CRYPT_TEST_LEN_MAX             64
+
+#define UHOS_CRYPT_TEST_BLOCK_LEN           16
+#define UHOS_CRYPT_TEST_TAG_LEN             16
+
+// JSON行的最大长度
+#define UHOS_CRYPT_TEST_JSON_LEN            128
+
+#define UHOS_CRYPT_TEST_ARRAY_NUM(a)        (sizeof(a) / sizeof((a)[0]))
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @struct      一个已知答案向量
+ */
+typedef struct
+{
+    const uhos_char        *name;
+    uhos_crypt_bench_mode_t mode;
+    const uhos_u8          *key;
+    uhos_u32                keybits;
+    const uhos_u8          *iv;                                 //<! CBC的iv、CTR的初始计数器或GCM的iv
+    uhos_u32                iv_len;
+    const uhos_u8          *add;                                //<! GCM附加数据，可为NULL
+    uhos_u32                add_len;
+    const uhos_u8          *pt;
+    const uhos_u8          *ct;
+    uhos_u32                len;
+    const uhos_u8          *tag;                                //<! GCM认证标签
+} uhos_crypt_test_vector_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+// SP 800-38A F.2.1/F.5.1/F.5.5
+static const uhos_u8 g_uhos_crypt_test_key128[16] = {
+    0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c};
+static const uhos_u8 g_uhos_crypt_test_key256[32] = {
+    0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe, 0x2b, 0x73, 0xae, 0xf0, 0x85, 0x7d, 0x77, 0x81,
+    0x1f, 0x35, 0x2c, 0x07, 0x3b, 0x61, 0x08, 0xd7, 0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4};
+static const uhos_u8 g_uhos_crypt_test_cbc_iv[16] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f};
+static const uhos_u8 g_uhos_crypt_test_ctr_iv[16] = {
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff};
+static const uhos_u8 g_uhos_crypt_test_pt[64] = {
+    0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+    0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+    0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+    0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17, 0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10};
+static const uhos_u8 g_uhos_crypt_test_cbc128_ct[64] = {
+    0x76, 0x49, 0xab, 0xac, 0x81, 0x19, 0xb2, 0x46, 0xce, 0xe9, 0x8e, 0x9b, 0x12, 0xe9, 0x19, 0x7d,
+    0x50, 0x86, 0xcb, 0x9b, 0x50, 0x72, 0x19, 0xee, 0x95, 0xdb, 0x11, 0x3a, 0x91, 0x76, 0x78, 0xb2,
+    0x73, 0xbe, 0xd6, 0xb8, 0xe3, 0xc1, 0x74, 0x3b, 0x71, 0x16, 0xe6, 0x9e, 0x22, 0x22, 0x95, 0x16,
+    0x3f, 0xf1, 0xca, 0xa1, 0x68, 0x1f, 0xac, 0x09, 0x12, 0x0e, 0xca, 0x30, 0x75, 0x86, 0xe1, 0xa7};
+static const uhos_u8 g_uhos_crypt_test_ctr128_ct[64] = {
+    0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26, 0x1b, 0xef, 0x68, 0x64, 0x99, 0x0d, 0xb6, 0xce,
+    0x98, 0x06, 0xf6, 0x6b, 0x79, 0x70, 0xfd, 0xff, 0x86, 0x17, 0x18, 0x7b, 0xb9, 0xff, 0xfd, 0xff,
+    0x5a, 0xe4, 0xdf, 0x3e, 0xdb, 0xd5, 0xd3, 0x5e, 0x5b, 0x4f, 0x09, 0x02, 0x0d, 0xb0, 0x3e, 0xab,
+    0x1e, 0x03, 0x1d, 0xda, 0x2f, 0xbe, 0x03, 0xd1, 0x79, 0x21, 0x70, 0xa0, 0xf3, 0x00, 0x9c, 0xee};
+static const uhos_u8 g_uhos_crypt_test_ctr256_ct[64] = {
+    0x60, 0x1e, 0xc3, 0x13, 0x77, 0x57, 0x89, 0xa5, 0xb7, 0xa7, 0xf5, 0x04, 0xbb, 0xf3, 0xd2, 0x28,
+    0xf4, 0x43, 0xe3, 0xca, 0x4d, 0x62, 0xb5, 0x9a, 0xca, 0x84, 0xe9, 0x90, 0xca, 0xca, 0xf5, 0xc5,
+    0x2b, 0x09, 0x30, 0xda, 0xa2, 0x3d, 0xe9, 0x4c, 0xe8, 0x70, 0x17, 0xba, 0x2d, 0x84, 0x98, 0x8d,
+    0xdf, 0xc9, 0xc5, 0x8d, 0xb6, 0x7a, 0xad, 0xa6, 0x13, 0xc2, 0xdd, 0x08, 0x45, 0x79, 0x41, 0xa6};
+
+// GCM测试用例1、2：全零秘钥、iv与明文
+static const uhos_u8 g_uhos_crypt_test_zero[16] = {0};
+static const uhos_u8 g_uhos_crypt_test_gcm1_tag[16] = {
+    0x58, 0xe2, 0xfc, 0xce, 0xfa, 0x7e, 0x30, 0x61, 0x36, 0x7f, 0x1d, 0x57, 0xa4, 0xe7, 0x45, 0x5a};
+static const uhos_u8 g_uhos_crypt_test_gcm2_ct[16] = {
+    0x03, 0x88, 0xda, 0xce, 0x60, 0xb6, 0xa3, 0x92, 0xf3, 0x28, 0xc2, 0xb9, 0x71, 0xb2, 0xfe, 0x78};
+static const uhos_u8 g_uhos_crypt_test_gcm2_tag[16] = {
+    0xab, 0x6e, 0x47, 0xd4, 0x2c, 0xec, 0x13, 0xbd, 0xf5, 0x3a, 0x67, 0xb2, 0x12, 0x57, 0xbd, 0xdf};
+
+// GCM测试用例4、16：60字节明文与20字节附加数据
+static const uhos_u8 g_uhos_crypt_test_gcm_key[32] = {
+    0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c, 0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+    0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c, 0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08};
+static const uhos_u8 g_uhos_crypt_test_gcm_iv[12] = {
+    0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88};
+static const uhos_u8 g_uhos_crypt_test_gcm_add[20] = {
+    0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef, 0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+    0xab, 0xad, 0xda, 0xd2};
+static const uhos_u8 g_uhos_crypt_test_gcm_pt[60] = {
+    0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5, 0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+    0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda, 0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+    0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53, 0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+    0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57, 0xba, 0x63, 0x7b, 0x39};
+static const uhos_u8 g_uhos_crypt_test_gcm4_ct[60] = {
+    0x42, 0x83, 0x1e, 0xc2, 0x21, 0x77, 0x74, 0x24, 0x4b, 0x72, 0x21, 0xb7, 0x84, 0xd0, 0xd4, 0x9c,
+    0xe3, 0xaa, 0x21, 0x2f, 0x2c, 0x02, 0xa4, 0xe0, 0x35, 0xc1, 0x7e, 0x23, 0x29, 0xac, 0xa1, 0x2e,
+    0x21, 0xd5, 0x14, 0xb2, 0x54, 0x66, 0x93, 0x1c, 0x7d, 0x8f, 0x6a, 0x5a, 0xac, 0x84, 0xaa, 0x05,
+    0x1b, 0xa3, 0x0b, 0x39, 0x6a, 0x0a, 0xac, 0x97, 0x3d, 0x58, 0xe0, 0x91};
+static const uhos_u8 g_uhos_crypt_test_gcm4_tag[16] = {
+    0x5b, 0xc9, 0x4f, 0xbc, 0x32, 0x21, 0xa5, 0xdb, 0x94, 0xfa, 0xe9, 0x5a, 0xe7, 0x12, 0x1a, 0x47};
+static const uhos_u8 g_uhos_crypt_test_gcm16_ct[60] = {
+    0x52, 0x2d, 0xc1, 0xf0, 0x99, 0x56, 0x7d, 0x07, 0xf4, 0x7f, 0x37, 0xa3, 0x2a, 0x84, 0x42, 0x7d,
+    0x64, 0x3a, 0x8c, 0xdc, 0xbf, 0xe5, 0xc0, 0xc9, 0x75, 0x98, 0xa2, 0xbd, 0x25, 0x55, 0xd1, 0xaa,
+    0x8c, 0xb0, 0x8e, 0x48, 0x59, 0x0d, 0xbb, 0x3d, 0xa7, 0xb0, 0x8b, 0x10, 0x56, 0x82, 0x88, 0x38,
+    0xc5, 0xf6, 0x1e, 0x63, 0x93, 0xba, 0x7a, 0x0a, 0xbc, 0xc9, 0xf6, 0x62};
+static const uhos_u8 g_uhos_crypt_test_gcm16_tag[16] = {
+    0x76, 0xfc, 0x6e, 0xce, 0x0f, 0x4e, 0x17, 0x68, 0xcd, 0xdf, 0x88, 0x53, 0xbb, 0x2d, 0x55, 0x1b};
+
+static const uhos_crypt_test_vector_t g_uhos_crypt_test_vectors[] = {
+    {"cbc_aes128", UHOS_CRYPT_BENCH_CBC, g_uhos_crypt_test_key128, 128, g_uhos_crypt_test_cbc_iv, 16, UHOS_NULL, 0,
+     g_uhos_crypt_test_pt, g_uhos_crypt_test_cbc128_ct, 64, UHOS_NULL},
+    {"ctr_aes128", UHOS_CRYPT_BENCH_CTR, g_uhos_crypt_test_key128, 128, g_uhos_crypt_test_ctr_iv, 16, UHOS_NULL, 0,
+     g_uhos_crypt_test_pt, g_uhos_crypt_test_ctr128_ct, 64, UHOS_NULL},
+    {"ctr_aes256", UHOS_CRYPT_BENCH_CTR, g_uhos_crypt_test_key256, 256, g_uhos_crypt_test_ctr_iv, 16, UHOS_NULL, 0,
+     g_uhos_crypt_test_pt, g_uhos_crypt_test_ctr256_ct, 64, UHOS_NULL},
+    {"gcm_case1", UHOS_CRYPT_BENCH_GCM, g_uhos_crypt_test_zero, 128, g_uhos_crypt_test_zero, 12, UHOS_NULL, 0,
+     g_uhos_crypt_test_zero, UHOS_NULL, 0, g_uhos_crypt_test_gcm1_tag},
+    {"gcm_case2", UHOS_CRYPT_BENCH_GCM, g_uhos_crypt_test_zero, 128, g_uhos_crypt_test_zero, 12, UHOS_NULL, 0,
+     g_uhos_crypt_test_zero, g_uhos_crypt_test_gcm2_ct, 16, g_uhos_crypt_test_gcm2_tag},
+    {"gcm_case4", UHOS_CRYPT_BENCH_GCM, g_uhos_crypt_test_gcm_key, 128, g_uhos_crypt_test_gcm_iv, 12, g_uhos_crypt_test_gcm_add, 20,
+     g_uhos_crypt_test_gcm_pt, g_uhos_crypt_test_gcm4_ct, 60, g_uhos_crypt_test_gcm4_tag},
+    {"gcm_case16", UHOS_CRYPT_BENCH_GCM, g_uhos_crypt_test_gcm_key, 256, g_uhos_crypt_test_gcm_iv, 12, g_uhos_crypt_test_gcm_add, 20,
+     g_uhos_crypt_test_gcm_pt, g_uhos_crypt_test_gcm16_ct, 60, g_uhos_crypt_test_gcm16_tag},
+};
+
+// 分段原地加密时依次使用的段长，用完后剩余部分为最后一段
+static const uhos_u32 g_uhos_crypt_test_splits[] = {1, 14, 17, 31};
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       第n段的长度
+ */
+static uhos_u32 uhos_crypt_test_piece(uhos_u32 n, uhos_u32 left)
+{
+    if ((n >= UHOS_CRYPT_TEST_ARRAY_NUM(g_uhos_crypt_test_splits)) || (g_uhos_crypt_test_splits[n] > left))
+    {
+        return left;
+    }
+
+    return g_uhos_crypt_test_splits[n];
+}
+
+/**
+ * @brief       CBC向量
+ * @return      失败原因，通过返回NULL
+ */
+static const uhos_char *uhos_crypt_test_cbc(const uhos_crypt_test_vector_t *vec, uhos_u8 *buf)
+{
+    const uhos_char *reason = UHOS_NULL;
+    uhos_void       *ctx    = uhos_aes_init();
+    uhos_u8          iv[UHOS_CRYPT_TEST_BLOCK_LEN];
+
+    if ((UHOS_NULL == ctx) || (0 != uhos_aes_setkey_enc(ctx, vec->key, vec->keybits)))
+    {
+        reason = "setkey";
+        goto out;
+    }
+
+    uhos_libc_memcpy(iv, vec->iv, sizeof(iv));
+    if ((0 != uhos_aes_crypt_cbc(ctx, UHOS_AES_ENCRYPT, vec->len, iv, vec->pt, buf)) || (0 != uhos_libc_memcmp(buf, vec->ct, vec->len)))
+    {
+        reason = "encrypt";
+        goto out;
+    }
+
+    // iv在调用间更新，分两次的结果应与一次相同
+    uhos_libc_memcpy(iv, vec->iv, sizeof(iv));
+    uhos_libc_memcpy(buf, vec->pt, vec->len);
+    if ((0 != uhos_aes_crypt_cbc(ctx, UHOS_AES_ENCRYPT, UHOS_CRYPT_TEST_BLOCK_LEN, iv, buf, buf)) ||
+        (0 != uhos_aes_crypt_cbc(ctx, UHOS_AES_ENCRYPT, vec->len - UHOS_CRYPT_TEST_BLOCK_LEN, iv, buf + UHOS_CRYPT_TEST_BLOCK_LEN,
+                                 buf + UHOS_CRYPT_TEST_BLOCK_LEN)) ||
+        (0 != uhos_libc_memcmp(buf, vec->ct, vec->len)))
+    {
+        reason = "split";
+        goto out;
+    }
+
+    uhos_libc_memcpy(iv, vec->iv, sizeof(iv));
+    if ((0 != uhos_aes_setkey_dec(ctx, vec->key, vec->keybits)) ||
+        (0 != uhos_aes_crypt_cbc(ctx, UHOS_AES_DECRYPT, vec->len, iv, vec->ct, buf)) || (0 != uhos_libc_memcmp(buf, vec->pt, vec->len)))
+    {
+        reason = "decrypt";
+    }
+
+out:
+    if (UHOS_NULL != ctx)
+    {
+        uhos_aes_free(ctx);
+    }
+
+    return reason;
+}
+
+/**
+ * @brief       CTR加解密，按g_uhos_crypt_test_splits分段或一次处理
+ */
+static uhos_s32 uhos_crypt_test_ctr_crypt(uhos_void *ctx, const uhos_crypt_test_vector_t *vec, uhos_bool split, const uhos_u8 *input,
+                                          uhos_u8 *output)
+{
+    uhos_u8     counter[UHOS_CRYPT_TEST_BLOCK_LEN];
+    uhos_u8     stream[UHOS_CRYPT_TEST_BLOCK_LEN];
+    uhos_size_t off   = 0;
+    uhos_u32    done  = 0;
+    uhos_u32    piece = vec->len;
+    uhos_u32    n     = 0;
+
+    uhos_libc_memcpy(counter, vec->iv, sizeof(counter));
+    for (done = 0; done < vec->len; done += piece, n++)
+    {
+        if (split)
+        {
+            piece = uhos_crypt_test_piece(n, vec->len - done);
+        }
+        if (0 != uhos_aes_crypt_ctr(ctx, piece, &off, counter, stream, input + done, output + done))
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       CTR向量
+ * @return      失败原因，通过返回NULL
+ */
+static const uhos_char *uhos_crypt_test_ctr(const uhos_crypt_test_vector_t *vec, uhos_u8 *buf)
+{
+    const uhos_char *reason = UHOS_NULL;
+    uhos_void       *ctx    = uhos_aes_init();
+
+    if ((UHOS_NULL == ctx) || (0 != uhos_aes_setkey_enc(ctx, vec->key, vec->keybits)))
+    {
+        reason = "setkey";
+        goto out;
+    }
+
+    if ((0 != uhos_crypt_test_ctr_crypt(ctx, vec, UHOS_FALSE, vec->pt, buf)) || (0 != uhos_libc_memcmp(buf, vec->ct, vec->len)))
+    {
+        reason = "encrypt";
+        goto out;
+    }
+
+    uhos_libc_memcpy(buf, vec->pt, vec->len);
+    if ((0 != uhos_crypt_test_ctr_crypt(ctx, vec, UHOS_TRUE, buf, buf)) || (0 != uhos_libc_memcmp(buf, vec->ct, vec->len)))
+    {
+        reason = "split";
+        goto out;
+    }
+
+    // 解密与加密相同
+    if ((0 != uhos_crypt_test_ctr_crypt(ctx, vec, UHOS_FALSE, vec->ct, buf)) || (0 != uhos_libc_memcmp(buf, vec->pt, vec->len)))
+    {
+        reason = "decrypt";
+    }
+
+out:
+    if (UHOS_NULL != ctx)
+    {
+        uhos_aes_free(ctx);
+    }
+
+    return reason;
+}
+
+/**
+ * @brief       GCM处理一条消息
+ * @param[in]   tag     加密时输出，解密时输入
+ */
+static uhos_s32 uhos_crypt_test_gcm_crypt(uhos_void *ctx, const uhos_crypt_test_vector_t *vec, UHOS_AES_CRYPT_E mode, uhos_bool split,
+                                          const uhos_u8 *input, uhos_u8 *output, uhos_u8 *tag)
+{
+    uhos_u32 done  = 0;
+    uhos_u32 piece = vec->len;
+    uhos_u32 n     = 0;
+
+    if (0 != uhos_aes_gcm_starts(ctx, mode, vec->iv, vec->iv_len, vec->add, vec->add_len))
+    {
+        return -1;
+    }
+    for (done = 0; done < vec->len; done += piece, n++)
+    {
+        if (split)
+        {
+            piece = uhos_crypt_test_piece(n, vec->len - done);
+        }
+        if (0 != uhos_aes_gcm_update(ctx, piece, input + done, output + done))
+        {
+            return -1;
+        }
+    }
+
+    return uhos_aes_gcm_finish(ctx, tag, UHOS_CRYPT_TEST_TAG_LEN);
+}
+
+/**
+ * @brief       GCM向量
+ * @return      失败原因，通过返回NULL
+ */
+static const uhos_char *uhos_crypt_test_gcm(const uhos_crypt_test_vector_t *vec, uhos_u8 *buf)
+{
+    const uhos_char *reason = UHOS_NULL;
+    uhos_void       *ctx    = uhos_aes_gcm_init();
+    uhos_u8          tag[UHOS_CRYPT_TEST_TAG_LEN];
+
+    if ((UHOS_NULL == ctx) || (0 != uhos_aes_gcm_setkey(ctx, vec->key, vec->keybits)))
+    {
+        reason = "setkey";
+        goto out;
+    }
+
+    if ((0 != uhos_crypt_test_gcm_crypt(ctx, vec, UHOS_AES_ENCRYPT, UHOS_FALSE, vec->pt, buf, tag)) ||
+        ((vec->len > 0) && (0 != uhos_libc_memcmp(buf, vec->ct, vec->len))) || (0 != uhos_libc_memcmp(tag, vec->tag, sizeof(tag))))
+    {
+        reason = "encrypt";
+        goto out;
+    }
+
+    // 同一句柄处理下一条消息，分段原地加密
+    uhos_libc_memcpy(buf, vec->pt, vec->len);
+    if ((0 != uhos_crypt_test_gcm_crypt(ctx, vec, UHOS_AES_ENCRYPT, UHOS_TRUE, buf, buf, tag)) ||
+        ((vec->len > 0) && (0 != uhos_libc_memcmp(buf, vec->ct, vec->len))) || (0 != uhos_libc_memcmp(tag, vec->tag, sizeof(tag))))
+    {
+        reason = "split";
+        goto out;
+    }
+
+    uhos_libc_memcpy(tag, vec->tag, sizeof(tag));
+    if ((0 != uhos_crypt_test_gcm_crypt(ctx, vec, UHOS_AES_DECRYPT, UHOS_TRUE, vec->ct, buf, tag)) ||
+        ((vec->len > 0) && (0 != uhos_libc_memcmp(buf, vec->pt, vec->len))))
+    {
+        reason = "decrypt";
+        goto out;
+    }
+
+    tag[UHOS_CRYPT_TEST_TAG_LEN - 1] ^= 0x01;
+    if (0 == uhos_crypt_test_gcm_crypt(ctx, vec, UHOS_AES_DECRYPT, UHOS_FALSE, vec->ct, buf, tag))
+    {
+        reason = "tamper";
+    }
+
+out:
+    if (UHOS_NULL != ctx)
+    {
+        uhos_aes_gcm_free(ctx);
+    }
+
+    return reason;
+}
+
+/**
+ * @brief       执行CBC、CTR与GCM的已知答案测试，每个向量输出一行JSON
+ * @return      0-全部通过，-1-有向量失败
+ */
+static uhos_s32 uhos_crypt_test_run(uhos_bench_print_t print)
+{
+    const uhos_crypt_test_vector_t *vec    = UHOS_NULL;
+    const uhos_char                *reason = UHOS_NULL;
+    uhos_u8                         buf[UHOS_CRYPT_TEST_LEN_MAX];
+    uhos_char                       line[UHOS_CRYPT_TEST_JSON_LEN];
+    uhos_bench_json_t               json;
+    uhos_s32                        ret    = 0;
+    uhos_u32                        i      = 0;
+
+    if (UHOS_NULL == print)
+    {
+        return -1;
+    }
+
+    for (i = 0; i < UHOS_CRYPT_TEST_ARRAY_NUM(g_uhos_crypt_test_vectors); i++)
+    {
+        vec = &g_uhos_crypt_test_vectors[i];
+        if (UHOS_CRYPT_BENCH_CBC == vec->mode)
+        {
+            reason = uhos_crypt_test_cbc(vec, buf);
+        }
+        else if (UHOS_CRYPT_BENCH_CTR == vec->mode)
+        {
+            reason = uhos_crypt_test_ctr(vec, buf);
+        }
+        else
+        {
+            reason = uhos_crypt_test_gcm(vec, buf);
+        }
+
+        if (UHOS_NULL != reason)
+        {
+            UHOS_LOGE("%s failed at %s", vec->name, reason);
+            ret = -1;
+        }
+        uhos_bench_json_begin(&json, line, sizeof(line));
+        uhos_bench_json_str(&json, "case", vec->name);
+        uhos_bench_json_status(&json, (UHOS_NULL == reason) ? 0 : -1);
+        uhos_bench_json_str(&json, "reason", reason);
+        uhos_bench_json_end(&json);
+        print(line);
+    }
+
+    return ret;
+}
+
+static void uhos_crypt_test_print(const uhos_char *line)
+{
+    printf("%s\n", line);
+    fflush(stdout);
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+int main(void)
+{
+    uhos_s32 ret = uhos_crypt_test_run(uhos_crypt_test_print);
+
+    if (0 != uhos_crypt_bench_matrix_run(uhos_crypt_test_print))
+    {
+        ret = -1;
+    }
+
+    return (0 == ret) ? 0 : 1;
+}
@@ -0,0 +1,101 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file host_log.c
+ * @author agent (agent@local)
+ * @brief 主机测试程序的日志与shell输出实现
+ * @details 设备上由闭源库提供uhos_log与uhos_shell_printf，主机测试程序链接本文件输出到stderr/stdout；
+ *          日志级别由环境变量UHOS_LOG_LVL控制，默认只输出告警及以上
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：主机测试程序的日志与shell输出实现
+ * </table>
+ */
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "uh_types.h"
+#include "uh_log.h"
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+static int host_log_level(void)
+{
+    static int  level = -1;
+    const char *env   = UHOS_NULL;
+
+    if (level < 0)
+    {
+        env   = getenv("UHOS_LOG_LVL");
+        level = env ? atoi(env) : LOG_LVL_WARN;
+    }
+
+    return level;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+void uhos_log(uhos_u8 level, const uhos_char *tag, const uhos_char *file, const uhos_char *func, const uhos_u32 line,
+              const uhos_char *format, ...)
+{
+    va_list ap;
+
+    (void)file;
+    (void)func;
+
+    if (level > host_log_level())
+    {
+        return;
+    }
+
+    va_start(ap, format);
+    fprintf(stderr, "[%u][%s:%u] ", (unsigned)level, tag, (unsigned)line);
+    vfprintf(stderr, format, ap);
+    fputc('\n', stderr);
+    va_end(ap);
+}
+
+void uhos_log_hexdump(const uhos_char *name, uhos_u8 width, const uhos_void *buf, uhos_u16 size)
+{
+    const uhos_u8 *p = (const uhos_u8 *)buf;
+    uhos_u16       i = 0;
+
+    if (LOG_LVL_DEBUG > host_log_level())
+    {
+        return;
+    }
+
+    fprintf(stderr, "%s(%u):", name, (unsigned)size);
+    for (i = 0; i < size; i++)
+    {
+        fprintf(stderr, "%s%02x", (width && (0 == i % width)) ? "\n  " : " ", p[i]);
+    }
+    fputc('\n', stderr);
+}
+
+void uhos_log_raw(const uhos_char *format, ...)
+{
+    va_list ap;
+
+    va_start(ap, format);
+    vfprintf(stderr, format, ap);
+    va_end(ap);
+}
+
+void uhos_shell_printf(char *fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, fmt);
+    vprintf(fmt, ap);
+    va_end(ap);
+}
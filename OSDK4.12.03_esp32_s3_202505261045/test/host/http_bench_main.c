@@ -0,0 +1,90 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file http_bench_main.c
+ * @author agent (agent@local)
+ * @brief 主机测试程序：对本机HTTP与HTTPS服务器运行连接池请求时延基准测试
+ * @details 服务器由run.sh以http_server.py启动；TLS经linux_openssl的uh_tls实现
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：主机测试程序：对本机HTTP与HTTPS服务器运行连接池请求时延基准测试
+ * </table>
+ */
+
+#define LOG_TAG "http-bench"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "uh_types.h"
+#include "uh_log.h"
+#include "uh_al_net.h"
+
+#include "uh_bench.h"
+#include "uh_http_bench.h"
+
+// CA证书文件的最大长度
+#define HTTP_BENCH_CA_MAX 8192
+
+static uhos_u8 g_http_bench_ca[HTTP_BENCH_CA_MAX];
+
+static void http_bench_print(const uhos_char *line)
+{
+    printf("%s\n", line);
+    fflush(stdout);
+}
+
+/**
+ * @brief       读入PEM格式的CA证书，长度含结尾的'\0'
+ * @return      证书长度，0表示失败
+ */
+static uhos_size_t http_bench_ca_load(const char *path)
+{
+    FILE       *fp  = fopen(path, "rb");
+    uhos_size_t len = 0;
+
+    if (UHOS_NULL == fp)
+    {
+        return 0;
+    }
+    len = fread(g_http_bench_ca, 1, sizeof(g_http_bench_ca) - 1, fp);
+    fclose(fp);
+    g_http_bench_ca[len] = '\0';
+
+    return (len > 0) ? (len + 1) : 0;
+}
+
+int main(int argc, char *argv[])
+{
+    uhos_http_bench_target_t target = {0};
+    uhos_s32                 ret    = 0;
+
+    if (4 != argc)
+    {
+        fprintf(stderr, "usage: %s <http_port> <https_port> <ca_cert.pem>\n", argv[0]);
+        return 2;
+    }
+
+    target.ca_cert_len = http_bench_ca_load(argv[3]);
+    if (0 == target.ca_cert_len)
+    {
+        UHOS_LOGE("load %s failed", argv[3]);
+        return 1;
+    }
+    target.ca_cert = g_http_bench_ca;
+    // IP地址字面量，uhos_net_resolve直接返回，无需初始化解析器
+    target.host    = "127.0.0.1";
+    target.path    = "/bench";
+
+    target.port  = (uhos_u16)atoi(argv[1]);
+    target.https = 0;
+    ret |= uhos_http_bench_matrix_run(&target, http_bench_print);
+
+    target.port  = (uhos_u16)atoi(argv[2]);
+    target.https = 1;
+    ret |= uhos_http_bench_matrix_run(&target, http_bench_print);
+
+    return (0 == ret) ? 0 : 1;
+}
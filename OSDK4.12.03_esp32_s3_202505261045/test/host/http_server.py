@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+#
+# 主机测试用的HTTP/HTTPS服务器，供http_bench与tls_async_bench用例使用
+#
+# 用法: http_server.py <端口文件> [<证书> <私钥> [tls1.2]]
+#   在127.0.0.1的随机端口上监听，端口号写入端口文件后开始服务；给出证书与私钥时为HTTPS，
+#   再给出tls1.2时最高只协商TLS1.2
+#   每个GET返回带Content-Length的短响应并保持连接，Keep-Alive超时5秒
+#
+
+import ssl
+import sys
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    disable_nagle_algorithm = True
+    timeout = 10
+
+    def log_message(self, *args):
+        pass
+
+    def do_GET(self):
+        body = ("ok " + self.path).encode()
+        self.send_response(200)
+        self.send_header("Content-Length", str(len(body)))
+        self.send_header("Keep-Alive", "timeout=5, max=1000")
+        self.end_headers()
+        self.wfile.write(body)
+
+
+def main():
+    if len(sys.argv) not in (2, 4, 5) or (len(sys.argv) == 5 and sys.argv[4] != "tls1.2"):
+        sys.exit("usage: http_server.py <port_file> [<cert> <key> [tls1.2]]")
+
+    ThreadingHTTPServer.request_queue_size = 128
+    server = ThreadingHTTPServer(("127.0.0.1", 0), Handler)
+    if len(sys.argv) >= 4:
+        ctx = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+        ctx.load_cert_chain(sys.argv[2], sys.argv[3])
+        if len(sys.argv) == 5:
+            ctx.maximum_version = ssl.TLSVersion.TLSv1_2
+        server.socket = ctx.wrap_socket(server.socket, server_side=True)
+
+    with open(sys.argv[1], "w") as f:
+        f.write("%d\n" % server.server_address[1])
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
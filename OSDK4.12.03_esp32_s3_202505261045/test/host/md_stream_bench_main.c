@@ -0,0 +1,193 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file md_stream_bench_main.c
+ * @author agent (agent@local)
+ * @brief 主机测试程序：以文件模拟OTA分区运行流式摘要耗时对比基准测试，并检查255个区间与空输入
+ * @details 摘要经linux_openssl的uh_verify实现；依次运行1MB的矩阵与4MB镜像的四种摘要方式
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：主机测试程序：以文件模拟OTA分区运行流式摘要耗时对比基准测试
+ * </table>
+ */
+
+#define LOG_TAG "md-stream-bench"
+
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_verify.h"
+
+#include "uh_bench.h"
+#include "uh_md_stream_bench.h"
+
+// 大镜像用例的长度
+#define MD_STREAM_BENCH_LARGE_LEN       (4 * 1024 * 1024)
+
+// 多区间检查的数据长度与区间数
+#define MD_STREAM_BENCH_RANGE_DATA      1000
+#define MD_STREAM_BENCH_RANGE_NUM       255
+
+#define MD_STREAM_BENCH_DIGEST_MAX      32
+
+// JSON行的最大长度
+#define MD_STREAM_BENCH_JSON_LEN        256
+
+static uhos_s32        g_md_stream_bench_fd = -1;
+static uhos_md_range_t g_md_stream_bench_ranges[MD_STREAM_BENCH_RANGE_NUM];
+static uhos_u8         g_md_stream_bench_data[MD_STREAM_BENCH_RANGE_DATA];
+
+static void md_stream_bench_print(const uhos_char *line)
+{
+    printf("%s\n", line);
+    fflush(stdout);
+}
+
+static uhos_s32 md_stream_bench_write(uhos_u32 offset, const uhos_u8 *buf, uhos_u32 len, uhos_void *arg)
+{
+    (void)arg;
+
+    return (pwrite(g_md_stream_bench_fd, buf, len, offset) == (ssize_t)len) ? 0 : -1;
+}
+
+static uhos_s32 md_stream_bench_read(uhos_u32 offset, uhos_u8 *buf, uhos_u32 len, uhos_void *arg)
+{
+    (void)arg;
+
+    return (pread(g_md_stream_bench_fd, buf, len, offset) == (ssize_t)len) ? 0 : -1;
+}
+
+/**
+ * @brief       一次性计算摘要作为参考值
+ */
+static uhos_void md_stream_bench_ref(const uhos_u8 *buf, uhos_u32 len, uhos_u8 *output)
+{
+    uhos_void *md = uhos_md_init(UHOS_MD_SHA256);
+
+    if (UHOS_NULL != md)
+    {
+        uhos_md_update(md, (uhos_u8 *)buf, len);
+        uhos_md_finish(md, output);
+    }
+}
+
+/**
+ * @brief       255个区间（含空区间）的流与零长度的流，各摘要都应与一次性计算的参考值一致
+ * @return      0-成功，-1-失败
+ */
+static uhos_s32 md_stream_bench_edge_run(uhos_void)
+{
+    uhos_bench_json_t json   = {0};
+    uhos_char         line[MD_STREAM_BENCH_JSON_LEN];
+    uhos_u8           digest[MD_STREAM_BENCH_DIGEST_MAX];
+    uhos_u8           ref[MD_STREAM_BENCH_DIGEST_MAX];
+    uhos_void        *stream = UHOS_NULL;
+    uhos_s32          status = 0;
+    uhos_u32          i      = 0;
+
+    for (i = 0; i < MD_STREAM_BENCH_RANGE_DATA; i++)
+    {
+        g_md_stream_bench_data[i] = (uhos_u8)(i * 7);
+    }
+    for (i = 0; i < MD_STREAM_BENCH_RANGE_NUM; i++)
+    {
+        g_md_stream_bench_ranges[i].offset  = i * 3;
+        g_md_stream_bench_ranges[i].len     = (0 != i % 5) ? 3 : 0;
+        g_md_stream_bench_ranges[i].md_type = UHOS_MD_SHA256;
+    }
+
+    stream = uhos_md_stream_init(UHOS_MD_SHA256, MD_STREAM_BENCH_RANGE_DATA, g_md_stream_bench_ranges, MD_STREAM_BENCH_RANGE_NUM);
+    if ((UHOS_NULL == stream) || (0 != uhos_md_stream_update(stream, 0, g_md_stream_bench_data, MD_STREAM_BENCH_RANGE_DATA)) ||
+        (0 != uhos_md_stream_finish(stream, UHOS_NULL, UHOS_NULL)))
+    {
+        status = -1;
+    }
+    for (i = 0; (0 == status) && (i < MD_STREAM_BENCH_RANGE_NUM); i++)
+    {
+        md_stream_bench_ref(&g_md_stream_bench_data[g_md_stream_bench_ranges[i].offset], g_md_stream_bench_ranges[i].len, ref);
+        if ((MD_STREAM_BENCH_DIGEST_MAX != uhos_md_stream_digest(stream, (uhos_s32)i, digest)) ||
+            (0 != uhos_libc_memcmp(digest, ref, sizeof(ref))))
+        {
+            status = -1;
+        }
+    }
+    md_stream_bench_ref(g_md_stream_bench_data, MD_STREAM_BENCH_RANGE_DATA, ref);
+    if ((0 != status) || (MD_STREAM_BENCH_DIGEST_MAX != uhos_md_stream_digest(stream, -1, digest)) ||
+        (0 != uhos_libc_memcmp(digest, ref, sizeof(ref))) || (uhos_md_stream_digest(stream, MD_STREAM_BENCH_RANGE_NUM, digest) >= 0))
+    {
+        status = -1;
+    }
+    if (UHOS_NULL != stream)
+    {
+        uhos_md_stream_free(stream);
+    }
+
+    stream = uhos_md_stream_init(UHOS_MD_SHA256, 0, UHOS_NULL, 0);
+    md_stream_bench_ref(g_md_stream_bench_data, 0, ref);
+    if ((UHOS_NULL == stream) || (0 != uhos_md_stream_finish(stream, UHOS_NULL, UHOS_NULL)) ||
+        (MD_STREAM_BENCH_DIGEST_MAX != uhos_md_stream_digest(stream, -1, digest)) || (0 != uhos_libc_memcmp(digest, ref, sizeof(ref))))
+    {
+        status = -1;
+    }
+    if (UHOS_NULL != stream)
+    {
+        uhos_md_stream_free(stream);
+    }
+
+    uhos_bench_json_begin(&json, line, sizeof(line));
+    uhos_bench_json_str(&json, "case", "edge");
+    uhos_bench_json_status(&json, status);
+    uhos_bench_json_u32(&json, "ranges", MD_STREAM_BENCH_RANGE_NUM);
+    uhos_bench_json_end(&json);
+    md_stream_bench_print(line);
+
+    return status;
+}
+
+int main(int argc, char *argv[])
+{
+    uhos_md_stream_bench_target_t target = {md_stream_bench_write, md_stream_bench_read, UHOS_NULL};
+    uhos_md_stream_bench_case_t   bcase  = {0};
+    uhos_md_stream_bench_result_t result = {0};
+    uhos_char                     line[MD_STREAM_BENCH_JSON_LEN];
+    uhos_s32                      ret    = 0;
+    uhos_u8                       mode   = 0;
+
+    if (2 != argc)
+    {
+        fprintf(stderr, "usage: %s <flash_file>\n", argv[0]);
+        return 2;
+    }
+
+    g_md_stream_bench_fd = open(argv[1], O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (g_md_stream_bench_fd < 0)
+    {
+        UHOS_LOGE("open %s failed", argv[1]);
+        return 1;
+    }
+
+    ret |= uhos_md_stream_bench_matrix_run(&target, md_stream_bench_print);
+
+    bcase.image_len = MD_STREAM_BENCH_LARGE_LEN;
+    bcase.chunk     = CONFIG_UHOS_MD_STREAM_BENCH_CHUNK;
+    for (mode = 0; mode < UHOS_MD_STREAM_BENCH_MODE_MAX; mode++)
+    {
+        bcase.mode = (uhos_md_stream_bench_mode_t)mode;
+        ret |= uhos_md_stream_bench_run(&target, &bcase, &result);
+        uhos_md_stream_bench_result_json(&bcase, &result, line, sizeof(line));
+        md_stream_bench_print(line);
+    }
+
+    ret |= md_stream_bench_edge_run();
+
+    close(g_md_stream_bench_fd);
+    unlink(argv[1]);
+
+    return (0 == ret) ? 0 : 1;
+}
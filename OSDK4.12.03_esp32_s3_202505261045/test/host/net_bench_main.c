@@ -0,0 +1,119 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file net_bench_main.c
+ * @author agent (agent@local)
+ * @brief 主机测试程序：在回环TCP连接上运行协议帧发送吞吐基准测试
+ * @details 经linux_posix网络适配层建立127.0.0.1上的连接，接收端由单独的线程排空
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：主机测试程序：在回环TCP连接上运行协议帧发送吞吐基准测试
+ * </table>
+ */
+
+#define LOG_TAG "net-bench"
+
+#include <stdio.h>
+
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_thread.h"
+#include "uh_semaphore.h"
+#include "uh_al_net.h"
+
+#include "uh_bench.h"
+#include "uh_net_bench.h"
+
+static uhos_sem_t g_net_bench_drain_done = UHOS_NULL;
+
+static void net_bench_print(const uhos_char *line)
+{
+    printf("%s\n", line);
+    fflush(stdout);
+}
+
+static void *net_bench_drain_task(void *arg)
+{
+    static uhos_u8 buf[16384];
+    uhos_s32       fd = (uhos_s32)(uhos_size_t)arg;
+
+    while (uhos_net_recv(fd, buf, sizeof(buf), 0) > 0)
+    {
+    }
+    uhos_sem_release(g_net_bench_drain_done);
+
+    return UHOS_NULL;
+}
+
+/**
+ * @brief       建立回环TCP连接
+ * @return      0-成功，-1-失败
+ */
+static int net_bench_connect(uhos_s32 *tx, uhos_s32 *rx)
+{
+    struct uhos_sockaddr_in addr = {0};
+    uhos_socklen_t          len  = sizeof(addr);
+    uhos_s32                lfd  = uhos_net_socket(UHOS_AF_INET, UHOS_SOCK_STREAM, 0);
+
+    *tx = -1;
+    *rx = -1;
+    if (lfd < 0)
+    {
+        return -1;
+    }
+
+    addr.sin_len         = sizeof(addr);
+    addr.sin_family      = UHOS_AF_INET;
+    addr.sin_addr.s_addr = uhos_net_inet_addr("127.0.0.1");
+    if ((0 != uhos_net_bind(lfd, (struct uhos_sockaddr *)&addr, sizeof(addr))) || (0 != uhos_net_listen(lfd, 1)) ||
+        (0 != uhos_net_getsockname(lfd, (struct uhos_sockaddr *)&addr, &len)))
+    {
+        uhos_net_close(lfd);
+        return -1;
+    }
+
+    *tx = uhos_net_socket(UHOS_AF_INET, UHOS_SOCK_STREAM, 0);
+    if ((*tx >= 0) && (0 == uhos_net_connect(*tx, (struct uhos_sockaddr *)&addr, sizeof(addr))))
+    {
+        *rx = uhos_net_accept(lfd, UHOS_NULL, UHOS_NULL);
+    }
+    uhos_net_close(lfd);
+
+    return (*rx >= 0) ? 0 : -1;
+}
+
+int main(void)
+{
+    uhos_thread_attr_t attr = {0};
+    uhos_thread_t      tid  = UHOS_NULL;
+    uhos_s32           tx   = -1;
+    uhos_s32           rx   = -1;
+    uhos_s32           ret  = -1;
+
+    if ((0 != net_bench_connect(&tx, &rx)) || (UHOS_SUCCESS != uhos_sem_create(&g_net_bench_drain_done, 0)))
+    {
+        UHOS_LOGE("loopback connection failed");
+        return 1;
+    }
+
+    attr.stack_size = 16 * 1024;
+    attr.name       = "net_drain";
+    if (UHOS_SUCCESS == uhos_thread_create(&tid, net_bench_drain_task, (void *)(uhos_size_t)rx, &attr))
+    {
+        ret = uhos_net_bench_matrix_run(tx, net_bench_print);
+        // 关闭发送端后接收线程读到连接结束退出
+        uhos_net_close(tx);
+        uhos_sem_wait(g_net_bench_drain_done, UHOS_SEM_WAIT_FOREVER);
+    }
+    else
+    {
+        uhos_net_close(tx);
+    }
+    uhos_net_close(rx);
+    uhos_sem_delete(g_net_bench_drain_done);
+
+    return (0 == ret) ? 0 : 1;
+}
@@ -0,0 +1,31 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file net_dns_bench_main.c
+ * @author agent (agent@local)
+ * @brief 主机测试程序：运行域名解析缓存对重连耗时影响的基准测试
+ * @details 桩DNS服务器与TCP监听端由uh_net_dns_bench在127.0.0.1上创建，经linux_posix网络适配层收发
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：主机测试程序：运行域名解析缓存对重连耗时影响的基准测试
+ * </table>
+ */
+
+#include <stdio.h>
+
+#include "uh_types.h"
+#include "uh_bench.h"
+#include "uh_net_dns_bench.h"
+
+static void net_dns_bench_print(const uhos_char *line)
+{
+    printf("%s\n", line);
+    fflush(stdout);
+}
+
+int main(void)
+{
+    return (0 == uhos_net_dns_bench_matrix_run(net_dns_bench_print)) ? 0 : 1;
+}
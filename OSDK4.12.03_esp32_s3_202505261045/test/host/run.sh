@@ -0,0 +1,195 @@
+#!/bin/sh
+#
+# 在Linux主机上编译并运行SDK的主机测试与基准测试程序
+#
+# 用法: test/host/run.sh <用例>... ，不带参数时运行全部用例
+#   ble_sim_cache   BLE模拟器：GATT client属性缓存命中条件与重连首次写入时间
+#   ble_bench       BLE模拟器：notify、写命令、写请求在不同MTU、连接间隔、数据长度与连接数下的吞吐与延迟
+#   ble_adv_bench   广播透传过滤：编译后的匹配器与逐条线性比较的回放耗时
+#   crypt           aes各模式的已知答案测试与吞吐率基准测试（OpenSSL实现的uh_crypt）
+#   md_stream_bench 以文件模拟OTA分区，写完后读回与写入时流式计算摘要的耗时，及255个区间与空输入的摘要
+#   net_bench       回环TCP上拷贝拼帧与聚合发送（uhos_net_writev）的协议帧发送吞吐
+#   net_dns_bench   桩DNS服务器不同应答延时下，清除缓存与缓存命中时的解析加TCP建连耗时
+#   http_bench      本机HTTP/HTTPS服务器（http_server.py）上每请求建连、连接复用与流水线的请求时延，
+#                   需要python3与openssl命令行工具
+#   tls_async_bench 本机TLS1.3与TLS1.2服务器上一个与两个事件循环并发异步握手、含超时连接时的耗时，
+#                   以及回调中取消同批其他握手时的重新校验，需要python3与openssl命令行工具
+#   tls_store_test  本机TLS1.3与TLS1.2服务器上多个句柄共用证书库时握手上下文的创建、共用与销毁次数，
+#                   需要python3与openssl命令行工具
+#
+# 环境变量:
+#   CC            编译器，默认gcc
+#   CFLAGS        附加编译选项，例如 "-O2" 或 "-fsanitize=address,undefined"；
+#                 AddressSanitizer下不要加优化选项：uhos_thread_delete以pthread_cancel结束线程，
+#                 优化后的栈展开会被误报为stack-buffer-overflow
+#   BUILD_DIR     输出目录，默认 /tmp/uhos_host_build
+#   UHOS_LOG_LVL  运行时日志级别，0~5，默认2（告警）
+#
+# 每个用例输出若干行JSON，全部用例通过时退出码为0
+
+set -e
+
+SDK=$(cd "$(dirname "$0")/../.." && pwd)
+HOST="$SDK/test/host"
+CC=${CC:-gcc}
+BUILD_DIR=${BUILD_DIR:-/tmp/uhos_host_build}
+INC="$(find "$SDK/include" -type d -printf '-I%p ')"
+LIBC="$SDK/src/AL_API/AL_LIBC/uh_libc_mem.c $SDK/src/AL_API/AL_LIBC/uh_libc_str.c"
+OS="$SDK/src/AL_API/AL_OS/linux_posix/linux_posix.c"
+FS="$SDK/src/AL_API/AL_FS/linux_posix/linux_posix_fs.c"
+BENCH="-I$SDK/src/AL_API/AL_BENCH/include $SDK/src/AL_API/AL_BENCH/src/uh_bench.c"
+SE="$SDK/src/AL_API/AL_SE"
+NET="-DCONFIG_UHOS_FD_SETSIZE=1024 -I$SDK/src/AL_API/AL_NET/include $SDK/src/AL_API/AL_NET/linux_posix/uh_net.c"
+RANDOM_SRC="$SDK/src/AL_API/AL_LIBC/linux_posix/uh_random.c"
+
+mkdir -p "$BUILD_DIR"
+
+# build <名称> <附加头文件目录与源文件...>
+build()
+{
+    name=$1
+    shift
+    $CC -g -D_GNU_SOURCE -DCONFIG_LOG_LVL=5 $CFLAGS $INC "$@" "$HOST/host_log.c" $OS $LIBC -lpthread \
+        -o "$BUILD_DIR/$name"
+}
+
+run_ble_sim_cache()
+{
+    BLE="$SDK/src/AL_API/AL_BLE"
+    build ble_sim_cache -I"$BLE/sim/include" -I"$BLE/include" "$HOST/ble_sim_cache_main.c" \
+        "$BLE"/sim/src/*.c "$BLE"/src/*.c $FS $BENCH
+    rm -rf /tmp/uhos_fs/data/ble_gattc
+    "$BUILD_DIR/ble_sim_cache"
+}
+
+run_ble_bench()
+{
+    BLE="$SDK/src/AL_API/AL_BLE"
+    build ble_bench -I"$BLE/sim/include" -I"$BLE/include" "$HOST/ble_bench_main.c" \
+        "$BLE"/sim/src/*.c "$BLE"/src/*.c $FS $BENCH
+    "$BUILD_DIR/ble_bench"
+}
+
+run_ble_adv_bench()
+{
+    BLE="$SDK/src/AL_API/AL_BLE"
+    build ble_adv_bench -I"$BLE/sim/include" -I"$BLE/include" "$HOST/ble_adv_bench_main.c" \
+        "$BLE"/sim/src/*.c "$BLE"/src/*.c $FS $BENCH
+    "$BUILD_DIR/ble_adv_bench"
+}
+
+run_crypt()
+{
+    build crypt_test -I"$SE/include" "$HOST/crypt_test.c" "$SE/src/uh_crypt_bench.c" "$SE/linux_openssl/uh_crypt.c" \
+        $BENCH -lcrypto
+    "$BUILD_DIR/crypt_test"
+}
+
+run_md_stream_bench()
+{
+    build md_stream_bench -I"$SE/include" "$HOST/md_stream_bench_main.c" "$SE/src/uh_md_stream_bench.c" \
+        "$SE/src/uh_md_stream.c" "$SE/linux_openssl/uh_verify.c" $BENCH -lcrypto
+    "$BUILD_DIR/md_stream_bench" "$BUILD_DIR/md_stream_flash.bin"
+}
+
+run_net_bench()
+{
+    build net_bench "$HOST/net_bench_main.c" "$SDK/src/AL_API/AL_NET/src/uh_net_bench.c" \
+        "$SDK/src/AL_API/AL_NET/linux_posix/uh_net_sendmsg.c" $NET $BENCH
+    "$BUILD_DIR/net_bench"
+}
+
+run_net_dns_bench()
+{
+    build net_dns_bench "$HOST/net_dns_bench_main.c" "$SDK/src/AL_API/AL_NET/src/uh_net_dns_bench.c" \
+        "$SDK/src/AL_API/AL_NET/src/uh_net_dns.c" "$SDK/src/AL_API/AL_NET/linux_posix/uh_net_poller.c" \
+        $RANDOM_SRC $NET $BENCH
+    "$BUILD_DIR/net_dns_bench"
+}
+
+# 生成本机服务器用的一次性自签名证书
+make_cert()
+{
+    openssl req -x509 -newkey rsa:2048 -nodes -days 1 -subj "/CN=127.0.0.1" -addext "subjectAltName=IP:127.0.0.1" \
+        -keyout "$BUILD_DIR/http_key.pem" -out "$BUILD_DIR/http_cert.pem" 2>/dev/null
+}
+
+# start_server <端口文件> [<证书> <私钥> [tls1.2]]，等待端口文件写入
+start_server()
+{
+    rm -f "$1"
+    python3 "$HOST/http_server.py" "$@" &
+    SERVER_PIDS="$SERVER_PIDS $!"
+    i=0
+    while [ ! -s "$1" ] && [ $i -lt 50 ]; do
+        sleep 0.1
+        i=$((i + 1))
+    done
+    [ -s "$1" ]
+}
+
+run_http_bench()
+{
+    NETSRC="$SDK/src/AL_API/AL_NET"
+    build http_bench -I"$SE/include" "$HOST/http_bench_main.c" "$NETSRC/src/uh_http_bench.c" "$NETSRC/src/uh_http_pool.c" \
+        "$NETSRC/src/uh_net_dns.c" "$NETSRC/linux_posix/uh_net_poller.c" "$NETSRC/linux_posix/uh_net_sendmsg.c" \
+        "$SE/src/uh_tls_sendv.c" "$SE/src/uh_tls_session.c" "$SE/linux_openssl/uh_tls.c" $RANDOM_SRC $NET $BENCH -lssl -lcrypto
+
+    make_cert
+    SERVER_PIDS=""
+    trap 'kill $SERVER_PIDS 2>/dev/null' EXIT
+    start_server "$BUILD_DIR/http_port"
+    start_server "$BUILD_DIR/https_port" "$BUILD_DIR/http_cert.pem" "$BUILD_DIR/http_key.pem"
+
+    ret=0
+    "$BUILD_DIR/http_bench" "$(cat "$BUILD_DIR/http_port")" "$(cat "$BUILD_DIR/https_port")" "$BUILD_DIR/http_cert.pem" || ret=1
+    kill $SERVER_PIDS 2>/dev/null
+    trap - EXIT
+    return $ret
+}
+
+# run_tls_versions <程序>，依次对本机TLS1.3与TLS1.2服务器运行，参数为端口与CA证书
+run_tls_versions()
+{
+    make_cert
+    SERVER_PIDS=""
+    trap 'kill $SERVER_PIDS 2>/dev/null' EXIT
+    start_server "$BUILD_DIR/tls13_port" "$BUILD_DIR/http_cert.pem" "$BUILD_DIR/http_key.pem"
+    start_server "$BUILD_DIR/tls12_port" "$BUILD_DIR/http_cert.pem" "$BUILD_DIR/http_key.pem" tls1.2
+
+    ret=0
+    echo "tls1.3"
+    "$BUILD_DIR/$1" "$(cat "$BUILD_DIR/tls13_port")" "$BUILD_DIR/http_cert.pem" || ret=1
+    echo "tls1.2"
+    "$BUILD_DIR/$1" "$(cat "$BUILD_DIR/tls12_port")" "$BUILD_DIR/http_cert.pem" || ret=1
+    kill $SERVER_PIDS 2>/dev/null
+    trap - EXIT
+    return $ret
+}
+
+run_tls_async_bench()
+{
+    build tls_async_bench -I"$SE/include" "$HOST/tls_async_bench_main.c" "$SE/src/uh_tls_async_bench.c" \
+        "$SE/src/uh_tls_async.c" "$SE/linux_openssl/uh_tls.c" "$SDK/src/AL_API/AL_NET/linux_posix/uh_net_poller.c" \
+        $NET $BENCH -lssl -lcrypto
+
+    run_tls_versions tls_async_bench
+}
+
+run_tls_store_test()
+{
+    build tls_store_test -I"$SE/include" "$HOST/tls_store_test.c" "$SE/linux_openssl/uh_tls.c" $NET $BENCH -lssl -lcrypto
+    run_tls_versions tls_store_test
+}
+
+CASES=${*:-"ble_sim_cache ble_bench ble_adv_bench crypt md_stream_bench net_bench net_dns_bench http_bench tls_async_bench tls_store_test"}
+failed=0
+for c in $CASES; do
+    echo "== $c"
+    if ! "run_$c"; then
+        echo "== $c FAILED"
+        failed=1
+    fi
+done
+
+exit $failed
@@ -0,0 +1,247 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file tls_async_bench_main.c
+ * @author agent (agent@local)
+ * @brief 主机测试程序：对本机TLS服务器运行异步tls握手并发测试与同批事件重新校验测试
+ * @details 服务器由run.sh以http_server.py启动；TLS经linux_openssl的uh_tls实现，poller为linux_posix实现。
+ *          重新校验测试中，偶数号连接的回调取消下一个连接的握手并立即以新连接发起一次握手，
+ *          新握手可能复用被取消握手的内存；同一批就绪事件中被取消的握手不应被推进或回调
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：主机测试程序：对本机TLS服务器运行异步tls握手并发测试与同批事件重新校验测试
+ * </table>
+ */
+
+#define LOG_TAG "tls-async-bench"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_al_net.h"
+#include "uh_tls.h"
+
+#include "uh_bench.h"
+#include "uh_tls_async_bench.h"
+
+// CA证书文件的最大长度
+#define TLS_ASYNC_BENCH_CA_MAX          8192
+
+// 重新校验测试的初始连接数
+#define TLS_ASYNC_BENCH_REVALIDATE_LINKS 16
+
+// 重新校验测试的握手超时
+#define TLS_ASYNC_BENCH_REVALIDATE_MS   3000
+
+// JSON行的最大长度
+#define TLS_ASYNC_BENCH_JSON_LEN        128
+
+/**
+ * @struct      重新校验测试的一个连接
+ */
+typedef struct
+{
+    uhos_s32   fd;
+    uhos_void *tls;
+    uhos_u32   done;                                            //<! 回调次数
+    uhos_s32   result;
+} tls_async_bench_link_t;
+
+static uhos_u8                 g_tls_async_bench_ca[TLS_ASYNC_BENCH_CA_MAX];
+static uhos_size_t             g_tls_async_bench_ca_len;
+static struct uhos_sockaddr_in g_tls_async_bench_addr;
+static uhos_net_poller_t       g_tls_async_bench_poller;
+// 前半为初始连接，后半为回调中新发起的连接
+static tls_async_bench_link_t  g_tls_async_bench_links[TLS_ASYNC_BENCH_REVALIDATE_LINKS * 2];
+static uhos_u32                g_tls_async_bench_started;
+static uhos_u32                g_tls_async_bench_cancelled;
+
+static void tls_async_bench_print(const uhos_char *line)
+{
+    printf("%s\n", line);
+    fflush(stdout);
+}
+
+/**
+ * @brief       读入PEM格式的CA证书，长度含结尾的'\0'
+ * @return      证书长度，0表示失败
+ */
+static uhos_size_t tls_async_bench_ca_load(const char *path)
+{
+    FILE       *fp  = fopen(path, "rb");
+    uhos_size_t len = 0;
+
+    if (UHOS_NULL == fp)
+    {
+        return 0;
+    }
+    len = fread(g_tls_async_bench_ca, 1, sizeof(g_tls_async_bench_ca) - 1, fp);
+    fclose(fp);
+    g_tls_async_bench_ca[len] = '\0';
+
+    return (len > 0) ? (len + 1) : 0;
+}
+
+static uhos_void tls_async_bench_revalidate_cb(uhos_void *handle, uhos_s32 result, uhos_void *arg);
+
+/**
+ * @brief       以阻塞方式连接服务器，设为非阻塞后发起异步握手
+ * @return      0-成功，-1-失败
+ */
+static uhos_s32 tls_async_bench_link_start(uhos_u32 idx)
+{
+    tls_async_bench_link_t *link = &g_tls_async_bench_links[idx];
+    uhos_s32                on   = 1;
+
+    g_tls_async_bench_started++;
+    link->fd  = uhos_net_socket(UHOS_AF_INET, UHOS_SOCK_STREAM, 0);
+    link->tls = uhos_tls_init();
+    if ((link->fd < 0) || (UHOS_NULL == link->tls) ||
+        (0 != uhos_net_connect(link->fd, (const struct uhos_sockaddr *)&g_tls_async_bench_addr, sizeof(g_tls_async_bench_addr))) ||
+        (0 != uhos_net_setsockopt(link->fd, UHOS_SOL_SOCKET, SO_OPT_NONBLOCK, &on, sizeof(on))) ||
+        (0 != uhos_tls_set_ca_cert(link->tls, g_tls_async_bench_ca, g_tls_async_bench_ca_len)) ||
+        (0 != uhos_tls_set_connected_socket(link->tls, link->fd)) || (0 != uhos_tls_start(link->tls)) ||
+        (uhos_tls_handshake_start(link->tls, g_tls_async_bench_poller, link->fd, TLS_ASYNC_BENCH_REVALIDATE_MS,
+                                  tls_async_bench_revalidate_cb, (uhos_void *)(uhos_size_t)idx) < 0))
+    {
+        UHOS_LOGE("link %u start failed", (unsigned)idx);
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       握手完成回调：偶数号初始连接取消下一个连接的握手，并以新连接补发一次握手
+ */
+static uhos_void tls_async_bench_revalidate_cb(uhos_void *handle, uhos_s32 result, uhos_void *arg)
+{
+    tls_async_bench_link_t *next = UHOS_NULL;
+    uhos_u32                idx  = (uhos_u32)(uhos_size_t)arg;
+
+    (void)handle;
+
+    g_tls_async_bench_links[idx].done++;
+    g_tls_async_bench_links[idx].result = result;
+
+    if ((idx + 1 < TLS_ASYNC_BENCH_REVALIDATE_LINKS) && (0 == idx % 2) &&
+        (0 == uhos_tls_handshake_cancel(g_tls_async_bench_links[idx + 1].tls)))
+    {
+        // 立即关闭被取消的连接，服务器在同一线程中逐个握手，不关闭会一直等待它
+        next = &g_tls_async_bench_links[idx + 1];
+        uhos_tls_uninit(next->tls);
+        uhos_net_close(next->fd);
+        next->tls = UHOS_NULL;
+        next->fd  = -1;
+        g_tls_async_bench_cancelled++;
+        tls_async_bench_link_start(TLS_ASYNC_BENCH_REVALIDATE_LINKS + idx);
+    }
+}
+
+/**
+ * @brief       重新校验测试：每个未被取消的握手恰好回调一次且成功，被取消的握手不回调
+ * @return      0-成功，-1-失败
+ */
+static uhos_s32 tls_async_bench_revalidate_run(uhos_u16 port)
+{
+    uhos_bench_json_t json     = {0};
+    uhos_char         line[TLS_ASYNC_BENCH_JSON_LEN];
+    uhos_s32          status   = 0;
+    uhos_u32          finished = 0;
+    uhos_u32          i        = 0;
+
+    g_tls_async_bench_addr.sin_family      = UHOS_AF_INET;
+    g_tls_async_bench_addr.sin_port        = uhos_net_htons(port);
+    g_tls_async_bench_addr.sin_addr.s_addr = uhos_net_htonl(UHOS_INADDR_LOOPBACK);
+    for (i = 0; i < TLS_ASYNC_BENCH_REVALIDATE_LINKS * 2; i++)
+    {
+        g_tls_async_bench_links[i].fd = -1;
+    }
+
+    g_tls_async_bench_poller = uhos_net_poller_create(TLS_ASYNC_BENCH_REVALIDATE_LINKS * 2);
+    if (UHOS_NULL == g_tls_async_bench_poller)
+    {
+        return -1;
+    }
+
+    for (i = 0; i < TLS_ASYNC_BENCH_REVALIDATE_LINKS; i++)
+    {
+        if (0 != tls_async_bench_link_start(i))
+        {
+            status = -1;
+        }
+    }
+    while (uhos_tls_handshake_poll(g_tls_async_bench_poller, -1) > 0)
+    {
+    }
+
+    for (i = 0; i < TLS_ASYNC_BENCH_REVALIDATE_LINKS * 2; i++)
+    {
+        if (UHOS_NULL != g_tls_async_bench_links[i].tls)
+        {
+            uhos_tls_uninit(g_tls_async_bench_links[i].tls);
+        }
+        if (g_tls_async_bench_links[i].fd >= 0)
+        {
+            uhos_net_close(g_tls_async_bench_links[i].fd);
+        }
+        if (g_tls_async_bench_links[i].done > 0)
+        {
+            finished++;
+        }
+        if ((g_tls_async_bench_links[i].done > 1) ||
+            ((g_tls_async_bench_links[i].done > 0) && (UHOS_TLS_RET_OK != g_tls_async_bench_links[i].result)))
+        {
+            status = -1;
+        }
+    }
+    uhos_net_poller_destroy(g_tls_async_bench_poller);
+    if ((0 == g_tls_async_bench_cancelled) || (finished + g_tls_async_bench_cancelled != g_tls_async_bench_started))
+    {
+        status = -1;
+    }
+
+    uhos_bench_json_begin(&json, line, sizeof(line));
+    uhos_bench_json_str(&json, "case", "revalidate");
+    uhos_bench_json_status(&json, status);
+    uhos_bench_json_u32(&json, "started", g_tls_async_bench_started);
+    uhos_bench_json_u32(&json, "cancelled", g_tls_async_bench_cancelled);
+    uhos_bench_json_u32(&json, "finished", finished);
+    uhos_bench_json_end(&json);
+    tls_async_bench_print(line);
+
+    return status;
+}
+
+int main(int argc, char *argv[])
+{
+    uhos_tls_async_bench_target_t target = {0};
+    uhos_s32                      ret    = 0;
+
+    if (3 != argc)
+    {
+        fprintf(stderr, "usage: %s <tls_port> <ca_cert.pem>\n", argv[0]);
+        return 2;
+    }
+
+    g_tls_async_bench_ca_len = tls_async_bench_ca_load(argv[2]);
+    if (0 == g_tls_async_bench_ca_len)
+    {
+        UHOS_LOGE("load %s failed", argv[2]);
+        return 1;
+    }
+    target.ip          = "127.0.0.1";
+    target.port        = (uhos_u16)atoi(argv[1]);
+    target.ca_cert     = g_tls_async_bench_ca;
+    target.ca_cert_len = g_tls_async_bench_ca_len;
+
+    ret |= uhos_tls_async_bench_matrix_run(&target, tls_async_bench_print);
+    ret |= tls_async_bench_revalidate_run(target.port);
+
+    return (0 == ret) ? 0 : 1;
+}
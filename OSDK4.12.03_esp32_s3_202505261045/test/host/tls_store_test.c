@@ -0,0 +1,421 @@
+/**
+ * @copyright Copyright (c) 2021, Haier.Co, Ltd.
+ * @file tls_store_test.c
+ * @author agent (agent@local)
+ * @brief 主机测试程序：tls证书库共用与释放测试，检查多个句柄共用一个握手上下文且该上下文只销毁一次
+ * @details 以uhos_tls_store_get_stat在用例前后的差值确认：共用证书库的句柄不再各自创建握手上下文，
+ *          证书库与句柄以任意顺序释放，上下文都只在最后一个引用释放时销毁一次。
+ *          不设置证书库的对照用例同时给出逐个句柄解析证书的耗时。
+ *          服务器由run.sh以http_server.py启动；TLS经linux_openssl的uh_tls实现
+ * @date 2026-10-19
+ *
+ * @par History:
+ * <table>
+ * <tr><th>Date         <th>version <th>Author  <th>Description
+ * <tr><td>2026-10-19   <td>1.0     <td>agent   <td>新增：tls证书库共用与释放测试的功能实现
+ * <tr><td>2026-10-19   <td>1.1     <td>agent   <td>由库源文件移为主机测试程序，输出与计时改用uh_bench.h
+ * </table>
+ */
+
+#define LOG_TAG "tls-store-test"
+
+/**************************************************************************************************/
+/*                           #include (依次为标准头文件、非标准头文件)                            */
+/**************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "uh_types.h"
+#include "uh_libc.h"
+#include "uh_log.h"
+#include "uh_al_net.h"
+#include "uh_tls.h"
+
+#include "uh_bench.h"
+
+/**************************************************************************************************/
+/*                                           内部宏定义                                           */
+/**************************************************************************************************/
+// 一个用例最多的连接数
+#define UHOS_TLS_STORE_TEST_LINKS           8
+
+// CA证书文件的最大长度
+#define UHOS_TLS_STORE_TEST_CA_MAX          8192
+
+// 阻塞套接字上握手仍返回WANT_READ/WANT_WRITE时的最多重试次数
+#define UHOS_TLS_STORE_TEST_RETRY_MAX       100
+
+// JSON行的最大长度
+#define UHOS_TLS_STORE_TEST_JSON_LEN        320
+
+/**************************************************************************************************/
+/*                                        内部数据类型定义                                        */
+/**************************************************************************************************/
+/**
+ * @enum        证书的设置方式与释放顺序
+ */
+typedef enum
+{
+    UHOS_TLS_STORE_TEST_RELEASE_FIRST = 0,                      //<! 共用证书库，握手后调用者先释放证书库，再释放句柄
+    UHOS_TLS_STORE_TEST_RELEASE_LAST,                           //<! 共用证书库，先释放句柄，调用者最后释放证书库
+    UHOS_TLS_STORE_TEST_NO_STORE,                               //<! 对照：各句柄以uhos_tls_set_ca_cert单独设置证书
+    UHOS_TLS_STORE_TEST_MODE_MAX,
+} uhos_tls_store_test_mode_t;
+
+/**
+ * @struct      被测服务器
+ */
+typedef struct
+{
+    const uhos_char *ip;                                        //<! 服务器点分十进制IP地址
+    uhos_u16         port;                                      //<! 服务器端口
+    const uhos_u8   *ca_cert;                                   //<! CA证书
+    uhos_size_t      ca_cert_len;
+} uhos_tls_store_test_target_t;
+
+/**
+ * @struct      测试用例
+ */
+typedef struct
+{
+    uhos_tls_store_test_mode_t mode;                            //<! 设置方式与释放顺序
+    uhos_u32                   links;                           //<! 依次握手的连接数
+} uhos_tls_store_test_case_t;
+
+/**
+ * @struct      测试结果，计数均为本用例执行前后uhos_tls_store_get_stat的差值
+ */
+typedef struct
+{
+    uhos_s32 status;                                            //<! 0-结果与预期一致，-1-不一致或出错
+    uhos_u32 ok;                                                //<! 握手成功数
+    uhos_s32 refs;                                              //<! 全部握手后证书库的引用数，共用时应为links+1
+    uhos_u32 ctx_new;                                           //<! 创建的握手上下文数，共用时应为1
+    uhos_u32 ctx_shared;                                        //<! 共用证书库上下文的句柄数，共用时应为links
+    uhos_u32 ctx_free_early;                                    //<! 最后一个引用释放前已销毁的上下文数，共用时应为0
+    uhos_u32 ctx_free;                                          //<! 全部释放后销毁的上下文数，应等于ctx_new
+    uhos_s32 stores;                                            //<! 全部释放后未销毁的证书库数，应为0
+    uhos_u32 elapsed_us;                                        //<! 全部句柄设置证书、启动与握手的耗时
+} uhos_tls_store_test_result_t;
+
+/**************************************************************************************************/
+/*                                        全局(静态)变量                                          */
+/**************************************************************************************************/
+static const uhos_char *g_uhos_tls_store_test_mode_name[UHOS_TLS_STORE_TEST_MODE_MAX] = {"release_first", "release_last",
+                                                                                          "no_store"};
+static uhos_u8          g_uhos_tls_store_test_ca[UHOS_TLS_STORE_TEST_CA_MAX];
+
+/**************************************************************************************************/
+/*                                          内部函数实现                                          */
+/**************************************************************************************************/
+/**
+ * @brief       以阻塞方式连接
+ * @return      socket，-1表示失败
+ */
+static uhos_s32 uhos_tls_store_test_connect(const struct uhos_sockaddr_in *addr)
+{
+    uhos_s32 fd = uhos_net_socket(UHOS_AF_INET, UHOS_SOCK_STREAM, 0);
+
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    if (0 != uhos_net_connect(fd, (const struct uhos_sockaddr *)addr, sizeof(struct uhos_sockaddr_in)))
+    {
+        uhos_net_close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+/**
+ * @brief       握手到成功或失败
+ * @return      0-成功，-1-失败
+ */
+static uhos_s32 uhos_tls_store_test_handshake(uhos_void *tls)
+{
+    uhos_s32 ret   = UHOS_TLS_RET_ERROR;
+    uhos_u32 retry = 0;
+
+    for (retry = 0; retry < UHOS_TLS_STORE_TEST_RETRY_MAX; retry++)
+    {
+        ret = uhos_tls_handshake(tls);
+        if ((UHOS_TLS_RET_WANT_READ != ret) && (UHOS_TLS_RET_WANT_WRITE != ret))
+        {
+            break;
+        }
+    }
+
+    return (UHOS_TLS_RET_OK == ret) ? 0 : -1;
+}
+
+/**
+ * @brief       释放一个连接
+ */
+static uhos_void uhos_tls_store_test_close(uhos_void **tls, uhos_s32 *fd)
+{
+    if (UHOS_NULL != *tls)
+    {
+        uhos_tls_uninit(*tls);
+        *tls = UHOS_NULL;
+    }
+    if (*fd >= 0)
+    {
+        uhos_net_close(*fd);
+        *fd = -1;
+    }
+}
+
+/**
+ * @brief       执行一个用例：以阻塞方式依次建立连接并握手，按用例的顺序释放证书库与句柄，
+ *              检查证书库的引用数与握手上下文的创建、共用、销毁次数
+ * @note        统计为全局计数，执行期间不应有其他tls句柄启动或释放
+ * @param[in]   target  被测服务器
+ * @param[in]   bcase   用例
+ * @param[out]  result  结果
+ * @return      0-成功，-1-失败
+ */
+static uhos_s32 uhos_tls_store_test_run(const uhos_tls_store_test_target_t *target, const uhos_tls_store_test_case_t *bcase,
+                                        uhos_tls_store_test_result_t *result)
+{
+    uhos_void              *tls[UHOS_TLS_STORE_TEST_LINKS];
+    uhos_s32                fd[UHOS_TLS_STORE_TEST_LINKS];
+    uhos_tls_store_stat_t   before   = {0};
+    uhos_tls_store_stat_t   after    = {0};
+    struct uhos_sockaddr_in srv_addr = {0};
+    uhos_void              *store    = UHOS_NULL;
+    uhos_u32                expect   = 0;
+    uhos_u32                start    = 0;
+    uhos_u32                i        = 0;
+    uhos_s32                ret      = 0;
+
+    if ((UHOS_NULL == target) || (UHOS_NULL == bcase) || (UHOS_NULL == result) || (bcase->mode >= UHOS_TLS_STORE_TEST_MODE_MAX) ||
+        (0 == bcase->links) || (bcase->links > UHOS_TLS_STORE_TEST_LINKS))
+    {
+        return -1;
+    }
+
+    uhos_libc_memset(result, 0, sizeof(uhos_tls_store_test_result_t));
+    result->status = -1;
+    result->refs   = -1;
+    for (i = 0; i < UHOS_TLS_STORE_TEST_LINKS; i++)
+    {
+        tls[i] = UHOS_NULL;
+        fd[i]  = -1;
+    }
+
+    if (0 != uhos_tls_store_get_stat(&before))
+    {
+        return -1;
+    }
+
+    if (UHOS_TLS_STORE_TEST_NO_STORE != bcase->mode)
+    {
+        store = uhos_tls_store_create(target->ca_cert, target->ca_cert_len, UHOS_NULL, 0, UHOS_NULL, 0);
+        if (UHOS_NULL == store)
+        {
+            goto out;
+        }
+    }
+
+    srv_addr.sin_family      = UHOS_AF_INET;
+    srv_addr.sin_port        = uhos_net_htons(target->port);
+    srv_addr.sin_addr.s_addr = uhos_net_inet_addr(target->ip);
+
+    start = uhos_bench_now_us();
+    for (i = 0; i < bcase->links; i++)
+    {
+        fd[i]  = uhos_tls_store_test_connect(&srv_addr);
+        tls[i] = uhos_tls_init();
+        if ((fd[i] < 0) || (UHOS_NULL == tls[i]))
+        {
+            UHOS_LOGE("link %u connect failed", (unsigned)i);
+            goto out;
+        }
+
+        ret = (UHOS_NULL != store) ? uhos_tls_set_ca_store(tls[i], store)
+                                   : uhos_tls_set_ca_cert(tls[i], target->ca_cert, target->ca_cert_len);
+        if ((0 != ret) || (0 != uhos_tls_set_connected_socket(tls[i], fd[i])) || (0 != uhos_tls_start(tls[i])) ||
+            (0 != uhos_tls_store_test_handshake(tls[i])))
+        {
+            UHOS_LOGE("link %u handshake failed", (unsigned)i);
+            goto out;
+        }
+        result->ok++;
+    }
+    result->elapsed_us = uhos_bench_now_us() - start;
+    result->refs       = (UHOS_NULL != store) ? uhos_tls_store_get_refs(store) : 0;
+
+    // 按用例顺序释放，最后一个引用释放前记录已销毁的上下文数
+    if (UHOS_TLS_STORE_TEST_RELEASE_FIRST == bcase->mode)
+    {
+        uhos_tls_store_release(store);
+        store = UHOS_NULL;
+        for (i = 0; i + 1 < bcase->links; i++)
+        {
+            uhos_tls_store_test_close(&tls[i], &fd[i]);
+        }
+    }
+    else
+    {
+        for (i = 0; i < bcase->links; i++)
+        {
+            uhos_tls_store_test_close(&tls[i], &fd[i]);
+        }
+    }
+    uhos_tls_store_get_stat(&after);
+    result->ctx_free_early = after.ctx_free - before.ctx_free;
+
+out:
+    for (i = 0; i < UHOS_TLS_STORE_TEST_LINKS; i++)
+    {
+        uhos_tls_store_test_close(&tls[i], &fd[i]);
+    }
+    if (UHOS_NULL != store)
+    {
+        uhos_tls_store_release(store);
+    }
+
+    uhos_tls_store_get_stat(&after);
+    result->ctx_new    = after.ctx_new - before.ctx_new;
+    result->ctx_shared = after.ctx_shared - before.ctx_shared;
+    result->ctx_free   = after.ctx_free - before.ctx_free;
+    result->stores     = (uhos_s32)(after.stores - before.stores);
+
+    expect = (UHOS_TLS_STORE_TEST_NO_STORE == bcase->mode) ? bcase->links : 1;
+    if ((result->ok == bcase->links) && (result->ctx_new == expect) && (result->ctx_free == expect) && (0 == result->stores) &&
+        ((UHOS_TLS_STORE_TEST_NO_STORE == bcase->mode) ||
+         ((result->refs == (uhos_s32)bcase->links + 1) && (result->ctx_shared == bcase->links) && (0 == result->ctx_free_early))))
+    {
+        result->status = 0;
+    }
+    else
+    {
+        UHOS_LOGE("test %s failed: ok %u refs %d new %u shared %u free %u/%u stores %d", g_uhos_tls_store_test_mode_name[bcase->mode],
+                  (unsigned)result->ok, (int)result->refs, (unsigned)result->ctx_new, (unsigned)result->ctx_shared,
+                  (unsigned)result->ctx_free_early, (unsigned)result->ctx_free, (int)result->stores);
+    }
+
+    return result->status;
+}
+
+/**
+ * @brief       将用例与结果格式化为一行JSON
+ * @return      写入的字符数
+ */
+static uhos_s32 uhos_tls_store_test_result_json(const uhos_tls_store_test_case_t *bcase, const uhos_tls_store_test_result_t *result,
+                                                uhos_char *buf, uhos_u32 size)
+{
+    uhos_bench_json_t json = {0};
+
+    if ((UHOS_NULL == bcase) || (UHOS_NULL == result) || (UHOS_NULL == buf) || (bcase->mode >= UHOS_TLS_STORE_TEST_MODE_MAX))
+    {
+        return 0;
+    }
+
+    uhos_bench_json_begin(&json, buf, size);
+    uhos_bench_json_str(&json, "case", g_uhos_tls_store_test_mode_name[bcase->mode]);
+    uhos_bench_json_u32(&json, "links", bcase->links);
+    uhos_bench_json_status(&json, result->status);
+    uhos_bench_json_u32(&json, "ok", result->ok);
+    uhos_bench_json_s32(&json, "refs", result->refs);
+    uhos_bench_json_u32(&json, "ctx_new", result->ctx_new);
+    uhos_bench_json_u32(&json, "ctx_shared", result->ctx_shared);
+    uhos_bench_json_u32(&json, "ctx_free_early", result->ctx_free_early);
+    uhos_bench_json_u32(&json, "ctx_free", result->ctx_free);
+    uhos_bench_json_s32(&json, "stores", result->stores);
+    uhos_bench_json_u32(&json, "elapsed_us", result->elapsed_us);
+
+    return uhos_bench_json_end(&json);
+}
+
+/**
+ * @brief       依次执行各设置方式与释放顺序的用例，每个用例UHOS_TLS_STORE_TEST_LINKS个连接，
+ *              每个用例输出一行JSON
+ * @param[in]   target  被测服务器
+ * @param[in]   print   输出回调
+ * @return      0-全部通过，-1-有用例失败
+ */
+static uhos_s32 uhos_tls_store_test_matrix_run(const uhos_tls_store_test_target_t *target, uhos_bench_print_t print)
+{
+    uhos_tls_store_test_case_t   bcase  = {0};
+    uhos_tls_store_test_result_t result = {0};
+    uhos_char                    line[UHOS_TLS_STORE_TEST_JSON_LEN];
+    uhos_s32                     ret    = 0;
+    uhos_u8                      mode   = 0;
+
+    if ((UHOS_NULL == target) || (UHOS_NULL == print))
+    {
+        return -1;
+    }
+
+    bcase.links = UHOS_TLS_STORE_TEST_LINKS;
+
+    for (mode = 0; mode < UHOS_TLS_STORE_TEST_MODE_MAX; mode++)
+    {
+        bcase.mode = (uhos_tls_store_test_mode_t)mode;
+
+        if (0 != uhos_tls_store_test_run(target, &bcase, &result))
+        {
+            ret = -1;
+        }
+        uhos_tls_store_test_result_json(&bcase, &result, line, sizeof(line));
+        print(line);
+    }
+
+    return ret;
+}
+
+static void uhos_tls_store_test_print(const uhos_char *line)
+{
+    printf("%s\n", line);
+    fflush(stdout);
+}
+
+/**
+ * @brief       读入PEM格式的CA证书，长度含结尾的'\0'
+ * @return      证书长度，0表示失败
+ */
+static uhos_size_t uhos_tls_store_test_ca_load(const char *path)
+{
+    FILE       *fp  = fopen(path, "rb");
+    uhos_size_t len = 0;
+
+    if (UHOS_NULL == fp)
+    {
+        return 0;
+    }
+    len = fread(g_uhos_tls_store_test_ca, 1, sizeof(g_uhos_tls_store_test_ca) - 1, fp);
+    fclose(fp);
+    g_uhos_tls_store_test_ca[len] = '\0';
+
+    return (len > 0) ? (len + 1) : 0;
+}
+
+/**************************************************************************************************/
+/*                                          全局函数实现                                          */
+/**************************************************************************************************/
+int main(int argc, char *argv[])
+{
+    uhos_tls_store_test_target_t target = {0};
+
+    if (3 != argc)
+    {
+        fprintf(stderr, "usage: %s <tls_port> <ca_cert.pem>\n", argv[0]);
+        return 2;
+    }
+
+    target.ca_cert_len = uhos_tls_store_test_ca_load(argv[2]);
+    if (0 == target.ca_cert_len)
+    {
+        UHOS_LOGE("load %s failed", argv[2]);
+        return 1;
+    }
+    target.ca_cert = g_uhos_tls_store_test_ca;
+    target.ip      = "127.0.0.1";
+    target.port    = (uhos_u16)atoi(argv[1]);
+
+    return (0 == uhos_tls_store_test_matrix_run(&target, uhos_tls_store_test_print)) ? 0 : 1;
+}